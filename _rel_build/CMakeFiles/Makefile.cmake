@@ -0,0 +1,950 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "vsomeip3Config.cmake"
+  "vsomeip3ConfigVersion.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/hello_world/CMakeLists.txt"
+  "/root/repo/examples/routingmanagerd/CMakeLists.txt"
+  "/root/repo/implementation/configuration/include/internal.hpp.in"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/benchmark_tests/CMakeLists.txt"
+  "/root/repo/test/common/CMakeLists.txt"
+  "/root/repo/test/internal_routing_disabled_acceptance_test/CMakeLists.txt"
+  "/root/repo/test/internal_routing_disabled_acceptance_test/vsomeip.json"
+  "/root/repo/test/network_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/application_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/application_tests/conf/application_test.json.in"
+  "/root/repo/test/network_tests/application_tests/conf/application_test_availability_starter.sh.in"
+  "/root/repo/test/network_tests/application_tests/conf/application_test_daemon.json.in"
+  "/root/repo/test/network_tests/application_tests/conf/application_test_multiple_init.sh.in"
+  "/root/repo/test/network_tests/application_tests/conf/application_test_no_dispatch_threads.json.in"
+  "/root/repo/test/network_tests/application_tests/conf/application_test_no_dispatch_threads_daemon.json.in"
+  "/root/repo/test/network_tests/application_tests/conf/application_test_single_process.json.in"
+  "/root/repo/test/network_tests/application_tests/conf/application_test_single_process_starter.sh.in"
+  "/root/repo/test/network_tests/application_tests/conf/application_test_starter.sh.in"
+  "/root/repo/test/network_tests/availability_handler_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/availability_handler_tests/conf/availability_handler_test.json.in"
+  "/root/repo/test/network_tests/availability_handler_tests/conf/availability_handler_test_client_starter.sh.in"
+  "/root/repo/test/network_tests/availability_handler_tests/conf/availability_handler_test_service_starter.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_client_local_start.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_external_client_start.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_external_service_start.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_external_starter.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_limited.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_queue_limited.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_random.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_starter.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_client.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_client_limited.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_client_queue_limited.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_client_random.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_client_start.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_service.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_service_limited.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_service_queue_limited.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_service_random.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_service_start.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_local_tcp_starter.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_service_local_start.sh.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_client.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_client_limited_general.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_client_queue_limited_general.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_client_queue_limited_specific.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_client_random.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_service.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_service_limited_general.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_service_queue_limited_general.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_service_queue_limited_specific.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_tcp_service_random.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_udp_client.json.in"
+  "/root/repo/test/network_tests/big_payload_tests/conf/big_payload_test_udp_service.json.in"
+  "/root/repo/test/network_tests/client_id_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_diff_client_ids_diff_ports_master.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_diff_client_ids_diff_ports_slave.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_diff_client_ids_partial_same_ports_master.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_diff_client_ids_partial_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_diff_client_ids_same_ports_master.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_diff_client_ids_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_same_client_ids_diff_ports_master.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_same_client_ids_diff_ports_slave.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_same_client_ids_same_ports_master.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_same_client_ids_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_utility.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_utility_discontinuous_masked_511.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_utility_masked_127.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_utility_masked_4095.json.in"
+  "/root/repo/test/network_tests/client_id_tests/conf/client_id_test_utility_masked_511.json.in"
+  "/root/repo/test/network_tests/configuration_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/configuration_tests/conf/configuration_test.json.in"
+  "/root/repo/test/network_tests/configuration_tests/conf/configuration_test_deprecated.json.in"
+  "/root/repo/test/network_tests/cpu_load_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/cpu_load_tests/conf/cpu_load_test_client_master.json.in"
+  "/root/repo/test/network_tests/cpu_load_tests/conf/cpu_load_test_client_slave.json.in"
+  "/root/repo/test/network_tests/cpu_load_tests/conf/cpu_load_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/cpu_load_tests/conf/cpu_load_test_service_master.json.in"
+  "/root/repo/test/network_tests/cpu_load_tests/conf/cpu_load_test_service_slave.json.in"
+  "/root/repo/test/network_tests/cpu_load_tests/conf/cpu_load_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/cyclic_event_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/cyclic_event_tests/conf/cyclic_event_test_client.json.in"
+  "/root/repo/test/network_tests/cyclic_event_tests/conf/cyclic_event_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/cyclic_event_tests/conf/cyclic_event_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/cyclic_event_tests/conf/service/vsomeip_events.json.in"
+  "/root/repo/test/network_tests/cyclic_event_tests/conf/service/vsomeip_gen.json.in"
+  "/root/repo/test/network_tests/cyclic_event_tests/conf/service/vsomeip_std.json.in"
+  "/root/repo/test/network_tests/debounce_callback_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/debounce_callback_tests/conf/debounce_callback_test_client.json.in"
+  "/root/repo/test/network_tests/debounce_callback_tests/conf/debounce_callback_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/debounce_callback_tests/conf/debounce_callback_test_service.json.in"
+  "/root/repo/test/network_tests/debounce_callback_tests/conf/debounce_callback_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/debounce_filter_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/debounce_filter_tests/conf/debounce_filter_test_client.json.in"
+  "/root/repo/test/network_tests/debounce_filter_tests/conf/debounce_filter_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/debounce_filter_tests/conf/debounce_filter_test_service.json.in"
+  "/root/repo/test/network_tests/debounce_filter_tests/conf/debounce_filter_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/debounce_frequency_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/debounce_frequency_tests/conf/debounce_frequency_test_client.json.in"
+  "/root/repo/test/network_tests/debounce_frequency_tests/conf/debounce_frequency_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/debounce_frequency_tests/conf/debounce_frequency_test_service.json.in"
+  "/root/repo/test/network_tests/debounce_frequency_tests/conf/debounce_frequency_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/debounce_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/debounce_tests/conf/debounce_test_client.json.in"
+  "/root/repo/test/network_tests/debounce_tests/conf/debounce_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/debounce_tests/conf/debounce_test_service.json.in"
+  "/root/repo/test/network_tests/debounce_tests/conf/debounce_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/e2e_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_profile_04_test_client_external.json.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_profile_04_test_external_master_start.sh.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_profile_04_test_external_slave_start.sh.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_profile_04_test_service_external.json.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_profile_07_test_client_external.json.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_profile_07_test_external_master_start.sh.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_profile_07_test_external_slave_start.sh.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_profile_07_test_service_external.json.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_test_client_external.json.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_test_external_master_start.sh.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_test_external_slave_start.sh.in"
+  "/root/repo/test/network_tests/e2e_tests/conf/e2e_test_service_external.json.in"
+  "/root/repo/test/network_tests/event_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/event_tests/conf/event_test_master.json.in"
+  "/root/repo/test/network_tests/event_tests/conf/event_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/event_tests/conf/event_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/event_tests/conf/event_test_slave_tcp.json.in"
+  "/root/repo/test/network_tests/event_tests/conf/event_test_slave_udp.json.in"
+  "/root/repo/test/network_tests/fake_socket_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/fake_socket_tests/conf/multiple_client_one_process.json.in"
+  "/root/repo/test/network_tests/header_factory_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/header_factory_tests/conf/header_factory_test_client.json.in"
+  "/root/repo/test/network_tests/header_factory_tests/conf/header_factory_test_client_start.sh.in"
+  "/root/repo/test/network_tests/header_factory_tests/conf/header_factory_test_send_receive_starter.sh.in"
+  "/root/repo/test/network_tests/header_factory_tests/conf/header_factory_test_service.json.in"
+  "/root/repo/test/network_tests/header_factory_tests/conf/header_factory_test_service_start.sh.in"
+  "/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_diff_ports_master.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_diff_ports_master_tcp.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_diff_ports_master_udp.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_diff_ports_same_service_id_master.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_diff_ports_same_service_id_slave.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_diff_ports_slave.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_diff_ports_slave_tcp.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_diff_ports_slave_udp.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_partial_same_ports_master.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_partial_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_same_ports_master.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_same_ports_master_tcp.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_same_ports_master_udp.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_same_ports_slave_tcp.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_diff_client_ids_same_ports_slave_udp.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_master_starter_qnx.sh.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_same_client_ids_diff_ports_master.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_same_client_ids_diff_ports_slave.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_same_client_ids_same_ports_master.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_same_client_ids_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/initial_event_tests/conf/initial_event_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/lazy_load_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/magic_cookies_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/magic_cookies_tests/conf/magic_cookies_test_client.json.in"
+  "/root/repo/test/network_tests/magic_cookies_tests/conf/magic_cookies_test_client_start.sh.in"
+  "/root/repo/test/network_tests/magic_cookies_tests/conf/magic_cookies_test_service.json.in"
+  "/root/repo/test/network_tests/magic_cookies_tests/conf/magic_cookies_test_service_start.sh.in"
+  "/root/repo/test/network_tests/magic_cookies_tests/conf/magic_cookies_test_starter.sh.in"
+  "/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/malicious_data_tests/conf/malicious_data_test_master.json.in"
+  "/root/repo/test/network_tests/malicious_data_tests/conf/malicious_data_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/memory_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/memory_tests/conf/memory_test_client.json.in"
+  "/root/repo/test/network_tests/memory_tests/conf/memory_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/memory_tests/conf/memory_test_service.json.in"
+  "/root/repo/test/network_tests/memory_tests/conf/memory_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/npdu_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_client_no_npdu.json.in"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_client_no_npdu_start.sh.in"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_client_npdu.json.in"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_client_npdu_start.sh.in"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_service_no_npdu.json.in"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_service_no_npdu_start.sh.in"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_service_npdu.json.in"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_service_npdu_start.sh.in"
+  "/root/repo/test/network_tests/npdu_tests/conf/npdu_test_starter.sh.in"
+  "/root/repo/test/network_tests/offer_stop_offer_test/CMakeLists.txt"
+  "/root/repo/test/network_tests/offer_stop_offer_test/conf/offer_stop_offer_test_client.json.in"
+  "/root/repo/test/network_tests/offer_stop_offer_test/conf/offer_stop_offer_test_client_starter.sh.in"
+  "/root/repo/test/network_tests/offer_stop_offer_test/conf/offer_stop_offer_test_service.json.in"
+  "/root/repo/test/network_tests/offer_stop_offer_test/conf/offer_stop_offer_test_service_starter.sh.in"
+  "/root/repo/test/network_tests/offer_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_big_sd_msg_master.json.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_big_sd_msg_master_starter.sh.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_big_sd_msg_slave.json.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_big_sd_msg_slave_starter.sh.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_external_master.json.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_external_master_starter.sh.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_external_slave.json.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_external_slave_starter.sh.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_local.json.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_local_starter.sh.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_multiple_offerings.json.in"
+  "/root/repo/test/network_tests/offer_tests/conf/offer_test_multiple_offerings_starter.sh.in"
+  "/root/repo/test/network_tests/offered_services_info_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/offered_services_info_tests/conf/offered_services_info_test_local.json.in"
+  "/root/repo/test/network_tests/offered_services_info_tests/conf/offered_services_info_test_local_starter.sh.in"
+  "/root/repo/test/network_tests/payload_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_client_external.json.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_client_external_start.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_client_external_starter.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_client_local.json.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_client_local_and_external_starter.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_client_local_start.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_client_local_starter.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_service.json.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_service_client_external_start.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/external_local_payload_test_service_start.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/local_payload_test_client.json.in"
+  "/root/repo/test/network_tests/payload_tests/conf/local_payload_test_client_start.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/local_payload_test_huge_payload_starter.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/local_payload_test_service.json.in"
+  "/root/repo/test/network_tests/payload_tests/conf/local_payload_test_service_start.sh.in"
+  "/root/repo/test/network_tests/payload_tests/conf/local_payload_test_starter.sh.in"
+  "/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/pending_subscription_tests/conf/pending_subscription_test_master.json.in"
+  "/root/repo/test/network_tests/pending_subscription_tests/conf/pending_subscription_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/registration_check_test/CMakeLists.txt"
+  "/root/repo/test/network_tests/registration_check_test/conf/registration_check_config.json.in"
+  "/root/repo/test/network_tests/registration_check_test/conf/registration_check_start.sh.in"
+  "/root/repo/test/network_tests/registration_check_test/conf/someip_sequence_checker.py.in"
+  "/root/repo/test/network_tests/regression_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/regression_tests/conf/climate_test_master.json.in"
+  "/root/repo/test/network_tests/regression_tests/conf/climate_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/regression_tests/conf/climate_test_slave.json.in"
+  "/root/repo/test/network_tests/regression_tests/conf/climate_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/restart_routing_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/restart_routing_tests/conf/restart_routing_test_autoconfig.json.in"
+  "/root/repo/test/network_tests/restart_routing_tests/conf/restart_routing_test_client.json.in"
+  "/root/repo/test/network_tests/restart_routing_tests/conf/restart_routing_test_client_start.sh.in"
+  "/root/repo/test/network_tests/restart_routing_tests/conf/restart_routing_test_service.json.in"
+  "/root/repo/test/network_tests/restart_routing_tests/conf/restart_routing_test_service_start.sh.in"
+  "/root/repo/test/network_tests/restart_routing_tests/conf/restart_routing_test_starter.sh.in"
+  "/root/repo/test/network_tests/routing_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/routing_tests/conf/external_local_routing_test_client_external.json.in"
+  "/root/repo/test/network_tests/routing_tests/conf/external_local_routing_test_client_external_start.sh.in"
+  "/root/repo/test/network_tests/routing_tests/conf/external_local_routing_test_service.json.in"
+  "/root/repo/test/network_tests/routing_tests/conf/external_local_routing_test_service_start.sh.in"
+  "/root/repo/test/network_tests/routing_tests/conf/external_local_routing_test_starter.sh.in"
+  "/root/repo/test/network_tests/routing_tests/conf/local_routing_test_client.json.in"
+  "/root/repo/test/network_tests/routing_tests/conf/local_routing_test_client_start.sh.in"
+  "/root/repo/test/network_tests/routing_tests/conf/local_routing_test_service.json.in"
+  "/root/repo/test/network_tests/routing_tests/conf/local_routing_test_service_start.sh.in"
+  "/root/repo/test/network_tests/routing_tests/conf/local_routing_test_starter.sh.in"
+  "/root/repo/test/network_tests/second_address_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/second_address_tests/conf/second_address_test_master_client.json.in"
+  "/root/repo/test/network_tests/second_address_tests/conf/second_address_test_master_service_udp.json.in"
+  "/root/repo/test/network_tests/second_address_tests/conf/second_address_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/second_address_tests/conf/second_address_test_slave_client.json.in"
+  "/root/repo/test/network_tests/second_address_tests/conf/second_address_test_slave_service_udp.json.in"
+  "/root/repo/test/network_tests/second_address_tests/conf/second_address_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/security_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/someip_tp_tests/conf/someip_tp_test_master.json.in"
+  "/root/repo/test/network_tests/someip_tp_tests/conf/someip_tp_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/conf/subscribe_notify_one_test_diff_client_ids_diff_ports_master.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/conf/subscribe_notify_one_test_diff_client_ids_diff_ports_master_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/conf/subscribe_notify_one_test_diff_client_ids_diff_ports_master_udp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/conf/subscribe_notify_one_test_diff_client_ids_diff_ports_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/conf/subscribe_notify_one_test_diff_client_ids_diff_ports_slave_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/conf/subscribe_notify_one_test_diff_client_ids_diff_ports_slave_udp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/conf/subscribe_notify_one_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/subscribe_notify_one_tests/conf/subscribe_notify_one_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_master.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_master_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_slave_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_master.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_master_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_master_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_master_tcp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_master_udp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_master_udp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_master_udp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_master_udp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_slave_udp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_slave_udp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_slave_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_slave_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_slave_tcp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_slave_udp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_diff_ports_slave_udp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_partial_same_ports_master.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_partial_same_ports_master_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_partial_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_partial_same_ports_slave_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_master.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_master_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_master_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_master_tcp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_master_udp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_master_udp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_slave_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_slave_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_slave_tcp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_slave_udp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_diff_client_ids_same_ports_slave_udp_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_one_event_two_eventgroups_master.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_one_event_two_eventgroups_master_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_one_event_two_eventgroups_master_starter.sh.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_one_event_two_eventgroups_slave_starter.sh.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_one_event_two_eventgroups_tcp_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_one_event_two_eventgroups_tcp_slave_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_one_event_two_eventgroups_udp_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_one_event_two_eventgroups_udp_slave_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_same_client_ids_diff_ports_master.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_same_client_ids_diff_ports_master_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_same_client_ids_diff_ports_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_same_client_ids_diff_ports_slave_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_same_client_ids_same_ports_master.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_same_client_ids_same_ports_master_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_same_client_ids_same_ports_slave.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_same_client_ids_same_ports_slave_local_tcp.json.in"
+  "/root/repo/test/network_tests/subscribe_notify_tests/conf/subscribe_notify_test_slave_starter.sh.in"
+  "/root/repo/test/network_tests/suspend_resume_tests/CMakeLists.txt"
+  "/root/repo/test/network_tests/suspend_resume_tests/conf/suspend_resume_test_client.json.in"
+  "/root/repo/test/network_tests/suspend_resume_tests/conf/suspend_resume_test_master_starter.sh.in"
+  "/root/repo/test/network_tests/suspend_resume_tests/conf/suspend_resume_test_service.json.in"
+  "/root/repo/test/network_tests/suspend_resume_tests/conf/suspend_resume_test_slave_starter.sh.in"
+  "/root/repo/test/tsan-suppressions.txt"
+  "/root/repo/test/unit_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/endpoint_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/message_deserializer_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/message_payload_impl_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/message_serializer_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/netlink_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/protocol_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/routing_manager_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/security_policy_manager_impl_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/security_policy_manager_impl_tests/policy_manager_impl_unit_test_macro.hpp.in"
+  "/root/repo/test/unit_tests/security_policy_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/security_tests/CMakeLists.txt"
+  "/root/repo/test/unit_tests/utility_utility_tests/CMakeLists.txt"
+  "/root/repo/tools/vsomeip_config_cache/CMakeLists.txt"
+  "/root/repo/tools/vsomeip_ctrl/CMakeLists.txt"
+  "/root/repo/vsomeip3.pc.in"
+  "/root/repo/vsomeip3Config.cmake.in"
+  "/root/repo/vsomeip3ConfigVersion.cmake.in"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/boost_atomic-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/boost_atomic-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/libboost_atomic-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/libboost_atomic-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/boost_thread-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/boost_thread-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/libboost_thread-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/libboost_thread-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/src/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/cmake/gmock.pc.in"
+  "/usr/src/googletest/googlemock/cmake/gmock_main.pc.in"
+  "/usr/src/googletest/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googletest/cmake/Config.cmake.in"
+  "/usr/src/googletest/googletest/cmake/gtest.pc.in"
+  "/usr/src/googletest/googletest/cmake/gtest_main.pc.in"
+  "/usr/src/googletest/googletest/cmake/internal_utils.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "vsomeip3Config.cmake"
+  "vsomeip3ConfigVersion.cmake"
+  "/root/repo/implementation/configuration/include/internal.hpp"
+  "vsomeip3.pc"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/routingmanagerd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/hello_world/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/vsomeip_ctrl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/vsomeip_config_cache/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/tsan-suppressions.txt"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/gtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/gtest/googletest/generated/gmock.pc"
+  "test/gtest/googletest/generated/gmock_main.pc"
+  "test/gtest/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/gtest/googletest/generated/GTestConfigVersion.cmake"
+  "test/gtest/googletest/generated/GTestConfig.cmake"
+  "test/gtest/googletest/generated/gtest.pc"
+  "test/gtest/googletest/generated/gtest_main.pc"
+  "test/gtest/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/client_id_tests/client_id_test_diff_client_ids_diff_ports_master.json"
+  "test/network_tests/client_id_tests/client_id_test_diff_client_ids_diff_ports_slave.json"
+  "test/network_tests/client_id_tests/client_id_test_diff_client_ids_partial_same_ports_master.json"
+  "test/network_tests/client_id_tests/client_id_test_diff_client_ids_partial_same_ports_slave.json"
+  "test/network_tests/client_id_tests/client_id_test_diff_client_ids_same_ports_master.json"
+  "test/network_tests/client_id_tests/client_id_test_diff_client_ids_same_ports_slave.json"
+  "test/network_tests/client_id_tests/client_id_test_master_starter.sh"
+  "test/network_tests/client_id_tests/client_id_test_same_client_ids_diff_ports_master.json"
+  "test/network_tests/client_id_tests/client_id_test_same_client_ids_diff_ports_slave.json"
+  "test/network_tests/client_id_tests/client_id_test_same_client_ids_same_ports_master.json"
+  "test/network_tests/client_id_tests/client_id_test_same_client_ids_same_ports_slave.json"
+  "test/network_tests/client_id_tests/client_id_test_slave_starter.sh"
+  "test/network_tests/client_id_tests/client_id_test_utility.json"
+  "test/network_tests/client_id_tests/client_id_test_utility_discontinuous_masked_511.json"
+  "test/network_tests/client_id_tests/client_id_test_utility_masked_127.json"
+  "test/network_tests/client_id_tests/client_id_test_utility_masked_511.json"
+  "test/network_tests/client_id_tests/client_id_test_utility_masked_4095.json"
+  "test/network_tests/client_id_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_diff_ports_master.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_diff_ports_master_tcp.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_diff_ports_master_udp.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_diff_ports_same_service_id_master.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_diff_ports_same_service_id_slave.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_diff_ports_slave.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_diff_ports_slave_tcp.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_diff_ports_slave_udp.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_partial_same_ports_master.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_partial_same_ports_slave.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_same_ports_master.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_same_ports_master_tcp.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_same_ports_master_udp.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_same_ports_slave.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_same_ports_slave_tcp.json"
+  "test/network_tests/initial_event_tests/initial_event_test_diff_client_ids_same_ports_slave_udp.json"
+  "test/network_tests/initial_event_tests/initial_event_test_master_starter.sh"
+  "test/network_tests/initial_event_tests/initial_event_test_master_starter_qnx.sh"
+  "test/network_tests/initial_event_tests/initial_event_test_same_client_ids_diff_ports_master.json"
+  "test/network_tests/initial_event_tests/initial_event_test_same_client_ids_diff_ports_slave.json"
+  "test/network_tests/initial_event_tests/initial_event_test_same_client_ids_same_ports_master.json"
+  "test/network_tests/initial_event_tests/initial_event_test_same_client_ids_same_ports_slave.json"
+  "test/network_tests/initial_event_tests/initial_event_test_slave_starter.sh"
+  "test/network_tests/initial_event_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_diff_client_ids_diff_ports_master.json"
+  "test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_diff_client_ids_diff_ports_master_tcp.json"
+  "test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_diff_client_ids_diff_ports_master_udp.json"
+  "test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_diff_client_ids_diff_ports_slave.json"
+  "test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_diff_client_ids_diff_ports_slave_tcp.json"
+  "test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_diff_client_ids_diff_ports_slave_udp.json"
+  "test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_master_starter.sh"
+  "test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_slave_starter.sh"
+  "test/network_tests/subscribe_notify_one_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_master.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_master_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_slave.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_slave_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_master.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_master_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_master_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_master_tcp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_master_udp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_master_udp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_master_udp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_master_udp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_slave_udp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_slave_udp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_slave.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_slave_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_slave_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_slave_tcp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_slave_udp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_diff_ports_slave_udp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_partial_same_ports_master.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_partial_same_ports_master_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_partial_same_ports_slave.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_partial_same_ports_slave_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_master.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_master_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_master_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_master_tcp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_master_udp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_master_udp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_slave.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_slave_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_slave_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_slave_tcp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_slave_udp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_diff_client_ids_same_ports_slave_udp_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_master.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_master_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_master_starter.sh"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_slave_starter.sh"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_tcp_slave.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_tcp_slave_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_udp_slave.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_udp_slave_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_same_client_ids_diff_ports_master.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_same_client_ids_diff_ports_master_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_same_client_ids_diff_ports_slave.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_same_client_ids_diff_ports_slave_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_same_client_ids_same_ports_master.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_same_client_ids_same_ports_master_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_same_client_ids_same_ports_slave.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_same_client_ids_same_ports_slave_local_tcp.json"
+  "test/network_tests/subscribe_notify_tests/subscribe_notify_test_slave_starter.sh"
+  "test/network_tests/subscribe_notify_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/restart_routing_tests/restart_routing_test_autoconfig.json"
+  "test/network_tests/restart_routing_tests/restart_routing_test_client.json"
+  "test/network_tests/restart_routing_tests/restart_routing_test_client_start.sh"
+  "test/network_tests/restart_routing_tests/restart_routing_test_service.json"
+  "test/network_tests/restart_routing_tests/restart_routing_test_service_start.sh"
+  "test/network_tests/restart_routing_tests/restart_routing_test_starter.sh"
+  "test/network_tests/restart_routing_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/configuration_tests/configuration_test_deprecated.json"
+  "test/network_tests/configuration_tests/configuration_test.json"
+  "test/network_tests/configuration_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/cpu_load_tests/cpu_load_test_client_master.json"
+  "test/network_tests/cpu_load_tests/cpu_load_test_client_slave.json"
+  "test/network_tests/cpu_load_tests/cpu_load_test_master_starter.sh"
+  "test/network_tests/cpu_load_tests/cpu_load_test_service_master.json"
+  "test/network_tests/cpu_load_tests/cpu_load_test_service_slave.json"
+  "test/network_tests/cpu_load_tests/cpu_load_test_slave_starter.sh"
+  "test/network_tests/cpu_load_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/debounce_callback_tests/debounce_callback_test_client.json"
+  "test/network_tests/debounce_callback_tests/debounce_callback_test_master_starter.sh"
+  "test/network_tests/debounce_callback_tests/debounce_callback_test_service.json"
+  "test/network_tests/debounce_callback_tests/debounce_callback_test_slave_starter.sh"
+  "test/network_tests/debounce_callback_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/debounce_filter_tests/debounce_filter_test_client.json"
+  "test/network_tests/debounce_filter_tests/debounce_filter_test_master_starter.sh"
+  "test/network_tests/debounce_filter_tests/debounce_filter_test_service.json"
+  "test/network_tests/debounce_filter_tests/debounce_filter_test_slave_starter.sh"
+  "test/network_tests/debounce_filter_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/debounce_frequency_tests/debounce_frequency_test_client.json"
+  "test/network_tests/debounce_frequency_tests/debounce_frequency_test_master_starter.sh"
+  "test/network_tests/debounce_frequency_tests/debounce_frequency_test_service.json"
+  "test/network_tests/debounce_frequency_tests/debounce_frequency_test_slave_starter.sh"
+  "test/network_tests/debounce_frequency_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/debounce_tests/debounce_test_client.json"
+  "test/network_tests/debounce_tests/debounce_test_master_starter.sh"
+  "test/network_tests/debounce_tests/debounce_test_service.json"
+  "test/network_tests/debounce_tests/debounce_test_slave_starter.sh"
+  "test/network_tests/debounce_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/e2e_tests/e2e_test_client_external.json"
+  "test/network_tests/e2e_tests/e2e_test_external_master_start.sh"
+  "test/network_tests/e2e_tests/e2e_test_external_slave_start.sh"
+  "test/network_tests/e2e_tests/e2e_test_service_external.json"
+  "test/network_tests/e2e_tests/e2e_profile_04_test_client_external.json"
+  "test/network_tests/e2e_tests/e2e_profile_04_test_external_master_start.sh"
+  "test/network_tests/e2e_tests/e2e_profile_04_test_external_slave_start.sh"
+  "test/network_tests/e2e_tests/e2e_profile_04_test_service_external.json"
+  "test/network_tests/e2e_tests/e2e_profile_07_test_client_external.json"
+  "test/network_tests/e2e_tests/e2e_profile_07_test_external_master_start.sh"
+  "test/network_tests/e2e_tests/e2e_profile_07_test_external_slave_start.sh"
+  "test/network_tests/e2e_tests/e2e_profile_07_test_service_external.json"
+  "test/network_tests/e2e_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/event_tests/event_test_master.json"
+  "test/network_tests/event_tests/event_test_master_starter.sh"
+  "test/network_tests/event_tests/event_test_slave_starter.sh"
+  "test/network_tests/event_tests/event_test_slave_tcp.json"
+  "test/network_tests/event_tests/event_test_slave_udp.json"
+  "test/network_tests/event_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/fake_socket_tests/multiple_client_one_process.json"
+  "test/network_tests/fake_socket_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/lazy_load_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/magic_cookies_tests/magic_cookies_test_client.json"
+  "test/network_tests/magic_cookies_tests/magic_cookies_test_client_start.sh"
+  "test/network_tests/magic_cookies_tests/magic_cookies_test_service.json"
+  "test/network_tests/magic_cookies_tests/magic_cookies_test_service_start.sh"
+  "test/network_tests/magic_cookies_tests/magic_cookies_test_starter.sh"
+  "test/network_tests/magic_cookies_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/malicious_data_tests/malicious_data_test_master.json"
+  "test/network_tests/malicious_data_tests/malicious_data_test_master_starter.sh"
+  "test/network_tests/malicious_data_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/memory_tests/memory_test_client.json"
+  "test/network_tests/memory_tests/memory_test_master_starter.sh"
+  "test/network_tests/memory_tests/memory_test_service.json"
+  "test/network_tests/memory_tests/memory_test_slave_starter.sh"
+  "test/network_tests/memory_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/offer_stop_offer_test/offer_stop_offer_test_client.json"
+  "test/network_tests/offer_stop_offer_test/offer_stop_offer_test_client_starter.sh"
+  "test/network_tests/offer_stop_offer_test/offer_stop_offer_test_service.json"
+  "test/network_tests/offer_stop_offer_test/offer_stop_offer_test_service_starter.sh"
+  "test/network_tests/offer_stop_offer_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/offered_services_info_tests/offered_services_info_test_local.json"
+  "test/network_tests/offered_services_info_tests/offered_services_info_test_local_starter.sh"
+  "test/network_tests/offered_services_info_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/pending_subscription_tests/pending_subscription_test_master.json"
+  "test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh"
+  "test/network_tests/pending_subscription_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/regression_tests/climate_test_master.json"
+  "test/network_tests/regression_tests/climate_test_master_starter.sh"
+  "test/network_tests/regression_tests/climate_test_slave.json"
+  "test/network_tests/regression_tests/climate_test_slave_starter.sh"
+  "test/network_tests/regression_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/second_address_tests/second_address_test_master_client.json"
+  "test/network_tests/second_address_tests/second_address_test_master_service_udp.json"
+  "test/network_tests/second_address_tests/second_address_test_master_starter.sh"
+  "test/network_tests/second_address_tests/second_address_test_slave_client.json"
+  "test/network_tests/second_address_tests/second_address_test_slave_service_udp.json"
+  "test/network_tests/second_address_tests/second_address_test_slave_starter.sh"
+  "test/network_tests/second_address_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/security_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/someip_tp_tests/someip_tp_test_master.json"
+  "test/network_tests/someip_tp_tests/someip_tp_test_master_starter.sh"
+  "test/network_tests/someip_tp_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/offer_tests/offer_test_big_sd_msg_master.json"
+  "test/network_tests/offer_tests/offer_test_big_sd_msg_master_starter.sh"
+  "test/network_tests/offer_tests/offer_test_big_sd_msg_slave.json"
+  "test/network_tests/offer_tests/offer_test_big_sd_msg_slave_starter.sh"
+  "test/network_tests/offer_tests/offer_test_external_master.json"
+  "test/network_tests/offer_tests/offer_test_external_master_starter.sh"
+  "test/network_tests/offer_tests/offer_test_external_slave.json"
+  "test/network_tests/offer_tests/offer_test_external_slave_starter.sh"
+  "test/network_tests/offer_tests/offer_test_local.json"
+  "test/network_tests/offer_tests/offer_test_local_starter.sh"
+  "test/network_tests/offer_tests/offer_test_multiple_offerings.json"
+  "test/network_tests/offer_tests/offer_test_multiple_offerings_starter.sh"
+  "test/network_tests/offer_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/suspend_resume_tests/suspend_resume_test_client.json"
+  "test/network_tests/suspend_resume_tests/suspend_resume_test_master_starter.sh"
+  "test/network_tests/suspend_resume_tests/suspend_resume_test_service.json"
+  "test/network_tests/suspend_resume_tests/suspend_resume_test_slave_starter.sh"
+  "test/network_tests/suspend_resume_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/availability_handler_tests/availability_handler_test.json"
+  "test/network_tests/availability_handler_tests/availability_handler_test_service_starter.sh"
+  "test/network_tests/availability_handler_tests/availability_handler_test_client_starter.sh"
+  "test/network_tests/availability_handler_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/application_tests/application_test.json"
+  "test/network_tests/application_tests/application_test_daemon.json"
+  "test/network_tests/application_tests/application_test_no_dispatch_threads.json"
+  "test/network_tests/application_tests/application_test_no_dispatch_threads_daemon.json"
+  "test/network_tests/application_tests/application_test_starter.sh"
+  "test/network_tests/application_tests/application_test_multiple_init.sh"
+  "test/network_tests/application_tests/application_test_single_process.json"
+  "test/network_tests/application_tests/application_test_single_process_starter.sh"
+  "test/network_tests/application_tests/application_test_availability_starter.sh"
+  "test/network_tests/application_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/routing_tests/external_local_routing_test_client_external.json"
+  "test/network_tests/routing_tests/external_local_routing_test_client_external_start.sh"
+  "test/network_tests/routing_tests/external_local_routing_test_service.json"
+  "test/network_tests/routing_tests/external_local_routing_test_service_start.sh"
+  "test/network_tests/routing_tests/external_local_routing_test_starter.sh"
+  "test/network_tests/routing_tests/local_routing_test_client.json"
+  "test/network_tests/routing_tests/local_routing_test_client_start.sh"
+  "test/network_tests/routing_tests/local_routing_test_service.json"
+  "test/network_tests/routing_tests/local_routing_test_service_start.sh"
+  "test/network_tests/routing_tests/local_routing_test_starter.sh"
+  "test/network_tests/routing_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/big_payload_tests/big_payload_test_client_local_start.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_external_client_start.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_external_service_start.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_external_starter.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_local.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_limited.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_queue_limited.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_random.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_starter.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_client.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_client_limited.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_client_queue_limited.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_client_random.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_client_start.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_service.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_service_limited.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_service_queue_limited.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_service_random.json"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_service_start.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_local_tcp_starter.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_service_local_start.sh"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_client.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_client_limited_general.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_client_queue_limited_general.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_client_queue_limited_specific.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_client_random.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_service.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_service_limited_general.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_service_queue_limited_general.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_service_queue_limited_specific.json"
+  "test/network_tests/big_payload_tests/big_payload_test_tcp_service_random.json"
+  "test/network_tests/big_payload_tests/big_payload_test_udp_client.json"
+  "test/network_tests/big_payload_tests/big_payload_test_udp_service.json"
+  "test/network_tests/big_payload_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/header_factory_tests/header_factory_test_client.json"
+  "test/network_tests/header_factory_tests/header_factory_test_client_start.sh"
+  "test/network_tests/header_factory_tests/header_factory_test_send_receive_starter.sh"
+  "test/network_tests/header_factory_tests/header_factory_test_service.json"
+  "test/network_tests/header_factory_tests/header_factory_test_service_start.sh"
+  "test/network_tests/header_factory_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/npdu_tests/npdu_test_client_no_npdu.json"
+  "test/network_tests/npdu_tests/npdu_test_client_no_npdu_start.sh"
+  "test/network_tests/npdu_tests/npdu_test_client_npdu.json"
+  "test/network_tests/npdu_tests/npdu_test_client_npdu_start.sh"
+  "test/network_tests/npdu_tests/npdu_test_service_no_npdu.json"
+  "test/network_tests/npdu_tests/npdu_test_service_no_npdu_start.sh"
+  "test/network_tests/npdu_tests/npdu_test_service_npdu.json"
+  "test/network_tests/npdu_tests/npdu_test_service_npdu_start.sh"
+  "test/network_tests/npdu_tests/npdu_test_starter.sh"
+  "test/network_tests/npdu_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/payload_tests/external_local_payload_test_client_external.json"
+  "test/network_tests/payload_tests/external_local_payload_test_client_external_start.sh"
+  "test/network_tests/payload_tests/external_local_payload_test_client_external_starter.sh"
+  "test/network_tests/payload_tests/external_local_payload_test_client_local.json"
+  "test/network_tests/payload_tests/external_local_payload_test_client_local_and_external_starter.sh"
+  "test/network_tests/payload_tests/external_local_payload_test_client_local_start.sh"
+  "test/network_tests/payload_tests/external_local_payload_test_client_local_starter.sh"
+  "test/network_tests/payload_tests/external_local_payload_test_service.json"
+  "test/network_tests/payload_tests/external_local_payload_test_service_client_external_start.sh"
+  "test/network_tests/payload_tests/external_local_payload_test_service_start.sh"
+  "test/network_tests/payload_tests/local_payload_test_client.json"
+  "test/network_tests/payload_tests/local_payload_test_client_start.sh"
+  "test/network_tests/payload_tests/local_payload_test_huge_payload_starter.sh"
+  "test/network_tests/payload_tests/local_payload_test_service.json"
+  "test/network_tests/payload_tests/local_payload_test_service_start.sh"
+  "test/network_tests/payload_tests/local_payload_test_starter.sh"
+  "test/network_tests/payload_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/cyclic_event_tests/service/vsomeip_events.json"
+  "test/network_tests/cyclic_event_tests/service/vsomeip_gen.json"
+  "test/network_tests/cyclic_event_tests/service/vsomeip_std.json"
+  "test/network_tests/cyclic_event_tests/cyclic_event_test_client.json"
+  "test/network_tests/cyclic_event_tests/cyclic_event_test_master_starter.sh"
+  "test/network_tests/cyclic_event_tests/cyclic_event_test_slave_starter.sh"
+  "test/network_tests/cyclic_event_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/network_tests/registration_check_test/registration_check_config.json"
+  "test/network_tests/registration_check_test/registration_check_start.sh"
+  "test/network_tests/registration_check_test/someip_sequence_checker.py"
+  "test/network_tests/registration_check_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/endpoint_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/message_payload_impl_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/message_serializer_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/message_deserializer_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/protocol_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/routing_manager_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "/root/repo/test/unit_tests/security_policy_manager_impl_tests/policy_manager_impl_unit_test_macro.hpp"
+  "test/unit_tests/security_policy_manager_impl_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/security_policy_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/security_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/utility_utility_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit_tests/netlink_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/benchmark_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/internal_routing_disabled_acceptance_test/vsomeip.json"
+  "test/internal_routing_disabled_acceptance_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  "CMakeFiles/vsomeip3-cfg.dir/DependInfo.cmake"
+  "CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  "CMakeFiles/vsomeip3-sd.dir/DependInfo.cmake"
+  "CMakeFiles/vsomeip3-e2e.dir/DependInfo.cmake"
+  "CMakeFiles/doc.dir/DependInfo.cmake"
+  "CMakeFiles/tools.dir/DependInfo.cmake"
+  "CMakeFiles/examples.dir/DependInfo.cmake"
+  "examples/routingmanagerd/CMakeFiles/routingmanagerd.dir/DependInfo.cmake"
+  "examples/hello_world/CMakeFiles/hello_world_client.dir/DependInfo.cmake"
+  "examples/hello_world/CMakeFiles/hello_world_service.dir/DependInfo.cmake"
+  "tools/vsomeip_ctrl/CMakeFiles/vsomeip_ctrl.dir/DependInfo.cmake"
+  "tools/vsomeip_config_cache/CMakeFiles/vsomeip_config_cache.dir/DependInfo.cmake"
+  "examples/CMakeFiles/request-sample.dir/DependInfo.cmake"
+  "examples/CMakeFiles/response-sample.dir/DependInfo.cmake"
+  "examples/CMakeFiles/subscribe-sample.dir/DependInfo.cmake"
+  "examples/CMakeFiles/notify-sample.dir/DependInfo.cmake"
+  "test/CMakeFiles/build_tests.dir/DependInfo.cmake"
+  "test/CMakeFiles/check.dir/DependInfo.cmake"
+  "test/CMakeFiles/build_network_tests.dir/DependInfo.cmake"
+  "test/CMakeFiles/build_unit_tests.dir/DependInfo.cmake"
+  "test/CMakeFiles/build_benchmark_tests.dir/DependInfo.cmake"
+  "test/gtest/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "test/gtest/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "test/gtest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "test/network_tests/client_id_tests/CMakeFiles/client_id_test_service.dir/DependInfo.cmake"
+  "test/network_tests/client_id_tests/CMakeFiles/client_id_test_utility.dir/DependInfo.cmake"
+  "test/network_tests/initial_event_tests/CMakeFiles/initial_event_test_client.dir/DependInfo.cmake"
+  "test/network_tests/initial_event_tests/CMakeFiles/initial_event_test_service.dir/DependInfo.cmake"
+  "test/network_tests/initial_event_tests/CMakeFiles/initial_event_test_availability_checker.dir/DependInfo.cmake"
+  "test/network_tests/initial_event_tests/CMakeFiles/initial_event_test_stop_service.dir/DependInfo.cmake"
+  "test/network_tests/subscribe_notify_one_tests/CMakeFiles/subscribe_notify_one_test_service.dir/DependInfo.cmake"
+  "test/network_tests/subscribe_notify_tests/CMakeFiles/subscribe_notify_test_service.dir/DependInfo.cmake"
+  "test/network_tests/subscribe_notify_tests/CMakeFiles/subscribe_notify_test_one_event_two_eventgroups_service.dir/DependInfo.cmake"
+  "test/network_tests/subscribe_notify_tests/CMakeFiles/subscribe_notify_test_one_event_two_eventgroups_client.dir/DependInfo.cmake"
+  "test/network_tests/restart_routing_tests/CMakeFiles/restart_routing_test_service.dir/DependInfo.cmake"
+  "test/network_tests/restart_routing_tests/CMakeFiles/restart_routing_test_client.dir/DependInfo.cmake"
+  "test/network_tests/configuration_tests/CMakeFiles/configuration_test.dir/DependInfo.cmake"
+  "test/network_tests/cpu_load_tests/CMakeFiles/cpu_load_test_service.dir/DependInfo.cmake"
+  "test/network_tests/cpu_load_tests/CMakeFiles/cpu_load_test_client.dir/DependInfo.cmake"
+  "test/network_tests/debounce_callback_tests/CMakeFiles/debounce_callback_test_client.dir/DependInfo.cmake"
+  "test/network_tests/debounce_callback_tests/CMakeFiles/debounce_callback_test_service.dir/DependInfo.cmake"
+  "test/network_tests/debounce_filter_tests/CMakeFiles/debounce_filter_test_client.dir/DependInfo.cmake"
+  "test/network_tests/debounce_filter_tests/CMakeFiles/debounce_filter_test_service.dir/DependInfo.cmake"
+  "test/network_tests/debounce_frequency_tests/CMakeFiles/debounce_frequency_test_client.dir/DependInfo.cmake"
+  "test/network_tests/debounce_frequency_tests/CMakeFiles/debounce_frequency_test_service.dir/DependInfo.cmake"
+  "test/network_tests/debounce_tests/CMakeFiles/debounce_test_client.dir/DependInfo.cmake"
+  "test/network_tests/debounce_tests/CMakeFiles/debounce_test_service.dir/DependInfo.cmake"
+  "test/network_tests/e2e_tests/CMakeFiles/e2e_test_client.dir/DependInfo.cmake"
+  "test/network_tests/e2e_tests/CMakeFiles/e2e_test_service.dir/DependInfo.cmake"
+  "test/network_tests/e2e_tests/CMakeFiles/e2e_profile_04_test_client.dir/DependInfo.cmake"
+  "test/network_tests/e2e_tests/CMakeFiles/e2e_profile_04_test_service.dir/DependInfo.cmake"
+  "test/network_tests/e2e_tests/CMakeFiles/e2e_profile_07_test_client.dir/DependInfo.cmake"
+  "test/network_tests/e2e_tests/CMakeFiles/e2e_profile_07_test_service.dir/DependInfo.cmake"
+  "test/network_tests/event_tests/CMakeFiles/event_test_client.dir/DependInfo.cmake"
+  "test/network_tests/event_tests/CMakeFiles/event_test_service.dir/DependInfo.cmake"
+  "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/DependInfo.cmake"
+  "test/network_tests/magic_cookies_tests/CMakeFiles/magic_cookies_test_client.dir/DependInfo.cmake"
+  "test/network_tests/magic_cookies_tests/CMakeFiles/magic_cookies_test_service.dir/DependInfo.cmake"
+  "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_service.dir/DependInfo.cmake"
+  "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/DependInfo.cmake"
+  "test/network_tests/memory_tests/CMakeFiles/memory_test_client.dir/DependInfo.cmake"
+  "test/network_tests/memory_tests/CMakeFiles/memory_test_service.dir/DependInfo.cmake"
+  "test/network_tests/offer_stop_offer_test/CMakeFiles/offer_stop_offer_test_client.dir/DependInfo.cmake"
+  "test/network_tests/offer_stop_offer_test/CMakeFiles/offer_stop_offer_test_service.dir/DependInfo.cmake"
+  "test/network_tests/offered_services_info_tests/CMakeFiles/offered_services_info_test_service.dir/DependInfo.cmake"
+  "test/network_tests/offered_services_info_tests/CMakeFiles/offered_services_info_test_client.dir/DependInfo.cmake"
+  "test/network_tests/pending_subscription_tests/CMakeFiles/pending_subscription_test_service.dir/DependInfo.cmake"
+  "test/network_tests/pending_subscription_tests/CMakeFiles/pending_subscription_test_sd_msg_sender.dir/DependInfo.cmake"
+  "test/network_tests/regression_tests/CMakeFiles/climate_test_service.dir/DependInfo.cmake"
+  "test/network_tests/regression_tests/CMakeFiles/climate_test_client.dir/DependInfo.cmake"
+  "test/network_tests/second_address_tests/CMakeFiles/second_address_test_service.dir/DependInfo.cmake"
+  "test/network_tests/second_address_tests/CMakeFiles/second_address_test_client.dir/DependInfo.cmake"
+  "test/network_tests/someip_tp_tests/CMakeFiles/someip_tp_test_service.dir/DependInfo.cmake"
+  "test/network_tests/someip_tp_tests/CMakeFiles/someip_tp_test_msg_sender.dir/DependInfo.cmake"
+  "test/network_tests/offer_tests/CMakeFiles/offer_test_service.dir/DependInfo.cmake"
+  "test/network_tests/offer_tests/CMakeFiles/offer_test_multiple_offerings.dir/DependInfo.cmake"
+  "test/network_tests/offer_tests/CMakeFiles/offer_test_client.dir/DependInfo.cmake"
+  "test/network_tests/offer_tests/CMakeFiles/offer_test_service_external.dir/DependInfo.cmake"
+  "test/network_tests/offer_tests/CMakeFiles/offer_test_external_sd_msg_sender.dir/DependInfo.cmake"
+  "test/network_tests/offer_tests/CMakeFiles/offer_test_big_sd_msg_service.dir/DependInfo.cmake"
+  "test/network_tests/offer_tests/CMakeFiles/offer_test_big_sd_msg_client.dir/DependInfo.cmake"
+  "test/network_tests/suspend_resume_tests/CMakeFiles/suspend_resume_test_service.dir/DependInfo.cmake"
+  "test/network_tests/suspend_resume_tests/CMakeFiles/suspend_resume_test_client.dir/DependInfo.cmake"
+  "test/network_tests/availability_handler_tests/CMakeFiles/availability_handler_test_manager.dir/DependInfo.cmake"
+  "test/network_tests/availability_handler_tests/CMakeFiles/availability_handler_test_service.dir/DependInfo.cmake"
+  "test/network_tests/availability_handler_tests/CMakeFiles/availability_handler_test_client.dir/DependInfo.cmake"
+  "test/network_tests/application_tests/CMakeFiles/application_test.dir/DependInfo.cmake"
+  "test/network_tests/application_tests/CMakeFiles/application_test_multiple_init.dir/DependInfo.cmake"
+  "test/network_tests/application_tests/CMakeFiles/application_test_single_process.dir/DependInfo.cmake"
+  "test/network_tests/application_tests/CMakeFiles/application_test_availability.dir/DependInfo.cmake"
+  "test/network_tests/routing_tests/CMakeFiles/local_routing_test_service.dir/DependInfo.cmake"
+  "test/network_tests/routing_tests/CMakeFiles/local_routing_test_client.dir/DependInfo.cmake"
+  "test/network_tests/routing_tests/CMakeFiles/external_local_routing_test_service.dir/DependInfo.cmake"
+  "test/network_tests/big_payload_tests/CMakeFiles/big_payload_test_service.dir/DependInfo.cmake"
+  "test/network_tests/big_payload_tests/CMakeFiles/big_payload_test_client.dir/DependInfo.cmake"
+  "test/network_tests/header_factory_tests/CMakeFiles/header_factory_test.dir/DependInfo.cmake"
+  "test/network_tests/header_factory_tests/CMakeFiles/header_factory_test_client.dir/DependInfo.cmake"
+  "test/network_tests/header_factory_tests/CMakeFiles/header_factory_test_service.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_rmd_client_side.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_rmd_service_side.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_service_1.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_service_2.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_service_3.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_service_4.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_client_1.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_client_2.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_client_3.dir/DependInfo.cmake"
+  "test/network_tests/npdu_tests/CMakeFiles/npdu_test_client_4.dir/DependInfo.cmake"
+  "test/network_tests/payload_tests/CMakeFiles/payload_test_service.dir/DependInfo.cmake"
+  "test/network_tests/payload_tests/CMakeFiles/payload_test_client.dir/DependInfo.cmake"
+  "test/network_tests/cyclic_event_tests/CMakeFiles/cyclic_event_test_service.dir/DependInfo.cmake"
+  "test/network_tests/cyclic_event_tests/CMakeFiles/cyclic_event_test_client.dir/DependInfo.cmake"
+  "test/network_tests/registration_check_test/CMakeFiles/registration_check_test.dir/DependInfo.cmake"
+  "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/DependInfo.cmake"
+  "test/unit_tests/message_payload_impl_tests/CMakeFiles/unit_tests_message_payload_impl_tests.dir/DependInfo.cmake"
+  "test/unit_tests/message_serializer_tests/CMakeFiles/unit_tests_message_serializer_tests.dir/DependInfo.cmake"
+  "test/unit_tests/message_deserializer_tests/CMakeFiles/unit_tests_message_deserializer_tests.dir/DependInfo.cmake"
+  "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/DependInfo.cmake"
+  "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/DependInfo.cmake"
+  "test/unit_tests/security_policy_manager_impl_tests/CMakeFiles/unit_tests_policy_manager_impl_tests.dir/DependInfo.cmake"
+  "test/unit_tests/security_policy_tests/CMakeFiles/unit_tests_policy_tests.dir/DependInfo.cmake"
+  "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/DependInfo.cmake"
+  "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/DependInfo.cmake"
+  "test/unit_tests/netlink_tests/CMakeFiles/unit_tests_netlink_tests.dir/DependInfo.cmake"
+  "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/DependInfo.cmake"
+  "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/implementation/configuration/src/configuration_impl.cpp" "CMakeFiles/vsomeip3-cfg.dir/implementation/configuration/src/configuration_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-cfg.dir/implementation/configuration/src/configuration_impl.cpp.o.d"
+  "/root/repo/implementation/configuration/src/configuration_plugin_impl.cpp" "CMakeFiles/vsomeip3-cfg.dir/implementation/configuration/src/configuration_plugin_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-cfg.dir/implementation/configuration/src/configuration_plugin_impl.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel_build/libvsomeip3-cfg.so" "/root/repo/_rel_build/libvsomeip3-cfg.so.3.5.7"
+  "/root/repo/_rel_build/libvsomeip3-cfg.so.3" "/root/repo/_rel_build/libvsomeip3-cfg.so.3.5.7"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
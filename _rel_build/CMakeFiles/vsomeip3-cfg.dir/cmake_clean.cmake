@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsomeip3-cfg.dir/implementation/configuration/src/configuration_impl.cpp.o"
+  "CMakeFiles/vsomeip3-cfg.dir/implementation/configuration/src/configuration_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-cfg.dir/implementation/configuration/src/configuration_plugin_impl.cpp.o"
+  "CMakeFiles/vsomeip3-cfg.dir/implementation/configuration/src/configuration_plugin_impl.cpp.o.d"
+  "libvsomeip3-cfg.pdb"
+  "libvsomeip3-cfg.so"
+  "libvsomeip3-cfg.so.3"
+  "libvsomeip3-cfg.so.3.5.7"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsomeip3-cfg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/implementation/e2e_protection/src/buffer/buffer.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/buffer/buffer.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/buffer/buffer.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/crc/crc.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/crc/crc.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/crc/crc.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/e2e_provider_impl.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/e2e_provider_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/e2e_provider_impl.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile01/checker.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/checker.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/checker.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile01/profile_01.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/profile_01.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/profile_01.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile01/protector.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/protector.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/protector.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile04/checker.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/checker.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/checker.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile04/profile_04.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/profile_04.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/profile_04.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile04/protector.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/protector.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/protector.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile05/checker.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/checker.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/checker.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile05/profile_05.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/profile_05.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/profile_05.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile05/protector.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/protector.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/protector.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile07/checker.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/checker.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/checker.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile07/profile_07.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/profile_07.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/profile_07.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile07/protector.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/protector.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/protector.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile_custom/checker.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/checker.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/checker.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile_custom/profile_custom.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/profile_custom.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/profile_custom.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2e/profile/profile_custom/protector.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/protector.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/protector.cpp.o.d"
+  "/root/repo/implementation/e2e_protection/src/e2exf/config.cpp" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2exf/config.cpp.o" "gcc" "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2exf/config.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel_build/libvsomeip3-e2e.so" "/root/repo/_rel_build/libvsomeip3-e2e.so.3.5.7"
+  "/root/repo/_rel_build/libvsomeip3-e2e.so.3" "/root/repo/_rel_build/libvsomeip3-e2e.so.3.5.7"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/buffer/buffer.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/buffer/buffer.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/crc/crc.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/crc/crc.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/e2e_provider_impl.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/e2e_provider_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/checker.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/checker.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/profile_01.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/profile_01.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/protector.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile01/protector.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/checker.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/checker.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/profile_04.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/profile_04.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/protector.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile04/protector.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/checker.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/checker.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/profile_05.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/profile_05.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/protector.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile05/protector.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/checker.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/checker.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/profile_07.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/profile_07.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/protector.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile07/protector.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/checker.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/checker.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/profile_custom.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/profile_custom.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/protector.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2e/profile/profile_custom/protector.cpp.o.d"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2exf/config.cpp.o"
+  "CMakeFiles/vsomeip3-e2e.dir/implementation/e2e_protection/src/e2exf/config.cpp.o.d"
+  "libvsomeip3-e2e.pdb"
+  "libvsomeip3-e2e.so"
+  "libvsomeip3-e2e.so.3"
+  "libvsomeip3-e2e.so.3.5.7"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsomeip3-e2e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/implementation/endpoints/src/socket_timestamping.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/socket_timestamping.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/socket_timestamping.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/tcp_receive_buffer.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/tcp_receive_buffer.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/tcp_receive_buffer.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/uring_context.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_context.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_context.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/uring_service.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_service.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_service.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/uring_socket_factory.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_socket_factory.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_socket_factory.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/uring_socket_receiver.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_socket_receiver.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_socket_receiver.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/uring_tcp_socket.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_tcp_socket.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_tcp_socket.cpp.o.d"
+  "/root/repo/implementation/logger/src/async_logger.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/logger/src/async_logger.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/logger/src/async_logger.cpp.o.d"
+  "/root/repo/implementation/logger/src/log_writer.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/logger/src/log_writer.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/logger/src/log_writer.cpp.o.d"
+  "/root/repo/implementation/routing/src/change_detector.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/routing/src/change_detector.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/routing/src/change_detector.cpp.o.d"
+  "/root/repo/implementation/tracing/src/channel_impl.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/channel_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/channel_impl.cpp.o.d"
+  "/root/repo/implementation/tracing/src/filter_table.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/filter_table.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/filter_table.cpp.o.d"
+  "/root/repo/implementation/tracing/src/header.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/header.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/header.cpp.o.d"
+  "/root/repo/implementation/tracing/src/pcapng_writer.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/pcapng_writer.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/pcapng_writer.cpp.o.d"
+  "/root/repo/implementation/utility/src/configuration_cache.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/configuration_cache.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/configuration_cache.cpp.o.d"
+  "/root/repo/implementation/utility/src/handler_statistics.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/handler_statistics.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/handler_statistics.cpp.o.d"
+  "/root/repo/implementation/utility/src/io_shards.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/io_shards.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/io_shards.cpp.o.d"
+  "/root/repo/implementation/utility/src/json_reader.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/json_reader.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/json_reader.cpp.o.d"
+  "/root/repo/implementation/utility/src/latency_statistics.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/latency_statistics.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/latency_statistics.cpp.o.d"
+  "/root/repo/implementation/utility/src/low_latency_io.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/low_latency_io.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/low_latency_io.cpp.o.d"
+  "/root/repo/implementation/utility/src/metrics.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/metrics.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/metrics.cpp.o.d"
+  "/root/repo/implementation/utility/src/metrics_exporter.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/metrics_exporter.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/metrics_exporter.cpp.o.d"
+  "/root/repo/implementation/utility/src/receive_timestamp.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/receive_timestamp.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/receive_timestamp.cpp.o.d"
+  "/root/repo/implementation/utility/src/timing_wheel.cpp" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/timing_wheel.cpp.o" "gcc" "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/timing_wheel.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
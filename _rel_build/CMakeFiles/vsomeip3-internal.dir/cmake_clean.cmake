@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/socket_timestamping.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/socket_timestamping.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/tcp_receive_buffer.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/tcp_receive_buffer.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_context.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_context.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_service.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_service.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_socket_factory.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_socket_factory.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_socket_receiver.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_socket_receiver.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_tcp_socket.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/endpoints/src/uring_tcp_socket.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/logger/src/async_logger.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/logger/src/async_logger.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/logger/src/log_writer.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/logger/src/log_writer.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/routing/src/change_detector.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/routing/src/change_detector.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/channel_impl.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/channel_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/filter_table.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/filter_table.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/header.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/header.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/pcapng_writer.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/tracing/src/pcapng_writer.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/configuration_cache.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/configuration_cache.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/handler_statistics.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/handler_statistics.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/io_shards.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/io_shards.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/json_reader.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/json_reader.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/latency_statistics.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/latency_statistics.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/low_latency_io.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/low_latency_io.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/metrics.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/metrics.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/metrics_exporter.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/metrics_exporter.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/receive_timestamp.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/receive_timestamp.cpp.o.d"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/timing_wheel.cpp.o"
+  "CMakeFiles/vsomeip3-internal.dir/implementation/utility/src/timing_wheel.cpp.o.d"
+  "libvsomeip3-internal.a"
+  "libvsomeip3-internal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsomeip3-internal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/implementation/service_discovery/src/configuration_option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/configuration_option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/configuration_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/deserializer.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/deserializer.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/deserializer.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/entry_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/entry_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/entry_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/eventgroupentry_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/eventgroupentry_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/eventgroupentry_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/ip_option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ip_option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ip_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/ipv4_option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ipv4_option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ipv4_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/ipv6_option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ipv6_option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ipv6_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/load_balancing_option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/load_balancing_option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/load_balancing_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/message_element_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/message_element_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/message_element_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/message_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/message_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/message_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/protection_option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/protection_option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/protection_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/remote_subscription_ack.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/remote_subscription_ack.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/remote_subscription_ack.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/request.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/request.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/request.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/runtime_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/runtime_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/runtime_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/selective_option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/selective_option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/selective_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/service_discovery_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/service_discovery_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/service_discovery_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/serviceentry_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/serviceentry_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/serviceentry_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/subscription.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/subscription.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/subscription.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/unknown_option_impl.cpp" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/unknown_option_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/unknown_option_impl.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel_build/libvsomeip3-sd.so" "/root/repo/_rel_build/libvsomeip3-sd.so.3.5.7"
+  "/root/repo/_rel_build/libvsomeip3-sd.so.3" "/root/repo/_rel_build/libvsomeip3-sd.so.3.5.7"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
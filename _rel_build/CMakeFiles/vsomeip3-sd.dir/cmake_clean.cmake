@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/configuration_option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/configuration_option_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/deserializer.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/deserializer.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/entry_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/entry_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/eventgroupentry_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/eventgroupentry_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ip_option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ip_option_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ipv4_option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ipv4_option_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ipv6_option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/ipv6_option_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/load_balancing_option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/load_balancing_option_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/message_element_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/message_element_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/message_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/message_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/option_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/protection_option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/protection_option_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/remote_subscription_ack.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/remote_subscription_ack.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/request.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/request.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/runtime_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/runtime_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/selective_option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/selective_option_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/service_discovery_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/service_discovery_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/serviceentry_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/serviceentry_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/subscription.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/subscription.cpp.o.d"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/unknown_option_impl.cpp.o"
+  "CMakeFiles/vsomeip3-sd.dir/implementation/service_discovery/src/unknown_option_impl.cpp.o.d"
+  "libvsomeip3-sd.pdb"
+  "libvsomeip3-sd.so"
+  "libvsomeip3-sd.so.3"
+  "libvsomeip3-sd.so.3.5.7"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsomeip3-sd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
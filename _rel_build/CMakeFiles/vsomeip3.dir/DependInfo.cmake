@@ -0,0 +1,121 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/implementation/endpoints/src/abstract_socket_factory.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/abstract_socket_factory.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/abstract_socket_factory.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/asio_socket_factory.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/asio_socket_factory.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/asio_socket_factory.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/client_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/client_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/client_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/credentials.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/credentials.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/credentials.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/endpoint_definition.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_definition.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_definition.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/endpoint_manager_base.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_manager_base.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_manager_base.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/endpoint_manager_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_manager_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_manager_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/local_tcp_client_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_tcp_client_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_tcp_client_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/local_tcp_server_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_tcp_server_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_tcp_server_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/local_uds_client_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_uds_client_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_uds_client_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/local_uds_server_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_uds_server_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_uds_server_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/netlink_connector.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/netlink_connector.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/netlink_connector.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/server_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/server_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/server_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/tcp_client_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tcp_client_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tcp_client_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/tcp_server_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tcp_server_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tcp_server_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/tp.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/tp_message.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp_message.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp_message.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/tp_reassembler.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp_reassembler.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp_reassembler.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/udp_client_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/udp_client_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/udp_client_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/udp_server_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/udp_server_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/udp_server_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/endpoints/src/virtual_server_endpoint_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/virtual_server_endpoint_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/virtual_server_endpoint_impl.cpp.o.d"
+  "/root/repo/implementation/logger/src/logger_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/logger/src/logger_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/logger/src/logger_impl.cpp.o.d"
+  "/root/repo/implementation/logger/src/message.cpp" "CMakeFiles/vsomeip3.dir/implementation/logger/src/message.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/logger/src/message.cpp.o.d"
+  "/root/repo/implementation/message/src/deserializer.cpp" "CMakeFiles/vsomeip3.dir/implementation/message/src/deserializer.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/message/src/deserializer.cpp.o.d"
+  "/root/repo/implementation/message/src/message_base_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/message/src/message_base_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/message/src/message_base_impl.cpp.o.d"
+  "/root/repo/implementation/message/src/message_header_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/message/src/message_header_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/message/src/message_header_impl.cpp.o.d"
+  "/root/repo/implementation/message/src/message_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/message/src/message_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/message/src/message_impl.cpp.o.d"
+  "/root/repo/implementation/message/src/payload_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/message/src/payload_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/message/src/payload_impl.cpp.o.d"
+  "/root/repo/implementation/message/src/serializer.cpp" "CMakeFiles/vsomeip3.dir/implementation/message/src/serializer.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/message/src/serializer.cpp.o.d"
+  "/root/repo/implementation/plugin/src/plugin_manager.cpp" "CMakeFiles/vsomeip3.dir/implementation/plugin/src/plugin_manager.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/plugin/src/plugin_manager.cpp.o.d"
+  "/root/repo/implementation/plugin/src/plugin_manager_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/plugin/src/plugin_manager_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/plugin/src/plugin_manager_impl.cpp.o.d"
+  "/root/repo/implementation/protocol/src/assign_client_ack_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/assign_client_ack_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/assign_client_ack_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/assign_client_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/assign_client_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/assign_client_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/config_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/config_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/config_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/deregister_application_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/deregister_application_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/deregister_application_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/distribute_security_policies_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/distribute_security_policies_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/distribute_security_policies_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/dummy_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/dummy_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/dummy_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/expire_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/expire_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/expire_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/multiple_services_command_base.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/multiple_services_command_base.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/multiple_services_command_base.cpp.o.d"
+  "/root/repo/implementation/protocol/src/offer_service_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offer_service_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offer_service_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/offered_services_request_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offered_services_request_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offered_services_request_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/offered_services_response_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offered_services_response_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offered_services_response_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/ping_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/ping_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/ping_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/pong_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/pong_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/pong_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/register_application_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_application_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_application_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/register_event.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_event.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_event.cpp.o.d"
+  "/root/repo/implementation/protocol/src/register_events_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_events_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_events_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/registered_ack_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/registered_ack_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/registered_ack_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/release_service_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/release_service_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/release_service_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/remove_security_policy_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/remove_security_policy_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/remove_security_policy_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/remove_security_policy_response_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/remove_security_policy_response_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/remove_security_policy_response_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/request_service_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/request_service_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/request_service_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/resend_provided_events_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/resend_provided_events_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/resend_provided_events_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/routing_info_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/routing_info_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/routing_info_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/routing_info_entry.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/routing_info_entry.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/routing_info_entry.cpp.o.d"
+  "/root/repo/implementation/protocol/src/security_policy_response_command_base.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/security_policy_response_command_base.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/security_policy_response_command_base.cpp.o.d"
+  "/root/repo/implementation/protocol/src/send_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/send_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/send_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/service_command_base.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/service_command_base.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/service_command_base.cpp.o.d"
+  "/root/repo/implementation/protocol/src/simple_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/simple_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/simple_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/stop_offer_service_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/stop_offer_service_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/stop_offer_service_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/subscribe_ack_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_ack_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_ack_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/subscribe_ack_command_base.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_ack_command_base.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_ack_command_base.cpp.o.d"
+  "/root/repo/implementation/protocol/src/subscribe_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/subscribe_command_base.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_command_base.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_command_base.cpp.o.d"
+  "/root/repo/implementation/protocol/src/subscribe_nack_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_nack_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_nack_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/suspend_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/suspend_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/suspend_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/unregister_event_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unregister_event_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unregister_event_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/unsubscribe_ack_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unsubscribe_ack_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unsubscribe_ack_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/unsubscribe_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unsubscribe_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unsubscribe_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/update_security_credentials_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_credentials_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_credentials_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/update_security_policy_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_policy_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_policy_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/update_security_policy_response_command.cpp" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_policy_response_command.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_policy_response_command.cpp.o.d"
+  "/root/repo/implementation/routing/src/event.cpp" "CMakeFiles/vsomeip3.dir/implementation/routing/src/event.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/routing/src/event.cpp.o.d"
+  "/root/repo/implementation/routing/src/eventgroupinfo.cpp" "CMakeFiles/vsomeip3.dir/implementation/routing/src/eventgroupinfo.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/routing/src/eventgroupinfo.cpp.o.d"
+  "/root/repo/implementation/routing/src/remote_subscription.cpp" "CMakeFiles/vsomeip3.dir/implementation/routing/src/remote_subscription.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/routing/src/remote_subscription.cpp.o.d"
+  "/root/repo/implementation/routing/src/routing_manager_base.cpp" "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_base.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_base.cpp.o.d"
+  "/root/repo/implementation/routing/src/routing_manager_client.cpp" "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_client.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_client.cpp.o.d"
+  "/root/repo/implementation/routing/src/routing_manager_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_impl.cpp.o.d"
+  "/root/repo/implementation/routing/src/routing_manager_stub.cpp" "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_stub.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_stub.cpp.o.d"
+  "/root/repo/implementation/routing/src/serviceinfo.cpp" "CMakeFiles/vsomeip3.dir/implementation/routing/src/serviceinfo.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/routing/src/serviceinfo.cpp.o.d"
+  "/root/repo/implementation/runtime/src/application_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/runtime/src/application_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/runtime/src/application_impl.cpp.o.d"
+  "/root/repo/implementation/runtime/src/runtime.cpp" "CMakeFiles/vsomeip3.dir/implementation/runtime/src/runtime.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/runtime/src/runtime.cpp.o.d"
+  "/root/repo/implementation/runtime/src/runtime_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/runtime/src/runtime_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/runtime/src/runtime_impl.cpp.o.d"
+  "/root/repo/implementation/security/src/policy.cpp" "CMakeFiles/vsomeip3.dir/implementation/security/src/policy.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/security/src/policy.cpp.o.d"
+  "/root/repo/implementation/security/src/policy_manager_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/security/src/policy_manager_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/security/src/policy_manager_impl.cpp.o.d"
+  "/root/repo/implementation/security/src/security.cpp" "CMakeFiles/vsomeip3.dir/implementation/security/src/security.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/security/src/security.cpp.o.d"
+  "/root/repo/implementation/tracing/src/connector_impl.cpp" "CMakeFiles/vsomeip3.dir/implementation/tracing/src/connector_impl.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/tracing/src/connector_impl.cpp.o.d"
+  "/root/repo/implementation/utility/src/criticalsection.cpp" "CMakeFiles/vsomeip3.dir/implementation/utility/src/criticalsection.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/utility/src/criticalsection.cpp.o.d"
+  "/root/repo/implementation/utility/src/instrumentation.cpp" "CMakeFiles/vsomeip3.dir/implementation/utility/src/instrumentation.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/utility/src/instrumentation.cpp.o.d"
+  "/root/repo/implementation/utility/src/snapshot.cpp" "CMakeFiles/vsomeip3.dir/implementation/utility/src/snapshot.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/utility/src/snapshot.cpp.o.d"
+  "/root/repo/implementation/utility/src/utility.cpp" "CMakeFiles/vsomeip3.dir/implementation/utility/src/utility.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/utility/src/utility.cpp.o.d"
+  "/root/repo/implementation/utility/src/wrappers.cpp" "CMakeFiles/vsomeip3.dir/implementation/utility/src/wrappers.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/utility/src/wrappers.cpp.o.d"
+  "/root/repo/implementation/utility/src/wrappers_qnx.cpp" "CMakeFiles/vsomeip3.dir/implementation/utility/src/wrappers_qnx.cpp.o" "gcc" "CMakeFiles/vsomeip3.dir/implementation/utility/src/wrappers_qnx.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel_build/libvsomeip3.so" "/root/repo/_rel_build/libvsomeip3.so.3.5.7"
+  "/root/repo/_rel_build/libvsomeip3.so.3" "/root/repo/_rel_build/libvsomeip3.so.3.5.7"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
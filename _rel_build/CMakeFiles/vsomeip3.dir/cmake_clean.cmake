@@ -0,0 +1,201 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/abstract_socket_factory.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/abstract_socket_factory.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/asio_socket_factory.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/asio_socket_factory.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/client_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/client_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/credentials.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/credentials.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_definition.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_definition.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_manager_base.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_manager_base.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_manager_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/endpoint_manager_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_tcp_client_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_tcp_client_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_tcp_server_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_tcp_server_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_uds_client_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_uds_client_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_uds_server_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/local_uds_server_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/netlink_connector.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/netlink_connector.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/server_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/server_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tcp_client_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tcp_client_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tcp_server_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tcp_server_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp_message.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp_message.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp_reassembler.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/tp_reassembler.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/udp_client_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/udp_client_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/udp_server_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/udp_server_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/virtual_server_endpoint_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/endpoints/src/virtual_server_endpoint_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/logger/src/logger_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/logger/src/logger_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/logger/src/message.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/logger/src/message.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/deserializer.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/deserializer.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/message_base_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/message_base_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/message_header_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/message_header_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/message_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/message_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/payload_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/payload_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/serializer.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/message/src/serializer.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/plugin/src/plugin_manager.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/plugin/src/plugin_manager.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/plugin/src/plugin_manager_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/plugin/src/plugin_manager_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/assign_client_ack_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/assign_client_ack_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/assign_client_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/assign_client_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/config_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/config_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/deregister_application_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/deregister_application_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/distribute_security_policies_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/distribute_security_policies_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/dummy_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/dummy_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/expire_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/expire_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/multiple_services_command_base.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/multiple_services_command_base.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offer_service_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offer_service_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offered_services_request_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offered_services_request_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offered_services_response_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/offered_services_response_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/ping_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/ping_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/pong_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/pong_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_application_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_application_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_event.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_event.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_events_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/register_events_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/registered_ack_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/registered_ack_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/release_service_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/release_service_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/remove_security_policy_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/remove_security_policy_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/remove_security_policy_response_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/remove_security_policy_response_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/request_service_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/request_service_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/resend_provided_events_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/resend_provided_events_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/routing_info_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/routing_info_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/routing_info_entry.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/routing_info_entry.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/security_policy_response_command_base.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/security_policy_response_command_base.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/send_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/send_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/service_command_base.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/service_command_base.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/simple_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/simple_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/stop_offer_service_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/stop_offer_service_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_ack_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_ack_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_ack_command_base.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_ack_command_base.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_command_base.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_command_base.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_nack_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/subscribe_nack_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/suspend_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/suspend_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unregister_event_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unregister_event_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unsubscribe_ack_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unsubscribe_ack_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unsubscribe_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/unsubscribe_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_credentials_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_credentials_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_policy_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_policy_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_policy_response_command.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/protocol/src/update_security_policy_response_command.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/event.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/event.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/eventgroupinfo.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/eventgroupinfo.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/remote_subscription.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/remote_subscription.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_base.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_base.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_client.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_client.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_stub.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/routing_manager_stub.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/serviceinfo.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/routing/src/serviceinfo.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/runtime/src/application_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/runtime/src/application_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/runtime/src/runtime.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/runtime/src/runtime.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/runtime/src/runtime_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/runtime/src/runtime_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/security/src/policy.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/security/src/policy.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/security/src/policy_manager_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/security/src/policy_manager_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/security/src/security.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/security/src/security.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/tracing/src/connector_impl.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/tracing/src/connector_impl.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/criticalsection.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/criticalsection.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/instrumentation.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/instrumentation.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/snapshot.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/snapshot.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/utility.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/utility.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/wrappers.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/wrappers.cpp.o.d"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/wrappers_qnx.cpp.o"
+  "CMakeFiles/vsomeip3.dir/implementation/utility/src/wrappers_qnx.cpp.o.d"
+  "libvsomeip3.pdb"
+  "libvsomeip3.so"
+  "libvsomeip3.so.3"
+  "libvsomeip3.so.3.5.7"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsomeip3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_rel_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("examples/routingmanagerd")
+subdirs("examples/hello_world")
+subdirs("tools/vsomeip_ctrl")
+subdirs("tools/vsomeip_config_cache")
+subdirs("examples")
+subdirs("test")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/notify-sample.dir/notify-sample.cpp.o"
+  "CMakeFiles/notify-sample.dir/notify-sample.cpp.o.d"
+  "notify-sample"
+  "notify-sample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/notify-sample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/request-sample.dir/request-sample.cpp.o"
+  "CMakeFiles/request-sample.dir/request-sample.cpp.o.d"
+  "request-sample"
+  "request-sample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/request-sample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/response-sample.dir/response-sample.cpp.o"
+  "CMakeFiles/response-sample.dir/response-sample.cpp.o.d"
+  "response-sample"
+  "response-sample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/response-sample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
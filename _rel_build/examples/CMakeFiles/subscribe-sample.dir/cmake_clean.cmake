@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscribe-sample.dir/subscribe-sample.cpp.o"
+  "CMakeFiles/subscribe-sample.dir/subscribe-sample.cpp.o.d"
+  "subscribe-sample"
+  "subscribe-sample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subscribe-sample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
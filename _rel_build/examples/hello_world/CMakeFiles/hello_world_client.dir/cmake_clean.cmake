@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hello_world_client.dir/hello_world_client_main.cpp.o"
+  "CMakeFiles/hello_world_client.dir/hello_world_client_main.cpp.o.d"
+  "hello_world_client"
+  "hello_world_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hello_world_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hello_world_service.dir/hello_world_service_main.cpp.o"
+  "CMakeFiles/hello_world_service.dir/hello_world_service_main.cpp.o.d"
+  "hello_world_service"
+  "hello_world_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hello_world_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
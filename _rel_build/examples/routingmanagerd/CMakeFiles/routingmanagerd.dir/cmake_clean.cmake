@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/routingmanagerd.dir/routingmanagerd.cpp.o"
+  "CMakeFiles/routingmanagerd.dir/routingmanagerd.cpp.o.d"
+  "routingmanagerd"
+  "routingmanagerd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/routingmanagerd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_rel_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("gtest")
+subdirs("common")
+subdirs("network_tests")
+subdirs("unit_tests")
+subdirs("benchmark_tests")
+subdirs("internal_routing_disabled_acceptance_test")
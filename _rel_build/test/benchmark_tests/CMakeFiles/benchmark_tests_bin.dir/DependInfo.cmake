@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/benchmark_tests/e2e_tests/allocation_counter.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/e2e_tests/allocation_counter.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/e2e_tests/allocation_counter.cpp.o.d"
+  "/root/repo/test/benchmark_tests/e2e_tests/bm_event_fan_out.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/e2e_tests/bm_event_fan_out.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/e2e_tests/bm_event_fan_out.cpp.o.d"
+  "/root/repo/test/benchmark_tests/e2e_tests/bm_round_trip.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/e2e_tests/bm_round_trip.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/e2e_tests/bm_round_trip.cpp.o.d"
+  "/root/repo/test/benchmark_tests/endpoint_tests/bm_npdu_timings.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_npdu_timings.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_npdu_timings.cpp.o.d"
+  "/root/repo/test/benchmark_tests/endpoint_tests/bm_train.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_train.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_train.cpp.o.d"
+  "/root/repo/test/benchmark_tests/endpoint_tests/bm_uring_socket_receiver.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_uring_socket_receiver.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_uring_socket_receiver.cpp.o.d"
+  "/root/repo/test/benchmark_tests/endpoint_tests/bm_uring_tcp_socket.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_uring_tcp_socket.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_uring_tcp_socket.cpp.o.d"
+  "/root/repo/test/benchmark_tests/main.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/main.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/main.cpp.o.d"
+  "/root/repo/test/benchmark_tests/routing_tests/bm_notify_batch.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/routing_tests/bm_notify_batch.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/routing_tests/bm_notify_batch.cpp.o.d"
+  "/root/repo/test/benchmark_tests/routing_tests/bm_routing_snapshot.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/routing_tests/bm_routing_snapshot.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/routing_tests/bm_routing_snapshot.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_check_credentials.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_check_credentials.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_check_credentials.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_check_routing_credentials.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_check_routing_credentials.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_check_routing_credentials.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_get_client_to_sec_client_mapping.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_client_to_sec_client_mapping.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_client_to_sec_client_mapping.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_get_clients.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_clients.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_clients.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_get_sec_client_to_clients_mapping.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_sec_client_to_clients_mapping.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_sec_client_to_clients_mapping.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_is_client_allowed.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_client_allowed.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_client_allowed.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_is_offer_allowed.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_offer_allowed.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_offer_allowed.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_is_policy_update_allowed.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_policy_update_allowed.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_policy_update_allowed.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_load.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_load_policies.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_policies.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_policies.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_load_security_policy_extensions.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_security_policy_extensions.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_security_policy_extensions.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_load_security_update_whitelist.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_security_update_whitelist.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_security_update_whitelist.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_remove_client_to_sec_client_mapping.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_remove_client_to_sec_client_mapping.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_remove_client_to_sec_client_mapping.cpp.o.d"
+  "/root/repo/test/benchmark_tests/security_tests/bm_remove_security_policy.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_remove_security_policy.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_remove_security_policy.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_async_logger.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_async_logger.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_async_logger.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_configuration_cache.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_configuration_cache.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_configuration_cache.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_handler_statistics.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_handler_statistics.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_handler_statistics.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_instrumentation.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_instrumentation.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_instrumentation.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_io_shards.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_io_shards.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_io_shards.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_json_reader.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_json_reader.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_json_reader.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_log_macros.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_log_macros.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_log_macros.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_low_latency_io.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_low_latency_io.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_low_latency_io.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_metrics.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_metrics.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_metrics.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_pcapng_writer.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_pcapng_writer.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_pcapng_writer.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_timing_wheel.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_timing_wheel.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_timing_wheel.cpp.o.d"
+  "/root/repo/test/benchmark_tests/utility_tests/bm_trace_filter_table.cpp" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_trace_filter_table.cpp.o" "gcc" "test/benchmark_tests/CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_trace_filter_table.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-cfg.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,81 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_tests_bin.dir/e2e_tests/allocation_counter.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/e2e_tests/allocation_counter.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/e2e_tests/bm_event_fan_out.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/e2e_tests/bm_event_fan_out.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/e2e_tests/bm_round_trip.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/e2e_tests/bm_round_trip.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_npdu_timings.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_npdu_timings.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_train.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_train.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_uring_socket_receiver.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_uring_socket_receiver.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_uring_tcp_socket.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/endpoint_tests/bm_uring_tcp_socket.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/main.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/main.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/routing_tests/bm_notify_batch.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/routing_tests/bm_notify_batch.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/routing_tests/bm_routing_snapshot.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/routing_tests/bm_routing_snapshot.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_check_credentials.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_check_credentials.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_check_routing_credentials.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_check_routing_credentials.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_client_to_sec_client_mapping.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_client_to_sec_client_mapping.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_clients.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_clients.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_sec_client_to_clients_mapping.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_get_sec_client_to_clients_mapping.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_client_allowed.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_client_allowed.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_offer_allowed.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_offer_allowed.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_policy_update_allowed.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_is_policy_update_allowed.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_policies.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_policies.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_security_policy_extensions.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_security_policy_extensions.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_security_update_whitelist.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_load_security_update_whitelist.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_remove_client_to_sec_client_mapping.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_remove_client_to_sec_client_mapping.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_remove_security_policy.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/security_tests/bm_remove_security_policy.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_async_logger.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_async_logger.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_configuration_cache.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_configuration_cache.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_handler_statistics.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_handler_statistics.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_instrumentation.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_instrumentation.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_io_shards.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_io_shards.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_json_reader.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_json_reader.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_log_macros.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_log_macros.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_low_latency_io.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_low_latency_io.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_metrics.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_metrics.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_pcapng_writer.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_pcapng_writer.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_timing_wheel.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_timing_wheel.cpp.o.d"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_trace_filter_table.cpp.o"
+  "CMakeFiles/benchmark_tests_bin.dir/utility_tests/bm_trace_filter_table.cpp.o.d"
+  "benchmark_tests_bin"
+  "benchmark_tests_bin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_tests_bin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
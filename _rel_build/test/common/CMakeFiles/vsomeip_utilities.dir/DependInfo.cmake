@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/common/src/utility.cpp" "test/common/CMakeFiles/vsomeip_utilities.dir/src/utility.cpp.o" "gcc" "test/common/CMakeFiles/vsomeip_utilities.dir/src/utility.cpp.o.d"
+  "/root/repo/test/common/src/vsomeip_app_utilities.cpp" "test/common/CMakeFiles/vsomeip_utilities.dir/src/vsomeip_app_utilities.cpp.o" "gcc" "test/common/CMakeFiles/vsomeip_utilities.dir/src/vsomeip_app_utilities.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
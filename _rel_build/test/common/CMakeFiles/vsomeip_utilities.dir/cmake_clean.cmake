@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsomeip_utilities.dir/src/utility.cpp.o"
+  "CMakeFiles/vsomeip_utilities.dir/src/utility.cpp.o.d"
+  "CMakeFiles/vsomeip_utilities.dir/src/vsomeip_app_utilities.cpp.o"
+  "CMakeFiles/vsomeip_utilities.dir/src/vsomeip_app_utilities.cpp.o.d"
+  "libvsomeip_utilities.pdb"
+  "libvsomeip_utilities.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsomeip_utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
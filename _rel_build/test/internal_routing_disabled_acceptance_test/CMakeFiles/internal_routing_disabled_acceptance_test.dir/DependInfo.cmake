@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/internal_routing_disabled_acceptance_test/applet.cpp" "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/applet.cpp.o" "gcc" "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/applet.cpp.o.d"
+  "/root/repo/test/internal_routing_disabled_acceptance_test/client.cpp" "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/client.cpp.o" "gcc" "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/client.cpp.o.d"
+  "/root/repo/test/internal_routing_disabled_acceptance_test/main.cpp" "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/main.cpp.o" "gcc" "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/main.cpp.o.d"
+  "/root/repo/test/internal_routing_disabled_acceptance_test/server.cpp" "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/server.cpp.o" "gcc" "test/internal_routing_disabled_acceptance_test/CMakeFiles/internal_routing_disabled_acceptance_test.dir/server.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
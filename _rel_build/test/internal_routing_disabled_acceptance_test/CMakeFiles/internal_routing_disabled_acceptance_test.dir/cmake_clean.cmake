@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/internal_routing_disabled_acceptance_test.dir/applet.cpp.o"
+  "CMakeFiles/internal_routing_disabled_acceptance_test.dir/applet.cpp.o.d"
+  "CMakeFiles/internal_routing_disabled_acceptance_test.dir/client.cpp.o"
+  "CMakeFiles/internal_routing_disabled_acceptance_test.dir/client.cpp.o.d"
+  "CMakeFiles/internal_routing_disabled_acceptance_test.dir/main.cpp.o"
+  "CMakeFiles/internal_routing_disabled_acceptance_test.dir/main.cpp.o.d"
+  "CMakeFiles/internal_routing_disabled_acceptance_test.dir/server.cpp.o"
+  "CMakeFiles/internal_routing_disabled_acceptance_test.dir/server.cpp.o.d"
+  "internal_routing_disabled_acceptance_test"
+  "internal_routing_disabled_acceptance_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/internal_routing_disabled_acceptance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/internal_routing_disabled_acceptance_test
+# Build directory: /root/repo/_rel_build/test/internal_routing_disabled_acceptance_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[internal_routing_disabled_acceptance_test]=] "/root/repo/_rel_build/test/internal_routing_disabled_acceptance_test/internal_routing_disabled_acceptance_test")
+set_tests_properties([=[internal_routing_disabled_acceptance_test]=] PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_rel_build;VSOMEIP_CONFIGURATION=/root/repo/_rel_build/test/internal_routing_disabled_acceptance_test/vsomeip.json" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/test/internal_routing_disabled_acceptance_test/CMakeLists.txt;25;add_test;/root/repo/test/internal_routing_disabled_acceptance_test/CMakeLists.txt;0;")
@@ -0,0 +1,42 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests
+# Build directory: /root/repo/_rel_build/test/network_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("client_id_tests")
+subdirs("initial_event_tests")
+subdirs("subscribe_notify_one_tests")
+subdirs("subscribe_notify_tests")
+subdirs("restart_routing_tests")
+subdirs("configuration_tests")
+subdirs("cpu_load_tests")
+subdirs("debounce_callback_tests")
+subdirs("debounce_filter_tests")
+subdirs("debounce_frequency_tests")
+subdirs("debounce_tests")
+subdirs("e2e_tests")
+subdirs("event_tests")
+subdirs("fake_socket_tests")
+subdirs("lazy_load_tests")
+subdirs("magic_cookies_tests")
+subdirs("malicious_data_tests")
+subdirs("memory_tests")
+subdirs("offer_stop_offer_test")
+subdirs("offered_services_info_tests")
+subdirs("pending_subscription_tests")
+subdirs("regression_tests")
+subdirs("second_address_tests")
+subdirs("security_tests")
+subdirs("someip_tp_tests")
+subdirs("offer_tests")
+subdirs("suspend_resume_tests")
+subdirs("availability_handler_tests")
+subdirs("application_tests")
+subdirs("routing_tests")
+subdirs("big_payload_tests")
+subdirs("header_factory_tests")
+subdirs("npdu_tests")
+subdirs("payload_tests")
+subdirs("cyclic_event_tests")
+subdirs("registration_check_test")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/application_test_availability.dir/application_test_availability.cpp.o"
+  "CMakeFiles/application_test_availability.dir/application_test_availability.cpp.o.d"
+  "application_test_availability"
+  "application_test_availability.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/application_test_availability.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
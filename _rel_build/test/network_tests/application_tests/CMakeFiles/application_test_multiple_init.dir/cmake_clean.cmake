@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/application_test_multiple_init.dir/application_test_multiple_init.cpp.o"
+  "CMakeFiles/application_test_multiple_init.dir/application_test_multiple_init.cpp.o.d"
+  "application_test_multiple_init"
+  "application_test_multiple_init.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/application_test_multiple_init.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/application_test_single_process.dir/application_test_single_process.cpp.o"
+  "CMakeFiles/application_test_single_process.dir/application_test_single_process.cpp.o.d"
+  "application_test_single_process"
+  "application_test_single_process.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/application_test_single_process.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
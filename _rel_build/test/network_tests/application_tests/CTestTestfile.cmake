@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/application_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/application_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[application_test]=] "/root/repo/_rel_build/test/network_tests/application_tests/application_test_starter.sh")
+set_tests_properties([=[application_test]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/application_tests/CMakeLists.txt;45;add_custom_test;/root/repo/test/network_tests/application_tests/CMakeLists.txt;0;")
+add_test([=[application_test_multiple_init]=] "/root/repo/_rel_build/test/network_tests/application_tests/application_test_multiple_init.sh")
+set_tests_properties([=[application_test_multiple_init]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/application_tests/CMakeLists.txt;52;add_custom_test;/root/repo/test/network_tests/application_tests/CMakeLists.txt;0;")
+add_test([=[application_test_single_process]=] "/root/repo/_rel_build/test/network_tests/application_tests/application_test_single_process_starter.sh")
+set_tests_properties([=[application_test_single_process]=] PROPERTIES  TIMEOUT "80" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/application_tests/CMakeLists.txt;93;add_custom_test;/root/repo/test/network_tests/application_tests/CMakeLists.txt;0;")
+add_test([=[application_test_availability]=] "/root/repo/_rel_build/test/network_tests/application_tests/application_test_availability_starter.sh")
+set_tests_properties([=[application_test_availability]=] PROPERTIES  TIMEOUT "80" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/application_tests/CMakeLists.txt;100;add_custom_test;/root/repo/test/network_tests/application_tests/CMakeLists.txt;0;")
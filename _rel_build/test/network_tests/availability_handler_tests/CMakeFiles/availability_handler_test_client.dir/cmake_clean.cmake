@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/availability_handler_test_client.dir/availability_handler_test_client.cpp.o"
+  "CMakeFiles/availability_handler_test_client.dir/availability_handler_test_client.cpp.o.d"
+  "availability_handler_test_client"
+  "availability_handler_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/availability_handler_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/availability_handler_test_manager.dir/availability_handler_test_manager.cpp.o"
+  "CMakeFiles/availability_handler_test_manager.dir/availability_handler_test_manager.cpp.o.d"
+  "availability_handler_test_manager"
+  "availability_handler_test_manager.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/availability_handler_test_manager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/availability_handler_test_service.dir/availability_handler_test_service.cpp.o"
+  "CMakeFiles/availability_handler_test_service.dir/availability_handler_test_service.cpp.o.d"
+  "availability_handler_test_service"
+  "availability_handler_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/availability_handler_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/availability_handler_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/availability_handler_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[availability_handler_test]=] "/root/repo/_rel_build/test/network_tests/availability_handler_tests/availability_handler_test_manager")
+set_tests_properties([=[availability_handler_test]=] PROPERTIES  TIMEOUT "90" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/availability_handler_tests/CMakeLists.txt;43;add_custom_test;/root/repo/test/network_tests/availability_handler_tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/big_payload_test_client.dir/big_payload_test_client.cpp.o"
+  "CMakeFiles/big_payload_test_client.dir/big_payload_test_client.cpp.o.d"
+  "big_payload_test_client"
+  "big_payload_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/big_payload_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
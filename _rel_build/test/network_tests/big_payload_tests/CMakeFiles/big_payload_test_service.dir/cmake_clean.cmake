@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/big_payload_test_service.dir/big_payload_test_service.cpp.o"
+  "CMakeFiles/big_payload_test_service.dir/big_payload_test_service.cpp.o.d"
+  "big_payload_test_service"
+  "big_payload_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/big_payload_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
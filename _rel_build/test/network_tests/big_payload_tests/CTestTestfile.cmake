@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/big_payload_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/big_payload_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[big_payload_test_local]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_local_starter.sh")
+set_tests_properties([=[big_payload_test_local]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;68;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_local_random]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_local_starter.sh" "RANDOM")
+set_tests_properties([=[big_payload_test_local_random]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;73;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_local_limited]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_local_starter.sh" "LIMITED")
+set_tests_properties([=[big_payload_test_local_limited]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;78;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_local_queue_limited]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_local_starter.sh" "QUEUELIMITEDGENERAL")
+set_tests_properties([=[big_payload_test_local_queue_limited]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;83;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_local_tcp]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_local_tcp_starter.sh")
+set_tests_properties([=[big_payload_test_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;88;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_local_tcp_random]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_local_tcp_starter.sh" "RANDOM")
+set_tests_properties([=[big_payload_test_local_tcp_random]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;93;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_local_tcp_limited]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_local_tcp_starter.sh" "LIMITED")
+set_tests_properties([=[big_payload_test_local_tcp_limited]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;98;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_local_tcp_queue_limited]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_local_tcp_starter.sh" "QUEUELIMITEDGENERAL")
+set_tests_properties([=[big_payload_test_local_tcp_queue_limited]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;103;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_external]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_external_starter.sh")
+set_tests_properties([=[big_payload_test_external]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;108;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_external_random]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_external_starter.sh" "RANDOM")
+set_tests_properties([=[big_payload_test_external_random]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;113;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_external_limited]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_external_starter.sh" "LIMITED")
+set_tests_properties([=[big_payload_test_external_limited]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;118;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_external_limited_general]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_external_starter.sh" "LIMITEDGENERAL")
+set_tests_properties([=[big_payload_test_external_limited_general]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;123;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_external_queue_limited_general]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_external_starter.sh" "QUEUELIMITEDGENERAL")
+set_tests_properties([=[big_payload_test_external_queue_limited_general]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;128;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_external_queue_limited_specific]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_external_starter.sh" "QUEUELIMITEDSPECIFIC")
+set_tests_properties([=[big_payload_test_external_queue_limited_specific]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;133;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
+add_test([=[big_payload_test_external_udp]=] "/root/repo/_rel_build/test/network_tests/big_payload_tests/big_payload_test_external_starter.sh" "UDP")
+set_tests_properties([=[big_payload_test_external_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;138;add_custom_test;/root/repo/test/network_tests/big_payload_tests/CMakeLists.txt;0;")
@@ -0,0 +1,10 @@
+#!/bin/bash
+# Copyright (C) 2015-2017 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+# Start the service
+export VSOMEIP_APPLICATION_NAME=big_payload_test_service
+export VSOMEIP_CONFIGURATION=big_payload_test_local.json
+./big_payload_test_service
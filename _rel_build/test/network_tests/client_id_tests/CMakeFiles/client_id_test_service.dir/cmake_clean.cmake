@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/client_id_test_service.dir/client_id_test_service.cpp.o"
+  "CMakeFiles/client_id_test_service.dir/client_id_test_service.cpp.o.d"
+  "client_id_test_service"
+  "client_id_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/client_id_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
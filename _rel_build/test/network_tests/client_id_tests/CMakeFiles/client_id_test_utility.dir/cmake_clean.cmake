@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/client_id_test_utility.dir/client_id_test_utility.cpp.o"
+  "CMakeFiles/client_id_test_utility.dir/client_id_test_utility.cpp.o.d"
+  "client_id_test_utility"
+  "client_id_test_utility.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/client_id_test_utility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
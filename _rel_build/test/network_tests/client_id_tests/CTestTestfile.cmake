@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/client_id_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/client_id_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[client_id_test_diff_client_ids_diff_ports]=] "/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_master_starter.sh" "client_id_test_diff_client_ids_diff_ports_master.json")
+set_tests_properties([=[client_id_test_diff_client_ids_diff_ports]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;57;add_custom_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;0;")
+add_test([=[client_id_test_diff_client_ids_same_ports]=] "/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_master_starter.sh" "client_id_test_diff_client_ids_same_ports_master.json")
+set_tests_properties([=[client_id_test_diff_client_ids_same_ports]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;62;add_custom_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;0;")
+add_test([=[client_id_test_diff_client_ids_partial_same_ports]=] "/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_master_starter.sh" "client_id_test_diff_client_ids_partial_same_ports_master.json")
+set_tests_properties([=[client_id_test_diff_client_ids_partial_same_ports]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;67;add_custom_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;0;")
+add_test([=[client_id_test_utility]=] "/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility")
+set_tests_properties([=[client_id_test_utility]=] PROPERTIES  ENVIRONMENT "VSOMEIP_CONFIGURATION=/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility.json" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;72;add_custom_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;0;")
+add_test([=[client_id_test_utility_masked_511]=] "/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility")
+set_tests_properties([=[client_id_test_utility_masked_511]=] PROPERTIES  ENVIRONMENT "VSOMEIP_CONFIGURATION=/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility_masked_511.json" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;78;add_custom_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;0;")
+add_test([=[client_id_test_utility_masked_4095]=] "/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility")
+set_tests_properties([=[client_id_test_utility_masked_4095]=] PROPERTIES  ENVIRONMENT "VSOMEIP_CONFIGURATION=/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility_masked_4095.json" TIMEOUT "600" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;84;add_custom_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;0;")
+add_test([=[client_id_test_utility_masked_127]=] "/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility")
+set_tests_properties([=[client_id_test_utility_masked_127]=] PROPERTIES  ENVIRONMENT "VSOMEIP_CONFIGURATION=/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility_masked_127.json" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;91;add_custom_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;0;")
+add_test([=[client_id_test_utility_discontinuous_masked_511]=] "/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility")
+set_tests_properties([=[client_id_test_utility_discontinuous_masked_511]=] PROPERTIES  ENVIRONMENT "VSOMEIP_CONFIGURATION=/root/repo/_rel_build/test/network_tests/client_id_tests/client_id_test_utility_discontinuous_masked_511.json" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;97;add_custom_test;/root/repo/test/network_tests/client_id_tests/CMakeLists.txt;0;")
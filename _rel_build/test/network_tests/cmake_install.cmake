@@ -0,0 +1,85 @@
+# Install script for directory: /root/repo/test/network_tests
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_rel_build/test/network_tests/client_id_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/initial_event_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/subscribe_notify_one_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/restart_routing_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/configuration_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/cpu_load_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/debounce_callback_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/debounce_filter_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/debounce_frequency_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/debounce_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/e2e_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/event_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/fake_socket_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/lazy_load_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/magic_cookies_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/malicious_data_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/memory_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/offer_stop_offer_test/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/offered_services_info_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/pending_subscription_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/regression_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/second_address_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/security_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/someip_tp_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/offer_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/suspend_resume_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/availability_handler_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/application_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/routing_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/big_payload_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/header_factory_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/npdu_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/payload_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/cyclic_event_tests/cmake_install.cmake")
+  include("/root/repo/_rel_build/test/network_tests/registration_check_test/cmake_install.cmake")
+
+endif()
+
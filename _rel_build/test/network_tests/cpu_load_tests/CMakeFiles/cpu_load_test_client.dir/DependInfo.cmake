@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/network_tests/cpu_load_tests/cpu_load_measurer.cpp" "test/network_tests/cpu_load_tests/CMakeFiles/cpu_load_test_client.dir/cpu_load_measurer.cpp.o" "gcc" "test/network_tests/cpu_load_tests/CMakeFiles/cpu_load_test_client.dir/cpu_load_measurer.cpp.o.d"
+  "/root/repo/test/network_tests/cpu_load_tests/cpu_load_test_client.cpp" "test/network_tests/cpu_load_tests/CMakeFiles/cpu_load_test_client.dir/cpu_load_test_client.cpp.o" "gcc" "test/network_tests/cpu_load_tests/CMakeFiles/cpu_load_test_client.dir/cpu_load_test_client.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpu_load_test_client.dir/cpu_load_measurer.cpp.o"
+  "CMakeFiles/cpu_load_test_client.dir/cpu_load_measurer.cpp.o.d"
+  "CMakeFiles/cpu_load_test_client.dir/cpu_load_test_client.cpp.o"
+  "CMakeFiles/cpu_load_test_client.dir/cpu_load_test_client.cpp.o.d"
+  "cpu_load_test_client"
+  "cpu_load_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpu_load_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
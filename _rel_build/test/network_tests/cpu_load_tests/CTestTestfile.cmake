@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/cpu_load_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/cpu_load_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cpu_load_test]=] "/root/repo/_rel_build/test/network_tests/cpu_load_tests/cpu_load_test_master_starter.sh")
+set_tests_properties([=[cpu_load_test]=] PROPERTIES  TIMEOUT "3000" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/cpu_load_tests/CMakeLists.txt;45;add_custom_test;/root/repo/test/network_tests/cpu_load_tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cyclic_event_test_client.dir/cyclic_event_test_client.cpp.o"
+  "CMakeFiles/cyclic_event_test_client.dir/cyclic_event_test_client.cpp.o.d"
+  "cyclic_event_test_client"
+  "cyclic_event_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cyclic_event_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
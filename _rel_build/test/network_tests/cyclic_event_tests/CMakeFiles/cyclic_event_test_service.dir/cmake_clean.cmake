@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cyclic_event_test_service.dir/cyclic_event_test_service.cpp.o"
+  "CMakeFiles/cyclic_event_test_service.dir/cyclic_event_test_service.cpp.o.d"
+  "cyclic_event_test_service"
+  "cyclic_event_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cyclic_event_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debounce_callback_test_service.dir/debounce_callback_test_service.cpp.o"
+  "CMakeFiles/debounce_callback_test_service.dir/debounce_callback_test_service.cpp.o.d"
+  "debounce_callback_test_service"
+  "debounce_callback_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/debounce_callback_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
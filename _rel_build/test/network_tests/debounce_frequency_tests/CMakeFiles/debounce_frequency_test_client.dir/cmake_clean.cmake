@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debounce_frequency_test_client.dir/debounce_frequency_test_client.cpp.o"
+  "CMakeFiles/debounce_frequency_test_client.dir/debounce_frequency_test_client.cpp.o.d"
+  "debounce_frequency_test_client"
+  "debounce_frequency_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/debounce_frequency_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
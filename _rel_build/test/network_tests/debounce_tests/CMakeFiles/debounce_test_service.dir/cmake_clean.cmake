@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debounce_test_service.dir/debounce_test_service.cpp.o"
+  "CMakeFiles/debounce_test_service.dir/debounce_test_service.cpp.o.d"
+  "debounce_test_service"
+  "debounce_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/debounce_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/debounce_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/debounce_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[debounce_test]=] "/root/repo/_rel_build/test/network_tests/debounce_tests/debounce_test_master_starter.sh")
+set_tests_properties([=[debounce_test]=] PROPERTIES  TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/debounce_tests/CMakeLists.txt;38;add_custom_test;/root/repo/test/network_tests/debounce_tests/CMakeLists.txt;0;")
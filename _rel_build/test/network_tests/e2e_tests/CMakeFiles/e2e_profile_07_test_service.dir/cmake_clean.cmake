@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/e2e_profile_07_test_service.dir/e2e_profile_07_test_service.cpp.o"
+  "CMakeFiles/e2e_profile_07_test_service.dir/e2e_profile_07_test_service.cpp.o.d"
+  "e2e_profile_07_test_service"
+  "e2e_profile_07_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/e2e_profile_07_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
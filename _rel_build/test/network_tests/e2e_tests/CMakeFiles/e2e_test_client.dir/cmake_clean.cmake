@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/e2e_test_client.dir/e2e_test_client.cpp.o"
+  "CMakeFiles/e2e_test_client.dir/e2e_test_client.cpp.o.d"
+  "e2e_test_client"
+  "e2e_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/e2e_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/e2e_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/e2e_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[e2e_test_external]=] "/root/repo/_rel_build/test/network_tests/e2e_tests/e2e_test_external_master_start.sh" "e2e_test_client_external.json")
+set_tests_properties([=[e2e_test_external]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/e2e_tests/CMakeLists.txt;38;add_custom_test;/root/repo/test/network_tests/e2e_tests/CMakeLists.txt;0;")
+add_test([=[e2e_profile_04_test_external]=] "/root/repo/_rel_build/test/network_tests/e2e_tests/e2e_profile_04_test_external_master_start.sh" "e2e_profile_04_test_client_external.json")
+set_tests_properties([=[e2e_profile_04_test_external]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/e2e_tests/CMakeLists.txt;74;add_custom_test;/root/repo/test/network_tests/e2e_tests/CMakeLists.txt;0;")
+add_test([=[e2e_profile_07_test_external]=] "/root/repo/_rel_build/test/network_tests/e2e_tests/e2e_profile_07_test_external_master_start.sh" "e2e_profile_07_test_client_external.json")
+set_tests_properties([=[e2e_profile_07_test_external]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/e2e_tests/CMakeLists.txt;112;add_custom_test;/root/repo/test/network_tests/e2e_tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/event_test_client.dir/event_test_client.cpp.o"
+  "CMakeFiles/event_test_client.dir/event_test_client.cpp.o.d"
+  "event_test_client"
+  "event_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/event_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/event_test_service.dir/event_test_service.cpp.o"
+  "CMakeFiles/event_test_service.dir/event_test_service.cpp.o.d"
+  "event_test_service"
+  "event_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/event_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
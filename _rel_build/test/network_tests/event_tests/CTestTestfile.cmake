@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/event_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/event_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[event_test_payload_fixed_udp]=] "/root/repo/_rel_build/test/network_tests/event_tests/event_test_master_starter.sh" "PAYLOAD_FIXED" "UDP")
+set_tests_properties([=[event_test_payload_fixed_udp]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/event_tests/CMakeLists.txt;39;add_custom_test;/root/repo/test/network_tests/event_tests/CMakeLists.txt;0;")
+add_test([=[event_test_payload_fixed_tcp]=] "/root/repo/_rel_build/test/network_tests/event_tests/event_test_master_starter.sh" "PAYLOAD_FIXED" "TCP")
+set_tests_properties([=[event_test_payload_fixed_tcp]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/event_tests/CMakeLists.txt;46;add_custom_test;/root/repo/test/network_tests/event_tests/CMakeLists.txt;0;")
+add_test([=[event_test_payload_dynamic_udp]=] "/root/repo/_rel_build/test/network_tests/event_tests/event_test_master_starter.sh" "PAYLOAD_DYNAMIC" "UDP")
+set_tests_properties([=[event_test_payload_dynamic_udp]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/event_tests/CMakeLists.txt;53;add_custom_test;/root/repo/test/network_tests/event_tests/CMakeLists.txt;0;")
+add_test([=[event_test_payload_dynamic_tcp]=] "/root/repo/_rel_build/test/network_tests/event_tests/event_test_master_starter.sh" "PAYLOAD_DYNAMIC" "TCP")
+set_tests_properties([=[event_test_payload_dynamic_tcp]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/event_tests/CMakeLists.txt;60;add_custom_test;/root/repo/test/network_tests/event_tests/CMakeLists.txt;0;")
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/network_tests/fake_socket_tests/helpers/app.cpp" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/app.cpp.o" "gcc" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/app.cpp.o.d"
+  "/root/repo/test/network_tests/fake_socket_tests/helpers/base_fake_socket_fixture.cpp" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/base_fake_socket_fixture.cpp.o" "gcc" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/base_fake_socket_fixture.cpp.o.d"
+  "/root/repo/test/network_tests/fake_socket_tests/helpers/fake_tcp_socket_handle.cpp" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/fake_tcp_socket_handle.cpp.o" "gcc" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/fake_tcp_socket_handle.cpp.o.d"
+  "/root/repo/test/network_tests/fake_socket_tests/helpers/service_state.cpp" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/service_state.cpp.o" "gcc" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/service_state.cpp.o.d"
+  "/root/repo/test/network_tests/fake_socket_tests/helpers/socket_manager.cpp" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/socket_manager.cpp.o" "gcc" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/helpers/socket_manager.cpp.o.d"
+  "/root/repo/test/network_tests/fake_socket_tests/main.cpp" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/main.cpp.o" "gcc" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/main.cpp.o.d"
+  "/root/repo/test/network_tests/fake_socket_tests/test_connection_restoration.cpp" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/test_connection_restoration.cpp.o" "gcc" "test/network_tests/fake_socket_tests/CMakeFiles/test_with_fake_sockets.dir/test_connection_restoration.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
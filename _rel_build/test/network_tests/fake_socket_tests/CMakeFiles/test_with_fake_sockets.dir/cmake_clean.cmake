@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/app.cpp.o"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/app.cpp.o.d"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/base_fake_socket_fixture.cpp.o"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/base_fake_socket_fixture.cpp.o.d"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/fake_tcp_socket_handle.cpp.o"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/fake_tcp_socket_handle.cpp.o.d"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/service_state.cpp.o"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/service_state.cpp.o.d"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/socket_manager.cpp.o"
+  "CMakeFiles/test_with_fake_sockets.dir/helpers/socket_manager.cpp.o.d"
+  "CMakeFiles/test_with_fake_sockets.dir/main.cpp.o"
+  "CMakeFiles/test_with_fake_sockets.dir/main.cpp.o.d"
+  "CMakeFiles/test_with_fake_sockets.dir/test_connection_restoration.cpp.o"
+  "CMakeFiles/test_with_fake_sockets.dir/test_connection_restoration.cpp.o.d"
+  "test_with_fake_sockets"
+  "test_with_fake_sockets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_with_fake_sockets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/fake_socket_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/fake_socket_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_with_fake_sockets]=] "/root/repo/_rel_build/test/network_tests/fake_socket_tests/test_with_fake_sockets")
+set_tests_properties([=[test_with_fake_sockets]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/network_tests/fake_socket_tests/CMakeLists.txt;27;add_test;/root/repo/test/network_tests/fake_socket_tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/header_factory_test.dir/header_factory_test.cpp.o"
+  "CMakeFiles/header_factory_test.dir/header_factory_test.cpp.o.d"
+  "header_factory_test"
+  "header_factory_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/header_factory_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
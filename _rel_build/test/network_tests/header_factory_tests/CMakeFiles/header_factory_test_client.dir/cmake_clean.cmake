@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/header_factory_test_client.dir/header_factory_test_client.cpp.o"
+  "CMakeFiles/header_factory_test_client.dir/header_factory_test_client.cpp.o.d"
+  "header_factory_test_client"
+  "header_factory_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/header_factory_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
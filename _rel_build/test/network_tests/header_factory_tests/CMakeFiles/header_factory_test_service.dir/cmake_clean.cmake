@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/header_factory_test_service.dir/header_factory_test_service.cpp.o"
+  "CMakeFiles/header_factory_test_service.dir/header_factory_test_service.cpp.o.d"
+  "header_factory_test_service"
+  "header_factory_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/header_factory_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/header_factory_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/header_factory_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[header_factory_test]=] "/root/repo/_rel_build/test/network_tests/header_factory_tests/header_factory_test")
+set_tests_properties([=[header_factory_test]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/header_factory_tests/CMakeLists.txt;52;add_custom_test;/root/repo/test/network_tests/header_factory_tests/CMakeLists.txt;0;")
+add_test([=[header_factory_test_send_receive]=] "/root/repo/_rel_build/test/network_tests/header_factory_tests/header_factory_test_send_receive_starter.sh")
+set_tests_properties([=[header_factory_test_send_receive]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/header_factory_tests/CMakeLists.txt;58;add_custom_test;/root/repo/test/network_tests/header_factory_tests/CMakeLists.txt;0;")
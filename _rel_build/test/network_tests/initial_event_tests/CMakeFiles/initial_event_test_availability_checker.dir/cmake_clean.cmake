@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/initial_event_test_availability_checker.dir/initial_event_test_availability_checker.cpp.o"
+  "CMakeFiles/initial_event_test_availability_checker.dir/initial_event_test_availability_checker.cpp.o.d"
+  "initial_event_test_availability_checker"
+  "initial_event_test_availability_checker.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/initial_event_test_availability_checker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/initial_event_test_client.dir/initial_event_test_client.cpp.o"
+  "CMakeFiles/initial_event_test_client.dir/initial_event_test_client.cpp.o.d"
+  "initial_event_test_client"
+  "initial_event_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/initial_event_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
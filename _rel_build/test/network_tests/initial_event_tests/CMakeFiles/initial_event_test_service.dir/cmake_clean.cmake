@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/initial_event_test_service.dir/initial_event_test_service.cpp.o"
+  "CMakeFiles/initial_event_test_service.dir/initial_event_test_service.cpp.o.d"
+  "initial_event_test_service"
+  "initial_event_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/initial_event_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
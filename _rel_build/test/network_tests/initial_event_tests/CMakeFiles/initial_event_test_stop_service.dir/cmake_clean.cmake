@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/initial_event_test_stop_service.dir/initial_event_test_stop_service.cpp.o"
+  "CMakeFiles/initial_event_test_stop_service.dir/initial_event_test_stop_service.cpp.o.d"
+  "initial_event_test_stop_service"
+  "initial_event_test_stop_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/initial_event_test_stop_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
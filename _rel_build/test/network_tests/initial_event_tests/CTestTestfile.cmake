@@ -0,0 +1,62 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/initial_event_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/initial_event_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[initial_event_test_diff_client_ids_diff_ports_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_udp.json" "UDP")
+set_tests_properties([=[initial_event_test_diff_client_ids_diff_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;71;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_diff_client_ids_diff_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_tcp.json" "TCP")
+set_tests_properties([=[initial_event_test_diff_client_ids_diff_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;79;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_diff_client_ids_diff_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master.json" "TCP_AND_UDP")
+set_tests_properties([=[initial_event_test_diff_client_ids_diff_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;87;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_diff_client_ids_same_ports_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master_udp.json" "UDP")
+set_tests_properties([=[initial_event_test_diff_client_ids_same_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;95;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_diff_client_ids_same_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master_tcp.json" "TCP")
+set_tests_properties([=[initial_event_test_diff_client_ids_same_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;103;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_diff_client_ids_same_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master.json" "TCP_AND_UDP")
+set_tests_properties([=[initial_event_test_diff_client_ids_same_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;111;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_diff_client_ids_partial_same_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_partial_same_ports_master.json" "TCP_AND_UDP")
+set_tests_properties([=[initial_event_test_diff_client_ids_partial_same_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;119;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_diff_client_ids_diff_ports_same_service_id_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_same_service_id_master.json" "TCP_AND_UDP" "SAME_SERVICE_ID")
+set_tests_properties([=[initial_event_test_diff_client_ids_diff_ports_same_service_id_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;127;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_udp.json" "UDP" "MULTIPLE_EVENTS")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;137;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_tcp.json" "TCP" "MULTIPLE_EVENTS")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;145;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_udp_and_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master.json" "TCP_AND_UDP" "MULTIPLE_EVENTS")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_udp_and_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;153;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_same_ports_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master_udp.json" "UDP" "MULTIPLE_EVENTS")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_same_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;161;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_same_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master_tcp.json" "TCP" "MULTIPLE_EVENTS")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_same_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;169;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_same_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master.json" "TCP_AND_UDP" "MULTIPLE_EVENTS")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_same_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;177;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_partial_same_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_partial_same_ports_master.json" "TCP_AND_UDP" "MULTIPLE_EVENTS")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_partial_same_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;185;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_same_service_id_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_same_service_id_master.json" "TCP_AND_UDP" "SAME_SERVICE_ID" "MULTIPLE_EVENTS")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_same_service_id_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;193;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_diff_ports_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_udp.json" "UDP" "MULTIPLE_EVENTS" "SUBSCRIBE_ON_AVAILABILITY")
+set_tests_properties([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_diff_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;203;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_diff_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_tcp.json" "TCP" "MULTIPLE_EVENTS" "SUBSCRIBE_ON_AVAILABILITY")
+set_tests_properties([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_diff_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;211;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_diff_ports_udp_and_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master.json" "TCP_AND_UDP" "MULTIPLE_EVENTS" "SUBSCRIBE_ON_AVAILABILITY")
+set_tests_properties([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_diff_ports_udp_and_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;219;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_same_ports_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master_udp.json" "UDP" "MULTIPLE_EVENTS" "SUBSCRIBE_ON_AVAILABILITY")
+set_tests_properties([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_same_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;227;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_same_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master_tcp.json" "TCP" "MULTIPLE_EVENTS" "SUBSCRIBE_ON_AVAILABILITY")
+set_tests_properties([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_same_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;235;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_same_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_same_ports_master.json" "TCP_AND_UDP" "MULTIPLE_EVENTS" "SUBSCRIBE_ON_AVAILABILITY")
+set_tests_properties([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_same_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;243;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_partial_same_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_partial_same_ports_master.json" "TCP_AND_UDP" "MULTIPLE_EVENTS" "SUBSCRIBE_ON_AVAILABILITY")
+set_tests_properties([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_partial_same_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;251;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_diff_ports_same_service_id_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_same_service_id_master.json" "TCP_AND_UDP" "SAME_SERVICE_ID" "MULTIPLE_EVENTS" "SUBSCRIBE_ON_AVAILABILITY")
+set_tests_properties([=[initial_event_test_multiple_events_subscribe_on_availability_diff_client_ids_diff_ports_same_service_id_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;259;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_partial_subscription_udp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_udp.json" "UDP" "MULTIPLE_EVENTS" "SUBSCRIBE_ONLY_ONE")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_partial_subscription_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;269;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_partial_subscription_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_tcp.json" "TCP" "MULTIPLE_EVENTS" "SUBSCRIBE_ONLY_ONE")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_partial_subscription_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;277;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_partial_subscription_udp_and_tcp]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master.json" "TCP_AND_UDP" "MULTIPLE_EVENTS" "SUBSCRIBE_ONLY_ONE")
+set_tests_properties([=[initial_event_test_multiple_events_diff_client_ids_diff_ports_partial_subscription_udp_and_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;285;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
+add_test([=[initial_event_test_diff_client_ids_diff_ports_client_subscribes_twice]=] "/root/repo/_rel_build/test/network_tests/initial_event_tests/initial_event_test_master_starter.sh" "initial_event_test_diff_client_ids_diff_ports_master_udp.json" "UDP" "CLIENT_SUBSCRIBES_TWICE")
+set_tests_properties([=[initial_event_test_diff_client_ids_diff_ports_client_subscribes_twice]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;295;add_custom_test;/root/repo/test/network_tests/initial_event_tests/CMakeLists.txt;0;")
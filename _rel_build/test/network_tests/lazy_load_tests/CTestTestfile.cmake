@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/lazy_load_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/lazy_load_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
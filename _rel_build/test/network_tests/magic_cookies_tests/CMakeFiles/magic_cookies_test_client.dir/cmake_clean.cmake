@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/magic_cookies_test_client.dir/magic_cookies_test_client.cpp.o"
+  "CMakeFiles/magic_cookies_test_client.dir/magic_cookies_test_client.cpp.o.d"
+  "magic_cookies_test_client"
+  "magic_cookies_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/magic_cookies_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/magic_cookies_test_service.dir/magic_cookies_test_service.cpp.o"
+  "CMakeFiles/magic_cookies_test_service.dir/magic_cookies_test_service.cpp.o.d"
+  "magic_cookies_test_service"
+  "magic_cookies_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/magic_cookies_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
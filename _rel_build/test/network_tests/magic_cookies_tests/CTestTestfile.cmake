@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/magic_cookies_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/magic_cookies_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[magic_cookies_test]=] "/root/repo/_rel_build/test/network_tests/magic_cookies_tests/magic_cookies_test_starter.sh")
+set_tests_properties([=[magic_cookies_test]=] PROPERTIES  TIMEOUT "250" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/magic_cookies_tests/CMakeLists.txt;44;add_custom_test;/root/repo/test/network_tests/magic_cookies_tests/CMakeLists.txt;0;")
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/implementation/message/src/deserializer.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/message/src/deserializer.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/message/src/deserializer.cpp.o.d"
+  "/root/repo/implementation/message/src/message_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/message/src/message_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/message/src/message_impl.cpp.o.d"
+  "/root/repo/implementation/message/src/payload_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/message/src/payload_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/message/src/payload_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/configuration_option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/configuration_option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/configuration_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/entry_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/entry_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/entry_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/eventgroupentry_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/eventgroupentry_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/eventgroupentry_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/ip_option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ip_option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ip_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/ipv4_option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv4_option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv4_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/ipv6_option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv6_option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv6_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/load_balancing_option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/load_balancing_option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/load_balancing_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/message_element_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_element_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_element_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/message_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/protection_option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/protection_option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/protection_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/selective_option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/selective_option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/selective_option_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/serviceentry_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/serviceentry_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/serviceentry_impl.cpp.o.d"
+  "/root/repo/implementation/service_discovery/src/unknown_option_impl.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/unknown_option_impl.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/unknown_option_impl.cpp.o.d"
+  "/root/repo/test/network_tests/malicious_data_tests/malicious_data_test_msg_sender.cpp" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/malicious_data_test_msg_sender.cpp.o" "gcc" "test/network_tests/malicious_data_tests/CMakeFiles/malicious_data_test_msg_sender.dir/malicious_data_test_msg_sender.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-sd.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/malicious_data_test_service.dir/malicious_data_test_service.cpp.o"
+  "CMakeFiles/malicious_data_test_service.dir/malicious_data_test_service.cpp.o.d"
+  "malicious_data_test_service"
+  "malicious_data_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/malicious_data_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
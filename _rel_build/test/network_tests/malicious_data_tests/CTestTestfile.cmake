@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/malicious_data_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/malicious_data_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[malicious_data_test_events]=] "/root/repo/_rel_build/test/network_tests/malicious_data_tests/malicious_data_test_master_starter.sh" "MALICIOUS_EVENTS")
+set_tests_properties([=[malicious_data_test_events]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;64;add_custom_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;0;")
+add_test([=[malicious_data_test_protocol_version]=] "/root/repo/_rel_build/test/network_tests/malicious_data_tests/malicious_data_test_master_starter.sh" "PROTOCOL_VERSION")
+set_tests_properties([=[malicious_data_test_protocol_version]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;71;add_custom_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;0;")
+add_test([=[malicious_data_test_message_type]=] "/root/repo/_rel_build/test/network_tests/malicious_data_tests/malicious_data_test_master_starter.sh" "MESSAGE_TYPE")
+set_tests_properties([=[malicious_data_test_message_type]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;78;add_custom_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;0;")
+add_test([=[malicious_data_test_return_code]=] "/root/repo/_rel_build/test/network_tests/malicious_data_tests/malicious_data_test_master_starter.sh" "RETURN_CODE")
+set_tests_properties([=[malicious_data_test_return_code]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;85;add_custom_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;0;")
+add_test([=[malicious_data_test_wrong_header_fields_udp]=] "/root/repo/_rel_build/test/network_tests/malicious_data_tests/malicious_data_test_master_starter.sh" "WRONG_HEADER_FIELDS_UDP")
+set_tests_properties([=[malicious_data_test_wrong_header_fields_udp]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;92;add_custom_test;/root/repo/test/network_tests/malicious_data_tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory_test_client.dir/memory_test_client.cpp.o"
+  "CMakeFiles/memory_test_client.dir/memory_test_client.cpp.o.d"
+  "memory_test_client"
+  "memory_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
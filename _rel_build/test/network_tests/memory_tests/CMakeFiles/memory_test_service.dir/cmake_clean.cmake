@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory_test_service.dir/memory_test_service.cpp.o"
+  "CMakeFiles/memory_test_service.dir/memory_test_service.cpp.o.d"
+  "memory_test_service"
+  "memory_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
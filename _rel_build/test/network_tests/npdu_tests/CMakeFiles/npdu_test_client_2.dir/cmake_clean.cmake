@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/npdu_test_client_2.dir/npdu_test_client.cpp.o"
+  "CMakeFiles/npdu_test_client_2.dir/npdu_test_client.cpp.o.d"
+  "npdu_test_client_2"
+  "npdu_test_client_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/npdu_test_client_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
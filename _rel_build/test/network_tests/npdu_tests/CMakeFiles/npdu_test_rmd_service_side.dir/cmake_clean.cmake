@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/npdu_test_rmd_service_side.dir/npdu_test_rmd.cpp.o"
+  "CMakeFiles/npdu_test_rmd_service_side.dir/npdu_test_rmd.cpp.o.d"
+  "npdu_test_rmd_service_side"
+  "npdu_test_rmd_service_side.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/npdu_test_rmd_service_side.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
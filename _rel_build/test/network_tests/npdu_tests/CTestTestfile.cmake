@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/npdu_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/npdu_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[npdu_test_udp]=] "/root/repo/_rel_build/test/network_tests/npdu_tests/npdu_test_starter.sh" "UDP" "sync")
+set_tests_properties([=[npdu_test_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/npdu_tests/CMakeLists.txt;126;add_custom_test;/root/repo/test/network_tests/npdu_tests/CMakeLists.txt;0;")
+add_test([=[npdu_test_tcp]=] "/root/repo/_rel_build/test/network_tests/npdu_tests/npdu_test_starter.sh" "TCP" "sync")
+set_tests_properties([=[npdu_test_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/npdu_tests/CMakeLists.txt;132;add_custom_test;/root/repo/test/network_tests/npdu_tests/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offer_stop_offer_test_client.dir/applications/client.cpp.o"
+  "CMakeFiles/offer_stop_offer_test_client.dir/applications/client.cpp.o.d"
+  "CMakeFiles/offer_stop_offer_test_client.dir/offer_stop_offer_test_client.cpp.o"
+  "CMakeFiles/offer_stop_offer_test_client.dir/offer_stop_offer_test_client.cpp.o.d"
+  "offer_stop_offer_test_client"
+  "offer_stop_offer_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offer_stop_offer_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offer_stop_offer_test_service.dir/applications/service.cpp.o"
+  "CMakeFiles/offer_stop_offer_test_service.dir/applications/service.cpp.o.d"
+  "CMakeFiles/offer_stop_offer_test_service.dir/offer_stop_offer_test_service.cpp.o"
+  "CMakeFiles/offer_stop_offer_test_service.dir/offer_stop_offer_test_service.cpp.o.d"
+  "offer_stop_offer_test_service"
+  "offer_stop_offer_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offer_stop_offer_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offer_test_big_sd_msg_client.dir/offer_test_big_sd_msg_client.cpp.o"
+  "CMakeFiles/offer_test_big_sd_msg_client.dir/offer_test_big_sd_msg_client.cpp.o.d"
+  "offer_test_big_sd_msg_client"
+  "offer_test_big_sd_msg_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offer_test_big_sd_msg_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offer_test_big_sd_msg_service.dir/offer_test_big_sd_msg_service.cpp.o"
+  "CMakeFiles/offer_test_big_sd_msg_service.dir/offer_test_big_sd_msg_service.cpp.o.d"
+  "offer_test_big_sd_msg_service"
+  "offer_test_big_sd_msg_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offer_test_big_sd_msg_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
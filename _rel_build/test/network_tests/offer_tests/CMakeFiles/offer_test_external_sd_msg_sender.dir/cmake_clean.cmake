@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offer_test_external_sd_msg_sender.dir/offer_test_external_sd_msg_sender.cpp.o"
+  "CMakeFiles/offer_test_external_sd_msg_sender.dir/offer_test_external_sd_msg_sender.cpp.o.d"
+  "offer_test_external_sd_msg_sender"
+  "offer_test_external_sd_msg_sender.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offer_test_external_sd_msg_sender.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
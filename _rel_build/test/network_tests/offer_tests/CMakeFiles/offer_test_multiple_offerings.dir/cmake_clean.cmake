@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offer_test_multiple_offerings.dir/offer_test_multiple_offerings.cpp.o"
+  "CMakeFiles/offer_test_multiple_offerings.dir/offer_test_multiple_offerings.cpp.o.d"
+  "offer_test_multiple_offerings"
+  "offer_test_multiple_offerings.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offer_test_multiple_offerings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
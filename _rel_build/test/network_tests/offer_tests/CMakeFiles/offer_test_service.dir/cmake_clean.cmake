@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offer_test_service.dir/offer_test_service.cpp.o"
+  "CMakeFiles/offer_test_service.dir/offer_test_service.cpp.o.d"
+  "offer_test_service"
+  "offer_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offer_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offer_test_service_external.dir/offer_test_service_external.cpp.o"
+  "CMakeFiles/offer_test_service_external.dir/offer_test_service_external.cpp.o.d"
+  "offer_test_service_external"
+  "offer_test_service_external.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offer_test_service_external.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
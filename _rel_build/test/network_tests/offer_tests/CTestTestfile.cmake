@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/offer_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/offer_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[offer_test_local]=] "/root/repo/_rel_build/test/network_tests/offer_tests/offer_test_local_starter.sh")
+set_tests_properties([=[offer_test_local]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/offer_tests/CMakeLists.txt;76;add_custom_test;/root/repo/test/network_tests/offer_tests/CMakeLists.txt;0;")
+add_test([=[offer_test_external]=] "/root/repo/_rel_build/test/network_tests/offer_tests/offer_test_external_master_starter.sh")
+set_tests_properties([=[offer_test_external]=] PROPERTIES  TIMEOUT "360" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/offer_tests/CMakeLists.txt;83;add_custom_test;/root/repo/test/network_tests/offer_tests/CMakeLists.txt;0;")
+add_test([=[offer_test_big_sd_msg]=] "/root/repo/_rel_build/test/network_tests/offer_tests/offer_test_big_sd_msg_master_starter.sh")
+set_tests_properties([=[offer_test_big_sd_msg]=] PROPERTIES  TIMEOUT "360" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/offer_tests/CMakeLists.txt;90;add_custom_test;/root/repo/test/network_tests/offer_tests/CMakeLists.txt;0;")
+add_test([=[offer_test_multiple_offerings]=] "/root/repo/_rel_build/test/network_tests/offer_tests/offer_test_multiple_offerings_starter.sh")
+set_tests_properties([=[offer_test_multiple_offerings]=] PROPERTIES  TIMEOUT "1800" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/offer_tests/CMakeLists.txt;97;add_custom_test;/root/repo/test/network_tests/offer_tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offered_services_info_test_client.dir/offered_services_info_test_client.cpp.o"
+  "CMakeFiles/offered_services_info_test_client.dir/offered_services_info_test_client.cpp.o.d"
+  "offered_services_info_test_client"
+  "offered_services_info_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offered_services_info_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
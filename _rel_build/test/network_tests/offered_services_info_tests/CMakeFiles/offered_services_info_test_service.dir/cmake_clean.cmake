@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/offered_services_info_test_service.dir/offered_services_info_test_service.cpp.o"
+  "CMakeFiles/offered_services_info_test_service.dir/offered_services_info_test_service.cpp.o.d"
+  "offered_services_info_test_service"
+  "offered_services_info_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offered_services_info_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/offered_services_info_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/offered_services_info_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[offered_services_info_test_local]=] "/root/repo/_rel_build/test/network_tests/offered_services_info_tests/offered_services_info_test_local_starter.sh")
+set_tests_properties([=[offered_services_info_test_local]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/offered_services_info_tests/CMakeLists.txt;41;add_custom_test;/root/repo/test/network_tests/offered_services_info_tests/CMakeLists.txt;0;")
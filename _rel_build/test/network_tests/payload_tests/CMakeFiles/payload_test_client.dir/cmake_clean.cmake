@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/payload_test_client.dir/payload_test_client.cpp.o"
+  "CMakeFiles/payload_test_client.dir/payload_test_client.cpp.o.d"
+  "CMakeFiles/payload_test_client.dir/stopwatch.cpp.o"
+  "CMakeFiles/payload_test_client.dir/stopwatch.cpp.o.d"
+  "payload_test_client"
+  "payload_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/payload_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/payload_test_service.dir/payload_test_service.cpp.o"
+  "CMakeFiles/payload_test_service.dir/payload_test_service.cpp.o.d"
+  "payload_test_service"
+  "payload_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/payload_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/payload_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/payload_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[local_payload_test]=] "/root/repo/_rel_build/test/network_tests/payload_tests/local_payload_test_starter.sh")
+set_tests_properties([=[local_payload_test]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;51;add_custom_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;0;")
+add_test([=[local_payload_test_huge_payload]=] "/root/repo/_rel_build/test/network_tests/payload_tests/local_payload_test_huge_payload_starter.sh")
+set_tests_properties([=[local_payload_test_huge_payload]=] PROPERTIES  TIMEOUT "1800" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;57;add_custom_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;0;")
+add_test([=[external_local_payload_test_client_local]=] "/root/repo/_rel_build/test/network_tests/payload_tests/external_local_payload_test_client_local_starter.sh")
+set_tests_properties([=[external_local_payload_test_client_local]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;64;add_custom_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;0;")
+add_test([=[external_local_payload_test_client_external]=] "/root/repo/_rel_build/test/network_tests/payload_tests/external_local_payload_test_client_external_starter.sh")
+set_tests_properties([=[external_local_payload_test_client_external]=] PROPERTIES  TIMEOUT "480" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;70;add_custom_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;0;")
+add_test([=[external_local_payload_test_client_local_and_external]=] "/root/repo/_rel_build/test/network_tests/payload_tests/external_local_payload_test_client_local_and_external_starter.sh")
+set_tests_properties([=[external_local_payload_test_client_local_and_external]=] PROPERTIES  TIMEOUT "480" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;77;add_custom_test;/root/repo/test/network_tests/payload_tests/CMakeLists.txt;0;")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/message/src/deserializer.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/message/src/deserializer.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/message/src/message_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/message/src/message_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/message/src/payload_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/message/src/payload_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/configuration_option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/configuration_option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/entry_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/entry_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/eventgroupentry_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/eventgroupentry_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/ip_option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/ip_option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv4_option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv4_option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv6_option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv6_option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/load_balancing_option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/load_balancing_option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_element_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_element_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/protection_option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/protection_option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/selective_option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/selective_option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/serviceentry_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/serviceentry_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/unknown_option_impl.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/__/__/__/implementation/service_discovery/src/unknown_option_impl.cpp.o.d"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/pending_subscription_test_sd_msg_sender.cpp.o"
+  "CMakeFiles/pending_subscription_test_sd_msg_sender.dir/pending_subscription_test_sd_msg_sender.cpp.o.d"
+  "pending_subscription_test_sd_msg_sender"
+  "pending_subscription_test_sd_msg_sender.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pending_subscription_test_sd_msg_sender.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
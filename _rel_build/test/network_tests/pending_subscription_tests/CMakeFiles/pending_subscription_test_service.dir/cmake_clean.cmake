@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pending_subscription_test_service.dir/pending_subscription_test_service.cpp.o"
+  "CMakeFiles/pending_subscription_test_service.dir/pending_subscription_test_service.cpp.o.d"
+  "pending_subscription_test_service"
+  "pending_subscription_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pending_subscription_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
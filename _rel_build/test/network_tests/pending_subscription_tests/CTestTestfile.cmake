@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/pending_subscription_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/pending_subscription_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[pending_subscription_test_subscribe]=] "/root/repo/_rel_build/test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh" "SUBSCRIBE")
+set_tests_properties([=[pending_subscription_test_subscribe]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;67;add_custom_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;0;")
+add_test([=[pending_subscription_test_alternating_subscribe_unsubscribe]=] "/root/repo/_rel_build/test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh" "SUBSCRIBE_UNSUBSCRIBE")
+set_tests_properties([=[pending_subscription_test_alternating_subscribe_unsubscribe]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;74;add_custom_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;0;")
+add_test([=[pending_subscription_test_unsubscribe]=] "/root/repo/_rel_build/test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh" "UNSUBSCRIBE")
+set_tests_properties([=[pending_subscription_test_unsubscribe]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;81;add_custom_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;0;")
+add_test([=[pending_subscription_test_alternating_subscribe_unsubscribe_nack]=] "/root/repo/_rel_build/test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh" "SUBSCRIBE_UNSUBSCRIBE_NACK")
+set_tests_properties([=[pending_subscription_test_alternating_subscribe_unsubscribe_nack]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;88;add_custom_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;0;")
+add_test([=[pending_subscription_test_alternating_subscribe_unsubscribe_same_port]=] "/root/repo/_rel_build/test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh" "SUBSCRIBE_UNSUBSCRIBE_SAME_PORT")
+set_tests_properties([=[pending_subscription_test_alternating_subscribe_unsubscribe_same_port]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;95;add_custom_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;0;")
+add_test([=[pending_subscription_test_subscribe_resubscribe_mixed]=] "/root/repo/_rel_build/test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh" "SUBSCRIBE_RESUBSCRIBE_MIXED")
+set_tests_properties([=[pending_subscription_test_subscribe_resubscribe_mixed]=] PROPERTIES  TIMEOUT "300" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;102;add_custom_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;0;")
+add_test([=[pending_subscription_test_subscribe_stopsubscribe_subscribe]=] "/root/repo/_rel_build/test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh" "SUBSCRIBE_STOPSUBSCRIBE_SUBSCRIBE")
+set_tests_properties([=[pending_subscription_test_subscribe_stopsubscribe_subscribe]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;109;add_custom_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;0;")
+add_test([=[pending_subscription_test_send_request_to_sd_port]=] "/root/repo/_rel_build/test/network_tests/pending_subscription_tests/pending_subscription_test_master_starter.sh" "REQUEST_TO_SD")
+set_tests_properties([=[pending_subscription_test_send_request_to_sd_port]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;116;add_custom_test;/root/repo/test/network_tests/pending_subscription_tests/CMakeLists.txt;0;")
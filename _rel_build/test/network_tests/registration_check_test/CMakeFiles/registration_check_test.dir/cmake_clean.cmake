@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/registration_check_test.dir/registration_check_service.cpp.o"
+  "CMakeFiles/registration_check_test.dir/registration_check_service.cpp.o.d"
+  "CMakeFiles/registration_check_test.dir/registration_check_test.cpp.o"
+  "CMakeFiles/registration_check_test.dir/registration_check_test.cpp.o.d"
+  "registration_check_test"
+  "registration_check_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/registration_check_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/registration_check_test
+# Build directory: /root/repo/_rel_build/test/network_tests/registration_check_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[registration_check_test]=] "/root/repo/_rel_build/test/network_tests/registration_check_test/registration_check_start.sh")
+set_tests_properties([=[registration_check_test]=] PROPERTIES  TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/registration_check_test/CMakeLists.txt;32;add_custom_test;/root/repo/test/network_tests/registration_check_test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/climate_test_client.dir/climate_test_client.cpp.o"
+  "CMakeFiles/climate_test_client.dir/climate_test_client.cpp.o.d"
+  "climate_test_client"
+  "climate_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/climate_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/climate_test_service.dir/climate_test_service.cpp.o"
+  "CMakeFiles/climate_test_service.dir/climate_test_service.cpp.o.d"
+  "climate_test_service"
+  "climate_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/climate_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/regression_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/regression_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[climate_test]=] "/root/repo/_rel_build/test/network_tests/regression_tests/climate_test_master_starter.sh")
+set_tests_properties([=[climate_test]=] PROPERTIES  TIMEOUT "25" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/regression_tests/CMakeLists.txt;38;add_custom_test;/root/repo/test/network_tests/regression_tests/CMakeLists.txt;0;")
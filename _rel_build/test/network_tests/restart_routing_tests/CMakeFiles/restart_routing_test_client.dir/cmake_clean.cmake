@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/restart_routing_test_client.dir/restart_routing_test_client.cpp.o"
+  "CMakeFiles/restart_routing_test_client.dir/restart_routing_test_client.cpp.o.d"
+  "restart_routing_test_client"
+  "restart_routing_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/restart_routing_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/restart_routing_test_service.dir/restart_routing_test_service.cpp.o"
+  "CMakeFiles/restart_routing_test_service.dir/restart_routing_test_service.cpp.o.d"
+  "restart_routing_test_service"
+  "restart_routing_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/restart_routing_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/external_local_routing_test_service.dir/external_local_routing_test_service.cpp.o"
+  "CMakeFiles/external_local_routing_test_service.dir/external_local_routing_test_service.cpp.o.d"
+  "external_local_routing_test_service"
+  "external_local_routing_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/external_local_routing_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
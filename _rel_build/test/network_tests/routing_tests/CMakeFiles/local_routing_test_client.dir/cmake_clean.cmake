@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_routing_test_client.dir/local_routing_test_client.cpp.o"
+  "CMakeFiles/local_routing_test_client.dir/local_routing_test_client.cpp.o.d"
+  "local_routing_test_client"
+  "local_routing_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_routing_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_routing_test_service.dir/local_routing_test_service.cpp.o"
+  "CMakeFiles/local_routing_test_service.dir/local_routing_test_service.cpp.o.d"
+  "local_routing_test_service"
+  "local_routing_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_routing_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/routing_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/routing_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[local_routing_test]=] "/root/repo/_rel_build/test/network_tests/routing_tests/local_routing_test_starter.sh")
+set_tests_properties([=[local_routing_test]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/routing_tests/CMakeLists.txt;44;add_custom_test;/root/repo/test/network_tests/routing_tests/CMakeLists.txt;0;")
+add_test([=[external_local_routing_test]=] "/root/repo/_rel_build/test/network_tests/routing_tests/external_local_routing_test_starter.sh")
+set_tests_properties([=[external_local_routing_test]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/routing_tests/CMakeLists.txt;64;add_custom_test;/root/repo/test/network_tests/routing_tests/CMakeLists.txt;0;")
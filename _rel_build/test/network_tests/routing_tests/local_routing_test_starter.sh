@@ -0,0 +1,76 @@
+#!/bin/sh
+# Copyright (C) 2015-2023 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+# Purpose: This script is needed to start the client and service with
+# one command. This is necessary as ctest - which is used to run the
+# tests - isn't able to start two binaries for one testcase. Therefore
+# the testcase simply executes this script. This script then runs client
+# and service and checks that both exit sucessfully.
+
+FAIL=0
+
+# Parameter 1: the pid to check
+check_tcp_udp_sockets_are_closed ()
+{
+    # Check that the service does not listen on any TCP/UDP socket
+    # or has any active connection via a TCP/UDP socket
+    # awk is used to avoid the case when a inode number is the same as a PID. The awk
+    # program filters the netstat output down to the protocol (1st field) and
+    # the PID/Program name (last field) fields.
+    SERVICE_SOCKETS_LISTENING=$(netstat -tulpen 2> /dev/null | awk '{print $1 "\t"  $NF}' | grep $1 | wc -l)
+    if [ $SERVICE_SOCKETS_LISTENING -ne 0 ]
+    then
+        ((FAIL+=1))
+    fi
+
+    SERVICE_SOCKETS_CONNECTED=$(netstat -tupen 2> /dev/null | awk '{print $1 "\t"  $NF}' | grep $1 | wc -l)
+    if [ $SERVICE_SOCKETS_CONNECTED -ne 0 ]
+    then
+        ((FAIL+=1))
+    fi
+}
+
+export VSOMEIP_CONFIGURATION=local_routing_test_service.json
+# start daemon
+../../../examples/routingmanagerd/routingmanagerd &
+PID_VSOMEIPD=$!
+
+# Start the service
+export VSOMEIP_APPLICATION_NAME=local_routing_test_service
+./local_routing_test_service &
+SERIVCE_PID=$!
+WAIT_PID_ONE=$!
+sleep 4;
+
+check_tcp_udp_sockets_are_closed  $SERIVCE_PID
+
+# Start the client
+export VSOMEIP_APPLICATION_NAME=local_routing_test_client
+export VSOMEIP_CONFIGURATION=local_routing_test_client.json
+./local_routing_test_client &
+CLIENT_PID=$!
+WAIT_PID_TWO=$!
+
+check_tcp_udp_sockets_are_closed  $SERIVCE_PID
+check_tcp_udp_sockets_are_closed  $CLIENT_PID
+
+# Wait until client and service are finished
+# Fail gets incremented if either client or service exit
+# with a non-zero exit code
+wait $WAIT_PID_ONE || ((FAIL+=1))
+wait $WAIT_PID_TWO || ((FAIL+=1))
+
+kill $PID_VSOMEIPD
+sleep 1
+
+# Check if client and server both exited successfully and the service didnt't
+# have any open
+if [ $FAIL -eq 0 ]
+then
+    exit 0
+else
+    exit 1
+fi
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/second_address_test_client.dir/second_address_test_client.cpp.o"
+  "CMakeFiles/second_address_test_client.dir/second_address_test_client.cpp.o.d"
+  "second_address_test_client"
+  "second_address_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/second_address_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/second_address_test_service.dir/second_address_test_service.cpp.o"
+  "CMakeFiles/second_address_test_service.dir/second_address_test_service.cpp.o.d"
+  "second_address_test_service"
+  "second_address_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/second_address_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/second_address_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/second_address_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[second_address_test_second_ip_address_service_udp]=] "/root/repo/_rel_build/test/network_tests/second_address_tests/second_address_test_master_starter.sh" "SERVICE" "UDP")
+set_tests_properties([=[second_address_test_second_ip_address_service_udp]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/second_address_tests/CMakeLists.txt;40;add_custom_test;/root/repo/test/network_tests/second_address_tests/CMakeLists.txt;0;")
+add_test([=[second_address_test_second_ip_address_client_udp]=] "/root/repo/_rel_build/test/network_tests/second_address_tests/second_address_test_master_starter.sh" "CLIENT" "UDP")
+set_tests_properties([=[second_address_test_second_ip_address_client_udp]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/second_address_tests/CMakeLists.txt;47;add_custom_test;/root/repo/test/network_tests/second_address_tests/CMakeLists.txt;0;")
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/endpoints/src/tp.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/endpoints/src/tp.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/endpoints/src/tp_message.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/endpoints/src/tp_message.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/endpoints/src/tp_reassembler.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/endpoints/src/tp_reassembler.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/message/src/deserializer.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/message/src/deserializer.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/message/src/message_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/message/src/message_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/message/src/payload_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/message/src/payload_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/configuration_option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/configuration_option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/entry_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/entry_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/eventgroupentry_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/eventgroupentry_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ip_option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ip_option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv4_option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv4_option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv6_option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/ipv6_option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/load_balancing_option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/load_balancing_option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_element_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_element_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/message_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/protection_option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/protection_option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/selective_option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/selective_option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/serviceentry_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/serviceentry_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/unknown_option_impl.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/__/__/__/implementation/service_discovery/src/unknown_option_impl.cpp.o.d"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/someip_tp_test_msg_sender.cpp.o"
+  "CMakeFiles/someip_tp_test_msg_sender.dir/someip_tp_test_msg_sender.cpp.o.d"
+  "someip_tp_test_msg_sender"
+  "someip_tp_test_msg_sender.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/someip_tp_test_msg_sender.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
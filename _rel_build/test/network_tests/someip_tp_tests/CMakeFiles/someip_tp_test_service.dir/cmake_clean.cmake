@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/someip_tp_test_service.dir/someip_tp_test_service.cpp.o"
+  "CMakeFiles/someip_tp_test_service.dir/someip_tp_test_service.cpp.o.d"
+  "someip_tp_test_service"
+  "someip_tp_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/someip_tp_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
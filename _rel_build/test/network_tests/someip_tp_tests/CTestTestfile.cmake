@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/someip_tp_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/someip_tp_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[someip_tp_test_in_sequence]=] "/root/repo/_rel_build/test/network_tests/someip_tp_tests/someip_tp_test_master_starter.sh" "IN_SEQUENCE")
+set_tests_properties([=[someip_tp_test_in_sequence]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;70;add_custom_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;0;")
+add_test([=[someip_tp_test_mixed]=] "/root/repo/_rel_build/test/network_tests/someip_tp_tests/someip_tp_test_master_starter.sh" "MIXED")
+set_tests_properties([=[someip_tp_test_mixed]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;77;add_custom_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;0;")
+add_test([=[someip_tp_test_incomplete]=] "/root/repo/_rel_build/test/network_tests/someip_tp_tests/someip_tp_test_master_starter.sh" "INCOMPLETE")
+set_tests_properties([=[someip_tp_test_incomplete]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;84;add_custom_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;0;")
+add_test([=[someip_tp_test_duplicate]=] "/root/repo/_rel_build/test/network_tests/someip_tp_tests/someip_tp_test_master_starter.sh" "DUPLICATE")
+set_tests_properties([=[someip_tp_test_duplicate]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;91;add_custom_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;0;")
+add_test([=[someip_tp_test_overlap]=] "/root/repo/_rel_build/test/network_tests/someip_tp_tests/someip_tp_test_master_starter.sh" "OVERLAP")
+set_tests_properties([=[someip_tp_test_overlap]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;98;add_custom_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;0;")
+add_test([=[someip_tp_test_overlap_front_back]=] "/root/repo/_rel_build/test/network_tests/someip_tp_tests/someip_tp_test_master_starter.sh" "OVERLAP_FRONT_BACK")
+set_tests_properties([=[someip_tp_test_overlap_front_back]=] PROPERTIES  TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;105;add_custom_test;/root/repo/test/network_tests/someip_tp_tests/CMakeLists.txt;0;")
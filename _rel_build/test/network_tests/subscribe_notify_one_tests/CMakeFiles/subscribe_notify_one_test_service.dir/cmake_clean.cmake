@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscribe_notify_one_test_service.dir/subscribe_notify_one_test_service.cpp.o"
+  "CMakeFiles/subscribe_notify_one_test_service.dir/subscribe_notify_one_test_service.cpp.o.d"
+  "subscribe_notify_one_test_service"
+  "subscribe_notify_one_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subscribe_notify_one_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
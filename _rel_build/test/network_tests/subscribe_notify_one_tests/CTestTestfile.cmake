@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/subscribe_notify_one_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/subscribe_notify_one_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[subscribe_notify_one_test_diff_client_ids_diff_ports_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_master_starter.sh" "UDP" "subscribe_notify_one_test_diff_client_ids_diff_ports_master_udp.json")
+set_tests_properties([=[subscribe_notify_one_test_diff_client_ids_diff_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_one_tests/CMakeLists.txt;33;add_custom_test;/root/repo/test/network_tests/subscribe_notify_one_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_one_test_diff_client_ids_diff_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_master_starter.sh" "TCP" "subscribe_notify_one_test_diff_client_ids_diff_ports_master_tcp.json")
+set_tests_properties([=[subscribe_notify_one_test_diff_client_ids_diff_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_one_tests/CMakeLists.txt;40;add_custom_test;/root/repo/test/network_tests/subscribe_notify_one_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_one_test_diff_client_ids_diff_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_one_tests/subscribe_notify_one_test_master_starter.sh" "TCP_AND_UDP" "subscribe_notify_one_test_diff_client_ids_diff_ports_master.json")
+set_tests_properties([=[subscribe_notify_one_test_diff_client_ids_diff_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_one_tests/CMakeLists.txt;47;add_custom_test;/root/repo/test/network_tests/subscribe_notify_one_tests/CMakeLists.txt;0;")
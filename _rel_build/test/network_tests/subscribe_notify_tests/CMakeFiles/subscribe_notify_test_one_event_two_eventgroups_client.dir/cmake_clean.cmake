@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscribe_notify_test_one_event_two_eventgroups_client.dir/subscribe_notify_test_one_event_two_eventgroups_client.cpp.o"
+  "CMakeFiles/subscribe_notify_test_one_event_two_eventgroups_client.dir/subscribe_notify_test_one_event_two_eventgroups_client.cpp.o.d"
+  "subscribe_notify_test_one_event_two_eventgroups_client"
+  "subscribe_notify_test_one_event_two_eventgroups_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subscribe_notify_test_one_event_two_eventgroups_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
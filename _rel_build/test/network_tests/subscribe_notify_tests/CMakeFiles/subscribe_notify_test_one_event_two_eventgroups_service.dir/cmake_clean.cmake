@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscribe_notify_test_one_event_two_eventgroups_service.dir/subscribe_notify_test_one_event_two_eventgroups_service.cpp.o"
+  "CMakeFiles/subscribe_notify_test_one_event_two_eventgroups_service.dir/subscribe_notify_test_one_event_two_eventgroups_service.cpp.o.d"
+  "subscribe_notify_test_one_event_two_eventgroups_service"
+  "subscribe_notify_test_one_event_two_eventgroups_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subscribe_notify_test_one_event_two_eventgroups_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
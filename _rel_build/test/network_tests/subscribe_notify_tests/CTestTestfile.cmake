@@ -0,0 +1,50 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/subscribe_notify_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/subscribe_notify_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "UDP" "subscribe_notify_test_diff_client_ids_diff_ports_master_udp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;96;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP" "subscribe_notify_test_diff_client_ids_diff_ports_master_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;104;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP_AND_UDP" "subscribe_notify_test_diff_client_ids_diff_ports_master.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;112;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_same_ports_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "UDP" "subscribe_notify_test_diff_client_ids_same_ports_master_udp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_same_ports_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;120;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_same_ports_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP" "subscribe_notify_test_diff_client_ids_same_ports_master_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_same_ports_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;128;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_same_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP_AND_UDP" "subscribe_notify_test_diff_client_ids_same_ports_master.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_same_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;136;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_partial_same_ports_both_tcp_and_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP_AND_UDP" "subscribe_notify_test_diff_client_ids_partial_same_ports_master.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_partial_same_ports_both_tcp_and_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;144;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "UDP" "subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_master_udp.json" "SAME_SERVICE_ID")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;152;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "UDP" "subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_master.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;161;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_udp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "UDP" "subscribe_notify_test_diff_client_ids_diff_ports_master_udp_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_udp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;171;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_tcp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP" "subscribe_notify_test_diff_client_ids_diff_ports_master_tcp_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_tcp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;179;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_both_tcp_and_udp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP_AND_UDP" "subscribe_notify_test_diff_client_ids_diff_ports_master_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_both_tcp_and_udp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;187;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_same_ports_udp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "UDP" "subscribe_notify_test_diff_client_ids_same_ports_master_udp_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_same_ports_udp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;195;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_same_ports_tcp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP" "subscribe_notify_test_diff_client_ids_same_ports_master_tcp_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_same_ports_tcp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;203;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_same_ports_both_tcp_and_udp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP_AND_UDP" "subscribe_notify_test_diff_client_ids_same_ports_master_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_same_ports_both_tcp_and_udp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;211;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_partial_same_ports_both_tcp_and_udp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "TCP_AND_UDP" "subscribe_notify_test_diff_client_ids_partial_same_ports_master_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_partial_same_ports_both_tcp_and_udp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;219;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_udp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "UDP" "subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_master_udp_local_tcp.json" "SAME_SERVICE_ID")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_same_service_id_udp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;227;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_udp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_master_starter.sh" "UDP" "subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_master_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_diff_client_ids_diff_ports_autoconfig_udp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;236;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_one_event_two_eventgroups_udp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_master_starter.sh" "UDP" "subscribe_notify_test_one_event_two_eventgroups_master.json")
+set_tests_properties([=[subscribe_notify_test_one_event_two_eventgroups_udp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;246;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_one_event_two_eventgroups_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_master_starter.sh" "TCP" "subscribe_notify_test_one_event_two_eventgroups_master.json")
+set_tests_properties([=[subscribe_notify_test_one_event_two_eventgroups_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;254;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_one_event_two_eventgroups_udp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_master_starter.sh" "UDP" "subscribe_notify_test_one_event_two_eventgroups_master_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_one_event_two_eventgroups_udp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;262;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
+add_test([=[subscribe_notify_test_one_event_two_eventgroups_tcp_local_tcp]=] "/root/repo/_rel_build/test/network_tests/subscribe_notify_tests/subscribe_notify_test_one_event_two_eventgroups_master_starter.sh" "TCP" "subscribe_notify_test_one_event_two_eventgroups_master_local_tcp.json")
+set_tests_properties([=[subscribe_notify_test_one_event_two_eventgroups_tcp_local_tcp]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;270;add_custom_test;/root/repo/test/network_tests/subscribe_notify_tests/CMakeLists.txt;0;")
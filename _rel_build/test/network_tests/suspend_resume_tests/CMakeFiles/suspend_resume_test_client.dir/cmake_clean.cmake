@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/suspend_resume_test_client.dir/suspend_resume_test_client.cpp.o"
+  "CMakeFiles/suspend_resume_test_client.dir/suspend_resume_test_client.cpp.o.d"
+  "suspend_resume_test_client"
+  "suspend_resume_test_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/suspend_resume_test_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/suspend_resume_test_service.dir/suspend_resume_test_service.cpp.o"
+  "CMakeFiles/suspend_resume_test_service.dir/suspend_resume_test_service.cpp.o.d"
+  "suspend_resume_test_service"
+  "suspend_resume_test_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/suspend_resume_test_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/network_tests/suspend_resume_tests
+# Build directory: /root/repo/_rel_build/test/network_tests/suspend_resume_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[suspend_resume_test_initial]=] "/root/repo/_rel_build/test/network_tests/suspend_resume_tests/suspend_resume_test_master_starter.sh" "SERVICE")
+set_tests_properties([=[suspend_resume_test_initial]=] PROPERTIES  TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/test/network_tests/CMakeLists.txt;122;add_test;/root/repo/test/network_tests/suspend_resume_tests/CMakeLists.txt;38;add_custom_test;/root/repo/test/network_tests/suspend_resume_tests/CMakeLists.txt;0;")
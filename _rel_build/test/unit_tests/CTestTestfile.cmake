@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit_tests
+# Build directory: /root/repo/_rel_build/test/unit_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("endpoint_tests")
+subdirs("message_payload_impl_tests")
+subdirs("message_serializer_tests")
+subdirs("message_deserializer_tests")
+subdirs("protocol_tests")
+subdirs("routing_manager_tests")
+subdirs("security_policy_manager_impl_tests")
+subdirs("security_policy_tests")
+subdirs("security_tests")
+subdirs("utility_utility_tests")
+subdirs("netlink_tests")
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit_tests/main.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/__/main.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/__/main.cpp.o.d"
+  "/root/repo/test/unit_tests/endpoint_tests/ut_npdu_timing_table.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_npdu_timing_table.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_npdu_timing_table.cpp.o.d"
+  "/root/repo/test/unit_tests/endpoint_tests/ut_socket_timestamping.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_socket_timestamping.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_socket_timestamping.cpp.o.d"
+  "/root/repo/test/unit_tests/endpoint_tests/ut_tcp_gather_write.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_tcp_gather_write.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_tcp_gather_write.cpp.o.d"
+  "/root/repo/test/unit_tests/endpoint_tests/ut_tcp_receive_buffer.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_tcp_receive_buffer.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_tcp_receive_buffer.cpp.o.d"
+  "/root/repo/test/unit_tests/endpoint_tests/ut_train.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_train.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_train.cpp.o.d"
+  "/root/repo/test/unit_tests/endpoint_tests/ut_udp_receive_sockets.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_udp_receive_sockets.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_udp_receive_sockets.cpp.o.d"
+  "/root/repo/test/unit_tests/endpoint_tests/ut_uring_socket_receiver.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_uring_socket_receiver.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_uring_socket_receiver.cpp.o.d"
+  "/root/repo/test/unit_tests/endpoint_tests/ut_uring_tcp_socket.cpp" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_uring_tcp_socket.cpp.o" "gcc" "test/unit_tests/endpoint_tests/CMakeFiles/unit_tests_endpoint_tests.dir/ut_uring_tcp_socket.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-cfg.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
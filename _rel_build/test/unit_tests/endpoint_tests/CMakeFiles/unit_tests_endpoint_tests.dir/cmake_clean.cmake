@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_endpoint_tests.dir/__/main.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/__/main.cpp.o.d"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_npdu_timing_table.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_npdu_timing_table.cpp.o.d"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_socket_timestamping.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_socket_timestamping.cpp.o.d"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_tcp_gather_write.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_tcp_gather_write.cpp.o.d"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_tcp_receive_buffer.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_tcp_receive_buffer.cpp.o.d"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_train.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_train.cpp.o.d"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_udp_receive_sockets.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_udp_receive_sockets.cpp.o.d"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_uring_socket_receiver.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_uring_socket_receiver.cpp.o.d"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_uring_tcp_socket.cpp.o"
+  "CMakeFiles/unit_tests_endpoint_tests.dir/ut_uring_tcp_socket.cpp.o.d"
+  "unit_tests_endpoint_tests"
+  "unit_tests_endpoint_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_endpoint_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
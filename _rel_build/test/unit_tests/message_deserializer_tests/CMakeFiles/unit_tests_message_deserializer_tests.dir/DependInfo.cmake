@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit_tests/main.cpp" "test/unit_tests/message_deserializer_tests/CMakeFiles/unit_tests_message_deserializer_tests.dir/__/main.cpp.o" "gcc" "test/unit_tests/message_deserializer_tests/CMakeFiles/unit_tests_message_deserializer_tests.dir/__/main.cpp.o.d"
+  "/root/repo/test/unit_tests/message_deserializer_tests/ut_deserialize.cpp" "test/unit_tests/message_deserializer_tests/CMakeFiles/unit_tests_message_deserializer_tests.dir/ut_deserialize.cpp.o" "gcc" "test/unit_tests/message_deserializer_tests/CMakeFiles/unit_tests_message_deserializer_tests.dir/ut_deserialize.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-cfg.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_message_payload_impl_tests.dir/__/main.cpp.o"
+  "CMakeFiles/unit_tests_message_payload_impl_tests.dir/__/main.cpp.o.d"
+  "CMakeFiles/unit_tests_message_payload_impl_tests.dir/ut_payload_impl.cpp.o"
+  "CMakeFiles/unit_tests_message_payload_impl_tests.dir/ut_payload_impl.cpp.o.d"
+  "unit_tests_message_payload_impl_tests"
+  "unit_tests_message_payload_impl_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_message_payload_impl_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
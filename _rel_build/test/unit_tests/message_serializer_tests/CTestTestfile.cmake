@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit_tests/message_serializer_tests
+# Build directory: /root/repo/_rel_build/test/unit_tests/message_serializer_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit_tests_message_serializer_tests "/root/repo/_rel_build/test/unit_tests/message_serializer_tests/unit_tests_message_serializer_tests")
+set_tests_properties(unit_tests_message_serializer_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit_tests/message_serializer_tests/CMakeLists.txt;26;add_test;/root/repo/test/unit_tests/message_serializer_tests/CMakeLists.txt;0;")
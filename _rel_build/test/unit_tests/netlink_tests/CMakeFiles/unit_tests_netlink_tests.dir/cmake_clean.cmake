@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_netlink_tests.dir/__/__/__/implementation/endpoints/src/netlink_connector.cpp.o"
+  "CMakeFiles/unit_tests_netlink_tests.dir/__/__/__/implementation/endpoints/src/netlink_connector.cpp.o.d"
+  "CMakeFiles/unit_tests_netlink_tests.dir/__/main.cpp.o"
+  "CMakeFiles/unit_tests_netlink_tests.dir/__/main.cpp.o.d"
+  "CMakeFiles/unit_tests_netlink_tests.dir/ut_simulated_messages.cpp.o"
+  "CMakeFiles/unit_tests_netlink_tests.dir/ut_simulated_messages.cpp.o.d"
+  "unit_tests_netlink_tests"
+  "unit_tests_netlink_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_netlink_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
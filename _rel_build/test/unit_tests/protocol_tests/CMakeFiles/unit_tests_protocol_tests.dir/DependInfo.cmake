@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/implementation/protocol/src/command.cpp" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/command.cpp.o" "gcc" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/config_command.cpp" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/config_command.cpp.o" "gcc" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/config_command.cpp.o.d"
+  "/root/repo/implementation/protocol/src/send_command.cpp" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/send_command.cpp.o" "gcc" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/send_command.cpp.o.d"
+  "/root/repo/test/unit_tests/protocol_tests/main.cpp" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/main.cpp.o" "gcc" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/main.cpp.o.d"
+  "/root/repo/test/unit_tests/protocol_tests/ut_config_command.cpp" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/ut_config_command.cpp.o" "gcc" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/ut_config_command.cpp.o.d"
+  "/root/repo/test/unit_tests/protocol_tests/ut_send_command.cpp" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/ut_send_command.cpp.o" "gcc" "test/unit_tests/protocol_tests/CMakeFiles/unit_tests_protocol_tests.dir/ut_send_command.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/command.cpp.o"
+  "CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/command.cpp.o.d"
+  "CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/config_command.cpp.o"
+  "CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/config_command.cpp.o.d"
+  "CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/send_command.cpp.o"
+  "CMakeFiles/unit_tests_protocol_tests.dir/__/__/__/implementation/protocol/src/send_command.cpp.o.d"
+  "CMakeFiles/unit_tests_protocol_tests.dir/main.cpp.o"
+  "CMakeFiles/unit_tests_protocol_tests.dir/main.cpp.o.d"
+  "CMakeFiles/unit_tests_protocol_tests.dir/ut_config_command.cpp.o"
+  "CMakeFiles/unit_tests_protocol_tests.dir/ut_config_command.cpp.o.d"
+  "CMakeFiles/unit_tests_protocol_tests.dir/ut_send_command.cpp.o"
+  "CMakeFiles/unit_tests_protocol_tests.dir/ut_send_command.cpp.o.d"
+  "unit_tests_protocol_tests"
+  "unit_tests_protocol_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_protocol_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
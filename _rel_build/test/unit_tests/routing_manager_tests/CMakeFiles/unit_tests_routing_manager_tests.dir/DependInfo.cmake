@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit_tests/main.cpp" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/__/main.cpp.o" "gcc" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/__/main.cpp.o.d"
+  "/root/repo/test/unit_tests/routing_manager_tests/routing_manager_ut_setup.cpp" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/routing_manager_ut_setup.cpp.o" "gcc" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/routing_manager_ut_setup.cpp.o.d"
+  "/root/repo/test/unit_tests/routing_manager_tests/ut_change_detector.cpp" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/ut_change_detector.cpp.o" "gcc" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/ut_change_detector.cpp.o.d"
+  "/root/repo/test/unit_tests/routing_manager_tests/ut_change_filter.cpp" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/ut_change_filter.cpp.o" "gcc" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/ut_change_filter.cpp.o.d"
+  "/root/repo/test/unit_tests/routing_manager_tests/ut_event_fanout.cpp" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/ut_event_fanout.cpp.o" "gcc" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/ut_event_fanout.cpp.o.d"
+  "/root/repo/test/unit_tests/routing_manager_tests/ut_set_routing_state.cpp" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/ut_set_routing_state.cpp.o" "gcc" "test/unit_tests/routing_manager_tests/CMakeFiles/unit_tests_routing_manager_tests.dir/ut_set_routing_state.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-cfg.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
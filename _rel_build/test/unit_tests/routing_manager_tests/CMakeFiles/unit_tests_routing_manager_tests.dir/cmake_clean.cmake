@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/__/main.cpp.o"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/__/main.cpp.o.d"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/routing_manager_ut_setup.cpp.o"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/routing_manager_ut_setup.cpp.o.d"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/ut_change_detector.cpp.o"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/ut_change_detector.cpp.o.d"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/ut_change_filter.cpp.o"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/ut_change_filter.cpp.o.d"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/ut_event_fanout.cpp.o"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/ut_event_fanout.cpp.o.d"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/ut_set_routing_state.cpp.o"
+  "CMakeFiles/unit_tests_routing_manager_tests.dir/ut_set_routing_state.cpp.o.d"
+  "unit_tests_routing_manager_tests"
+  "unit_tests_routing_manager_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_routing_manager_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_policy_tests.dir/__/main.cpp.o"
+  "CMakeFiles/unit_tests_policy_tests.dir/__/main.cpp.o.d"
+  "CMakeFiles/unit_tests_policy_tests.dir/ut_policy.cpp.o"
+  "CMakeFiles/unit_tests_policy_tests.dir/ut_policy.cpp.o.d"
+  "unit_tests_policy_tests"
+  "unit_tests_policy_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_policy_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit_tests/main.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/__/main.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/__/main.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_check_credentials.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_check_credentials.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_check_credentials.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_check_routing_credentials.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_check_routing_credentials.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_check_routing_credentials.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_get_client_to_sec_client_mapping.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_get_client_to_sec_client_mapping.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_get_client_to_sec_client_mapping.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_get_clients.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_get_clients.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_get_clients.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_get_sec_client_to_clients_mapping.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_get_sec_client_to_clients_mapping.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_get_sec_client_to_clients_mapping.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_is_client_allowed.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_is_client_allowed.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_is_client_allowed.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_is_offer_allowed.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_is_offer_allowed.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_is_offer_allowed.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_is_policy_update_allowed.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_is_policy_update_allowed.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_is_policy_update_allowed.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_load.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_load.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_load.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_load_policies.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_load_policies.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_load_policies.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_load_security_policy_extensions.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_load_security_policy_extensions.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_load_security_policy_extensions.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_load_security_update_whitelist.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_load_security_update_whitelist.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_load_security_update_whitelist.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_remove_client_to_sec_client_mapping.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_remove_client_to_sec_client_mapping.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_remove_client_to_sec_client_mapping.cpp.o.d"
+  "/root/repo/test/unit_tests/security_tests/ut_remove_security_policy.cpp" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_remove_security_policy.cpp.o" "gcc" "test/unit_tests/security_tests/CMakeFiles/unit_tests_security_tests.dir/ut_remove_security_policy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-cfg.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
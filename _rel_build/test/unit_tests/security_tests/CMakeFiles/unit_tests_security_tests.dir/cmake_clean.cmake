@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_security_tests.dir/__/main.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/__/main.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_check_credentials.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_check_credentials.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_check_routing_credentials.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_check_routing_credentials.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_get_client_to_sec_client_mapping.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_get_client_to_sec_client_mapping.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_get_clients.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_get_clients.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_get_sec_client_to_clients_mapping.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_get_sec_client_to_clients_mapping.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_is_client_allowed.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_is_client_allowed.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_is_offer_allowed.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_is_offer_allowed.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_is_policy_update_allowed.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_is_policy_update_allowed.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_load.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_load.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_load_policies.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_load_policies.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_load_security_policy_extensions.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_load_security_policy_extensions.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_load_security_update_whitelist.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_load_security_update_whitelist.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_remove_client_to_sec_client_mapping.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_remove_client_to_sec_client_mapping.cpp.o.d"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_remove_security_policy.cpp.o"
+  "CMakeFiles/unit_tests_security_tests.dir/ut_remove_security_policy.cpp.o.d"
+  "unit_tests_security_tests"
+  "unit_tests_security_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_security_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit_tests/security_tests
+# Build directory: /root/repo/_rel_build/test/unit_tests/security_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit_tests_security_tests "/root/repo/_rel_build/test/unit_tests/security_tests/unit_tests_security_tests")
+set_tests_properties(unit_tests_security_tests PROPERTIES  WORKING_DIRECTORY "/root/repo/_rel_build" _BACKTRACE_TRIPLES "/root/repo/test/unit_tests/security_tests/CMakeLists.txt;27;add_test;/root/repo/test/unit_tests/security_tests/CMakeLists.txt;0;")
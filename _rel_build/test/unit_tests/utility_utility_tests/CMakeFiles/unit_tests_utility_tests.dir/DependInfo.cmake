@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit_tests/main.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/__/main.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/__/main.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_async_logger.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_async_logger.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_async_logger.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_configuration_cache.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_configuration_cache.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_configuration_cache.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_handler_statistics.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_handler_statistics.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_handler_statistics.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_instrumentation.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_instrumentation.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_instrumentation.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_io_shards.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_io_shards.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_io_shards.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_json_reader.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_json_reader.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_json_reader.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_latency_statistics.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_latency_statistics.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_latency_statistics.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_low_latency_io.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_low_latency_io.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_low_latency_io.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_metrics.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_metrics.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_metrics.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_pcapng_writer.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_pcapng_writer.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_pcapng_writer.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_snapshot.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_snapshot.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_snapshot.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_structured_logging.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_structured_logging.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_structured_logging.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_timing_wheel.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_timing_wheel.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_timing_wheel.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_trace_filter_table.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_trace_filter_table.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_trace_filter_table.cpp.o.d"
+  "/root/repo/test/unit_tests/utility_utility_tests/ut_utility.cpp" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_utility.cpp.o" "gcc" "test/unit_tests/utility_utility_tests/CMakeFiles/unit_tests_utility_tests.dir/ut_utility.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-cfg.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3-internal.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/test/common/CMakeFiles/vsomeip_utilities.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/vsomeip3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
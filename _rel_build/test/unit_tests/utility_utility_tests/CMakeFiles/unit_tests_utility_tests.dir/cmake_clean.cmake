@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_utility_tests.dir/__/main.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/__/main.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_async_logger.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_async_logger.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_configuration_cache.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_configuration_cache.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_handler_statistics.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_handler_statistics.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_instrumentation.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_instrumentation.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_io_shards.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_io_shards.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_json_reader.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_json_reader.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_latency_statistics.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_latency_statistics.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_low_latency_io.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_low_latency_io.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_metrics.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_metrics.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_pcapng_writer.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_pcapng_writer.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_snapshot.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_snapshot.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_structured_logging.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_structured_logging.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_timing_wheel.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_timing_wheel.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_trace_filter_table.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_trace_filter_table.cpp.o.d"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_utility.cpp.o"
+  "CMakeFiles/unit_tests_utility_tests.dir/ut_utility.cpp.o.d"
+  "unit_tests_utility_tests"
+  "unit_tests_utility_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_utility_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
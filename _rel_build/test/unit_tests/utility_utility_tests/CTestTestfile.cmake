@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit_tests/utility_utility_tests
+# Build directory: /root/repo/_rel_build/test/unit_tests/utility_utility_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit_tests_utility_tests "/root/repo/_rel_build/test/unit_tests/utility_utility_tests/unit_tests_utility_tests")
+set_tests_properties(unit_tests_utility_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit_tests/utility_utility_tests/CMakeLists.txt;30;add_test;/root/repo/test/unit_tests/utility_utility_tests/CMakeLists.txt;0;")
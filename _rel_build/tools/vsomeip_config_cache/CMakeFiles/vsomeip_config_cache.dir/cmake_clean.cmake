@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsomeip_config_cache.dir/vsomeip_config_cache.cpp.o"
+  "CMakeFiles/vsomeip_config_cache.dir/vsomeip_config_cache.cpp.o.d"
+  "vsomeip_config_cache"
+  "vsomeip_config_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsomeip_config_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
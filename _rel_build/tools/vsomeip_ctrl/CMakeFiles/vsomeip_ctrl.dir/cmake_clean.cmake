@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vsomeip_ctrl.dir/vsomeip_ctrl.cpp.o"
+  "CMakeFiles/vsomeip_ctrl.dir/vsomeip_ctrl.cpp.o.d"
+  "vsomeip_ctrl"
+  "vsomeip_ctrl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vsomeip_ctrl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -28,8 +28,13 @@ struct application_configuration {
     std::size_t event_loop_periodicity_;
     std::map<plugin_type_e, std::set<std::string>> plugins_;
     int nice_level_;
+    bool has_io_sharding_;
     debounce_configuration_t debounces_;
     bool has_session_handling_;
+    // services whose sockets are busy polled by a dedicated thread
+    std::set<std::pair<service_t, instance_t>> low_latency_services_;
+    std::set<unsigned> low_latency_cpus_;
+    std::uint32_t low_latency_busy_poll_;
 };
 
 } // namespace cfg
@@ -0,0 +1,48 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_CHANGE_FILTER_HPP
+#define VSOMEIP_V3_CHANGE_FILTER_HPP
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+enum class change_filter_value_e : uint8_t {
+    CFV_INT8,
+    CFV_UINT8,
+    CFV_INT16,
+    CFV_UINT16,
+    CFV_INT32,
+    CFV_UINT32,
+    CFV_INT64,
+    CFV_UINT64,
+    CFV_FLOAT32,
+    CFV_FLOAT64
+};
+
+// Declarative change detection of an event ("change_filter" of the event
+// configuration). An update is a change if a bit that is not ignored differs
+// or if a numeric value moved by more than its tolerance.
+struct change_filter_t {
+    struct tolerance_t {
+        std::size_t offset_;
+        change_filter_value_e type_;
+        bool is_little_endian_;
+        double epsilon_;
+    };
+
+    // Byte index -> bits to be ignored (same format as the debounce filters)
+    std::map<std::size_t, byte_t> ignore_;
+    std::vector<tolerance_t> tolerances_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_CHANGE_FILTER_HPP
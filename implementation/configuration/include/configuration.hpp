@@ -21,6 +21,7 @@
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/vsomeip_sec.h>
 
+#include "npdu_timing_table.hpp"
 #include "trace.hpp"
 
 #include "../../e2e_protection/include/e2exf/config.hpp"
@@ -41,6 +42,7 @@ namespace vsomeip_v3 {
 class policy_manager_impl;
 class security;
 class event;
+struct change_filter_t;
 struct debounce_filter_impl_t;
 
 class configuration {
@@ -76,7 +78,12 @@ public:
     virtual bool has_file_log() const = 0;
     virtual bool has_dlt_log() const = 0;
     virtual const std::string& get_logfile() const = 0;
+    virtual std::uint64_t get_logfile_max_size() const = 0;
+    virtual std::uint32_t get_logfile_max_files() const = 0;
     virtual logger::level_e get_loglevel() const = 0;
+    virtual bool has_async_log() const = 0;
+    virtual std::size_t get_async_log_queue_size() const = 0;
+    virtual bool is_async_log_blocking() const = 0;
 
     virtual bool is_routing_enabled() const = 0;
     virtual const std::string& get_routing_host_name() const = 0;
@@ -100,6 +107,9 @@ public:
     virtual void get_configured_timing_responses(service_t _service, const std::string& _ip_service, std::uint16_t _port_service,
                                                  method_t _method, std::chrono::nanoseconds* _debounce_time,
                                                  std::chrono::nanoseconds* _max_retention_time) const = 0;
+    // All timings of the messages that are sent to / from the given address and port
+    virtual npdu_timing_table get_npdu_timings_requests(const std::string& _ip_target, std::uint16_t _port_target) const = 0;
+    virtual npdu_timing_table get_npdu_timings_responses(const std::string& _ip_service, std::uint16_t _port_service) const = 0;
 
     virtual bool is_someip(service_t _service, instance_t _instance) const = 0;
 
@@ -116,6 +126,8 @@ public:
     virtual void get_event_update_properties(service_t _service, instance_t _instance, event_t _event, std::chrono::milliseconds& _cycle,
                                              bool& _change_resets_cycle, bool& _update_on_change_) const = 0;
 
+    virtual std::shared_ptr<change_filter_t> get_change_filter(service_t _service, instance_t _instance, event_t _event) const = 0;
+
     virtual client_t get_id(const std::string& _name) const = 0;
     virtual bool is_configured_client_id(client_t _id) const = 0;
 
@@ -124,6 +136,10 @@ public:
     virtual std::size_t get_max_detached_thread_wait_time(const std::string& _name) const = 0;
     virtual std::size_t get_io_thread_count(const std::string& _name) const = 0;
     virtual int get_io_thread_nice_level(const std::string& _name) const = 0;
+    virtual bool has_io_sharding(const std::string& _name) const = 0;
+    virtual std::set<std::pair<service_t, instance_t>> get_low_latency_services(const std::string& _name) const = 0;
+    virtual std::set<unsigned> get_low_latency_cpus(const std::string& _name) const = 0;
+    virtual std::uint32_t get_low_latency_busy_poll(const std::string& _name) const = 0;
     virtual std::size_t get_request_debounce_time(const std::string& _name) const = 0;
     virtual bool has_session_handling(const std::string& _name) const = 0;
 
@@ -140,6 +156,7 @@ public:
     virtual std::uint32_t get_max_message_size_reliable(const std::string& _address, std::uint16_t _port) const = 0;
     virtual std::uint32_t get_max_message_size_unreliable() const = 0;
     virtual std::uint32_t get_buffer_shrink_threshold() const = 0;
+    virtual std::uint32_t get_tcp_receive_ring_size() const = 0;
 
     virtual bool supports_selective_broadcasts(const boost::asio::ip::address& _address) const = 0;
 
@@ -225,6 +242,13 @@ public:
     virtual std::uint32_t get_max_tcp_restart_aborts() const = 0;
     virtual std::uint32_t get_max_tcp_connect_time() const = 0;
 
+    // Limits for coalescing queued messages into a single TCP write
+    virtual std::uint32_t get_tcp_gather_write_max_buffers() const = 0;
+    virtual std::uint32_t get_tcp_gather_write_max_bytes() const = 0;
+
+    virtual bool is_io_uring_enabled() const = 0;
+    virtual std::uint32_t get_io_uring_queue_depth() const = 0;
+
     // Acceptance handling
     virtual bool is_protected_device(const boost::asio::ip::address& _address) const = 0;
     virtual bool is_protected_port(const boost::asio::ip::address& _address, std::uint16_t _port, bool _reliable) const = 0;
@@ -251,6 +275,8 @@ public:
     virtual bool is_secure_service(service_t _service, instance_t _instance) const = 0;
 
     virtual int get_udp_receive_buffer_size() const = 0;
+    virtual std::uint32_t get_udp_receive_socket_count(std::uint16_t _port) const = 0;
+    virtual bool is_udp_receive_steered_by_address(std::uint16_t _port) const = 0;
 
     virtual bool check_routing_credentials(client_t _client, const vsomeip_sec_client_t* _sec_client) const = 0;
 
@@ -269,6 +295,12 @@ public:
     virtual uint32_t get_statistics_interval() const = 0;
     virtual uint32_t get_statistics_min_freq() const = 0;
     virtual uint32_t get_statistics_max_messages() const = 0;
+    virtual bool is_latency_statistics_enabled() const = 0;
+    virtual bool is_socket_timestamping_enabled() const = 0;
+    virtual std::uint32_t get_metrics_max_services() const = 0;
+    virtual std::string get_metrics_socket() const = 0;
+    virtual bool is_handler_profiling_enabled() const = 0;
+    virtual std::uint32_t get_slow_handlers_count() const = 0;
 
     virtual uint8_t get_max_remote_subscribers() const = 0;
 
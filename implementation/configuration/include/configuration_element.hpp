@@ -6,19 +6,27 @@
 #ifndef VSOMEIP_V3_CONFIGURATION_CONFIGURATION_ELEMENT_HPP_
 #define VSOMEIP_V3_CONFIGURATION_CONFIGURATION_ELEMENT_HPP_
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/property_tree/ptree.hpp>
 
 namespace vsomeip_v3 {
 
+struct policy;
+
 struct configuration_element {
     std::string name_;
     boost::property_tree::ptree tree_;
+    // Security policies that were converted while the file was read. They
+    // are not part of "tree_", which only keeps an empty "policies" array.
+    std::vector<std::shared_ptr<policy>> policies_;
 
     configuration_element(const std::string& _name, const boost::property_tree::ptree& _tree) noexcept : name_(_name), tree_(_tree) { }
 
-    configuration_element(configuration_element&& _source) noexcept : name_(std::move(_source.name_)), tree_(std::move(_source.tree_)) { }
+    configuration_element(configuration_element&& _source) noexcept : name_(std::move(_source.name_)), tree_(std::move(_source.tree_)),
+        policies_(std::move(_source.policies_)) { }
 
     bool operator<(const configuration_element& _other) const { return (name_ < _other.name_); }
 };
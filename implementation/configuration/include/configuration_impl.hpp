@@ -31,6 +31,8 @@
 
 namespace vsomeip_v3 {
 
+class configuration_cache;
+
 namespace cfg {
 
 struct client;
@@ -92,7 +94,12 @@ public:
     VSOMEIP_EXPORT bool has_file_log() const;
     VSOMEIP_EXPORT bool has_dlt_log() const;
     VSOMEIP_EXPORT const std::string& get_logfile() const;
+    VSOMEIP_EXPORT std::uint64_t get_logfile_max_size() const;
+    VSOMEIP_EXPORT std::uint32_t get_logfile_max_files() const;
     VSOMEIP_EXPORT vsomeip_v3::logger::level_e get_loglevel() const;
+    VSOMEIP_EXPORT bool has_async_log() const;
+    VSOMEIP_EXPORT std::size_t get_async_log_queue_size() const;
+    VSOMEIP_EXPORT bool is_async_log_blocking() const;
 
     VSOMEIP_EXPORT std::string get_unicast_address(service_t _service, instance_t _instance) const;
 
@@ -106,6 +113,8 @@ public:
     VSOMEIP_EXPORT void get_configured_timing_responses(service_t _service, const std::string& _ip_service, std::uint16_t _port_service,
                                                         method_t _method, std::chrono::nanoseconds* _debounce_time,
                                                         std::chrono::nanoseconds* _max_retention_time) const;
+    VSOMEIP_EXPORT npdu_timing_table get_npdu_timings_requests(const std::string& _ip_target, std::uint16_t _port_target) const;
+    VSOMEIP_EXPORT npdu_timing_table get_npdu_timings_responses(const std::string& _ip_service, std::uint16_t _port_service) const;
 
     VSOMEIP_EXPORT bool is_someip(service_t _service, instance_t _instance) const;
 
@@ -131,6 +140,10 @@ public:
     VSOMEIP_EXPORT std::size_t get_max_detached_thread_wait_time(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_io_thread_count(const std::string& _name) const;
     VSOMEIP_EXPORT int get_io_thread_nice_level(const std::string& _name) const;
+    VSOMEIP_EXPORT bool has_io_sharding(const std::string& _name) const;
+    VSOMEIP_EXPORT std::set<std::pair<service_t, instance_t>> get_low_latency_services(const std::string& _name) const;
+    VSOMEIP_EXPORT std::set<unsigned> get_low_latency_cpus(const std::string& _name) const;
+    VSOMEIP_EXPORT std::uint32_t get_low_latency_busy_poll(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_request_debounce_time(const std::string& _name) const;
     VSOMEIP_EXPORT bool has_session_handling(const std::string& _name) const;
     VSOMEIP_EXPORT std::size_t get_event_loop_periodicity(const std::string& _name) const;
@@ -146,10 +159,13 @@ public:
                                                     std::chrono::milliseconds& _cycle, bool& _change_resets_cycle,
                                                     bool& _update_on_change_) const;
 
+    VSOMEIP_EXPORT std::shared_ptr<change_filter_t> get_change_filter(service_t _service, instance_t _instance, event_t _event) const;
+
     VSOMEIP_EXPORT std::uint32_t get_max_message_size_local() const;
     VSOMEIP_EXPORT std::uint32_t get_max_message_size_reliable(const std::string& _address, std::uint16_t _port) const;
     VSOMEIP_EXPORT std::uint32_t get_max_message_size_unreliable() const;
     VSOMEIP_EXPORT std::uint32_t get_buffer_shrink_threshold() const;
+    VSOMEIP_EXPORT std::uint32_t get_tcp_receive_ring_size() const;
 
     VSOMEIP_EXPORT bool supports_selective_broadcasts(const boost::asio::ip::address& _address) const;
 
@@ -225,6 +241,12 @@ public:
     VSOMEIP_EXPORT std::uint32_t get_max_tcp_restart_aborts() const;
     VSOMEIP_EXPORT std::uint32_t get_max_tcp_connect_time() const;
 
+    VSOMEIP_EXPORT std::uint32_t get_tcp_gather_write_max_buffers() const;
+    VSOMEIP_EXPORT std::uint32_t get_tcp_gather_write_max_bytes() const;
+
+    VSOMEIP_EXPORT bool is_io_uring_enabled() const;
+    VSOMEIP_EXPORT std::uint32_t get_io_uring_queue_depth() const;
+
     VSOMEIP_EXPORT bool is_protected_device(const boost::asio::ip::address& _address) const;
     VSOMEIP_EXPORT bool is_protected_port(const boost::asio::ip::address& _address, std::uint16_t _port, bool _reliable) const;
     VSOMEIP_EXPORT bool is_secure_port(const boost::asio::ip::address& _address, std::uint16_t _port, bool _reliable) const;
@@ -238,6 +260,8 @@ public:
     VSOMEIP_EXPORT bool is_secure_service(service_t _service, instance_t _instance) const;
 
     VSOMEIP_EXPORT int get_udp_receive_buffer_size() const;
+    VSOMEIP_EXPORT std::uint32_t get_udp_receive_socket_count(std::uint16_t _port) const;
+    VSOMEIP_EXPORT bool is_udp_receive_steered_by_address(std::uint16_t _port) const;
 
     VSOMEIP_EXPORT bool is_tp_client(service_t _service, instance_t _instance, method_t _method) const;
     VSOMEIP_EXPORT bool is_tp_service(service_t _service, instance_t _instance, method_t _method) const;
@@ -250,6 +274,12 @@ public:
     VSOMEIP_EXPORT uint32_t get_statistics_interval() const;
     VSOMEIP_EXPORT uint32_t get_statistics_min_freq() const;
     VSOMEIP_EXPORT uint32_t get_statistics_max_messages() const;
+    VSOMEIP_EXPORT bool is_latency_statistics_enabled() const;
+    VSOMEIP_EXPORT bool is_socket_timestamping_enabled() const;
+    VSOMEIP_EXPORT std::uint32_t get_metrics_max_services() const;
+    VSOMEIP_EXPORT std::string get_metrics_socket() const;
+    VSOMEIP_EXPORT bool is_handler_profiling_enabled() const;
+    VSOMEIP_EXPORT std::uint32_t get_slow_handlers_count() const;
 
     VSOMEIP_EXPORT uint8_t get_max_remote_subscribers() const;
 
@@ -274,6 +304,7 @@ public:
 private:
     void read_data(const std::set<std::string>& _input, std::vector<configuration_element>& _elements, std::set<std::string>& _failed,
                    bool _mandatory_only, bool _read_second_level = false);
+    bool read_cached_data(const configuration_cache& _cache, std::vector<configuration_element>& _elements, bool _mandatory_only);
 #ifndef VSOMEIP_DISABLE_POLICY
     void load_policy_data(const std::string& _input, std::vector<configuration_element>& _elements, std::set<std::string>& _failed,
                           bool _mandatory_only);
@@ -309,6 +340,7 @@ private:
     void load_trace_channels(const boost::property_tree::ptree& _tree);
     void load_trace_channel(const boost::property_tree::ptree& _tree);
     void load_trace_filters(const boost::property_tree::ptree& _tree);
+    void load_trace_pcap(const boost::property_tree::ptree& _tree);
     void load_trace_filter(const boost::property_tree::ptree& _tree);
     void load_trace_filter_expressions(const boost::property_tree::ptree& _tree, std::string& _criteria,
                                        std::shared_ptr<trace_filter>& _filter);
@@ -364,15 +396,19 @@ private:
 
     void load_debounce(const configuration_element& _element);
     void load_service_debounce(const boost::property_tree::ptree& _tree, debounce_configuration_t& _debounces);
+    void load_low_latency(const boost::property_tree::ptree& _tree, std::set<std::pair<service_t, instance_t>>& _services,
+                          std::set<unsigned>& _cpus, std::uint32_t& _busy_poll);
     void load_events_debounce(const boost::property_tree::ptree& _tree,
                               std::unordered_map<event_t, std::shared_ptr<debounce_filter_impl_t>>& _debounces);
     void load_event_debounce(const boost::property_tree::ptree& _tree,
                              std::unordered_map<event_t, std::shared_ptr<debounce_filter_impl_t>>& _debounces);
     void load_event_debounce_ignore(const boost::property_tree::ptree& _tree, std::map<std::size_t, byte_t>& _ignore);
+    void load_event_change_filter(const boost::property_tree::ptree& _tree, std::shared_ptr<change_filter_t>& _change_filter);
     void load_acceptances(const configuration_element& _element);
     void load_acceptance_data(const boost::property_tree::ptree& _tree);
     void load_activation_file_path(std::set<std::string>& _path, const boost::property_tree::ptree& _tree);
     void load_udp_receive_buffer_size(const configuration_element& _element);
+    void load_udp_receive_sockets(const configuration_element& _element);
     bool load_npdu_debounce_times_configuration(const std::shared_ptr<service>& _service, const boost::property_tree::ptree& _tree);
     bool load_npdu_debounce_times_for_service(const std::shared_ptr<service>& _service, bool _is_request,
                                               const boost::property_tree::ptree& _tree);
@@ -384,6 +420,7 @@ private:
     std::shared_ptr<service> find_service(service_t _service, instance_t _instance) const;
     std::shared_ptr<service> find_service_unlocked(service_t _service, instance_t _instance) const;
     std::shared_ptr<service> find_service(service_t _service, const std::string& _address, std::uint16_t _port) const;
+    npdu_timing_table get_npdu_timings(const std::string& _address, std::uint16_t _port, bool _is_request) const;
     std::shared_ptr<eventgroup> find_eventgroup(service_t _service, instance_t _instance, eventgroup_t _eventgroup) const;
     bool find_port(uint16_t& _port, uint16_t _remote, bool _reliable, std::map<bool, std::set<uint16_t>>& _used_client_ports) const;
     bool find_specific_port(uint16_t& _port, service_t _service, instance_t _instance, bool _reliable,
@@ -407,6 +444,8 @@ private:
     void load_endpoint_queue_sizes(const configuration_element& _element);
 
     void load_tcp_restart_settings(const configuration_element& _element);
+    void load_tcp_gather_write_settings(const configuration_element& _element);
+    void load_io_uring(const configuration_element& _element);
 
     void load_secure_services(const configuration_element& _element);
     void load_secure_service(const boost::property_tree::ptree& _tree);
@@ -439,8 +478,13 @@ protected:
     std::atomic_bool has_file_log_;
     std::atomic_bool has_dlt_log_;
     std::string logfile_;
+    std::uint64_t logfile_max_size_;
+    std::uint32_t logfile_max_files_;
     mutable std::mutex mutex_loglevel_;
     vsomeip_v3::logger::level_e loglevel_;
+    bool has_async_log_;
+    std::size_t async_log_queue_size_;
+    bool is_async_log_blocking_;
 
     std::map<std::string, application_configuration> applications_;
     std::set<client_t> client_identifiers_;
@@ -486,6 +530,7 @@ protected:
     std::uint32_t max_reliable_message_size_;
     std::uint32_t max_unreliable_message_size_;
     std::uint32_t buffer_shrink_threshold_;
+    std::uint32_t tcp_receive_ring_size_;
 
     std::shared_ptr<trace> trace_;
 
@@ -509,6 +554,7 @@ protected:
         ET_LOGGING_FILE,
         ET_LOGGING_DLT,
         ET_LOGGING_LEVEL,
+        ET_LOGGING_ASYNC,
         ET_ROUTING,
         ET_SERVICE_DISCOVERY_ENABLE,
         ET_SERVICE_DISCOVERY_PROTOCOL,
@@ -528,6 +574,7 @@ protected:
         ET_LOCAL_CLIENTS_KEEPALIVE_TIME,
         ET_TRACING_ENABLE,
         ET_TRACING_SD_ENABLE,
+        ET_TRACING_PCAP,
         ET_SERVICE_DISCOVERY_FIND_INITIAL_DEBOUNCE_REPS,
         ET_SERVICE_DISCOVERY_FIND_INITIAL_DEBOUNCE_TIME,
         ET_SERVICE_DISCOVERY_OFFER_DEBOUNCE_TIME,
@@ -539,9 +586,13 @@ protected:
         ET_ENDPOINT_QUEUE_LIMIT_LOCAL,
         ET_TCP_RESTART_ABORTS_MAX,
         ET_TCP_CONNECT_TIME_MAX,
+        ET_TCP_GATHER_WRITE_MAX_BUFFERS,
+        ET_TCP_GATHER_WRITE_MAX_BYTES,
+        ET_IO_URING,
         ET_SD_ACCEPTANCE_REQUIRED,
         ET_NETMASK,
         ET_UDP_RECEIVE_BUFFER_SIZE,
+        ET_UDP_RECEIVE_SOCKETS,
         ET_NPDU_DEFAULT_TIMINGS,
         ET_PLUGIN_NAME,
         ET_PLUGIN_TYPE,
@@ -585,6 +636,12 @@ protected:
     uint32_t tcp_restart_aborts_max_;
     uint32_t tcp_connect_time_max_;
 
+    uint32_t tcp_gather_write_max_buffers_;
+    uint32_t tcp_gather_write_max_bytes_;
+
+    bool is_io_uring_enabled_;
+    uint32_t io_uring_queue_depth_;
+
     mutable std::mutex sd_acceptance_required_ips_mutex_;
     sd_acceptance_rules_t sd_acceptance_rules_;
     std::set<boost::asio::ip::address> sd_acceptance_rules_active_;
@@ -593,6 +650,8 @@ protected:
     bool has_issued_clients_warning_;
 
     int udp_receive_buffer_size_;
+    // port --> (number of sockets, steer by remote address)
+    std::map<std::uint16_t, std::pair<std::uint32_t, bool>> udp_receive_sockets_;
 
     std::chrono::nanoseconds npdu_default_debounce_requ_;
     std::chrono::nanoseconds npdu_default_debounce_resp_;
@@ -608,6 +667,12 @@ protected:
     uint32_t statistics_interval_;
     uint32_t statistics_min_freq_;
     uint32_t statistics_max_messages_;
+    bool is_latency_statistics_enabled_;
+    bool is_socket_timestamping_enabled_;
+    std::uint32_t metrics_max_services_;
+    std::string metrics_socket_;
+    bool is_handler_profiling_enabled_;
+    std::uint32_t slow_handlers_count_;
 
     uint8_t max_remote_subscribers_;
 
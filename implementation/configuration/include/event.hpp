@@ -11,6 +11,8 @@
 
 #include <vsomeip/primitive_types.hpp>
 
+#include "change_filter.hpp"
+
 namespace vsomeip_v3 {
 namespace cfg {
 
@@ -30,6 +32,8 @@ struct event {
     std::chrono::milliseconds cycle_;
     bool change_resets_cycle_;
     bool update_on_change_;
+
+    std::shared_ptr<change_filter_t> change_filter_;
 };
 
 } // namespace cfg
@@ -16,6 +16,7 @@
 #define VSOMEIP_ENV_APPLICATION_NAME            "VSOMEIP_APPLICATION_NAME"
 #define VSOMEIP_ENV_CONFIGURATION               "VSOMEIP_CONFIGURATION"
 #define VSOMEIP_ENV_CONFIGURATION_MODULE        "VSOMEIP_CONFIGURATION_MODULE"
+#define VSOMEIP_ENV_CONFIGURATION_CACHE         "VSOMEIP_CONFIGURATION_CACHE"
 #define VSOMEIP_ENV_E2E_PROTECTION_MODULE       "VSOMEIP_E2E_PROTECTION_MODULE"
 #define VSOMEIP_ENV_MANDATORY_CONFIGURATION_FILES "VSOMEIP_MANDATORY_CONFIGURATION_FILES"
 #define VSOMEIP_ENV_LOAD_PLUGINS                "VSOMEIP_LOAD_PLUGINS"
@@ -66,17 +67,29 @@
 
 #define VSOMEIP_DEFAULT_LOG_INTERVAL            10
 #define VSOMEIP_DEFAULT_QUEUE_WARN_SIZE         32768
+#define VSOMEIP_DEFAULT_ASYNC_LOG_QUEUE_SIZE    1024
+#define VSOMEIP_DEFAULT_LOGFILE_MAX_FILES       3
+
+#define VSOMEIP_DEFAULT_TRACE_PCAP_PATH         VSOMEIP_BASE_PATH "vsomeip-trace.pcapng"
+#define VSOMEIP_DEFAULT_TRACE_PCAP_MAX_SIZE     (16 * 1024 * 1024)
+#define VSOMEIP_DEFAULT_TRACE_PCAP_MAX_FILES    3
+#define VSOMEIP_DEFAULT_TRACE_PCAP_BUFFER_SIZE  (4 * 1024 * 1024)
 
 #define VSOMEIP_MAX_TCP_CONNECT_TIME            5000
 #define VSOMEIP_MAX_TCP_RESTART_ABORTS          5
 #define VSOMEIP_MAX_TCP_SENT_WAIT_TIME          10000
 #define VSOMEIP_TCP_USER_TIMEOUT                3000
+#define VSOMEIP_TCP_GATHER_WRITE_MAX_BUFFERS   1
+#define VSOMEIP_TCP_GATHER_WRITE_MAX_BYTES     65536
 
 #define VSOMEIP_MAX_NETLINK_RETRIES             3
 
 #define VSOMEIP_TP_MAX_SEGMENT_LENGTH_DEFAULT   1392
 
 #define VSOMEIP_DEFAULT_BUFFER_SHRINK_THRESHOLD 5
+#define VSOMEIP_DEFAULT_TCP_RECEIVE_RING_SIZE   16384
+#define VSOMEIP_DEFAULT_IO_URING_QUEUE_DEPTH    256
+#define VSOMEIP_IO_URING_RECEIVE_BUFFERS        256
 
 #define VSOMEIP_DEFAULT_WATCHDOG_TIMEOUT        5000
 #define VSOMEIP_DEFAULT_MAX_MISSING_PONGS       3
@@ -99,6 +112,9 @@
 #define VSOMEIP_DEFAULT_STATISTICS_MAX_MSG      50
 #define VSOMEIP_DEFAULT_STATISTICS_MIN_FREQ     50
 #define VSOMEIP_DEFAULT_STATISTICS_INTERVAL     10000
+#define VSOMEIP_DEFAULT_METRICS_MAX_SERVICES    64
+#define VSOMEIP_DEFAULT_SLOW_HANDLERS           5
+#define VSOMEIP_MAX_LOGGED_LOCK_SITES           5
 
 #define VSOMEIP_DEFAULT_MAX_REMOTE_SUBSCRIBERS  3
 
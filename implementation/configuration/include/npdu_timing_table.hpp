@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_CFG_NPDU_TIMING_TABLE_HPP
+#define VSOMEIP_V3_CFG_NPDU_TIMING_TABLE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+// nPDU debounce and maximum retention times of the messages an endpoint
+// sends, resolved from the configuration when the endpoint is created.
+//
+// The configured methods are kept in a vector that is sorted by service and
+// method, all others use the defaults.
+class npdu_timing_table {
+public:
+    npdu_timing_table() : default_debounce_(0), default_retention_(0) { }
+
+    npdu_timing_table(std::chrono::nanoseconds _default_debounce, std::chrono::nanoseconds _default_retention) :
+        default_debounce_(_default_debounce), default_retention_(_default_retention) { }
+
+    void add(service_t _service, method_t _method, std::chrono::nanoseconds _debounce, std::chrono::nanoseconds _retention) {
+        const entry_t its_entry{to_key(_service, _method), _debounce, _retention};
+        auto its_position = std::lower_bound(entries_.begin(), entries_.end(), its_entry.key_,
+                                             [](const entry_t& _entry, std::uint32_t _key) { return _entry.key_ < _key; });
+        if (its_position != entries_.end() && its_position->key_ == its_entry.key_) {
+            *its_position = its_entry;
+        } else {
+            entries_.insert(its_position, its_entry);
+        }
+    }
+
+    void get(service_t _service, method_t _method, std::chrono::nanoseconds& _debounce, std::chrono::nanoseconds& _retention) const {
+        const std::uint32_t its_key(to_key(_service, _method));
+        auto its_position = std::lower_bound(entries_.begin(), entries_.end(), its_key,
+                                             [](const entry_t& _entry, std::uint32_t _key) { return _entry.key_ < _key; });
+        if (its_position != entries_.end() && its_position->key_ == its_key) {
+            _debounce = its_position->debounce_;
+            _retention = its_position->retention_;
+        } else {
+            _debounce = default_debounce_;
+            _retention = default_retention_;
+        }
+    }
+
+    std::size_t size() const { return entries_.size(); }
+
+private:
+    struct entry_t {
+        std::uint32_t key_;
+        std::chrono::nanoseconds debounce_;
+        std::chrono::nanoseconds retention_;
+    };
+
+    static std::uint32_t to_key(service_t _service, method_t _method) {
+        return (static_cast<std::uint32_t>(_service) << 16) | _method;
+    }
+
+    std::vector<entry_t> entries_;
+    std::chrono::nanoseconds default_debounce_;
+    std::chrono::nanoseconds default_retention_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_CFG_NPDU_TIMING_TABLE_HPP
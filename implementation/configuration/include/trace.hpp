@@ -11,6 +11,7 @@
 
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/trace.hpp>
+#include "internal.hpp"
 #include "../../tracing/include/enumeration_types.hpp"
 
 namespace vsomeip_v3 {
@@ -30,6 +31,14 @@ struct trace_filter {
     std::vector<vsomeip_v3::trace::match_t> matches_;
 };
 
+struct trace_pcap {
+    bool is_enabled_{false};
+    std::string path_{VSOMEIP_DEFAULT_TRACE_PCAP_PATH};
+    std::uint64_t max_size_{VSOMEIP_DEFAULT_TRACE_PCAP_MAX_SIZE};
+    std::uint32_t max_files_{VSOMEIP_DEFAULT_TRACE_PCAP_MAX_FILES};
+    std::size_t buffer_size_{VSOMEIP_DEFAULT_TRACE_PCAP_BUFFER_SIZE};
+};
+
 struct trace {
     trace() : is_enabled_(false), is_sd_enabled_(false), channels_(), filters_() { }
 
@@ -38,6 +47,8 @@ struct trace {
 
     std::vector<std::shared_ptr<trace_channel>> channels_;
     std::vector<std::shared_ptr<trace_filter>> filters_;
+
+    trace_pcap pcap_;
 };
 
 } // namespace cfg
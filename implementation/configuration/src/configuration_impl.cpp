@@ -37,6 +37,8 @@
 #include "../../protocol/include/protocol.hpp"
 #include "../../routing/include/event.hpp"
 #include "../../service_discovery/include/defines.hpp"
+#include "../../utility/include/configuration_cache.hpp"
+#include "../../utility/include/json_reader.hpp"
 #include "../../utility/include/service_instance_map.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../security/include/policy_manager_impl.hpp"
@@ -48,7 +50,8 @@ namespace cfg {
 configuration_impl::configuration_impl(const std::string& _path) :
     default_unicast_{"local"}, is_loaded_{false}, is_logging_loaded_{false}, prefix_{VSOMEIP_PREFIX}, diagnosis_{VSOMEIP_DIAGNOSIS_ADDRESS},
     diagnosis_mask_{0xFF00}, has_console_log_{true}, has_file_log_{false}, has_dlt_log_{false}, logfile_{"/tmp/vsomeip.log"},
-    loglevel_{vsomeip_v3::logger::level_e::LL_INFO}, is_sd_enabled_{VSOMEIP_SD_DEFAULT_ENABLED}, sd_protocol_{VSOMEIP_SD_DEFAULT_PROTOCOL},
+    logfile_max_size_{0}, logfile_max_files_{VSOMEIP_DEFAULT_LOGFILE_MAX_FILES}, loglevel_{vsomeip_v3::logger::level_e::LL_INFO},
+    has_async_log_{false}, async_log_queue_size_{VSOMEIP_DEFAULT_ASYNC_LOG_QUEUE_SIZE}, is_async_log_blocking_{false}, is_sd_enabled_{VSOMEIP_SD_DEFAULT_ENABLED}, sd_protocol_{VSOMEIP_SD_DEFAULT_PROTOCOL},
     sd_multicast_{VSOMEIP_SD_DEFAULT_MULTICAST}, sd_port_{VSOMEIP_SD_DEFAULT_PORT},
     sd_initial_delay_min_{VSOMEIP_SD_DEFAULT_INITIAL_DELAY_MIN}, sd_initial_delay_max_{VSOMEIP_SD_DEFAULT_INITIAL_DELAY_MAX},
     sd_repetitions_base_delay_{VSOMEIP_SD_DEFAULT_REPETITIONS_BASE_DELAY}, sd_repetitions_max_{VSOMEIP_SD_DEFAULT_REPETITIONS_MAX},
@@ -58,18 +61,24 @@ configuration_impl::configuration_impl(const std::string& _path) :
     sd_find_initial_debounce_time_(VSOMEIP_SD_INITIAL_FIND_DEBOUNCE_TIME),
     sd_wait_route_netlink_notification_{VSOMEIP_SD_WAIT_ROUTE_NETLINK_NOTIFICATION}, max_configured_message_size_{0},
     max_local_message_size_{0}, max_reliable_message_size_{0}, max_unreliable_message_size_{0},
-    buffer_shrink_threshold_{VSOMEIP_DEFAULT_BUFFER_SHRINK_THRESHOLD}, trace_{std::make_shared<trace>()},
+    buffer_shrink_threshold_{VSOMEIP_DEFAULT_BUFFER_SHRINK_THRESHOLD},
+    tcp_receive_ring_size_{VSOMEIP_DEFAULT_TCP_RECEIVE_RING_SIZE}, trace_{std::make_shared<trace>()},
     watchdog_{std::make_shared<watchdog>()}, local_clients_keepalive_{std::make_shared<local_clients_keepalive>()}, log_version_{true},
     log_version_interval_{VSOMEIP_DEFAULT_LOG_INTERVAL}, permissions_uds_{VSOMEIP_DEFAULT_UDS_PERMISSIONS}, network_{"vsomeip"},
     e2e_enabled_{false}, log_memory_{false}, log_memory_interval_{0}, log_status_{false}, log_status_interval_{0},
     endpoint_queue_limit_external_{QUEUE_SIZE_UNLIMITED}, endpoint_queue_limit_local_{QUEUE_SIZE_UNLIMITED},
     tcp_restart_aborts_max_{VSOMEIP_MAX_TCP_RESTART_ABORTS}, tcp_connect_time_max_{VSOMEIP_MAX_TCP_CONNECT_TIME},
+    tcp_gather_write_max_buffers_{VSOMEIP_TCP_GATHER_WRITE_MAX_BUFFERS}, tcp_gather_write_max_bytes_{VSOMEIP_TCP_GATHER_WRITE_MAX_BYTES},
+    is_io_uring_enabled_{false}, io_uring_queue_depth_{VSOMEIP_DEFAULT_IO_URING_QUEUE_DEPTH},
     has_issued_methods_warning_{false}, has_issued_clients_warning_{false}, udp_receive_buffer_size_{VSOMEIP_DEFAULT_UDP_RCV_BUFFER_SIZE},
     npdu_default_debounce_requ_{VSOMEIP_DEFAULT_NPDU_DEBOUNCING_NANO}, npdu_default_debounce_resp_{VSOMEIP_DEFAULT_NPDU_DEBOUNCING_NANO},
     npdu_default_max_retention_requ_{VSOMEIP_DEFAULT_NPDU_MAXIMUM_RETENTION_NANO},
     npdu_default_max_retention_resp_{VSOMEIP_DEFAULT_NPDU_MAXIMUM_RETENTION_NANO}, shutdown_timeout_{VSOMEIP_DEFAULT_SHUTDOWN_TIMEOUT},
     log_statistics_{true}, statistics_interval_{VSOMEIP_DEFAULT_STATISTICS_INTERVAL},
     statistics_min_freq_{VSOMEIP_DEFAULT_STATISTICS_MIN_FREQ}, statistics_max_messages_{VSOMEIP_DEFAULT_STATISTICS_MAX_MSG},
+    is_latency_statistics_enabled_{false}, is_socket_timestamping_enabled_{false},
+    metrics_max_services_{VSOMEIP_DEFAULT_METRICS_MAX_SERVICES}, is_handler_profiling_enabled_{false},
+    slow_handlers_count_{VSOMEIP_DEFAULT_SLOW_HANDLERS},
     max_remote_subscribers_{VSOMEIP_DEFAULT_MAX_REMOTE_SUBSCRIBERS}, path_{_path}, is_security_enabled_{false},
     is_security_external_{false}, is_security_audit_{false}, is_remote_access_allowed_{true},
     initial_routing_state_{routing_state_e::RS_UNKNOWN}, request_debounce_time_{VSOMEIP_REQUEST_DEBOUNCE_TIME},
@@ -96,10 +105,14 @@ configuration_impl::configuration_impl(const configuration_impl& _other) :
     has_file_log_{_other.has_file_log_.load()}, has_dlt_log_{_other.has_dlt_log_.load()},
     max_configured_message_size_{_other.max_configured_message_size_}, max_local_message_size_{_other.max_local_message_size_},
     max_reliable_message_size_{_other.max_reliable_message_size_}, max_unreliable_message_size_{_other.max_unreliable_message_size_},
-    buffer_shrink_threshold_{_other.buffer_shrink_threshold_}, permissions_uds_{VSOMEIP_DEFAULT_UDS_PERMISSIONS},
+    buffer_shrink_threshold_{_other.buffer_shrink_threshold_},
+    tcp_receive_ring_size_{_other.tcp_receive_ring_size_}, permissions_uds_{VSOMEIP_DEFAULT_UDS_PERMISSIONS},
     endpoint_queue_limit_external_{_other.endpoint_queue_limit_external_}, endpoint_queue_limit_local_{_other.endpoint_queue_limit_local_},
     tcp_restart_aborts_max_{_other.tcp_restart_aborts_max_}, tcp_connect_time_max_{_other.tcp_connect_time_max_},
-    udp_receive_buffer_size_{_other.udp_receive_buffer_size_}, npdu_default_debounce_requ_{_other.npdu_default_debounce_requ_},
+    tcp_gather_write_max_buffers_{_other.tcp_gather_write_max_buffers_}, tcp_gather_write_max_bytes_{_other.tcp_gather_write_max_bytes_},
+    is_io_uring_enabled_{_other.is_io_uring_enabled_}, io_uring_queue_depth_{_other.io_uring_queue_depth_},
+    udp_receive_buffer_size_{_other.udp_receive_buffer_size_}, udp_receive_sockets_{_other.udp_receive_sockets_},
+    npdu_default_debounce_requ_{_other.npdu_default_debounce_requ_},
     npdu_default_debounce_resp_{_other.npdu_default_debounce_resp_},
     npdu_default_max_retention_requ_{_other.npdu_default_max_retention_requ_},
     npdu_default_max_retention_resp_{_other.npdu_default_max_retention_resp_}, shutdown_timeout_{_other.shutdown_timeout_},
@@ -118,8 +131,13 @@ configuration_impl::configuration_impl(const configuration_impl& _other) :
     diagnosis_mask_ = _other.diagnosis_mask_;
 
     logfile_ = _other.logfile_;
+    logfile_max_size_ = _other.logfile_max_size_;
+    logfile_max_files_ = _other.logfile_max_files_;
 
     loglevel_ = _other.loglevel_;
+    has_async_log_ = _other.has_async_log_;
+    async_log_queue_size_ = _other.async_log_queue_size_;
+    is_async_log_blocking_ = _other.is_async_log_blocking_;
 
     routing_ = _other.routing_;
 
@@ -183,6 +201,12 @@ configuration_impl::configuration_impl(const configuration_impl& _other) :
     statistics_interval_ = _other.statistics_interval_;
     statistics_min_freq_ = _other.statistics_min_freq_;
     statistics_max_messages_ = _other.statistics_max_messages_;
+    is_latency_statistics_enabled_ = _other.is_latency_statistics_enabled_;
+    is_socket_timestamping_enabled_ = _other.is_socket_timestamping_enabled_;
+    metrics_max_services_ = _other.metrics_max_services_;
+    metrics_socket_ = _other.metrics_socket_;
+    is_handler_profiling_enabled_ = _other.is_handler_profiling_enabled_;
+    slow_handlers_count_ = _other.slow_handlers_count_;
     max_remote_subscribers_ = _other.max_remote_subscribers_;
 
     is_security_enabled_ = _other.is_security_enabled_.load();
@@ -275,14 +299,24 @@ bool configuration_impl::load(const std::string& _name) {
     std::vector<configuration_element> its_mandatory_elements;
     std::vector<configuration_element> its_optional_elements;
 
+    // Use the parsed trees of the configuration cache image if it is up to date
+    configuration_cache its_cache;
+    const char* its_cache_path = getenv(VSOMEIP_ENV_CONFIGURATION_CACHE);
+    bool is_cached = (nullptr != its_cache_path && its_cache.open(its_cache_path, its_input));
+
     // Look for the standard configuration file
-    read_data(its_input, its_mandatory_elements, its_failed, true);
+    if (!is_cached || !read_cached_data(its_cache, its_mandatory_elements, true)) {
+        is_cached = false;
+        read_data(its_input, its_mandatory_elements, its_failed, true);
+    }
     load_data(its_mandatory_elements, true, false);
 
     // If the configuration is incomplete, this is the routing manager configuration or
     // the routing is yet unknown, read the full set of configuration files
     if (its_mandatory_elements.empty() || _name == get_routing_host_name() || "" == get_routing_host_name()) {
-        read_data(its_input, its_optional_elements, its_failed, false);
+        if (!is_cached || !read_cached_data(its_cache, its_optional_elements, false)) {
+            read_data(its_input, its_optional_elements, its_failed, false);
+        }
         load_data(its_mandatory_elements, false, true);
         load_data(its_optional_elements, true, true);
     }
@@ -310,6 +344,12 @@ bool configuration_impl::load(const std::string& _name) {
             VSOMEIP_INFO << "Using configuration folder: \"" << i << "\".";
     }
 
+    if (is_cached) {
+        VSOMEIP_INFO << "Using configuration cache: \"" << its_cache_path << "\".";
+    } else if (nullptr != its_cache_path) {
+        VSOMEIP_WARNING << "Configuration cache \"" << its_cache_path << "\" is missing or outdated, read JSON configuration.";
+    }
+
     VSOMEIP_INFO << "Parsed vsomeip configuration in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count()
                  << "ms";
 
@@ -463,6 +503,21 @@ void configuration_impl::read_data(const std::set<std::string>& _input, std::vec
     }
 }
 
+bool configuration_impl::read_cached_data(const configuration_cache& _cache, std::vector<configuration_element>& _elements,
+                                          bool _mandatory_only) {
+    return _cache.get(_elements, [this, _mandatory_only](const std::string& _name) {
+        if (is_mandatory(_name) != _mandatory_only) {
+            return false;
+        }
+#ifndef VSOMEIP_DISABLE_SECURITY
+        if (policy_manager_->is_policy_extension(_name)) {
+            policy_manager_->set_policy_extension_base_path(_name);
+        }
+#endif
+        return true;
+    });
+}
+
 void configuration_impl::load_policy_data(const std::string& _input, std::vector<configuration_element>& _elements,
                                           std::set<std::string>& _failed, bool _mandatory_only) {
     if (is_mandatory(_input) == _mandatory_only) {
@@ -472,10 +527,31 @@ void configuration_impl::load_policy_data(const std::string& _input, std::vector
         }
 #endif
         boost::property_tree::ptree its_tree;
-        try {
-            boost::property_tree::json_parser::read_json(_input, its_tree);
-            _elements.push_back({_input, its_tree});
-        } catch (boost::property_tree::json_parser_error&) {
+        std::vector<std::shared_ptr<policy>> its_policies;
+#ifndef VSOMEIP_DISABLE_SECURITY
+        // Security policies are converted one by one while the file is read
+        // instead of keeping all of them in the tree. As before, a policy
+        // that cannot be converted drops the remaining ones.
+        bool is_converting(true);
+        json_ptree_builder its_builder(its_tree, {"security", "policies"},
+                                       [this, &its_policies, &is_converting](const boost::property_tree::ptree& _policy) {
+                                           if (is_converting) {
+                                               try {
+                                                   its_policies.push_back(policy_manager_->convert_policy(_policy));
+                                               } catch (...) {
+                                                   is_converting = false;
+                                               }
+                                           }
+                                       });
+#else
+        json_ptree_builder its_builder(its_tree);
+#endif
+        std::string its_error;
+        if (json_reader::parse_file(_input, its_builder, its_error)) {
+            _elements.emplace_back(_input, boost::property_tree::ptree());
+            _elements.back().tree_.swap(its_tree);
+            _elements.back().policies_ = std::move(its_policies);
+        } else {
             _failed.insert(_input);
         }
     }
@@ -509,10 +585,13 @@ bool configuration_impl::load_data(const std::vector<configuration_element>& _el
             load_payload_sizes(e);
             load_endpoint_queue_sizes(e);
             load_tcp_restart_settings(e);
+            load_tcp_gather_write_settings(e);
+            load_io_uring(e);
             load_permissions(e);
             load_security(e);
             load_tracing(e);
             load_udp_receive_buffer_size(e);
+            load_udp_receive_sockets(e);
             load_services(e);
             load_local_clients_keepalive(e);
             load_request_debounce_time(e);
@@ -576,6 +655,14 @@ bool configuration_impl::load_logging(const configuration_element& _element, std
                             has_file_log_ = (its_sub_value == "true");
                         } else if (its_sub_key == "path") {
                             logfile_ = its_sub_value;
+                        } else if (its_sub_key == "max-size") {
+                            std::stringstream its_converter;
+                            its_converter << std::dec << its_sub_value;
+                            its_converter >> logfile_max_size_;
+                        } else if (its_sub_key == "max-files") {
+                            std::stringstream its_converter;
+                            its_converter << std::dec << its_sub_value;
+                            its_converter >> logfile_max_files_;
                         }
                     }
                     is_configured_[ET_LOGGING_FILE] = true;
@@ -616,6 +703,30 @@ bool configuration_impl::load_logging(const configuration_element& _element, std
                                                                                             : vsomeip_v3::logger::level_e::LL_INFO))))));
                     is_configured_[ET_LOGGING_LEVEL] = true;
                 }
+            } else if (its_key == "async") {
+                if (is_configured_[ET_LOGGING_ASYNC]) {
+                    _warnings.insert("Multiple definitions for logging.async."
+                                     " Ignoring definition from "
+                                     + _element.name_);
+                } else {
+                    for (auto j : i->second) {
+                        std::string its_sub_key(j.first);
+                        std::string its_sub_value(j.second.data());
+                        if (its_sub_key == "enable") {
+                            has_async_log_ = (its_sub_value == "true");
+                        } else if (its_sub_key == "queue-size") {
+                            std::stringstream its_converter;
+                            its_converter << std::dec << its_sub_value;
+                            its_converter >> async_log_queue_size_;
+                            if (async_log_queue_size_ == 0) {
+                                async_log_queue_size_ = VSOMEIP_DEFAULT_ASYNC_LOG_QUEUE_SIZE;
+                            }
+                        } else if (its_sub_key == "overflow") {
+                            is_async_log_blocking_ = (its_sub_value == "block");
+                        }
+                    }
+                    is_configured_[ET_LOGGING_ASYNC] = true;
+                }
             } else if (its_key == "version") {
                 std::stringstream its_converter;
                 for (auto j : i->second) {
@@ -659,6 +770,20 @@ bool configuration_impl::load_logging(const configuration_element& _element, std
                     } else if (its_sub_key == "max-messages") {
                         its_converter << std::dec << its_sub_value;
                         its_converter >> statistics_max_messages_;
+                    } else if (its_sub_key == "latency") {
+                        is_latency_statistics_enabled_ = (its_sub_value == "true");
+                    } else if (its_sub_key == "socket-timestamps") {
+                        is_socket_timestamping_enabled_ = (its_sub_value == "true");
+                    } else if (its_sub_key == "max-services") {
+                        its_converter << std::dec << its_sub_value;
+                        its_converter >> metrics_max_services_;
+                    } else if (its_sub_key == "metrics-socket") {
+                        metrics_socket_ = its_sub_value;
+                    } else if (its_sub_key == "handler-profiling") {
+                        is_handler_profiling_enabled_ = (its_sub_value == "true");
+                    } else if (its_sub_key == "slow-handlers") {
+                        its_converter << std::dec << its_sub_value;
+                        its_converter >> slow_handlers_count_;
                     }
                 }
             }
@@ -904,6 +1029,10 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
     std::size_t its_event_loop_periodicity{VSOMEIP_DEFAULT_EVENT_LOOP_PERIODICITY};
     std::map<plugin_type_e, std::set<std::string>> plugins;
     int its_io_thread_nice_level(VSOMEIP_DEFAULT_IO_THREAD_NICE_LEVEL);
+    bool has_io_sharding(false);
+    std::set<std::pair<service_t, instance_t>> its_low_latency_services;
+    std::set<unsigned> its_low_latency_cpus;
+    std::uint32_t its_low_latency_busy_poll(0);
     debounce_configuration_t its_debounces;
     bool has_session_handling(true);
     for (auto i = _tree.begin(); i != _tree.end(); ++i) {
@@ -941,6 +1070,10 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
         } else if (its_key == "io_thread_nice") {
             its_converter << std::dec << its_value;
             its_converter >> its_io_thread_nice_level;
+        } else if (its_key == "io_sharding") {
+            has_io_sharding = (its_value == "true");
+        } else if (its_key == "low_latency") {
+            load_low_latency(i->second, its_low_latency_services, its_low_latency_cpus, its_low_latency_busy_poll);
         } else if (its_key == "request_debounce_time") {
             its_converter << std::dec << its_value;
             its_converter >> its_request_debounce_time;
@@ -987,14 +1120,68 @@ void configuration_impl::load_application_data(const boost::property_tree::ptree
                                        its_event_loop_periodicity,
                                        plugins,
                                        its_io_thread_nice_level,
+                                       has_io_sharding,
                                        its_debounces,
-                                       has_session_handling};
+                                       has_session_handling,
+                                       its_low_latency_services,
+                                       its_low_latency_cpus,
+                                       its_low_latency_busy_poll};
         } else {
             VSOMEIP_WARNING << "Multiple configurations for application " << its_name << ". Ignoring a configuration from " << _file_name;
         }
     }
 }
 
+void configuration_impl::load_low_latency(const boost::property_tree::ptree& _tree, std::set<std::pair<service_t, instance_t>>& _services,
+                                          std::set<unsigned>& _cpus, std::uint32_t& _busy_poll) {
+    try {
+        for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+            std::string its_key(i->first);
+            std::string its_value(i->second.data());
+            std::stringstream its_converter;
+
+            if (its_key == "services") {
+                for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                    service_t its_service(ANY_SERVICE);
+                    instance_t its_instance(ANY_INSTANCE);
+                    for (auto k = j->second.begin(); k != j->second.end(); ++k) {
+                        std::string its_inner_value(k->second.data());
+                        std::stringstream its_inner_converter;
+                        if (its_inner_value.size() > 1 && its_inner_value[0] == '0' && its_inner_value[1] == 'x') {
+                            its_inner_converter << std::hex << its_inner_value;
+                        } else {
+                            its_inner_converter << std::dec << its_inner_value;
+                        }
+                        if (k->first == "service") {
+                            its_inner_converter >> its_service;
+                        } else if (k->first == "instance") {
+                            its_inner_converter >> its_instance;
+                        }
+                    }
+                    if (its_service != ANY_SERVICE && its_instance != ANY_INSTANCE) {
+                        _services.emplace(its_service, its_instance);
+                    } else {
+                        VSOMEIP_WARNING << "Ignoring low latency service without service and instance identifier";
+                    }
+                }
+            } else if (its_key == "cpus") {
+                for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                    unsigned its_cpu(0);
+                    std::stringstream its_cpu_converter;
+                    its_cpu_converter << std::dec << j->second.data();
+                    its_cpu_converter >> its_cpu;
+                    _cpus.insert(its_cpu);
+                }
+            } else if (its_key == "busy_poll") {
+                its_converter << std::dec << its_value;
+                its_converter >> _busy_poll;
+            }
+        }
+    } catch (...) {
+        VSOMEIP_ERROR << "Invalid low latency configuration";
+    }
+}
+
 std::map<plugin_type_e, std::set<std::string>> configuration_impl::load_plugins(const boost::property_tree::ptree& _tree,
                                                                                 const std::string& _application_name) {
     std::map<plugin_type_e, std::set<std::string>> its_plugins;
@@ -1104,6 +1291,14 @@ void configuration_impl::load_tracing(const configuration_element& _element) {
                 load_trace_channels(i->second);
             } else if (its_key == "filters") {
                 load_trace_filters(i->second);
+            } else if (its_key == "pcap") {
+                if (is_configured_[ET_TRACING_PCAP]) {
+                    VSOMEIP_WARNING << "Multiple definitions of tracing.pcap."
+                                    << " Ignoring definition from " << _element.name_;
+                } else {
+                    load_trace_pcap(i->second);
+                    is_configured_[ET_TRACING_PCAP] = true;
+                }
             }
         }
     } catch (...) {
@@ -1111,6 +1306,32 @@ void configuration_impl::load_tracing(const configuration_element& _element) {
     }
 }
 
+void configuration_impl::load_trace_pcap(const boost::property_tree::ptree& _tree) {
+    auto& its_pcap = trace_->pcap_;
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        std::string its_key(i->first);
+        std::string its_value(i->second.data());
+        std::stringstream its_converter;
+        if (its_key == "enable") {
+            its_pcap.is_enabled_ = (its_value == "true");
+        } else if (its_key == "path") {
+            its_pcap.path_ = its_value;
+        } else if (its_key == "max-size") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_pcap.max_size_;
+        } else if (its_key == "max-files") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_pcap.max_files_;
+        } else if (its_key == "buffer-size") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_pcap.buffer_size_;
+            if (its_pcap.buffer_size_ == 0) {
+                its_pcap.buffer_size_ = VSOMEIP_DEFAULT_TRACE_PCAP_BUFFER_SIZE;
+            }
+        }
+    }
+}
+
 void configuration_impl::load_trace_channels(const boost::property_tree::ptree& _tree) {
     try {
         for (auto i = _tree.begin(); i != _tree.end(); ++i) {
@@ -2091,6 +2312,7 @@ void configuration_impl::load_event(std::shared_ptr<service>& _service, const bo
         std::chrono::milliseconds its_cycle(std::chrono::milliseconds::zero());
         bool its_change_resets_cycle(false);
         bool its_update_on_change(true);
+        std::shared_ptr<change_filter_t> its_change_filter;
 
         for (auto j = i->second.begin(); j != i->second.end(); ++j) {
             std::string its_key(j->first);
@@ -2119,6 +2341,8 @@ void configuration_impl::load_event(std::shared_ptr<service>& _service, const bo
                 its_change_resets_cycle = (its_value == "true");
             } else if (its_key == "update_on_change") {
                 its_update_on_change = (its_value == "true");
+            } else if (its_key == "change_filter") {
+                load_event_change_filter(j->second, its_change_filter);
             }
         }
 
@@ -2143,6 +2367,7 @@ void configuration_impl::load_event(std::shared_ptr<service>& _service, const bo
 
                 auto its_event = std::make_shared<event>(its_event_id, its_is_field, its_reliability, its_cycle, its_change_resets_cycle,
                                                          its_update_on_change);
+                its_event->change_filter_ = its_change_filter;
                 _service->events_[its_event_id] = its_event;
             }
         }
@@ -2540,6 +2765,7 @@ void configuration_impl::load_payload_sizes(const configuration_element& _elemen
     const std::string payload_sizes("payload-sizes");
     const std::string max_local_payload_size("max-payload-size-local");
     const std::string buffer_shrink_threshold("buffer-shrink-threshold");
+    const std::string tcp_receive_ring_size("tcp-receive-ring-size");
     const std::string max_reliable_payload_size("max-payload-size-reliable");
     const std::string max_unreliable_payload_size("max-payload-size-unreliable");
     try {
@@ -2571,6 +2797,18 @@ void configuration_impl::load_payload_sizes(const configuration_element& _elemen
                 VSOMEIP_ERROR << __func__ << ": " << buffer_shrink_threshold << " " << e.what();
             }
         }
+        if (_element.tree_.get_child_optional(tcp_receive_ring_size)) {
+            auto trrs = _element.tree_.get_child(tcp_receive_ring_size);
+            std::string s(trrs.data());
+            try {
+                tcp_receive_ring_size_ = static_cast<std::uint32_t>(std::stoul(s.c_str(), NULL, 10));
+                if (tcp_receive_ring_size_ < VSOMEIP_SOMEIP_HEADER_SIZE) {
+                    tcp_receive_ring_size_ = VSOMEIP_SOMEIP_HEADER_SIZE;
+                }
+            } catch (const std::exception& e) {
+                VSOMEIP_ERROR << __func__ << ": " << tcp_receive_ring_size << " " << e.what();
+            }
+        }
         if (_element.tree_.get_child_optional(payload_sizes)) {
             const std::string unicast("unicast");
             const std::string ports("ports");
@@ -2878,6 +3116,26 @@ const std::string& configuration_impl::get_logfile() const {
     return logfile_;
 }
 
+std::uint64_t configuration_impl::get_logfile_max_size() const {
+    return logfile_max_size_;
+}
+
+std::uint32_t configuration_impl::get_logfile_max_files() const {
+    return logfile_max_files_;
+}
+
+bool configuration_impl::has_async_log() const {
+    return has_async_log_;
+}
+
+std::size_t configuration_impl::get_async_log_queue_size() const {
+    return async_log_queue_size_;
+}
+
+bool configuration_impl::is_async_log_blocking() const {
+    return is_async_log_blocking_;
+}
+
 vsomeip_v3::logger::level_e configuration_impl::get_loglevel() const {
     std::unique_lock<std::mutex> its_lock(mutex_loglevel_);
     return loglevel_;
@@ -2959,6 +3217,35 @@ void configuration_impl::get_configured_timing_responses(service_t _service, con
     *_max_retention_time = npdu_default_max_retention_resp_;
 }
 
+npdu_timing_table configuration_impl::get_npdu_timings_requests(const std::string& _ip_target, std::uint16_t _port_target) const {
+    return get_npdu_timings(_ip_target, _port_target, true);
+}
+
+npdu_timing_table configuration_impl::get_npdu_timings_responses(const std::string& _ip_service, std::uint16_t _port_service) const {
+    return get_npdu_timings(_ip_service, _port_service, false);
+}
+
+npdu_timing_table configuration_impl::get_npdu_timings(const std::string& _address, std::uint16_t _port, bool _is_request) const {
+    npdu_timing_table its_timings(_is_request ? npdu_default_debounce_requ_ : npdu_default_debounce_resp_,
+                                  _is_request ? npdu_default_max_retention_requ_ : npdu_default_max_retention_resp_);
+
+    auto find_address = services_by_ip_port_.find(_address);
+    if (find_address != services_by_ip_port_.end()) {
+        auto find_port = find_address->second.find(_port);
+        if (find_port != find_address->second.end()) {
+            for (const auto& its_service : find_port->second) {
+                const auto& its_times =
+                        (_is_request ? its_service.second->debounce_times_requests_ : its_service.second->debounce_times_responses_);
+                for (const auto& its_method : its_times) {
+                    its_timings.add(its_service.first, its_method.first, its_method.second[0], its_method.second[1]);
+                }
+            }
+        }
+    }
+
+    return its_timings;
+}
+
 bool configuration_impl::is_someip(service_t _service, instance_t _instance) const {
     auto its_service = find_service(_service, _instance);
     if (its_service)
@@ -3123,6 +3410,41 @@ int configuration_impl::get_io_thread_nice_level(const std::string& _name) const
     return its_io_thread_nice_level;
 }
 
+bool configuration_impl::has_io_sharding(const std::string& _name) const {
+    bool has_io_sharding(false);
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        has_io_sharding = found_application->second.has_io_sharding_;
+    }
+
+    return has_io_sharding;
+}
+
+std::set<std::pair<service_t, instance_t>> configuration_impl::get_low_latency_services(const std::string& _name) const {
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        return found_application->second.low_latency_services_;
+    }
+    return {};
+}
+
+std::set<unsigned> configuration_impl::get_low_latency_cpus(const std::string& _name) const {
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        return found_application->second.low_latency_cpus_;
+    }
+    return {};
+}
+
+std::uint32_t configuration_impl::get_low_latency_busy_poll(const std::string& _name) const {
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end()) {
+        return found_application->second.low_latency_busy_poll_;
+    }
+    return 0;
+}
+
 std::size_t configuration_impl::get_max_dispatchers(const std::string& _name) const {
     size_t its_max_dispatchers{default_max_dispatchers_};
     auto found_application = applications_.find(_name);
@@ -3275,6 +3597,18 @@ void configuration_impl::get_event_update_properties(service_t _service, instanc
     _update_on_change = true;
 }
 
+std::shared_ptr<change_filter_t> configuration_impl::get_change_filter(service_t _service, instance_t _instance, event_t _event) const {
+
+    const auto search = services_.find(service_instance_t{_service, _instance});
+    if (search != services_.end()) {
+        const auto find_event = search->second->events_.find(_event);
+        if (find_event != search->second->events_.end()) {
+            return find_event->second->change_filter_;
+        }
+    }
+    return nullptr;
+}
+
 bool configuration_impl::find_port(uint16_t& _port, uint16_t _remote, bool _reliable,
                                    std::map<bool, std::set<uint16_t>>& _used_client_ports) const {
     bool is_configured(false);
@@ -3504,6 +3838,10 @@ std::uint32_t configuration_impl::get_buffer_shrink_threshold() const {
     return buffer_shrink_threshold_;
 }
 
+std::uint32_t configuration_impl::get_tcp_receive_ring_size() const {
+    return tcp_receive_ring_size_;
+}
+
 bool configuration_impl::supports_selective_broadcasts(const boost::asio::ip::address& _address) const {
     return supported_selective_addresses.find(_address.to_string()) != supported_selective_addresses.end();
 }
@@ -4042,6 +4380,60 @@ void configuration_impl::load_event_debounce_ignore(const boost::property_tree::
     }
 }
 
+void configuration_impl::load_event_change_filter(const boost::property_tree::ptree& _tree,
+                                                  std::shared_ptr<change_filter_t>& _change_filter) {
+    static const std::map<std::string, change_filter_value_e> its_types {
+            {"int8", change_filter_value_e::CFV_INT8},       {"uint8", change_filter_value_e::CFV_UINT8},
+            {"int16", change_filter_value_e::CFV_INT16},     {"uint16", change_filter_value_e::CFV_UINT16},
+            {"int32", change_filter_value_e::CFV_INT32},     {"uint32", change_filter_value_e::CFV_UINT32},
+            {"int64", change_filter_value_e::CFV_INT64},     {"uint64", change_filter_value_e::CFV_UINT64},
+            {"float32", change_filter_value_e::CFV_FLOAT32}, {"float64", change_filter_value_e::CFV_FLOAT64}};
+
+    auto its_change_filter = std::make_shared<change_filter_t>();
+    for (auto i = _tree.begin(); i != _tree.end(); ++i) {
+        std::string its_key(i->first);
+        if (its_key == "ignore") {
+            load_event_debounce_ignore(i->second, its_change_filter->ignore_);
+        } else if (its_key == "tolerances") {
+            for (auto j = i->second.begin(); j != i->second.end(); ++j) {
+                change_filter_t::tolerance_t its_tolerance {0, change_filter_value_e::CFV_UINT8, false, 0.0};
+                bool has_offset(false), is_valid(true);
+                for (auto k = j->second.begin(); k != j->second.end(); ++k) {
+                    std::string its_tolerance_key(k->first);
+                    std::string its_tolerance_value(k->second.data());
+                    std::stringstream its_converter;
+                    if (its_tolerance_key == "offset") {
+                        its_converter << std::dec << its_tolerance_value;
+                        its_converter >> its_tolerance.offset_;
+                        has_offset = !its_converter.fail();
+                    } else if (its_tolerance_key == "type") {
+                        auto found_type = its_types.find(its_tolerance_value);
+                        if (found_type != its_types.end()) {
+                            its_tolerance.type_ = found_type->second;
+                        } else {
+                            VSOMEIP_WARNING << "Unknown change filter tolerance type \"" << its_tolerance_value << "\"";
+                            is_valid = false;
+                        }
+                    } else if (its_tolerance_key == "byte_order") {
+                        its_tolerance.is_little_endian_ = (its_tolerance_value == "little_endian");
+                    } else if (its_tolerance_key == "epsilon") {
+                        its_converter << its_tolerance_value;
+                        its_converter >> its_tolerance.epsilon_;
+                        is_valid = is_valid && !its_converter.fail();
+                    }
+                }
+                if (has_offset && is_valid) {
+                    its_change_filter->tolerances_.push_back(its_tolerance);
+                }
+            }
+        }
+    }
+
+    if (!its_change_filter->ignore_.empty() || !its_change_filter->tolerances_.empty()) {
+        _change_filter = its_change_filter;
+    }
+}
+
 void configuration_impl::load_acceptances(const configuration_element& _element) {
     std::string its_acceptances_key("acceptances");
     try {
@@ -4387,6 +4779,37 @@ void configuration_impl::load_udp_receive_buffer_size(const configuration_elemen
     }
 }
 
+void configuration_impl::load_udp_receive_sockets(const configuration_element& _element) {
+    const std::string its_receive_sockets("udp-receive-sockets");
+    try {
+        if (_element.tree_.get_child_optional(its_receive_sockets)) {
+            if (is_configured_[ET_UDP_RECEIVE_SOCKETS]) {
+                VSOMEIP_WARNING << "Multiple definitions of " << its_receive_sockets << " Ignoring definition from " << _element.name_;
+            } else {
+                for (const auto& i : _element.tree_.get_child(its_receive_sockets)) {
+                    std::uint16_t its_port(ILLEGAL_PORT);
+                    std::uint32_t its_count(1);
+                    bool is_steered(false);
+                    try {
+                        its_port = static_cast<std::uint16_t>(std::stoul(i.second.get<std::string>("port"), nullptr, 10));
+                        its_count = static_cast<std::uint32_t>(std::stoul(i.second.get<std::string>("count"), nullptr, 10));
+                        is_steered = (i.second.get<std::string>("steering", "") == "remote-address");
+                    } catch (const std::exception& e) {
+                        VSOMEIP_ERROR << __func__ << ": " << its_receive_sockets << " " << e.what();
+                        continue;
+                    }
+                    if (its_port != ILLEGAL_PORT && its_count > 1) {
+                        udp_receive_sockets_[its_port] = std::make_pair(its_count, is_steered);
+                    }
+                }
+                is_configured_[ET_UDP_RECEIVE_SOCKETS] = true;
+            }
+        }
+    } catch (...) {
+        // intentionally left empty
+    }
+}
+
 void configuration_impl::load_secure_services(const configuration_element& _element) {
     std::lock_guard<std::mutex> its_lock(secure_services_mutex_);
     try {
@@ -4501,6 +4924,96 @@ void configuration_impl::load_tcp_restart_settings(const configuration_element&
     }
 }
 
+void configuration_impl::load_tcp_gather_write_settings(const configuration_element& _element) {
+    const std::string tcp_gather_write_max_buffers("tcp-gather-write-max-buffers");
+    const std::string tcp_gather_write_max_bytes("tcp-gather-write-max-bytes");
+
+    try {
+        if (_element.tree_.get_child_optional(tcp_gather_write_max_buffers)) {
+            if (is_configured_[ET_TCP_GATHER_WRITE_MAX_BUFFERS]) {
+                VSOMEIP_WARNING << "Multiple definitions for " << tcp_gather_write_max_buffers << " Ignoring definition from "
+                                << _element.name_;
+            } else {
+                is_configured_[ET_TCP_GATHER_WRITE_MAX_BUFFERS] = true;
+                auto mpsl = _element.tree_.get_child(tcp_gather_write_max_buffers);
+                std::string s(mpsl.data());
+                try {
+                    tcp_gather_write_max_buffers_ = static_cast<std::uint32_t>(std::stoul(s.c_str(), NULL, 10));
+                    if (tcp_gather_write_max_buffers_ == 0) {
+                        tcp_gather_write_max_buffers_ = 1;
+                    }
+                } catch (const std::exception& e) {
+                    VSOMEIP_ERROR << __func__ << ": " << tcp_gather_write_max_buffers << " " << e.what();
+                }
+            }
+        }
+        if (_element.tree_.get_child_optional(tcp_gather_write_max_bytes)) {
+            if (is_configured_[ET_TCP_GATHER_WRITE_MAX_BYTES]) {
+                VSOMEIP_WARNING << "Multiple definitions for " << tcp_gather_write_max_bytes << " Ignoring definition from "
+                                << _element.name_;
+            } else {
+                is_configured_[ET_TCP_GATHER_WRITE_MAX_BYTES] = true;
+                auto mpsl = _element.tree_.get_child(tcp_gather_write_max_bytes);
+                std::string s(mpsl.data());
+                try {
+                    tcp_gather_write_max_bytes_ = static_cast<std::uint32_t>(std::stoul(s.c_str(), NULL, 10));
+                } catch (const std::exception& e) {
+                    VSOMEIP_ERROR << __func__ << ": " << tcp_gather_write_max_bytes << " " << e.what();
+                }
+            }
+        }
+    } catch (...) {
+        // intentionally left empty
+    }
+}
+
+std::uint32_t configuration_impl::get_tcp_gather_write_max_buffers() const {
+    return tcp_gather_write_max_buffers_;
+}
+
+std::uint32_t configuration_impl::get_tcp_gather_write_max_bytes() const {
+    return tcp_gather_write_max_bytes_;
+}
+
+void configuration_impl::load_io_uring(const configuration_element& _element) {
+    const std::string io_uring("io-uring");
+    try {
+        if (_element.tree_.get_child_optional(io_uring)) {
+            if (is_configured_[ET_IO_URING]) {
+                VSOMEIP_WARNING << "Multiple definitions for " << io_uring << " Ignoring definition from " << _element.name_;
+            } else {
+                is_configured_[ET_IO_URING] = true;
+                for (const auto& i : _element.tree_.get_child(io_uring)) {
+                    const std::string its_key(i.first);
+                    const std::string its_value(i.second.data());
+                    try {
+                        if (its_key == "enable") {
+                            is_io_uring_enabled_ = (its_value == "true");
+                        } else if (its_key == "queue-depth") {
+                            io_uring_queue_depth_ = static_cast<std::uint32_t>(std::stoul(its_value, nullptr, 10));
+                            if (io_uring_queue_depth_ == 0) {
+                                io_uring_queue_depth_ = VSOMEIP_DEFAULT_IO_URING_QUEUE_DEPTH;
+                            }
+                        }
+                    } catch (const std::exception& e) {
+                        VSOMEIP_ERROR << __func__ << ": " << io_uring << "." << its_key << " " << e.what();
+                    }
+                }
+            }
+        }
+    } catch (...) {
+        // intentionally left empty
+    }
+}
+
+bool configuration_impl::is_io_uring_enabled() const {
+    return is_io_uring_enabled_;
+}
+
+std::uint32_t configuration_impl::get_io_uring_queue_depth() const {
+    return io_uring_queue_depth_;
+}
+
 std::uint32_t configuration_impl::get_max_tcp_restart_aborts() const {
     return tcp_restart_aborts_max_;
 }
@@ -4699,6 +5212,19 @@ int configuration_impl::get_udp_receive_buffer_size() const {
     return udp_receive_buffer_size_;
 }
 
+std::uint32_t configuration_impl::get_udp_receive_socket_count(std::uint16_t _port) const {
+    auto found_port = udp_receive_sockets_.find(_port);
+    if (found_port != udp_receive_sockets_.end()) {
+        return found_port->second.first;
+    }
+    return 1;
+}
+
+bool configuration_impl::is_udp_receive_steered_by_address(std::uint16_t _port) const {
+    auto found_port = udp_receive_sockets_.find(_port);
+    return (found_port != udp_receive_sockets_.end() && found_port->second.second);
+}
+
 bool configuration_impl::is_tp_client(service_t _service, instance_t _instance, method_t _method) const {
 
     bool ret(false);
@@ -4782,6 +5308,31 @@ uint32_t configuration_impl::get_statistics_max_messages() const {
     return statistics_max_messages_;
 }
 
+bool configuration_impl::is_latency_statistics_enabled() const {
+    return is_latency_statistics_enabled_;
+}
+
+bool configuration_impl::is_socket_timestamping_enabled() const {
+    // The timestamps are only used by the latency statistics
+    return is_latency_statistics_enabled_ && is_socket_timestamping_enabled_;
+}
+
+std::uint32_t configuration_impl::get_metrics_max_services() const {
+    return metrics_max_services_;
+}
+
+std::string configuration_impl::get_metrics_socket() const {
+    return metrics_socket_;
+}
+
+bool configuration_impl::is_handler_profiling_enabled() const {
+    return is_handler_profiling_enabled_;
+}
+
+std::uint32_t configuration_impl::get_slow_handlers_count() const {
+    return slow_handlers_count_;
+}
+
 uint8_t configuration_impl::get_max_remote_subscribers() const {
     return max_remote_subscribers_;
 }
@@ -11,8 +11,10 @@
 #include <boost/asio/local/stream_protocol.hpp>
 #endif
 #include <functional>
+#include <tuple>
 
 #include "abstract_netlink_connector.hpp"
+#include "socket_receiver.hpp"
 #include "tcp_socket.hpp"
 
 namespace vsomeip_v3 {
@@ -35,14 +37,27 @@ public:
     virtual std::unique_ptr<tcp_socket> create_tcp_socket(boost::asio::io_context& _io) = 0;
     virtual std::unique_ptr<tcp_acceptor> create_tcp_acceptor(boost::asio::io_context& _io) = 0;
 
-    std::unique_ptr<boost::asio::ip::udp::socket> create_udp_socket(boost::asio::io_context& _io) {
+    virtual std::unique_ptr<boost::asio::ip::udp::socket> create_udp_socket(boost::asio::io_context& _io) {
         return std::make_unique<boost::asio::ip::udp::socket>(_io);
     }
 
+    // Receivers that read the UDP sockets of the endpoints instead of boost::asio.
+    // nullptr means the endpoints receive through their asio sockets.
+    virtual std::unique_ptr<udp_receiver> create_udp_receiver(boost::asio::io_context& _io) {
+        std::ignore = _io;
+        return nullptr;
+    }
+
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
-    std::unique_ptr<boost::asio::local::stream_protocol::socket> create_uds_socket(boost::asio::io_context& _io) {
+    virtual std::unique_ptr<boost::asio::local::stream_protocol::socket> create_uds_socket(boost::asio::io_context& _io) {
         return std::make_unique<boost::asio::local::stream_protocol::socket>(_io);
     }
+
+    // Same as create_udp_receiver, for the connections of the local server endpoints
+    virtual std::unique_ptr<uds_receiver> create_uds_receiver(boost::asio::io_context& _io) {
+        std::ignore = _io;
+        return nullptr;
+    }
 #endif
 };
 
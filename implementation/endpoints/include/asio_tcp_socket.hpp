@@ -6,6 +6,7 @@
 #ifndef VSOMEIP_V3_ASIO_TCP_SOCKET_HPP_
 #define VSOMEIP_V3_ASIO_TCP_SOCKET_HPP_
 
+#include "socket_timestamping.hpp"
 #include "tcp_socket.hpp"
 
 #include <boost/asio/write.hpp>
@@ -17,11 +18,11 @@ namespace vsomeip_v3 {
 
 class asio_tcp_acceptor;
 
-class asio_tcp_socket final : public tcp_socket {
+class asio_tcp_socket : public tcp_socket {
 public:
-    asio_tcp_socket(boost::asio::io_context& _io) : socket_(_io) { }
+    asio_tcp_socket(boost::asio::io_context& _io) : socket_(_io), is_timestamping_(false) { }
 
-private:
+protected:
     [[nodiscard]] bool is_open() const override { return socket_.is_open(); }
     [[nodiscard]] int native_handle() override { return socket_.native_handle(); }
 
@@ -39,6 +40,10 @@ private:
     [[nodiscard]] bool set_user_timeout(unsigned int timeout) override {
         return setsockopt(socket_.native_handle(), IPPROTO_TCP, TCP_USER_TIMEOUT, &timeout, sizeof(timeout)) != -1;
     }
+    [[nodiscard]] bool enable_receive_timestamps() override {
+        is_timestamping_ = socket_timestamping::enable(socket_.native_handle());
+        return is_timestamping_;
+    }
 #endif
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
     [[nodiscard]] bool bind_to_device(std::string const& _device) override {
@@ -52,17 +57,29 @@ private:
     void async_connect(boost::asio::ip::tcp::endpoint const& ep, connect_handler handler) override {
         socket_.async_connect(ep, std::move(handler));
     }
-    void async_receive(boost::asio::mutable_buffer b, rw_handler handler) override { socket_.async_receive(b, std::move(handler)); }
+    void async_receive(boost::asio::mutable_buffer b, rw_handler handler) override {
+#if defined(__linux__) || defined(ANDROID)
+        if (is_timestamping_) {
+            socket_timestamping::async_receive(socket_, b, std::move(handler));
+            return;
+        }
+#endif
+        socket_.async_receive(b, std::move(handler));
+    }
     void async_write(std::vector<boost::asio::const_buffer> const& bs, rw_handler handler) override {
         boost::asio::async_write(socket_, bs, std::move(handler));
     }
     void async_write(boost::asio::const_buffer const& b, completion_condition cc, rw_handler handler) override {
         boost::asio::async_write(socket_, b, std::move(cc), std::move(handler));
     }
+    void async_write(std::vector<boost::asio::const_buffer> const& bs, completion_condition cc, rw_handler handler) override {
+        boost::asio::async_write(socket_, bs, std::move(cc), std::move(handler));
+    }
 
     // needs to access the socket member to create a meaningful new connection
     friend class asio_tcp_acceptor;
     boost::asio::ip::tcp::socket socket_;
+    bool is_timestamping_;
 };
 
 class asio_tcp_acceptor final : public tcp_acceptor {
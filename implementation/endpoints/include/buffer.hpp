@@ -6,10 +6,14 @@
 #ifndef VSOMEIP_V3_BUFFER_HPP_
 #define VSOMEIP_V3_BUFFER_HPP_
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <memory>
-#include <set>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -37,13 +41,103 @@ struct timing {
 };
 #endif
 
+// The service/method pairs of the messages in a train. Trains usually carry
+// a few passengers, which are kept in an inline array. Only crowded trains
+// fall back to a hash set.
+class train_passengers {
+public:
+    train_passengers() : size_(0) { }
+
+    bool empty() const { return size_ == 0; }
+
+    bool contains(service_t _service, method_t _method) const {
+        const std::uint32_t its_key(to_key(_service, _method));
+        const auto its_end = inline_.begin() + (std::min)(size_, inline_.size());
+        return std::find(inline_.begin(), its_end, its_key) != its_end || (!overflow_.empty() && overflow_.count(its_key) > 0);
+    }
+
+    bool contains_service(service_t _service) const {
+        const auto its_end = inline_.begin() + (std::min)(size_, inline_.size());
+        auto is_service = [_service](std::uint32_t _key) { return (_key >> 16) == _service; };
+        return std::any_of(inline_.begin(), its_end, is_service) || std::any_of(overflow_.begin(), overflow_.end(), is_service);
+    }
+
+    void insert(service_t _service, method_t _method) {
+        if (contains(_service, _method)) {
+            return;
+        }
+        if (size_ < inline_.size()) {
+            inline_[size_] = to_key(_service, _method);
+        } else {
+            overflow_.insert(to_key(_service, _method));
+        }
+        size_++;
+    }
+
+    void clear() {
+        size_ = 0;
+        overflow_.clear();
+    }
+
+private:
+    static std::uint32_t to_key(service_t _service, method_t _method) {
+        return (static_cast<std::uint32_t>(_service) << 16) | _method;
+    }
+
+    std::array<std::uint32_t, 16> inline_;
+    std::size_t size_;
+    std::unordered_set<std::uint32_t> overflow_;
+};
+
+// Recycles the buffers of departed trains. The pool keeps a reference to the
+// buffers it created and hands one out again once all other references were
+// dropped, which usually happens after it was sent. Buffers are reserved to
+// the size of a full train, so that boarding does not reallocate.
+class train_buffer_pool {
+public:
+    // At most "max_reserve" bytes are reserved upfront, as the maximum message
+    // size may be unlimited. Larger trains grow their buffer as needed.
+    static constexpr std::size_t max_reserve = 4096;
+    // Buffers that grew beyond this are released instead of being kept
+    static constexpr std::size_t max_recycled_capacity = 65536;
+    static constexpr std::size_t max_buffers = 8;
+
+    message_buffer_ptr_t get(std::size_t _capacity) {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        for (const auto& b : buffers_) {
+            // Only the pool can hand out new references to its buffers
+            if (b.use_count() == 1) {
+                // Pairs with the release of the last reference on the sending thread
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (b->capacity() > max_recycled_capacity) {
+                    message_buffer_t().swap(*b);
+                }
+                b->clear();
+                b->reserve(std::min(_capacity, max_reserve));
+                return b;
+            }
+        }
+
+        auto its_buffer = std::make_shared<message_buffer_t>();
+        its_buffer->reserve(std::min(_capacity, max_reserve));
+        if (buffers_.size() < max_buffers) {
+            buffers_.push_back(its_buffer);
+        }
+        return its_buffer;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<message_buffer_ptr_t> buffers_;
+};
+
 struct train {
-    train() :
-        buffer_(std::make_shared<message_buffer_t>()), minimal_debounce_time_(DEFAULT_NANOSECONDS_MAX),
+    explicit train(message_buffer_ptr_t _buffer) :
+        buffer_(std::move(_buffer)), minimal_debounce_time_(DEFAULT_NANOSECONDS_MAX),
         minimal_max_retention_time_(DEFAULT_NANOSECONDS_MAX), departure_(std::chrono::steady_clock::now() + std::chrono::hours(6)) {};
 
-    void reset() {
-        buffer_ = std::make_shared<message_buffer_t>();
+    void reset(message_buffer_ptr_t _buffer) {
+        buffer_ = std::move(_buffer);
         passengers_.clear();
         minimal_debounce_time_ = DEFAULT_NANOSECONDS_MAX;
         minimal_max_retention_time_ = DEFAULT_NANOSECONDS_MAX;
@@ -51,7 +145,7 @@ struct train {
     }
 
     message_buffer_ptr_t buffer_;
-    std::set<std::pair<service_t, method_t>> passengers_;
+    train_passengers passengers_;
 
     std::chrono::nanoseconds minimal_debounce_time_;
     std::chrono::nanoseconds minimal_max_retention_time_;
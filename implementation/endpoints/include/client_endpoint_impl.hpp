@@ -24,6 +24,9 @@
 #include "endpoint_impl.hpp"
 #include "client_endpoint.hpp"
 #include "tp.hpp"
+#include "../../configuration/include/npdu_timing_table.hpp"
+#include "../../utility/include/instrumentation.hpp"
+#include "../../utility/include/timing_wheel.hpp"
 
 namespace boost::asio::ip {
 class tcp;
@@ -73,6 +76,7 @@ public:
     virtual bool is_reliable() const = 0;
 
     size_t get_queue_size() const;
+    bool get_metrics(endpoint_metrics_t& _metrics) const;
 
 public:
     void cancel_and_connect_cbk(boost::system::error_code const& _error);
@@ -94,9 +98,9 @@ protected:
     enum class connecting_timer_state_e : std::uint8_t { IN_PROGRESS, FINISH_SUCCESS, FINISH_ERROR };
 
     std::pair<message_buffer_ptr_t, uint32_t> get_front();
+    // Drops the queued buffers, must be called with "mutex_" locked
+    void drop_queue();
     virtual void send_queued(std::pair<message_buffer_ptr_t, uint32_t>& _entry) = 0;
-    virtual void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
-                                                    std::chrono::nanoseconds* _maximum_retention) const = 0;
     void shutdown_and_close_socket(bool _recreate_socket);
     void shutdown_and_close_socket_unlocked(bool _recreate_socket);
     void start_connect_timer();
@@ -127,16 +131,23 @@ protected:
     std::atomic<uint32_t> connecting_timeout_;
 
     // send data
+    std::shared_ptr<train_buffer_pool> train_buffers_;
     std::shared_ptr<train> train_;
     std::map<std::chrono::steady_clock::time_point, std::deque<std::shared_ptr<train>>> dispatched_trains_;
-    boost::asio::steady_timer dispatch_timer_;
+    wheel_timer dispatch_timer_;
+    // Expiry of the pending dispatch wait, max() if there is none
+    std::chrono::steady_clock::time_point dispatch_expiry_;
     std::chrono::steady_clock::time_point last_departure_;
     std::atomic<bool> has_last_departure_;
 
     std::deque<std::pair<message_buffer_ptr_t, uint32_t>> queue_;
     std::size_t queue_size_;
 
-    mutable std::recursive_mutex mutex_;
+    mutable named_recursive_mutex mutex_;
+
+    // Debounce and retention times of the messages that are sent, guarded by
+    // "mutex_"
+    npdu_timing_table npdu_timings_;
 
     std::atomic<bool> was_not_connected_;
 
@@ -147,6 +158,9 @@ protected:
 private:
     virtual void set_local_port() = 0;
     virtual std::string get_remote_information() const = 0;
+    // Aborts the receives that are not done by the socket itself, called with
+    // "socket_mutex_" locked before the socket is closed
+    virtual void cancel_receive_unlocked();
     virtual bool tp_segmentation_enabled(service_t _service, instance_t _instance, method_t _method) const;
     virtual std::uint32_t get_max_allowed_reconnects() const = 0;
     virtual void max_allowed_reconnects_reached() = 0;
@@ -154,6 +168,8 @@ private:
 
     void schedule_train();
 
+    // Next train to depart, must be called with "mutex_" locked
+    std::shared_ptr<train> get_next_train() const;
     void start_dispatch_timer(const std::chrono::steady_clock::time_point& _now);
     void cancel_dispatch_timer();
     void recreate_socket();
@@ -10,7 +10,9 @@
 
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/constants.hpp>
+#include <vsomeip/structured_types.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace vsomeip_v3 {
@@ -21,6 +23,8 @@ class endpoint {
 public:
     typedef std::function<void()> error_handler_t;
     typedef std::function<void(const std::shared_ptr<endpoint>&)> prepare_stop_handler_t;
+    // Serialized messages that may be shared by the batches of several targets
+    typedef std::vector<std::shared_ptr<const std::vector<byte_t>>> batch_t;
 
     virtual ~endpoint() = default;
 
@@ -37,6 +41,14 @@ public:
     virtual bool send(const byte_t* _data, uint32_t _size) = 0;
     virtual bool send_to(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) = 0;
     virtual bool send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) = 0;
+    // Sends several messages to the same target.
+    virtual bool send_batch_to(const std::shared_ptr<endpoint_definition> _target, const batch_t& _messages) {
+        bool is_sent(true);
+        for (const auto& m : _messages) {
+            is_sent = send_to(_target, m->data(), static_cast<uint32_t>(m->size())) && is_sent;
+        }
+        return is_sent;
+    }
     virtual void enable_magic_cookies() = 0;
     virtual void receive() = 0;
 
@@ -55,6 +67,9 @@ public:
 
     virtual void print_status() = 0;
     virtual size_t get_queue_size() const = 0;
+    // Fills the counters and the queue size, returns false if the endpoint
+    // does not record metrics
+    virtual bool get_metrics(endpoint_metrics_t& _metrics) const = 0;
 
     virtual void set_established(bool _established) = 0;
     virtual void set_connected(bool _connected) = 0;
@@ -16,6 +16,7 @@
 #include "buffer.hpp"
 #include "endpoint.hpp"
 #include "../../configuration/include/configuration.hpp"
+#include "../../utility/include/metrics.hpp"
 
 namespace vsomeip_v3 {
 
@@ -47,6 +48,18 @@ public:
     virtual void print_status() = 0;
 
     virtual size_t get_queue_size() const = 0;
+    bool get_metrics(endpoint_metrics_t& _metrics) const;
+
+    // Called by the send completion handlers for each buffer that was
+    // written and for each queued buffer that is dropped, see get_metrics
+    void count_sent(const message_buffer_t& _buffer);
+    void count_dropped(const message_buffer_t& _buffer);
+
+    // Called by the receive paths, see get_metrics
+    inline void count_received(std::uint32_t _size) {
+        counters_.add(EC_MESSAGES_RECEIVED);
+        counters_.add(EC_BYTES_RECEIVED, _size);
+    }
 
 public:
     // required
@@ -55,7 +68,9 @@ public:
     virtual void restart(bool _force) = 0;
 
 protected:
-    uint32_t find_magic_cookie(byte_t* _buffer, size_t _size);
+    uint32_t find_magic_cookie(const byte_t* _buffer, size_t _size);
+    // Messages (commands of local endpoints) in a buffer, without magic cookies
+    std::uint32_t get_message_count(const message_buffer_t& _buffer) const;
     instance_t get_instance(service_t _service);
 
 protected:
@@ -91,6 +106,9 @@ protected:
     std::shared_ptr<configuration> configuration_;
 
     bool is_supporting_someip_tp_;
+
+    // Also updated by the (const) queue limit checks
+    mutable endpoint_counters counters_;
 };
 
 } // namespace vsomeip_v3
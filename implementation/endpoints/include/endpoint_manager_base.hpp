@@ -54,6 +54,8 @@ public:
 
     // Statistics
     void log_client_states() const;
+    // Appends the metrics of the local client endpoints
+    void get_metrics(std::vector<endpoint_metrics_t>& _metrics) const;
 
     // Multicast options
     void add_multicast_option(const multicast_option_t& _option);
@@ -75,6 +75,9 @@ public:
     // Statistics
     void log_client_states() const;
     void log_server_states() const;
+    // Appends the metrics of the local client, remote client and server
+    // endpoints
+    void get_metrics(std::vector<endpoint_metrics_t>& _metrics) const;
 
     // add join/leave options
     void add_multicast_option(const multicast_option_t& _option);
@@ -85,8 +88,8 @@ public:
 private:
     std::shared_ptr<endpoint> find_remote_client(service_t _service, instance_t _instance, bool _reliable);
     std::shared_ptr<endpoint> create_remote_client(service_t _service, instance_t _instance, bool _reliable);
-    std::shared_ptr<endpoint> create_client_endpoint(const boost::asio::ip::address& _address, uint16_t _local_port, uint16_t _remote_port,
-                                                     bool _reliable);
+    std::shared_ptr<endpoint> create_client_endpoint(service_t _service, instance_t _instance, const boost::asio::ip::address& _address,
+                                                     uint16_t _local_port, uint16_t _remote_port, bool _reliable);
 
     // process join/leave options
     void process_multicast_options();
@@ -47,9 +47,6 @@ public:
     bool send_to(const std::shared_ptr<endpoint_definition>, const byte_t* _data, uint32_t _size);
     bool send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size);
     bool send_queued(const target_data_iterator_type _queue_iterator);
-    void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
-                                            std::chrono::nanoseconds* _maximum_retention) const;
-
     bool get_default_target(service_t, endpoint_type&) const;
 
     bool is_local() const;
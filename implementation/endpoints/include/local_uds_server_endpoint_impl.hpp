@@ -17,6 +17,7 @@
 
 #include "buffer.hpp"
 #include "server_endpoint_impl.hpp"
+#include "socket_receiver.hpp"
 
 namespace vsomeip_v3 {
 
@@ -44,9 +45,6 @@ public:
     bool send_to(const std::shared_ptr<endpoint_definition>, const byte_t* _data, uint32_t _size);
     bool send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size);
     bool send_queued(const target_data_iterator_type _queue_iterator);
-    void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
-                                            std::chrono::nanoseconds* _maximum_retention) const;
-
     bool get_default_target(service_t, endpoint_type&) const;
 
     bool is_local() const;
@@ -131,6 +129,9 @@ private:
 
         bool assigned_client_;
         std::atomic<bool> is_stopped_;
+
+        // Reads the socket instead of boost::asio if the socket factory provides it
+        std::unique_ptr<uds_receiver> receiver_;
     };
 
     std::mutex acceptor_mutex_;
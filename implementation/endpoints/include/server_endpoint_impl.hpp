@@ -20,6 +20,9 @@
 #include "endpoint_impl.hpp"
 #include "server_endpoint.hpp"
 #include "tp.hpp"
+#include "../../configuration/include/npdu_timing_table.hpp"
+#include "../../utility/include/instrumentation.hpp"
+#include "../../utility/include/timing_wheel.hpp"
 #if defined(__QNX__)
 #include "../../utility/include/qnx_helper.hpp"
 #endif
@@ -34,18 +37,22 @@ public:
     typedef typename Protocol::socket socket_type;
     typedef typename Protocol::endpoint endpoint_type;
     struct endpoint_data_type {
-        endpoint_data_type(boost::asio::io_context& _io) :
-            train_(std::make_shared<train>()), dispatch_timer_(std::make_shared<boost::asio::steady_timer>(_io)),
-            has_last_departure_(false), queue_size_(0), is_sending_(false), sent_timer_(_io), io_(_io) { }
+        endpoint_data_type(boost::asio::io_context& _io, message_buffer_ptr_t _buffer) :
+            train_(std::make_shared<train>(std::move(_buffer))), dispatch_timer_(std::make_shared<wheel_timer>(_io)),
+            dispatch_expiry_(std::chrono::steady_clock::time_point::max()), has_last_departure_(false), queue_size_(0), is_sending_(false),
+            sending_count_(1), sent_timer_(_io), io_(_io) { }
 
         endpoint_data_type(const endpoint_data_type&& _source) :
-            train_(_source.train_), dispatch_timer_(std::make_shared<boost::asio::steady_timer>(_source.io_)),
-            has_last_departure_(_source.has_last_departure_), queue_(_source.queue_), queue_size_(_source.queue_size_),
-            is_sending_(_source.is_sending_), sent_timer_(_source.io_), io_(_source.io_) { }
+            train_(_source.train_), dispatch_timer_(std::make_shared<wheel_timer>(_source.io_)),
+            dispatch_expiry_(std::chrono::steady_clock::time_point::max()), has_last_departure_(_source.has_last_departure_),
+            queue_(_source.queue_), queue_size_(_source.queue_size_), is_sending_(_source.is_sending_), sending_count_(_source.sending_count_),
+            sent_timer_(_source.io_), io_(_source.io_) { }
 
         std::shared_ptr<train> train_;
         std::map<std::chrono::steady_clock::time_point, std::deque<std::shared_ptr<train>>> dispatched_trains_;
-        std::shared_ptr<boost::asio::steady_timer> dispatch_timer_;
+        std::shared_ptr<wheel_timer> dispatch_timer_;
+        // Expiry of the pending dispatch wait, max() if there is none
+        std::chrono::steady_clock::time_point dispatch_expiry_;
         std::chrono::steady_clock::time_point last_departure_;
         bool has_last_departure_;
 
@@ -53,6 +60,7 @@ public:
         std::size_t queue_size_;
 
         bool is_sending_;
+        std::size_t sending_count_; // queue entries of the write in progress
         boost::asio::steady_timer sent_timer_;
 
         boost::asio::io_context& io_;
@@ -96,9 +104,9 @@ public:
 
 protected:
     virtual bool send_intern(endpoint_type _target, const byte_t* _data, uint32_t _port);
+    bool send_batch_intern(endpoint_type _target, const endpoint::batch_t& _messages);
     virtual bool send_queued(const target_data_iterator_type _it) = 0;
-    virtual void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
-                                                    std::chrono::nanoseconds* _maximum_retention) const = 0;
+    void set_npdu_timings(npdu_timing_table _timings);
 
     virtual bool get_default_target(service_t _service, endpoint_type& _target) const = 0;
 
@@ -125,7 +133,13 @@ protected:
 
     std::map<service_t, endpoint::prepare_stop_handler_t> prepare_stop_handlers_;
 
-    mutable std::mutex mutex_;
+    mutable named_mutex mutex_;
+
+    // Debounce and retention times of the messages that are sent, guarded by
+    // "mutex_"
+    npdu_timing_table npdu_timings_;
+
+    std::shared_ptr<train_buffer_pool> train_buffers_;
 
 private:
     virtual std::string get_remote_information(const target_data_iterator_type _queue_iterator) const = 0;
@@ -133,8 +147,11 @@ private:
     virtual bool tp_segmentation_enabled(service_t _service, instance_t _instance, method_t _method) const;
 
     void schedule_train(endpoint_data_type& _target);
+    bool board_train(endpoint_type _target, const byte_t* _data, uint32_t _size, bool _restart_timer);
     void update_last_departure(endpoint_data_type& _data);
 
+    // Next train to depart, must be called with "mutex_" locked
+    std::shared_ptr<train> get_next_train(const endpoint_data_type& _data) const;
     void start_dispatch_timer(target_data_iterator_type _it, const std::chrono::steady_clock::time_point& _now);
     void cancel_dispatch_timer(target_data_iterator_type _it);
 
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_SOCKET_RECEIVER_HPP_
+#define VSOMEIP_V3_SOCKET_RECEIVER_HPP_
+
+#include <cstdint>
+#include <functional>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/ip/udp.hpp>
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+#include <boost/asio/local/stream_protocol.hpp>
+#endif
+
+namespace vsomeip_v3 {
+
+/**
+ * Reads the datagrams of a UDP socket instead of boost::asio. The endpoint
+ * still opens, binds and configures the socket and sends through it.
+ * The handlers run on the io threads of the socket, within a
+ * receive_timestamp::socket_scope for the kernel receive time if timestamping
+ * is enabled for the socket.
+ **/
+class udp_receiver {
+public:
+    using receive_handler_t = std::function<void(const boost::system::error_code& _error, std::size_t _bytes,
+                                                 const boost::asio::ip::udp::endpoint& _sender, const boost::asio::ip::address& _destination)>;
+
+    virtual ~udp_receiver() = default;
+
+    // Receives the next datagram of "_socket" into "_buffer". "_destination" is only
+    // known if IP_PKTINFO / IPV6_RECVPKTINFO is enabled for the socket.
+    virtual void async_receive(boost::asio::ip::udp::socket& _socket, boost::asio::mutable_buffer _buffer, receive_handler_t _handler) = 0;
+    // Aborts the pending receive. Must be called before the socket is closed,
+    // as the kernel may still hold the socket for the receiver otherwise.
+    virtual void cancel() = 0;
+};
+
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+/**
+ * Reads a local stream socket together with the credentials of the sender
+ * (SCM_CREDENTIALS) instead of boost::asio.
+ **/
+class uds_receiver {
+public:
+    using receive_handler_t =
+            std::function<void(const boost::system::error_code& _error, std::size_t _bytes, const std::uint32_t& _uid, const std::uint32_t& _gid)>;
+
+    virtual ~uds_receiver() = default;
+
+    // Reads at most the size of "_buffer". Completes with boost::asio::error::eof
+    // if the peer closed the connection.
+    virtual void async_receive(boost::asio::local::stream_protocol::socket& _socket, boost::asio::mutable_buffer _buffer,
+                               receive_handler_t _handler) = 0;
+    // Same as udp_receiver::cancel
+    virtual void cancel() = 0;
+};
+#endif
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_SOCKET_RECEIVER_HPP_
@@ -0,0 +1,107 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_SOCKET_TIMESTAMPING_HPP_
+#define VSOMEIP_V3_SOCKET_TIMESTAMPING_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include "../../utility/include/receive_timestamp.hpp"
+
+struct msghdr;
+
+namespace vsomeip_v3 {
+namespace socket_timestamping {
+
+// Enables the software receive timestamps of the kernel (SO_TIMESTAMPING) for
+// a socket that is read with recvmsg.
+bool enable(int _fd);
+
+// Kernel receive time from the SCM_TIMESTAMPING control message of a message
+// that was read with recvmsg. Returns the epoch if there is none.
+receive_timestamp::socket_time_t get(msghdr& _header);
+
+// Reads at most the size of "_buffer" from the (non-blocking) stream socket.
+// Returns boost::asio::error::would_block if there is nothing to read.
+boost::system::error_code receive(int _fd, boost::asio::mutable_buffer _buffer, std::size_t& _bytes,
+                                  receive_timestamp::socket_time_t& _time);
+
+// Reads a datagram from the (non-blocking) socket. Returns
+// boost::asio::error::would_block if there is nothing to read.
+boost::system::error_code receive_from(int _fd, boost::asio::mutable_buffer _buffer, boost::asio::ip::udp::endpoint& _sender,
+                                       std::size_t& _bytes, receive_timestamp::socket_time_t& _time);
+
+using receive_handler_t = std::function<void(const boost::system::error_code&, std::size_t)>;
+
+// Same as async_receive of a boost::asio stream socket, but the data is read
+// with recvmsg and the handler runs within a receive_timestamp::socket_scope
+// for the kernel receive time. The socket must outlive the handler.
+template<typename Socket_>
+void async_receive(Socket_& _socket, boost::asio::mutable_buffer _buffer, receive_handler_t _handler) {
+    _socket.async_wait(Socket_::wait_read, [&_socket, _buffer, _handler](const boost::system::error_code& _error) {
+        if (_error) {
+            _handler(_error, 0);
+            return;
+        }
+        if (!_socket.is_open()) {
+            _handler(boost::asio::error::operation_aborted, 0);
+            return;
+        }
+
+        std::size_t its_bytes(0);
+        receive_timestamp::socket_time_t its_time;
+        const auto its_error = receive(_socket.native_handle(), _buffer, its_bytes, its_time);
+        if (its_error == boost::asio::error::would_block) {
+            async_receive(_socket, _buffer, _handler);
+            return;
+        }
+
+        const receive_timestamp::socket_scope its_scope(its_time);
+        _handler(its_error, its_bytes);
+    });
+}
+
+// Same as async_receive_from of a boost::asio datagram socket, but the data is
+// read with recvmsg and the handler runs within a receive_timestamp::socket_scope
+// for the kernel receive time. The pending receive does not keep the socket
+// alive; it is aborted if the socket was destroyed meanwhile.
+template<typename Socket_>
+void async_receive_from(const std::shared_ptr<Socket_>& _socket, boost::asio::mutable_buffer _buffer,
+                        boost::asio::ip::udp::endpoint& _sender, receive_handler_t _handler) {
+    _socket->async_wait(Socket_::wait_read,
+                        [its_weak_socket = std::weak_ptr<Socket_>(_socket), _buffer, &_sender, _handler](const boost::system::error_code& _error) {
+                            if (_error) {
+                                _handler(_error, 0);
+                                return;
+                            }
+                            const auto its_socket = its_weak_socket.lock();
+                            if (!its_socket || !its_socket->is_open()) {
+                                _handler(boost::asio::error::operation_aborted, 0);
+                                return;
+                            }
+
+                            std::size_t its_bytes(0);
+                            receive_timestamp::socket_time_t its_time;
+                            const auto its_error = receive_from(its_socket->native_handle(), _buffer, _sender, its_bytes, its_time);
+                            if (its_error == boost::asio::error::would_block) {
+                                async_receive_from(its_socket, _buffer, _sender, _handler);
+                                return;
+                            }
+
+                            const receive_timestamp::socket_scope its_scope(its_time);
+                            _handler(its_error, its_bytes);
+                        });
+}
+
+} // namespace socket_timestamping
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_SOCKET_TIMESTAMPING_HPP_
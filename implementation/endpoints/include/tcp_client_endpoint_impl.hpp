@@ -13,6 +13,7 @@
 
 #include <vsomeip/defines.hpp>
 #include "client_endpoint_impl.hpp"
+#include "tcp_receive_buffer.hpp"
 #if defined(__QNX__)
 #include "../../utility/include/qnx_helper.hpp"
 #endif
@@ -45,21 +46,17 @@ public:
 
 private:
     void send_queued(std::pair<message_buffer_ptr_t, uint32_t>& _entry);
-    void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
-                                            std::chrono::nanoseconds* _maximum_retention) const;
-    bool is_magic_cookie(const message_buffer_ptr_t& _recv_buffer, size_t _offset) const;
+    bool is_magic_cookie(const std::shared_ptr<tcp_receive_buffer>& _recv_buffer, size_t _offset) const;
     void send_magic_cookie(message_buffer_ptr_t& _buffer);
 
-    void receive_cbk(boost::system::error_code const& _error, std::size_t _bytes, const message_buffer_ptr_t& _recv_buffer,
-                     std::size_t _recv_buffer_size);
+    void receive_cbk(boost::system::error_code const& _error, std::size_t _bytes, const std::shared_ptr<tcp_receive_buffer>& _recv_buffer);
 
     void connect();
     void receive();
-    void receive(message_buffer_ptr_t _recv_buffer, std::size_t _recv_buffer_size, std::size_t _missing_capacity);
-    void calculate_shrink_count(const message_buffer_ptr_t& _recv_buffer, std::size_t _recv_buffer_size);
+    void receive(std::shared_ptr<tcp_receive_buffer> _recv_buffer, std::size_t _missing_capacity);
     std::string get_address_port_remote() const;
     std::string get_address_port_local() const;
-    void handle_recv_buffer_exception(const std::exception& _e, const message_buffer_ptr_t& _recv_buffer, std::size_t _recv_buffer_size);
+    void handle_recv_buffer_exception(const std::exception& _e, const std::shared_ptr<tcp_receive_buffer>& _recv_buffer);
     void set_local_port();
     std::size_t write_completion_condition(const boost::system::error_code& _error, std::size_t _bytes_transferred,
                                            std::size_t _bytes_to_send, service_t _service, method_t _method, client_t _client,
@@ -71,10 +68,9 @@ private:
 
     void wait_until_sent(const boost::system::error_code& _error);
 
-    const std::uint32_t recv_buffer_size_initial_;
-    message_buffer_ptr_t recv_buffer_;
-    std::uint32_t shrink_count_;
+    const std::uint32_t recv_ring_size_;
     const std::uint32_t buffer_shrink_threshold_;
+    std::shared_ptr<tcp_receive_buffer> recv_buffer_;
 
     const boost::asio::ip::address remote_address_;
     const std::uint16_t remote_port_;
@@ -88,6 +84,13 @@ private:
     std::chrono::steady_clock::time_point connect_timepoint_;
 
     boost::asio::steady_timer sent_timer_;
+
+    // Gather writes: limits, queue entries of the write in progress and statistics
+    const std::size_t gather_write_max_buffers_;
+    const std::size_t gather_write_max_bytes_;
+    std::size_t sending_count_;
+    std::uint64_t writes_;
+    std::uint64_t written_buffers_;
 };
 
 } // namespace vsomeip_v3
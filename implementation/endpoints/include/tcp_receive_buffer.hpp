@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_TCP_RECEIVE_BUFFER_HPP_
+#define VSOMEIP_V3_TCP_RECEIVE_BUFFER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/asio/buffer.hpp>
+
+#include "buffer.hpp"
+
+namespace vsomeip_v3 {
+
+// Receive buffer of the TCP endpoints.
+//
+// Data is received into a ring of fixed size and the messages are framed in
+// place: the parser reads them from "data()" and drops them with "consume".
+// The read and write positions only move forward and return to the start of
+// the ring as soon as everything was consumed, so usually no byte is ever
+// moved. Only if the (partial) message at the read position no longer fits
+// behind it, its bytes are moved to the start of the ring.
+//
+// A message that is larger than the ring is received into a dedicated
+// buffer of exactly its size. It is framed there like in the ring, and the
+// buffer is kept for the next large message until "_shrink_threshold"
+// receives went to the ring again (0 keeps it forever).
+class tcp_receive_buffer {
+public:
+    tcp_receive_buffer(std::size_t _capacity, std::uint32_t _shrink_threshold);
+
+    // Unparsed bytes, the first one starts a message.
+    const byte_t* data() const { return storage_->data() + head_; }
+    std::size_t size() const { return tail_ - head_; }
+
+    // Space the next receive may fill. "_missing" is the number of bytes
+    // that are known to be missing to complete the message at "data()",
+    // the space returned is at least that large.
+    // Throws std::bad_alloc if a dedicated buffer cannot be allocated.
+    boost::asio::mutable_buffer prepare(std::size_t _missing);
+
+    // Adds "_bytes" received into the space returned by "prepare". Returns
+    // false if they exceed that space.
+    bool commit(std::size_t _bytes);
+
+    // Drops "_bytes" parsed bytes.
+    void consume(std::size_t _bytes);
+
+    // Drops all unparsed bytes and releases the dedicated buffer.
+    void clear();
+
+    std::size_t capacity() const;
+    bool is_dedicated() const { return storage_ == &dedicated_; }
+
+private:
+    void relocate(message_buffer_t& _target);
+
+    message_buffer_t ring_;
+    message_buffer_t dedicated_;
+    message_buffer_t* storage_;
+
+    std::size_t head_;
+    std::size_t tail_;
+    std::size_t limit_;
+
+    const std::uint32_t shrink_threshold_;
+    std::uint32_t shrink_count_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_TCP_RECEIVE_BUFFER_HPP_
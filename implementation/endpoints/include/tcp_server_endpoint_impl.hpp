@@ -14,6 +14,7 @@
 #include <vsomeip/defines.hpp>
 #include <vsomeip/export.hpp>
 #include "server_endpoint_impl.hpp"
+#include "tcp_receive_buffer.hpp"
 
 #include <chrono>
 
@@ -37,11 +38,9 @@ public:
     void stop();
 
     bool send_to(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size);
+    bool send_batch_to(const std::shared_ptr<endpoint_definition> _target, const batch_t& _messages);
     bool send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size);
     bool send_queued(const target_data_iterator_type _it);
-    void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
-                                            std::chrono::nanoseconds* _maximum_retention) const;
-
     VSOMEIP_EXPORT bool is_established_to(const std::shared_ptr<endpoint_definition>& _endpoint);
 
     bool get_default_target(service_t, endpoint_type&) const;
@@ -70,8 +69,8 @@ private:
         typedef std::shared_ptr<connection> ptr;
 
         static ptr create(const std::weak_ptr<tcp_server_endpoint_impl>& _server, std::uint32_t _max_message_size,
-                          std::uint32_t _buffer_shrink_threshold, bool _magic_cookies_enabled, boost::asio::io_context& _io,
-                          std::chrono::milliseconds _send_timeout);
+                          std::uint32_t _recv_ring_size, std::uint32_t _buffer_shrink_threshold, bool _magic_cookies_enabled,
+                          boost::asio::io_context& _io, std::chrono::milliseconds _send_timeout);
 
         ~connection();
 
@@ -85,17 +84,19 @@ private:
         void send_queued(const target_data_iterator_type _it);
 
         void set_remote_info(const endpoint_type& _remote);
+        // must be called with the socket lock held
+        void enable_receive_timestamps();
         std::string get_address_port_remote() const;
         std::size_t get_recv_buffer_capacity() const;
+        double get_writes_per_message() const;
 
     private:
         connection(const std::weak_ptr<tcp_server_endpoint_impl>& _server, std::uint32_t _max_message_size,
-                   std::uint32_t _recv_buffer_size_initial, std::uint32_t _buffer_shrink_threshold, bool _magic_cookies_enabled,
+                   std::uint32_t _recv_ring_size, std::uint32_t _buffer_shrink_threshold, bool _magic_cookies_enabled,
                    boost::asio::io_context& _io, std::chrono::milliseconds _send_timeout);
         bool send_magic_cookie(message_buffer_ptr_t& _buffer);
         bool is_magic_cookie(size_t _offset) const;
         void receive_cbk(boost::system::error_code const& _error, std::size_t _bytes);
-        void calculate_shrink_count();
         std::string get_address_port_local() const;
         void handle_recv_buffer_exception(const std::exception& _e);
         std::size_t write_completion_condition(const boost::system::error_code& _error, std::size_t _bytes_transferred,
@@ -109,31 +110,38 @@ private:
         std::weak_ptr<tcp_server_endpoint_impl> server_;
 
         const uint32_t max_message_size_;
-        const uint32_t recv_buffer_size_initial_;
 
-        message_buffer_t recv_buffer_;
-        size_t recv_buffer_size_;
+        tcp_receive_buffer recv_buffer_;
         std::uint32_t missing_capacity_;
-        std::uint32_t shrink_count_;
-        const std::uint32_t buffer_shrink_threshold_;
 
         endpoint_type remote_;
         boost::asio::ip::address remote_address_;
         std::uint16_t remote_port_;
         std::atomic<bool> magic_cookies_enabled_;
+        // guarded by the socket mutex
+        bool is_timestamping_;
         std::chrono::steady_clock::time_point last_cookie_sent_;
         const std::chrono::milliseconds send_timeout_;
         const std::chrono::milliseconds send_timeout_warning_;
+
+        // guarded by the server mutex
+        std::uint64_t writes_;
+        std::uint64_t written_buffers_;
     };
 
     std::mutex acceptor_mutex_;
     boost::asio::ip::tcp::acceptor acceptor_;
+    // guarded by the acceptor mutex, distributes the connections over the io shards
+    std::size_t accepted_;
     std::mutex connections_mutex_;
     typedef std::map<endpoint_type, connection::ptr> connections_t;
     connections_t connections_;
     const std::uint32_t buffer_shrink_threshold_;
+    const std::uint32_t recv_ring_size_;
     std::uint16_t local_port_;
     const std::chrono::milliseconds send_timeout_;
+    const std::size_t gather_write_max_buffers_;
+    const std::size_t gather_write_max_bytes_;
 
 private:
     void remove_connection(connection* _connection);
@@ -9,6 +9,7 @@
 #include <boost/asio/ip/tcp.hpp>
 
 #include <functional>
+#include <vector>
 
 namespace vsomeip_v3 {
 
@@ -65,6 +66,7 @@ public:
     // usually the ConstBufferSequence is a template parameter
     virtual void async_write(std::vector<boost::asio::const_buffer> const&, rw_handler) = 0;
     virtual void async_write(boost::asio::const_buffer const& b, completion_condition cc, rw_handler handler) = 0;
+    virtual void async_write(std::vector<boost::asio::const_buffer> const& bs, completion_condition cc, rw_handler handler) = 0;
 #if defined(__linux__) || defined(ANDROID)
     /**
      * abstraction for setting the linux specific tcp option
@@ -72,6 +74,14 @@ public:
      * On error errno will be set.
      **/
     [[nodiscard]] virtual bool set_user_timeout(unsigned int) = 0;
+    /**
+     * abstraction for enabling the linux specific software receive
+     * timestamps (SO_TIMESTAMPING) of the socket. The handlers of
+     * async_receive can then read the kernel receive time from
+     * receive_timestamp.
+     * On error errno will be set.
+     **/
+    [[nodiscard]] virtual bool enable_receive_timestamps() = 0;
 #endif
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
     /**
@@ -14,6 +14,7 @@
 #include <vsomeip/defines.hpp>
 
 #include "client_endpoint_impl.hpp"
+#include "socket_receiver.hpp"
 #include "tp_reassembler.hpp"
 
 namespace vsomeip_v3 {
@@ -49,10 +50,9 @@ public:
 
 private:
     void send_queued(std::pair<message_buffer_ptr_t, uint32_t>& _entry);
-    void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
-                                            std::chrono::nanoseconds* _maximum_retention) const;
     void connect();
     void receive();
+    void cancel_receive_unlocked();
     void set_local_port();
     std::string get_address_port_remote() const;
     std::string get_address_port_local() const;
@@ -66,6 +66,8 @@ private:
     const std::uint16_t remote_port_;
     const int udp_receive_buffer_size_;
     std::shared_ptr<tp::tp_reassembler> tp_reassembler_;
+    // Reads the socket instead of boost::asio if the socket factory provides it
+    std::unique_ptr<udp_receiver> receiver_;
 
     std::mutex last_sent_mutex_;
     std::chrono::steady_clock::time_point last_sent_;
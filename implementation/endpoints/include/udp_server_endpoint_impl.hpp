@@ -10,6 +10,7 @@
 #include <vsomeip/defines.hpp>
 
 #include "server_endpoint_impl.hpp"
+#include "socket_receiver.hpp"
 #include "tp_reassembler.hpp"
 
 namespace vsomeip_v3 {
@@ -42,10 +43,9 @@ public:
     bool is_closed() const override;
 
     bool send_to(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) override;
+    bool send_batch_to(const std::shared_ptr<endpoint_definition> _target, const batch_t& _messages) override;
     bool send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) override;
     bool send_queued(const target_data_iterator_type _it) override;
-    void get_configured_times_from_endpoint(service_t _service, method_t _method, std::chrono::nanoseconds* _debouncing,
-                                            std::chrono::nanoseconds* _maximum_retention) const override;
 
     VSOMEIP_EXPORT void join(const std::string& _address);
     VSOMEIP_EXPORT void join_unlocked(const std::string& _address);
@@ -88,6 +88,20 @@ private:
     void set_broadcast();
     void receive_unicast_unlocked();
     void receive_multicast_unlocked();
+
+    // Additional socket bound with SO_REUSEPORT to the unicast port
+    struct receive_socket_t {
+        explicit receive_socket_t(boost::asio::io_context& _io);
+
+        socket_type socket_;
+        endpoint_type remote_;
+        message_buffer_t buffer_;
+        std::unique_ptr<udp_receiver> receiver_;
+    };
+    bool set_reuse_port(socket_type& _socket, boost::system::error_code& _error) const;
+    void open_receive_sockets_unlocked(const endpoint_type& _local, std::uint32_t _count);
+    void receive_socket_unlocked(const std::shared_ptr<receive_socket_t>& _socket);
+    void close_receive_sockets_unlocked();
     bool is_joined_unlocked(const std::string& _address) const;
     bool is_joined_unlocked(const std::string& _address, bool& _received) const;
     std::string get_remote_information(const target_data_iterator_type _it) const override;
@@ -114,10 +128,15 @@ private:
     std::shared_ptr<socket_type> unicast_socket_;
     endpoint_type unicast_remote_;
     message_buffer_t unicast_recv_buffer_;
+    // Read the sockets instead of boost::asio if the socket factory provides them
+    std::unique_ptr<udp_receiver> unicast_receiver_;
+
+    std::vector<std::shared_ptr<receive_socket_t>> receive_sockets_;
 
     std::shared_ptr<socket_type> multicast_socket_;
     std::unique_ptr<endpoint_type> multicast_local_;
     message_buffer_t multicast_recv_buffer_;
+    std::unique_ptr<udp_receiver> multicast_receiver_;
     std::atomic<unsigned> lifecycle_idx_;
     std::map<std::string, bool, std::less<>> joined_;
     std::map<std::string, bool, std::less<>> join_status_;
@@ -137,6 +156,8 @@ private:
     // Atomic so the logger can print this variable without a lock
     std::atomic<bool> is_stopped_{true};
     bool is_v4_{true};
+    // read the kernel receive time of each datagram (SIOCGSTAMPNS)
+    bool is_timestamping_{false};
 
     // to tracking sent messages
     on_unicast_sent_cbk_t on_unicast_sent_{nullptr};
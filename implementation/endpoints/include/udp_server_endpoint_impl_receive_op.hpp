@@ -17,6 +17,8 @@
 
 #include <vsomeip/internal/logger.hpp>
 
+#include "socket_timestamping.hpp"
+
 #if defined(__QNX__)
 #include <netinet/in.h>
 #include <sys/socket.h>
@@ -47,6 +49,7 @@ struct storage : public std::enable_shared_from_this<storage> {
 
     static bool receive_cb(const std::shared_ptr<storage>& _data, boost::system::error_code _error_code) {
         endpoint_type_t sender;
+        receive_timestamp::socket_time_t its_time;
 
         if (!_error_code) {
 
@@ -197,10 +200,13 @@ struct storage : public std::enable_shared_from_this<storage> {
                 its_header.msg_iov = its_vec;
                 its_header.msg_iovlen = 1;
 
-                // Sender & destination address info
+                // Sender & destination address info, followed by the receive
+                // time if timestamping is enabled for the socket
                 struct sockaddr_in addr_v4 = {};
                 struct sockaddr_in6 addr_v6 = {};
-                uint8_t control_data[CMSG_SPACE(std::max(sizeof(struct in_pktinfo), sizeof(struct in6_pktinfo)))];
+                constexpr size_t its_time_size = CMSG_SPACE(3 * sizeof(struct timespec));
+                alignas(struct cmsghdr) uint8_t
+                        control_data[CMSG_SPACE(std::max(sizeof(struct in_pktinfo), sizeof(struct in6_pktinfo))) + its_time_size];
 
                 // Prepare
                 if (_data->is_v4_) {
@@ -208,13 +214,13 @@ struct storage : public std::enable_shared_from_this<storage> {
                     its_header.msg_namelen = sizeof(addr_v4);
 
                     its_header.msg_control = control_data;
-                    its_header.msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo));
+                    its_header.msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo)) + its_time_size;
                 } else {
                     its_header.msg_name = &addr_v6;
                     its_header.msg_namelen = sizeof(addr_v6);
 
                     its_header.msg_control = control_data;
-                    its_header.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
+                    its_header.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo)) + its_time_size;
                 }
 
                 // Call recvmsg and handle its result
@@ -240,6 +246,7 @@ struct storage : public std::enable_shared_from_this<storage> {
                 if (_data->bytes_ == 0) {
                     _error_code = boost::asio::error::eof;
                 }
+                its_time = socket_timestamping::get(its_header);
 
                 // Extract sender & destination addresses
                 if (_data->is_v4_) {
@@ -295,6 +302,7 @@ struct storage : public std::enable_shared_from_this<storage> {
         }
 
         // Call the handler
+        const receive_timestamp::socket_scope its_scope(its_time);
         _data->handler_(_error_code, _data->bytes_, sender, _data->destination_);
         return false;
     }
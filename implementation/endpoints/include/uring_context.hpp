@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_URING_CONTEXT_HPP_
+#define VSOMEIP_V3_URING_CONTEXT_HPP_
+
+#include "uring_service.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace vsomeip_v3 {
+
+/**
+ * Operations of a socket on the io_uring of its io_context. They can outlive
+ * the socket, the kernel releases the buffers of cancelled operations
+ * asynchronously.
+ * Closing the socket starts a new generation. Operations of an older
+ * generation are no longer started or retried, as their descriptor may have
+ * been reused.
+ **/
+class uring_context : public std::enable_shared_from_this<uring_context> {
+public:
+    uring_context(uring_service& _service, const boost::asio::any_io_executor& _executor);
+    virtual ~uring_context() = default;
+
+    unsigned get_generation();
+    // Cancels the started operations, "_is_closing" starts a new generation
+    void cancel(bool _is_closing);
+
+protected:
+    // Error of a negative operation result (-errno). -ECANCELED is operation_aborted.
+    static boost::system::error_code to_error(int _result);
+
+    boost::system::error_code start(unsigned _generation, const std::function<void(io_uring_sqe&)>& _prepare,
+                                    std::function<void(int)> _handler);
+    boost::system::error_code start_multishot(unsigned _generation, const std::function<void(io_uring_sqe&)>& _prepare,
+                                              uring_service::multishot_handler_t _handler);
+
+    // Calls "_retry" once "_fd" is ready for "_events" (POLLIN, POLLOUT), or "_fail"
+    void wait(unsigned _generation, int _fd, unsigned _events, const std::function<void()>& _retry,
+              const std::function<void(const boost::system::error_code&)>& _fail);
+
+    // Never call a handler from the initiating function
+    void post(std::function<void()> _handler);
+
+    uring_service& service_;
+    boost::asio::any_io_executor executor_;
+
+    std::mutex mutex_;
+    unsigned generation_;
+    std::set<uring_service::op_id_t> ops_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_HAS_IO_URING
+
+#endif // VSOMEIP_V3_URING_CONTEXT_HPP_
@@ -0,0 +1,144 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_URING_SERVICE_HPP_
+#define VSOMEIP_V3_URING_SERVICE_HPP_
+
+#if defined(__linux__) && !defined(ANDROID) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+// Receiving relies on the internal poll of sockets (Linux 5.7), the UDP
+// receivers on multishot receives and provided buffer rings (Linux 6.0).
+// Older kernels are detected at runtime.
+#if defined(IORING_FEAT_FAST_POLL) && defined(IORING_RECV_MULTISHOT)
+#define VSOMEIP_HAS_IO_URING 1
+#endif
+#endif
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+
+namespace vsomeip_v3 {
+
+// io_uring instance of an io_context.
+//
+// Operations are written to the submission queue when they are started,
+// but submitted with a single io_uring_enter once the current round of
+// handlers of the io_context is done. The ring signals completions through
+// an eventfd that is waited for by the io_context, so the completion
+// handlers run on the io threads like any other asio handler.
+//
+// Receives may select their buffer from a ring of provided buffers that is
+// shared by all operations of the io_context, see init_buffers.
+class uring_service : public boost::asio::io_context::service {
+public:
+    static boost::asio::io_context::id id;
+
+    using op_id_t = std::uint64_t;
+    // Receives the result of the operation: transferred bytes or -errno
+    using completion_handler_t = std::function<void(int _result)>;
+    // Receives the result and the flags (IORING_CQE_F_*) of each completion
+    using multishot_handler_t = std::function<void(int _result, std::uint32_t _flags)>;
+
+    // Buffer group of the provided buffers
+    static constexpr std::uint16_t buffer_group = 0;
+
+    explicit uring_service(boost::asio::io_context& _io);
+    ~uring_service() override;
+
+    // Sets up the ring on first call. Returns false if io_uring cannot be used.
+    bool init(std::uint32_t _queue_depth);
+    bool is_available() const;
+
+    // Queues the operation prepared by "_prepare". Returns 0 if the ring is not available.
+    op_id_t start(const std::function<void(io_uring_sqe&)>& _prepare, completion_handler_t _handler);
+    // Same as start, but the handler is called for every completion of the
+    // operation. The last one is the one without IORING_CQE_F_MORE.
+    op_id_t start_multishot(const std::function<void(io_uring_sqe&)>& _prepare, multishot_handler_t _handler);
+    // The operation completes with -ECANCELED unless it already completed.
+    void cancel(op_id_t _op);
+
+    // Registers "_count" (a power of two) buffers of "_size" bytes on first call.
+    // Returns false if the kernel does not support provided buffer rings.
+    bool init_buffers(std::uint16_t _count, std::size_t _size);
+    std::size_t get_buffer_size() const;
+    // Buffer that was selected by a completion with IORING_CQE_F_BUFFER
+    const unsigned char* get_buffer(std::uint16_t _id) const;
+    // Gives the buffer back to the kernel
+    void release_buffer(std::uint16_t _id);
+
+private:
+    struct op_t {
+        std::shared_ptr<multishot_handler_t> handler_;
+        bool is_multishot_;
+    };
+
+    void shutdown() override;
+
+    op_id_t start_unlocked(const std::function<void(io_uring_sqe&)>& _prepare, std::shared_ptr<multishot_handler_t> _handler,
+                           bool _is_multishot);
+
+    io_uring_sqe* get_sqe_unlocked();
+    void cancel_unlocked(op_id_t _op);
+    void submit_unlocked();
+    void schedule_submit_unlocked();
+    void wait();
+    void reap();
+    void add_buffer_unlocked(std::uint16_t _id);
+    void close_unlocked();
+
+    boost::asio::io_context& io_;
+
+    mutable std::mutex mutex_;
+    int ring_fd_;
+    bool is_initialized_;
+    bool is_submit_scheduled_;
+    op_id_t next_op_;
+    std::unordered_map<op_id_t, op_t> ops_;
+
+    void* sq_ring_;
+    std::size_t sq_ring_size_;
+    void* cq_ring_;
+    std::size_t cq_ring_size_;
+    io_uring_sqe* sqes_;
+    std::size_t sqes_size_;
+
+    unsigned* sq_head_;
+    unsigned* sq_tail_;
+    unsigned sq_mask_;
+    unsigned sq_entries_;
+    unsigned* sq_array_;
+    unsigned* cq_head_;
+    unsigned* cq_tail_;
+    unsigned cq_mask_;
+    io_uring_cqe* cqes_;
+    unsigned pending_;
+
+    int event_fd_;
+    std::unique_ptr<boost::asio::posix::stream_descriptor> event_;
+    std::uint64_t event_count_;
+
+    bool is_buffers_initialized_;
+    io_uring_buf_ring* buffer_ring_;
+    std::size_t buffer_ring_size_;
+    std::uint16_t buffer_count_;
+    std::uint16_t buffer_tail_;
+    std::size_t buffer_size_;
+    std::vector<unsigned char> buffers_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_HAS_IO_URING
+
+#endif // VSOMEIP_V3_URING_SERVICE_HPP_
@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_URING_SOCKET_FACTORY_HPP_
+#define VSOMEIP_V3_URING_SOCKET_FACTORY_HPP_
+
+#include "abstract_socket_factory.hpp"
+#include "uring_service.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+namespace vsomeip_v3 {
+
+/**
+ * Socket factory that creates TCP sockets which receive and send through
+ * io_uring, and receivers that read the UDP sockets and the local server
+ * connections through io_uring. Falls back to boost::asio on io_contexts
+ * whose ring could not be set up.
+ **/
+class uring_socket_factory final : public abstract_socket_factory {
+public:
+    explicit uring_socket_factory(std::uint32_t _queue_depth);
+    ~uring_socket_factory() override = default;
+
+    std::shared_ptr<abstract_netlink_connector> create_netlink_connector(boost::asio::io_context& _io,
+                                                                         const boost::asio::ip::address& _address,
+                                                                         const boost::asio::ip::address& _multicast_address,
+                                                                         bool _is_requiring_link) override;
+
+    std::unique_ptr<tcp_socket> create_tcp_socket(boost::asio::io_context& _io) override;
+    std::unique_ptr<tcp_acceptor> create_tcp_acceptor(boost::asio::io_context& _io) override;
+
+    std::unique_ptr<udp_receiver> create_udp_receiver(boost::asio::io_context& _io) override;
+    std::unique_ptr<uds_receiver> create_uds_receiver(boost::asio::io_context& _io) override;
+
+private:
+    const std::uint32_t queue_depth_;
+};
+
+}
+
+#endif // VSOMEIP_HAS_IO_URING
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_URING_SOCKET_RECEIVER_HPP_
+#define VSOMEIP_V3_URING_SOCKET_RECEIVER_HPP_
+
+#include "socket_receiver.hpp"
+#include "uring_service.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <memory>
+
+namespace vsomeip_v3 {
+
+/**
+ * udp_receiver on the io_uring of an io_context. A single multishot recvmsg
+ * per socket reads the datagrams into the provided buffers of the ring, they
+ * are copied into the buffers of the endpoint when it asks for them. Without
+ * provided buffers (or while they are used up), each datagram is read with
+ * its own recvmsg directly into the buffer of the endpoint.
+ **/
+class uring_udp_receiver final : public udp_receiver {
+public:
+    // Size of a provided buffer: the datagram and its address and control messages
+    static std::size_t get_buffer_size();
+
+    uring_udp_receiver(boost::asio::io_context& _io, uring_service& _service, bool _is_multishot);
+    ~uring_udp_receiver() override;
+
+    void async_receive(boost::asio::ip::udp::socket& _socket, boost::asio::mutable_buffer _buffer, receive_handler_t _handler) override;
+    void cancel() override;
+
+private:
+    class context;
+    std::shared_ptr<context> context_;
+};
+
+/**
+ * uds_receiver on the io_uring of an io_context. The data is read with
+ * recvmsg directly into the buffer of the endpoint.
+ **/
+class uring_uds_receiver final : public uds_receiver {
+public:
+    uring_uds_receiver(boost::asio::io_context& _io, uring_service& _service);
+    ~uring_uds_receiver() override;
+
+    void async_receive(boost::asio::local::stream_protocol::socket& _socket, boost::asio::mutable_buffer _buffer,
+                       receive_handler_t _handler) override;
+    void cancel() override;
+
+private:
+    class context;
+    std::shared_ptr<context> context_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_HAS_IO_URING
+
+#endif // VSOMEIP_V3_URING_SOCKET_RECEIVER_HPP_
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_URING_TCP_SOCKET_HPP_
+#define VSOMEIP_V3_URING_TCP_SOCKET_HPP_
+
+#include "asio_tcp_socket.hpp"
+#include "uring_service.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <memory>
+
+namespace vsomeip_v3 {
+
+/**
+ * tcp_socket that receives and sends through the io_uring of its io_context.
+ * Opening, connecting, accepting and the socket options are still done by
+ * boost::asio.
+ **/
+class uring_tcp_socket final : public asio_tcp_socket {
+public:
+    uring_tcp_socket(boost::asio::io_context& _io, uring_service& _service);
+    ~uring_tcp_socket() override;
+
+private:
+    class context;
+    struct write_op;
+
+    // The receives do not read control messages
+    [[nodiscard]] bool enable_receive_timestamps() override { return false; }
+
+    void close(boost::system::error_code& ec) override;
+    void cancel(boost::system::error_code& ec) override;
+
+    void async_receive(boost::asio::mutable_buffer b, rw_handler handler) override;
+    void async_write(std::vector<boost::asio::const_buffer> const& bs, rw_handler handler) override;
+    void async_write(boost::asio::const_buffer const& b, completion_condition cc, rw_handler handler) override;
+    void async_write(std::vector<boost::asio::const_buffer> const& bs, completion_condition cc, rw_handler handler) override;
+
+    std::shared_ptr<context> context_;
+};
+
+}
+
+#endif // VSOMEIP_HAS_IO_URING
+
+#endif
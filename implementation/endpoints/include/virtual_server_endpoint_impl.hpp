@@ -51,6 +51,7 @@ public:
     void print_status();
 
     size_t get_queue_size() const;
+    bool get_metrics(endpoint_metrics_t& _metrics) const;
 
 private:
     std::string address_;
@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -33,10 +34,16 @@ client_endpoint_impl<Protocol>::client_endpoint_impl(const std::shared_ptr<endpo
                                                      const std::shared_ptr<configuration>& _configuration) :
     endpoint_impl<Protocol>(_endpoint_host, _routing_host, _io, _configuration), remote_{_remote}, flush_timer_{_io}, connect_timer_{_io},
     connect_timeout_{VSOMEIP_DEFAULT_CONNECT_TIMEOUT}, state_{cei_state_e::CLOSED}, reconnect_counter_{0}, connecting_timer_{_io},
-    connecting_timeout_{VSOMEIP_DEFAULT_CONNECTING_TIMEOUT}, train_{std::make_shared<train>()}, dispatch_timer_{_io},
-    has_last_departure_{false}, queue_size_{0}, was_not_connected_{false}, is_sending_{false}, strand_(_io) {
+    connecting_timeout_{VSOMEIP_DEFAULT_CONNECTING_TIMEOUT}, train_buffers_{std::make_shared<train_buffer_pool>()},
+    train_{std::make_shared<train>(train_buffers_->get(0))}, dispatch_timer_{_io},
+    dispatch_expiry_{std::chrono::steady_clock::time_point::max()}, has_last_departure_{false}, queue_size_{0}, mutex_{"client_endpoint_impl::mutex_"}, was_not_connected_{false}, is_sending_{false}, strand_(_io) {
     this->local_ = _local;
     recreate_socket();
+
+    // The timings only depend on the remote endpoint, which never changes
+    if constexpr (std::is_same_v<Protocol, boost::asio::ip::tcp> || std::is_same_v<Protocol, boost::asio::ip::udp>) {
+        npdu_timings_ = _configuration->get_npdu_timings_requests(_remote.address().to_string(), _remote.port());
+    }
 }
 
 template<typename Protocol>
@@ -123,11 +130,10 @@ void client_endpoint_impl<Protocol>::prepare_stop(const endpoint::prepare_stop_h
 template<typename Protocol>
 void client_endpoint_impl<Protocol>::stop() {
     {
-        std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         endpoint_impl<Protocol>::sending_blocked_ = true;
         // delete unsent messages
-        queue_.clear();
-        queue_size_ = 0;
+        drop_queue();
     }
     {
         std::lock_guard<std::mutex> its_lock(connect_timer_mutex_);
@@ -139,6 +145,15 @@ void client_endpoint_impl<Protocol>::stop() {
     boost::asio::dispatch(strand_, std::bind(&client_endpoint_impl::shutdown_and_close_socket, this->shared_from_this(), false));
 }
 
+template<typename Protocol>
+void client_endpoint_impl<Protocol>::drop_queue() {
+    for (const auto& e : queue_) {
+        endpoint_impl<Protocol>::count_dropped(*e.first);
+    }
+    queue_.clear();
+    queue_size_ = 0;
+}
+
 template<typename Protocol>
 std::pair<message_buffer_ptr_t, uint32_t> client_endpoint_impl<Protocol>::get_front() {
 
@@ -174,7 +189,7 @@ bool client_endpoint_impl<Protocol>::send_error(const std::shared_ptr<endpoint_d
 template<typename Protocol>
 bool client_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size) {
 
-    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     bool must_depart(false);
     auto its_now(std::chrono::steady_clock::now());
 
@@ -191,26 +206,22 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
     }
 
     if (!check_message_size(_size)) {
-        return segment_message(_data, _size) == endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
+        return (segment_message(_data, _size) == endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT);
     }
 
-    // STEP 1: Cancel dispatch timer
-    cancel_dispatch_timer();
-
     // STEP 3: Get configured timings
     const service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
     const service_t its_method = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
-    get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
+    npdu_timings_.get(its_service, its_method, its_debouncing, its_retention);
 
     // STEP 4: Check if the passenger enters an empty train
-    const std::pair<service_t, method_t> its_identifier = std::make_pair(its_service, its_method);
     if (train_->passengers_.empty()) {
         train_->departure_ = its_now + its_retention; // latest possible
     } else {
         // STEP 4.1: Check whether the current train already contains the message
-        if (train_->passengers_.end() != train_->passengers_.find(its_identifier)) {
+        if (train_->passengers_.contains(its_service, its_method)) {
             must_depart = true;
         } else {
             // STEP 5: Check whether the current message fits into the current train
@@ -250,13 +261,13 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t* _data, uint32_t _size)
         // departs. Schedule departure of current train and create a new one.
         schedule_train();
 
-        train_ = std::make_shared<train>();
+        train_ = std::make_shared<train>(train_buffers_->get(endpoint_impl<Protocol>::max_message_size_));
         train_->departure_ = its_now + its_retention;
     }
 
     // STEP 9: insert current message buffer
     train_->buffer_->insert(train_->buffer_->end(), _data, _data + _size);
-    train_->passengers_.insert(its_identifier);
+    train_->passengers_.insert(its_service, its_method);
     // STEP 9.1: update the trains minimal debounce time if necessary
     if (its_debouncing < train_->minimal_debounce_time_) {
         train_->minimal_debounce_time_ = its_debouncing;
@@ -291,7 +302,7 @@ void client_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
     const service_t its_method = bithelper::read_uint16_be(&(*(_segments[0]))[VSOMEIP_METHOD_POS_MIN]);
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
-    get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
+    npdu_timings_.get(its_service, its_method, its_debouncing, its_retention);
     // update the trains minimal debounce time if necessary
     if (its_debouncing < train_->minimal_debounce_time_) {
         train_->minimal_debounce_time_ = its_debouncing;
@@ -305,7 +316,7 @@ void client_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
     // messages as we will send several now anyway.
     if (!train_->passengers_.empty()) {
         schedule_train();
-        train_ = std::make_shared<train>();
+        train_ = std::make_shared<train>(train_buffers_->get(endpoint_impl<Protocol>::max_message_size_));
         train_->departure_ = its_now + its_retention;
     }
 
@@ -350,7 +361,8 @@ bool client_endpoint_impl<Protocol>::flush() {
     bool has_queued(true);
     bool is_current_train(true);
 
-    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
+    dispatch_expiry_ = std::chrono::steady_clock::time_point::max();
 
     std::shared_ptr<train> its_train(train_);
     if (!dispatched_trains_.empty()) {
@@ -374,7 +386,7 @@ bool client_endpoint_impl<Protocol>::flush() {
 
         // Reset current train if necessary
         if (is_current_train) {
-            its_train->reset();
+            its_train->reset(train_buffers_->get(endpoint_impl<Protocol>::max_message_size_));
         }
     } else {
         has_queued = false;
@@ -405,6 +417,7 @@ void client_endpoint_impl<Protocol>::connect_cbk(boost::system::error_code const
                             << " endpoint > " << this << " socket state > " << static_cast<int>(state_.load());
 
             shutdown_and_close_socket(true);
+            endpoint_impl<Protocol>::counters_.add(EC_RECONNECTS);
 
             if (state_ != cei_state_e::ESTABLISHED) {
                 state_ = cei_state_e::CLOSED;
@@ -517,8 +530,9 @@ void client_endpoint_impl<Protocol>::send_cbk(boost::system::error_code const& _
     (void)_bytes;
 
     if (!_error) {
-        std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         if (queue_.size() > 0) {
+            endpoint_impl<Protocol>::count_sent(*queue_.front().first);
             queue_size_ -= queue_.front().first->size();
             queue_.pop_front();
 
@@ -557,11 +571,10 @@ void client_endpoint_impl<Protocol>::send_cbk(boost::system::error_code const& _
         state_ = cei_state_e::CLOSED;
         bool stopping(false);
         {
-            std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+            std::scoped_lock its_lock(mutex_);
             stopping = endpoint_impl<Protocol>::sending_blocked_;
             if (stopping) {
-                queue_.clear();
-                queue_size_ = 0;
+                drop_queue();
             } else {
                 service_t its_service(0);
                 method_t its_method(0);
@@ -603,9 +616,8 @@ void client_endpoint_impl<Protocol>::send_cbk(boost::system::error_code const& _
         }
         state_ = cei_state_e::CLOSED;
         if (_error == boost::asio::error::no_permission) {
-            std::lock_guard<std::recursive_mutex> its_lock(mutex_);
-            queue_.clear();
-            queue_size_ = 0;
+            std::scoped_lock its_lock(mutex_);
+            drop_queue();
         }
         was_not_connected_ = true;
         shutdown_and_close_socket(true);
@@ -653,7 +665,7 @@ void client_endpoint_impl<Protocol>::send_cbk(boost::system::error_code const& _
         print_status();
     }
 
-    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     was_not_connected_ = true;
     is_sending_ = false;
 }
@@ -662,6 +674,18 @@ template<typename Protocol>
 void client_endpoint_impl<Protocol>::flush_cbk(boost::system::error_code const& _error) {
 
     if (!_error) {
+        {
+            // The wait is only moved to earlier departures, so it may expire
+            // before the next train is due. Wait again in this case.
+            std::scoped_lock its_lock(mutex_);
+            const auto its_now(std::chrono::steady_clock::now());
+            const auto its_train(get_next_train());
+            if (!its_train->buffer_->empty() && its_train->departure_ > its_now) {
+                dispatch_expiry_ = std::chrono::steady_clock::time_point::max();
+                start_dispatch_timer(its_now);
+                return;
+            }
+        }
         (void)flush();
     }
 }
@@ -676,6 +700,7 @@ void client_endpoint_impl<Protocol>::shutdown_and_close_socket(bool _recreate_so
 template<typename Protocol>
 void client_endpoint_impl<Protocol>::shutdown_and_close_socket_unlocked(bool _recreate_socket) {
 
+    cancel_receive_unlocked();
     if (socket_->is_open()) {
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
         if constexpr (std::is_same_v<Protocol, boost::asio::ip::tcp>) {
@@ -722,6 +747,9 @@ void client_endpoint_impl<Protocol>::shutdown_and_close_socket_unlocked(bool _re
     }
 }
 
+template<typename Protocol>
+void client_endpoint_impl<Protocol>::cancel_receive_unlocked() { }
+
 template<typename Protocol>
 bool client_endpoint_impl<Protocol>::get_remote_address(boost::asio::ip::address& _address) const {
 
@@ -735,6 +763,18 @@ std::uint16_t client_endpoint_impl<Protocol>::get_remote_port() const {
     return 0;
 }
 
+template<typename Protocol>
+bool client_endpoint_impl<Protocol>::get_metrics(endpoint_metrics_t& _metrics) const {
+
+    endpoint_impl<Protocol>::get_metrics(_metrics);
+    boost::asio::ip::address its_address;
+    if (!this->is_local() && get_remote_address(its_address)) {
+        _metrics.remote_address_ = its_address.to_string();
+        _metrics.remote_port_ = get_remote_port();
+    }
+    return true;
+}
+
 template<typename Protocol>
 std::uint16_t client_endpoint_impl<Protocol>::get_local_port() const {
 
@@ -821,6 +861,7 @@ bool client_endpoint_impl<Protocol>::check_queue_limit(const uint8_t* _data, std
                       << ") reached. Dropping message (" << std::hex << std::setfill('0') << std::setw(4) << its_client << "): ["
                       << std::setw(4) << its_service << "." << std::setw(4) << its_method << "." << std::setw(4) << its_session << "] "
                       << "queue_size: " << std::dec << queue_size_ << " data size: " << _size;
+        endpoint_impl<Protocol>::counters_.add(EC_QUEUE_LIMIT_DROPS);
         return false;
     }
     return true;
@@ -831,6 +872,7 @@ void client_endpoint_impl<Protocol>::queue_train(const std::shared_ptr<train>& _
 
     queue_size_ += _train->buffer_->size();
     queue_.emplace_back(_train->buffer_, 0);
+    endpoint_impl<Protocol>::counters_.add(EC_TRAIN_DEPARTURES);
 
     if (!is_sending_ && !queue_.empty()) { // no writing in progress
         auto its_entry = get_front();
@@ -844,14 +886,13 @@ void client_endpoint_impl<Protocol>::queue_train(const std::shared_ptr<train>& _
 template<typename Protocol>
 size_t client_endpoint_impl<Protocol>::get_queue_size() const {
 
-    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     return queue_size_;
 }
 
 template<typename Protocol>
-void client_endpoint_impl<Protocol>::start_dispatch_timer(const std::chrono::steady_clock::time_point& _now) {
+std::shared_ptr<train> client_endpoint_impl<Protocol>::get_next_train() const {
 
-    // Choose the next train
     std::shared_ptr<train> its_train(train_);
     if (!dispatched_trains_.empty()) {
 
@@ -861,27 +902,30 @@ void client_endpoint_impl<Protocol>::start_dispatch_timer(const std::chrono::ste
             its_train = its_dispatched->second.front();
         }
     }
+    return its_train;
+}
 
-    std::chrono::nanoseconds its_offset;
-    if (its_train->departure_ > _now) {
-
-        its_offset = std::chrono::duration_cast<std::chrono::nanoseconds>(its_train->departure_ - _now);
-    } else { // already departure time
+template<typename Protocol>
+void client_endpoint_impl<Protocol>::start_dispatch_timer(const std::chrono::steady_clock::time_point& _now) {
 
-        its_offset = std::chrono::nanoseconds::zero();
+    // The pending wait is only moved if the next train departs earlier. It
+    // is moved instead of being cancelled and restarted. Later departures
+    // are waited for again by flush_cbk.
+    const auto its_expiry = std::max(get_next_train()->departure_, _now);
+    if (its_expiry >= dispatch_expiry_) {
+        return;
+    }
+    dispatch_expiry_ = its_expiry;
+    if (!dispatch_timer_.reschedule(its_expiry)) {
+        dispatch_timer_.expires_at(its_expiry);
+        dispatch_timer_.async_wait(std::bind(&client_endpoint_impl<Protocol>::flush_cbk, this->shared_from_this(), std::placeholders::_1));
     }
-
-#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
-    dispatch_timer_.expires_after(its_offset);
-#else
-    dispatch_timer_.expires_after(std::chrono::duration_cast<std::chrono::steady_clock::duration>(its_offset));
-#endif
-    dispatch_timer_.async_wait(std::bind(&client_endpoint_impl<Protocol>::flush_cbk, this->shared_from_this(), std::placeholders::_1));
 }
 
 template<typename Protocol>
 void client_endpoint_impl<Protocol>::cancel_dispatch_timer() {
     dispatch_timer_.cancel();
+    dispatch_expiry_ = std::chrono::steady_clock::time_point::max();
 }
 
 template<typename Protocol>
@@ -14,6 +14,8 @@
 #include "../include/endpoint_host.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/endpoint_impl.hpp"
+#include "../../protocol/include/protocol.hpp"
+#include "../../utility/include/bithelper.hpp"
 
 namespace vsomeip_v3 {
 
@@ -31,7 +33,7 @@ void endpoint_impl<Protocol>::enable_magic_cookies() {
 }
 
 template<typename Protocol>
-uint32_t endpoint_impl<Protocol>::find_magic_cookie(byte_t* _buffer, size_t _size) {
+uint32_t endpoint_impl<Protocol>::find_magic_cookie(const byte_t* _buffer, size_t _size) {
     bool is_found(false);
     uint32_t its_offset = 0xFFFFFFFF;
 
@@ -72,6 +74,52 @@ void endpoint_impl<Protocol>::remove_default_target(service_t) { }
 template<typename Protocol>
 void endpoint_impl<Protocol>::remove_stop_handler(service_t) { }
 
+template<typename Protocol>
+bool endpoint_impl<Protocol>::get_metrics(endpoint_metrics_t& _metrics) const {
+    _metrics.is_local_ = is_local();
+    _metrics.is_reliable_ = is_reliable();
+    _metrics.is_client_ = is_client();
+    _metrics.local_port_ = get_local_port();
+    _metrics.remote_address_.clear();
+    _metrics.remote_port_ = 0;
+    _metrics.client_ = ILLEGAL_CLIENT;
+    _metrics.queue_size_ = get_queue_size();
+    get_endpoint_metrics(counters_, _metrics);
+    return true;
+}
+
+template<typename Protocol>
+void endpoint_impl<Protocol>::count_sent(const message_buffer_t& _buffer) {
+    counters_.add(EC_MESSAGES_SENT, get_message_count(_buffer));
+    counters_.add(EC_BYTES_SENT, _buffer.size());
+}
+
+template<typename Protocol>
+void endpoint_impl<Protocol>::count_dropped(const message_buffer_t& _buffer) {
+    counters_.add(EC_SEND_DROPS, get_message_count(_buffer));
+}
+
+template<typename Protocol>
+std::uint32_t endpoint_impl<Protocol>::get_message_count(const message_buffer_t& _buffer) const {
+    std::uint32_t its_count(0);
+    std::size_t its_position(0);
+    if (is_local()) {
+        while (its_position + protocol::COMMAND_HEADER_SIZE <= _buffer.size()) {
+            its_position += protocol::COMMAND_HEADER_SIZE + bithelper::read_uint32_le(&_buffer[its_position + protocol::COMMAND_POSITION_SIZE]);
+            ++its_count;
+        }
+    } else {
+        while (its_position + VSOMEIP_SOMEIP_HEADER_SIZE <= _buffer.size()) {
+            const auto its_message_id = bithelper::read_uint32_be(&_buffer[its_position]);
+            if (its_message_id != 0xFFFF0000 && its_message_id != 0xFFFF8000) {
+                ++its_count;
+            }
+            its_position += VSOMEIP_SOMEIP_HEADER_SIZE + bithelper::read_uint32_be(&_buffer[its_position + VSOMEIP_LENGTH_POS_MIN]);
+        }
+    }
+    return its_count;
+}
+
 template<typename Protocol>
 void endpoint_impl<Protocol>::register_error_handler(const error_handler_t& _error_handler) {
     std::lock_guard<std::mutex> its_lock(error_handler_mutex_);
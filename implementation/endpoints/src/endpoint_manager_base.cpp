@@ -11,6 +11,7 @@
 #include "../../configuration/include/configuration.hpp"
 #include "../../protocol/include/config_command.hpp"
 #include "../../routing/include/routing_manager_base.hpp"
+#include "../../utility/include/io_shards.hpp"
 #include "../../utility/include/utility.hpp"
 
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
@@ -227,6 +228,16 @@ std::map<client_t, std::shared_ptr<endpoint>> endpoint_manager_base::get_local_e
     return local_endpoints_;
 }
 
+void endpoint_manager_base::get_metrics(std::vector<endpoint_metrics_t>& _metrics) const {
+    for (const auto& e : get_local_endpoints()) {
+        endpoint_metrics_t its_metrics;
+        if (e.second->get_metrics(its_metrics)) {
+            its_metrics.client_ = e.first;
+            _metrics.push_back(std::move(its_metrics));
+        }
+    }
+}
+
 void endpoint_manager_base::log_client_states() const {
     std::vector<std::pair<client_t, size_t>> its_client_queue_sizes;
     std::stringstream its_log;
@@ -266,7 +277,8 @@ std::shared_ptr<endpoint> endpoint_manager_base::create_local_unlocked(client_t
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
     if (is_local_routing_) {
         its_endpoint = std::make_shared<local_uds_client_endpoint_impl>(shared_from_this(), rm_->shared_from_this(),
-                                                                        boost::asio::local::stream_protocol::endpoint(its_path.str()), io_,
+                                                                        boost::asio::local::stream_protocol::endpoint(its_path.str()),
+                                                                        io_shards::select(io_, _client),
                                                                         configuration_);
         VSOMEIP_INFO << "Client [" << std::hex << rm_->get_client() << "] is connecting to [" << std::hex << _client << "] at "
                      << its_path.str() << " endpoint > " << its_endpoint;
@@ -283,7 +295,7 @@ std::shared_ptr<endpoint> endpoint_manager_base::create_local_unlocked(client_t
                 its_local_address = configuration_->get_routing_guest_address();
                 its_endpoint = std::make_shared<local_tcp_client_endpoint_impl>(
                         shared_from_this(), rm_->shared_from_this(), boost::asio::ip::tcp::endpoint(its_local_address, local_port_),
-                        boost::asio::ip::tcp::endpoint(its_remote_address, its_remote_port), io_, configuration_);
+                        boost::asio::ip::tcp::endpoint(its_remote_address, its_remote_port), io_shards::select(io_, _client), configuration_);
 
                 VSOMEIP_INFO << "Client [" << std::hex << std::setfill('0') << std::setw(4) << rm_->get_client() << "] @ "
                              << its_local_address.to_string() << ":" << std::dec << local_port_ << " is connecting to [" << std::hex
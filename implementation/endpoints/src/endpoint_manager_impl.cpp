@@ -22,6 +22,8 @@
 #include "../../routing/include/routing_host.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/io_shards.hpp"
+#include "../../utility/include/low_latency_io.hpp"
 
 #include <forward_list>
 #include <iomanip>
@@ -230,8 +232,21 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_server_endpoint(uint16_t
 
     std::lock_guard<std::recursive_mutex> its_lock(endpoint_mutex_);
     if (_start) {
+        auto its_io{&io_shards::select(io_, std::hash<uint32_t>()((uint32_t(_port) << 1) | uint32_t(_reliable)))};
+        if (boost::asio::has_service<low_latency_io>(io_)) {
+            // Server endpoints that offer a low latency service are busy polled
+            auto& its_low_latency{boost::asio::use_service<low_latency_io>(io_)};
+            for (const auto& [its_service, its_instance] : its_low_latency.get_services()) {
+                const auto its_port{_reliable ? configuration_->get_reliable_port(its_service, its_instance)
+                                              : configuration_->get_unreliable_port(its_service, its_instance)};
+                if (its_port == _port) {
+                    its_io = &its_low_latency.get_polled();
+                    break;
+                }
+            }
+        }
         if (_reliable) {
-            auto its_tmp{std::make_shared<tcp_server_endpoint_impl>(shared_from_this(), rm_->shared_from_this(), io_, configuration_)};
+            auto its_tmp{std::make_shared<tcp_server_endpoint_impl>(shared_from_this(), rm_->shared_from_this(), *its_io, configuration_)};
             if (its_tmp) {
                 boost::asio::ip::tcp::endpoint its_reliable(its_unicast, _port);
                 its_tmp->init(its_reliable, its_error);
@@ -244,7 +259,7 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_server_endpoint(uint16_t
                 }
             }
         } else {
-            auto its_tmp{std::make_shared<udp_server_endpoint_impl>(shared_from_this(), rm_->shared_from_this(), io_, configuration_)};
+            auto its_tmp{std::make_shared<udp_server_endpoint_impl>(shared_from_this(), rm_->shared_from_this(), *its_io, configuration_)};
             if (its_tmp) {
                 boost::asio::ip::udp::endpoint its_unreliable(its_unicast, _port);
                 its_tmp->init(its_unreliable, its_error);
@@ -588,6 +603,38 @@ void endpoint_manager_impl::print_status() const {
     }
 }
 
+void endpoint_manager_impl::get_metrics(std::vector<endpoint_metrics_t>& _metrics) const {
+    endpoint_manager_base::get_metrics(_metrics);
+
+    client_endpoints_t its_client_endpoints;
+    server_endpoints_t its_server_endpoints;
+    {
+        std::scoped_lock its_lock{endpoint_mutex_};
+        its_client_endpoints = client_endpoints_;
+        its_server_endpoints = server_endpoints_;
+    }
+
+    endpoint_metrics_t its_metrics;
+    for (const auto& its_address : its_client_endpoints) {
+        for (const auto& its_port : its_address.second) {
+            for (const auto& its_reliability : its_port.second) {
+                for (const auto& its_partition : its_reliability.second) {
+                    if (its_partition.second->get_metrics(its_metrics)) {
+                        _metrics.push_back(its_metrics);
+                    }
+                }
+            }
+        }
+    }
+    for (const auto& its_port : its_server_endpoints) {
+        for (const auto& its_reliability : its_port.second) {
+            if (its_reliability.second->get_metrics(its_metrics)) {
+                _metrics.push_back(its_metrics);
+            }
+        }
+    }
+}
+
 bool endpoint_manager_impl::create_routing_root(std::shared_ptr<endpoint>& _root, bool& _is_socket_activated,
                                                 const std::shared_ptr<routing_host>& _host) {
 
@@ -1046,7 +1093,7 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_remote_client(service_t
         }
         if (configuration_->get_client_port(_service, _instance, its_remote_port, _reliable, its_used_client_ports, its_local_port)) {
             if (its_endpoint_def) {
-                its_endpoint = create_client_endpoint(its_remote_address, its_local_port, its_remote_port, _reliable);
+                its_endpoint = create_client_endpoint(_service, _instance, its_remote_address, its_local_port, its_remote_port, _reliable);
             }
 
             if (its_endpoint) {
@@ -1071,17 +1118,25 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_remote_client(service_t
     return its_endpoint;
 }
 
-std::shared_ptr<endpoint> endpoint_manager_impl::create_client_endpoint(const boost::asio::ip::address& _address, uint16_t _local_port,
+std::shared_ptr<endpoint> endpoint_manager_impl::create_client_endpoint(service_t _service, instance_t _instance,
+                                                                        const boost::asio::ip::address& _address, uint16_t _local_port,
                                                                         uint16_t _remote_port, bool _reliable) {
 
     std::shared_ptr<endpoint> its_endpoint;
     boost::asio::ip::address its_unicast = configuration_->get_unicast_address();
+    auto its_io{&io_shards::select(io_, std::hash<std::string>()(_address.to_string()) ^ ((std::size_t(_remote_port) << 1) | _reliable))};
+    if (boost::asio::has_service<low_latency_io>(io_)) {
+        auto& its_low_latency{boost::asio::use_service<low_latency_io>(io_)};
+        if (its_low_latency.is_low_latency(_service, _instance)) {
+            its_io = &its_low_latency.get_polled();
+        }
+    }
 
     try {
         if (_reliable) {
             its_endpoint = std::make_shared<tcp_client_endpoint_impl>(
                     shared_from_this(), rm_->shared_from_this(), boost::asio::ip::tcp::endpoint(its_unicast, _local_port),
-                    boost::asio::ip::tcp::endpoint(_address, _remote_port), io_, configuration_);
+                    boost::asio::ip::tcp::endpoint(_address, _remote_port), *its_io, configuration_);
 
             if (configuration_->has_enabled_magic_cookies(_address.to_string(), _remote_port)) {
                 its_endpoint->enable_magic_cookies();
@@ -1089,7 +1144,7 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_client_endpoint(const bo
         } else {
             its_endpoint = std::make_shared<udp_client_endpoint_impl>(
                     shared_from_this(), rm_->shared_from_this(), boost::asio::ip::udp::endpoint(its_unicast, _local_port),
-                    boost::asio::ip::udp::endpoint(_address, _remote_port), io_, configuration_);
+                    boost::asio::ip::udp::endpoint(_address, _remote_port), *its_io, configuration_);
         }
     } catch (...) {
         VSOMEIP_ERROR << __func__ << " Client endpoint creation failed";
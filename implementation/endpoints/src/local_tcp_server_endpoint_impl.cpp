@@ -405,9 +405,7 @@ void local_tcp_server_endpoint_impl::connection::send_queued(const message_buffe
 
     std::shared_ptr<local_tcp_server_endpoint_impl> its_server(server_.lock());
     if (!its_server) {
-        VSOMEIP_TRACE << "ltsei::connection::send_queued "
-                         " couldn't lock server_"
-                      << " endpoint > " << this;
+        VSOMEIP_TRACE_F("ltsei::connection::send_queued  couldn't lock server_ endpoint > {}", static_cast<const void*>(this));
         return;
     }
 
@@ -461,22 +459,19 @@ void local_tcp_server_endpoint_impl::disconnect_from(const client_t _client) {
     connections_.erase(_client);
 }
 
-void local_tcp_server_endpoint_impl::get_configured_times_from_endpoint(service_t _service, method_t _method,
-                                                                        std::chrono::nanoseconds* _debouncing,
-                                                                        std::chrono::nanoseconds* _maximum_retention) const {
-    (void)_service;
-    (void)_method;
-    (void)_debouncing;
-    (void)_maximum_retention;
-    VSOMEIP_ERROR << "ltsei::get_configured_times_from_endpoint." << " endpoint > " << this;
-}
-
 void local_tcp_server_endpoint_impl::connection::send_cbk(const message_buffer_ptr_t _buffer, boost::system::error_code const& _error,
                                                           std::size_t _bytes) {
-    (void)_buffer;
     (void)_bytes;
     if (_error)
         VSOMEIP_WARNING << "ltsei::send_cbk received error: " << _error.message() << " endpoint > " << this;
+
+    if (auto its_server = server_.lock()) {
+        if (_error) {
+            its_server->count_dropped(*_buffer);
+        } else {
+            its_server->count_sent(*_buffer);
+        }
+    }
 }
 
 void local_tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code const& _error, std::size_t _bytes) {
@@ -661,6 +656,7 @@ void local_tcp_server_endpoint_impl::connection::receive_cbk(boost::system::erro
                             its_server->add_connection(its_client, shared_from_this());
                         }
 
+                        its_server->count_received(uint32_t(its_end - its_start));
                         its_host->on_message(&recv_buffer_[its_start], uint32_t(its_end - its_start), its_server.get(), false,
                                              bound_client_, &sec_client_, its_address, its_port);
                     } else {
@@ -47,10 +47,9 @@ void local_uds_client_endpoint_impl::restart(bool _force) {
         return;
     }
     {
-        std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         sending_blocked_ = false;
-        queue_.clear();
-        queue_size_ = 0;
+        drop_queue();
         is_sending_ = false;
     }
     {
@@ -66,7 +65,7 @@ void local_uds_client_endpoint_impl::restart(bool _force) {
 void local_uds_client_endpoint_impl::start() {
     if (state_ == cei_state_e::CLOSED) {
         {
-            std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+            std::scoped_lock its_lock(mutex_);
             sending_blocked_ = false;
         }
         connect();
@@ -75,7 +74,7 @@ void local_uds_client_endpoint_impl::start() {
 
 void local_uds_client_endpoint_impl::stop() {
     {
-        std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         sending_blocked_ = true;
     }
     {
@@ -178,7 +177,7 @@ void local_uds_client_endpoint_impl::receive() {
 // this overrides client_endpoint_impl::send to disable the pull method
 // for local communication
 bool local_uds_client_endpoint_impl::send(const uint8_t* _data, uint32_t _size) {
-    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
 
     if (endpoint_impl::sending_blocked_ || !check_queue_limit(_data, _size)) {
         return false;
@@ -233,17 +232,6 @@ void local_uds_client_endpoint_impl::send_queued(std::pair<message_buffer_ptr_t,
     }
 }
 
-void local_uds_client_endpoint_impl::get_configured_times_from_endpoint(service_t _service, method_t _method,
-                                                                        std::chrono::nanoseconds* _debouncing,
-                                                                        std::chrono::nanoseconds* _maximum_retention) const {
-
-    (void)_service;
-    (void)_method;
-    (void)_debouncing;
-    (void)_maximum_retention;
-    VSOMEIP_ERROR << "local_client_endpoint_impl::get_configured_times_from_endpoint called.";
-}
-
 void local_uds_client_endpoint_impl::send_magic_cookie() { }
 
 void local_uds_client_endpoint_impl::receive_cbk(boost::system::error_code const& _error, std::size_t _bytes) {
@@ -254,10 +242,9 @@ void local_uds_client_endpoint_impl::receive_cbk(boost::system::error_code const
             // endpoint was stopped
             return;
         } else if (_error == boost::asio::error::eof) {
-            std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+            std::scoped_lock its_lock(mutex_);
             sending_blocked_ = false;
-            queue_.clear();
-            queue_size_ = 0;
+            drop_queue();
         } else if (_error == boost::asio::error::connection_reset || _error == boost::asio::error::bad_descriptor) {
             restart(true);
             return;
@@ -287,6 +274,7 @@ void local_uds_client_endpoint_impl::receive_cbk(boost::system::error_code const
             && recv_buffer_[2] == 0x6d && recv_buffer_[3] == 0x07 && recv_buffer_[4] == byte_t(protocol::id_e::ASSIGN_CLIENT_ACK_ID)
             && recv_buffer_[15] == 0x07 && recv_buffer_[16] == 0x6d && recv_buffer_[17] == 0x37 && recv_buffer_[18] == 0x67) {
 
+            count_received(static_cast<std::uint32_t>(recv_buffer_.size() - 8));
             auto its_routing_host = routing_host_.lock();
             if (its_routing_host)
                 its_routing_host->on_message(&recv_buffer_[4], static_cast<length_t>(recv_buffer_.size() - 8), this);
@@ -316,7 +304,7 @@ void local_uds_client_endpoint_impl::print_status() {
     std::size_t its_queue_size(0);
 
     {
-        std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         its_queue_size = queue_.size();
         its_data_size = queue_size_;
     }
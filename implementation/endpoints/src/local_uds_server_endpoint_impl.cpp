@@ -15,6 +15,7 @@
 #ifndef __QNX__
 #include "../include/credentials.hpp"
 #endif
+#include "../include/abstract_socket_factory.hpp"
 #include "../include/endpoint_host.hpp"
 #include "../include/local_uds_server_endpoint_impl.hpp"
 #include "../include/local_server_endpoint_impl_receive_op.hpp"
@@ -339,7 +340,7 @@ local_uds_server_endpoint_impl::connection::connection(const std::shared_ptr<loc
     socket_(_io), server_(_server), recv_buffer_size_initial_(_initial_recv_buffer_size + 8), max_message_size_(_max_message_size),
     recv_buffer_(recv_buffer_size_initial_, 0), recv_buffer_size_(0), missing_capacity_(0), shrink_count_(0),
     buffer_shrink_threshold_(_buffer_shrink_threshold), bound_client_(VSOMEIP_CLIENT_UNSET), bound_client_host_(""),
-    assigned_client_(false), is_stopped_(true) {
+    assigned_client_(false), is_stopped_(true), receiver_(abstract_socket_factory::get()->create_uds_receiver(_io)) {
     if (_server->is_routing_endpoint_ && !_server->configuration_->is_security_enabled()) {
         assigned_client_ = true;
     }
@@ -404,6 +405,12 @@ void local_uds_server_endpoint_impl::connection::start() {
         }
 
         is_stopped_ = false;
+        if (receiver_) {
+            receiver_->async_receive(socket_, boost::asio::buffer(&recv_buffer_[recv_buffer_size_], left_buffer_size),
+                                     std::bind(&local_uds_server_endpoint_impl::connection::receive_cbk, shared_from_this(),
+                                               std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
+            return;
+        }
         auto its_storage = std::make_shared<local_endpoint_receive_op::storage>(
                 socket_,
                 std::bind(&local_uds_server_endpoint_impl::connection::receive_cbk, shared_from_this(), std::placeholders::_1,
@@ -423,6 +430,9 @@ void local_uds_server_endpoint_impl::connection::stop() {
             VSOMEIP_ERROR << "lse: socket/handle closed already '" << std::string(std::strerror(errno)) << "' (" << errno << ") "
                           << get_path_local();
         }
+        if (receiver_) {
+            receiver_->cancel();
+        }
         boost::system::error_code its_error;
         socket_.cancel(its_error);
     }
@@ -487,22 +497,19 @@ void local_uds_server_endpoint_impl::disconnect_from(const client_t _client) {
     connections_.erase(_client);
 }
 
-void local_uds_server_endpoint_impl::get_configured_times_from_endpoint(service_t _service, method_t _method,
-                                                                        std::chrono::nanoseconds* _debouncing,
-                                                                        std::chrono::nanoseconds* _maximum_retention) const {
-    (void)_service;
-    (void)_method;
-    (void)_debouncing;
-    (void)_maximum_retention;
-    VSOMEIP_ERROR << "local_uds_server_endpoint_impl::get_configured_times_from_endpoint.";
-}
-
 void local_uds_server_endpoint_impl::connection::send_cbk(const message_buffer_ptr_t _buffer, boost::system::error_code const& _error,
                                                           std::size_t _bytes) {
-    (void)_buffer;
     (void)_bytes;
     if (_error)
         VSOMEIP_WARNING << "sei::send_cbk received error: " << _error.message();
+
+    if (auto its_server = server_.lock()) {
+        if (_error) {
+            its_server->count_dropped(*_buffer);
+        } else {
+            its_server->count_sent(*_buffer);
+        }
+    }
 }
 
 void local_uds_server_endpoint_impl::connection::receive_cbk(boost::system::error_code const& _error, std::size_t _bytes, uid_t const& _uid,
@@ -682,6 +689,7 @@ void local_uds_server_endpoint_impl::connection::receive_cbk(boost::system::erro
                     its_sec_client.user = _uid;
                     its_sec_client.group = _gid;
 
+                    its_server->count_received(uint32_t(its_end - its_start));
                     its_host->on_message(&recv_buffer_[its_start], uint32_t(its_end - its_start), its_server.get(), false, bound_client_,
                                          &its_sec_client);
                 } else {
@@ -839,6 +847,9 @@ void local_uds_server_endpoint_impl::connection::shutdown_and_close() {
 }
 
 void local_uds_server_endpoint_impl::connection::shutdown_and_close_unlocked() {
+    if (receiver_) {
+        receiver_->cancel();
+    }
     boost::system::error_code its_error;
     socket_.shutdown(socket_.shutdown_both, its_error);
     socket_.close(its_error);
@@ -31,12 +31,13 @@ template<typename Protocol>
 server_endpoint_impl<Protocol>::server_endpoint_impl(const std::shared_ptr<endpoint_host>& _endpoint_host,
                                                      const std::shared_ptr<routing_host>& _routing_host, boost::asio::io_context& _io,
                                                      const std::shared_ptr<configuration>& _configuration) :
-    endpoint_impl<Protocol>(_endpoint_host, _routing_host, _io, _configuration) { }
+    endpoint_impl<Protocol>(_endpoint_host, _routing_host, _io, _configuration), mutex_("server_endpoint_impl::mutex_"),
+    train_buffers_(std::make_shared<train_buffer_pool>()) { }
 
 template<typename Protocol>
 void server_endpoint_impl<Protocol>::prepare_stop(const endpoint::prepare_stop_handler_t& _handler, service_t _service) {
 
-    std::lock_guard<std::mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     std::vector<target_data_iterator_type> its_erased;
 
     if (_service == ANY_SERVICE) {
@@ -52,8 +53,7 @@ void server_endpoint_impl<Protocol>::prepare_stop(const endpoint::prepare_stop_h
 
         for (auto t = targets_.begin(); t != targets_.end(); t++) {
             auto its_train(t->second.train_);
-            // cancel dispatch timer
-            t->second.dispatch_timer_->cancel();
+            cancel_dispatch_timer(t);
             if (its_train->buffer_->size() > 0) {
                 if (queue_train(t, its_train))
                     its_erased.push_back(t);
@@ -83,15 +83,11 @@ void server_endpoint_impl<Protocol>::prepare_stop(const endpoint::prepare_stop_h
 
         for (auto t = targets_.begin(); t != targets_.end(); t++) {
             auto its_train(t->second.train_);
-            for (auto const& passenger_iter : its_train->passengers_) {
-                if (passenger_iter.first == _service) {
-                    // cancel dispatch timer
-                    t->second.dispatch_timer_->cancel();
-                    // TODO: Queue all(!) trains here...
-                    if (queue_train(t, its_train))
-                        its_erased.push_back(t);
-                    break;
-                }
+            if (its_train->passengers_.contains_service(_service)) {
+                cancel_dispatch_timer(t);
+                // TODO: Queue all(!) trains here...
+                if (queue_train(t, its_train))
+                    its_erased.push_back(t);
             }
         }
     }
@@ -220,6 +216,33 @@ bool server_endpoint_impl<Protocol>::send(const std::vector<byte_t>& _cmd_header
 template<typename Protocol>
 bool server_endpoint_impl<Protocol>::send_intern(endpoint_type _target, const byte_t* _data, uint32_t _size) {
 
+    return board_train(_target, _data, _size, true);
+}
+
+template<typename Protocol>
+bool server_endpoint_impl<Protocol>::send_batch_intern(endpoint_type _target, const endpoint::batch_t& _messages) {
+
+    if (_messages.empty()) {
+        return true;
+    }
+
+    // All messages enter the train(s) first, the dispatch timer is
+    // restarted once for the whole batch.
+    const auto its_target_iterator = find_or_create_target_unlocked(_target);
+
+    bool is_sent(true);
+    for (const auto& m : _messages) {
+        is_sent = board_train(_target, m->data(), static_cast<uint32_t>(m->size()), false) && is_sent;
+    }
+
+    start_dispatch_timer(its_target_iterator, std::chrono::steady_clock::now());
+
+    return is_sent;
+}
+
+template<typename Protocol>
+bool server_endpoint_impl<Protocol>::board_train(endpoint_type _target, const byte_t* _data, uint32_t _size, bool _restart_timer) {
+
     if (!check_message_size(_size)) {
         return segment_message(_data, _size, _target) == endpoint_impl<Protocol>::cms_ret_e::MSG_WAS_SPLIT;
     }
@@ -255,24 +278,20 @@ bool server_endpoint_impl<Protocol>::send_intern(endpoint_type _target, const by
         return false;
     }
 
-    // STEP 2: Cancel the dispatch timer
-    cancel_dispatch_timer(its_target_iterator);
-
     // STEP 3: Get configured timings
     const service_t its_service = bithelper::read_uint16_be(&_data[VSOMEIP_SERVICE_POS_MIN]);
     const method_t its_method = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
     if (its_service != VSOMEIP_SD_SERVICE && its_method != VSOMEIP_SD_METHOD) {
-        get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
+        npdu_timings_.get(its_service, its_method, its_debouncing, its_retention);
     }
 
     // STEP 4: Check if the passenger enters an empty train
-    const std::pair<service_t, method_t> its_identifier = std::make_pair(its_service, its_method);
     if (its_data.train_->passengers_.empty()) {
         its_data.train_->departure_ = its_now + its_retention;
     } else {
-        if (its_data.train_->passengers_.end() != its_data.train_->passengers_.find(its_identifier)) {
+        if (its_data.train_->passengers_.contains(its_service, its_method)) {
             must_depart = true;
         } else {
             // STEP 5: Check whether the current message fits into the current train
@@ -312,13 +331,13 @@ bool server_endpoint_impl<Protocol>::send_intern(endpoint_type _target, const by
         // departs. Block sending until train is allowed to depart.
         schedule_train(its_data);
 
-        its_data.train_ = std::make_shared<train>();
+        its_data.train_ = std::make_shared<train>(train_buffers_->get(endpoint_impl<Protocol>::max_message_size_));
         its_data.train_->departure_ = its_now + its_retention;
     }
 
     // STEP 9: insert current message buffer
     its_data.train_->buffer_->insert(its_data.train_->buffer_->end(), _data, _data + _size);
-    its_data.train_->passengers_.insert(its_identifier);
+    its_data.train_->passengers_.insert(its_service, its_method);
     // STEP 9.1: update the trains minimal debounce time if necessary
     if (its_debouncing < its_data.train_->minimal_debounce_time_) {
         its_data.train_->minimal_debounce_time_ = its_debouncing;
@@ -329,7 +348,9 @@ bool server_endpoint_impl<Protocol>::send_intern(endpoint_type _target, const by
     }
 
     // STEP 10: restart timer with current departure time
-    start_dispatch_timer(its_target_iterator, its_now);
+    if (_restart_timer) {
+        start_dispatch_timer(its_target_iterator, its_now);
+    }
 
     return true;
 }
@@ -357,7 +378,7 @@ void server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
 
     std::chrono::nanoseconds its_debouncing(0), its_retention(0);
     if (its_service != VSOMEIP_SD_SERVICE && its_method != VSOMEIP_SD_METHOD) {
-        get_configured_times_from_endpoint(its_service, its_method, &its_debouncing, &its_retention);
+        npdu_timings_.get(its_service, its_method, its_debouncing, its_retention);
     }
     // update the trains minimal debounce time if necessary
     if (its_debouncing < its_data.train_->minimal_debounce_time_) {
@@ -371,7 +392,7 @@ void server_endpoint_impl<Protocol>::send_segments(const tp::tp_split_messages_t
     // messages as we will send several now anyway.
     if (!its_data.train_->passengers_.empty()) {
         schedule_train(its_data);
-        its_data.train_ = std::make_shared<train>();
+        its_data.train_ = std::make_shared<train>(train_buffers_->get(endpoint_impl<Protocol>::max_message_size_));
         its_data.train_->departure_ = its_now + its_retention;
     }
 
@@ -392,7 +413,8 @@ server_endpoint_impl<Protocol>::find_or_create_target_unlocked(endpoint_type _ta
 
     auto its_iterator = targets_.find(_target);
     if (its_iterator == targets_.end()) {
-        auto its_result = targets_.emplace(std::make_pair(_target, endpoint_data_type(this->io_)));
+        auto its_result = targets_.emplace(
+                std::make_pair(_target, endpoint_data_type(this->io_, train_buffers_->get(endpoint_impl<Protocol>::max_message_size_))));
         its_iterator = its_result.first;
     }
 
@@ -493,6 +515,7 @@ bool server_endpoint_impl<Protocol>::check_queue_limit(const uint8_t* _data, std
                       << ") reached. Dropping message (" << std::hex << std::setfill('0') << std::setw(4) << its_client << "): ["
                       << std::setw(4) << its_service << "." << std::setw(4) << its_method << "." << std::setw(4) << its_session << "]"
                       << " queue_size: " << std::dec << _endpoint_data.queue_size_ << " data size: " << _size;
+        endpoint_impl<Protocol>::counters_.add(EC_QUEUE_LIMIT_DROPS);
         return false;
     }
     return true;
@@ -506,6 +529,7 @@ bool server_endpoint_impl<Protocol>::queue_train(target_data_iterator_type _it,
     auto& its_data = _it->second;
     its_data.queue_size_ += _train->buffer_->size();
     its_data.queue_.emplace_back(_train->buffer_, 0);
+    endpoint_impl<Protocol>::counters_.add(EC_TRAIN_DEPARTURES);
 
     if (!its_data.is_sending_ && !is_closed()) { // no writing in progress
         must_erase = send_queued(_it);
@@ -520,13 +544,14 @@ bool server_endpoint_impl<Protocol>::flush(endpoint_type _key) {
     bool has_queued(true);
     bool is_current_train(true);
 
-    std::lock_guard<std::mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
 
     auto it = targets_.find(_key);
     if (it == targets_.end())
         return false;
 
     auto& its_data = it->second;
+    its_data.dispatch_expiry_ = std::chrono::steady_clock::time_point::max();
     auto its_train(its_data.train_);
     if (!its_data.dispatched_trains_.empty()) {
 
@@ -551,7 +576,7 @@ bool server_endpoint_impl<Protocol>::flush(endpoint_type _key) {
 
         // Reset current train if necessary
         if (is_current_train) {
-            its_train->reset();
+            its_train->reset(train_buffers_->get(endpoint_impl<Protocol>::max_message_size_));
         }
     } else {
         has_queued = false;
@@ -626,7 +651,7 @@ void server_endpoint_impl<Protocol>::send_cbk(const endpoint_type _key, boost::s
         }
     };
 
-    std::lock_guard<std::mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
 
     auto it = targets_.find(_key);
     if (it == targets_.end())
@@ -667,18 +692,27 @@ void server_endpoint_impl<Protocol>::send_cbk(const endpoint_type _key, boost::s
     session_t its_session(0);
 
     if (!_error) {
-        const std::size_t payload_size = its_buffer->size();
-        if (payload_size <= its_data.queue_size_) {
-            its_data.queue_size_ -= payload_size;
-            its_data.queue_.pop_front();
-        } else {
-            parse_message_ids(its_buffer, its_service, its_method, its_client, its_session);
-            VSOMEIP_WARNING << __func__ << ": prevented queue_size underflow. queue_size: " << its_data.queue_size_
-                            << " payload_size: " << payload_size << " payload: (" << std::hex << std::setfill('0') << std::setw(4)
-                            << its_client << "): [" << std::setw(4) << its_service << "." << std::setw(4) << its_method << "."
-                            << std::setw(4) << its_session << "]";
-            its_data.queue_.pop_front();
-            recalculate_queue_size(its_data);
+        // A gather write completes several queue entries at once
+        const std::size_t its_count(its_data.sending_count_);
+        its_data.sending_count_ = 1;
+        for (std::size_t i = 0; i < its_count && !its_data.queue_.empty(); ++i) {
+            if (i > 0) {
+                its_buffer = its_data.queue_.front().first;
+            }
+            endpoint_impl<Protocol>::count_sent(*its_buffer);
+            const std::size_t payload_size = its_buffer->size();
+            if (payload_size <= its_data.queue_size_) {
+                its_data.queue_size_ -= payload_size;
+                its_data.queue_.pop_front();
+            } else {
+                parse_message_ids(its_buffer, its_service, its_method, its_client, its_session);
+                VSOMEIP_WARNING << __func__ << ": prevented queue_size underflow. queue_size: " << its_data.queue_size_
+                                << " payload_size: " << payload_size << " payload: (" << std::hex << std::setfill('0') << std::setw(4)
+                                << its_client << "): [" << std::setw(4) << its_service << "." << std::setw(4) << its_method << "."
+                                << std::setw(4) << its_session << "]";
+                its_data.queue_.pop_front();
+                recalculate_queue_size(its_data);
+            }
         }
 
         update_last_departure(its_data);
@@ -708,6 +742,9 @@ void server_endpoint_impl<Protocol>::send_cbk(const endpoint_type _key, boost::s
                         << std::setfill('0') << std::setw(4) << its_client << "): [" << std::setw(4) << its_service << "." << std::setw(4)
                         << its_method << "." << std::setw(4) << its_session << "]"
                         << " endpoint -> " << this;
+        for (const auto& e : its_data.queue_) {
+            endpoint_impl<Protocol>::count_dropped(*e.first);
+        }
         cancel_dispatch_timer(it);
         targets_.erase(it);
         if (!prepare_stop_handlers_.empty()) {
@@ -727,7 +764,22 @@ template<typename Protocol>
 void server_endpoint_impl<Protocol>::flush_cbk(endpoint_type _key, const boost::system::error_code& _error_code) {
 
     if (!_error_code) {
-
+        {
+            // The wait is only moved to earlier departures, so it may expire
+            // before the next train is due. Wait again in this case.
+            std::scoped_lock its_lock(mutex_);
+            auto it = targets_.find(_key);
+            if (it == targets_.end()) {
+                return;
+            }
+            const auto its_now(std::chrono::steady_clock::now());
+            const auto its_train(get_next_train(it->second));
+            if (!its_train->buffer_->empty() && its_train->departure_ > its_now) {
+                it->second.dispatch_expiry_ = std::chrono::steady_clock::time_point::max();
+                start_dispatch_timer(it, its_now);
+                return;
+            }
+        }
         (void)flush(_key);
     }
 }
@@ -737,7 +789,7 @@ void server_endpoint_impl<Protocol>::remove_stop_handler(service_t _service) {
     std::stringstream its_services_log;
     its_services_log << __func__ << ": ";
 
-    std::lock_guard<std::mutex> its_lock{mutex_};
+    std::scoped_lock its_lock{mutex_};
     for (const auto& its_service : prepare_stop_handlers_)
         its_services_log << std::hex << std::setfill('0') << std::setw(4) << its_service.first << ' ';
 
@@ -749,7 +801,7 @@ template<typename Protocol>
 size_t server_endpoint_impl<Protocol>::get_queue_size() const {
     size_t its_queue_size(0);
     {
-        std::lock_guard<std::mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         for (const auto& t : targets_) {
             its_queue_size += t.second.queue_size_;
         }
@@ -758,42 +810,51 @@ size_t server_endpoint_impl<Protocol>::get_queue_size() const {
 }
 
 template<typename Protocol>
-void server_endpoint_impl<Protocol>::start_dispatch_timer(target_data_iterator_type _it,
-                                                          const std::chrono::steady_clock::time_point& _now) {
-
-    auto& its_data = _it->second;
-    std::shared_ptr<train> its_train(its_data.train_);
+std::shared_ptr<train> server_endpoint_impl<Protocol>::get_next_train(const endpoint_data_type& _data) const {
 
-    if (!its_data.dispatched_trains_.empty()) {
+    std::shared_ptr<train> its_train(_data.train_);
+    if (!_data.dispatched_trains_.empty()) {
 
-        auto its_dispatched = its_data.dispatched_trains_.begin();
+        auto its_dispatched = _data.dispatched_trains_.begin();
         if (its_dispatched->first < its_train->departure_) {
 
             its_train = its_dispatched->second.front();
         }
     }
+    return its_train;
+}
 
-    std::chrono::nanoseconds its_offset;
-    if (its_train->departure_ > _now) {
+template<typename Protocol>
+void server_endpoint_impl<Protocol>::start_dispatch_timer(target_data_iterator_type _it,
+                                                          const std::chrono::steady_clock::time_point& _now) {
 
-        its_offset = std::chrono::duration_cast<std::chrono::nanoseconds>(its_train->departure_ - _now);
-    } else { // already departure time
+    auto& its_data = _it->second;
 
-        its_offset = std::chrono::nanoseconds::zero();
+    // The pending wait is only moved if the next train departs earlier. It
+    // is moved instead of being cancelled and restarted. Later departures
+    // are waited for again by flush_cbk.
+    const auto its_expiry = std::max(get_next_train(its_data)->departure_, _now);
+    if (its_expiry >= its_data.dispatch_expiry_) {
+        return;
+    }
+    its_data.dispatch_expiry_ = its_expiry;
+    if (!its_data.dispatch_timer_->reschedule(its_expiry)) {
+        its_data.dispatch_timer_->expires_at(its_expiry);
+        its_data.dispatch_timer_->async_wait(
+                std::bind(&server_endpoint_impl<Protocol>::flush_cbk, this->shared_from_this(), _it->first, std::placeholders::_1));
     }
-
-#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
-    its_data.dispatch_timer_->expires_after(its_offset);
-#else
-    its_data.dispatch_timer_->expires_after(std::chrono::duration_cast<std::chrono::steady_clock::duration>(its_offset));
-#endif
-    its_data.dispatch_timer_->async_wait(
-            std::bind(&server_endpoint_impl<Protocol>::flush_cbk, this->shared_from_this(), _it->first, std::placeholders::_1));
 }
 
 template<typename Protocol>
 void server_endpoint_impl<Protocol>::cancel_dispatch_timer(target_data_iterator_type _it) {
     _it->second.dispatch_timer_->cancel();
+    _it->second.dispatch_expiry_ = std::chrono::steady_clock::time_point::max();
+}
+
+template<typename Protocol>
+void server_endpoint_impl<Protocol>::set_npdu_timings(npdu_timing_table _timings) {
+    std::scoped_lock its_lock(mutex_);
+    npdu_timings_ = std::move(_timings);
 }
 
 template<typename Protocol>
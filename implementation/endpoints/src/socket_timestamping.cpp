@@ -0,0 +1,123 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/socket_timestamping.hpp"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+
+#include <linux/net_tstamp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <time.h>
+#endif
+
+namespace vsomeip_v3 {
+namespace socket_timestamping {
+
+#if defined(__linux__)
+namespace {
+receive_timestamp::socket_time_t to_time(const timespec& _time) {
+    return receive_timestamp::socket_time_t(std::chrono::duration_cast<receive_timestamp::socket_time_t::duration>(
+            std::chrono::seconds(_time.tv_sec) + std::chrono::nanoseconds(_time.tv_nsec)));
+}
+
+// Space for the SCM_TIMESTAMPING control message
+constexpr std::size_t control_size = CMSG_SPACE(3 * sizeof(timespec));
+
+// Reads a message into "_buffer" and its sender into "_name" (if not null)
+boost::system::error_code receive_message(int _fd, boost::asio::mutable_buffer _buffer, sockaddr* _name, socklen_t& _name_length,
+                                          std::size_t& _bytes, receive_timestamp::socket_time_t& _time) {
+    iovec its_vec{_buffer.data(), _buffer.size()};
+    alignas(cmsghdr) char its_control[control_size];
+
+    msghdr its_header{};
+    its_header.msg_name = _name;
+    its_header.msg_namelen = _name_length;
+    its_header.msg_iov = &its_vec;
+    its_header.msg_iovlen = 1;
+    its_header.msg_control = its_control;
+    its_header.msg_controllen = sizeof(its_control);
+
+    ssize_t its_result;
+    do {
+        its_result = ::recvmsg(_fd, &its_header, MSG_DONTWAIT);
+    } while (its_result < 0 && errno == EINTR);
+
+    if (its_result < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return boost::asio::error::would_block;
+        }
+        return boost::system::error_code(errno, boost::system::system_category());
+    }
+
+    _bytes = static_cast<std::size_t>(its_result);
+    _name_length = its_header.msg_namelen;
+    _time = get(its_header);
+    return boost::system::error_code();
+}
+} // namespace
+
+bool enable(int _fd) {
+    const int its_flags(SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE);
+    return ::setsockopt(_fd, SOL_SOCKET, SO_TIMESTAMPING, &its_flags, sizeof(its_flags)) == 0;
+}
+
+receive_timestamp::socket_time_t get(msghdr& _header) {
+    for (cmsghdr* its_cmsg = CMSG_FIRSTHDR(&_header); its_cmsg != nullptr; its_cmsg = CMSG_NXTHDR(&_header, its_cmsg)) {
+        if (its_cmsg->cmsg_level == SOL_SOCKET && its_cmsg->cmsg_type == SCM_TIMESTAMPING
+            && its_cmsg->cmsg_len >= CMSG_LEN(sizeof(timespec))) {
+            // The software timestamp is the first of the three
+            timespec its_time;
+            std::memcpy(&its_time, CMSG_DATA(its_cmsg), sizeof(its_time));
+            return to_time(its_time);
+        }
+    }
+    return receive_timestamp::socket_time_t();
+}
+
+boost::system::error_code receive(int _fd, boost::asio::mutable_buffer _buffer, std::size_t& _bytes,
+                                  receive_timestamp::socket_time_t& _time) {
+    socklen_t its_name_length(0);
+    const auto its_error = receive_message(_fd, _buffer, nullptr, its_name_length, _bytes, _time);
+    if (!its_error && _bytes == 0 && _buffer.size() > 0) {
+        return boost::asio::error::eof;
+    }
+    return its_error;
+}
+
+boost::system::error_code receive_from(int _fd, boost::asio::mutable_buffer _buffer, boost::asio::ip::udp::endpoint& _sender,
+                                       std::size_t& _bytes, receive_timestamp::socket_time_t& _time) {
+    socklen_t its_name_length(static_cast<socklen_t>(_sender.capacity()));
+    const auto its_error = receive_message(_fd, _buffer, _sender.data(), its_name_length, _bytes, _time);
+    if (!its_error) {
+        _sender.resize(its_name_length);
+    }
+    return its_error;
+}
+#else
+bool enable(int) {
+    return false;
+}
+
+receive_timestamp::socket_time_t get(msghdr&) {
+    return receive_timestamp::socket_time_t();
+}
+
+boost::system::error_code receive(int, boost::asio::mutable_buffer, std::size_t& _bytes, receive_timestamp::socket_time_t&) {
+    _bytes = 0;
+    return boost::asio::error::operation_not_supported;
+}
+
+boost::system::error_code receive_from(int, boost::asio::mutable_buffer, boost::asio::ip::udp::endpoint&, std::size_t& _bytes,
+                                       receive_timestamp::socket_time_t&) {
+    _bytes = 0;
+    return boost::asio::error::operation_not_supported;
+}
+#endif
+
+} // namespace socket_timestamping
+} // namespace vsomeip_v3
@@ -19,6 +19,7 @@
 #include "../include/tcp_client_endpoint_impl.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/low_latency_io.hpp"
 
 namespace vsomeip_v3 {
 
@@ -27,13 +28,15 @@ tcp_client_endpoint_impl::tcp_client_endpoint_impl(const std::shared_ptr<endpoin
                                                    const endpoint_type& _remote, boost::asio::io_context& _io,
                                                    const std::shared_ptr<configuration>& _configuration) :
     tcp_client_endpoint_base_impl(_endpoint_host, _routing_host, _local, _remote, _io, _configuration),
-    recv_buffer_size_initial_(VSOMEIP_SOMEIP_HEADER_SIZE), recv_buffer_(std::make_shared<message_buffer_t>(recv_buffer_size_initial_, 0)),
-    shrink_count_(0), buffer_shrink_threshold_(configuration_->get_buffer_shrink_threshold()), remote_address_(_remote.address()),
+    recv_ring_size_(configuration_->get_tcp_receive_ring_size()), buffer_shrink_threshold_(configuration_->get_buffer_shrink_threshold()),
+    recv_buffer_(std::make_shared<tcp_receive_buffer>(recv_ring_size_, buffer_shrink_threshold_)), remote_address_(_remote.address()),
     remote_port_(_remote.port()), last_cookie_sent_(std::chrono::steady_clock::now() - std::chrono::seconds(11)),
     // send timeout after 2/3 of configured ttl, warning after 1/3
     send_timeout_(configuration_->get_sd_ttl() * 666), send_timeout_warning_(send_timeout_ / 2),
     tcp_restart_aborts_max_(configuration_->get_max_tcp_restart_aborts()),
-    tcp_connect_time_max_(configuration_->get_max_tcp_connect_time()), aborted_restart_count_(0), sent_timer_(_io) {
+    tcp_connect_time_max_(configuration_->get_max_tcp_connect_time()), aborted_restart_count_(0), sent_timer_(_io),
+    gather_write_max_buffers_(configuration_->get_tcp_gather_write_max_buffers()),
+    gather_write_max_bytes_(configuration_->get_tcp_gather_write_max_bytes()), sending_count_(1), writes_(0), written_buffers_(0) {
 
     is_supporting_magic_cookies_ = true;
 
@@ -76,13 +79,13 @@ void tcp_client_endpoint_impl::restart(bool _force) {
             std::scoped_lock its_lock{self->socket_mutex_};
             address_port_local = self->get_address_port_local();
             self->shutdown_and_close_socket_unlocked(true);
-            self->recv_buffer_ = std::make_shared<message_buffer_t>(self->recv_buffer_size_initial_, 0);
+            self->recv_buffer_ = std::make_shared<tcp_receive_buffer>(self->recv_ring_size_, self->buffer_shrink_threshold_);
         }
         self->state_ = cei_state_e::CONNECTING;
         self->was_not_connected_ = true;
         self->reconnect_counter_ = 0;
         {
-            std::scoped_lock<std::recursive_mutex> its_lock(self->mutex_);
+            std::scoped_lock its_lock(self->mutex_);
             for (const auto& q : self->queue_) {
                 const service_t its_service = bithelper::read_uint16_be(&(*q.first)[VSOMEIP_SERVICE_POS_MIN]);
                 const method_t its_method = bithelper::read_uint16_be(&(*q.first)[VSOMEIP_METHOD_POS_MIN]);
@@ -94,9 +97,9 @@ void tcp_client_endpoint_impl::restart(bool _force) {
                                 << std::setw(4) << its_session << "]"
                                 << " size: " << std::dec << q.first->size();
             }
-            self->queue_.clear();
-            self->queue_size_ = 0;
+            self->drop_queue();
             self->is_sending_ = false;
+            self->sending_count_ = 1;
         }
         VSOMEIP_WARNING << "tce::restart: local: " << address_port_local << " remote: " << self->get_address_port_remote();
         self->start_connect_timer();
@@ -149,6 +152,12 @@ void tcp_client_endpoint_impl::connect() {
                                "setsockopt(TCP_USER_TIMEOUT), errno "
                             << errno;
         }
+
+        if (configuration_->is_socket_timestamping_enabled() && !socket_->enable_receive_timestamps()) {
+            VSOMEIP_WARNING << "tcp_client_endpoint::connect: could not enable receive timestamps, errno " << errno;
+        }
+
+        low_latency_io::apply(io_, socket_->native_handle());
 #endif
 
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
@@ -231,51 +240,39 @@ void tcp_client_endpoint_impl::connect() {
 }
 
 void tcp_client_endpoint_impl::receive() {
-    message_buffer_ptr_t its_recv_buffer;
+    std::shared_ptr<tcp_receive_buffer> its_recv_buffer;
     {
         std::scoped_lock its_lock{socket_mutex_};
         its_recv_buffer = recv_buffer_;
     }
     auto self = std::dynamic_pointer_cast<tcp_client_endpoint_impl>(shared_from_this());
-    boost::asio::dispatch(strand_, [self, its_recv_buffer]() { self->receive(its_recv_buffer, 0, 0); });
+    boost::asio::dispatch(strand_, [self, its_recv_buffer]() { self->receive(its_recv_buffer, 0); });
 }
 
-void tcp_client_endpoint_impl::receive(message_buffer_ptr_t _recv_buffer, std::size_t _recv_buffer_size, std::size_t _missing_capacity) {
+void tcp_client_endpoint_impl::receive(std::shared_ptr<tcp_receive_buffer> _recv_buffer, std::size_t _missing_capacity) {
     std::scoped_lock its_lock{socket_mutex_};
     if (socket_->is_open()) {
-        const std::size_t its_capacity(_recv_buffer->capacity());
-        size_t buffer_size = its_capacity - _recv_buffer_size;
+        if (_missing_capacity > MESSAGE_SIZE_UNLIMITED) {
+            VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
+            return;
+        }
+        boost::asio::mutable_buffer its_buffer;
         try {
-            if (_missing_capacity) {
-                if (_missing_capacity > MESSAGE_SIZE_UNLIMITED) {
-                    VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
-                    return;
-                }
-                const std::size_t its_required_capacity(_recv_buffer_size + _missing_capacity);
-                if (its_capacity < its_required_capacity) {
-                    _recv_buffer->reserve(its_required_capacity);
-                    _recv_buffer->resize(its_required_capacity, 0x0);
-                    if (_recv_buffer->size() > 1048576) {
-                        VSOMEIP_INFO << "tce: recv_buffer size is: " << _recv_buffer->size() << " local: " << get_address_port_local()
-                                     << " remote: " << get_address_port_remote();
-                    }
-                }
-                buffer_size = _missing_capacity;
-            } else if (buffer_shrink_threshold_ && shrink_count_ > buffer_shrink_threshold_ && _recv_buffer_size == 0) {
-                _recv_buffer->resize(recv_buffer_size_initial_, 0x0);
-                _recv_buffer->shrink_to_fit();
-                buffer_size = recv_buffer_size_initial_;
-                shrink_count_ = 0;
+            const std::size_t its_capacity(_recv_buffer->capacity());
+            its_buffer = _recv_buffer->prepare(_missing_capacity);
+            if (_recv_buffer->capacity() > its_capacity && _recv_buffer->capacity() > 1048576) {
+                VSOMEIP_INFO << "tce: recv_buffer size is: " << _recv_buffer->capacity() << " local: " << get_address_port_local()
+                             << " remote: " << get_address_port_remote();
             }
         } catch (const std::exception& e) {
-            handle_recv_buffer_exception(e, _recv_buffer, _recv_buffer_size);
+            handle_recv_buffer_exception(e, _recv_buffer);
             // don't start receiving again
             return;
         }
-        socket_->async_receive(boost::asio::buffer(&(*_recv_buffer)[_recv_buffer_size], buffer_size),
+        socket_->async_receive(its_buffer,
                                strand_.wrap(std::bind(&tcp_client_endpoint_impl::receive_cbk,
                                                       std::dynamic_pointer_cast<tcp_client_endpoint_impl>(shared_from_this()),
-                                                      std::placeholders::_1, std::placeholders::_2, _recv_buffer, _recv_buffer_size)));
+                                                      std::placeholders::_1, std::placeholders::_2, _recv_buffer)));
     }
 }
 
@@ -301,20 +298,48 @@ void tcp_client_endpoint_impl::send_queued(std::pair<message_buffer_ptr_t, uint3
             << static_cast<int>((*_entry.first)[i] << " ";
     VSOMEIP_INFO << msg.str();
 #endif
+
+    // Coalesce the entries queued behind the first one into a single write
+    std::vector<message_buffer_ptr_t> its_buffers {_entry.first};
+    std::size_t its_length(_entry.first->size());
+    {
+        std::scoped_lock its_lock(mutex_);
+        if (!queue_.empty() && queue_.front().first == _entry.first) {
+            for (auto it = std::next(queue_.begin());
+                 it != queue_.end() && its_buffers.size() < gather_write_max_buffers_
+                 && its_length + it->first->size() <= gather_write_max_bytes_;
+                 ++it) {
+                its_buffers.push_back(it->first);
+                its_length += it->first->size();
+            }
+        }
+        sending_count_ = its_buffers.size();
+        writes_++;
+        written_buffers_ += its_buffers.size();
+    }
+
+    std::vector<boost::asio::const_buffer> its_sequence;
+    its_sequence.reserve(its_buffers.size());
+    for (const auto& b : its_buffers) {
+        its_sequence.push_back(boost::asio::buffer(*b));
+    }
+
     {
         std::scoped_lock its_lock{socket_mutex_};
         if (socket_->is_open()) {
             socket_->async_write(
-                    boost::asio::buffer(*_entry.first),
-                    [this, self = shared_from_this(), to_be_send_length = _entry.first->size(), when = std::chrono::steady_clock::now(),
-                     its_service, its_method, its_client, its_session](auto ec, auto size) {
+                    its_sequence,
+                    [this, self = shared_from_this(), to_be_send_length = its_length, when = std::chrono::steady_clock::now(), its_service,
+                     its_method, its_client, its_session](auto ec, auto size) {
                         // do not use self, as the shared_from_this is pointing to the base class
                         return write_completion_condition(ec, size, to_be_send_length, its_service, its_method, its_client, its_session,
                                                           when);
                     },
                     strand_.wrap(
-                            // copy the buffer into the callback to keep the buffer itself alive
-                            [this, self = shared_from_this(), buffer = _entry.first](auto ec, auto size) { send_cbk(ec, size, buffer); }));
+                            // copy the buffers into the callback to keep the buffers themselves alive
+                            [this, self = shared_from_this(), buffers = std::move(its_buffers)](auto ec, auto size) {
+                                send_cbk(ec, size, buffers.front());
+                            }));
         } else {
             VSOMEIP_WARNING << "tcei::" << __func__ << ": try to send while socket was not open | endpoint > " << this;
             was_not_connected_ = true;
@@ -323,13 +348,6 @@ void tcp_client_endpoint_impl::send_queued(std::pair<message_buffer_ptr_t, uint3
     }
 }
 
-void tcp_client_endpoint_impl::get_configured_times_from_endpoint(service_t _service, method_t _method,
-                                                                  std::chrono::nanoseconds* _debouncing,
-                                                                  std::chrono::nanoseconds* _maximum_retention) const {
-    configuration_->get_configured_timing_requests(_service, remote_address_.to_string(), remote_port_, _method, _debouncing,
-                                                   _maximum_retention);
-}
-
 bool tcp_client_endpoint_impl::get_remote_address(boost::asio::ip::address& _address) const {
     if (remote_address_.is_unspecified()) {
         return false;
@@ -434,8 +452,8 @@ bool tcp_client_endpoint_impl::is_reliable() const {
     return true;
 }
 
-bool tcp_client_endpoint_impl::is_magic_cookie(const message_buffer_ptr_t& _recv_buffer, size_t _offset) const {
-    return (0 == std::memcmp(SERVICE_COOKIE, &(*_recv_buffer)[_offset], sizeof(SERVICE_COOKIE)));
+bool tcp_client_endpoint_impl::is_magic_cookie(const std::shared_ptr<tcp_receive_buffer>& _recv_buffer, size_t _offset) const {
+    return (0 == std::memcmp(SERVICE_COOKIE, _recv_buffer->data() + _offset, sizeof(SERVICE_COOKIE)));
 }
 
 void tcp_client_endpoint_impl::send_magic_cookie(message_buffer_ptr_t& _buffer) {
@@ -449,7 +467,7 @@ void tcp_client_endpoint_impl::send_magic_cookie(message_buffer_ptr_t& _buffer)
 }
 
 void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _error, std::size_t _bytes,
-                                           const message_buffer_ptr_t& _recv_buffer, std::size_t _recv_buffer_size) {
+                                           const std::shared_ptr<tcp_receive_buffer>& _recv_buffer) {
     if (_error == boost::asio::error::operation_aborted) {
         // endpoint was stopped
         return;
@@ -457,9 +475,9 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
 #if 0
     std::stringstream msg;
     msg << "cei::rcb (" << _error.message() << "): ";
-    for (std::size_t i = 0; i < _bytes + _recv_buffer_size; ++i)
+    for (std::size_t i = 0; i < _recv_buffer->size() + _bytes; ++i)
         msg << std::hex << std::setfill('0') << std::setw(2)
-            << static_cast<int>( (_recv_buffer)[i] << " ";
+            << static_cast<int>(_recv_buffer->data()[i]) << " ";
     VSOMEIP_INFO << msg.str();
 #endif
     std::unique_lock<std::mutex> its_lock(socket_mutex_);
@@ -467,22 +485,24 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
     if (its_host) {
         std::uint32_t its_missing_capacity(0);
         if (!_error && 0 < _bytes) {
-            if (_recv_buffer_size + _bytes > _recv_buffer->size()) {
+            if (!_recv_buffer->commit(_bytes)) {
                 VSOMEIP_ERROR << "receive buffer overflow in tcp client endpoint ~> abort!";
                 return;
             }
-            _recv_buffer_size += _bytes;
+            // Messages are framed in place, the receive buffer drops them once they were parsed
+            const byte_t* its_buffer = _recv_buffer->data();
+            std::size_t its_buffer_size = _recv_buffer->size();
 
             size_t its_iteration_gap = 0;
             bool has_full_message(false);
             do {
-                uint64_t read_message_size = utility::get_message_size(&(*_recv_buffer)[its_iteration_gap], _recv_buffer_size);
+                uint64_t read_message_size = utility::get_message_size(&its_buffer[its_iteration_gap], its_buffer_size);
                 if (read_message_size > MESSAGE_SIZE_UNLIMITED) {
                     VSOMEIP_ERROR << "Message size exceeds allowed maximum!";
                     return;
                 }
                 uint32_t current_message_size = static_cast<uint32_t>(read_message_size);
-                has_full_message = (current_message_size > VSOMEIP_RETURN_CODE_POS && current_message_size <= _recv_buffer_size);
+                has_full_message = (current_message_size > VSOMEIP_RETURN_CODE_POS && current_message_size <= its_buffer_size);
                 if (has_full_message) {
                     bool needs_forwarding(true);
                     if (is_magic_cookie(_recv_buffer, its_iteration_gap)) {
@@ -490,7 +510,7 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                     } else {
                         if (has_enabled_magic_cookies_) {
                             uint32_t its_offset =
-                                    find_magic_cookie(&(*_recv_buffer)[its_iteration_gap], static_cast<uint32_t>(_recv_buffer_size));
+                                    find_magic_cookie(&its_buffer[its_iteration_gap], static_cast<uint32_t>(its_buffer_size));
                             if (its_offset < current_message_size) {
                                 VSOMEIP_ERROR << "Message includes Magic Cookie. Ignoring it.";
                                 current_message_size = its_offset;
@@ -499,29 +519,29 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                         }
                     }
                     if (needs_forwarding) {
+                        count_received(current_message_size);
                         if (!has_enabled_magic_cookies_) {
                             its_lock.unlock();
-                            its_host->on_message(&(*_recv_buffer)[its_iteration_gap], current_message_size, this, false,
+                            its_host->on_message(&its_buffer[its_iteration_gap], current_message_size, this, false,
                                                  VSOMEIP_ROUTING_CLIENT, nullptr, remote_address_, remote_port_);
                             its_lock.lock();
                         } else {
                             // Only call on_message without a magic cookie in front of the buffer!
                             if (!is_magic_cookie(_recv_buffer, its_iteration_gap)) {
                                 its_lock.unlock();
-                                its_host->on_message(&(*_recv_buffer)[its_iteration_gap], current_message_size, this, false,
+                                its_host->on_message(&its_buffer[its_iteration_gap], current_message_size, this, false,
                                                      VSOMEIP_ROUTING_CLIENT, nullptr, remote_address_, remote_port_);
                                 its_lock.lock();
                             }
                         }
                     }
-                    calculate_shrink_count(_recv_buffer, _recv_buffer_size);
-                    _recv_buffer_size -= current_message_size;
+                    its_buffer_size -= current_message_size;
                     its_iteration_gap += current_message_size;
                     its_missing_capacity = 0;
-                } else if (has_enabled_magic_cookies_ && _recv_buffer_size > 0) {
-                    const uint32_t its_offset = find_magic_cookie(&(*_recv_buffer)[its_iteration_gap], _recv_buffer_size);
-                    if (its_offset < _recv_buffer_size) {
-                        _recv_buffer_size -= its_offset;
+                } else if (has_enabled_magic_cookies_ && its_buffer_size > 0) {
+                    const uint32_t its_offset = find_magic_cookie(&its_buffer[its_iteration_gap], its_buffer_size);
+                    if (its_offset < its_buffer_size) {
+                        its_buffer_size -= its_offset;
                         its_iteration_gap += its_offset;
                         has_full_message = true; // trigger next loop
                         VSOMEIP_ERROR << "Detected Magic Cookie within message data."
@@ -530,37 +550,29 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                 }
 
                 if (!has_full_message) {
-                    if (_recv_buffer_size > VSOMEIP_RETURN_CODE_POS) {
+                    if (its_buffer_size > VSOMEIP_RETURN_CODE_POS) {
                         bool invalid_parameter_detected{false};
-                        if (recv_buffer_->size() <= (its_iteration_gap + VSOMEIP_RETURN_CODE_POS)) {
-                            VSOMEIP_ERROR << "TCP Client receive_cbk is trying to access invalid "
-                                             "vector position."
-                                          << " Actual: " << recv_buffer_->size() << " Received: " << _recv_buffer->size()
-                                          << " Current: " << current_message_size << " Indicated: " << _recv_buffer_size
-                                          << " Bytes: " << _bytes << " Iteration_gap: " << its_iteration_gap
-                                          << " Is_full_message: " << has_full_message;
-                            return;
-                        } else if ((*recv_buffer_)[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION) {
+                        if (its_buffer[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION) {
                             invalid_parameter_detected = true;
                             VSOMEIP_ERROR << "tce: Wrong protocol version: 0x" << std::hex << std::setfill('0') << std::setw(2)
-                                          << std::uint32_t((*recv_buffer_)[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS])
+                                          << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS])
                                           << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
                             // ensure to send back a message w/ wrong protocol version
                             its_lock.unlock();
-                            its_host->on_message(&(*_recv_buffer)[its_iteration_gap], VSOMEIP_SOMEIP_HEADER_SIZE + 8, this, false,
+                            its_host->on_message(&its_buffer[its_iteration_gap], VSOMEIP_SOMEIP_HEADER_SIZE + 8, this, false,
                                                  VSOMEIP_ROUTING_CLIENT, nullptr, remote_address_, remote_port_);
                             its_lock.lock();
                         } else if (!utility::is_valid_message_type(
-                                           static_cast<message_type_e>((*recv_buffer_)[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))) {
+                                           static_cast<message_type_e>(its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))) {
                             invalid_parameter_detected = true;
                             VSOMEIP_ERROR << "tce: Invalid message type: 0x" << std::hex << std::setfill('0') << std::setw(2)
-                                          << std::uint32_t((*recv_buffer_)[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])
+                                          << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])
                                           << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
                         } else if (!utility::is_valid_return_code(
-                                           static_cast<return_code_e>((*recv_buffer_)[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))) {
+                                           static_cast<return_code_e>(its_buffer[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))) {
                             invalid_parameter_detected = true;
                             VSOMEIP_ERROR << "tce: Invalid return code: 0x" << std::hex << std::setfill('0') << std::setw(2)
-                                          << std::uint32_t((*recv_buffer_)[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])
+                                          << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])
                                           << " local: " << get_address_port_local() << " remote: " << get_address_port_remote();
                         }
 
@@ -576,9 +588,9 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                         }
                     }
                     if (max_message_size_ != MESSAGE_SIZE_UNLIMITED && current_message_size > max_message_size_) {
-                        _recv_buffer_size = 0;
-                        _recv_buffer->resize(recv_buffer_size_initial_, 0x0);
-                        _recv_buffer->shrink_to_fit();
+                        its_buffer_size = 0;
+                        its_iteration_gap = 0;
+                        _recv_buffer->clear();
                         if (has_enabled_magic_cookies_) {
                             VSOMEIP_ERROR << "Received a TCP message which exceeds "
                                           << "maximum message size (" << std::dec << current_message_size
@@ -600,22 +612,22 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                             wait_until_sent(boost::asio::error::operation_aborted);
                             return;
                         }
-                    } else if (current_message_size > _recv_buffer_size) {
-                        its_missing_capacity = current_message_size - static_cast<std::uint32_t>(_recv_buffer_size);
-                    } else if (VSOMEIP_SOMEIP_HEADER_SIZE > _recv_buffer_size) {
-                        its_missing_capacity = VSOMEIP_SOMEIP_HEADER_SIZE - static_cast<std::uint32_t>(_recv_buffer_size);
-                    } else if (has_enabled_magic_cookies_ && _recv_buffer_size > 0) {
+                    } else if (current_message_size > its_buffer_size) {
+                        its_missing_capacity = current_message_size - static_cast<std::uint32_t>(its_buffer_size);
+                    } else if (VSOMEIP_SOMEIP_HEADER_SIZE > its_buffer_size) {
+                        its_missing_capacity = VSOMEIP_SOMEIP_HEADER_SIZE - static_cast<std::uint32_t>(its_buffer_size);
+                    } else if (has_enabled_magic_cookies_ && its_buffer_size > 0) {
                         // no need to check for magic cookie here again: has_full_message
                         // would have been set to true if there was one present in the data
-                        _recv_buffer_size = 0;
-                        _recv_buffer->resize(recv_buffer_size_initial_, 0x0);
-                        _recv_buffer->shrink_to_fit();
+                        its_buffer_size = 0;
+                        its_iteration_gap = 0;
+                        _recv_buffer->clear();
                         its_missing_capacity = 0;
                         VSOMEIP_ERROR << "tce::c<" << this << ">rcb: recv_buffer_capacity: " << _recv_buffer->capacity()
                                       << " local: " << get_address_port_local() << " remote: " << get_address_port_remote()
                                       << ". Didn't find magic cookie in broken data, trying to resync.";
                     } else {
-                        VSOMEIP_ERROR << "tce::c<" << this << ">rcb: recv_buffer_size is: " << std::dec << _recv_buffer_size
+                        VSOMEIP_ERROR << "tce::c<" << this << ">rcb: recv_buffer_size is: " << std::dec << its_buffer_size
                                       << " but couldn't read "
                                          "out message_size. recv_buffer_capacity: "
                                       << _recv_buffer->capacity() << " its_iteration_gap: " << its_iteration_gap
@@ -631,21 +643,12 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                         return;
                     }
                 }
-            } while (has_full_message && _recv_buffer_size);
-            if (its_iteration_gap) {
-                // Copy incomplete message to front for next receive_cbk iteration
-                for (size_t i = 0; i < _recv_buffer_size; ++i) {
-                    (*_recv_buffer)[i] = (*_recv_buffer)[i + its_iteration_gap];
-                }
-                // Still more capacity needed after shifting everything to front?
-                if (its_missing_capacity && its_missing_capacity <= _recv_buffer->capacity() - _recv_buffer_size) {
-                    its_missing_capacity = 0;
-                }
-            }
+            } while (has_full_message && its_buffer_size);
+            _recv_buffer->consume(its_iteration_gap);
             its_lock.unlock();
             auto self = std::dynamic_pointer_cast<tcp_client_endpoint_impl>(shared_from_this());
-            boost::asio::dispatch(strand_, [self, _recv_buffer, _recv_buffer_size, its_missing_capacity]() {
-                self->receive(_recv_buffer, _recv_buffer_size, its_missing_capacity);
+            boost::asio::dispatch(strand_, [self, _recv_buffer, its_missing_capacity]() {
+                self->receive(_recv_buffer, its_missing_capacity);
             });
         } else {
             VSOMEIP_WARNING << "tcp_client_endpoint receive_cbk: " << _error.message() << "(" << std::dec << _error.value()
@@ -669,26 +672,14 @@ void tcp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
             } else {
                 its_lock.unlock();
                 auto self = std::dynamic_pointer_cast<tcp_client_endpoint_impl>(shared_from_this());
-                boost::asio::dispatch(strand_, [self, _recv_buffer, _recv_buffer_size, its_missing_capacity]() {
-                    self->receive(_recv_buffer, _recv_buffer_size, its_missing_capacity);
+                boost::asio::dispatch(strand_, [self, _recv_buffer, its_missing_capacity]() {
+                    self->receive(_recv_buffer, its_missing_capacity);
                 });
             }
         }
     }
 }
 
-void tcp_client_endpoint_impl::calculate_shrink_count(const message_buffer_ptr_t& _recv_buffer, std::size_t _recv_buffer_size) {
-    if (buffer_shrink_threshold_) {
-        if (_recv_buffer->capacity() != recv_buffer_size_initial_) {
-            if (_recv_buffer_size < (_recv_buffer->capacity() >> 1)) {
-                shrink_count_++;
-            } else {
-                shrink_count_ = 0;
-            }
-        }
-    }
-}
-
 std::string tcp_client_endpoint_impl::get_address_port_remote() const {
     std::string its_address_port;
     its_address_port.reserve(21);
@@ -718,26 +709,26 @@ std::string tcp_client_endpoint_impl::get_address_port_local() const {
     return its_address_port;
 }
 
-void tcp_client_endpoint_impl::handle_recv_buffer_exception(const std::exception& _e, const message_buffer_ptr_t& _recv_buffer,
-                                                            std::size_t _recv_buffer_size) {
+void tcp_client_endpoint_impl::handle_recv_buffer_exception(const std::exception& _e,
+                                                            const std::shared_ptr<tcp_receive_buffer>& _recv_buffer) {
 
     std::stringstream its_message;
     its_message << "tcp_client_endpoint_impl::connection catched exception" << _e.what() << " local: " << get_address_port_local()
                 << " remote: " << get_address_port_remote() << " shutting down connection. Start of buffer: " << std::hex
                 << std::setfill('0');
 
-    for (std::size_t i = 0; i < _recv_buffer_size && i < 16; i++) {
-        its_message << std::setw(2) << static_cast<int>((*_recv_buffer)[i]) << " ";
+    for (std::size_t i = 0; i < _recv_buffer->size() && i < 16; i++) {
+        its_message << std::setw(2) << static_cast<int>(_recv_buffer->data()[i]) << " ";
     }
 
     its_message << " Last 16 Bytes captured: ";
-    for (int i = 15; _recv_buffer_size > 15 && i >= 0; i--) {
-        its_message << std::setw(2) << static_cast<int>(((*_recv_buffer)[static_cast<size_t>(i)])) << " ";
+    for (int i = 15; _recv_buffer->size() > 15 && i >= 0; i--) {
+        its_message << std::setw(2) << static_cast<int>(_recv_buffer->data()[static_cast<size_t>(i)]) << " ";
     }
     VSOMEIP_ERROR << its_message.str();
     _recv_buffer->clear();
     {
-        std::scoped_lock<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         sending_blocked_ = true;
     }
     {
@@ -763,10 +754,14 @@ void tcp_client_endpoint_impl::print_status() {
     std::size_t its_data_size(0);
     std::size_t its_queue_size(0);
     std::size_t its_receive_buffer_capacity(0);
+    std::uint64_t its_writes(0);
+    std::uint64_t its_written_buffers(0);
     {
-        std::scoped_lock<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         its_queue_size = queue_.size();
         its_data_size = queue_size_;
+        its_writes = writes_;
+        its_written_buffers = written_buffers_;
     }
     std::string local;
     {
@@ -776,7 +771,9 @@ void tcp_client_endpoint_impl::print_status() {
     }
 
     VSOMEIP_INFO << "status tce: " << local << " -> " << get_address_port_remote() << " queue: " << std::dec << its_queue_size
-                 << " data: " << std::dec << its_data_size << " recv_buffer: " << std::dec << its_receive_buffer_capacity;
+                 << " data: " << std::dec << its_data_size << " recv_buffer: " << std::dec << its_receive_buffer_capacity
+                 << " writes per message: " << std::fixed << std::setprecision(2)
+                 << (its_written_buffers ? static_cast<double>(its_writes) / static_cast<double>(its_written_buffers) : 0.0);
 }
 
 std::string tcp_client_endpoint_impl::get_remote_information() const {
@@ -787,13 +784,18 @@ void tcp_client_endpoint_impl::send_cbk(boost::system::error_code const& _error,
                                         const message_buffer_ptr_t& _sent_msg) {
     (void)_bytes;
 
-    std::scoped_lock<std::recursive_mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     sent_timer_.cancel();
 
     if (!_error) {
         if (queue_.size() > 0) {
-            queue_size_ -= queue_.front().first->size();
-            queue_.pop_front();
+            // A gather write completes several entries at once
+            for (std::size_t i = 0; i < sending_count_ && !queue_.empty(); ++i) {
+                count_sent(*queue_.front().first);
+                queue_size_ -= queue_.front().first->size();
+                queue_.pop_front();
+            }
+            sending_count_ = 1;
 
             update_last_departure();
 
@@ -809,7 +811,9 @@ void tcp_client_endpoint_impl::send_cbk(boost::system::error_code const& _error,
         }
         return;
     } else {
+        // The failed write is repeated from the front of the queue
         is_sending_ = false;
+        sending_count_ = 1;
 
         if (_error == boost::system::errc::destination_address_required) {
             VSOMEIP_WARNING << "tce::send_cbk received error: " << _error.message() << " (" << std::dec << _error.value() << ") "
@@ -862,7 +866,7 @@ void tcp_client_endpoint_impl::wait_until_sent(const boost::system::error_code&
         // and therefore its part of its normal execution path.
         VSOMEIP_WARNING << "tce::" << __func__ << "::  (" << _error.value() << ") message: " << _error.message();
     }
-    std::unique_lock<std::recursive_mutex> its_lock(mutex_);
+    named_recursive_mutex::unique_lock its_lock(mutex_);
     if (!is_sending_ || !_error) {
         its_lock.unlock();
         if (!_error)
@@ -0,0 +1,87 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+
+#include "../include/tcp_receive_buffer.hpp"
+
+namespace vsomeip_v3 {
+
+tcp_receive_buffer::tcp_receive_buffer(std::size_t _capacity, std::uint32_t _shrink_threshold) :
+    ring_(std::max<std::size_t>(_capacity, 1), 0), storage_(&ring_), head_(0), tail_(0), limit_(ring_.size()),
+    shrink_threshold_(_shrink_threshold), shrink_count_(0) { }
+
+boost::asio::mutable_buffer tcp_receive_buffer::prepare(std::size_t _missing) {
+    const std::size_t its_required(size() + std::max<std::size_t>(_missing, 1));
+
+    if (its_required > limit_ - head_) {
+        if (its_required <= ring_.size()) {
+            relocate(ring_);
+            limit_ = ring_.size();
+        } else {
+            if (dedicated_.size() < its_required) {
+                message_buffer_t its_buffer(its_required, 0);
+                std::copy(data(), data() + size(), its_buffer.begin());
+                tail_ = size();
+                head_ = 0;
+                dedicated_.swap(its_buffer);
+                storage_ = &dedicated_;
+            } else {
+                relocate(dedicated_);
+            }
+            // Stop at the end of the message, the next one is received into the ring
+            limit_ = its_required;
+            shrink_count_ = 0;
+        }
+    } else if (!is_dedicated() && shrink_threshold_ && !dedicated_.empty() && ++shrink_count_ > shrink_threshold_) {
+        message_buffer_t().swap(dedicated_);
+        shrink_count_ = 0;
+    }
+
+    return boost::asio::buffer(storage_->data() + tail_, limit_ - tail_);
+}
+
+bool tcp_receive_buffer::commit(std::size_t _bytes) {
+    if (_bytes > limit_ - tail_) {
+        return false;
+    }
+    tail_ += _bytes;
+    return true;
+}
+
+void tcp_receive_buffer::consume(std::size_t _bytes) {
+    head_ += std::min(_bytes, size());
+    if (head_ == tail_) {
+        storage_ = &ring_;
+        head_ = tail_ = 0;
+        limit_ = ring_.size();
+    }
+}
+
+void tcp_receive_buffer::clear() {
+    storage_ = &ring_;
+    head_ = tail_ = 0;
+    limit_ = ring_.size();
+    message_buffer_t().swap(dedicated_);
+    shrink_count_ = 0;
+}
+
+std::size_t tcp_receive_buffer::capacity() const {
+    return ring_.size() + dedicated_.capacity();
+}
+
+void tcp_receive_buffer::relocate(message_buffer_t& _target) {
+    const std::size_t its_size(size());
+    if (&_target != storage_ || head_ != 0) {
+        // The target range never starts behind the source range, therefore
+        // copying front to back is safe if both are in the same buffer.
+        std::copy(data(), data() + its_size, _target.begin());
+    }
+    storage_ = &_target;
+    head_ = 0;
+    tail_ = its_size;
+}
+
+} // namespace vsomeip_v3
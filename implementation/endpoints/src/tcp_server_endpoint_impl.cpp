@@ -15,8 +15,11 @@
 #include "../include/endpoint_host.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/tcp_server_endpoint_impl.hpp"
+#include "../include/socket_timestamping.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/io_shards.hpp"
+#include "../../utility/include/low_latency_io.hpp"
 
 namespace ip = boost::asio::ip;
 
@@ -25,10 +28,11 @@ namespace vsomeip_v3 {
 tcp_server_endpoint_impl::tcp_server_endpoint_impl(const std::shared_ptr<endpoint_host>& _endpoint_host,
                                                    const std::shared_ptr<routing_host>& _routing_host, boost::asio::io_context& _io,
                                                    const std::shared_ptr<configuration>& _configuration) :
-    tcp_server_endpoint_base_impl(_endpoint_host, _routing_host, _io, _configuration), acceptor_(_io),
-    buffer_shrink_threshold_(configuration_->get_buffer_shrink_threshold()),
+    tcp_server_endpoint_base_impl(_endpoint_host, _routing_host, _io, _configuration), acceptor_(_io), accepted_(0),
+    buffer_shrink_threshold_(configuration_->get_buffer_shrink_threshold()), recv_ring_size_(configuration_->get_tcp_receive_ring_size()),
     // send timeout after 2/3 of configured ttl, warning after 1/3
-    send_timeout_(configuration_->get_sd_ttl() * 666) {
+    send_timeout_(configuration_->get_sd_ttl() * 666), gather_write_max_buffers_(configuration_->get_tcp_gather_write_max_buffers()),
+    gather_write_max_bytes_(configuration_->get_tcp_gather_write_max_bytes()) {
     is_supporting_magic_cookies_ = true;
 }
 
@@ -70,6 +74,7 @@ void tcp_server_endpoint_impl::init(const endpoint_type& _local, boost::system::
 
     this->max_message_size_ = configuration_->get_max_message_size_reliable(_local.address().to_string(), _local.port());
     this->queue_limit_ = configuration_->get_endpoint_queue_limit(_local.address().to_string(), _local.port());
+    set_npdu_timings(configuration_->get_npdu_timings_responses(_local.address().to_string(), _local.port()));
 }
 
 void tcp_server_endpoint_impl::start() {
@@ -77,7 +82,8 @@ void tcp_server_endpoint_impl::start() {
     if (acceptor_.is_open()) {
         connection::ptr new_connection =
                 connection::create(std::dynamic_pointer_cast<tcp_server_endpoint_impl>(shared_from_this()), max_message_size_,
-                                   buffer_shrink_threshold_, has_enabled_magic_cookies_, io_, send_timeout_);
+                                   recv_ring_size_, buffer_shrink_threshold_, has_enabled_magic_cookies_,
+                                   io_shards::select(io_, local_port_ + accepted_++), send_timeout_);
 
         {
             std::unique_lock<std::mutex> its_socket_lock(new_connection->get_socket_lock());
@@ -108,13 +114,19 @@ void tcp_server_endpoint_impl::stop() {
 }
 
 bool tcp_server_endpoint_impl::send_to(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) {
-    std::lock_guard<std::mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     endpoint_type its_target(_target->get_address(), _target->get_port());
     return send_intern(its_target, _data, _size);
 }
 
+bool tcp_server_endpoint_impl::send_batch_to(const std::shared_ptr<endpoint_definition> _target, const batch_t& _messages) {
+    std::scoped_lock its_lock(mutex_);
+    endpoint_type its_target(_target->get_address(), _target->get_port());
+    return send_batch_intern(its_target, _messages);
+}
+
 bool tcp_server_endpoint_impl::send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) {
-    std::lock_guard<std::mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     const endpoint_type its_target(_target->get_address(), _target->get_port());
     const auto its_target_iterator(find_or_create_target_unlocked(its_target));
     auto& its_data = its_target_iterator->second;
@@ -176,6 +188,9 @@ bool tcp_server_endpoint_impl::send_queued(const target_data_iterator_type _it)
             }
 
             // Drop outstanding messages.
+            for (const auto& its_q : _it->second.queue_) {
+                count_dropped(*its_q.first);
+            }
             _it->second.queue_.clear();
             must_erase = true;
         }
@@ -184,13 +199,6 @@ bool tcp_server_endpoint_impl::send_queued(const target_data_iterator_type _it)
     return (must_erase);
 }
 
-void tcp_server_endpoint_impl::get_configured_times_from_endpoint(service_t _service, method_t _method,
-                                                                  std::chrono::nanoseconds* _debouncing,
-                                                                  std::chrono::nanoseconds* _maximum_retention) const {
-    configuration_->get_configured_timing_responses(_service, tcp_server_endpoint_base_impl::local_.address().to_string(),
-                                                    tcp_server_endpoint_base_impl::local_.port(), _method, _debouncing, _maximum_retention);
-}
-
 bool tcp_server_endpoint_impl::is_established_to(const std::shared_ptr<endpoint_definition>& _endpoint) {
     bool is_connected = false;
     endpoint_type its_endpoint(_endpoint->get_address(), _endpoint->get_port());
@@ -257,6 +265,12 @@ void tcp_server_endpoint_impl::accept_cbk(connection::ptr _connection, boost::sy
             if (setsockopt(new_connection_socket.native_handle(), IPPROTO_TCP, TCP_USER_TIMEOUT, &opt, sizeof(opt)) == -1) {
                 VSOMEIP_WARNING << "tsei::" << __func__ << ": could not setsockopt(TCP_USER_TIMEOUT), errno " << errno;
             }
+
+            if (configuration_->is_socket_timestamping_enabled()) {
+                _connection->enable_receive_timestamps();
+            }
+
+            low_latency_io::apply(io_, new_connection_socket.native_handle());
 #endif
         }
         if (!its_error) {
@@ -312,14 +326,13 @@ void tcp_server_endpoint_impl::disconnect_from(const client_t) {
 // class tcp_service_impl::connection
 ///////////////////////////////////////////////////////////////////////////////
 tcp_server_endpoint_impl::connection::connection(const std::weak_ptr<tcp_server_endpoint_impl>& _server, std::uint32_t _max_message_size,
-                                                 std::uint32_t _recv_buffer_size_initial, std::uint32_t _buffer_shrink_threshold,
+                                                 std::uint32_t _recv_ring_size, std::uint32_t _buffer_shrink_threshold,
                                                  bool _magic_cookies_enabled, boost::asio::io_context& _io,
                                                  std::chrono::milliseconds _send_timeout) :
-    socket_(_io), server_(_server), max_message_size_(_max_message_size), recv_buffer_size_initial_(_recv_buffer_size_initial),
-    recv_buffer_(_recv_buffer_size_initial, 0), recv_buffer_size_(0), missing_capacity_(0), shrink_count_(0),
-    buffer_shrink_threshold_(_buffer_shrink_threshold), remote_port_(0), magic_cookies_enabled_(_magic_cookies_enabled),
+    socket_(_io), server_(_server), max_message_size_(_max_message_size), recv_buffer_(_recv_ring_size, _buffer_shrink_threshold),
+    missing_capacity_(0), remote_port_(0), magic_cookies_enabled_(_magic_cookies_enabled), is_timestamping_(false),
     last_cookie_sent_(std::chrono::steady_clock::now() - std::chrono::seconds(11)), send_timeout_(_send_timeout),
-    send_timeout_warning_(_send_timeout / 2) { }
+    send_timeout_warning_(_send_timeout / 2), writes_(0), written_buffers_(0) { }
 
 tcp_server_endpoint_impl::connection::~connection() {
 
@@ -334,11 +347,11 @@ tcp_server_endpoint_impl::connection::~connection() {
 
 tcp_server_endpoint_impl::connection::ptr
 tcp_server_endpoint_impl::connection::create(const std::weak_ptr<tcp_server_endpoint_impl>& _server, std::uint32_t _max_message_size,
-                                             std::uint32_t _buffer_shrink_threshold, bool _magic_cookies_enabled,
-                                             boost::asio::io_context& _io, std::chrono::milliseconds _send_timeout) {
-    const std::uint32_t its_initial_receveive_buffer_size = VSOMEIP_SOMEIP_HEADER_SIZE + 8 + MAGIC_COOKIE_SIZE + 8;
-    return ptr(new connection(_server, _max_message_size, its_initial_receveive_buffer_size, _buffer_shrink_threshold,
-                              _magic_cookies_enabled, _io, _send_timeout));
+                                             std::uint32_t _recv_ring_size, std::uint32_t _buffer_shrink_threshold,
+                                             bool _magic_cookies_enabled, boost::asio::io_context& _io,
+                                             std::chrono::milliseconds _send_timeout) {
+    return ptr(new connection(_server, _max_message_size, _recv_ring_size, _buffer_shrink_threshold, _magic_cookies_enabled, _io,
+                              _send_timeout));
 }
 
 tcp_server_endpoint_impl::socket_type& tcp_server_endpoint_impl::connection::get_socket() {
@@ -356,47 +369,38 @@ void tcp_server_endpoint_impl::connection::start() {
 void tcp_server_endpoint_impl::connection::receive() {
     std::lock_guard<std::mutex> its_lock(socket_mutex_);
     if (socket_.is_open()) {
-        const std::size_t its_capacity(recv_buffer_.capacity());
-        if (recv_buffer_size_ > its_capacity) {
-            VSOMEIP_ERROR << __func__ << "Received buffer size is greater than the buffer capacity!"
-                          << " recv_buffer_size_: " << recv_buffer_size_ << " its_capacity: " << its_capacity;
+        if (missing_capacity_ > MESSAGE_SIZE_UNLIMITED) {
+            VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
             return;
         }
-        size_t left_buffer_size = its_capacity - recv_buffer_size_;
+        boost::asio::mutable_buffer its_buffer;
         try {
-            if (missing_capacity_) {
-                if (missing_capacity_ > MESSAGE_SIZE_UNLIMITED) {
-                    VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
-                    return;
-                }
-                const std::size_t its_required_capacity(recv_buffer_size_ + missing_capacity_);
-                if (its_capacity < its_required_capacity) {
-                    // Make the resize to its_required_capacity
-                    recv_buffer_.reserve(its_required_capacity);
-                    recv_buffer_.resize(its_required_capacity, 0x0);
-                    if (recv_buffer_.size() > 1048576) {
-                        VSOMEIP_INFO << "tse: recv_buffer size is: " << recv_buffer_.size() << " local: " << get_address_port_local()
-                                     << " remote: " << get_address_port_remote();
-                    }
-                }
-                left_buffer_size = missing_capacity_;
-                missing_capacity_ = 0;
-            } else if (buffer_shrink_threshold_ && shrink_count_ > buffer_shrink_threshold_ && recv_buffer_size_ == 0) {
-                // In this case, make the resize to recv_buffer_size_initial_
-                recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                recv_buffer_.shrink_to_fit();
-                // And set buffer_size to recv_buffer_size_initial_, the same of our resize
-                left_buffer_size = recv_buffer_size_initial_;
-                shrink_count_ = 0;
+            const std::size_t its_capacity(recv_buffer_.capacity());
+            its_buffer = recv_buffer_.prepare(missing_capacity_);
+            if (recv_buffer_.capacity() > its_capacity && recv_buffer_.capacity() > 1048576) {
+                VSOMEIP_INFO << "tse: recv_buffer size is: " << recv_buffer_.capacity() << " local: " << get_address_port_local()
+                             << " remote: " << get_address_port_remote();
             }
+            missing_capacity_ = 0;
         } catch (const std::exception& e) {
             handle_recv_buffer_exception(e);
             // don't start receiving again
             return;
         }
-        socket_.async_receive(boost::asio::buffer(&recv_buffer_[recv_buffer_size_], left_buffer_size),
-                              std::bind(&tcp_server_endpoint_impl::connection::receive_cbk, shared_from_this(), std::placeholders::_1,
-                                        std::placeholders::_2));
+        auto its_handler = std::bind(&tcp_server_endpoint_impl::connection::receive_cbk, shared_from_this(), std::placeholders::_1,
+                                     std::placeholders::_2);
+        if (is_timestamping_) {
+            socket_timestamping::async_receive(socket_, its_buffer, std::move(its_handler));
+        } else {
+            socket_.async_receive(its_buffer, std::move(its_handler));
+        }
+    }
+}
+
+void tcp_server_endpoint_impl::connection::enable_receive_timestamps() {
+    is_timestamping_ = socket_timestamping::enable(socket_.native_handle());
+    if (!is_timestamping_) {
+        VSOMEIP_WARNING << "tsei::" << __func__ << ": could not enable receive timestamps, errno " << errno;
     }
 }
 
@@ -443,16 +447,35 @@ void tcp_server_endpoint_impl::connection::send_queued(const target_data_iterato
         }
     }
 
+    // Coalesce the entries queued behind the first one into a single write
+    auto its_buffers = std::make_shared<std::vector<message_buffer_ptr_t>>(1, its_buffer);
+    std::vector<boost::asio::const_buffer> its_sequence {boost::asio::buffer(*its_buffer)};
+    std::size_t its_length(its_buffer->size());
+    for (auto it = std::next(_it->second.queue_.begin());
+         it != _it->second.queue_.end() && its_buffers->size() < its_server->gather_write_max_buffers_
+         && its_length + it->first->size() <= its_server->gather_write_max_bytes_;
+         ++it) {
+        its_buffers->push_back(it->first);
+        its_sequence.push_back(boost::asio::buffer(*it->first));
+        its_length += it->first->size();
+    }
+    _it->second.sending_count_ = its_buffers->size();
+    writes_++;
+    written_buffers_ += its_buffers->size();
+
     {
         std::lock_guard<std::mutex> its_lock(socket_mutex_);
         _it->second.is_sending_ = true;
 
         boost::asio::async_write(
-                socket_, boost::asio::buffer(*its_buffer),
+                socket_, its_sequence,
                 std::bind(&tcp_server_endpoint_impl::connection::write_completion_condition, shared_from_this(), std::placeholders::_1,
-                          std::placeholders::_2, its_buffer->size(), its_service, its_method, its_client, its_session,
+                          std::placeholders::_2, its_length, its_service, its_method, its_client, its_session,
                           std::chrono::steady_clock::now()),
-                std::bind(&tcp_server_endpoint_base_impl::send_cbk, its_server, _it->first, std::placeholders::_1, std::placeholders::_2));
+                // keep the buffers alive until the write is done
+                [its_server, its_key = _it->first, its_buffers](const boost::system::error_code& _error, std::size_t _bytes) {
+                    its_server->send_cbk(its_key, _error, _bytes);
+                });
     }
 }
 
@@ -466,7 +489,7 @@ bool tcp_server_endpoint_impl::connection::send_magic_cookie(message_buffer_ptr_
 }
 
 bool tcp_server_endpoint_impl::connection::is_magic_cookie(size_t _offset) const {
-    return (0 == std::memcmp(CLIENT_COOKIE, &recv_buffer_[_offset], sizeof(CLIENT_COOKIE)));
+    return (0 == std::memcmp(CLIENT_COOKIE, recv_buffer_.data() + _offset, sizeof(CLIENT_COOKIE)));
 }
 
 void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code const& _error, std::size_t _bytes) {
@@ -483,37 +506,39 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
 
 #if 0
     std::stringstream msg;
-    for (std::size_t i = 0; i < _bytes + recv_buffer_size_; ++i)
+    for (std::size_t i = 0; i < recv_buffer_.size() + _bytes; ++i)
         msg << std::hex << std::setfill('0') << std::setw(2)
-                << static_cast<int>( recv_buffer_[i] << " ";
+                << static_cast<int>(recv_buffer_.data()[i]) << " ";
     VSOMEIP_INFO << msg.str();
 #endif
     std::shared_ptr<routing_host> its_host = its_server->routing_host_.lock();
     if (its_host) {
         if (!_error && 0 < _bytes) {
-            if (recv_buffer_size_ + _bytes < recv_buffer_size_) {
+            if (!recv_buffer_.commit(_bytes)) {
                 VSOMEIP_ERROR << "receive buffer overflow in tcp client endpoint ~> abort!";
                 return;
             }
-            recv_buffer_size_ += _bytes;
+            // Messages are framed in place, the receive buffer drops them once they were parsed
+            const byte_t* its_buffer = recv_buffer_.data();
+            std::size_t its_buffer_size = recv_buffer_.size();
 
             size_t its_iteration_gap = 0;
             bool has_full_message;
             do {
-                uint64_t read_message_size = utility::get_message_size(&recv_buffer_[its_iteration_gap], recv_buffer_size_);
+                uint64_t read_message_size = utility::get_message_size(&its_buffer[its_iteration_gap], its_buffer_size);
                 if (read_message_size > MESSAGE_SIZE_UNLIMITED) {
                     VSOMEIP_ERROR << "Message size exceeds allowed maximum!";
                     return;
                 }
                 uint32_t current_message_size = static_cast<uint32_t>(read_message_size);
-                has_full_message = (current_message_size > VSOMEIP_RETURN_CODE_POS && current_message_size <= recv_buffer_size_);
+                has_full_message = (current_message_size > VSOMEIP_RETURN_CODE_POS && current_message_size <= its_buffer_size);
                 if (has_full_message) {
                     bool needs_forwarding(true);
                     if (is_magic_cookie(its_iteration_gap)) {
                         magic_cookies_enabled_ = true;
                     } else {
                         if (magic_cookies_enabled_) {
-                            uint32_t its_offset = its_server->find_magic_cookie(&recv_buffer_[its_iteration_gap], recv_buffer_size_);
+                            uint32_t its_offset = its_server->find_magic_cookie(&its_buffer[its_iteration_gap], its_buffer_size);
                             if (its_offset < current_message_size) {
                                 {
                                     std::lock_guard<std::mutex> its_lock(socket_mutex_);
@@ -524,8 +549,8 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                                 if (!is_magic_cookie(its_iteration_gap)) {
                                     auto its_endpoint_host = its_server->endpoint_host_.lock();
                                     if (its_endpoint_host) {
-                                        its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap],
-                                                                    static_cast<length_t>(recv_buffer_size_), its_server.get(),
+                                        its_endpoint_host->on_error(&its_buffer[its_iteration_gap],
+                                                                    static_cast<length_t>(its_buffer_size), its_server.get(),
                                                                     remote_address_, remote_port_);
                                     }
                                 }
@@ -535,38 +560,38 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         }
                     }
                     if (needs_forwarding) {
-                        if (utility::is_request(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])) {
+                        if (utility::is_request(its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])) {
                             const client_t its_client =
-                                    bithelper::read_uint16_be(&recv_buffer_[its_iteration_gap + VSOMEIP_CLIENT_POS_MIN]);
+                                    bithelper::read_uint16_be(&its_buffer[its_iteration_gap + VSOMEIP_CLIENT_POS_MIN]);
                             if (its_client != MAGIC_COOKIE_CLIENT) {
                                 const service_t its_service =
-                                        bithelper::read_uint16_be(&recv_buffer_[its_iteration_gap + VSOMEIP_SERVICE_POS_MIN]);
+                                        bithelper::read_uint16_be(&its_buffer[its_iteration_gap + VSOMEIP_SERVICE_POS_MIN]);
                                 const method_t its_method =
-                                        bithelper::read_uint16_be(&recv_buffer_[its_iteration_gap + VSOMEIP_METHOD_POS_MIN]);
+                                        bithelper::read_uint16_be(&its_buffer[its_iteration_gap + VSOMEIP_METHOD_POS_MIN]);
                                 const session_t its_session =
-                                        bithelper::read_uint16_be(&recv_buffer_[its_iteration_gap + VSOMEIP_SESSION_POS_MIN]);
+                                        bithelper::read_uint16_be(&its_buffer[its_iteration_gap + VSOMEIP_SESSION_POS_MIN]);
                                 std::scoped_lock its_clients_lock{its_server->clients_mutex_};
                                 its_server->clients_[to_clients_key(its_service, its_method, its_client)][its_session] = remote_;
                             }
                         }
+                        its_server->count_received(current_message_size);
                         if (!magic_cookies_enabled_) {
-                            its_host->on_message(&recv_buffer_[its_iteration_gap], current_message_size, its_server.get(), false,
+                            its_host->on_message(&its_buffer[its_iteration_gap], current_message_size, its_server.get(), false,
                                                  VSOMEIP_ROUTING_CLIENT, nullptr, remote_address_, remote_port_);
                         } else {
                             // Only call on_message without a magic cookie in front of the buffer!
                             if (!is_magic_cookie(its_iteration_gap)) {
-                                its_host->on_message(&recv_buffer_[its_iteration_gap], current_message_size, its_server.get(), false,
+                                its_host->on_message(&its_buffer[its_iteration_gap], current_message_size, its_server.get(), false,
                                                      VSOMEIP_ROUTING_CLIENT, nullptr, remote_address_, remote_port_);
                             }
                         }
                     }
-                    calculate_shrink_count();
                     missing_capacity_ = 0;
-                    recv_buffer_size_ -= current_message_size;
+                    its_buffer_size -= current_message_size;
                     its_iteration_gap += current_message_size;
-                } else if (magic_cookies_enabled_ && recv_buffer_size_ > 0) {
-                    uint32_t its_offset = its_server->find_magic_cookie(&recv_buffer_[its_iteration_gap], recv_buffer_size_);
-                    if (its_offset < recv_buffer_size_) {
+                } else if (magic_cookies_enabled_ && its_buffer_size > 0) {
+                    uint32_t its_offset = its_server->find_magic_cookie(&its_buffer[its_iteration_gap], its_buffer_size);
+                    if (its_offset < its_buffer_size) {
                         {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "Detected Magic Cookie within message data. Resyncing."
@@ -575,17 +600,17 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         if (!is_magic_cookie(its_iteration_gap)) {
                             auto its_endpoint_host = its_server->endpoint_host_.lock();
                             if (its_endpoint_host) {
-                                its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap], static_cast<length_t>(recv_buffer_size_),
+                                its_endpoint_host->on_error(&its_buffer[its_iteration_gap], static_cast<length_t>(its_buffer_size),
                                                             its_server.get(), remote_address_, remote_port_);
                             }
                         }
-                        recv_buffer_size_ -= its_offset;
+                        its_buffer_size -= its_offset;
                         its_iteration_gap += its_offset;
                         has_full_message = true; // trigger next loop
                         if (!is_magic_cookie(its_iteration_gap)) {
                             auto its_endpoint_host = its_server->endpoint_host_.lock();
                             if (its_endpoint_host) {
-                                its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap], static_cast<length_t>(recv_buffer_size_),
+                                its_endpoint_host->on_error(&its_buffer[its_iteration_gap], static_cast<length_t>(its_buffer_size),
                                                             its_server.get(), remote_address_, remote_port_);
                             }
                         }
@@ -593,37 +618,37 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                 }
 
                 if (!has_full_message) {
-                    if (recv_buffer_size_ > VSOMEIP_RETURN_CODE_POS
-                        && (recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION
+                    if (its_buffer_size > VSOMEIP_RETURN_CODE_POS
+                        && (its_buffer[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION
                             || !utility::is_valid_message_type(
-                                    static_cast<message_type_e>(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))
+                                    static_cast<message_type_e>(its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))
                             || !utility::is_valid_return_code(
-                                    static_cast<return_code_e>(recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])))) {
-                        if (recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION) {
+                                    static_cast<return_code_e>(its_buffer[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])))) {
+                        if (its_buffer[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION) {
                             {
                                 std::lock_guard<std::mutex> its_lock(socket_mutex_);
                                 VSOMEIP_ERROR << "tse: Wrong protocol version: 0x" << std::hex << std::setfill('0') << std::setw(2)
-                                              << std::uint32_t(recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS])
+                                              << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS])
                                               << " local: " << get_address_port_local() << " remote: " << get_address_port_remote()
                                               << ". Closing connection due to missing/broken data TCP "
                                                  "stream.";
                             }
                             // ensure to send back a error message w/ wrong protocol version
-                            its_host->on_message(&recv_buffer_[its_iteration_gap], VSOMEIP_SOMEIP_HEADER_SIZE + 8, its_server.get(), false,
+                            its_host->on_message(&its_buffer[its_iteration_gap], VSOMEIP_SOMEIP_HEADER_SIZE + 8, its_server.get(), false,
                                                  VSOMEIP_ROUTING_CLIENT, nullptr, remote_address_, remote_port_);
                         } else if (!utility::is_valid_message_type(
-                                           static_cast<message_type_e>(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))) {
+                                           static_cast<message_type_e>(its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))) {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "tse: Invalid message type: 0x" << std::hex << std::setfill('0') << std::setw(2)
-                                          << std::uint32_t(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])
+                                          << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])
                                           << " local: " << get_address_port_local() << " remote: " << get_address_port_remote()
                                           << ". Closing connection due to missing/broken data TCP "
                                              "stream.";
                         } else if (!utility::is_valid_return_code(
-                                           static_cast<return_code_e>(recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))) {
+                                           static_cast<return_code_e>(its_buffer[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))) {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "tse: Invalid return code: 0x" << std::hex << std::setfill('0') << std::setw(2)
-                                          << std::uint32_t(recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])
+                                          << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])
                                           << " local: " << get_address_port_local() << " remote: " << get_address_port_remote()
                                           << ". Closing connection due to missing/broken data TCP "
                                              "stream.";
@@ -631,9 +656,9 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         wait_until_sent(boost::asio::error::operation_aborted);
                         return;
                     } else if (max_message_size_ != MESSAGE_SIZE_UNLIMITED && current_message_size > max_message_size_) {
-                        recv_buffer_size_ = 0;
-                        recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                        recv_buffer_.shrink_to_fit();
+                        its_buffer_size = 0;
+                        its_iteration_gap = 0;
+                        recv_buffer_.clear();
                         if (magic_cookies_enabled_) {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "Received a TCP message which exceeds "
@@ -653,16 +678,16 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                             wait_until_sent(boost::asio::error::operation_aborted);
                             return;
                         }
-                    } else if (current_message_size > recv_buffer_size_) {
-                        missing_capacity_ = current_message_size - static_cast<std::uint32_t>(recv_buffer_size_);
-                    } else if (VSOMEIP_SOMEIP_HEADER_SIZE > recv_buffer_size_) {
-                        missing_capacity_ = VSOMEIP_SOMEIP_HEADER_SIZE - static_cast<std::uint32_t>(recv_buffer_size_);
-                    } else if (magic_cookies_enabled_ && recv_buffer_size_ > 0) {
+                    } else if (current_message_size > its_buffer_size) {
+                        missing_capacity_ = current_message_size - static_cast<std::uint32_t>(its_buffer_size);
+                    } else if (VSOMEIP_SOMEIP_HEADER_SIZE > its_buffer_size) {
+                        missing_capacity_ = VSOMEIP_SOMEIP_HEADER_SIZE - static_cast<std::uint32_t>(its_buffer_size);
+                    } else if (magic_cookies_enabled_ && its_buffer_size > 0) {
                         // no need to check for magic cookie here again: has_full_message
                         // would have been set to true if there was one present in the data
-                        recv_buffer_size_ = 0;
-                        recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                        recv_buffer_.shrink_to_fit();
+                        its_buffer_size = 0;
+                        its_iteration_gap = 0;
+                        recv_buffer_.clear();
                         missing_capacity_ = 0;
                         std::lock_guard<std::mutex> its_lock(socket_mutex_);
                         VSOMEIP_ERROR << "Didn't find magic cookie in broken"
@@ -671,7 +696,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                     } else {
                         {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
-                            VSOMEIP_ERROR << "tse::c<" << this << ">rcb: recv_buffer_size is: " << std::dec << recv_buffer_size_
+                            VSOMEIP_ERROR << "tse::c<" << this << ">rcb: recv_buffer_size is: " << std::dec << its_buffer_size
                                           << " but couldn't read "
                                              "out message_size. recv_buffer_capacity: "
                                           << recv_buffer_.capacity() << " its_iteration_gap: " << its_iteration_gap
@@ -683,17 +708,8 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
                         return;
                     }
                 }
-            } while (has_full_message && recv_buffer_size_);
-            if (its_iteration_gap) {
-                // Copy incomplete message to front for next receive_cbk iteration
-                for (size_t i = 0; i < recv_buffer_size_; ++i) {
-                    recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
-                }
-                // Still more capacity needed after shifting everything to front?
-                if (missing_capacity_ && missing_capacity_ <= recv_buffer_.capacity() - recv_buffer_size_) {
-                    missing_capacity_ = 0;
-                }
-            }
+            } while (has_full_message && its_buffer_size);
+            recv_buffer_.consume(its_iteration_gap);
             receive();
         }
     }
@@ -707,18 +723,6 @@ void tcp_server_endpoint_impl::connection::receive_cbk(boost::system::error_code
     }
 }
 
-void tcp_server_endpoint_impl::connection::calculate_shrink_count() {
-    if (buffer_shrink_threshold_) {
-        if (recv_buffer_.capacity() != recv_buffer_size_initial_) {
-            if (recv_buffer_size_ < (recv_buffer_.capacity() >> 1)) {
-                shrink_count_++;
-            } else {
-                shrink_count_ = 0;
-            }
-        }
-    }
-}
-
 void tcp_server_endpoint_impl::connection::set_remote_info(const endpoint_type& _remote) {
     remote_ = _remote;
     remote_address_ = _remote.address();
@@ -755,13 +759,13 @@ void tcp_server_endpoint_impl::connection::handle_recv_buffer_exception(const st
                 << " remote: " << get_address_port_remote() << " shutting down connection. Start of buffer: " << std::hex
                 << std::setfill('0');
 
-    for (std::size_t i = 0; i < recv_buffer_size_ && i < 16; i++) {
-        its_message << std::setw(2) << static_cast<int>(recv_buffer_[i]) << " ";
+    for (std::size_t i = 0; i < recv_buffer_.size() && i < 16; i++) {
+        its_message << std::setw(2) << static_cast<int>(recv_buffer_.data()[i]) << " ";
     }
 
     its_message << " Last 16 Bytes captured: ";
-    for (int i = 15; recv_buffer_size_ > 15 && i >= 0; i--) {
-        its_message << std::setw(2) << static_cast<int>(recv_buffer_[static_cast<size_t>(i)]) << " ";
+    for (int i = 15; recv_buffer_.size() > 15 && i >= 0; i--) {
+        its_message << std::setw(2) << static_cast<int>(recv_buffer_.data()[static_cast<size_t>(i)]) << " ";
     }
     VSOMEIP_ERROR << its_message.str();
     recv_buffer_.clear();
@@ -776,6 +780,10 @@ void tcp_server_endpoint_impl::connection::handle_recv_buffer_exception(const st
     }
 }
 
+double tcp_server_endpoint_impl::connection::get_writes_per_message() const {
+    return (written_buffers_ ? static_cast<double>(writes_) / static_cast<double>(written_buffers_) : 0.0);
+}
+
 std::size_t tcp_server_endpoint_impl::connection::get_recv_buffer_capacity() const {
     return recv_buffer_.capacity();
 }
@@ -835,7 +843,7 @@ void tcp_server_endpoint_impl::receive() {
 }
 
 void tcp_server_endpoint_impl::print_status() {
-    std::lock_guard<std::mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     connections_t its_connections;
     {
         std::lock_guard<std::mutex> its_lock_inner(connections_mutex_);
@@ -858,7 +866,8 @@ void tcp_server_endpoint_impl::print_status() {
             its_data_size = found_queue->second.queue_size_;
         }
         VSOMEIP_INFO << "status tse: client: " << c.second->get_address_port_remote() << " queue: " << std::dec << its_queue_size
-                     << " data: " << std::dec << its_data_size << " recv_buffer: " << std::dec << its_recv_size;
+                     << " data: " << std::dec << its_data_size << " recv_buffer: " << std::dec << its_recv_size << " writes per message: "
+                     << std::fixed << std::setprecision(2) << c.second->get_writes_per_message();
     }
 }
 
@@ -875,7 +884,7 @@ void tcp_server_endpoint_impl::connection::wait_until_sent(const boost::system::
     if (!its_server)
         return;
 
-    std::lock_guard<std::mutex> its_lock(its_server->mutex_);
+    std::scoped_lock its_lock(its_server->mutex_);
 
     auto it = its_server->targets_.find(remote_);
     if (it != its_server->targets_.end()) {
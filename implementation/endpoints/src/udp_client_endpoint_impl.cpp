@@ -12,12 +12,15 @@
 
 #include <vsomeip/internal/logger.hpp>
 
+#include "../include/abstract_socket_factory.hpp"
 #include "../include/endpoint_host.hpp"
+#include "../include/socket_timestamping.hpp"
 #include "../include/tp.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/udp_client_endpoint_impl.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/low_latency_io.hpp"
 
 namespace vsomeip_v3 {
 
@@ -27,7 +30,8 @@ udp_client_endpoint_impl::udp_client_endpoint_impl(const std::shared_ptr<endpoin
                                                    const std::shared_ptr<configuration>& _configuration) :
     udp_client_endpoint_base_impl(_endpoint_host, _routing_host, _local, _remote, _io, _configuration), remote_address_(_remote.address()),
     remote_port_(_remote.port()), udp_receive_buffer_size_(_configuration->get_udp_receive_buffer_size()),
-    tp_reassembler_(std::make_shared<tp::tp_reassembler>(_configuration->get_max_message_size_unreliable(), _io)) {
+    tp_reassembler_(std::make_shared<tp::tp_reassembler>(_configuration->get_max_message_size_unreliable(), _io)),
+    receiver_(abstract_socket_factory::get()->create_udp_receiver(_io)) {
     is_supporting_someip_tp_ = true;
 
     this->max_message_size_ = VSOMEIP_MAX_UDP_MESSAGE_SIZE;
@@ -81,7 +85,12 @@ void udp_client_endpoint_impl::connect() {
             }
             socket_->get_option(its_option, its_error);
         }
+
+        low_latency_io::apply(io_, socket_->native_handle());
 #endif
+        if (configuration_->is_socket_timestamping_enabled()) {
+            std::ignore = socket_timestamping::enable(socket_->native_handle());
+        }
         if (its_error) {
             VSOMEIP_WARNING << "udp_client_endpoint_impl::connect: couldn't get "
                             << "SO_RCVBUF: " << its_error.message() << " local port:" << std::dec << local_.port()
@@ -165,8 +174,8 @@ void udp_client_endpoint_impl::restart(bool _force) {
         return;
     }
     {
-        std::lock_guard<std::recursive_mutex> its_lock(mutex_);
-        queue_.clear();
+        std::scoped_lock its_lock(mutex_);
+        drop_queue();
     }
     std::string local;
     {
@@ -216,23 +225,46 @@ void udp_client_endpoint_impl::send_queued(std::pair<message_buffer_ptr_t, uint3
     }
 }
 
-void udp_client_endpoint_impl::get_configured_times_from_endpoint(service_t _service, method_t _method,
-                                                                  std::chrono::nanoseconds* _debouncing,
-                                                                  std::chrono::nanoseconds* _maximum_retention) const {
-    configuration_->get_configured_timing_requests(_service, remote_address_.to_string(), remote_port_, _method, _debouncing,
-                                                   _maximum_retention);
-}
-
 void udp_client_endpoint_impl::receive() {
     std::lock_guard<std::mutex> its_lock(socket_mutex_);
     if (!socket_->is_open()) {
         return;
     }
     message_buffer_ptr_t its_buffer = std::make_shared<message_buffer_t>(VSOMEIP_MAX_UDP_MESSAGE_SIZE);
-    socket_->async_receive_from(boost::asio::buffer(*its_buffer), const_cast<endpoint_type&>(remote_),
-                                strand_.wrap(std::bind(&udp_client_endpoint_impl::receive_cbk,
-                                                       std::dynamic_pointer_cast<udp_client_endpoint_impl>(shared_from_this()),
-                                                       std::placeholders::_1, std::placeholders::_2, its_buffer)));
+    auto its_self = std::dynamic_pointer_cast<udp_client_endpoint_impl>(shared_from_this());
+    if (receiver_) {
+        receiver_->async_receive(*socket_, boost::asio::buffer(*its_buffer),
+                                 [its_self, its_buffer](boost::system::error_code const& _error, std::size_t _bytes, const endpoint_type&,
+                                                        const boost::asio::ip::address&) {
+                                     its_self->strand_.dispatch(
+                                             [its_self, its_buffer, _error, _bytes, its_time = receive_timestamp::get_socket_time()]() {
+                                                 const receive_timestamp::socket_scope its_scope(its_time);
+                                                 its_self->receive_cbk(_error, _bytes, its_buffer);
+                                             });
+                                 });
+    } else if (configuration_->is_socket_timestamping_enabled()) {
+        // The socket lives as long as the endpoint. The receive time is taken
+        // along, as the strand may defer the handler.
+        socket_timestamping::async_receive_from(
+                std::shared_ptr<socket_type>(its_self, socket_.get()), boost::asio::buffer(*its_buffer), const_cast<endpoint_type&>(remote_),
+                [its_self, its_buffer](boost::system::error_code const& _error, std::size_t _bytes) {
+                    its_self->strand_.dispatch([its_self, its_buffer, _error, _bytes, its_time = receive_timestamp::get_socket_time()]() {
+                        const receive_timestamp::socket_scope its_scope(its_time);
+                        its_self->receive_cbk(_error, _bytes, its_buffer);
+                    });
+                });
+    } else {
+        socket_->async_receive_from(boost::asio::buffer(*its_buffer), const_cast<endpoint_type&>(remote_),
+                                    strand_.wrap([its_self, its_buffer](boost::system::error_code const& _error, std::size_t _bytes) {
+                                        its_self->receive_cbk(_error, _bytes, its_buffer);
+                                    }));
+    }
+}
+
+void udp_client_endpoint_impl::cancel_receive_unlocked() {
+    if (receiver_) {
+        receiver_->cancel();
+    }
 }
 
 bool udp_client_endpoint_impl::get_remote_address(boost::asio::ip::address& _address) const {
@@ -354,10 +386,12 @@ void udp_client_endpoint_impl::receive_cbk(boost::system::error_code const& _err
                     const auto res =
                             tp_reassembler_->process_tp_message(&(*_recv_buffer)[i], current_message_size, remote_address_, remote_port_);
                     if (res.first) {
+                        count_received(static_cast<std::uint32_t>(res.second.size()));
                         its_host->on_message(&res.second[0], static_cast<std::uint32_t>(res.second.size()), this, false,
                                              VSOMEIP_ROUTING_CLIENT, nullptr, remote_address_, remote_port_);
                     }
                 } else {
+                    count_received(current_message_size);
                     its_host->on_message(&(*_recv_buffer)[i], current_message_size, this, false, VSOMEIP_ROUTING_CLIENT, nullptr,
                                          remote_address_, remote_port_);
                 }
@@ -418,7 +452,7 @@ void udp_client_endpoint_impl::print_status() {
     std::size_t its_data_size(0);
     std::size_t its_queue_size(0);
     {
-        std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         its_queue_size = queue_.size();
         its_data_size = queue_size_;
     }
@@ -440,8 +474,9 @@ void udp_client_endpoint_impl::send_cbk(boost::system::error_code const& _error,
                                         const message_buffer_ptr_t& _sent_msg) {
     (void)_bytes;
     if (!_error) {
-        std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+        std::scoped_lock its_lock(mutex_);
         if (queue_.size() > 0) {
+            count_sent(*queue_.front().first);
             queue_size_ -= queue_.front().first->size();
             queue_.pop_front();
 
@@ -461,11 +496,10 @@ void udp_client_endpoint_impl::send_cbk(boost::system::error_code const& _error,
         state_ = cei_state_e::CLOSED;
         bool stopping(false);
         {
-            std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+            std::scoped_lock its_lock(mutex_);
             stopping = sending_blocked_;
             if (stopping) {
-                queue_.clear();
-                queue_size_ = 0;
+                drop_queue();
             } else {
                 service_t its_service(0);
                 method_t its_method(0);
@@ -495,9 +529,8 @@ void udp_client_endpoint_impl::send_cbk(boost::system::error_code const& _error,
         if (_error == boost::asio::error::no_permission) {
             VSOMEIP_WARNING << "uce::send_cbk received error: " << _error.message() << " (" << std::dec << _error.value() << ") "
                             << get_remote_information();
-            std::lock_guard<std::recursive_mutex> its_lock(mutex_);
-            queue_.clear();
-            queue_size_ = 0;
+            std::scoped_lock its_lock(mutex_);
+            drop_queue();
         }
         was_not_connected_ = true;
         shutdown_and_close_socket(true);
@@ -541,7 +574,7 @@ void udp_client_endpoint_impl::send_cbk(boost::system::error_code const& _error,
         print_status();
     }
 
-    std::lock_guard<std::recursive_mutex> its_lock(mutex_);
+    std::scoped_lock its_lock(mutex_);
     is_sending_ = false;
 }
 
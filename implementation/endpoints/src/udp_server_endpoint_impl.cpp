@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <thread>
@@ -11,11 +12,17 @@
 #include <boost/asio/ip/network_v4.hpp>
 #include <boost/asio/ip/network_v6.hpp>
 
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
 #include <vsomeip/constants.hpp>
 #include <vsomeip/internal/logger.hpp>
 
+#include "../include/abstract_socket_factory.hpp"
 #include "../include/endpoint_definition.hpp"
 #include "../include/endpoint_host.hpp"
+#include "../include/socket_timestamping.hpp"
 #include "../include/tp.hpp"
 #include "../include/udp_server_endpoint_impl.hpp"
 #include "../include/udp_server_endpoint_impl_receive_op.hpp"
@@ -23,21 +30,51 @@
 #include "../../routing/include/routing_host.hpp"
 #include "../../service_discovery/include/defines.hpp"
 #include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/io_shards.hpp"
+#include "../../utility/include/low_latency_io.hpp"
 #include "../../utility/include/utility.hpp"
 
 namespace ip = boost::asio::ip;
 
 namespace vsomeip_v3 {
 
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+namespace {
+// Classic BPF program that selects the receive socket of a SO_REUSEPORT
+// group by the source IP address of the datagram.
+bool attach_steering_program(int _fd, bool _is_v4, std::uint32_t _count) {
+    std::vector<sock_filter> its_code;
+    if (_is_v4) {
+        its_code.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, static_cast<__u32>(SKF_NET_OFF + 12)));
+    } else {
+        // XOR of the four words of the IPv6 source address
+        its_code.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, static_cast<__u32>(SKF_NET_OFF + 8)));
+        for (int its_offset = 12; its_offset < 24; its_offset += 4) {
+            its_code.push_back(BPF_STMT(BPF_MISC | BPF_TAX, 0));
+            its_code.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, static_cast<__u32>(SKF_NET_OFF + its_offset)));
+            its_code.push_back(BPF_STMT(BPF_ALU | BPF_XOR | BPF_X, 0));
+        }
+    }
+    its_code.push_back(BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, _count));
+    its_code.push_back(BPF_STMT(BPF_RET | BPF_A, 0));
+
+    sock_fprog its_program{static_cast<unsigned short>(its_code.size()), its_code.data()};
+    return setsockopt(_fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &its_program, sizeof(its_program)) == 0;
+}
+} // namespace
+#endif
+
 udp_server_endpoint_impl::udp_server_endpoint_impl(const std::shared_ptr<endpoint_host>& _endpoint_host,
                                                    const std::shared_ptr<routing_host>& _routing_host, boost::asio::io_context& _io,
                                                    const std::shared_ptr<configuration>& _configuration) :
     server_endpoint_impl<ip::udp>(_endpoint_host, _routing_host, _io, _configuration),
-    unicast_recv_buffer_(VSOMEIP_MAX_UDP_MESSAGE_SIZE, 0), lifecycle_idx_(0), netmask_(_configuration->get_netmask()),
+    unicast_recv_buffer_(VSOMEIP_MAX_UDP_MESSAGE_SIZE, 0), unicast_receiver_(abstract_socket_factory::get()->create_udp_receiver(_io)),
+    multicast_receiver_(abstract_socket_factory::get()->create_udp_receiver(_io)), lifecycle_idx_(0), netmask_(_configuration->get_netmask()),
     prefix_(_configuration->get_prefix()),
     tp_reassembler_(std::make_shared<tp::tp_reassembler>(_configuration->get_max_message_size_unreliable(), _io)), tp_cleanup_timer_(_io) {
     is_supporting_someip_tp_ = true;
     max_message_size_ = VSOMEIP_MAX_UDP_MESSAGE_SIZE;
+    is_timestamping_ = _configuration->is_socket_timestamping_enabled();
 
     static std::atomic<unsigned> instance_count = 0;
     instance_name_ = "usei#" + std::to_string(++instance_count) + "::";
@@ -55,6 +92,8 @@ bool udp_server_endpoint_impl::is_local() const {
 
 void udp_server_endpoint_impl::init(const endpoint_type& _local, boost::system::error_code& _error) {
     VSOMEIP_INFO << instance_name_ << "init: " << _local.address() << ":" << _local.port() << ", lifecycle_idx=" << lifecycle_idx_.load();
+    // Before taking sync_, as sending locks it while holding mutex_
+    set_npdu_timings(configuration_->get_npdu_timings_responses(_local.address().to_string(), _local.port()));
     std::scoped_lock its_lock(sync_);
     init_unlocked(_local, _error);
     VSOMEIP_INFO << instance_name_ << "init: lifecycle_idx=" << lifecycle_idx_.load() << ", " << _error.message();
@@ -70,7 +109,11 @@ void udp_server_endpoint_impl::init_unlocked(const endpoint_type& _local, boost:
         }
 
         VSOMEIP_WARNING << instance_name_ << "init_unlocked: reset unicast socket, lifecycle_idx=" << lifecycle_idx_.load();
+        if (unicast_receiver_) {
+            unicast_receiver_->cancel();
+        }
         unicast_socket_.reset();
+        close_receive_sockets_unlocked();
     }
 
     unicast_socket_ = std::make_shared<socket_type>(io_, _local.protocol());
@@ -111,6 +154,14 @@ void udp_server_endpoint_impl::init_unlocked(const endpoint_type& _local, boost:
     }
 #endif
 
+    std::uint32_t its_socket_count(configuration_->get_udp_receive_socket_count(_local.port()));
+    if (its_socket_count > 1 && !set_reuse_port(*unicast_socket_, _error)) {
+        VSOMEIP_ERROR << instance_name_ << "init_unlocked: failed to configure reuse port, " << _error.message();
+        // Non-fatal error, the unicast socket receives alone
+        its_socket_count = 1;
+        _error.clear();
+    }
+
     std::ignore = unicast_socket_->bind(_local, _error);
     if (_error) {
         VSOMEIP_ERROR << instance_name_ << "init_unlocked: failed to bind, " << _error.message();
@@ -173,7 +224,16 @@ void udp_server_endpoint_impl::init_unlocked(const endpoint_type& _local, boost:
             _error.clear();
         }
     }
+
+    low_latency_io::apply(io_, unicast_socket_->native_handle());
 #endif
+    if (is_timestamping_) {
+        is_timestamping_ = socket_timestamping::enable(unicast_socket_->native_handle());
+    }
+
+    if (its_socket_count > 1) {
+        open_receive_sockets_unlocked(_local, its_socket_count);
+    }
 
     if (local_ != _local || local_port_ != _local.port()) {
         instance_name_ += _local.address().to_string();
@@ -188,6 +248,101 @@ void udp_server_endpoint_impl::init_unlocked(const endpoint_type& _local, boost:
     }
 }
 
+udp_server_endpoint_impl::receive_socket_t::receive_socket_t(boost::asio::io_context& _io) :
+    socket_(_io), buffer_(VSOMEIP_MAX_UDP_MESSAGE_SIZE, 0), receiver_(abstract_socket_factory::get()->create_udp_receiver(_io)) { }
+
+bool udp_server_endpoint_impl::set_reuse_port(socket_type& _socket, boost::system::error_code& _error) const {
+#ifdef __linux__
+    const int its_reuse_port(1);
+    if (setsockopt(_socket.native_handle(), SOL_SOCKET, SO_REUSEPORT, &its_reuse_port, sizeof(its_reuse_port)) == -1) {
+        _error.assign(errno, boost::system::generic_category());
+        return false;
+    }
+    return true;
+#else
+    std::ignore = _socket;
+    _error = boost::asio::error::operation_not_supported;
+    return false;
+#endif
+}
+
+void udp_server_endpoint_impl::open_receive_sockets_unlocked(const endpoint_type& _local, std::uint32_t _count) {
+    // The caller must hold the lock
+
+    const int its_udp_recv_buffer_size = configuration_->get_udp_receive_buffer_size();
+    for (std::uint32_t i = 1; i < _count; ++i) {
+        // Each receive loop runs on its own io thread if the application shards its io_context
+        auto its_socket = std::make_shared<receive_socket_t>(io_shards::select(io_, std::size_t(_local.port()) + i));
+
+        boost::system::error_code its_error;
+        std::ignore = its_socket->socket_.open(_local.protocol(), its_error);
+        if (!its_error) {
+            std::ignore = its_socket->socket_.set_option(boost::asio::socket_base::reuse_address(true), its_error);
+        }
+        if (!its_error) {
+            std::ignore = set_reuse_port(its_socket->socket_, its_error);
+        }
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+        if (!its_error) {
+            std::string its_device(configuration_->get_device());
+            if (!its_device.empty()) {
+                std::ignore = setsockopt(its_socket->socket_.native_handle(), SOL_SOCKET, SO_BINDTODEVICE, its_device.c_str(),
+                                         static_cast<socklen_t>(its_device.size()));
+            }
+        }
+#endif
+        if (!its_error) {
+            boost::system::error_code its_option_error;
+            std::ignore = its_socket->socket_.set_option(boost::asio::socket_base::receive_buffer_size(its_udp_recv_buffer_size),
+                                                         its_option_error);
+            std::ignore = its_socket->socket_.bind(_local, its_error);
+        }
+#ifdef __linux__
+        if (!its_error) {
+            low_latency_io::apply(io_, its_socket->socket_.native_handle());
+        }
+#endif
+        if (!its_error && is_timestamping_) {
+            is_timestamping_ = socket_timestamping::enable(its_socket->socket_.native_handle());
+        }
+        if (its_error) {
+            VSOMEIP_ERROR << instance_name_ << "open_receive_sockets_unlocked: failed to open receive socket " << i << ", "
+                          << its_error.message();
+            break;
+        }
+        receive_sockets_.push_back(its_socket);
+    }
+
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    if (!receive_sockets_.empty() && configuration_->is_udp_receive_steered_by_address(_local.port())) {
+        // The program applies to the whole group, the sockets are selected in the order they were bound
+        if (!attach_steering_program(unicast_socket_->native_handle(), _local.address().is_v4(),
+                                     static_cast<std::uint32_t>(receive_sockets_.size() + 1))) {
+            VSOMEIP_WARNING << instance_name_ << "open_receive_sockets_unlocked: failed to attach steering program, "
+                            << std::strerror(errno);
+        }
+    }
+#endif
+
+    VSOMEIP_INFO << instance_name_ << "open_receive_sockets_unlocked: receiving on " << receive_sockets_.size() + 1 << " sockets";
+}
+
+void udp_server_endpoint_impl::close_receive_sockets_unlocked() {
+    // The caller must hold the lock
+
+    // The pending receives own their sockets. Closing aborts them, so the
+    // sockets leave the SO_REUSEPORT group of the port before it is bound again.
+    for (const auto& its_socket : receive_sockets_) {
+        boost::system::error_code its_error;
+        if (its_socket->receiver_) {
+            its_socket->receiver_->cancel();
+        }
+        std::ignore = its_socket->socket_.cancel(its_error);
+        std::ignore = its_socket->socket_.close(its_error);
+    }
+    receive_sockets_.clear();
+}
+
 void udp_server_endpoint_impl::receive() { }
 
 void udp_server_endpoint_impl::start() {
@@ -243,6 +398,9 @@ void udp_server_endpoint_impl::start_unlocked() {
 
     VSOMEIP_INFO << instance_name_ << "start_unlocked: start unicast data handler, lifecycle_idx=" << lifecycle_idx_.load();
     receive_unicast_unlocked();
+    for (const auto& its_socket : receive_sockets_) {
+        receive_socket_unlocked(its_socket);
+    }
 
     if (!multicast_socket_) {
         VSOMEIP_INFO << instance_name_ << "start_unlocked: join " << joined_.size() << " groups";
@@ -274,7 +432,14 @@ void udp_server_endpoint_impl::stop_unlocked() {
     is_stopped_ = true;
 
     server_endpoint_impl::stop();
+    if (unicast_receiver_) {
+        unicast_receiver_->cancel();
+    }
     unicast_socket_.reset();
+    close_receive_sockets_unlocked();
+    if (multicast_receiver_) {
+        multicast_receiver_->cancel();
+    }
     multicast_socket_.reset();
     tp_reassembler_->stop();
 }
@@ -288,38 +453,101 @@ void udp_server_endpoint_impl::receive_unicast_unlocked() {
     // The caller must hold the lock
 
     if (unicast_socket_ && unicast_socket_->is_open()) {
-        unicast_socket_->async_receive_from(
-                boost::asio::buffer(&unicast_recv_buffer_[0], max_message_size_), unicast_remote_,
-                [self = shared_ptr(), lifecycle_idx = lifecycle_idx_.load()](boost::system::error_code const& _error, std::size_t _bytes) {
-                    if (lifecycle_idx == self->lifecycle_idx_.load() && _error != boost::asio::error::eof
-                        && _error != boost::asio::error::connection_reset && _error != boost::asio::error::operation_aborted) {
-                        self->on_unicast_received(_error, _bytes);
-                        std::scoped_lock its_lock(self->sync_);
-                        self->receive_unicast_unlocked();
-                    } else {
-                        VSOMEIP_WARNING << self->instance_name_
-                                        << "receive_unicast_unlocked: stop data handler, lifecycle_idx=" << lifecycle_idx << " vs "
-                                        << self->lifecycle_idx_.load() << ", " << _error.message() << ", stopped=" << self->is_stopped_;
-                    }
-                });
+        auto its_handler = [self = shared_ptr(), lifecycle_idx = lifecycle_idx_.load()](boost::system::error_code const& _error,
+                                                                                         std::size_t _bytes) {
+            if (lifecycle_idx == self->lifecycle_idx_.load() && _error != boost::asio::error::eof
+                && _error != boost::asio::error::connection_reset && _error != boost::asio::error::operation_aborted) {
+                self->on_unicast_received(_error, _bytes);
+                std::scoped_lock its_lock(self->sync_);
+                self->receive_unicast_unlocked();
+            } else {
+                VSOMEIP_WARNING << self->instance_name_ << "receive_unicast_unlocked: stop data handler, lifecycle_idx=" << lifecycle_idx
+                                << " vs " << self->lifecycle_idx_.load() << ", " << _error.message() << ", stopped=" << self->is_stopped_;
+            }
+        };
+        const auto its_buffer = boost::asio::buffer(&unicast_recv_buffer_[0], max_message_size_);
+        if (unicast_receiver_) {
+            unicast_receiver_->async_receive(*unicast_socket_, its_buffer,
+                                             [self = shared_ptr(), its_handler](boost::system::error_code const& _error, std::size_t _bytes,
+                                                                                const endpoint_type& _sender, const boost::asio::ip::address&) {
+                                                 self->unicast_remote_ = _sender;
+                                                 its_handler(_error, _bytes);
+                                             });
+        } else if (is_timestamping_) {
+            socket_timestamping::async_receive_from(unicast_socket_, its_buffer, unicast_remote_, std::move(its_handler));
+        } else {
+            unicast_socket_->async_receive_from(its_buffer, unicast_remote_, std::move(its_handler));
+        }
     } else {
         VSOMEIP_WARNING << instance_name_ << "receive_unicast_unlocked: stop data handler, stopped=" << is_stopped_
                         << ", lifecycle_idx=" << lifecycle_idx_.load();
     }
 }
 
+void udp_server_endpoint_impl::receive_socket_unlocked(const std::shared_ptr<receive_socket_t>& _socket) {
+    // The caller must hold the lock
+
+    if (_socket->socket_.is_open()) {
+        auto its_handler = [self = shared_ptr(), _socket, lifecycle_idx = lifecycle_idx_.load()](boost::system::error_code const& _error,
+                                                                                                 std::size_t _bytes) {
+            if (lifecycle_idx == self->lifecycle_idx_.load() && _error != boost::asio::error::eof
+                && _error != boost::asio::error::connection_reset && _error != boost::asio::error::operation_aborted) {
+                if (_error) {
+                    VSOMEIP_ERROR << self->instance_name_ << "receive_socket_unlocked: " << _error.message();
+                } else {
+                    self->on_message_received_unlocked(_error, _bytes, false, _socket->remote_, _socket->buffer_);
+                }
+                std::scoped_lock its_lock(self->sync_);
+                self->receive_socket_unlocked(_socket);
+            }
+        };
+        const auto its_buffer = boost::asio::buffer(&_socket->buffer_[0], max_message_size_);
+        if (_socket->receiver_) {
+            _socket->receiver_->async_receive(_socket->socket_, its_buffer,
+                                              [_socket, its_handler](boost::system::error_code const& _error, std::size_t _bytes,
+                                                                     const endpoint_type& _sender, const boost::asio::ip::address&) {
+                                                  _socket->remote_ = _sender;
+                                                  its_handler(_error, _bytes);
+                                              });
+        } else if (is_timestamping_) {
+            socket_timestamping::async_receive_from(std::shared_ptr<socket_type>(_socket, &_socket->socket_), its_buffer, _socket->remote_,
+                                                    std::move(its_handler));
+        } else {
+            _socket->socket_.async_receive_from(its_buffer, _socket->remote_, std::move(its_handler));
+        }
+    }
+}
+
 //
 // receive_multicast_unlocked is called with sync_ being hold
 //
 void udp_server_endpoint_impl::receive_multicast_unlocked() {
     // The caller must hold the lock
 
-    if (multicast_socket_ && multicast_socket_->is_open()) {
+    if (multicast_socket_ && multicast_socket_->is_open() && multicast_receiver_) {
+        multicast_receiver_->async_receive(
+                *multicast_socket_, boost::asio::buffer(&multicast_recv_buffer_[0], max_message_size_),
+                [self = shared_ptr(), lifecycle_idx = lifecycle_idx_.load()](boost::system::error_code const& _error, std::size_t _bytes,
+                                                                             const endpoint_type& _sender,
+                                                                             const boost::asio::ip::address& _destination) {
+                    if (lifecycle_idx == self->lifecycle_idx_.load() && _error != boost::asio::error::eof
+                        && _error != boost::asio::error::connection_reset && _error != boost::asio::error::operation_aborted) {
+                        self->on_multicast_received(_error, _bytes, _sender, _destination);
+                        std::scoped_lock its_lock(self->sync_);
+                        self->receive_multicast_unlocked();
+                    } else {
+                        VSOMEIP_WARNING << self->instance_name_
+                                        << "receive_multicast_unlocked: stop data handler, lifecycle_idx=" << lifecycle_idx << " vs "
+                                        << self->lifecycle_idx_.load() << ", " << _error.message() << ", stopped=" << self->is_stopped_;
+                    }
+                });
+    } else if (multicast_socket_ && multicast_socket_->is_open()) {
         auto its_storage = std::make_shared<udp_endpoint_receive_op::storage>(
                 multicast_socket_,
-                std::bind(&udp_server_endpoint_impl::on_multicast_received,
-                          std::dynamic_pointer_cast<udp_server_endpoint_impl>(shared_from_this()), std::placeholders::_1,
-                          std::placeholders::_2, std::placeholders::_3, std::placeholders::_4),
+                [self = shared_ptr()](boost::system::error_code const& _error, std::size_t _bytes,
+                                      const boost::asio::ip::udp::endpoint& _sender, const boost::asio::ip::address& _destination) {
+                    self->on_multicast_received(_error, _bytes, _sender, _destination);
+                },
                 &multicast_recv_buffer_[0], max_message_size_, is_v4_, boost::asio::ip::address(), std::numeric_limits<std::size_t>::min());
         multicast_socket_->async_wait(
                 socket_type::wait_read,
@@ -354,6 +582,16 @@ bool udp_server_endpoint_impl::send_to(const std::shared_ptr<endpoint_definition
     return result;
 }
 
+bool udp_server_endpoint_impl::send_batch_to(const std::shared_ptr<endpoint_definition> _target, const batch_t& _messages) {
+    std::scoped_lock its_lock(mutex_);
+    bool result = false;
+    if (_target) {
+        endpoint_type its_target(_target->get_address(), _target->get_port());
+        result = send_batch_intern(its_target, _messages);
+    }
+    return result;
+}
+
 bool udp_server_endpoint_impl::send_error(const std::shared_ptr<endpoint_definition> _target, const byte_t* _data, uint32_t _size) {
     std::scoped_lock its_lock(sync_);
 
@@ -428,16 +666,6 @@ bool udp_server_endpoint_impl::send_queued_unlocked(const target_data_iterator_t
     return false;
 }
 
-void udp_server_endpoint_impl::get_configured_times_from_endpoint(service_t _service, method_t _method,
-                                                                  std::chrono::nanoseconds* _debouncing,
-                                                                  std::chrono::nanoseconds* _maximum_retention) const {
-
-    // Shall not use the lock
-
-    configuration_->get_configured_timing_responses(_service, udp_server_endpoint_base_impl::local_.address().to_string(),
-                                                    udp_server_endpoint_base_impl::local_.port(), _method, _debouncing, _maximum_retention);
-}
-
 bool udp_server_endpoint_impl::is_joined(const std::string& _address) const {
     std::scoped_lock its_lock(sync_);
     auto result = is_joined_unlocked(_address);
@@ -705,12 +933,14 @@ void udp_server_endpoint_impl::on_message_received_unlocked(boost::system::error
                                     clients_[to_clients_key(its_service, its_method, its_client)][its_session] = _remote;
                                 }
                             }
+                            count_received(static_cast<uint32_t>(res.second.size()));
                             its_host->on_message(&res.second[0], static_cast<uint32_t>(res.second.size()), this, _is_multicast,
                                                  VSOMEIP_ROUTING_CLIENT, nullptr, its_remote_address, its_remote_port);
                         }
                     } else {
                         if (its_service != VSOMEIP_SD_SERVICE
                             || (current_message_size > VSOMEIP_SOMEIP_HEADER_SIZE && current_message_size >= remaining_bytes)) {
+                            count_received(current_message_size);
                             its_host->on_message(&_buffer[i], current_message_size, this, _is_multicast, VSOMEIP_ROUTING_CLIENT, nullptr,
                                                  its_remote_address, its_remote_port);
                         } else {
@@ -772,7 +1002,8 @@ void udp_server_endpoint_impl::print_status() {
     std::scoped_lock its_lock(sync_);
 
     VSOMEIP_ERROR << instance_name_ << "status use: " << std::dec << local_port_ << " number targets: " << std::dec << targets_.size()
-                  << " recv_buffer: " << std::dec << unicast_recv_buffer_.capacity() << " multicast_recv_buffer: " << std::dec
+                  << " recv_buffer: " << std::dec << unicast_recv_buffer_.capacity() << " receive_sockets: " << receive_sockets_.size() + 1
+                  << " multicast_recv_buffer: " << std::dec
                   << multicast_recv_buffer_.capacity();
 
     for (const auto& c : targets_) {
@@ -952,7 +1183,12 @@ void udp_server_endpoint_impl::set_multicast_option(const boost::asio::ip::addre
                     _error.clear();
                 }
             }
+
+            low_latency_io::apply(io_, multicast_socket_->native_handle());
 #endif
+            if (is_timestamping_) {
+                std::ignore = socket_timestamping::enable(multicast_socket_->native_handle());
+            }
 
             VSOMEIP_INFO << instance_name_ << "set_multicast_option: start multicast data handler, lifecycle_idx=" << lifecycle_idx_.load();
             receive_multicast_unlocked();
@@ -1000,6 +1236,9 @@ void udp_server_endpoint_impl::set_multicast_option(const boost::asio::ip::addre
 
             if (joined_.empty()) {
                 VSOMEIP_INFO << instance_name_ << "set_multicast_option: stop multicast";
+                if (multicast_receiver_) {
+                    multicast_receiver_->cancel();
+                }
                 multicast_socket_.reset();
             }
         }
@@ -0,0 +1,95 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/uring_context.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+
+namespace vsomeip_v3 {
+
+uring_context::uring_context(uring_service& _service, const boost::asio::any_io_executor& _executor) :
+    service_(_service), executor_(_executor), generation_(0) { }
+
+unsigned uring_context::get_generation() {
+    std::scoped_lock its_lock(mutex_);
+    return generation_;
+}
+
+void uring_context::cancel(bool _is_closing) {
+    std::scoped_lock its_lock(mutex_);
+    if (_is_closing) {
+        generation_++;
+    }
+    for (const auto o : ops_) {
+        service_.cancel(o);
+    }
+}
+
+boost::system::error_code uring_context::to_error(int _result) {
+    return boost::system::error_code(-_result, boost::system::system_category());
+}
+
+boost::system::error_code uring_context::start(unsigned _generation, const std::function<void(io_uring_sqe&)>& _prepare,
+                                               std::function<void(int)> _handler) {
+    return start_multishot(_generation, _prepare, [_handler = std::move(_handler)](int _result, std::uint32_t) { _handler(_result); });
+}
+
+boost::system::error_code uring_context::start_multishot(unsigned _generation, const std::function<void(io_uring_sqe&)>& _prepare,
+                                                         uring_service::multishot_handler_t _handler) {
+    std::scoped_lock its_lock(mutex_);
+    if (_generation != generation_) {
+        return boost::asio::error::operation_aborted;
+    }
+
+    // The completion waits for the lock, so the id is set when it runs
+    auto its_op = std::make_shared<uring_service::op_id_t>(0);
+    *its_op = service_.start_multishot(_prepare, [self = shared_from_this(), its_op, _handler](int _result, std::uint32_t _flags) {
+        if (!(_flags & IORING_CQE_F_MORE)) {
+            std::scoped_lock its_ops_lock(self->mutex_);
+            self->ops_.erase(*its_op);
+        }
+        _handler(_result, _flags);
+    });
+    if (*its_op == 0) {
+        return boost::asio::error::no_buffer_space;
+    }
+    ops_.insert(*its_op);
+    return boost::system::error_code();
+}
+
+void uring_context::wait(unsigned _generation, int _fd, unsigned _events, const std::function<void()>& _retry,
+                         const std::function<void(const boost::system::error_code&)>& _fail) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    _events = (_events << 16) | (_events >> 16);
+#endif
+    auto its_error = start(
+            _generation,
+            [_fd, _events](io_uring_sqe& _sqe) {
+                _sqe.opcode = IORING_OP_POLL_ADD;
+                _sqe.fd = _fd;
+                _sqe.poll32_events = _events;
+            },
+            [_retry, _fail](int _result) {
+                if (_result < 0) {
+                    _fail(to_error(_result));
+                } else {
+                    _retry();
+                }
+            });
+    if (its_error) {
+        post([_fail, its_error] { _fail(its_error); });
+    }
+}
+
+void uring_context::post(std::function<void()> _handler) {
+    boost::asio::post(executor_, std::move(_handler));
+}
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_HAS_IO_URING
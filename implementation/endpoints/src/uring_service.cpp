@@ -0,0 +1,449 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/uring_service.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/post.hpp>
+
+#include <vsomeip/internal/logger.hpp>
+
+namespace vsomeip_v3 {
+
+namespace {
+int uring_setup(unsigned _entries, io_uring_params* _params) {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, _entries, _params));
+}
+
+int uring_enter(int _fd, unsigned _to_submit, unsigned _min_complete, unsigned _flags) {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, _fd, _to_submit, _min_complete, _flags, nullptr, 0));
+}
+
+int uring_register(int _fd, unsigned _opcode, const void* _arg, unsigned _count) {
+    return static_cast<int>(::syscall(__NR_io_uring_register, _fd, _opcode, _arg, _count));
+}
+
+template<typename T>
+T* at_offset(void* _base, std::uint32_t _offset) {
+    return reinterpret_cast<T*>(static_cast<char*>(_base) + _offset);
+}
+} // namespace
+
+boost::asio::io_context::id uring_service::id;
+
+uring_service::uring_service(boost::asio::io_context& _io) :
+    boost::asio::io_context::service(_io), io_(_io), ring_fd_(-1), is_initialized_(false), is_submit_scheduled_(false), next_op_(0),
+    sq_ring_(MAP_FAILED), sq_ring_size_(0), cq_ring_(MAP_FAILED), cq_ring_size_(0), sqes_(static_cast<io_uring_sqe*>(MAP_FAILED)),
+    sqes_size_(0), sq_head_(nullptr), sq_tail_(nullptr), sq_mask_(0), sq_entries_(0), sq_array_(nullptr), cq_head_(nullptr),
+    cq_tail_(nullptr), cq_mask_(0), cqes_(nullptr), pending_(0), event_fd_(-1), event_count_(0), is_buffers_initialized_(false),
+    buffer_ring_(static_cast<io_uring_buf_ring*>(MAP_FAILED)), buffer_ring_size_(0), buffer_count_(0), buffer_tail_(0), buffer_size_(0) { }
+
+uring_service::~uring_service() {
+    std::scoped_lock its_lock(mutex_);
+    close_unlocked();
+}
+
+bool uring_service::init(std::uint32_t _queue_depth) {
+    std::scoped_lock its_lock(mutex_);
+    if (is_initialized_) {
+        return ring_fd_ >= 0;
+    }
+    is_initialized_ = true;
+
+    io_uring_params its_params;
+    std::memset(&its_params, 0, sizeof(its_params));
+    ring_fd_ = uring_setup(_queue_depth, &its_params);
+    if (ring_fd_ < 0) {
+        VSOMEIP_WARNING << "uring_service::" << __func__ << ": io_uring is not available (" << std::strerror(errno)
+                        << "), using the epoll reactor.";
+        return false;
+    }
+
+    sq_ring_size_ = its_params.sq_off.array + its_params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = its_params.cq_off.cqes + its_params.cq_entries * sizeof(io_uring_cqe);
+    const bool is_single_mmap(its_params.features & IORING_FEAT_SINGLE_MMAP);
+    if (is_single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ != MAP_FAILED) {
+        cq_ring_ = is_single_mmap
+                ? sq_ring_
+                : ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    }
+    if (cq_ring_ != MAP_FAILED) {
+        sqes_size_ = its_params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(
+                ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES));
+    }
+    if (sqes_ == MAP_FAILED) {
+        VSOMEIP_WARNING << "uring_service::" << __func__ << ": mapping the rings failed (" << std::strerror(errno)
+                        << "), using the epoll reactor.";
+        close_unlocked();
+        return false;
+    }
+
+    sq_head_ = at_offset<unsigned>(sq_ring_, its_params.sq_off.head);
+    sq_tail_ = at_offset<unsigned>(sq_ring_, its_params.sq_off.tail);
+    sq_mask_ = *at_offset<unsigned>(sq_ring_, its_params.sq_off.ring_mask);
+    sq_entries_ = its_params.sq_entries;
+    sq_array_ = at_offset<unsigned>(sq_ring_, its_params.sq_off.array);
+    cq_head_ = at_offset<unsigned>(cq_ring_, its_params.cq_off.head);
+    cq_tail_ = at_offset<unsigned>(cq_ring_, its_params.cq_off.tail);
+    cq_mask_ = *at_offset<unsigned>(cq_ring_, its_params.cq_off.ring_mask);
+    cqes_ = at_offset<io_uring_cqe>(cq_ring_, its_params.cq_off.cqes);
+
+    event_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (event_fd_ < 0 || uring_register(ring_fd_, IORING_REGISTER_EVENTFD, &event_fd_, 1) < 0) {
+        VSOMEIP_WARNING << "uring_service::" << __func__ << ": registering the eventfd failed (" << std::strerror(errno)
+                        << "), using the epoll reactor.";
+        close_unlocked();
+        return false;
+    }
+    event_ = std::make_unique<boost::asio::posix::stream_descriptor>(io_, event_fd_);
+
+    VSOMEIP_INFO << "uring_service::" << __func__ << ": using io_uring with " << sq_entries_ << " entries.";
+    wait();
+    return true;
+}
+
+bool uring_service::is_available() const {
+    std::scoped_lock its_lock(mutex_);
+    return ring_fd_ >= 0;
+}
+
+uring_service::op_id_t uring_service::start(const std::function<void(io_uring_sqe&)>& _prepare, completion_handler_t _handler) {
+    std::scoped_lock its_lock(mutex_);
+    return start_unlocked(
+            _prepare, std::make_shared<multishot_handler_t>([_handler = std::move(_handler)](int _result, std::uint32_t) { _handler(_result); }),
+            false);
+}
+
+uring_service::op_id_t uring_service::start_multishot(const std::function<void(io_uring_sqe&)>& _prepare, multishot_handler_t _handler) {
+    std::scoped_lock its_lock(mutex_);
+    return start_unlocked(_prepare, std::make_shared<multishot_handler_t>(std::move(_handler)), true);
+}
+
+uring_service::op_id_t uring_service::start_unlocked(const std::function<void(io_uring_sqe&)>& _prepare,
+                                                     std::shared_ptr<multishot_handler_t> _handler, bool _is_multishot) {
+    io_uring_sqe* its_sqe = get_sqe_unlocked();
+    if (!its_sqe) {
+        return 0;
+    }
+
+    _prepare(*its_sqe);
+    const op_id_t its_op(++next_op_);
+    its_sqe->user_data = its_op;
+    __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+    pending_++;
+
+    ops_.emplace(its_op, op_t{std::move(_handler), _is_multishot});
+    schedule_submit_unlocked();
+    return its_op;
+}
+
+void uring_service::cancel(op_id_t _op) {
+    std::scoped_lock its_lock(mutex_);
+    if (ops_.find(_op) == ops_.end()) {
+        return;
+    }
+
+    cancel_unlocked(_op);
+    // Cancellations are not batched, the buffers must be released soon
+    submit_unlocked();
+}
+
+bool uring_service::init_buffers(std::uint16_t _count, std::size_t _size) {
+    std::scoped_lock its_lock(mutex_);
+    if (is_buffers_initialized_) {
+        return buffer_count_ > 0;
+    }
+    is_buffers_initialized_ = true;
+    if (ring_fd_ < 0 || _count == 0 || (_count & (_count - 1)) != 0) {
+        return false;
+    }
+
+    // The kernel requires the ring to be page aligned
+    buffer_ring_size_ = _count * sizeof(io_uring_buf);
+    buffer_ring_ = static_cast<io_uring_buf_ring*>(::mmap(nullptr, buffer_ring_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (buffer_ring_ == MAP_FAILED) {
+        VSOMEIP_WARNING << "uring_service::" << __func__ << ": mapping the buffer ring failed (" << std::strerror(errno) << ")";
+        return false;
+    }
+
+    io_uring_buf_reg its_registration;
+    std::memset(&its_registration, 0, sizeof(its_registration));
+    its_registration.ring_addr = reinterpret_cast<std::uintptr_t>(buffer_ring_);
+    its_registration.ring_entries = _count;
+    its_registration.bgid = buffer_group;
+    if (uring_register(ring_fd_, IORING_REGISTER_PBUF_RING, &its_registration, 1) < 0) {
+        VSOMEIP_INFO << "uring_service::" << __func__ << ": provided buffer rings are not available (" << std::strerror(errno) << ")";
+        ::munmap(buffer_ring_, buffer_ring_size_);
+        buffer_ring_ = static_cast<io_uring_buf_ring*>(MAP_FAILED);
+        return false;
+    }
+
+    buffer_size_ = _size;
+    buffers_.resize(_count * _size);
+    buffer_count_ = _count;
+    for (std::uint16_t i = 0; i < _count; ++i) {
+        add_buffer_unlocked(i);
+    }
+    __atomic_store_n(&buffer_ring_->tail, buffer_tail_, __ATOMIC_RELEASE);
+    return true;
+}
+
+std::size_t uring_service::get_buffer_size() const {
+    std::scoped_lock its_lock(mutex_);
+    return buffer_size_;
+}
+
+const unsigned char* uring_service::get_buffer(std::uint16_t _id) const {
+    // The buffers do not move once they are registered
+    return &buffers_[_id * buffer_size_];
+}
+
+void uring_service::release_buffer(std::uint16_t _id) {
+    std::scoped_lock its_lock(mutex_);
+    if (buffer_count_ > 0 && _id < buffer_count_) {
+        add_buffer_unlocked(_id);
+        __atomic_store_n(&buffer_ring_->tail, buffer_tail_, __ATOMIC_RELEASE);
+    }
+}
+
+void uring_service::add_buffer_unlocked(std::uint16_t _id) {
+    // Not "bufs" of io_uring_buf_ring: its flexible array member starts behind an empty
+    // struct, which takes a byte in C++. The entries start at the ring itself.
+    io_uring_buf& its_entry = reinterpret_cast<io_uring_buf*>(buffer_ring_)[buffer_tail_ & (buffer_count_ - 1)];
+    its_entry.addr = reinterpret_cast<std::uintptr_t>(&buffers_[_id * buffer_size_]);
+    its_entry.len = static_cast<__u32>(buffer_size_);
+    its_entry.bid = _id;
+    buffer_tail_++;
+}
+
+void uring_service::shutdown() {
+    std::unique_lock its_lock(mutex_);
+    if (ring_fd_ < 0) {
+        return;
+    }
+
+    if (event_) {
+        boost::system::error_code its_error;
+        std::ignore = event_->close(its_error);
+    }
+
+    // The kernel may still write into receive buffers that are owned by the
+    // handlers. Cancel everything and wait (a bounded time) until it is done.
+    std::vector<op_id_t> its_ops;
+    for (const auto& o : ops_) {
+        its_ops.push_back(o.first);
+    }
+    for (const auto o : its_ops) {
+        cancel_unlocked(o);
+    }
+    submit_unlocked();
+
+    std::vector<op_t> its_completed;
+    for (int i = 0; i < 100 && !ops_.empty(); ++i) {
+        pollfd its_poll{ring_fd_, POLLIN, 0};
+        std::ignore = ::poll(&its_poll, 1, 10);
+
+        unsigned its_head(*cq_head_);
+        const unsigned its_tail(__atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE));
+        for (; its_head != its_tail; ++its_head) {
+            const io_uring_cqe& its_cqe = cqes_[its_head & cq_mask_];
+            auto found_op = ops_.find(its_cqe.user_data);
+            if (found_op != ops_.end() && !(found_op->second.is_multishot_ && (its_cqe.flags & IORING_CQE_F_MORE))) {
+                its_completed.push_back(std::move(found_op->second));
+                ops_.erase(found_op);
+            }
+        }
+        __atomic_store_n(cq_head_, its_head, __ATOMIC_RELEASE);
+    }
+    if (!ops_.empty()) {
+        VSOMEIP_WARNING << "uring_service::" << __func__ << ": " << ops_.size() << " operations did not finish.";
+    }
+
+    // Like asio, destroy the handlers of the unfinished operations without calling them
+    auto its_ops_handlers(std::move(ops_));
+    ops_.clear();
+    close_unlocked();
+    its_lock.unlock();
+}
+
+io_uring_sqe* uring_service::get_sqe_unlocked() {
+    if (ring_fd_ < 0) {
+        return nullptr;
+    }
+
+    if (*sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+        submit_unlocked();
+        if (*sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+            VSOMEIP_ERROR << "uring_service::" << __func__ << ": submission queue is full.";
+            return nullptr;
+        }
+    }
+
+    const unsigned its_index(*sq_tail_ & sq_mask_);
+    io_uring_sqe* its_sqe = &sqes_[its_index];
+    std::memset(its_sqe, 0, sizeof(io_uring_sqe));
+    sq_array_[its_index] = its_index;
+    return its_sqe;
+}
+
+void uring_service::cancel_unlocked(op_id_t _op) {
+    io_uring_sqe* its_sqe = get_sqe_unlocked();
+    if (its_sqe) {
+        its_sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        its_sqe->fd = -1;
+        its_sqe->addr = _op;
+        // The result of the cancellation itself is not reported
+        its_sqe->user_data = 0;
+        __atomic_store_n(sq_tail_, *sq_tail_ + 1, __ATOMIC_RELEASE);
+        pending_++;
+    }
+}
+
+void uring_service::submit_unlocked() {
+    while (pending_ > 0) {
+        const int its_submitted = uring_enter(ring_fd_, pending_, 0, 0);
+        if (its_submitted < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EBUSY) {
+                VSOMEIP_ERROR << "uring_service::" << __func__ << ": " << std::strerror(errno);
+            }
+            // Retried with the next batch
+            break;
+        }
+        pending_ -= static_cast<unsigned>(its_submitted);
+        if (its_submitted == 0) {
+            break;
+        }
+    }
+}
+
+void uring_service::schedule_submit_unlocked() {
+    if (!is_submit_scheduled_) {
+        is_submit_scheduled_ = true;
+        // Runs after the handlers that are already queued, so everything they start is submitted at once
+        boost::asio::post(io_, [this] {
+            std::scoped_lock its_lock(mutex_);
+            is_submit_scheduled_ = false;
+            if (ring_fd_ >= 0) {
+                submit_unlocked();
+            }
+        });
+    }
+}
+
+void uring_service::wait() {
+    // Reads the counter instead of waiting for readability: the reactor
+    // watches the descriptor edge-triggered and a wait only completes with
+    // the next edge, so a completion that is posted after reap() drained the
+    // queue, but before the wait is started, would be stuck until the next one.
+    // A read is tried right away and finds the counter set.
+    event_->async_read_some(boost::asio::buffer(&event_count_, sizeof(event_count_)),
+                            [this](const boost::system::error_code& _error, std::size_t) {
+                                if (!_error) {
+                                    reap();
+                                    std::scoped_lock its_lock(mutex_);
+                                    if (event_ && event_->is_open()) {
+                                        wait();
+                                    }
+                                }
+                            });
+}
+
+void uring_service::reap() {
+    struct completion_t {
+        std::shared_ptr<multishot_handler_t> handler_;
+        int result_;
+        std::uint32_t flags_;
+    };
+    std::vector<completion_t> its_completed;
+    {
+        std::scoped_lock its_lock(mutex_);
+        if (ring_fd_ < 0) {
+            return;
+        }
+
+        unsigned its_head(*cq_head_);
+        const unsigned its_tail(__atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE));
+        for (; its_head != its_tail; ++its_head) {
+            const io_uring_cqe& its_cqe = cqes_[its_head & cq_mask_];
+            auto found_op = ops_.find(its_cqe.user_data);
+            if (found_op != ops_.end()) {
+                its_completed.push_back(completion_t{found_op->second.handler_, its_cqe.res, its_cqe.flags});
+                if (!found_op->second.is_multishot_ || !(its_cqe.flags & IORING_CQE_F_MORE)) {
+                    ops_.erase(found_op);
+                }
+            } else if (its_cqe.flags & IORING_CQE_F_BUFFER) {
+                // Completion of a cancelled operation that still selected a buffer
+                add_buffer_unlocked(static_cast<std::uint16_t>(its_cqe.flags >> IORING_CQE_BUFFER_SHIFT));
+                __atomic_store_n(&buffer_ring_->tail, buffer_tail_, __ATOMIC_RELEASE);
+            }
+        }
+        __atomic_store_n(cq_head_, its_head, __ATOMIC_RELEASE);
+    }
+
+    for (auto& c : its_completed) {
+        (*c.handler_)(c.result_, c.flags_);
+    }
+}
+
+void uring_service::close_unlocked() {
+    if (event_) {
+        // The descriptor owns the eventfd
+        event_.reset();
+        event_fd_ = -1;
+    }
+    if (event_fd_ >= 0) {
+        ::close(event_fd_);
+        event_fd_ = -1;
+    }
+    if (sqes_ != MAP_FAILED) {
+        ::munmap(sqes_, sqes_size_);
+        sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+    }
+    if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) {
+        ::munmap(cq_ring_, cq_ring_size_);
+    }
+    cq_ring_ = MAP_FAILED;
+    if (sq_ring_ != MAP_FAILED) {
+        ::munmap(sq_ring_, sq_ring_size_);
+        sq_ring_ = MAP_FAILED;
+    }
+    if (ring_fd_ >= 0) {
+        ::close(ring_fd_);
+        ring_fd_ = -1;
+    }
+    pending_ = 0;
+    // The ring no longer uses the buffers once it is closed
+    if (buffer_ring_ != MAP_FAILED) {
+        ::munmap(buffer_ring_, buffer_ring_size_);
+        buffer_ring_ = static_cast<io_uring_buf_ring*>(MAP_FAILED);
+    }
+    buffer_count_ = 0;
+}
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_HAS_IO_URING
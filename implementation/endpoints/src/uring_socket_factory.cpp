@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/uring_socket_factory.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include "../include/netlink_connector.hpp"
+#include "../include/uring_socket_receiver.hpp"
+#include "../include/uring_tcp_socket.hpp"
+#include "../../configuration/include/internal.hpp"
+
+namespace vsomeip_v3 {
+
+uring_socket_factory::uring_socket_factory(std::uint32_t _queue_depth) : queue_depth_(_queue_depth) { }
+
+std::shared_ptr<abstract_netlink_connector>
+uring_socket_factory::create_netlink_connector(boost::asio::io_context& _io, const boost::asio::ip::address& _address,
+                                               const boost::asio::ip::address& _multicast_address, bool _is_requiring_link) {
+    return std::make_shared<netlink_connector>(_io, _address, _multicast_address, _is_requiring_link);
+}
+
+std::unique_ptr<tcp_socket> uring_socket_factory::create_tcp_socket(boost::asio::io_context& _io) {
+    auto& its_service = boost::asio::use_service<uring_service>(_io);
+    if (its_service.init(queue_depth_)) {
+        return std::make_unique<uring_tcp_socket>(_io, its_service);
+    }
+    return std::make_unique<asio_tcp_socket>(_io);
+}
+
+std::unique_ptr<tcp_acceptor> uring_socket_factory::create_tcp_acceptor(boost::asio::io_context& _io) {
+    // Accepting stays with asio, the accepted sockets are created by create_tcp_socket
+    return std::make_unique<asio_tcp_acceptor>(_io);
+}
+
+std::unique_ptr<udp_receiver> uring_socket_factory::create_udp_receiver(boost::asio::io_context& _io) {
+    auto& its_service = boost::asio::use_service<uring_service>(_io);
+    if (its_service.init(queue_depth_)) {
+        // Without provided buffers (Linux < 5.19), each datagram is read on its own
+        const bool has_buffers(its_service.init_buffers(VSOMEIP_IO_URING_RECEIVE_BUFFERS, uring_udp_receiver::get_buffer_size()));
+        return std::make_unique<uring_udp_receiver>(_io, its_service, has_buffers);
+    }
+    return nullptr;
+}
+
+std::unique_ptr<uds_receiver> uring_socket_factory::create_uds_receiver(boost::asio::io_context& _io) {
+    auto& its_service = boost::asio::use_service<uring_service>(_io);
+    if (its_service.init(queue_depth_)) {
+        return std::make_unique<uring_uds_receiver>(_io, its_service);
+    }
+    return nullptr;
+}
+
+}
+
+#endif // VSOMEIP_HAS_IO_URING
@@ -0,0 +1,486 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/uring_socket_receiver.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <vsomeip/defines.hpp>
+#include <vsomeip/internal/logger.hpp>
+
+#include "../include/socket_timestamping.hpp"
+#include "../include/uring_context.hpp"
+#include "../../configuration/include/internal.hpp"
+#include "../../utility/include/receive_timestamp.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+// Sender address, destination address (IP_PKTINFO) and receive time (SCM_TIMESTAMPING) of a datagram
+constexpr socklen_t udp_name_size = sizeof(sockaddr_in6);
+constexpr std::size_t udp_control_size =
+        CMSG_SPACE(std::max(sizeof(in_pktinfo), sizeof(in6_pktinfo))) + CMSG_SPACE(3 * sizeof(struct timespec));
+constexpr std::size_t uds_control_size = CMSG_SPACE(sizeof(ucred));
+
+void parse_datagram(msghdr& _header, boost::asio::ip::udp::endpoint& _sender, boost::asio::ip::address& _destination,
+                    receive_timestamp::socket_time_t& _time) {
+    if (_header.msg_namelen > 0 && _header.msg_namelen <= _sender.capacity()) {
+        std::memcpy(_sender.data(), _header.msg_name, _header.msg_namelen);
+        _sender.resize(_header.msg_namelen);
+    }
+
+    for (cmsghdr* its_cmsg = CMSG_FIRSTHDR(&_header); its_cmsg != nullptr; its_cmsg = CMSG_NXTHDR(&_header, its_cmsg)) {
+        if (its_cmsg->cmsg_level == IPPROTO_IP && its_cmsg->cmsg_type == IP_PKTINFO && its_cmsg->cmsg_len == CMSG_LEN(sizeof(in_pktinfo))) {
+            in_pktinfo its_info;
+            std::memcpy(&its_info, CMSG_DATA(its_cmsg), sizeof(its_info));
+            _destination = boost::asio::ip::address_v4(ntohl(its_info.ipi_addr.s_addr));
+        } else if (its_cmsg->cmsg_level == IPPROTO_IPV6 && its_cmsg->cmsg_type == IPV6_PKTINFO
+                   && its_cmsg->cmsg_len == CMSG_LEN(sizeof(in6_pktinfo))) {
+            in6_pktinfo its_info;
+            std::memcpy(&its_info, CMSG_DATA(its_cmsg), sizeof(its_info));
+            boost::asio::ip::address_v6::bytes_type its_bytes;
+            std::memcpy(its_bytes.data(), &its_info.ipi6_addr, its_bytes.size());
+            _destination = boost::asio::ip::address_v6(its_bytes);
+        }
+    }
+    _time = socket_timestamping::get(_header);
+}
+} // namespace
+
+//
+// uring_udp_receiver
+//
+class uring_udp_receiver::context : public uring_context {
+public:
+    context(uring_service& _service, const boost::asio::any_io_executor& _executor, bool _is_multishot) :
+        uring_context(_service, _executor), fd_(-1), is_multishot_(_is_multishot), is_armed_(false), has_received_(false) {
+        // The layout of the provided buffers: io_uring_recvmsg_out, name, control messages, payload
+        std::memset(&header_, 0, sizeof(header_));
+        header_.msg_namelen = udp_name_size;
+        header_.msg_controllen = udp_control_size;
+    }
+
+    void receive(int _fd, boost::asio::mutable_buffer _buffer, receive_handler_t _handler) {
+        std::scoped_lock its_lock(receive_mutex_);
+        if (_fd != fd_) {
+            // The operations of a previous socket must not continue on a reused descriptor
+            uring_context::cancel(true);
+            reset_unlocked();
+            fd_ = _fd;
+        }
+
+        if (!ready_.empty()) {
+            const datagram_t its_datagram(ready_.front());
+            ready_.pop_front();
+            post([self = get_self(), its_datagram, _buffer, _handler] { self->deliver(its_datagram, _buffer, _handler); });
+            return;
+        }
+
+        buffer_ = _buffer;
+        handler_ = std::move(_handler);
+        if (!is_multishot_) {
+            receive_once_unlocked();
+        } else if (!is_armed_) {
+            arm_unlocked();
+        }
+    }
+
+    void stop() {
+        uring_context::cancel(true);
+        std::scoped_lock its_lock(receive_mutex_);
+        reset_unlocked();
+        fd_ = -1;
+        fail_unlocked(boost::asio::error::operation_aborted);
+    }
+
+private:
+    struct datagram_t {
+        std::uint16_t buffer_;
+        int result_;
+    };
+
+    // A datagram that is read without a provided buffer
+    struct message_t {
+        msghdr header_{};
+        iovec vec_{};
+        sockaddr_in6 name_{};
+        alignas(cmsghdr) unsigned char control_[udp_control_size]{};
+    };
+
+    std::shared_ptr<context> get_self() { return std::static_pointer_cast<context>(shared_from_this()); }
+
+    void arm_unlocked() {
+        const unsigned its_generation(get_generation());
+        const int its_fd(fd_);
+        auto its_error = start_multishot(
+                its_generation,
+                [this, its_fd](io_uring_sqe& _sqe) {
+                    _sqe.opcode = IORING_OP_RECVMSG;
+                    _sqe.fd = its_fd;
+                    _sqe.addr = reinterpret_cast<std::uintptr_t>(&header_);
+                    _sqe.len = 1;
+                    _sqe.ioprio = IORING_RECV_MULTISHOT;
+                    _sqe.flags = IOSQE_BUFFER_SELECT;
+                    _sqe.buf_group = uring_service::buffer_group;
+                },
+                [self = get_self(), its_generation](int _result, std::uint32_t _flags) { self->on_datagram(its_generation, _result, _flags); });
+        if (its_error) {
+            fail_unlocked(its_error);
+        } else {
+            is_armed_ = true;
+        }
+    }
+
+    void on_datagram(unsigned _generation, int _result, std::uint32_t _flags) {
+        const bool has_buffer(_flags & IORING_CQE_F_BUFFER);
+        const datagram_t its_datagram{static_cast<std::uint16_t>(_flags >> IORING_CQE_BUFFER_SHIFT), _result};
+
+        std::unique_lock its_lock(receive_mutex_);
+        if (_generation != get_generation()) {
+            if (has_buffer) {
+                service_.release_buffer(its_datagram.buffer_);
+            }
+            return;
+        }
+        if (!(_flags & IORING_CQE_F_MORE)) {
+            // Started again by the next receive
+            is_armed_ = false;
+        }
+
+        if (_result >= 0 && has_buffer) {
+            has_received_ = true;
+            if (handler_) {
+                const auto its_buffer(buffer_);
+                const auto its_handler(std::move(handler_));
+                handler_ = nullptr;
+                its_lock.unlock();
+                deliver(its_datagram, its_buffer, its_handler);
+            } else {
+                ready_.push_back(its_datagram);
+            }
+            return;
+        }
+
+        if (has_buffer) {
+            service_.release_buffer(its_datagram.buffer_);
+        }
+        if (!handler_ || (_flags & IORING_CQE_F_MORE)) {
+            return;
+        }
+        if (_result == -ENOBUFS) {
+            // The provided buffers are used up, this datagram is read directly
+            receive_once_unlocked();
+        } else if (_result == -EINVAL && !has_received_) {
+            VSOMEIP_INFO << "uring_udp_receiver::" << __func__ << ": multishot receives are not available, reading each datagram on its own.";
+            is_multishot_ = false;
+            receive_once_unlocked();
+        } else {
+            fail_unlocked(to_error(_result));
+        }
+    }
+
+    void deliver(const datagram_t& _datagram, boost::asio::mutable_buffer _buffer, const receive_handler_t& _handler) {
+        const unsigned char* its_data(service_.get_buffer(_datagram.buffer_));
+        io_uring_recvmsg_out its_out;
+        std::memcpy(&its_out, its_data, sizeof(its_out));
+
+        const unsigned char* its_name(its_data + sizeof(its_out));
+        const unsigned char* its_control(its_name + header_.msg_namelen);
+        const unsigned char* its_payload(its_control + header_.msg_controllen);
+        const std::size_t its_offset(static_cast<std::size_t>(its_payload - its_data));
+        std::size_t its_bytes(0);
+        if (static_cast<std::size_t>(_datagram.result_) > its_offset) {
+            its_bytes = std::min({static_cast<std::size_t>(_datagram.result_) - its_offset, std::size_t(its_out.payloadlen), _buffer.size()});
+            std::memcpy(_buffer.data(), its_payload, its_bytes);
+        }
+
+        msghdr its_header;
+        std::memset(&its_header, 0, sizeof(its_header));
+        its_header.msg_name = const_cast<unsigned char*>(its_name);
+        its_header.msg_namelen = std::min(its_out.namelen, header_.msg_namelen);
+        its_header.msg_control = const_cast<unsigned char*>(its_control);
+        its_header.msg_controllen = its_out.controllen;
+
+        boost::asio::ip::udp::endpoint its_sender;
+        boost::asio::ip::address its_destination;
+        receive_timestamp::socket_time_t its_time;
+        parse_datagram(its_header, its_sender, its_destination, its_time);
+        service_.release_buffer(_datagram.buffer_);
+
+        const receive_timestamp::socket_scope its_scope(its_time);
+        _handler(boost::system::error_code(), its_bytes, its_sender, its_destination);
+    }
+
+    void receive_once_unlocked() {
+        auto its_message = std::make_shared<message_t>();
+        its_message->vec_.iov_base = buffer_.data();
+        its_message->vec_.iov_len = buffer_.size();
+        its_message->header_.msg_iov = &its_message->vec_;
+        its_message->header_.msg_iovlen = 1;
+        its_message->header_.msg_name = &its_message->name_;
+        its_message->header_.msg_namelen = sizeof(its_message->name_);
+        its_message->header_.msg_control = its_message->control_;
+        its_message->header_.msg_controllen = sizeof(its_message->control_);
+
+        const unsigned its_generation(get_generation());
+        const int its_fd(fd_);
+        auto its_error = start(
+                its_generation,
+                [its_fd, its_message](io_uring_sqe& _sqe) {
+                    _sqe.opcode = IORING_OP_RECVMSG;
+                    _sqe.fd = its_fd;
+                    _sqe.addr = reinterpret_cast<std::uintptr_t>(&its_message->header_);
+                    _sqe.len = 1;
+                },
+                [self = get_self(), its_generation, its_message](int _result) { self->on_message(its_generation, its_message, _result); });
+        if (its_error) {
+            fail_unlocked(its_error);
+        }
+    }
+
+    void on_message(unsigned _generation, const std::shared_ptr<message_t>& _message, int _result) {
+        std::unique_lock its_lock(receive_mutex_);
+        if (_generation != get_generation() || !handler_) {
+            return;
+        }
+
+        if (_result == -EAGAIN) {
+            auto self = get_self();
+            wait(
+                    _generation, fd_, POLLIN,
+                    [self, _generation] {
+                        std::scoped_lock its_retry_lock(self->receive_mutex_);
+                        if (_generation == self->get_generation() && self->handler_) {
+                            self->receive_once_unlocked();
+                        }
+                    },
+                    [self](const boost::system::error_code& _error) {
+                        std::scoped_lock its_fail_lock(self->receive_mutex_);
+                        self->fail_unlocked(_error);
+                    });
+            return;
+        }
+        if (_result < 0) {
+            fail_unlocked(to_error(_result));
+            return;
+        }
+
+        boost::asio::ip::udp::endpoint its_sender;
+        boost::asio::ip::address its_destination;
+        receive_timestamp::socket_time_t its_time;
+        parse_datagram(_message->header_, its_sender, its_destination, its_time);
+
+        const auto its_handler(std::move(handler_));
+        handler_ = nullptr;
+        its_lock.unlock();
+
+        const receive_timestamp::socket_scope its_scope(its_time);
+        its_handler(boost::system::error_code(), static_cast<std::size_t>(_result), its_sender, its_destination);
+    }
+
+    void fail_unlocked(const boost::system::error_code& _error) {
+        if (handler_) {
+            post([its_handler = std::move(handler_), _error] {
+                its_handler(_error, 0, boost::asio::ip::udp::endpoint(), boost::asio::ip::address());
+            });
+            handler_ = nullptr;
+        }
+    }
+
+    void reset_unlocked() {
+        is_armed_ = false;
+        for (const auto& d : ready_) {
+            service_.release_buffer(d.buffer_);
+        }
+        ready_.clear();
+    }
+
+    std::mutex receive_mutex_;
+    int fd_;
+    bool is_multishot_;
+    bool is_armed_;
+    bool has_received_;
+    // Template of the multishot receives
+    msghdr header_;
+    // Received while no receive was pending
+    std::deque<datagram_t> ready_;
+
+    // The pending receive
+    boost::asio::mutable_buffer buffer_;
+    receive_handler_t handler_;
+};
+
+std::size_t uring_udp_receiver::get_buffer_size() {
+    return sizeof(io_uring_recvmsg_out) + udp_name_size + udp_control_size + VSOMEIP_MAX_UDP_MESSAGE_SIZE;
+}
+
+uring_udp_receiver::uring_udp_receiver(boost::asio::io_context& _io, uring_service& _service, bool _is_multishot) :
+    context_(std::make_shared<context>(_service, _io.get_executor(), _is_multishot)) { }
+
+uring_udp_receiver::~uring_udp_receiver() {
+    context_->stop();
+}
+
+void uring_udp_receiver::async_receive(boost::asio::ip::udp::socket& _socket, boost::asio::mutable_buffer _buffer,
+                                       receive_handler_t _handler) {
+    context_->receive(_socket.native_handle(), _buffer, std::move(_handler));
+}
+
+void uring_udp_receiver::cancel() {
+    context_->stop();
+}
+
+//
+// uring_uds_receiver
+//
+class uring_uds_receiver::context : public uring_context {
+public:
+    using uring_context::uring_context;
+
+    void receive(int _fd, boost::asio::mutable_buffer _buffer, receive_handler_t _handler) {
+        std::scoped_lock its_lock(receive_mutex_);
+        if (_fd != fd_) {
+            uring_context::cancel(true);
+            fd_ = _fd;
+        }
+
+        buffer_ = _buffer;
+        handler_ = std::move(_handler);
+        receive_unlocked();
+    }
+
+    void stop() {
+        uring_context::cancel(true);
+        std::scoped_lock its_lock(receive_mutex_);
+        fd_ = -1;
+        fail_unlocked(boost::asio::error::operation_aborted);
+    }
+
+private:
+    struct message_t {
+        msghdr header_{};
+        iovec vec_{};
+        alignas(cmsghdr) unsigned char control_[uds_control_size]{};
+    };
+
+    std::shared_ptr<context> get_self() { return std::static_pointer_cast<context>(shared_from_this()); }
+
+    void receive_unlocked() {
+        auto its_message = std::make_shared<message_t>();
+        its_message->vec_.iov_base = buffer_.data();
+        its_message->vec_.iov_len = buffer_.size();
+        its_message->header_.msg_iov = &its_message->vec_;
+        its_message->header_.msg_iovlen = 1;
+        its_message->header_.msg_control = its_message->control_;
+        its_message->header_.msg_controllen = sizeof(its_message->control_);
+
+        const unsigned its_generation(get_generation());
+        const int its_fd(fd_);
+        auto its_error = start(
+                its_generation,
+                [its_fd, its_message](io_uring_sqe& _sqe) {
+                    _sqe.opcode = IORING_OP_RECVMSG;
+                    _sqe.fd = its_fd;
+                    _sqe.addr = reinterpret_cast<std::uintptr_t>(&its_message->header_);
+                    _sqe.len = 1;
+                },
+                [self = get_self(), its_generation, its_message](int _result) { self->on_message(its_generation, its_message, _result); });
+        if (its_error) {
+            fail_unlocked(its_error);
+        }
+    }
+
+    void on_message(unsigned _generation, const std::shared_ptr<message_t>& _message, int _result) {
+        std::unique_lock its_lock(receive_mutex_);
+        if (_generation != get_generation() || !handler_) {
+            return;
+        }
+
+        if (_result == -EAGAIN) {
+            auto self = get_self();
+            wait(
+                    _generation, fd_, POLLIN,
+                    [self, _generation] {
+                        std::scoped_lock its_retry_lock(self->receive_mutex_);
+                        if (_generation == self->get_generation() && self->handler_) {
+                            self->receive_unlocked();
+                        }
+                    },
+                    [self](const boost::system::error_code& _error) {
+                        std::scoped_lock its_fail_lock(self->receive_mutex_);
+                        self->fail_unlocked(_error);
+                    });
+            return;
+        }
+        if (_result < 0) {
+            fail_unlocked(to_error(_result));
+            return;
+        }
+
+        std::uint32_t its_uid(ANY_UID), its_gid(ANY_GID);
+        for (cmsghdr* its_cmsg = CMSG_FIRSTHDR(&_message->header_); its_cmsg != nullptr;
+             its_cmsg = CMSG_NXTHDR(&_message->header_, its_cmsg)) {
+            if (its_cmsg->cmsg_level == SOL_SOCKET && its_cmsg->cmsg_type == SCM_CREDENTIALS
+                && its_cmsg->cmsg_len == CMSG_LEN(sizeof(ucred))) {
+                ucred its_credentials;
+                std::memcpy(&its_credentials, CMSG_DATA(its_cmsg), sizeof(its_credentials));
+                its_uid = its_credentials.uid;
+                its_gid = its_credentials.gid;
+                break;
+            }
+        }
+
+        const auto its_handler(std::move(handler_));
+        handler_ = nullptr;
+        its_lock.unlock();
+
+        its_handler(_result == 0 ? boost::system::error_code(boost::asio::error::eof) : boost::system::error_code(),
+                    static_cast<std::size_t>(_result), its_uid, its_gid);
+    }
+
+    void fail_unlocked(const boost::system::error_code& _error) {
+        if (handler_) {
+            post([its_handler = std::move(handler_), _error] { its_handler(_error, 0, ANY_UID, ANY_GID); });
+            handler_ = nullptr;
+        }
+    }
+
+    std::mutex receive_mutex_;
+    int fd_{-1};
+
+    // The pending receive
+    boost::asio::mutable_buffer buffer_;
+    receive_handler_t handler_;
+};
+
+uring_uds_receiver::uring_uds_receiver(boost::asio::io_context& _io, uring_service& _service) :
+    context_(std::make_shared<context>(_service, _io.get_executor())) { }
+
+uring_uds_receiver::~uring_uds_receiver() {
+    context_->stop();
+}
+
+void uring_uds_receiver::async_receive(boost::asio::local::stream_protocol::socket& _socket, boost::asio::mutable_buffer _buffer,
+                                       receive_handler_t _handler) {
+    context_->receive(_socket.native_handle(), _buffer, std::move(_handler));
+}
+
+void uring_uds_receiver::cancel() {
+    context_->stop();
+}
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_HAS_IO_URING
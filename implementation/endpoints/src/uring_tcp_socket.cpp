@@ -0,0 +1,183 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/uring_tcp_socket.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <cerrno>
+#include <limits>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include "../include/uring_context.hpp"
+
+namespace vsomeip_v3 {
+
+struct uring_tcp_socket::write_op {
+    // Not yet written
+    std::vector<boost::asio::const_buffer> buffers_;
+    std::size_t total_{0};
+    completion_condition cc_;
+    rw_handler handler_;
+
+    std::vector<iovec> iov_;
+    msghdr msg_{};
+};
+
+class uring_tcp_socket::context : public uring_context {
+public:
+    using uring_context::uring_context;
+
+    void receive(unsigned _generation, int _fd, boost::asio::mutable_buffer _buffer, rw_handler _handler) {
+        auto self = std::static_pointer_cast<context>(shared_from_this());
+        auto its_error = start(
+                _generation,
+                [_fd, _buffer](io_uring_sqe& _sqe) {
+                    _sqe.opcode = IORING_OP_RECV;
+                    _sqe.fd = _fd;
+                    _sqe.addr = reinterpret_cast<std::uintptr_t>(_buffer.data());
+                    _sqe.len = static_cast<__u32>(_buffer.size());
+                },
+                [self, _generation, _fd, _buffer, _handler](int _result) {
+                    if (_result == -EAGAIN) {
+                        self->wait(
+                                _generation, _fd, POLLIN, [self, _generation, _fd, _buffer, _handler] {
+                                    self->receive(_generation, _fd, _buffer, _handler);
+                                },
+                                [_handler](const boost::system::error_code& _error) { _handler(_error, 0); });
+                    } else if (_result < 0) {
+                        _handler(to_error(_result), 0);
+                    } else if (_result == 0 && _buffer.size() > 0) {
+                        _handler(boost::asio::error::eof, 0);
+                    } else {
+                        _handler(boost::system::error_code(), static_cast<std::size_t>(_result));
+                    }
+                });
+        if (its_error) {
+            complete(std::move(_handler), its_error, 0);
+        }
+    }
+
+    void write(unsigned _generation, int _fd, const std::shared_ptr<write_op>& _op) {
+        while (!_op->buffers_.empty() && _op->buffers_.front().size() == 0) {
+            _op->buffers_.erase(_op->buffers_.begin());
+        }
+
+        // Like boost::asio::async_write, ask the completion condition how much may be written next
+        std::size_t its_max(0);
+        if (!_op->buffers_.empty()) {
+            its_max = (_op->cc_ ? _op->cc_(boost::system::error_code(), _op->total_) : std::numeric_limits<std::size_t>::max());
+        }
+        if (its_max == 0) {
+            complete(_op->handler_, boost::system::error_code(), _op->total_);
+            return;
+        }
+
+        _op->iov_.clear();
+        for (const auto& b : _op->buffers_) {
+            if (its_max == 0 || _op->iov_.size() == IOV_MAX) {
+                break;
+            }
+            const std::size_t its_size(std::min(b.size(), its_max));
+            _op->iov_.push_back(iovec{const_cast<void*>(b.data()), its_size});
+            its_max -= its_size;
+        }
+        _op->msg_.msg_iov = _op->iov_.data();
+        _op->msg_.msg_iovlen = _op->iov_.size();
+
+        auto self = std::static_pointer_cast<context>(shared_from_this());
+        auto its_error = start(
+                _generation,
+                [_fd, _op](io_uring_sqe& _sqe) {
+                    _sqe.opcode = IORING_OP_SENDMSG;
+                    _sqe.fd = _fd;
+                    _sqe.addr = reinterpret_cast<std::uintptr_t>(&_op->msg_);
+                    _sqe.len = 1;
+                    _sqe.msg_flags = MSG_NOSIGNAL;
+                },
+                [self, _generation, _fd, _op](int _result) {
+                    if (_result == -EAGAIN) {
+                        self->wait(
+                                _generation, _fd, POLLOUT, [self, _generation, _fd, _op] { self->write(_generation, _fd, _op); },
+                                [_op](const boost::system::error_code& _error) { _op->handler_(_error, _op->total_); });
+                    } else if (_result <= 0) {
+                        _op->handler_(_result < 0 ? to_error(_result) : boost::system::error_code(), _op->total_);
+                    } else {
+                        consume(*_op, static_cast<std::size_t>(_result));
+                        self->write(_generation, _fd, _op);
+                    }
+                });
+        if (its_error) {
+            complete(_op->handler_, its_error, _op->total_);
+        }
+    }
+
+private:
+    void complete(rw_handler _handler, const boost::system::error_code& _error, std::size_t _bytes) {
+        // Never call the handler from the initiating function
+        post([_handler, _error, _bytes] { _handler(_error, _bytes); });
+    }
+
+    static void consume(write_op& _op, std::size_t _bytes) {
+        _op.total_ += _bytes;
+        auto its_buffer = _op.buffers_.begin();
+        while (_bytes > 0 && its_buffer != _op.buffers_.end()) {
+            const std::size_t its_size(std::min(_bytes, its_buffer->size()));
+            *its_buffer += its_size;
+            _bytes -= its_size;
+            if (its_buffer->size() == 0) {
+                ++its_buffer;
+            }
+        }
+        _op.buffers_.erase(_op.buffers_.begin(), its_buffer);
+    }
+};
+
+uring_tcp_socket::uring_tcp_socket(boost::asio::io_context& _io, uring_service& _service) :
+    asio_tcp_socket(_io), context_(std::make_shared<context>(_service, socket_.get_executor())) { }
+
+uring_tcp_socket::~uring_tcp_socket() {
+    context_->cancel(true);
+}
+
+void uring_tcp_socket::close(boost::system::error_code& ec) {
+    context_->cancel(true);
+    asio_tcp_socket::close(ec);
+}
+
+void uring_tcp_socket::cancel(boost::system::error_code& ec) {
+    context_->cancel(false);
+    asio_tcp_socket::cancel(ec);
+}
+
+void uring_tcp_socket::async_receive(boost::asio::mutable_buffer b, rw_handler handler) {
+    context_->receive(context_->get_generation(), socket_.native_handle(), b, std::move(handler));
+}
+
+void uring_tcp_socket::async_write(std::vector<boost::asio::const_buffer> const& bs, rw_handler handler) {
+    auto its_op = std::make_shared<write_op>();
+    its_op->buffers_ = bs;
+    its_op->handler_ = std::move(handler);
+    context_->write(context_->get_generation(), socket_.native_handle(), its_op);
+}
+
+void uring_tcp_socket::async_write(boost::asio::const_buffer const& b, completion_condition cc, rw_handler handler) {
+    async_write(std::vector<boost::asio::const_buffer>{b}, std::move(cc), std::move(handler));
+}
+
+void uring_tcp_socket::async_write(std::vector<boost::asio::const_buffer> const& bs, completion_condition cc, rw_handler handler) {
+    auto its_op = std::make_shared<write_op>();
+    its_op->buffers_ = bs;
+    its_op->cc_ = std::move(cc);
+    its_op->handler_ = std::move(handler);
+    context_->write(context_->get_generation(), socket_.native_handle(), its_op);
+}
+
+}
+
+#endif // VSOMEIP_HAS_IO_URING
@@ -124,4 +124,9 @@ void virtual_server_endpoint_impl::print_status() { }
 size_t virtual_server_endpoint_impl::get_queue_size() const {
     return 0;
 }
+
+bool virtual_server_endpoint_impl::get_metrics(endpoint_metrics_t& _metrics) const {
+    (void)_metrics;
+    return false;
+}
 } // namespace vsomeip_v3
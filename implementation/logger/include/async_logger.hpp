@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_LOGGER_ASYNC_LOGGER_HPP_
+#define VSOMEIP_V3_LOGGER_ASYNC_LOGGER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "log_writer.hpp"
+
+namespace vsomeip_v3 {
+namespace logger {
+
+// Hands log records from the logging threads to a background writer thread.
+//
+// Every logging thread owns a single producer/single consumer ring, so that
+// logging threads neither share a lock nor a cache line. The writer thread
+// collects the records of all rings, orders them by time and passes them to
+// the sink in batches.
+//
+// If the ring of a thread is full, the record is either dropped and counted
+// (the writer then logs how many records were lost) or the thread waits for
+// the writer to catch up.
+class async_logger {
+public:
+    using sink_t = std::function<void(const std::vector<log_record>&)>;
+
+    VSOMEIP_IMPORT_EXPORT async_logger(std::size_t _queue_size, bool _is_blocking, sink_t _sink);
+    // Writes all pending records before returning
+    VSOMEIP_IMPORT_EXPORT ~async_logger();
+
+    VSOMEIP_IMPORT_EXPORT void push(level_e _level, std::chrono::system_clock::time_point _when, std::string&& _text);
+    VSOMEIP_IMPORT_EXPORT void push(log_record&& _record);
+
+    // Waits until the records that were pushed before were passed to the sink
+    VSOMEIP_IMPORT_EXPORT void flush();
+
+    VSOMEIP_IMPORT_EXPORT void set_blocking(bool _is_blocking);
+    VSOMEIP_IMPORT_EXPORT std::uint64_t get_dropped() const;
+
+private:
+    class ring;
+
+    ring* get_ring();
+    void wake_up();
+    void run();
+
+    const std::uint64_t id_;
+    const std::size_t queue_size_;
+    std::atomic<bool> is_blocking_;
+    const sink_t sink_;
+
+    // Rings of all threads that logged, guarded by "rings_mutex_"
+    std::mutex rings_mutex_;
+    std::vector<std::shared_ptr<ring>> rings_;
+    std::atomic<std::uint64_t> rings_version_;
+
+    std::atomic<std::uint64_t> dropped_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_up_condition_;
+    std::condition_variable flushed_condition_;
+    std::atomic<bool> is_waiting_;
+    bool is_stopping_;
+
+    std::thread writer_;
+};
+
+} // namespace logger
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_LOGGER_ASYNC_LOGGER_HPP_
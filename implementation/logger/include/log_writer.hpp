@@ -0,0 +1,89 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_LOGGER_LOG_WRITER_HPP_
+#define VSOMEIP_V3_LOGGER_LOG_WRITER_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/internal/logger.hpp>
+
+namespace vsomeip_v3 {
+namespace logger {
+
+struct log_record {
+    level_e level_;
+    std::chrono::system_clock::time_point when_;
+    // The line, or the characters of the string arguments of a structured line
+    std::string text_;
+
+    // Structured lines are formatted when they are written
+    const char* format_{nullptr};
+    std::array<argument, max_structured_arguments> arguments_{};
+    std::size_t argument_count_{0};
+};
+
+// Formats a structured line into "_text"
+VSOMEIP_IMPORT_EXPORT void format_structured(const log_record& _record, std::string& _text);
+
+// Writes log lines to the console and the log file.
+//
+// The log file stays open. If a maximum size is set, it is rotated to
+// "<path>.1" ... "<path>.<max_files>" before a line would exceed it.
+class log_writer {
+public:
+    VSOMEIP_IMPORT_EXPORT log_writer();
+
+    VSOMEIP_IMPORT_EXPORT void set_console(bool _enabled, const std::string& _app_name);
+    VSOMEIP_IMPORT_EXPORT void set_file(bool _enabled, const std::string& _path, std::uint64_t _max_size, std::uint32_t _max_files);
+
+    // Writes and flushes a single line
+    VSOMEIP_IMPORT_EXPORT void write(level_e _level, std::chrono::system_clock::time_point _when, const std::string& _text);
+    // Writes and flushes a single record
+    VSOMEIP_IMPORT_EXPORT void write(const log_record& _record);
+    // Writes all records and flushes once
+    VSOMEIP_IMPORT_EXPORT void write(const std::vector<log_record>& _records);
+
+private:
+    void write_unlocked(level_e _level, std::chrono::system_clock::time_point _when, const std::string& _text);
+    void write_unlocked(const log_record& _record);
+    void flush_unlocked();
+
+    void format_time(std::chrono::system_clock::time_point _when);
+
+    void open_file_unlocked();
+    void rotate_file_unlocked();
+
+    std::mutex mutex_;
+
+    bool is_console_enabled_;
+    std::string app_name_;
+
+    bool is_file_enabled_;
+    std::string path_;
+    std::uint64_t max_size_;
+    std::uint32_t max_files_;
+    std::ofstream file_;
+    std::uint64_t file_size_;
+
+    // "YYYY-MM-DD HH:MM:SS" of "time_", reformatted when the second changes
+    std::time_t time_;
+    char time_prefix_[32];
+    std::string line_;
+    std::string structured_text_;
+};
+
+} // namespace logger
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_LOGGER_LOG_WRITER_HPP_
@@ -18,6 +18,9 @@
 
 #include <vsomeip/internal/logger.hpp>
 
+#include "async_logger.hpp"
+#include "log_writer.hpp"
+
 namespace vsomeip_v3 {
 
 class configuration;
@@ -39,6 +42,12 @@ public:
     bool has_file_log() const;
     std::string get_logfile() const;
 
+    // Writes a line to the console and / or the log file, or queues it for
+    // the writer thread if asynchronous logging is enabled
+    void write(log_record&& _record);
+
+    static bool is_enabled(level_e _level) { return _level <= level__.load(std::memory_order_relaxed); }
+
     const std::string& get_app_name() const;
     std::unique_lock<std::mutex> get_app_name_lock() const;
 
@@ -53,6 +62,8 @@ private:
 private:
     static std::mutex mutex__;
     static std::string app_name__;
+    // Log level of the current configuration, read without taking a lock
+    static std::atomic<level_e> level__;
 
     mutable std::mutex configuration_mutex_;
     std::atomic<level_e> cfg_level{level_e::LL_NONE};
@@ -60,6 +71,11 @@ private:
     std::atomic_bool cfg_dlt_enabled{false};
     std::atomic_bool cfg_file_enabled{false};
     std::string cfg_file_name{""};
+    std::atomic_bool cfg_async_enabled{false};
+
+    log_writer writer_;
+    // Created when asynchronous logging is enabled for the first time
+    std::unique_ptr<async_logger> async_logger_;
 
 #ifdef USE_DLT
 #ifndef ANDROID
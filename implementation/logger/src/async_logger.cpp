@@ -0,0 +1,249 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include "../include/async_logger.hpp"
+
+namespace vsomeip_v3 {
+namespace logger {
+
+namespace {
+std::atomic<std::uint64_t> next_id__(1);
+
+std::size_t round_up_to_power_of_two(std::size_t _size) {
+    std::size_t its_size(2);
+    while (its_size < _size) {
+        its_size <<= 1;
+    }
+    return its_size;
+}
+} // namespace
+
+class async_logger::ring {
+public:
+    explicit ring(std::size_t _size) :
+        slots_(round_up_to_power_of_two(_size)), mask_(slots_.size() - 1), head_(0), tail_(0), written_(0), is_orphaned_(false),
+        is_detached_(false) { }
+
+    // Producer: moves "_record" if there is space
+    bool try_push(log_record& _record) {
+        const auto its_tail = tail_.load(std::memory_order_relaxed);
+        if (its_tail - head_.load(std::memory_order_acquire) == slots_.size()) {
+            return false;
+        }
+        slots_[its_tail & mask_] = std::move(_record);
+        tail_.store(its_tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer
+    void pop_all(std::vector<log_record>& _records) {
+        auto its_head = head_.load(std::memory_order_relaxed);
+        const auto its_tail = tail_.load(std::memory_order_acquire);
+        for (; its_head != its_tail; ++its_head) {
+            _records.push_back(std::move(slots_[its_head & mask_]));
+        }
+        head_.store(its_head, std::memory_order_release);
+    }
+
+    bool is_empty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_seq_cst); }
+
+    std::vector<log_record> slots_;
+    const std::size_t mask_;
+
+    alignas(64) std::atomic<std::size_t> head_;
+    alignas(64) std::atomic<std::size_t> tail_;
+    // Records before this position were passed to the sink
+    std::atomic<std::size_t> written_;
+    // The producing thread terminated
+    std::atomic<bool> is_orphaned_;
+    // The async_logger was destroyed
+    std::atomic<bool> is_detached_;
+};
+
+async_logger::async_logger(std::size_t _queue_size, bool _is_blocking, sink_t _sink) :
+    id_(next_id__++), queue_size_(_queue_size), is_blocking_(_is_blocking), sink_(std::move(_sink)), rings_version_(0), dropped_(0),
+    is_waiting_(false), is_stopping_(false) {
+
+    writer_ = std::thread(&async_logger::run, this);
+#if defined(__linux__)
+    pthread_setname_np(writer_.native_handle(), "vsomeip_log");
+#endif
+}
+
+async_logger::~async_logger() {
+    {
+        std::scoped_lock its_lock{mutex_};
+        is_stopping_ = true;
+        wake_up_condition_.notify_one();
+    }
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+
+    std::scoped_lock its_lock{rings_mutex_};
+    for (const auto& r : rings_) {
+        r->is_detached_ = true;
+    }
+}
+
+void async_logger::push(level_e _level, std::chrono::system_clock::time_point _when, std::string&& _text) {
+    push(log_record{_level, _when, std::move(_text)});
+}
+
+void async_logger::push(log_record&& _record) {
+    auto its_ring = get_ring();
+    if (!its_ring->try_push(_record)) {
+        if (!is_blocking_) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        do {
+            wake_up();
+            std::this_thread::yield();
+        } while (!its_ring->try_push(_record));
+    }
+
+    // Pairs with the fence of the writer before it goes to sleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (is_waiting_.load(std::memory_order_relaxed)) {
+        wake_up();
+    }
+}
+
+void async_logger::flush() {
+    std::vector<std::pair<std::shared_ptr<ring>, std::size_t>> its_positions;
+    {
+        std::scoped_lock its_lock{rings_mutex_};
+        for (const auto& r : rings_) {
+            its_positions.emplace_back(r, r->tail_.load(std::memory_order_acquire));
+        }
+    }
+
+    std::unique_lock its_lock{mutex_};
+    wake_up_condition_.notify_one();
+    flushed_condition_.wait(its_lock, [this, &its_positions]() {
+        return is_stopping_ || std::all_of(its_positions.begin(), its_positions.end(), [](const auto& p) {
+                   return p.first->written_.load(std::memory_order_acquire) >= p.second;
+               });
+    });
+}
+
+void async_logger::set_blocking(bool _is_blocking) {
+    is_blocking_ = _is_blocking;
+}
+
+std::uint64_t async_logger::get_dropped() const {
+    return dropped_;
+}
+
+async_logger::ring* async_logger::get_ring() {
+    struct thread_rings {
+        ~thread_rings() {
+            for (const auto& r : rings_) {
+                r.second->is_orphaned_ = true;
+            }
+        }
+        std::vector<std::pair<std::uint64_t, std::shared_ptr<ring>>> rings_;
+    };
+    static thread_local thread_rings its_rings;
+
+    for (const auto& r : its_rings.rings_) {
+        if (r.first == id_) {
+            return r.second.get();
+        }
+    }
+
+    its_rings.rings_.erase(std::remove_if(its_rings.rings_.begin(), its_rings.rings_.end(),
+                                          [](const auto& r) { return r.second->is_detached_.load(); }),
+                           its_rings.rings_.end());
+
+    auto its_ring = std::make_shared<ring>(queue_size_);
+    {
+        std::scoped_lock its_lock{rings_mutex_};
+        rings_.push_back(its_ring);
+        rings_version_++;
+    }
+    its_rings.rings_.emplace_back(id_, its_ring);
+    return its_ring.get();
+}
+
+void async_logger::wake_up() {
+    std::scoped_lock its_lock{mutex_};
+    wake_up_condition_.notify_one();
+}
+
+void async_logger::run() {
+    std::vector<std::shared_ptr<ring>> its_rings;
+    std::uint64_t its_version(0);
+    std::vector<log_record> its_records;
+    std::uint64_t its_dropped(0);
+
+    while (true) {
+        if (rings_version_.load(std::memory_order_acquire) != its_version) {
+            std::scoped_lock its_lock{rings_mutex_};
+            its_rings = rings_;
+            its_version = rings_version_;
+        }
+
+        its_records.clear();
+        for (const auto& r : its_rings) {
+            r->pop_all(its_records);
+        }
+
+        const auto its_current_dropped = dropped_.load(std::memory_order_relaxed);
+        if (its_current_dropped != its_dropped) {
+            its_records.push_back({level_e::LL_WARNING, std::chrono::system_clock::now(),
+                                   "Dropped " + std::to_string(its_current_dropped - its_dropped)
+                                           + " log messages as the queue of the logging thread was full"});
+            its_dropped = its_current_dropped;
+        }
+
+        if (!its_records.empty()) {
+            std::stable_sort(its_records.begin(), its_records.end(),
+                             [](const log_record& _left, const log_record& _right) { return _left.when_ < _right.when_; });
+            sink_(its_records);
+        }
+
+        bool has_orphans(false);
+        for (const auto& r : its_rings) {
+            r->written_.store(r->head_.load(std::memory_order_relaxed), std::memory_order_release);
+            has_orphans = has_orphans || (r->is_orphaned_ && r->is_empty());
+        }
+        if (has_orphans) {
+            std::scoped_lock its_lock{rings_mutex_};
+            rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const auto& r) { return r->is_orphaned_ && r->is_empty(); }),
+                         rings_.end());
+            rings_version_++;
+        }
+
+        std::unique_lock its_lock{mutex_};
+        flushed_condition_.notify_all();
+        if (!its_records.empty()) {
+            continue;
+        }
+
+        is_waiting_ = true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool is_empty = std::all_of(its_rings.begin(), its_rings.end(), [](const auto& r) { return r->is_empty(); })
+                && rings_version_.load() == its_version;
+        if (is_empty) {
+            if (is_stopping_) {
+                break;
+            }
+            // Lines that are pushed without waking up are written after a short delay
+            wake_up_condition_.wait_for(its_lock, std::chrono::milliseconds(10));
+        }
+        is_waiting_ = false;
+    }
+}
+
+} // namespace logger
+} // namespace vsomeip_v3
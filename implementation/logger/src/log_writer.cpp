@@ -0,0 +1,255 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "../include/log_writer.hpp"
+
+namespace vsomeip_v3 {
+namespace logger {
+
+namespace {
+
+const char* to_string(level_e _level) {
+    switch (_level) {
+    case level_e::LL_FATAL:
+        return "fatal";
+    case level_e::LL_ERROR:
+        return "error";
+    case level_e::LL_WARNING:
+        return "warning";
+    case level_e::LL_INFO:
+        return "info";
+    case level_e::LL_DEBUG:
+        return "debug";
+    case level_e::LL_VERBOSE:
+        return "verbose";
+    default:
+        return "none";
+    }
+}
+
+} // namespace
+
+void format_structured(const log_record& _record, std::string& _text) {
+    _text.clear();
+
+    std::size_t its_argument(0);
+    std::size_t its_string_offset(0);
+    for (const char* c = _record.format_; *c != '\0'; ++c) {
+        if (*c != '{') {
+            _text.push_back(*c);
+            continue;
+        }
+        const char* its_end = std::strchr(c, '}');
+        if (its_end == nullptr || its_argument >= _record.argument_count_) {
+            _text.append(c);
+            break;
+        }
+
+        // "{}", "{:x}" or "{:<width>x}" with an optional leading '0'
+        bool is_hex(false), is_zero_padded(false);
+        int its_width(0);
+        if (c[1] == ':') {
+            const char* s = c + 2;
+            if (*s == '0') {
+                is_zero_padded = true;
+                ++s;
+            }
+            for (; *s >= '0' && *s <= '9'; ++s) {
+                its_width = its_width * 10 + (*s - '0');
+            }
+            is_hex = (*s == 'x');
+        }
+
+        char its_buffer[32];
+        const auto& its_value = _record.arguments_[its_argument++];
+        switch (its_value.type_) {
+        case argument::type_e::AT_SIGNED:
+            if (is_hex) {
+                std::snprintf(its_buffer, sizeof(its_buffer), is_zero_padded ? "%0*" PRIx64 : "%*" PRIx64, its_width,
+                              static_cast<std::uint64_t>(its_value.signed_));
+            } else {
+                std::snprintf(its_buffer, sizeof(its_buffer), is_zero_padded ? "%0*" PRId64 : "%*" PRId64, its_width, its_value.signed_);
+            }
+            _text.append(its_buffer);
+            break;
+        case argument::type_e::AT_UNSIGNED:
+            if (is_hex) {
+                std::snprintf(its_buffer, sizeof(its_buffer), is_zero_padded ? "%0*" PRIx64 : "%*" PRIx64, its_width, its_value.unsigned_);
+            } else {
+                std::snprintf(its_buffer, sizeof(its_buffer), is_zero_padded ? "%0*" PRIu64 : "%*" PRIu64, its_width, its_value.unsigned_);
+            }
+            _text.append(its_buffer);
+            break;
+        case argument::type_e::AT_FLOATING:
+            std::snprintf(its_buffer, sizeof(its_buffer), "%g", its_value.floating_);
+            _text.append(its_buffer);
+            break;
+        case argument::type_e::AT_BOOLEAN:
+            _text.append(its_value.unsigned_ ? "true" : "false");
+            break;
+        case argument::type_e::AT_POINTER:
+            std::snprintf(its_buffer, sizeof(its_buffer), "%p", its_value.pointer_);
+            _text.append(its_buffer);
+            break;
+        case argument::type_e::AT_STRING:
+            _text.append(_record.text_, its_string_offset, its_value.string_.length_);
+            its_string_offset += its_value.string_.length_;
+            break;
+        }
+        c = its_end;
+    }
+}
+
+log_writer::log_writer() :
+    is_console_enabled_(false), is_file_enabled_(false), max_size_(0), max_files_(0), file_size_(0), time_(-1), time_prefix_{} { }
+
+void log_writer::set_console(bool _enabled, const std::string& _app_name) {
+    std::scoped_lock its_lock{mutex_};
+    is_console_enabled_ = _enabled;
+    app_name_ = _app_name;
+}
+
+void log_writer::set_file(bool _enabled, const std::string& _path, std::uint64_t _max_size, std::uint32_t _max_files) {
+    std::scoped_lock its_lock{mutex_};
+    if (!_enabled || _path != path_) {
+        file_.close();
+    }
+    is_file_enabled_ = _enabled;
+    path_ = _path;
+    max_size_ = _max_size;
+    max_files_ = _max_files;
+}
+
+void log_writer::write(level_e _level, std::chrono::system_clock::time_point _when, const std::string& _text) {
+    std::scoped_lock its_lock{mutex_};
+    write_unlocked(_level, _when, _text);
+    flush_unlocked();
+}
+
+void log_writer::write(const log_record& _record) {
+    std::scoped_lock its_lock{mutex_};
+    write_unlocked(_record);
+    flush_unlocked();
+}
+
+void log_writer::write(const std::vector<log_record>& _records) {
+    std::scoped_lock its_lock{mutex_};
+    for (const auto& r : _records) {
+        write_unlocked(r);
+    }
+    flush_unlocked();
+}
+
+void log_writer::write_unlocked(const log_record& _record) {
+    if (_record.format_ != nullptr) {
+        format_structured(_record, structured_text_);
+        write_unlocked(_record.level_, _record.when_, structured_text_);
+    } else {
+        write_unlocked(_record.level_, _record.when_, _record.text_);
+    }
+}
+
+void log_writer::write_unlocked(level_e _level, std::chrono::system_clock::time_point _when, const std::string& _text) {
+    format_time(_when);
+
+    // "YYYY-MM-DD HH:MM:SS.uuuuuu "
+    char its_micros[16];
+    auto its_us = std::chrono::duration_cast<std::chrono::microseconds>(_when.time_since_epoch()).count() % 1000000;
+    std::snprintf(its_micros, sizeof(its_micros), ".%06d ", static_cast<int>(its_us));
+
+    if (is_console_enabled_) {
+        line_.assign(time_prefix_);
+        line_.append(its_micros);
+        line_.append(app_name_);
+        line_.append(" [");
+        line_.append(to_string(_level));
+        line_.append("] ");
+        line_.append(_text);
+        line_.push_back('\n');
+        std::cout.write(line_.data(), static_cast<std::streamsize>(line_.size()));
+    }
+
+    if (is_file_enabled_) {
+        line_.assign(time_prefix_);
+        line_.append(its_micros);
+        line_.append("[");
+        line_.append(to_string(_level));
+        line_.append("] ");
+        line_.append(_text);
+        line_.push_back('\n');
+
+        if (!file_.is_open()) {
+            open_file_unlocked();
+        }
+        if (max_size_ > 0 && file_size_ > 0 && file_size_ + line_.size() > max_size_) {
+            rotate_file_unlocked();
+        }
+        if (file_.is_open()) {
+            file_.write(line_.data(), static_cast<std::streamsize>(line_.size()));
+            file_size_ += line_.size();
+        }
+    }
+}
+
+void log_writer::flush_unlocked() {
+    if (is_console_enabled_) {
+        std::cout.flush();
+    }
+    if (file_.is_open()) {
+        file_.flush();
+    }
+}
+
+void log_writer::format_time(std::chrono::system_clock::time_point _when) {
+    auto its_time_t = std::chrono::system_clock::to_time_t(_when);
+    if (its_time_t == time_) {
+        return;
+    }
+
+    struct tm its_time;
+#ifdef _WIN32
+    localtime_s(&its_time, &its_time_t);
+#else
+    localtime_r(&its_time_t, &its_time);
+#endif
+    std::strftime(time_prefix_, sizeof(time_prefix_), "%Y-%m-%d %H:%M:%S", &its_time);
+    time_ = its_time_t;
+}
+
+void log_writer::open_file_unlocked() {
+    {
+        std::ifstream its_existing(path_, std::ios_base::binary | std::ios_base::ate);
+        file_size_ = its_existing.is_open() ? static_cast<std::uint64_t>(its_existing.tellg()) : 0;
+    }
+    file_.clear();
+    file_.open(path_, std::ios_base::app);
+}
+
+void log_writer::rotate_file_unlocked() {
+    file_.close();
+
+    if (max_files_ == 0) {
+        std::remove(path_.c_str());
+    } else {
+        // The oldest file is dropped, all others move up by one
+        std::remove((path_ + "." + std::to_string(max_files_)).c_str());
+        for (std::uint32_t i = max_files_; i > 1; --i) {
+            std::rename((path_ + "." + std::to_string(i - 1)).c_str(), (path_ + "." + std::to_string(i)).c_str());
+        }
+        std::rename(path_.c_str(), (path_ + ".1").c_str());
+    }
+
+    file_.clear();
+    file_.open(path_, std::ios_base::trunc);
+    file_size_ = 0;
+}
+
+} // namespace logger
+} // namespace vsomeip_v3
@@ -15,15 +15,17 @@ namespace logger {
 
 std::mutex logger_impl::mutex__;
 std::string logger_impl::app_name__;
+std::atomic<level_e> logger_impl::level__{level_e::LL_NONE};
 
 void logger_impl::init(const std::shared_ptr<configuration>& _configuration) {
     std::scoped_lock its_lock{mutex__};
     auto its_logger = logger_impl::get();
-    its_logger->set_configuration(_configuration);
 
     const char* its_name = getenv(VSOMEIP_ENV_APPLICATION_NAME);
     app_name__ = (nullptr != its_name) ? its_name : "";
 
+    its_logger->set_configuration(_configuration);
+
 #ifdef USE_DLT
 #define VSOMEIP_LOG_DEFAULT_CONTEXT_ID              "VSIP"
 #define VSOMEIP_LOG_DEFAULT_CONTEXT_NAME            "vSomeIP context"
@@ -38,6 +40,9 @@ void logger_impl::init(const std::shared_ptr<configuration>& _configuration) {
 }
 
 logger_impl::~logger_impl() {
+    // Writes the queued lines
+    async_logger_.reset();
+
 #ifdef USE_DLT
 #ifndef ANDROID
     DLT_UNREGISTER_CONTEXT(dlt_);
@@ -66,6 +71,14 @@ std::string logger_impl::get_logfile() const {
     return cfg_file_name;
 }
 
+void logger_impl::write(log_record&& _record) {
+    if (cfg_async_enabled) {
+        async_logger_->push(std::move(_record));
+    } else {
+        writer_.write(_record);
+    }
+}
+
 const std::string& logger_impl::get_app_name() const {
     return app_name__;
 }
@@ -80,10 +93,29 @@ void logger_impl::set_configuration(const std::shared_ptr<configuration>& _confi
     std::scoped_lock its_lock{configuration_mutex_};
     if (_configuration) {
         cfg_level = _configuration->get_loglevel();
+        level__ = cfg_level.load();
         cfg_console_enabled = _configuration->has_console_log();
         cfg_dlt_enabled = _configuration->has_dlt_log();
         cfg_file_enabled = _configuration->has_file_log();
         cfg_file_name = _configuration->get_logfile();
+
+#ifndef ANDROID
+        writer_.set_console(cfg_console_enabled, app_name__);
+#endif
+        writer_.set_file(cfg_file_enabled, cfg_file_name, _configuration->get_logfile_max_size(), _configuration->get_logfile_max_files());
+
+        if (_configuration->has_async_log()) {
+            if (!async_logger_) {
+                async_logger_ = std::make_unique<async_logger>(_configuration->get_async_log_queue_size(),
+                                                               _configuration->is_async_log_blocking(),
+                                                               [this](const std::vector<log_record>& _records) { writer_.write(_records); });
+            } else {
+                async_logger_->set_blocking(_configuration->is_async_log_blocking());
+            }
+            cfg_async_enabled = true;
+        } else {
+            cfg_async_enabled = false;
+        }
     }
 }
 
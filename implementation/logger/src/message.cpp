@@ -3,10 +3,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <chrono>
-#include <ctime>
-#include <fstream>
-#include <iomanip>
 #include <iostream>
 
 #ifdef ANDROID
@@ -68,111 +66,105 @@
 namespace vsomeip_v3 {
 namespace logger {
 
-std::mutex message::mutex__;
+namespace {
 
-message::message(level_e _level) : std::ostream(&buffer_), level_(_level) {
-
-    when_ = std::chrono::system_clock::now();
-}
-
-message::~message() try {
-    std::scoped_lock its_lock{mutex__};
-    auto its_logger = logger_impl::get();
-
-    if (level_ > its_logger->get_loglevel())
-        return;
+// Passes a line to Android logging, the console / file writer and DLT.
+// Structured lines are only formatted here if Android logging or DLT need them.
+void emit(logger_impl& _logger, log_record&& _record) {
+    std::string its_text;
+    [[maybe_unused]] const auto get_text = [&_record, &its_text]() -> const std::string& {
+        if (_record.format_ == nullptr) {
+            return _record.text_;
+        }
+        if (its_text.empty()) {
+            format_structured(_record, its_text);
+        }
+        return its_text;
+    };
 
-    if (its_logger->has_console_log() || its_logger->has_file_log()) {
+#ifdef ANDROID
+    if (_logger.has_console_log()) {
+        std::string app = runtime::get_property("LogApplication");
+        const std::string its_line("VSIP: " + get_text());
 
-        // Prepare log level
-        const char* its_level;
-        switch (level_) {
+        switch (_record.level_) {
         case level_e::LL_FATAL:
-            its_level = "fatal";
+            ALOGE(app.c_str(), its_line.c_str());
             break;
         case level_e::LL_ERROR:
-            its_level = "error";
+            ALOGE(app.c_str(), its_line.c_str());
             break;
         case level_e::LL_WARNING:
-            its_level = "warning";
+            ALOGW(app.c_str(), its_line.c_str());
             break;
         case level_e::LL_INFO:
-            its_level = "info";
+            ALOGI(app.c_str(), its_line.c_str());
             break;
         case level_e::LL_DEBUG:
-            its_level = "debug";
+            ALOGD(app.c_str(), its_line.c_str());
             break;
         case level_e::LL_VERBOSE:
-            its_level = "verbose";
+            ALOGV(app.c_str(), its_line.c_str());
             break;
         default:
-            its_level = "none";
+            ALOGI(app.c_str(), its_line.c_str());
         };
-
-        // Prepare time stamp
-        auto its_time_t = std::chrono::system_clock::to_time_t(when_);
-        struct tm its_time;
-#ifdef _WIN32
-        localtime_s(&its_time, &its_time_t);
-#else
-        localtime_r(&its_time_t, &its_time);
-#endif
-        auto its_ms = std::chrono::duration_cast<std::chrono::microseconds>(when_.time_since_epoch()).count() % 1000000;
-
-        if (its_logger->has_console_log()) {
-#ifndef ANDROID
-            {
-                std::unique_lock<std::mutex> app_name_lock = its_logger->get_app_name_lock();
-                std::cout << std::dec << std::setw(4) << its_time.tm_year + 1900 << "-" << std::setfill('0') << std::setw(2)
-                          << its_time.tm_mon + 1 << "-" << std::setw(2) << its_time.tm_mday << " " << std::setw(2) << its_time.tm_hour
-                          << ":" << std::setw(2) << its_time.tm_min << ":" << std::setw(2) << its_time.tm_sec << "." << std::setw(6)
-                          << its_ms << " " << its_logger->get_app_name() << " [" << its_level << "] " << buffer_.data_.str() << std::endl;
-            }
-#else
-            std::string app = runtime::get_property("LogApplication");
-
-            switch (level_) {
-            case level_e::LL_FATAL:
-                ALOGE(app.c_str(), ("VSIP: " + buffer_.data_.str()).c_str());
-                break;
-            case level_e::LL_ERROR:
-                ALOGE(app.c_str(), ("VSIP: " + buffer_.data_.str()).c_str());
-                break;
-            case level_e::LL_WARNING:
-                ALOGW(app.c_str(), ("VSIP: " + buffer_.data_.str()).c_str());
-                break;
-            case level_e::LL_INFO:
-                ALOGI(app.c_str(), ("VSIP: " + buffer_.data_.str()).c_str());
-                break;
-            case level_e::LL_DEBUG:
-                ALOGD(app.c_str(), ("VSIP: " + buffer_.data_.str()).c_str());
-                break;
-            case level_e::LL_VERBOSE:
-                ALOGV(app.c_str(), ("VSIP: " + buffer_.data_.str()).c_str());
-                break;
-            default:
-                ALOGI(app.c_str(), ("VSIP: " + buffer_.data_.str()).c_str());
-            };
-#endif // !ANDROID
-        }
-
-        if (its_logger->has_file_log()) {
-            std::ofstream its_logfile(its_logger->get_logfile(), std::ios_base::app);
-            if (its_logfile.is_open()) {
-                its_logfile << std::dec << std::setw(4) << its_time.tm_year + 1900 << "-" << std::setfill('0') << std::setw(2)
-                            << its_time.tm_mon + 1 << "-" << std::setw(2) << its_time.tm_mday << " " << std::setw(2) << its_time.tm_hour
-                            << ":" << std::setw(2) << its_time.tm_min << ":" << std::setw(2) << its_time.tm_sec << "." << std::setw(6)
-                            << its_ms << " [" << its_level << "] " << buffer_.data_.str() << std::endl;
-            }
-        }
     }
-    if (its_logger->has_dlt_log()) {
+#endif // ANDROID
+
+    if (_logger.has_dlt_log()) {
 #ifdef USE_DLT
 #ifndef ANDROID
-        its_logger->log(level_, buffer_.data_.str().c_str());
+        _logger.log(_record.level_, get_text().c_str());
 #endif
 #endif // USE_DLT
     }
+
+    if (_logger.has_console_log() || _logger.has_file_log()) {
+        _logger.write(std::move(_record));
+    }
+}
+
+} // namespace
+
+bool is_enabled(level_e _level) {
+    return logger_impl::is_enabled(_level);
+}
+
+void log_structured(level_e _level, const char* _format, const argument* _arguments, std::size_t _count) try {
+    auto its_logger = logger_impl::get();
+
+    if (_level > its_logger->get_loglevel())
+        return;
+
+    log_record its_record{_level, std::chrono::system_clock::now(), std::string()};
+    its_record.format_ = _format;
+    its_record.argument_count_ = std::min(_count, max_structured_arguments);
+    for (std::size_t i = 0; i < its_record.argument_count_; ++i) {
+        its_record.arguments_[i] = _arguments[i];
+        if (_arguments[i].type_ == argument::type_e::AT_STRING) {
+            its_record.text_.append(_arguments[i].string_.data_, _arguments[i].string_.length_);
+            its_record.arguments_[i].string_.data_ = nullptr;
+        }
+    }
+
+    emit(*its_logger, std::move(its_record));
+} catch (const std::exception& e) {
+    std::cerr << "\nVSIP: Error logging structured message: " << e.what() << '\n';
+}
+
+message::message(level_e _level) : std::ostream(&buffer_), level_(_level) {
+
+    when_ = std::chrono::system_clock::now();
+}
+
+message::~message() try {
+    auto its_logger = logger_impl::get();
+
+    if (level_ > its_logger->get_loglevel())
+        return;
+
+    emit(*its_logger, log_record{level_, when_, buffer_.data_.str()});
 } catch (const std::exception& e) {
     std::cerr << "\nVSIP: Error destroying message class: " << e.what() << '\n';
     return;
@@ -28,6 +28,9 @@ public:
 
     VSOMEIP_EXPORT void set_data(const byte_t* _data, std::size_t _length);
     VSOMEIP_EXPORT void set_data(const std::vector<byte_t>& _data);
+    // Refers to "_data" instead of copying it. The data must stay valid
+    // until reset is called or other data is set.
+    VSOMEIP_EXPORT void set_view(const byte_t* _data, std::size_t _length);
     VSOMEIP_EXPORT void append_data(const byte_t* _data, std::size_t _length);
     VSOMEIP_EXPORT void drop_data(std::size_t _length);
 
@@ -57,8 +60,13 @@ public:
     VSOMEIP_EXPORT void show() const;
 #endif
 protected:
+    void rebase();
+
+    // Owned data, unused while a view is set
     std::vector<byte_t> data_;
-    std::vector<byte_t>::iterator position_;
+    const byte_t* begin_;
+    const byte_t* end_;
+    const byte_t* position_;
     std::size_t remaining_;
 
 private:
@@ -18,20 +18,29 @@
 namespace vsomeip_v3 {
 
 deserializer::deserializer(std::uint32_t _buffer_shrink_threshold) :
-    position_(data_.begin()), remaining_(0), buffer_shrink_threshold_(_buffer_shrink_threshold), shrink_count_(0) { }
+    begin_(nullptr), end_(nullptr), position_(nullptr), remaining_(0), buffer_shrink_threshold_(_buffer_shrink_threshold),
+    shrink_count_(0) { }
 
 deserializer::deserializer(byte_t* _data, std::size_t _length, std::uint32_t _buffer_shrink_threshold) :
-    data_(_data, _data + _length), position_(data_.begin()), remaining_(_length), buffer_shrink_threshold_(_buffer_shrink_threshold),
-    shrink_count_(0) { }
+    data_(_data, _data + _length), remaining_(_length), buffer_shrink_threshold_(_buffer_shrink_threshold), shrink_count_(0) {
+    rebase();
+}
 
 deserializer::deserializer(const deserializer& _other) :
-    data_(_other.data_), position_(_other.position_), remaining_(_other.remaining_),
-    buffer_shrink_threshold_(_other.buffer_shrink_threshold_), shrink_count_(_other.shrink_count_) { }
+    data_(_other.data_), begin_(_other.begin_), end_(_other.end_), position_(_other.position_), remaining_(_other.remaining_),
+    buffer_shrink_threshold_(_other.buffer_shrink_threshold_), shrink_count_(_other.shrink_count_) {
+
+    // A view keeps referring to the same data, owned data is copied
+    if (_other.begin_ == _other.data_.data()) {
+        rebase();
+        position_ = begin_ + (_other.position_ - _other.begin_);
+    }
+}
 
 deserializer::~deserializer() { }
 
 std::size_t deserializer::get_available() const {
-    return data_.size();
+    return static_cast<std::size_t>(end_ - begin_);
 }
 
 std::size_t deserializer::get_remaining() const {
@@ -91,8 +100,8 @@ bool deserializer::deserialize(uint8_t* _data, std::size_t _length) {
     if (_length > remaining_)
         return false;
 
-    std::memcpy(_data, &data_[static_cast<std::vector<byte_t>::size_type>(position_ - data_.begin())], _length);
-    position_ += static_cast<std::vector<byte_t>::difference_type>(_length);
+    std::memcpy(_data, position_, _length);
+    position_ += _length;
     remaining_ -= _length;
 
     return true;
@@ -102,8 +111,8 @@ bool deserializer::deserialize(std::string& _target, std::size_t _length) {
     if (_length > remaining_ || _length > _target.capacity()) {
         return false;
     }
-    _target.assign(position_, position_ + static_cast<std::vector<byte_t>::difference_type>(_length));
-    position_ += static_cast<std::vector<byte_t>::difference_type>(_length);
+    _target.assign(position_, position_ + _length);
+    position_ += _length;
     remaining_ -= _length;
 
     return true;
@@ -113,8 +122,8 @@ bool deserializer::deserialize(std::vector<uint8_t>& _value) {
     if (_value.capacity() > remaining_)
         return false;
 
-    _value.assign(position_, position_ + static_cast<std::vector<byte_t>::difference_type>(_value.capacity()));
-    position_ += static_cast<std::vector<byte_t>::difference_type>(_value.capacity());
+    _value.assign(position_, position_ + _value.capacity());
+    position_ += _value.capacity();
     remaining_ -= _value.capacity();
 
     return true;
@@ -124,7 +133,7 @@ bool deserializer::look_ahead(std::size_t _index, uint8_t& _value) const {
     if (_index > remaining_)
         return false;
 
-    _value = *(position_ + static_cast<std::vector<byte_t>::difference_type>(_index));
+    _value = *(position_ + _index);
 
     return true;
 }
@@ -133,8 +142,7 @@ bool deserializer::look_ahead(std::size_t _index, uint16_t& _value) const {
     if (_index + 1 > remaining_)
         return false;
 
-    std::vector<uint8_t>::iterator i = position_ + static_cast<std::vector<byte_t>::difference_type>(_index);
-    _value = bithelper::read_uint16_be(&(*i));
+    _value = bithelper::read_uint16_be(position_ + _index);
 
     return true;
 }
@@ -143,8 +151,7 @@ bool deserializer::look_ahead(std::size_t _index, uint32_t& _value) const {
     if (_index + 3 > remaining_)
         return false;
 
-    std::vector<uint8_t>::const_iterator i = position_ + static_cast<std::vector<byte_t>::difference_type>(_index);
-    _value = bithelper::read_uint32_be(&(*i));
+    _value = bithelper::read_uint32_be(position_ + _index);
 
     return true;
 }
@@ -165,34 +172,56 @@ message_impl* deserializer::deserialize_message() try {
 void deserializer::set_data(const byte_t* _data, std::size_t _length) {
     if (0 != _data) {
         data_.assign(_data, _data + _length);
-        position_ = data_.begin();
-        remaining_ = static_cast<std::vector<byte_t>::size_type>(data_.end() - position_);
     } else {
         data_.clear();
-        position_ = data_.end();
-        remaining_ = 0;
     }
+    rebase();
+    remaining_ = data_.size();
 }
 
 void deserializer::set_data(const std::vector<byte_t>& _data) {
 
-    data_ = std::move(_data);
-    position_ = data_.begin();
+    data_ = _data;
+    rebase();
     remaining_ = data_.size();
 }
 
+void deserializer::set_view(const byte_t* _data, std::size_t _length) {
+
+    data_.clear();
+    if (0 != _data) {
+        begin_ = _data;
+        end_ = _data + _length;
+    } else {
+        begin_ = end_ = nullptr;
+    }
+    position_ = begin_;
+    remaining_ = static_cast<std::size_t>(end_ - begin_);
+}
+
 void deserializer::append_data(const byte_t* _data, std::size_t _length) {
-    std::vector<byte_t>::difference_type offset = (position_ - data_.begin());
+    const auto offset = position_ - begin_;
+    if (begin_ != data_.data()) {
+        // Appending to a view requires a copy of the viewed data
+        data_.assign(begin_, end_);
+    }
     data_.insert(data_.end(), _data, _data + _length);
-    position_ = data_.begin() + offset;
+    rebase();
+    position_ = begin_ + offset;
     remaining_ += _length;
 }
 
 void deserializer::drop_data(std::size_t _length) {
-    if (position_ + static_cast<std::vector<byte_t>::difference_type>(_length) < data_.end())
-        position_ += static_cast<std::vector<byte_t>::difference_type>(_length);
+    if (_length < static_cast<std::size_t>(end_ - position_))
+        position_ += _length;
     else
-        position_ = data_.end();
+        position_ = end_;
+}
+
+void deserializer::rebase() {
+    begin_ = data_.data();
+    end_ = begin_ + data_.size();
+    position_ = begin_;
 }
 
 void deserializer::reset() {
@@ -204,12 +233,12 @@ void deserializer::reset() {
         }
     }
     data_.clear();
-    position_ = data_.begin();
-    remaining_ = data_.size();
     if (buffer_shrink_threshold_ && shrink_count_ > buffer_shrink_threshold_) {
         data_.shrink_to_fit();
         shrink_count_ = 0;
     }
+    rebase();
+    remaining_ = 0;
 }
 
 #ifdef VSOMEIP_DEBUGGING
@@ -220,8 +249,8 @@ void deserializer::show() const {
             << static_cast<int>(*position_ << ", "
             << std:: dec << remaining_ << ") "
             << std::hex << std::setfill('0');
-    for (int i = 0; i < data_.size(); ++i)
-        its_message << std::setw(2) << static_cast<int>(data_[i]) << " ";
+    for (const byte_t* i = begin_; i < end_; ++i)
+        its_message << std::setw(2) << static_cast<int>(*i) << " ";
     VSOMEIP_INFO << its_message;
 }
 #endif
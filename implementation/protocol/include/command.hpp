@@ -30,6 +30,10 @@ public:
     virtual void deserialize(const std::vector<byte_t>& _buffer, error_e& _error);
 
 protected:
+    // Header (de)serialization on raw buffers of at least COMMAND_HEADER_SIZE bytes
+    void serialize_header(byte_t* _buffer, error_e& _error) const;
+    void deserialize_header(const byte_t* _buffer, error_e& _error);
+
     id_e id_;
     version_t version_;
     client_t client_;
@@ -15,9 +15,20 @@ class send_command : public command {
 public:
     send_command(id_e _id);
 
+    send_command(const send_command&) = delete;
+    send_command& operator=(const send_command&) = delete;
+
     void serialize(std::vector<byte_t>& _buffer, error_e& _error) const;
     void deserialize(const std::vector<byte_t>& _buffer, error_e& _error);
 
+    // Zero-copy variants: "serialize" writes the SEND_COMMAND_HEADER_SIZE
+    // bytes of the header into "_header", which must directly precede the
+    // "_message_size" bytes of the (caller owned) message. "deserialize"
+    // does not copy the message but refers to it within "_buffer", which
+    // therefore must outlive its use by get_message_data().
+    void serialize(byte_t* _header, std::size_t _message_size, error_e& _error) const;
+    void deserialize(const byte_t* _buffer, std::size_t _size, error_e& _error);
+
     instance_t get_instance() const;
     void set_instance(instance_t _instance);
 
@@ -30,9 +41,11 @@ public:
     client_t get_target() const;
     void set_target(client_t _target);
 
-    // TODO: Optimize this as the vector might be huge!
     std::vector<byte_t> get_message() const;
-    void set_message(const std::vector<byte_t>& _message);
+    void set_message(std::vector<byte_t> _message);
+
+    const byte_t* get_message_data() const;
+    std::size_t get_message_size() const;
 
 private:
     instance_t instance_;
@@ -40,6 +53,10 @@ private:
     uint8_t status_; // TODO: DO WE REALLY NEED THIS?
     client_t target_;
     std::vector<byte_t> message_;
+
+    // Either refers to message_ or into the buffer given to deserialize
+    const byte_t* message_data_;
+    std::size_t message_size_;
 };
 
 } // namespace protocol
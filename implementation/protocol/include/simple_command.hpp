@@ -15,6 +15,7 @@ class simple_command : public command {
 public:
     void serialize(std::vector<byte_t>& _buffer, error_e& _error) const;
     void deserialize(const std::vector<byte_t>& _buffer, error_e& _error);
+    void deserialize(const byte_t* _buffer, std::size_t _size, error_e& _error);
 
 protected:
     simple_command(id_e _id);
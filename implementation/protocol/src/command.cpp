@@ -15,6 +15,11 @@ void command::serialize(std::vector<byte_t>& _buffer, error_e& _error) const {
     // buffer space reservation is done within the code of
     // the derived classes that call this method
 
+    serialize_header(&_buffer[0], _error);
+}
+
+void command::serialize_header(byte_t* _buffer, error_e& _error) const {
+
     _buffer[0] = static_cast<byte_t>(id_);
     std::memcpy(&_buffer[COMMAND_POSITION_VERSION], &version_, sizeof(version_));
     std::memcpy(&_buffer[COMMAND_POSITION_CLIENT], &client_, sizeof(client_));
@@ -29,6 +34,11 @@ void command::deserialize(const std::vector<byte_t>& _buffer, error_e& _error) {
     // done within the code of the derived classes
     // that call this method
 
+    deserialize_header(&_buffer[0], _error);
+}
+
+void command::deserialize_header(const byte_t* _buffer, error_e& _error) {
+
     // If the id_ is set to "UNKNOWN", read it.
     // Otherwise check it.
     if (id_ == id_e::UNKNOWN_ID) {
@@ -10,7 +10,8 @@
 namespace vsomeip_v3 {
 namespace protocol {
 
-send_command::send_command(id_e _id) : command(_id) { }
+send_command::send_command(id_e _id) :
+    command(_id), instance_(0), is_reliable_(false), status_(0), target_(0), message_data_(nullptr), message_size_(0) { }
 
 instance_t send_command::get_instance() const {
 
@@ -54,17 +55,43 @@ void send_command::set_target(client_t _target) {
 
 std::vector<byte_t> send_command::get_message() const {
 
-    return message_;
+    return std::vector<byte_t>(message_data_, message_data_ + message_size_);
 }
 
-void send_command::set_message(const std::vector<byte_t>& _message) {
+void send_command::set_message(std::vector<byte_t> _message) {
 
     message_ = std::move(_message);
+    message_data_ = message_.data();
+    message_size_ = message_.size();
+}
+
+const byte_t* send_command::get_message_data() const {
+
+    return message_data_;
+}
+
+std::size_t send_command::get_message_size() const {
+
+    return message_size_;
 }
 
 void send_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) const {
 
-    size_t its_size(COMMAND_HEADER_SIZE + sizeof(instance_) + sizeof(is_reliable_) + sizeof(status_) + sizeof(target_) + message_.size());
+    // resize buffer
+    _buffer.resize(SEND_COMMAND_HEADER_SIZE + message_size_);
+
+    serialize(&_buffer[0], message_size_, _error);
+    if (_error != error_e::ERROR_OK)
+        return;
+
+    // serialize message
+    if (message_size_ > 0)
+        std::memcpy(&_buffer[SEND_COMMAND_HEADER_SIZE], message_data_, message_size_);
+}
+
+void send_command::serialize(byte_t* _header, std::size_t _message_size, error_e& _error) const {
+
+    size_t its_size(COMMAND_HEADER_SIZE + sizeof(instance_) + sizeof(is_reliable_) + sizeof(status_) + sizeof(target_) + _message_size);
 
     if (its_size > std::numeric_limits<command_size_t>::max()) {
 
@@ -72,42 +99,45 @@ void send_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) cons
         return;
     }
 
-    // resize buffer
-    _buffer.resize(its_size);
-
     // set size
     size_ = static_cast<command_size_t>(its_size - COMMAND_HEADER_SIZE);
 
     // serialize header
-    command::serialize(_buffer, _error);
+    serialize_header(_header, _error);
     if (_error != error_e::ERROR_OK)
         return;
 
     // serialize payload
     size_t its_offset(COMMAND_POSITION_PAYLOAD);
-    std::memcpy(&_buffer[its_offset], &instance_, sizeof(instance_));
+    std::memcpy(&_header[its_offset], &instance_, sizeof(instance_));
     its_offset += sizeof(instance_);
-    _buffer[its_offset] = static_cast<byte_t>(is_reliable_);
+    _header[its_offset] = static_cast<byte_t>(is_reliable_);
     its_offset += sizeof(is_reliable_);
-    _buffer[its_offset] = static_cast<byte_t>(status_);
+    _header[its_offset] = static_cast<byte_t>(status_);
     its_offset += sizeof(status_);
-    std::memcpy(&_buffer[its_offset], &target_, sizeof(target_));
-    its_offset += sizeof(target_);
-    std::memcpy(&_buffer[its_offset], &message_[0], message_.size());
+    std::memcpy(&_header[its_offset], &target_, sizeof(target_));
 }
 
 void send_command::deserialize(const std::vector<byte_t>& _buffer, error_e& _error) {
 
-    size_t its_size(COMMAND_HEADER_SIZE + sizeof(instance_) + sizeof(is_reliable_) + sizeof(status_) + sizeof(target_));
+    deserialize(_buffer.data(), _buffer.size(), _error);
+    if (_error != error_e::ERROR_OK)
+        return;
+
+    // own the message, as the buffer might be gone when it is used
+    set_message(std::vector<byte_t>(message_data_, message_data_ + message_size_));
+}
 
-    if (its_size > _buffer.size()) {
+void send_command::deserialize(const byte_t* _buffer, std::size_t _size, error_e& _error) {
+
+    if (SEND_COMMAND_HEADER_SIZE > _size) {
 
         _error = error_e::ERROR_NOT_ENOUGH_BYTES;
         return;
     }
 
     // deserialize header
-    command::deserialize(_buffer, _error);
+    deserialize_header(_buffer, _error);
     if (_error != error_e::ERROR_OK)
         return;
 
@@ -121,8 +151,9 @@ void send_command::deserialize(const std::vector<byte_t>& _buffer, error_e& _err
     its_offset += sizeof(status_);
     std::memcpy(&target_, &_buffer[its_offset], sizeof(target_));
     its_offset += sizeof(target_);
-    message_.resize(_buffer.size() - its_offset);
-    std::memcpy(&message_[0], &_buffer[its_offset], message_.size());
+
+    message_data_ = &_buffer[its_offset];
+    message_size_ = _size - its_offset;
 }
 
 } // namespace protocol
@@ -28,13 +28,18 @@ void simple_command::serialize(std::vector<byte_t>& _buffer, error_e& _error) co
 
 void simple_command::deserialize(const std::vector<byte_t>& _buffer, error_e& _error) {
 
-    if (_buffer.size() < COMMAND_HEADER_SIZE) {
+    deserialize(_buffer.data(), _buffer.size(), _error);
+}
+
+void simple_command::deserialize(const byte_t* _buffer, std::size_t _size, error_e& _error) {
+
+    if (_size < COMMAND_HEADER_SIZE) {
 
         _error = error_e::ERROR_NOT_ENOUGH_BYTES;
         return;
     }
 
-    command::deserialize(_buffer, _error);
+    deserialize_header(_buffer, _error);
 }
 
 } // namespace protocol
@@ -0,0 +1,44 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_CHANGE_DETECTOR_HPP
+#define VSOMEIP_V3_CHANGE_DETECTOR_HPP
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../configuration/include/change_filter.hpp"
+
+namespace vsomeip_v3 {
+
+class payload;
+
+// Compiled form of a change filter. The ignored bits are turned into a per
+// byte compare mask once, so that the check of an update is a single masked
+// (SIMD) compare over the payload plus the numeric tolerance checks instead
+// of a map lookup per byte.
+class change_detector {
+public:
+    explicit change_detector(const change_filter_t& _filter);
+    explicit change_detector(const std::map<std::size_t, byte_t>& _ignore);
+
+    bool has_changed(const std::shared_ptr<payload>& _old, const std::shared_ptr<payload>& _new) const;
+    bool has_changed(const byte_t* _old, std::size_t _old_length, const byte_t* _new, std::size_t _new_length) const;
+
+private:
+    bool is_ignored(std::size_t _index) const;
+    bool exceeds_tolerance(const change_filter_t::tolerance_t& _tolerance, const byte_t* _old, const byte_t* _new) const;
+
+    // Bits that must be equal; bytes behind the mask are compared completely
+    std::vector<byte_t> mask_;
+    std::vector<change_filter_t::tolerance_t> tolerances_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_CHANGE_DETECTOR_HPP
@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <vector>
 #include <atomic>
 
 #include <boost/asio/ip/address.hpp>
@@ -20,6 +21,9 @@
 #include <vsomeip/function_types.hpp>
 #include <vsomeip/payload.hpp>
 
+#include "types.hpp"
+#include "../../utility/include/snapshot.hpp"
+
 namespace vsomeip_v3 {
 
 class endpoint;
@@ -28,10 +32,14 @@ class message;
 class payload;
 class routing_manager;
 
+class change_detector;
 struct debounce_filter_impl_t;
 
 class event : public std::enable_shared_from_this<event> {
 public:
+    // Sorted and duplicate free list of subscribed clients
+    using subscribers_t = std::vector<client_t>;
+
     event(routing_manager* _routing, bool _is_shadow = false);
 
     service_t get_service() const;
@@ -58,7 +66,8 @@ public:
 
     bool set_payload_notify_pending(const std::shared_ptr<payload>& _payload);
 
-    void set_payload(const std::shared_ptr<payload>& _payload, bool _force);
+    // Returns true if the event is provided and the payload was accepted
+    bool set_payload(const std::shared_ptr<payload>& _payload, bool _force);
     void unset_payload(bool _force = false);
 
     event_type_e get_type() const;
@@ -83,6 +92,10 @@ public:
     // SIP_RPC_359 (epsilon change)
     void set_epsilon_change_function(const epsilon_change_func_t& _epsilon_change_func);
 
+    // Configured change filter, checked once per update before any client
+    // specific filtering. Updates that do not change the event are dropped.
+    void set_change_detector(const std::shared_ptr<change_detector>& _change_detector);
+
     std::set<eventgroup_t> get_eventgroups() const;
     std::set<eventgroup_t> get_eventgroups(client_t _client) const;
     void add_eventgroup(eventgroup_t _eventgroup);
@@ -95,8 +108,9 @@ public:
     void remove_subscriber(eventgroup_t _eventgroup, client_t _client);
     bool has_subscriber(eventgroup_t _eventgroup, client_t _client);
     std::set<client_t> get_subscribers();
-    std::set<client_t> get_filtered_subscribers(bool _force);
-    std::set<client_t> update_and_get_filtered_subscribers(const std::shared_ptr<payload>& _payload, bool _force);
+    std::shared_ptr<const subscribers_t> get_fanout() const;
+    std::shared_ptr<const subscribers_t> get_filtered_subscribers(bool _force);
+    std::shared_ptr<const subscribers_t> update_and_get_filtered_subscribers(const std::shared_ptr<payload>& _payload, bool _force);
     VSOMEIP_EXPORT std::set<client_t> get_subscribers(eventgroup_t _eventgroup);
     void clear_subscribers();
 
@@ -115,6 +129,11 @@ public:
 
     void remove_pending(const std::shared_ptr<endpoint_definition>& _target);
 
+    // Remote targets of the eventgroups, merged according to the reliability
+    // of the event. Set by the eventgroups whenever their subscriptions change.
+    void set_remote_targets(eventgroup_t _eventgroup, const std::shared_ptr<const remote_targets_t>& _targets);
+    std::shared_ptr<const remote_targets_t> get_remote_targets() const;
+
     void set_session();
 
 private:
@@ -133,7 +152,10 @@ private:
     bool prepare_update_payload_unlocked(const std::shared_ptr<payload>& _payload, bool _force);
     void update_payload_unlocked();
 
-    void get_pending_updates(const std::set<client_t>& _clients);
+    void get_pending_updates(const subscribers_t& _clients);
+
+    void update_fanout_unlocked();
+    void update_remote_targets_unlocked();
 
 private:
     routing_manager* routing_;
@@ -153,6 +175,13 @@ private:
     mutable std::mutex eventgroups_mutex_;
     std::map<eventgroup_t, std::set<client_t>> eventgroups_;
 
+    // Subscribers of all eventgroups, rebuilt whenever "eventgroups_" changes.
+    snapshot<subscribers_t> fanout_;
+
+    std::mutex remote_targets_mutex_;
+    std::map<eventgroup_t, std::shared_ptr<const remote_targets_t>> eventgroup_targets_;
+    snapshot<remote_targets_t> remote_targets_;
+
     std::atomic<bool> is_set_;
     std::atomic<bool> is_provided_;
 
@@ -165,12 +194,15 @@ private:
     epsilon_change_func_t epsilon_change_func_;
     bool has_default_epsilon_change_func_;
 
+    std::shared_ptr<change_detector> change_detector_;
+
     std::atomic<reliability_type_e> reliability_;
 
     std::set<std::shared_ptr<endpoint_definition>> pending_;
 
     std::mutex filters_mutex_;
     std::map<client_t, epsilon_change_func_t> filters_;
+    std::atomic<bool> has_filters_;
 };
 
 } // namespace vsomeip_v3
@@ -21,6 +21,7 @@
 
 #include "remote_subscription.hpp"
 #include "types.hpp"
+#include "../../utility/include/snapshot.hpp"
 
 #if defined(__QNX__)
 #include "../../utility/include/qnx_helper.hpp"
@@ -40,6 +41,9 @@ public:
         bool operator==(const subscription_t& _other) const { return (subscription_ == _other.subscription_); }
     };
 
+    // Sorted and duplicate free list of unicast subscriber endpoints
+    using targets_t = std::vector<std::shared_ptr<endpoint_definition>>;
+
     VSOMEIP_EXPORT eventgroupinfo();
     VSOMEIP_EXPORT eventgroupinfo(const service_t _service, const service_t _instance, const eventgroup_t _eventgroup,
                                   const major_version_t _major, const ttl_t _ttl, const uint8_t _max_remote_subscribers);
@@ -89,6 +93,8 @@ public:
     void clear_remote_subscriptions();
 
     VSOMEIP_EXPORT std::set<std::shared_ptr<endpoint_definition>> get_unicast_targets() const;
+    std::shared_ptr<const targets_t> get_unicast_fanout() const;
+    std::shared_ptr<const remote_targets_t> get_remote_targets() const;
     VSOMEIP_EXPORT std::set<std::shared_ptr<endpoint_definition>> get_multicast_targets() const;
 
     VSOMEIP_EXPORT uint8_t get_threshold() const;
@@ -104,6 +110,8 @@ public:
 
 private:
     void update_id();
+    void update_fanout_unlocked();
+    void update_event_targets() const;
     uint32_t get_unreliable_target_count() const;
 
     std::atomic<service_t> service_;
@@ -126,6 +134,11 @@ private:
     remote_subscription_id_t id_;
     std::map<boost::asio::ip::address, uint8_t> remote_subscribers_count_;
 
+    // Unicast targets of all subscriptions, rebuilt whenever "subscriptions_" changes.
+    snapshot<targets_t> unicast_fanout_;
+    // Unicast and multicast targets as used for sending, published to the events.
+    snapshot<remote_targets_t> remote_targets_;
+
     std::atomic<reliability_type_e> reliability_;
     std::atomic<bool> reliability_auto_mode_;
 
@@ -93,6 +93,8 @@ public:
 
     virtual void notify(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload, bool _force) = 0;
 
+    virtual std::vector<bool> notify_batch(const std::vector<notification_t>& _notifications, bool _force) = 0;
+
     virtual void notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload, client_t _client,
                             bool _force
 #ifdef VSOMEIP_ENABLE_COMPAT
@@ -110,7 +112,11 @@ public:
     virtual void register_debounce(const std::shared_ptr<debounce_filter_impl_t>& _filter, client_t _client,
                                    const std::shared_ptr<vsomeip_v3::event>& _event) = 0;
     virtual void remove_debounce(client_t _client, event_t _event) = 0;
-    virtual void update_debounce_clients(const std::set<client_t>& _clients, event_t _event) = 0;
+    // _clients must be sorted
+    virtual void update_debounce_clients(const std::vector<client_t>& _clients, event_t _event) = 0;
+
+    // Fills the endpoint and service discovery metrics
+    virtual void get_metrics(metrics_t& _metrics) const = 0;
 };
 
 } // namespace vsomeip_v3
@@ -31,11 +31,13 @@
 #if defined(__QNX__)
 #include "../../utility/include/qnx_helper.hpp"
 #endif
+#include "../../utility/include/instrumentation.hpp"
 #include "../../utility/include/service_instance_map.hpp"
+#include "../../utility/include/snapshot.hpp"
 
 namespace vsomeip_v3 {
 
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
 namespace trace {
 class connector_impl;
 } // namespace trace
@@ -67,7 +69,9 @@ public:
     virtual void register_debounce(const std::shared_ptr<debounce_filter_impl_t>& _filter, client_t _client,
                                    const std::shared_ptr<vsomeip_v3::event>& _event);
     virtual void remove_debounce(client_t _client, event_t _event);
-    virtual void update_debounce_clients(const std::set<client_t>& _clients, event_t _event);
+    virtual void update_debounce_clients(const std::vector<client_t>& _clients, event_t _event);
+
+    virtual void get_metrics(metrics_t& _metrics) const;
 
     virtual bool is_routing_manager() const;
 
@@ -103,6 +107,8 @@ public:
 
     virtual void notify(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload, bool _force);
 
+    virtual std::vector<bool> notify_batch(const std::vector<notification_t>& _notifications, bool _force);
+
     virtual void notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload, client_t _client,
                             bool _force
 #ifdef VSOMEIP_ENABLE_COMPAT
@@ -254,9 +260,15 @@ protected:
     eventgroups_t eventgroups_;
 
     // Events (part of one or more eventgroups)
-    mutable std::mutex events_mutex_;
+    mutable named_mutex events_mutex_;
     service_instance_map<std::unordered_map<event_t, std::shared_ptr<event>>> events_;
 
+    // Read-only copies of "services_" and "events_" used by find_service/find_event
+    // on the data path. Must be republished (with the corresponding mutex held)
+    // whenever the authoritative table is modified.
+    void publish_services_unlocked();
+    void publish_events_unlocked(service_t _service, instance_t _instance);
+
     boost::asio::steady_timer debounce_timer;
     std::multimap<std::chrono::steady_clock::time_point,
                   std::tuple<client_t, bool, std::function<void(const boost::system::error_code)>, event_t>>
@@ -297,7 +309,7 @@ protected:
 
     std::atomic<routing_state_e> routing_state_;
 
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
     std::shared_ptr<trace::connector_impl> tc_;
 #endif
 
@@ -305,6 +317,12 @@ private:
     services_t services_;
     mutable std::mutex services_mutex_;
 
+    using services_snapshot_t = service_instance_map<std::shared_ptr<serviceinfo>>;
+    snapshot<services_snapshot_t> services_snapshot_;
+
+    using events_snapshot_t = service_instance_map<std::shared_ptr<const std::unordered_map<event_t, std::shared_ptr<event>>>>;
+    snapshot<events_snapshot_t> events_snapshot_;
+
     mutable std::mutex guests_mutex_;
     std::map<client_t, std::pair<boost::asio::ip::address, port_t>> guests_;
 
@@ -48,6 +48,8 @@ public:
     std::string get_env(client_t _client) const;
     std::string get_env_unlocked(client_t _client) const;
 
+    void get_metrics(metrics_t& _metrics) const;
+
     void start_keepalive();
     void check_keepalive();
     void cancel_keepalive();
@@ -9,11 +9,14 @@
 #include <memory>
 
 #include <boost/asio/io_context.hpp>
+#include <vsomeip/structured_types.hpp>
 #include <vsomeip/vsomeip_sec.h>
 
 namespace vsomeip_v3 {
 
 class configuration;
+class handler_statistics;
+class latency_statistics;
 class message;
 
 class routing_manager_host {
@@ -43,6 +46,12 @@ public:
     virtual void send(std::shared_ptr<message> _message) = 0;
     virtual void on_offered_services_info(std::vector<std::pair<service_t, instance_t>>& _services) = 0;
     virtual bool is_routing() const = 0;
+
+    // nullptr if the latency statistics are disabled
+    virtual latency_statistics* get_latency_statistics() const = 0;
+    // nullptr if the handler profiling is disabled
+    virtual handler_statistics* get_handler_statistics() const = 0;
+    virtual std::vector<dispatch_queue_sample_t> get_dispatch_queue_history() const = 0;
 };
 
 } // namespace vsomeip_v3
@@ -108,6 +108,8 @@ public:
 #endif
     );
 
+    std::vector<bool> notify_batch(const std::vector<notification_t>& _notifications, bool _force);
+
     void on_subscribe_ack(client_t _client, service_t _service, instance_t _instance, eventgroup_t _eventgroup, event_t _event,
                           remote_subscription_id_t _id);
 
@@ -190,6 +192,8 @@ public:
 
     void print_stub_status() const;
 
+    void get_metrics(metrics_t& _metrics) const;
+
     void send_error(return_code_e _return_code, const byte_t* _data, length_t _size, instance_t _instance, bool _reliable,
                     endpoint* const _receiver, const boost::asio::ip::address& _remote_address, std::uint16_t _remote_port);
     void service_endpoint_connected(service_t _service, instance_t _instance, major_version_t _major, minor_version_t _minor,
@@ -334,6 +338,33 @@ private:
     bool has_subscribed_eventgroup(service_t _service, instance_t _instance) const;
 #endif // VSOMEIP_ENABLE_DEFAULT_EVENT_CACHING
 
+    // Remote notifications of a notify_batch call, collected per server
+    // endpoint and target and handed over once all events are updated.
+    // A notification is copied once and shared by the batches of all targets.
+    struct notification_batch_t {
+        struct entry_t {
+            std::shared_ptr<endpoint> endpoint_;
+            std::shared_ptr<endpoint_definition> target_;
+            endpoint::batch_t messages_;
+        };
+        std::map<std::pair<const endpoint*, const endpoint_definition*>, entry_t> entries_;
+    };
+
+    // Makes a batch the current one of the calling thread for its lifetime
+    class notification_batch_scope {
+    public:
+        explicit notification_batch_scope(notification_batch_t& _batch) { notification_batch_ = &_batch; }
+        ~notification_batch_scope() { notification_batch_ = nullptr; }
+
+        notification_batch_scope(const notification_batch_scope&) = delete;
+        notification_batch_scope& operator=(const notification_batch_scope&) = delete;
+    };
+
+    // _message is created from _data by the first target that batches it and
+    // reused by the following targets of the same notification
+    void send_notification(const std::shared_ptr<endpoint>& _endpoint, const std::shared_ptr<endpoint_definition>& _target,
+                           const byte_t* _data, uint32_t _size, std::shared_ptr<const std::vector<byte_t>>& _message);
+
 private:
     std::shared_ptr<routing_manager_stub> stub_;
     std::shared_ptr<sd::service_discovery> discovery_;
@@ -406,6 +437,9 @@ private:
     message_acceptance_handler_t message_acceptance_handler_;
 
     std::mutex on_state_change_mutex_;
+
+    // Batch of the notify_batch call running on this thread (if any)
+    static thread_local notification_batch_t* notification_batch_;
 };
 
 } // namespace vsomeip_v3
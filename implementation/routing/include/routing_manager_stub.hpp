@@ -82,6 +82,7 @@ public:
     void update_registration(client_t _client, registration_type_e _type, const boost::asio::ip::address& _address, port_t _port);
 
     void print_endpoint_status() const;
+    void get_endpoint_metrics(std::vector<endpoint_metrics_t>& _metrics) const;
 
     bool send_provided_event_resend_request(client_t _client, pending_remote_offer_id_t _id);
 
@@ -8,6 +8,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 #include <boost/asio/ip/address.hpp>
 
 #include <vsomeip/primitive_types.hpp>
@@ -38,6 +39,12 @@ enum class remote_subscription_state_e : std::uint8_t {
 
 typedef std::uint16_t remote_subscription_id_t;
 
+// Remote subscribers of an event, split by the server endpoint used to reach them.
+struct remote_targets_t {
+    std::vector<std::shared_ptr<endpoint_definition>> reliable_;
+    std::vector<std::shared_ptr<endpoint_definition>> unreliable_;
+};
+
 struct msg_statistic_t {
     uint32_t counter_;
     length_t avg_length_;
@@ -0,0 +1,206 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <vsomeip/payload.hpp>
+
+#include "../include/change_detector.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+
+std::size_t get_size(change_filter_value_e _type) {
+    switch (_type) {
+    case change_filter_value_e::CFV_INT8:
+    case change_filter_value_e::CFV_UINT8:
+        return 1;
+    case change_filter_value_e::CFV_INT16:
+    case change_filter_value_e::CFV_UINT16:
+        return 2;
+    case change_filter_value_e::CFV_INT32:
+    case change_filter_value_e::CFV_UINT32:
+    case change_filter_value_e::CFV_FLOAT32:
+        return 4;
+    default:
+        return 8;
+    }
+}
+
+double get_value(const byte_t* _data, change_filter_value_e _type, bool _is_little_endian) {
+    const std::size_t its_size = get_size(_type);
+    std::uint64_t its_raw(0);
+    for (std::size_t i = 0; i < its_size; ++i) {
+        its_raw = (its_raw << 8) | _data[_is_little_endian ? its_size - 1 - i : i];
+    }
+
+    switch (_type) {
+    case change_filter_value_e::CFV_INT8:
+        return static_cast<double>(static_cast<std::int8_t>(its_raw));
+    case change_filter_value_e::CFV_UINT8:
+        return static_cast<double>(static_cast<std::uint8_t>(its_raw));
+    case change_filter_value_e::CFV_INT16:
+        return static_cast<double>(static_cast<std::int16_t>(its_raw));
+    case change_filter_value_e::CFV_UINT16:
+        return static_cast<double>(static_cast<std::uint16_t>(its_raw));
+    case change_filter_value_e::CFV_INT32:
+        return static_cast<double>(static_cast<std::int32_t>(its_raw));
+    case change_filter_value_e::CFV_UINT32:
+        return static_cast<double>(static_cast<std::uint32_t>(its_raw));
+    case change_filter_value_e::CFV_INT64:
+        return static_cast<double>(static_cast<std::int64_t>(its_raw));
+    case change_filter_value_e::CFV_FLOAT32: {
+        const auto its_bits = static_cast<std::uint32_t>(its_raw);
+        float its_value;
+        std::memcpy(&its_value, &its_bits, sizeof(its_value));
+        return static_cast<double>(its_value);
+    }
+    case change_filter_value_e::CFV_FLOAT64: {
+        double its_value;
+        std::memcpy(&its_value, &its_raw, sizeof(its_value));
+        return its_value;
+    }
+    default:
+        return static_cast<double>(its_raw);
+    }
+}
+
+// Returns true if any bit selected by "_mask" differs between "_lhs" and "_rhs".
+bool differs_masked(const byte_t* _lhs, const byte_t* _rhs, const byte_t* _mask, std::size_t _length) {
+    std::size_t i(0);
+#if defined(__SSE2__)
+    const __m128i its_zero = _mm_setzero_si128();
+    for (; i + 16 <= _length; i += 16) {
+        const __m128i its_lhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_lhs + i));
+        const __m128i its_rhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_rhs + i));
+        const __m128i its_mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_mask + i));
+        const __m128i its_diff = _mm_and_si128(_mm_xor_si128(its_lhs, its_rhs), its_mask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(its_diff, its_zero)) != 0xffff) {
+            return true;
+        }
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 16 <= _length; i += 16) {
+        const uint8x16_t its_diff = vandq_u8(veorq_u8(vld1q_u8(_lhs + i), vld1q_u8(_rhs + i)), vld1q_u8(_mask + i));
+        const uint64x2_t its_words = vreinterpretq_u64_u8(its_diff);
+        if ((vgetq_lane_u64(its_words, 0) | vgetq_lane_u64(its_words, 1)) != 0) {
+            return true;
+        }
+    }
+#endif
+    for (; i + sizeof(std::uint64_t) <= _length; i += sizeof(std::uint64_t)) {
+        std::uint64_t its_lhs, its_rhs, its_mask;
+        std::memcpy(&its_lhs, _lhs + i, sizeof(its_lhs));
+        std::memcpy(&its_rhs, _rhs + i, sizeof(its_rhs));
+        std::memcpy(&its_mask, _mask + i, sizeof(its_mask));
+        if (((its_lhs ^ its_rhs) & its_mask) != 0) {
+            return true;
+        }
+    }
+    for (; i < _length; ++i) {
+        if (((_lhs[i] ^ _rhs[i]) & _mask[i]) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+change_detector::change_detector(const change_filter_t& _filter) : change_detector(_filter.ignore_) {
+
+    tolerances_ = _filter.tolerances_;
+    for (const auto& t : tolerances_) {
+        const std::size_t its_end = t.offset_ + get_size(t.type_);
+        if (mask_.size() < its_end) {
+            mask_.resize(its_end, 0xff);
+        }
+        // Checked numerically
+        std::fill(mask_.begin() + static_cast<std::ptrdiff_t>(t.offset_), mask_.begin() + static_cast<std::ptrdiff_t>(its_end), 0x00);
+    }
+}
+
+change_detector::change_detector(const std::map<std::size_t, byte_t>& _ignore) {
+
+    if (!_ignore.empty()) {
+        mask_.resize(_ignore.rbegin()->first + 1, 0xff);
+        for (const auto& [its_index, its_ignored] : _ignore) {
+            mask_[its_index] = static_cast<byte_t>(~its_ignored);
+        }
+    }
+}
+
+bool change_detector::has_changed(const std::shared_ptr<payload>& _old, const std::shared_ptr<payload>& _new) const {
+
+    if (!_old || !_new) {
+        return _old != _new;
+    }
+    return has_changed(_old->get_data(), _old->get_length(), _new->get_data(), _new->get_length());
+}
+
+bool change_detector::has_changed(const byte_t* _old, std::size_t _old_length, const byte_t* _new, std::size_t _new_length) const {
+
+    const std::size_t its_min_length = std::min(_old_length, _new_length);
+    const std::size_t its_max_length = std::max(_old_length, _new_length);
+
+    // A change is detected when an additional byte is not completely ignored
+    for (std::size_t i = its_min_length; i < its_max_length; i++) {
+        if (!is_ignored(i)) {
+            return true;
+        }
+    }
+
+    const std::size_t its_masked_length = std::min(its_min_length, mask_.size());
+    if (differs_masked(_old, _new, mask_.data(), its_masked_length)) {
+        return true;
+    }
+    if (its_min_length > its_masked_length
+        && std::memcmp(_old + its_masked_length, _new + its_masked_length, its_min_length - its_masked_length) != 0) {
+        return true;
+    }
+
+    for (const auto& t : tolerances_) {
+        if (t.offset_ + get_size(t.type_) <= its_min_length && exceeds_tolerance(t, _old, _new)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool change_detector::is_ignored(std::size_t _index) const {
+
+    if (_index >= mask_.size() || mask_[_index] != 0x00) {
+        return false;
+    }
+    return std::none_of(tolerances_.begin(), tolerances_.end(), [_index](const change_filter_t::tolerance_t& _t) {
+        return _index >= _t.offset_ && _index < _t.offset_ + get_size(_t.type_);
+    });
+}
+
+bool change_detector::exceeds_tolerance(const change_filter_t::tolerance_t& _tolerance, const byte_t* _old, const byte_t* _new) const {
+
+    const std::size_t its_size = get_size(_tolerance.type_);
+    if (std::memcmp(_old + _tolerance.offset_, _new + _tolerance.offset_, its_size) == 0) {
+        return false;
+    }
+
+    const double its_old = get_value(_old + _tolerance.offset_, _tolerance.type_, _tolerance.is_little_endian_);
+    const double its_new = get_value(_new + _tolerance.offset_, _tolerance.type_, _tolerance.is_little_endian_);
+
+    // NaN never lies within the tolerance
+    return !(std::fabs(its_new - its_old) <= _tolerance.epsilon_);
+}
+
+} // namespace vsomeip_v3
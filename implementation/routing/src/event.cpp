@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -15,6 +16,7 @@
 #include <vsomeip/runtime.hpp>
 #include <vsomeip/internal/logger.hpp>
 
+#include "../include/change_detector.hpp"
 #include "../include/event.hpp"
 #include "../include/routing_manager.hpp"
 #include "../../endpoints/include/endpoint_definition.hpp"
@@ -27,7 +29,7 @@ event::event(routing_manager* _routing, bool _is_shadow) :
     type_(event_type_e::ET_EVENT), cycle_timer_(_routing->get_io()), cycle_(std::chrono::milliseconds::zero()), change_resets_cycle_(false),
     is_updating_on_change_(true), is_set_(false), is_provided_(false), is_shadow_(_is_shadow), is_cache_placeholder_(false),
     epsilon_change_func_(std::bind(&event::has_changed, this, std::placeholders::_1, std::placeholders::_2)),
-    has_default_epsilon_change_func_(true), reliability_(reliability_type_e::RT_UNKNOWN) { }
+    has_default_epsilon_change_func_(true), reliability_(reliability_type_e::RT_UNKNOWN), has_filters_(false) { }
 
 service_t event::get_service() const {
 
@@ -119,7 +121,7 @@ void event::update_payload_unlocked() {
     current_->set_payload(update_->get_payload());
 }
 
-void event::set_payload(const std::shared_ptr<payload>& _payload, bool _force) {
+bool event::set_payload(const std::shared_ptr<payload>& _payload, bool _force) {
 
     std::lock_guard<std::mutex> its_lock(mutex_);
     if (is_provided_) {
@@ -135,12 +137,14 @@ void event::set_payload(const std::shared_ptr<payload>& _payload, bool _force) {
 
                 update_payload_unlocked();
             }
+            return true;
         }
     } else {
         VSOMEIP_INFO << __func__ << ":" << __LINE__ << " Cannot set payload for event [" << std::hex << std::setfill('0') << std::setw(4)
                      << current_->get_service() << "." << current_->get_instance() << "." << current_->get_method()
                      << "]. It isn't provided";
     }
+    return false;
 }
 
 void event::set_payload(const std::shared_ptr<payload>& _payload, client_t _client, bool _force) {
@@ -247,6 +251,12 @@ void event::set_epsilon_change_function(const epsilon_change_func_t& _epsilon_ch
     }
 }
 
+void event::set_change_detector(const std::shared_ptr<change_detector>& _change_detector) {
+
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    change_detector_ = _change_detector;
+}
+
 std::set<eventgroup_t> event::get_eventgroups() const {
 
     std::set<eventgroup_t> its_eventgroups;
@@ -283,6 +293,7 @@ void event::set_eventgroups(const std::set<eventgroup_t>& _eventgroups) {
     std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
     for (auto e : _eventgroups)
         eventgroups_[e] = std::set<client_t>();
+    update_fanout_unlocked();
 }
 
 void event::update_cbk(boost::system::error_code const& _error) {
@@ -366,6 +377,11 @@ bool event::prepare_update_payload_unlocked(const std::shared_ptr<payload>& _pay
         return false;
     }
 
+    if (!_force && is_set_ && change_detector_ && cycle_ == std::chrono::milliseconds::zero() && !is_shadow_
+        && !change_detector_->has_changed(current_->get_payload(), _payload)) {
+        return false;
+    }
+
     update_->set_payload(_payload);
 
     if (!is_set_) {
@@ -441,51 +457,13 @@ bool event::add_subscriber(eventgroup_t _eventgroup, const std::shared_ptr<debou
             VSOMEIP_INFO << "Filter parameters: " << its_filter_parameters.str();
             {
                 std::scoped_lock lk{filters_mutex_};
-                filters_[_client] = [_filter](const std::shared_ptr<payload>& _old, const std::shared_ptr<payload>& _new) {
+                auto its_detector = std::make_shared<change_detector>(_filter->ignore_);
+                filters_[_client] = [_filter, its_detector](const std::shared_ptr<payload>& _old, const std::shared_ptr<payload>& _new) {
                     bool is_changed(false), is_elapsed(false);
 
                     // Check whether we should forward because of changed data
                     if (_filter->on_change_) {
-                        length_t its_min_length, its_max_length;
-
-                        if (_old->get_length() < _new->get_length()) {
-                            its_min_length = _old->get_length();
-                            its_max_length = _new->get_length();
-                        } else {
-                            its_min_length = _new->get_length();
-                            its_max_length = _old->get_length();
-                        }
-
-                        // Check whether all additional bytes (if any) are excluded
-                        for (length_t i = its_min_length; i < its_max_length; i++) {
-                            auto j = _filter->ignore_.find(i);
-                            // A change is detected when an additional byte is not
-                            // excluded at all or if its exclusion does not cover all
-                            // bits
-                            if (j == _filter->ignore_.end() || j->second != 0xFF) {
-                                is_changed = true;
-                                break;
-                            }
-                        }
-
-                        if (!is_changed) {
-                            const byte_t* its_old = _old->get_data();
-                            const byte_t* its_new = _new->get_data();
-                            for (length_t i = 0; i < its_min_length; i++) {
-                                auto j = _filter->ignore_.find(i);
-                                if (j == _filter->ignore_.end()) {
-                                    if (its_old[i] != its_new[i]) {
-                                        is_changed = true;
-                                        break;
-                                    }
-                                } else if (j->second != 0xFF) {
-                                    if ((its_old[i] & ~(j->second)) != (its_new[i] & ~(j->second))) {
-                                        is_changed = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
+                        is_changed = its_detector->has_changed(_old, _new);
                     }
 
                     if (_filter->interval_ > -1) {
@@ -503,6 +481,7 @@ bool event::add_subscriber(eventgroup_t _eventgroup, const std::shared_ptr<debou
 
                     return (is_changed || is_elapsed);
                 };
+                has_filters_ = true;
             }
 
             // Create a new callback for this client if filter interval is used
@@ -510,9 +489,13 @@ bool event::add_subscriber(eventgroup_t _eventgroup, const std::shared_ptr<debou
         } else {
             std::scoped_lock lk{filters_mutex_};
             filters_.erase(_client);
+            has_filters_ = !filters_.empty();
         }
 
         ret = eventgroups_[_eventgroup].insert(_client).second;
+        if (ret) {
+            update_fanout_unlocked();
+        }
 
     } else {
         VSOMEIP_WARNING << __func__ << ": Didnt' insert client " << std::hex << std::setfill('0') << std::setw(4) << _client
@@ -526,7 +509,9 @@ void event::remove_subscriber(eventgroup_t _eventgroup, client_t _client) {
     std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
     auto find_eventgroup = eventgroups_.find(_eventgroup);
     if (find_eventgroup != eventgroups_.end()) {
-        find_eventgroup->second.erase(_client);
+        if (find_eventgroup->second.erase(_client) > 0) {
+            update_fanout_unlocked();
+        }
         routing_->remove_debounce(_client, get_event());
     }
 }
@@ -547,17 +532,22 @@ bool event::has_subscriber(eventgroup_t _eventgroup, client_t _client) {
 
 std::set<client_t> event::get_subscribers() {
 
-    std::set<client_t> its_subscribers;
-    std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
-    for (const auto& e : eventgroups_)
-        its_subscribers.insert(e.second.begin(), e.second.end());
-    return its_subscribers;
+    const auto its_fanout = fanout_.load();
+    return std::set<client_t>(its_fanout->begin(), its_fanout->end());
 }
 
-std::set<client_t> event::get_filtered_subscribers(bool _force) {
+std::shared_ptr<const event::subscribers_t> event::get_fanout() const {
+
+    return fanout_.load();
+}
 
-    std::set<client_t> its_subscribers(get_subscribers());
-    std::set<client_t> its_filtered_subscribers;
+std::shared_ptr<const event::subscribers_t> event::get_filtered_subscribers(bool _force) {
+
+    static const auto its_empty = std::make_shared<const subscribers_t>();
+
+    auto its_subscribers = fanout_.load();
+    if (its_subscribers->empty())
+        return its_subscribers;
 
     std::shared_ptr<payload> its_payload, its_payload_update;
     {
@@ -565,13 +555,7 @@ std::set<client_t> event::get_filtered_subscribers(bool _force) {
         its_payload_update = update_->get_payload();
     }
 
-    bool is_filters_empty = false;
-    {
-        std::scoped_lock its_lock{filters_mutex_};
-        is_filters_empty = filters_.empty();
-    }
-
-    if (is_filters_empty) {
+    if (!has_filters_) {
 
         bool must_forward = ((type_ != event_type_e::ET_FIELD && has_default_epsilon_change_func_) || _force
                              || epsilon_change_func_(its_payload, its_payload_update));
@@ -580,15 +564,18 @@ std::set<client_t> event::get_filtered_subscribers(bool _force) {
             return its_subscribers;
 
     } else {
+        auto its_filtered_subscribers = std::make_shared<subscribers_t>();
+        its_filtered_subscribers->reserve(its_subscribers->size());
+
         byte_t is_allowed(0xff);
 
         std::scoped_lock its_lock{filters_mutex_};
-        for (const auto s : its_subscribers) {
+        for (const auto s : *its_subscribers) {
 
             auto its_specific = filters_.find(s);
             if (its_specific != filters_.end()) {
                 if (its_specific->second(its_payload, its_payload_update))
-                    its_filtered_subscribers.insert(s);
+                    its_filtered_subscribers->push_back(s);
             } else {
                 if (is_allowed == 0xff) {
                     is_allowed = ((type_ != event_type_e::ET_FIELD && has_default_epsilon_change_func_) || _force
@@ -598,28 +585,31 @@ std::set<client_t> event::get_filtered_subscribers(bool _force) {
                 }
 
                 if (is_allowed == 0x01)
-                    its_filtered_subscribers.insert(s);
+                    its_filtered_subscribers->push_back(s);
             }
         }
+
+        return its_filtered_subscribers;
     }
 
-    return its_filtered_subscribers;
+    return its_empty;
 }
 
 // Get the clients that have pending updates after debounce timeout
-void event::get_pending_updates(const std::set<client_t>& _clients) {
+void event::get_pending_updates(const subscribers_t& _clients) {
     if (has_changed(current_->get_payload(), update_->get_payload())) {
         routing_->update_debounce_clients(_clients, get_event());
     }
 }
 
-std::set<client_t> event::update_and_get_filtered_subscribers(const std::shared_ptr<payload>& _payload, bool _is_from_remote) {
+std::shared_ptr<const event::subscribers_t> event::update_and_get_filtered_subscribers(const std::shared_ptr<payload>& _payload,
+                                                                                       bool _is_from_remote) {
 
     std::lock_guard<std::mutex> its_lock(mutex_);
 
     (void)prepare_update_payload_unlocked(_payload, true);
     auto its_subscribers = get_filtered_subscribers(!_is_from_remote);
-    get_pending_updates(its_subscribers);
+    get_pending_updates(*its_subscribers);
     if (_is_from_remote)
         update_payload_unlocked();
 
@@ -631,6 +621,20 @@ void event::clear_subscribers() {
     std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
     for (auto& e : eventgroups_)
         e.second.clear();
+    update_fanout_unlocked();
+}
+
+void event::update_fanout_unlocked() {
+
+    auto its_fanout = std::make_shared<subscribers_t>();
+    for (const auto& e : eventgroups_)
+        its_fanout->insert(its_fanout->end(), e.second.begin(), e.second.end());
+
+    std::sort(its_fanout->begin(), its_fanout->end());
+    its_fanout->erase(std::unique(its_fanout->begin(), its_fanout->end()), its_fanout->end());
+    its_fanout->shrink_to_fit();
+
+    fanout_.publish(std::move(its_fanout));
 }
 
 bool event::has_ref(client_t _client, bool _is_provided) {
@@ -713,13 +717,8 @@ std::set<client_t> event::get_subscribers(eventgroup_t _eventgroup) {
 
 bool event::is_subscribed(client_t _client) {
 
-    std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
-    for (const auto& egp : eventgroups_) {
-        if (egp.second.find(_client) != egp.second.end()) {
-            return true;
-        }
-    }
-    return false;
+    const auto its_fanout = fanout_.load();
+    return std::binary_search(its_fanout->begin(), its_fanout->end(), _client);
 }
 
 reliability_type_e event::get_reliability() const {
@@ -729,7 +728,46 @@ reliability_type_e event::get_reliability() const {
 
 void event::set_reliability(const reliability_type_e _reliability) {
 
+    std::lock_guard<std::mutex> its_lock(remote_targets_mutex_);
     reliability_ = _reliability;
+    update_remote_targets_unlocked();
+}
+
+void event::set_remote_targets(eventgroup_t _eventgroup, const std::shared_ptr<const remote_targets_t>& _targets) {
+
+    std::lock_guard<std::mutex> its_lock(remote_targets_mutex_);
+    if (_targets) {
+        eventgroup_targets_[_eventgroup] = _targets;
+    } else {
+        eventgroup_targets_.erase(_eventgroup);
+    }
+    update_remote_targets_unlocked();
+}
+
+std::shared_ptr<const remote_targets_t> event::get_remote_targets() const {
+
+    return remote_targets_.load();
+}
+
+void event::update_remote_targets_unlocked() {
+
+    const bool is_reliable(reliability_ == reliability_type_e::RT_RELIABLE || reliability_ == reliability_type_e::RT_BOTH);
+    const bool is_unreliable(reliability_ == reliability_type_e::RT_UNRELIABLE || reliability_ == reliability_type_e::RT_BOTH);
+
+    auto its_targets = std::make_shared<remote_targets_t>();
+    for (const auto& e : eventgroup_targets_) {
+        if (is_reliable)
+            its_targets->reliable_.insert(its_targets->reliable_.end(), e.second->reliable_.begin(), e.second->reliable_.end());
+        if (is_unreliable)
+            its_targets->unreliable_.insert(its_targets->unreliable_.end(), e.second->unreliable_.begin(), e.second->unreliable_.end());
+    }
+
+    for (auto its_list : {&its_targets->reliable_, &its_targets->unreliable_}) {
+        std::sort(its_list->begin(), its_list->end());
+        its_list->erase(std::unique(its_list->begin(), its_list->end()), its_list->end());
+    }
+
+    remote_targets_.publish(std::move(its_targets));
 }
 
 void event::remove_pending(const std::shared_ptr<endpoint_definition>& _target) {
@@ -94,9 +94,16 @@ bool eventgroupinfo::get_multicast(boost::asio::ip::address& _address, uint16_t&
 }
 
 void eventgroupinfo::set_multicast(const boost::asio::ip::address& _address, uint16_t _port) {
-    std::lock_guard<std::mutex> its_lock(address_mutex_);
-    address_ = _address;
-    port_ = _port;
+    {
+        std::lock_guard<std::mutex> its_lock(address_mutex_);
+        address_ = _address;
+        port_ = _port;
+    }
+    {
+        std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
+        update_fanout_unlocked();
+    }
+    update_event_targets();
 }
 
 std::set<std::shared_ptr<event>> eventgroupinfo::get_events() const {
@@ -113,6 +120,7 @@ void eventgroupinfo::add_event(const std::shared_ptr<event>& _event) {
 
     std::lock_guard<std::mutex> its_lock(events_mutex_);
     events_.insert(_event);
+    _event->set_remote_targets(eventgroup_, remote_targets_.load());
 
     if (!reliability_auto_mode_ && _event->get_reliability() == reliability_type_e::RT_UNKNOWN) {
         reliability_auto_mode_ = true;
@@ -150,6 +158,7 @@ void eventgroupinfo::remove_event(const std::shared_ptr<event>& _event) {
 
     std::lock_guard<std::mutex> its_lock(events_mutex_);
     events_.erase(_event);
+    _event->set_remote_targets(eventgroup_, nullptr);
 }
 
 reliability_type_e eventgroupinfo::get_reliability() const {
@@ -184,6 +193,11 @@ uint8_t eventgroupinfo::get_threshold() const {
 
 void eventgroupinfo::set_threshold(uint8_t _threshold) {
     threshold_ = _threshold;
+    {
+        std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
+        update_fanout_unlocked();
+    }
+    update_event_targets();
 }
 
 std::set<std::shared_ptr<remote_subscription>> eventgroupinfo::get_remote_subscriptions() const {
@@ -209,6 +223,7 @@ bool eventgroupinfo::update_remote_subscription(const std::shared_ptr<remote_sub
 
     std::shared_ptr<endpoint_definition> its_subscriber;
     std::set<std::shared_ptr<event>> its_events;
+    bool has_changed(false);
 
     {
         std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
@@ -240,6 +255,8 @@ bool eventgroupinfo::update_remote_subscription(const std::shared_ptr<remote_sub
                         update_id();
                         _subscription->set_id(id_);
                         subscriptions_[id_] = _subscription;
+                        update_fanout_unlocked();
+                        has_changed = true;
                     } else {
                         if (!_subscription->is_pending()) {
                             if (!_subscription->force_initial_events()) {
@@ -263,6 +280,10 @@ bool eventgroupinfo::update_remote_subscription(const std::shared_ptr<remote_sub
         }
     }
 
+    if (has_changed) {
+        update_event_targets();
+    }
+
     if (its_subscriber) {
         {
             // Build set of events first to avoid having to
@@ -312,18 +333,24 @@ remote_subscription_id_t eventgroupinfo::add_remote_subscription(const std::shar
         VSOMEIP_ERROR << __func__ << ": Received ptr is null";
         return id_;
     }
-    std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
+    remote_subscription_id_t its_id;
+    {
+        std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
 
-    update_id();
+        update_id();
 
-    _subscription->set_id(id_);
-    subscriptions_[id_] = _subscription;
+        _subscription->set_id(id_);
+        subscriptions_[id_] = _subscription;
+        update_fanout_unlocked();
 
-    boost::asio::ip::address its_address;
-    if (_subscription->get_ip_address(its_address)) {
-        remote_subscribers_count_[its_address]++;
+        boost::asio::ip::address its_address;
+        if (_subscription->get_ip_address(its_address)) {
+            remote_subscribers_count_[its_address]++;
+        }
+        its_id = id_;
     }
-    return id_;
+    update_event_targets();
+    return its_id;
 }
 
 std::shared_ptr<remote_subscription> eventgroupinfo::get_remote_subscription(const remote_subscription_id_t _id) {
@@ -337,44 +364,106 @@ std::shared_ptr<remote_subscription> eventgroupinfo::get_remote_subscription(con
 }
 
 void eventgroupinfo::remove_remote_subscription(const remote_subscription_id_t _id) {
-    std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
+    {
+        std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
 
-    auto find_subscription = subscriptions_.find(_id);
-    if (find_subscription != subscriptions_.end()) {
-        boost::asio::ip::address its_address;
-        if (find_subscription->second->get_ip_address(its_address)) {
-            auto find_address = remote_subscribers_count_.find(its_address);
-            if (find_address != remote_subscribers_count_.end()) {
-                if (find_address->second != 0) {
-                    find_address->second--;
+        auto find_subscription = subscriptions_.find(_id);
+        if (find_subscription != subscriptions_.end()) {
+            boost::asio::ip::address its_address;
+            if (find_subscription->second->get_ip_address(its_address)) {
+                auto find_address = remote_subscribers_count_.find(its_address);
+                if (find_address != remote_subscribers_count_.end()) {
+                    if (find_address->second != 0) {
+                        find_address->second--;
+                    }
                 }
             }
         }
-    }
 
-    subscriptions_.erase(_id);
+        if (subscriptions_.erase(_id) == 0) {
+            return;
+        }
+        update_fanout_unlocked();
+    }
+    update_event_targets();
 }
 
 void eventgroupinfo::clear_remote_subscriptions() {
-    std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
-    subscriptions_.clear();
-    remote_subscribers_count_.clear();
+    {
+        std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
+        subscriptions_.clear();
+        remote_subscribers_count_.clear();
+        update_fanout_unlocked();
+    }
+    update_event_targets();
 }
 
 std::set<std::shared_ptr<endpoint_definition>> eventgroupinfo::get_unicast_targets() const {
-    std::set<std::shared_ptr<endpoint_definition>> its_targets;
+    const auto its_fanout = unicast_fanout_.load();
+    return std::set<std::shared_ptr<endpoint_definition>>(its_fanout->begin(), its_fanout->end());
+}
 
-    std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
+std::shared_ptr<const eventgroupinfo::targets_t> eventgroupinfo::get_unicast_fanout() const {
+    return unicast_fanout_.load();
+}
+
+std::shared_ptr<const remote_targets_t> eventgroupinfo::get_remote_targets() const {
+    return remote_targets_.load();
+}
+
+void eventgroupinfo::update_fanout_unlocked() {
+    auto its_fanout = std::make_shared<targets_t>();
+    its_fanout->reserve(2 * subscriptions_.size());
     for (const auto& s : subscriptions_) {
         const auto its_reliable = s.second->get_reliable();
         if (its_reliable)
-            its_targets.insert(its_reliable);
+            its_fanout->push_back(its_reliable);
         const auto its_unreliable = s.second->get_unreliable();
         if (its_unreliable)
-            its_targets.insert(its_unreliable);
+            its_fanout->push_back(its_unreliable);
     }
 
-    return its_targets;
+    std::sort(its_fanout->begin(), its_fanout->end());
+    its_fanout->erase(std::unique(its_fanout->begin(), its_fanout->end()), its_fanout->end());
+
+    // Unreliable subscribers are served by multicast once their number
+    // reaches the configured threshold.
+    bool is_sending_multicast(false);
+    boost::asio::ip::address its_address;
+    uint16_t its_port(ILLEGAL_PORT);
+    if (threshold_ != 0 && get_multicast(its_address, its_port)) {
+        uint32_t its_count(0);
+        for (const auto& s : subscriptions_) {
+            if (!s.second->get_parent() && s.second->get_unreliable()) {
+                its_count++;
+            }
+        }
+        is_sending_multicast = (its_count >= threshold_);
+    }
+
+    auto its_targets = std::make_shared<remote_targets_t>();
+    for (const auto& its_target : *its_fanout) {
+        if (its_target->is_reliable()) {
+            its_targets->reliable_.push_back(its_target);
+        } else if (!is_sending_multicast) {
+            its_targets->unreliable_.push_back(its_target);
+        }
+    }
+    if (is_sending_multicast) {
+        its_targets->unreliable_.push_back(endpoint_definition::get(its_address, its_port, false, service_, instance_));
+    }
+
+    unicast_fanout_.publish(std::move(its_fanout));
+    remote_targets_.publish(std::move(its_targets));
+}
+
+void eventgroupinfo::update_event_targets() const {
+    // The events only store the targets, so their locks may be taken
+    // while holding "events_mutex_".
+    std::lock_guard<std::mutex> its_lock(events_mutex_);
+    const auto its_targets = remote_targets_.load();
+    for (const auto& its_event : events_)
+        its_event->set_remote_targets(eventgroup_, its_targets);
 }
 
 std::set<std::shared_ptr<endpoint_definition>> eventgroupinfo::get_multicast_targets() const {
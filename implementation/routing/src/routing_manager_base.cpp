@@ -3,17 +3,19 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <iomanip>
 
 #include <vsomeip/runtime.hpp>
 #include <vsomeip/internal/logger.hpp>
 
+#include "../include/change_detector.hpp"
 #include "../include/routing_manager_base.hpp"
 #include "../../configuration/include/debounce_filter_impl.hpp"
 #include "../../protocol/include/send_command.hpp"
 #include "../../security/include/policy_manager_impl.hpp"
 #include "../../security/include/security.hpp"
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
 #include "../../tracing/include/connector_impl.hpp"
 #endif
 #include "../../utility/include/bithelper.hpp"
@@ -22,8 +24,9 @@
 namespace vsomeip_v3 {
 
 routing_manager_base::routing_manager_base(routing_manager_host* _host) :
-    host_(_host), io_(host_->get_io()), configuration_(host_->get_configuration()), debounce_timer(host_->get_io())
-#ifdef USE_DLT
+    host_(_host), io_(host_->get_io()), configuration_(host_->get_configuration()), events_mutex_("routing_manager_base::events_mutex_"),
+    debounce_timer(host_->get_io())
+#ifdef VSOMEIP_ENABLE_TRACING
     ,
     tc_(trace::connector_impl::get())
 #endif
@@ -147,16 +150,18 @@ void routing_manager_base::remove_debounce(client_t _client, event_t _event) {
     }
 }
 
-void routing_manager_base::update_debounce_clients(const std::set<client_t>& _clients, event_t _event) {
+void routing_manager_base::get_metrics(metrics_t& _metrics) const {
+    if (ep_mgr_) {
+        ep_mgr_->get_metrics(_metrics.endpoints_);
+    }
+}
+
+void routing_manager_base::update_debounce_clients(const std::vector<client_t>& _clients, event_t _event) {
     std::lock_guard<std::mutex> its_lock(debounce_mutex_);
     for (auto& debounce_client : debounce_clients_) {
         if (_event == std::get<3>(debounce_client.second)) {
-            std::get<1>(debounce_client.second) = true;
-            for (auto s : _clients) {
-                if (std::get<0>(debounce_client.second) == s) {
-                    std::get<1>(debounce_client.second) = false;
-                }
-            }
+            std::get<1>(debounce_client.second) =
+                    !std::binary_search(_clients.begin(), _clients.end(), std::get<0>(debounce_client.second));
         }
     }
 }
@@ -231,7 +236,7 @@ bool routing_manager_base::offer_service(client_t _client, service_t _service, i
         its_info = create_service_info(_service, _instance, _major, _minor, DEFAULT_TTL, true);
     }
     {
-        std::lock_guard<std::mutex> its_lock(events_mutex_);
+        std::scoped_lock its_lock(events_mutex_);
         // Set major version for all registered events of this service and instance
         const auto search = events_.find(service_instance_t{_service, _instance});
 
@@ -252,7 +257,7 @@ void routing_manager_base::stop_offer_service(client_t _client, service_t _servi
 
     std::map<event_t, std::shared_ptr<event>> events;
     {
-        std::lock_guard<std::mutex> its_lock(events_mutex_);
+        std::scoped_lock its_lock(events_mutex_);
         const auto search = events_.find(service_instance_t{_service, _instance});
         if (search != events_.end()) {
             for (const auto& [event_id, event_ptr] : search->second) {
@@ -421,51 +426,14 @@ void routing_manager_base::register_event(client_t _client, service_t _service,
                                 << _instance << "." << std::setw(4) << _notifier << "."
                                 << " Debounce parameters: " << its_debounce_parameters.str();
 
-                _epsilon_change_func = [its_debounce](const std::shared_ptr<payload>& _old, const std::shared_ptr<payload>& _new) {
+                auto its_detector = std::make_shared<change_detector>(its_debounce->ignore_);
+                _epsilon_change_func = [its_debounce, its_detector](const std::shared_ptr<payload>& _old,
+                                                                    const std::shared_ptr<payload>& _new) {
                     bool is_changed(false), is_elapsed(false);
 
                     // Check whether we should forward because of changed data
                     if (its_debounce->on_change_) {
-                        length_t its_min_length, its_max_length;
-
-                        if (_old->get_length() < _new->get_length()) {
-                            its_min_length = _old->get_length();
-                            its_max_length = _new->get_length();
-                        } else {
-                            its_min_length = _new->get_length();
-                            its_max_length = _old->get_length();
-                        }
-
-                        // Check whether all additional bytes (if any) are excluded
-                        for (length_t i = its_min_length; i < its_max_length; i++) {
-                            auto j = its_debounce->ignore_.find(i);
-                            // A change is detected when an additional byte is not
-                            // excluded at all or if its exclusion does not cover all
-                            // bits
-                            if (j == its_debounce->ignore_.end() || j->second != 0xFF) {
-                                is_changed = true;
-                                break;
-                            }
-                        }
-
-                        if (!is_changed) {
-                            const byte_t* its_old = _old->get_data();
-                            const byte_t* its_new = _new->get_data();
-                            for (length_t i = 0; i < its_min_length; i++) {
-                                auto j = its_debounce->ignore_.find(i);
-                                if (j == its_debounce->ignore_.end()) {
-                                    if (its_old[i] != its_new[i]) {
-                                        is_changed = true;
-                                        break;
-                                    }
-                                } else if (j->second != 0xFF) {
-                                    if ((its_old[i] & ~(j->second)) != (its_new[i] & ~(j->second))) {
-                                        is_changed = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
+                        is_changed = its_detector->has_changed(_old, _new);
                     }
 
                     if (its_debounce->interval_ > -1) {
@@ -505,6 +473,17 @@ void routing_manager_base::register_event(client_t _client, service_t _service,
         }
     }
 
+    if (_is_provided) {
+        std::shared_ptr<change_filter_t> its_change_filter = configuration_->get_change_filter(_service, _instance, _notifier);
+        if (its_change_filter) {
+            VSOMEIP_INFO << "Using change filter configuration for SOME/IP event " << std::hex << std::setfill('0') << std::setw(4)
+                         << _service << "." << std::setw(4) << _instance << "." << std::setw(4) << _notifier << " (ignore="
+                         << std::dec << its_change_filter->ignore_.size() << ", tolerances=" << its_change_filter->tolerances_.size()
+                         << ")";
+            its_event->set_change_detector(std::make_shared<change_detector>(*its_change_filter));
+        }
+    }
+
     if (transfer_subscriptions_from_any_event) {
         // check if someone subscribed to ANY_EVENT and the subscription
         // was stored in the cache placeholder. Move the subscribers
@@ -541,15 +520,16 @@ void routing_manager_base::register_event(client_t _client, service_t _service,
         its_eventgroupinfo->add_event(its_event);
     }
 
-    std::lock_guard<std::mutex> its_lock(events_mutex_);
+    std::scoped_lock its_lock(events_mutex_);
     events_[service_instance_t{_service, _instance}][_notifier] = its_event;
+    publish_events_unlocked(_service, _instance);
 }
 
 void routing_manager_base::unregister_event(client_t _client, service_t _service, instance_t _instance, event_t _event, bool _is_provided) {
     (void)_client;
     std::shared_ptr<event> its_unrefed_event;
     {
-        std::lock_guard<std::mutex> its_lock(events_mutex_);
+        std::scoped_lock its_lock(events_mutex_);
         const auto search = events_.find(service_instance_t{_service, _instance});
         if (search != events_.end()) {
             const auto found_event = search->second.find(_event);
@@ -559,6 +539,7 @@ void routing_manager_base::unregister_event(client_t _client, service_t _service
                 if (!its_event->has_ref()) {
                     its_unrefed_event = its_event;
                     search->second.erase(found_event);
+                    publish_events_unlocked(_service, _instance);
                 } else if (_is_provided) {
                     its_event->set_provided(false);
                 }
@@ -596,7 +577,7 @@ std::set<std::shared_ptr<event>> routing_manager_base::find_events(service_t _se
 
 std::vector<event_t> routing_manager_base::find_events(service_t _service, instance_t _instance) const {
     std::vector<event_t> its_events;
-    std::lock_guard<std::mutex> its_lock(events_mutex_);
+    std::scoped_lock its_lock(events_mutex_);
     const auto search = events_.find(service_instance_t{_service, _instance});
 
     if (search != events_.end()) {
@@ -753,6 +734,44 @@ void routing_manager_base::notify(service_t _service, instance_t _instance, even
     }
 }
 
+std::vector<bool> routing_manager_base::notify_batch(const std::vector<notification_t>& _notifications, bool _force) {
+
+    std::vector<bool> its_results(_notifications.size(), false);
+
+    // Resolve all events from the same routing snapshot
+    const auto its_events = events_snapshot_.load();
+    const std::unordered_map<event_t, std::shared_ptr<event>>* its_last_events(nullptr);
+    service_t its_last_service(ANY_SERVICE);
+    instance_t its_last_instance(ANY_INSTANCE);
+
+    for (std::size_t i = 0; i < _notifications.size(); ++i) {
+        const auto& its_notification = _notifications[i];
+        if (its_notification.service_ != its_last_service || its_notification.instance_ != its_last_instance) {
+            its_last_service = its_notification.service_;
+            its_last_instance = its_notification.instance_;
+            const auto found_service_instance = its_events->find(service_instance_t{its_last_service, its_last_instance});
+            its_last_events = (found_service_instance != its_events->end() ? found_service_instance->second.get() : nullptr);
+        }
+
+        std::shared_ptr<event> its_event;
+        if (its_last_events) {
+            const auto found_event = its_last_events->find(its_notification.event_);
+            if (found_event != its_last_events->end()) {
+                its_event = found_event->second;
+            }
+        }
+
+        if (its_event) {
+            its_results[i] = its_event->set_payload(its_notification.payload_, _force);
+        } else {
+            VSOMEIP_WARNING << "Attempt to update the undefined event/field [" << std::hex << its_notification.service_ << "."
+                            << its_notification.instance_ << "." << its_notification.event_ << "]";
+        }
+    }
+
+    return its_results;
+}
+
 void routing_manager_base::notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload,
                                       client_t _client, bool _force
 #ifdef VSOMEIP_ENABLE_COMPAT
@@ -938,6 +957,7 @@ std::shared_ptr<serviceinfo> routing_manager_base::create_service_info(service_t
     {
         std::lock_guard<std::mutex> its_lock(services_mutex_);
         services_[_service][_instance] = its_info;
+        publish_services_unlocked();
     }
     if (!_is_local_service) {
         std::lock_guard<std::mutex> its_lock(services_remote_mutex_);
@@ -948,13 +968,10 @@ std::shared_ptr<serviceinfo> routing_manager_base::create_service_info(service_t
 
 std::shared_ptr<serviceinfo> routing_manager_base::find_service(service_t _service, instance_t _instance) const {
     std::shared_ptr<serviceinfo> its_info;
-    std::lock_guard<std::mutex> its_lock(services_mutex_);
-    auto found_service = services_.find(_service);
-    if (found_service != services_.end()) {
-        auto found_instance = found_service->second.find(_instance);
-        if (found_instance != found_service->second.end()) {
-            its_info = found_instance->second;
-        }
+    const auto its_services = services_snapshot_.load();
+    const auto found_service = its_services->find(service_instance_t{_service, _instance});
+    if (found_service != its_services->end()) {
+        its_info = found_service->second;
     }
     return its_info;
 }
@@ -980,6 +997,7 @@ void routing_manager_base::clear_service_info(service_t _service, instance_t _in
                 services_[_service].erase(_instance);
                 deleted_instance = true;
             }
+            publish_services_unlocked();
         } else {
             its_info->set_endpoint(its_empty_endpoint, _reliable);
         }
@@ -1127,14 +1145,14 @@ void routing_manager_base::remove_local(client_t _client,
 }
 
 std::shared_ptr<event> routing_manager_base::find_event(service_t _service, instance_t _instance, event_t _event) const {
-    std::lock_guard<std::mutex> its_lock(events_mutex_);
     std::shared_ptr<event> its_event;
+    const auto its_events = events_snapshot_.load();
 
-    const auto search = events_.find(service_instance_t{_service, _instance});
+    const auto search = its_events->find(service_instance_t{_service, _instance});
 
-    if (search != events_.end()) {
-        const auto found_event = search->second.find(_event);
-        if (found_event != search->second.end()) {
+    if (search != its_events->end()) {
+        const auto found_event = search->second->find(_event);
+        if (found_event != search->second->end()) {
             its_event = found_event->second;
         }
     }
@@ -1142,6 +1160,31 @@ std::shared_ptr<event> routing_manager_base::find_event(service_t _service, inst
     return its_event;
 }
 
+void routing_manager_base::publish_services_unlocked() {
+    auto its_services = std::make_shared<services_snapshot_t>();
+    for (const auto& [its_service, its_instances] : services_) {
+        for (const auto& [its_instance, its_info] : its_instances) {
+            its_services->emplace(service_instance_t{its_service, its_instance}, its_info);
+        }
+    }
+    services_snapshot_.publish(std::move(its_services));
+}
+
+void routing_manager_base::publish_events_unlocked(service_t _service, instance_t _instance) {
+    // Only the entry of the modified service instance is copied, all others
+    // are shared with the previous snapshot.
+    const service_instance_t its_key{_service, _instance};
+    auto its_events = std::make_shared<events_snapshot_t>(*events_snapshot_.load());
+    const auto found_service_instance = events_.find(its_key);
+    if (found_service_instance != events_.end() && !found_service_instance->second.empty()) {
+        (*its_events)[its_key] =
+                std::make_shared<const std::unordered_map<event_t, std::shared_ptr<event>>>(found_service_instance->second);
+    } else {
+        its_events->erase(its_key);
+    }
+    events_snapshot_.publish(std::move(its_events));
+}
+
 std::set<std::shared_ptr<eventgroupinfo>> routing_manager_base::find_eventgroups(service_t _service, instance_t _instance) const {
 
     std::set<std::shared_ptr<eventgroupinfo>> its_eventgroups;
@@ -1210,7 +1253,7 @@ void routing_manager_base::remove_eventgroup_info(service_t _service, instance_t
 
 bool routing_manager_base::send_local_notification(client_t _client, const byte_t* _data, uint32_t _size, instance_t _instance,
                                                    bool _reliable, uint8_t _status_check, bool _force) {
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
     bool has_local(false);
 #endif
     (void)_client;
@@ -1220,14 +1263,15 @@ bool routing_manager_base::send_local_notification(client_t _client, const byte_
 
     std::shared_ptr<event> its_event = find_event(its_service, _instance, its_method);
     if (its_event && !its_event->is_shadow()) {
-        for (auto its_client : its_event->get_filtered_subscribers(_force)) {
+        const auto its_subscribers = its_event->get_filtered_subscribers(_force);
+        for (auto its_client : *its_subscribers) {
 
             // local
             if (its_client == VSOMEIP_ROUTING_CLIENT) {
                 has_remote = true;
                 continue;
             }
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
             else {
                 has_local = true;
             }
@@ -1239,7 +1283,7 @@ bool routing_manager_base::send_local_notification(client_t _client, const byte_
             }
         }
     }
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
     // Trace the message if a local client but will _not_ be forwarded to the routing manager
     if (has_local && !has_remote) {
         trace::header its_header;
@@ -1261,12 +1305,13 @@ bool routing_manager_base::send_local(std::shared_ptr<endpoint>& _target, client
     its_command.set_reliable(_reliable);
     its_command.set_status(_status_check);
     its_command.set_target(_client);
-    its_command.set_message(std::vector<byte_t>(_data, _data + _size));
 
-    std::vector<byte_t> its_buffer;
+    // Copy the message only once, directly behind the command header
+    std::vector<byte_t> its_buffer(protocol::SEND_COMMAND_HEADER_SIZE + _size);
     protocol::error_e its_error;
-    its_command.serialize(its_buffer, its_error);
+    its_command.serialize(&its_buffer[0], _size, its_error);
     if (its_error == protocol::error_e::ERROR_OK) {
+        std::memcpy(&its_buffer[protocol::SEND_COMMAND_HEADER_SIZE], _data, _size);
         has_sent = _target->send(&its_buffer[0], uint32_t(its_buffer.size()));
     }
 
@@ -1412,7 +1457,7 @@ void routing_manager_base::remove_pending_subscription(service_t _service, insta
 
 std::set<std::tuple<service_t, instance_t, eventgroup_t>> routing_manager_base::get_subscriptions(const client_t _client) {
     std::set<std::tuple<service_t, instance_t, eventgroup_t>> result;
-    std::lock_guard<std::mutex> its_lock(events_mutex_);
+    std::scoped_lock its_lock(events_mutex_);
 
     for (const auto& [key, eventmap] : events_) {
         for (auto [event_id, event] : eventmap) {
@@ -1427,7 +1472,7 @@ std::set<std::tuple<service_t, instance_t, eventgroup_t>> routing_manager_base::
 }
 
 void routing_manager_base::clear_shadow_subscriptions(void) {
-    std::lock_guard<std::mutex> its_lock(events_mutex_);
+    std::scoped_lock its_lock(events_mutex_);
 
     for (const auto& [service_instance_key, eventmap] : events_) {
         for (auto [event_id, event] : eventmap) {
@@ -71,9 +71,10 @@
 #include "../../security/include/policy_manager_impl.hpp"
 #include "../../security/include/security.hpp"
 #include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/receive_timestamp.hpp"
 #include "../../utility/include/service_instance_map.hpp"
 #include "../../utility/include/utility.hpp"
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
 #include "../../tracing/include/connector_impl.hpp"
 #endif
 
@@ -224,6 +225,17 @@ std::string routing_manager_client::get_env_unlocked(client_t _client) const {
     return "";
 }
 
+void routing_manager_client::get_metrics(metrics_t& _metrics) const {
+
+    routing_manager_base::get_metrics(_metrics);
+
+    std::scoped_lock its_receiver_lock(receiver_mutex_);
+    endpoint_metrics_t its_metrics;
+    if (receiver_ && receiver_->get_metrics(its_metrics)) {
+        _metrics.endpoints_.push_back(std::move(its_metrics));
+    }
+}
+
 void routing_manager_client::start_keepalive() {
     std::scoped_lock lk{keepalive_mutex_};
     if (!keepalive_active_ && configuration_->is_local_clients_keepalive_enabled()) {
@@ -814,7 +826,7 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
             its_target = ep_mgr_->find_local(_client);
             if (its_target) {
                 is_sent = send_local(its_target, get_client(), _data, _size, _instance, _reliable, protocol::id_e::SEND_ID, _status_check);
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                 if (is_sent) {
                     trace::header its_header;
                     if (its_header.prepare(nullptr, true, _instance))
@@ -826,14 +838,14 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
         }
         // If no direct endpoint could be found
         // or for notifications ~> route to routing_manager_stub
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
         bool message_to_stub(false);
 #endif
         if (!its_target) {
             std::scoped_lock its_sender_lock{sender_mutex_};
             if (sender_) {
                 its_target = sender_;
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                 message_to_stub = true;
 #endif
             } else {
@@ -857,7 +869,7 @@ bool routing_manager_client::send(client_t _client, const byte_t* _data, length_
         if (send) {
             auto its_client{its_command == protocol::id_e::NOTIFY_ONE_ID ? _client : get_client()};
             is_sent = send_local(its_target, its_client, _data, _size, _instance, _reliable, its_command, _status_check);
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
             if (is_sent && !utility::is_notification(VSOMEIP_MESSAGE_TYPE_POS) && !message_to_stub) {
                 trace::header its_header;
                 if (its_header.prepare(nullptr, true, _instance))
@@ -950,7 +962,7 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
 #ifndef VSOMEIP_DISABLE_SECURITY
     bool is_internal_policy_update(false);
 #endif // !VSOMEIP_DISABLE_SECURITY
-    std::vector<byte_t> its_buffer(_data, _data + _size);
+    std::vector<byte_t> its_buffer;
     protocol::error_e its_error;
 
     auto its_policy_manager = configuration_->get_policy_manager();
@@ -958,7 +970,7 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
         return;
 
     protocol::dummy_command its_dummy_command;
-    its_dummy_command.deserialize(its_buffer, its_error);
+    its_dummy_command.deserialize(_data, _size, its_error);
 
     if (its_error == protocol::error_e::ERROR_OK) {
         its_id = its_dummy_command.get_id();
@@ -986,14 +998,20 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
             return;
         }
 
+        // SEND and ROUTING_INFO commands are decoded from the receive buffer
+        if (its_id != protocol::id_e::SEND_ID && its_id != protocol::id_e::ROUTING_INFO_ID) {
+            its_buffer.assign(_data, _data + _size);
+        }
+
         switch (its_id) {
         case protocol::id_e::SEND_ID: {
+            const receive_timestamp::routing_scope its_routing_scope(configuration_->is_latency_statistics_enabled());
             protocol::send_command its_send_command(protocol::id_e::SEND_ID);
-            its_send_command.deserialize(its_buffer, its_error);
+            its_send_command.deserialize(_data, _size, its_error);
             if (its_error == protocol::error_e::ERROR_OK) {
 
                 auto a_deserializer = get_deserializer();
-                a_deserializer->set_data(its_send_command.get_message());
+                a_deserializer->set_view(its_send_command.get_message_data(), its_send_command.get_message_size());
                 std::shared_ptr<message_impl> its_message(a_deserializer->deserialize_message());
                 a_deserializer->reset();
                 put_deserializer(a_deserializer);
@@ -1123,7 +1141,7 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
                         }
                     }
                     host_->on_message(std::move(its_message));
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                     if (client_side_logging_
                         && (client_side_logging_filter_.empty()
                             || (1 == client_side_logging_filter_.count(std::make_tuple(its_message->get_service(), ANY_INSTANCE)))
@@ -1178,7 +1196,7 @@ void routing_manager_client::on_message(const byte_t* _data, length_t _size, end
             its_command.deserialize(its_buffer, its_error);
             if (its_error == protocol::error_e::ERROR_OK) {
                 send_pong();
-                VSOMEIP_TRACE << "PING(" << std::hex << std::setfill('0') << std::setw(4) << get_client() << ")";
+                VSOMEIP_TRACE_F("PING({:04x})", get_client());
             } else {
                 VSOMEIP_ERROR << __func__ << ": pong command deserialization failed (" << std::dec << static_cast<int>(its_error) << ")";
             }
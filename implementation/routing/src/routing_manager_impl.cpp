@@ -3,6 +3,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <climits>
 #include <iomanip>
 #include <memory>
@@ -50,8 +51,12 @@
 #include "../../service_discovery/include/runtime.hpp"
 #include "../../service_discovery/include/service_discovery.hpp"
 #include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/handler_statistics.hpp"
+#include "../../utility/include/instrumentation.hpp"
+#include "../../utility/include/latency_statistics.hpp"
+#include "../../utility/include/receive_timestamp.hpp"
 #include "../../utility/include/utility.hpp"
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
 #include "../../tracing/include/connector_impl.hpp"
 #endif
 
@@ -62,7 +67,7 @@
 #include "../../e2e_protection/include/e2e/profile/e2e_provider.hpp"
 #endif
 
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
 #include "../../tracing/include/connector_impl.hpp"
 #endif
 
@@ -74,6 +79,8 @@ runtime::~runtime() { }
 }
 #endif
 
+thread_local routing_manager_impl::notification_batch_t* routing_manager_impl::notification_batch_(nullptr);
+
 routing_manager_impl::routing_manager_impl(routing_manager_host* _host) :
     routing_manager_base(_host), version_log_timer_(_host->get_io()), if_state_running_(false), sd_route_set_(false),
     routing_running_(false), status_log_timer_(_host->get_io()), memory_log_timer_(_host->get_io()),
@@ -782,7 +789,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
         } else if (is_notification && _client && !is_service_discovery) { // Selective notifications!
             if (_client == get_client()) {
                 deliver_message(_data, _size, _instance, _reliable, _bound_client, _sec_client, _status_check, _sent_from_remote);
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                 trace::header its_header;
                 if (its_header.prepare(its_target, true, _instance))
                     tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
@@ -795,7 +802,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
 
         if (its_target) {
             is_sent = send_local(its_target, its_target_client, _data, _size, _instance, _reliable, protocol::id_e::SEND_ID, _status_check);
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
             if (is_sent
                 && ((is_request && its_client == get_client()) || (is_response && find_local_client(its_service, _instance) == get_client())
                     || (is_notification && find_local_client(its_service, _instance) == VSOMEIP_ROUTING_CLIENT))) {
@@ -841,7 +848,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
                     its_target = ep_mgr_impl_->find_or_create_remote_client(its_service, _instance, _reliable);
                     if (its_target) {
                         is_sent = its_target->send(_data, _size);
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                         if (is_sent) {
                             trace::header its_header;
                             if (its_header.prepare(its_target, true, _instance))
@@ -863,64 +870,33 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
                             method_t its_method_inner = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
                             std::shared_ptr<event> its_event = find_event(its_service, _instance, its_method_inner);
                             if (its_event) {
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                                 bool has_sent(false);
 #endif
-                                std::set<std::shared_ptr<endpoint_definition>> its_targets;
                                 // we need both endpoints as clients can subscribe to events via TCP
                                 // and UDP
                                 std::shared_ptr<endpoint> its_udp_server_endpoint = its_info->get_endpoint(false);
                                 std::shared_ptr<endpoint> its_tcp_server_endpoint = its_info->get_endpoint(true);
 
-                                if (its_udp_server_endpoint || its_tcp_server_endpoint) {
-                                    const auto its_reliability = its_event->get_reliability();
-                                    for (auto its_group : its_event->get_eventgroups()) {
-                                        auto its_eventgroup = find_eventgroup(its_service, _instance, its_group);
-                                        if (its_eventgroup) {
-                                            // Unicast targets
-                                            for (const auto& its_remote : its_eventgroup->get_unicast_targets()) {
-                                                if (its_remote->is_reliable() && its_tcp_server_endpoint) {
-                                                    if (its_reliability == reliability_type_e::RT_RELIABLE
-                                                        || its_reliability == reliability_type_e::RT_BOTH) {
-                                                        its_targets.insert(its_remote);
-                                                    }
-                                                } else if (its_udp_server_endpoint && !its_eventgroup->is_sending_multicast()) {
-                                                    if (its_reliability == reliability_type_e::RT_UNRELIABLE
-                                                        || its_reliability == reliability_type_e::RT_BOTH) {
-                                                        its_targets.insert(its_remote);
-                                                    }
-                                                }
-                                            }
-                                            // Send to multicast targets if subscribers are still
-                                            // interested
-                                            if (its_eventgroup->is_sending_multicast()) {
-                                                if (its_reliability == reliability_type_e::RT_UNRELIABLE
-                                                    || its_reliability == reliability_type_e::RT_BOTH) {
-                                                    boost::asio::ip::address its_address;
-                                                    uint16_t its_port;
-                                                    if (its_eventgroup->get_multicast(its_address, its_port)) {
-                                                        std::shared_ptr<endpoint_definition> its_multicast_target;
-                                                        its_multicast_target = endpoint_definition::get(its_address, its_port, false,
-                                                                                                        its_service, _instance);
-                                                        its_targets.insert(its_multicast_target);
-                                                    }
-                                                }
-                                            }
-                                        }
+                                const auto its_targets = its_event->get_remote_targets();
+                                std::shared_ptr<const std::vector<byte_t>> its_message;
+                                if (its_tcp_server_endpoint) {
+                                    for (const auto& its_target : its_targets->reliable_) {
+                                        send_notification(its_tcp_server_endpoint, its_target, _data, _size, its_message);
+#ifdef VSOMEIP_ENABLE_TRACING
+                                        has_sent = true;
+#endif
                                     }
                                 }
-
-                                for (auto const& target : its_targets) {
-                                    if (target->is_reliable()) {
-                                        its_tcp_server_endpoint->send_to(target, _data, _size);
-                                    } else {
-                                        its_udp_server_endpoint->send_to(target, _data, _size);
-                                    }
-#ifdef USE_DLT
-                                    has_sent = true;
+                                if (its_udp_server_endpoint) {
+                                    for (const auto& its_target : its_targets->unreliable_) {
+                                        send_notification(its_udp_server_endpoint, its_target, _data, _size, its_message);
+#ifdef VSOMEIP_ENABLE_TRACING
+                                        has_sent = true;
 #endif
+                                    }
                                 }
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                                 if (has_sent) {
                                     trace::header its_header;
                                     if (its_header.prepare(nullptr, true, _instance))
@@ -946,7 +922,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t* _data, length_t
                                                               : its_info->get_endpoint(_reliable);
                             if (its_target) {
                                 is_sent = its_target->send(_data, _size);
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                                 if (is_sent) {
                                     trace::header its_header;
                                     if (its_header.prepare(its_target, true, _instance))
@@ -1023,7 +999,7 @@ bool routing_manager_impl::send_to(const std::shared_ptr<endpoint_definition>& _
 
     if (its_endpoint) {
         is_sent = its_endpoint->send_to(_target, _data, _size);
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
         if (is_sent) {
             trace::header its_header;
             if (its_header.prepare(its_endpoint, true, _instance))
@@ -1043,7 +1019,7 @@ bool routing_manager_impl::send_via_sd(const std::shared_ptr<endpoint_definition
 
     if (its_endpoint) {
         is_sent = its_endpoint->send_to(_target, _data, _size);
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
         if (is_sent && tc_->is_sd_enabled()) {
             trace::header its_header;
             if (its_header.prepare(its_endpoint, true, 0x0))
@@ -1144,6 +1120,47 @@ void routing_manager_impl::notify_one(service_t _service, instance_t _instance,
     }
 }
 
+std::vector<bool> routing_manager_impl::notify_batch(const std::vector<notification_t>& _notifications, bool _force) {
+
+    if (notification_batch_) {
+        // Nested call (e.g. from a handler), the outer batch collects
+        return routing_manager_base::notify_batch(_notifications, _force);
+    }
+
+    notification_batch_t its_batch;
+    std::vector<bool> its_results;
+    {
+        notification_batch_scope its_scope(its_batch);
+        its_results = routing_manager_base::notify_batch(_notifications, _force);
+    }
+
+    // One endpoint lock and one dispatch timer restart per target
+    for (const auto& e : its_batch.entries_) {
+        e.second.endpoint_->send_batch_to(e.second.target_, e.second.messages_);
+    }
+
+    return its_results;
+}
+
+void routing_manager_impl::send_notification(const std::shared_ptr<endpoint>& _endpoint,
+                                             const std::shared_ptr<endpoint_definition>& _target, const byte_t* _data, uint32_t _size,
+                                             std::shared_ptr<const std::vector<byte_t>>& _message) {
+
+    if (notification_batch_) {
+        auto& its_entry = notification_batch_->entries_[std::make_pair(_endpoint.get(), _target.get())];
+        if (!its_entry.endpoint_) {
+            its_entry.endpoint_ = _endpoint;
+            its_entry.target_ = _target;
+        }
+        if (!_message) {
+            _message = std::make_shared<const std::vector<byte_t>>(_data, _data + _size);
+        }
+        its_entry.messages_.push_back(_message);
+    } else {
+        _endpoint->send_to(_target, _data, _size);
+    }
+}
+
 void routing_manager_impl::on_availability(service_t _service, instance_t _instance, availability_state_e _state, major_version_t _major,
                                            minor_version_t _minor) {
     // insert subscriptions of routing manager into service discovery
@@ -1276,7 +1293,7 @@ void routing_manager_impl::on_message(const byte_t* _data, length_t _size, endpo
     uint8_t its_check_status = e2e::profile_interface::generic_check_status::E2E_OK;
     instance_t its_instance(0x0);
     message_type_e its_message_type;
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
     bool is_forwarded(true);
 #endif
     if (_size >= VSOMEIP_SOMEIP_HEADER_SIZE) {
@@ -1378,15 +1395,26 @@ void routing_manager_impl::on_message(const byte_t* _data, length_t _size, endpo
                 return;
             }
 
+            auto its_latency_statistics = host_->get_latency_statistics();
+            if (its_latency_statistics) {
+                const auto its_socket_time = receive_timestamp::get_socket_time();
+                if (its_socket_time != receive_timestamp::socket_time_t()) {
+                    its_method = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
+                    its_latency_statistics->record(its_service, its_instance, its_method, latency_stage_e::LS_SOCKET_TO_ROUTING,
+                                                   std::chrono::system_clock::now() - its_socket_time);
+                }
+            }
+            const receive_timestamp::routing_scope its_routing_scope(its_latency_statistics != nullptr);
+
             // Common way of message handling
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
             is_forwarded =
 #endif
                     on_message(its_service, its_instance, _data, _size, _receiver->is_reliable(), _bound_client, _sec_client,
                                its_check_status, true);
         }
     }
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
     if (is_forwarded) {
         trace::header its_header;
         const boost::asio::ip::address_v4 its_remote_address =
@@ -1620,7 +1648,7 @@ bool routing_manager_impl::deliver_message(const byte_t* _data, length_t _size,
     bool is_delivered(false);
 
     auto its_deserializer = get_deserializer();
-    its_deserializer->set_data(_data, _size);
+    its_deserializer->set_view(_data, _size);
     std::shared_ptr<message_impl> its_message(its_deserializer->deserialize_message());
     its_deserializer->reset();
     put_deserializer(its_deserializer);
@@ -1742,7 +1770,7 @@ bool routing_manager_impl::has_subscribed_eventgroup(service_t _service, instanc
     if (search != eventgroups_.end()) {
         for (const auto& e : search->second) {
             for (const auto& its_event : e.second->get_events()) {
-                if (!its_event->get_subscribers().empty()) {
+                if (!its_event->get_fanout()->empty()) {
                     return true;
                 }
             }
@@ -1763,7 +1791,7 @@ bool routing_manager_impl::deliver_notification(service_t _service, instance_t _
     std::shared_ptr<event> its_event = find_event(_service, _instance, its_event_id);
     if (its_event) {
         if (!its_event->is_provided()) {
-            if (its_event->get_subscribers().size() == 0) {
+            if (its_event->get_fanout()->empty()) {
                 // no subscribers for this specific event / check subscriptions
                 // to other events of the event's eventgroups
                 bool cache_event = false;
@@ -1771,7 +1799,7 @@ bool routing_manager_impl::deliver_notification(service_t _service, instance_t _
                     std::shared_ptr<eventgroupinfo> egi = find_eventgroup(_service, _instance, eg);
                     if (egi) {
                         for (const auto& e : egi->get_events()) {
-                            cache_event = (e->get_subscribers().size() > 0);
+                            cache_event = !e->get_fanout()->empty();
                             if (cache_event) {
                                 break;
                             }
@@ -1798,9 +1826,9 @@ bool routing_manager_impl::deliver_notification(service_t _service, instance_t _
 
         // Ignore the filter for messages coming from other local clients
         // as the filter was already applied there.
-        auto its_subscribers = its_event->update_and_get_filtered_subscribers(its_payload, _is_from_remote);
+        const auto its_subscribers = its_event->update_and_get_filtered_subscribers(its_payload, _is_from_remote);
         if (its_event->get_type() != event_type_e::ET_SELECTIVE_EVENT) {
-            for (const auto its_local_client : its_subscribers) {
+            for (const auto its_local_client : *its_subscribers) {
                 if (its_local_client == host_->get_client()) {
                     deliver_message(_data, _length, _instance, _reliable, _bound_client, _sec_client, _status_check, _is_from_remote);
                 } else {
@@ -1818,7 +1846,7 @@ bool routing_manager_impl::deliver_notification(service_t _service, instance_t _
             if (its_client_id == VSOMEIP_ROUTING_CLIENT)
                 its_client_id = get_client();
 
-            if (its_subscribers.find(its_client_id) != its_subscribers.end()) {
+            if (std::binary_search(its_subscribers->begin(), its_subscribers->end(), its_client_id)) {
                 if (its_client_id == host_->get_client()) {
                     deliver_message(_data, _length, _instance, _reliable, _bound_client, _sec_client, _status_check, _is_from_remote);
                 } else {
@@ -2782,7 +2810,7 @@ void routing_manager_impl::send_error(return_code_e _return_code, const byte_t*
                         ep_mgr_impl_->find_server_endpoint(its_endpoint_def->get_remote_port(), its_endpoint_def->is_reliable());
                 if (its_endpoint) {
                     its_endpoint->send_error(its_endpoint_def, its_serializer->get_data(), its_serializer->get_size());
-#ifdef USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
                     trace::header its_header;
                     if (its_header.prepare(its_endpoint, true, _instance))
                         tc_->trace(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, _data, _size);
@@ -3849,6 +3877,38 @@ void routing_manager_impl::status_log_timer_cbk(boost::system::error_code const&
     }
 
     ep_mgr_impl_->print_status();
+
+    auto its_handler_statistics = host_->get_handler_statistics();
+    if (its_handler_statistics) {
+        // The durations are cumulative and given in microseconds
+        std::stringstream its_handler_log;
+        for (const auto& p : handler_statistics::get_slowest(its_handler_statistics->get(), configuration_->get_slow_handlers_count())) {
+            its_handler_log << std::dec << static_cast<int>(p.kind_) << "/" << std::hex << std::setfill('0') << std::setw(4) << p.service_
+                            << "." << std::setw(4) << p.method_ << ": #=" << std::dec << p.wall_time_.count_
+                            << " p50=" << latency_histogram::get_percentile(p.wall_time_, 50.0).count() / 1000
+                            << " p99=" << latency_histogram::get_percentile(p.wall_time_, 99.0).count() / 1000
+                            << " max=" << p.wall_time_.max_.count() / 1000
+                            << " cpu_p99=" << latency_histogram::get_percentile(p.cpu_time_, 99.0).count() / 1000 << ", ";
+        }
+        std::stringstream its_queue_log;
+        for (const auto& s : host_->get_dispatch_queue_history()) {
+            its_queue_log << std::dec << s.max_depth_ << " ";
+        }
+        VSOMEIP_INFO << "Slowest handlers: [" << its_handler_log.str() << "] dispatch queue depth (max/s): [" << its_queue_log.str() << "]";
+    }
+
+    if (instrumentation::is_enabled()) {
+        // The durations are cumulative and given in microseconds
+        std::stringstream its_lock_log;
+        const auto its_sites = instrumentation::get_lock_sites();
+        for (std::size_t i = 0; i < its_sites.size() && i < VSOMEIP_MAX_LOGGED_LOCK_SITES; ++i) {
+            const auto& s = its_sites[i];
+            its_lock_log << s.name_ << ": #=" << std::dec << s.acquisitions_ << " contended=" << s.wait_time_.count_
+                         << " wait=" << s.wait_time_.sum_.count() / 1000 << " max=" << s.wait_time_.max_.count() / 1000 << ", ";
+        }
+        VSOMEIP_INFO << "Lock contention: [" << its_lock_log.str() << "] allocations: " << std::dec << instrumentation::get_allocations();
+    }
+
     {
         std::scoped_lock its_lock{status_log_timer_mutex_};
         status_log_timer_.expires_after(std::chrono::seconds(configuration_->get_log_status_interval()));
@@ -3994,6 +4054,16 @@ void routing_manager_impl::print_stub_status() const {
         stub_->print_endpoint_status();
 }
 
+void routing_manager_impl::get_metrics(metrics_t& _metrics) const {
+    ep_mgr_impl_->get_metrics(_metrics.endpoints_);
+    if (stub_) {
+        stub_->get_endpoint_metrics(_metrics.endpoints_);
+    }
+    if (discovery_) {
+        discovery_->get_metrics(_metrics.sd_messages_sent_, _metrics.sd_messages_received_);
+    }
+}
+
 void routing_manager_impl::service_endpoint_connected(service_t _service, instance_t _instance, major_version_t _major,
                                                       minor_version_t _minor, const std::shared_ptr<endpoint>& _endpoint,
                                                       bool _unreliable_only) {
@@ -4188,6 +4258,25 @@ void routing_manager_impl::statistics_log_timer_cbk(boost::system::error_code co
             VSOMEIP_INFO << "Received events statistics: [" << its_log.str() << "]";
         }
 
+        auto its_latency_statistics = host_->get_latency_statistics();
+        if (its_latency_statistics) {
+            // The histograms are cumulative, the latencies are given in microseconds
+            std::stringstream its_latency_log;
+            for (const auto& h : its_latency_statistics->get()) {
+                its_latency_log << std::hex << std::setfill('0') << std::setw(4) << h.service_ << "." << std::setw(4) << h.instance_ << "."
+                                << std::setw(4) << h.method_ << "/" << std::dec << static_cast<int>(h.stage_) << ": #=" << h.count_
+                                << " p50=" << latency_histogram::get_percentile(h, 50.0).count() / 1000
+                                << " p99=" << latency_histogram::get_percentile(h, 99.0).count() / 1000
+                                << " max=" << h.max_.count() / 1000 << ", ";
+            }
+            if (its_latency_statistics->get_ignored()) {
+                its_latency_log << std::dec << " #ignored: " << its_latency_statistics->get_ignored();
+            }
+            if (its_latency_log.str().length() > 0) {
+                VSOMEIP_INFO << "Receive latency statistics: [" << its_latency_log.str() << "]";
+            }
+        }
+
         {
             std::scoped_lock its_lock{statistics_log_timer_mutex_};
             statistics_log_timer_.expires_after(std::chrono::milliseconds(its_interval));
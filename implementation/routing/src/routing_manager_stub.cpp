@@ -58,6 +58,7 @@
 #include "../../security/include/policy_manager_impl.hpp"
 #include "../../security/include/security.hpp"
 #include "../../utility/include/bithelper.hpp"
+#include "../../utility/include/receive_timestamp.hpp"
 #include "../../utility/include/utility.hpp"
 
 namespace vsomeip_v3 {
@@ -252,12 +253,12 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
     std::uint16_t its_subscription_id(PENDING_SUBSCRIPTION_ID);
     port_t its_port(ILLEGAL_PORT);
 
-    std::vector<byte_t> its_buffer(_data, _data + _size);
+    std::vector<byte_t> its_buffer;
     protocol::error_e its_error;
 
     // Use dummy command to deserialize id and client.
     protocol::dummy_command its_base_command;
-    its_base_command.deserialize(its_buffer, its_error);
+    its_base_command.deserialize(_data, _size, its_error);
     if (its_error != protocol::error_e::ERROR_OK) {
 
         VSOMEIP_ERROR << __func__ << ": deserialization of command and client identifier failed (" << std::dec
@@ -276,6 +277,11 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
         return;
     }
 
+    // SEND and NOTIFY commands are decoded from the receive buffer
+    if (its_id != protocol::id_e::SEND_ID && its_id != protocol::id_e::NOTIFY_ID && its_id != protocol::id_e::NOTIFY_ONE_ID) {
+        its_buffer.assign(_data, _data + _size);
+    }
+
     switch (its_id) {
 
     case protocol::id_e::REGISTER_APPLICATION_ID: {
@@ -488,12 +494,14 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
     }
 
     case protocol::id_e::SEND_ID: {
+        const receive_timestamp::routing_scope its_routing_scope(configuration_->is_latency_statistics_enabled());
         protocol::send_command its_command(its_id);
-        its_command.deserialize(its_buffer, its_error);
+        its_command.deserialize(_data, _size, its_error);
         if (its_error == protocol::error_e::ERROR_OK) {
 
-            auto its_message_data(its_command.get_message());
-            if (its_message_data.size() > VSOMEIP_MESSAGE_TYPE_POS) {
+            const byte_t* its_message_data(its_command.get_message_data());
+            const std::size_t its_message_size(its_command.get_message_size());
+            if (its_message_size > VSOMEIP_MESSAGE_TYPE_POS) {
 
                 its_service = bithelper::read_uint16_be(&its_message_data[VSOMEIP_SERVICE_POS_MIN]);
                 its_method = bithelper::read_uint16_be(&its_message_data[VSOMEIP_METHOD_POS_MIN]);
@@ -518,12 +526,12 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
                 }
                 // reduce by size of instance, flush, reliable, client and is_valid_crc flag
                 uint32_t its_contained_size = bithelper::read_uint32_be(&its_message_data[VSOMEIP_LENGTH_POS_MIN]);
-                if (its_message_data.size() != its_contained_size + VSOMEIP_SOMEIP_HEADER_SIZE) {
+                if (its_message_size != its_contained_size + VSOMEIP_SOMEIP_HEADER_SIZE) {
                     VSOMEIP_WARNING << "Received a SEND command containing message with invalid "
                                        "size -> skip!";
                     break;
                 }
-                host_->on_message(its_service, its_instance, &its_message_data[0], length_t(its_message_data.size()), is_reliable,
+                host_->on_message(its_service, its_instance, its_message_data, length_t(its_message_size), is_reliable,
                                   _bound_client, _sec_client, its_check_status, false);
             }
         }
@@ -533,11 +541,12 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
     case protocol::id_e::NOTIFY_ID:
     case protocol::id_e::NOTIFY_ONE_ID: {
         protocol::send_command its_command(its_id);
-        its_command.deserialize(its_buffer, its_error);
+        its_command.deserialize(_data, _size, its_error);
         if (its_error == protocol::error_e::ERROR_OK) {
 
-            auto its_message_data(its_command.get_message());
-            if (its_message_data.size() > VSOMEIP_MESSAGE_TYPE_POS) {
+            const byte_t* its_message_data(its_command.get_message_data());
+            const std::size_t its_message_size(its_command.get_message_size());
+            if (its_message_size > VSOMEIP_MESSAGE_TYPE_POS) {
 
                 its_client = its_command.get_target();
                 its_service = bithelper::read_uint16_be(&its_message_data[VSOMEIP_SERVICE_POS_MIN]);
@@ -545,13 +554,13 @@ void routing_manager_stub::on_message(const byte_t* _data, length_t _size, endpo
 
                 uint32_t its_contained_size = bithelper::read_uint32_be(&its_message_data[VSOMEIP_LENGTH_POS_MIN]);
 
-                if (its_message_data.size() != its_contained_size + VSOMEIP_SOMEIP_HEADER_SIZE) {
+                if (its_message_size != its_contained_size + VSOMEIP_SOMEIP_HEADER_SIZE) {
                     VSOMEIP_WARNING << "Received a NOTIFY command containing message with invalid "
                                        "size -> skip!";
                     break;
                 }
 
-                host_->on_notification(its_client, its_service, its_instance, &its_message_data[0], length_t(its_message_data.size()),
+                host_->on_notification(its_client, its_service, its_instance, its_message_data, length_t(its_message_size),
                                        its_id == protocol::id_e::NOTIFY_ONE_ID);
                 break;
             }
@@ -1952,6 +1961,16 @@ void routing_manager_stub::print_endpoint_status() const {
     }
 }
 
+void routing_manager_stub::get_endpoint_metrics(std::vector<endpoint_metrics_t>& _metrics) const {
+    endpoint_metrics_t its_metrics;
+    if (local_receiver_ && local_receiver_->get_metrics(its_metrics)) {
+        _metrics.push_back(its_metrics);
+    }
+    if (root_ && root_->get_metrics(its_metrics)) {
+        _metrics.push_back(its_metrics);
+    }
+}
+
 bool routing_manager_stub::send_provided_event_resend_request(client_t _client, pending_remote_offer_id_t _id) {
 
     std::shared_ptr<endpoint> its_endpoint = host_->find_local(_client);
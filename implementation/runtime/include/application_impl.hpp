@@ -33,12 +33,18 @@
 #include "../../configuration/include/internal.hpp"
 #endif // ANDROID
 #include "../../routing/include/routing_manager_host.hpp"
+#include "../../utility/include/handler_statistics.hpp"
+#include "../../utility/include/instrumentation.hpp"
+#include "../../utility/include/latency_statistics.hpp"
+#include "../../utility/include/metrics.hpp"
 #include "../../utility/include/service_instance_map.hpp"
 
 namespace vsomeip_v3 {
 
 class runtime;
 class configuration;
+class low_latency_io;
+class metrics_exporter;
 class routing_manager;
 class routing_manager_stub;
 
@@ -88,6 +94,14 @@ public:
     VSOMEIP_EXPORT void notify(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload,
                                bool _force) const;
 
+    VSOMEIP_EXPORT std::vector<bool> notify_batch(const std::vector<notification_t>& _notifications, bool _force) const;
+
+    VSOMEIP_EXPORT std::vector<latency_histogram_t> get_latency_histograms() const;
+
+    VSOMEIP_EXPORT metrics_t get_metrics() const;
+    VSOMEIP_EXPORT std::vector<handler_profile_t> get_handler_profiles() const;
+    VSOMEIP_EXPORT std::vector<dispatch_queue_sample_t> get_dispatch_queue_history() const;
+
     VSOMEIP_EXPORT void notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload,
                                    client_t _client, bool _force) const;
 
@@ -126,6 +140,8 @@ public:
     VSOMEIP_EXPORT std::shared_ptr<policy_manager> get_policy_manager() const;
     VSOMEIP_EXPORT std::shared_ptr<configuration_public> get_public_configuration() const;
     VSOMEIP_EXPORT boost::asio::io_context& get_io();
+    VSOMEIP_EXPORT latency_statistics* get_latency_statistics() const;
+    VSOMEIP_EXPORT handler_statistics* get_handler_statistics() const;
 
     VSOMEIP_EXPORT void on_state(state_type_e _state);
     VSOMEIP_EXPORT void on_availability(service_t _service, instance_t _instance, availability_state_e _state, major_version_t _major,
@@ -218,6 +234,9 @@ private:
             handler_(nullptr), service_id_(_service_id), instance_id_(_instance_id), method_id_(_method_id), session_id_(_session_id),
             eventgroup_id_(_eventgroup_id), handler_type_(_handler_type) { }
 
+        // Set for messages
+        std::chrono::steady_clock::time_point queued_;
+
         std::function<void()> handler_;
         service_t service_id_;
         instance_t instance_id_;
@@ -262,6 +281,7 @@ private:
     bool check_subscription_state(service_t _service, instance_t _instance, eventgroup_t _eventgroup, event_t _event);
 
     void print_blocking_call(const std::shared_ptr<sync_handler>& _handler);
+    static handler_kind_e get_handler_kind(handler_type_e _type);
 
     void watchdog_cbk(boost::system::error_code const& _error);
 
@@ -299,6 +319,25 @@ private:
     const std::string path_;
     std::shared_ptr<configuration> configuration_;
 
+    // Created by init if enabled, see get_latency_statistics
+    std::unique_ptr<latency_statistics> latency_statistics_;
+
+    // Created by init if enabled, see get_handler_profiles
+    std::unique_ptr<handler_statistics> handler_statistics_;
+    // Recorded under handlers_mutex_ if handler_statistics_ exists
+    queue_depth_history dispatch_queue_history_;
+
+    // Attached to io_ by init if low latency services are configured
+    low_latency_io* low_latency_io_{nullptr};
+
+    // Created by init, see get_metrics
+    std::unique_ptr<service_metrics> service_metrics_;
+    dispatch_counters dispatch_counters_;
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+    // Created by init if a metrics socket is configured
+    std::shared_ptr<metrics_exporter> metrics_exporter_;
+#endif
+
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
     pthread_t start_thread_;
 #endif
@@ -353,7 +392,7 @@ private:
 
     // Handlers
     mutable std::deque<std::shared_ptr<sync_handler>> handlers_;
-    mutable std::mutex handlers_mutex_;
+    mutable named_mutex handlers_mutex_;
 
     // Dispatching
     std::atomic<bool> is_dispatching_;
@@ -371,7 +410,7 @@ private:
 
     // Condition to wakeup the dispatcher thread
     bool elapse_unactive_dispatchers_;
-    mutable std::condition_variable dispatcher_condition_;
+    mutable named_mutex::condition_variable dispatcher_condition_;
     std::size_t max_dispatchers_;
     std::size_t max_dispatch_time_;
 
@@ -32,12 +32,17 @@
 #include "../../configuration/include/configuration_plugin.hpp"
 #endif // VSOMEIP_ENABLE_MULTIPLE_ROUTING_MANAGERS
 #include "../../endpoints/include/endpoint.hpp"
+#include "../../endpoints/include/uring_socket_factory.hpp"
 #include "../../message/include/serializer.hpp"
 #include "../../plugin/include/plugin_manager_impl.hpp"
 #include "../../routing/include/routing_manager_impl.hpp"
 #include "../../routing/include/routing_manager_client.hpp"
 #include "../../security/include/security.hpp"
 #include "../../tracing/include/connector_impl.hpp"
+#include "../../utility/include/io_shards.hpp"
+#include "../../utility/include/low_latency_io.hpp"
+#include "../../utility/include/metrics_exporter.hpp"
+#include "../../utility/include/receive_timestamp.hpp"
 #include "../../utility/include/utility.hpp"
 
 namespace vsomeip_v3 {
@@ -59,7 +64,7 @@ application_impl::application_impl(const std::string& _name, const std::string&
 #ifdef VSOMEIP_ENABLE_SIGNAL_HANDLING
     signals_{io_, SIGINT, SIGTERM}, catched_signal_{false},
 #endif
-    is_dispatching_{false}, max_dispatchers_{VSOMEIP_DEFAULT_MAX_DISPATCHERS}, max_dispatch_time_{VSOMEIP_DEFAULT_MAX_DISPATCH_TIME},
+    handlers_mutex_{"application_impl::handlers_mutex_"}, is_dispatching_{false}, max_dispatchers_{VSOMEIP_DEFAULT_MAX_DISPATCHERS}, max_dispatch_time_{VSOMEIP_DEFAULT_MAX_DISPATCH_TIME},
     dispatcher_counter_{0}, max_detached_thread_wait_time{VSOMEIP_MAX_WAIT_TIME_DETACHED_THREADS}, stopped_{false},
     block_stop_condition_{false}, is_routing_manager_host_{false}, stopped_called_{false}, watchdog_timer_{io_},
     client_side_logging_{false}, has_session_handling_{true} {
@@ -279,6 +284,42 @@ bool application_impl::init() {
                 is_routing_manager_host_ = utility::is_routing_manager(configuration_->get_network());
         }
 
+#ifdef VSOMEIP_HAS_IO_URING
+        if (configuration_->is_io_uring_enabled()) {
+            // Only takes effect if no socket was created so far. Set once per process, the io threads
+            // of the applications that already run may read the factory concurrently.
+            static std::once_flag its_io_uring_flag;
+            std::call_once(its_io_uring_flag, [this] {
+                set_abstract_factory(std::make_shared<uring_socket_factory>(configuration_->get_io_uring_queue_depth()));
+            });
+        }
+#endif
+
+        // Endpoints are pinned to their io_context when they are created
+        const size_t its_io_thread_count = configuration_->get_io_thread_count(name_);
+        if (configuration_->has_io_sharding(name_) && its_io_thread_count > 1) {
+            boost::asio::use_service<io_shards>(io_).resize(its_io_thread_count);
+            VSOMEIP_INFO << "Application \"" << name_ << "\" runs one io_context per io thread.";
+        }
+
+        // Must be configured before the routing manager creates the endpoints
+        const auto its_low_latency_services = configuration_->get_low_latency_services(name_);
+        if (!its_low_latency_services.empty()) {
+            low_latency_io_ = &boost::asio::use_service<low_latency_io>(io_);
+            low_latency_io_->configure(its_low_latency_services, configuration_->get_low_latency_cpus(name_),
+                                       configuration_->get_low_latency_busy_poll(name_));
+            VSOMEIP_INFO << "Application \"" << name_ << "\" busy polls " << std::dec << its_low_latency_services.size()
+                         << " low latency service(s).";
+        }
+
+        if (configuration_->is_latency_statistics_enabled()) {
+            latency_statistics_ = std::make_unique<latency_statistics>(configuration_->get_statistics_max_messages());
+        }
+        if (configuration_->is_handler_profiling_enabled()) {
+            handler_statistics_ = std::make_unique<handler_statistics>(configuration_->get_statistics_max_messages());
+        }
+        service_metrics_ = std::make_unique<service_metrics>(configuration_->get_metrics_max_services());
+
         if (is_routing_manager_host_) {
             VSOMEIP_INFO << "Instantiating routing manager [Host].";
             if (client_ == VSOMEIP_CLIENT_UNSET) {
@@ -293,7 +334,15 @@ bool application_impl::init() {
 
         routing_->init();
 
-#ifdef USE_DLT
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+        const auto its_metrics_socket = configuration_->get_metrics_socket();
+        if (!its_metrics_socket.empty()) {
+            metrics_exporter_ = std::make_shared<metrics_exporter>(io_, its_metrics_socket + "-" + name_,
+                                                                   [this]() { return to_prometheus(get_metrics(), name_); });
+        }
+#endif
+
+#ifdef VSOMEIP_ENABLE_TRACING
         // Tracing
         std::shared_ptr<trace::connector_impl> its_connector = trace::connector_impl::get();
         std::shared_ptr<cfg::trace> its_trace_configuration = its_configuration->get_trace();
@@ -376,6 +425,9 @@ void application_impl::start() {
         std::scoped_lock its_lock{start_stop_mutex_};
         if (io_.stopped()) {
             io_.restart();
+            if (boost::asio::has_service<io_shards>(io_)) {
+                boost::asio::use_service<io_shards>(io_).restart();
+            }
         } else if (stop_thread_.joinable()) {
             VSOMEIP_ERROR << "Trying to start an already started application.";
             return;
@@ -419,11 +471,25 @@ void application_impl::start() {
         }
         stop_thread_ = std::thread(&application_impl::shutdown, shared_from_this());
 
+        if (low_latency_io_) {
+            std::stringstream s;
+            s << std::hex << std::setfill('0') << std::setw(4) << client_ << "_ll";
+            low_latency_io_->start(s.str());
+        }
+
         if (routing_)
             routing_->start();
 
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+        if (metrics_exporter_) {
+            metrics_exporter_->start();
+        }
+#endif
+
         for (size_t i = 0; i < io_thread_count - 1; i++) {
-            auto its_thread = std::make_shared<std::thread>([this, i, io_thread_nice_level, event_loop_periodicity] {
+            // With io sharding, each io thread runs its own io_context
+            boost::asio::io_context& its_io = io_shards::select(io_, i + 1);
+            auto its_thread = std::make_shared<std::thread>([this, i, io_thread_nice_level, event_loop_periodicity, &its_io] {
                 VSOMEIP_INFO << "io thread id from application: " << std::hex << std::setfill('0') << std::setw(4) << client_ << " ("
                              << name_ << ") is: " << std::hex << std::this_thread::get_id()
 #if defined(__linux__) || defined(ANDROID)
@@ -441,9 +507,9 @@ void application_impl::start() {
                 while (true) {
                     try {
                         if (event_loop_periodicity) {
-                            io_.run_for(std::chrono::seconds(event_loop_periodicity));
+                            its_io.run_for(std::chrono::seconds(event_loop_periodicity));
                         } else {
-                            io_.run();
+                            its_io.run();
                         }
                         if (stopped_) {
                             break;
@@ -838,7 +904,10 @@ void application_impl::send(std::shared_ptr<message> _message) {
             _message->set_session(get_session(true));
         }
         // Always increment the session-id
-        (void)routing_->send(client_, _message, false);
+        if (routing_->send(client_, _message, false) && service_metrics_) {
+            service_metrics_->record_sent(_message->get_service(), _message->get_instance(),
+                                          VSOMEIP_SOMEIP_HEADER_SIZE + _message->get_length());
+        }
     }
 }
 
@@ -851,6 +920,59 @@ void application_impl::notify(service_t _service, instance_t _instance, event_t
     }
 }
 
+std::vector<bool> application_impl::notify_batch(const std::vector<notification_t>& _notifications, bool _force) const {
+
+    if (routing_) {
+        const auto its_runtime{runtime::get()};
+        std::vector<notification_t> its_notifications;
+        its_notifications.reserve(_notifications.size());
+        for (const auto& n : _notifications) {
+            its_notifications.push_back(
+                    {n.service_, n.instance_, n.event_, its_runtime->create_payload(n.payload_->get_data(), n.payload_->get_length())});
+        }
+        return routing_->notify_batch(its_notifications, _force);
+    }
+    return std::vector<bool>(_notifications.size(), false);
+}
+
+std::vector<latency_histogram_t> application_impl::get_latency_histograms() const {
+    if (latency_statistics_) {
+        return latency_statistics_->get();
+    }
+    return std::vector<latency_histogram_t>();
+}
+
+metrics_t application_impl::get_metrics() const {
+    metrics_t its_metrics {};
+    if (routing_) {
+        routing_->get_metrics(its_metrics);
+    }
+    if (service_metrics_) {
+        its_metrics.services_ = service_metrics_->get();
+    }
+    its_metrics.dispatched_ = dispatch_counters_.get(DC_DISPATCHED);
+    its_metrics.dispatched_messages_ = dispatch_counters_.get(DC_DISPATCHED_MESSAGES);
+    its_metrics.dispatch_wait_sum_ = std::chrono::nanoseconds(dispatch_counters_.get(DC_WAIT_SUM));
+    its_metrics.dispatch_wait_max_ = std::chrono::nanoseconds(dispatch_counters_.get_max(DC_WAIT_MAX));
+    {
+        std::scoped_lock its_lock{handlers_mutex_};
+        its_metrics.dispatch_queue_size_ = handlers_.size();
+    }
+    return its_metrics;
+}
+
+std::vector<handler_profile_t> application_impl::get_handler_profiles() const {
+    if (handler_statistics_) {
+        return handler_statistics_->get();
+    }
+    return std::vector<handler_profile_t>();
+}
+
+std::vector<dispatch_queue_sample_t> application_impl::get_dispatch_queue_history() const {
+    std::scoped_lock its_lock{handlers_mutex_};
+    return dispatch_queue_history_.get();
+}
+
 void application_impl::notify_one(service_t _service, instance_t _instance, event_t _event, std::shared_ptr<payload> _payload,
                                   client_t _client, bool _force) const {
     if (routing_) {
@@ -1270,7 +1392,7 @@ void application_impl::deliver_subscription_state(service_t _service, instance_t
         }
     }
     {
-        std::unique_lock<std::mutex> handlers_lock(handlers_mutex_);
+        named_mutex::unique_lock handlers_lock(handlers_mutex_);
         for (auto& handler : handlers) {
             auto its_sync_handler = std::make_shared<sync_handler>([handler, _service, _instance, _eventgroup, _event, _error]() {
                 handler(_service, _instance, _eventgroup, _event, _error);
@@ -1481,6 +1603,14 @@ boost::asio::io_context& application_impl::get_io() {
     return io_;
 }
 
+latency_statistics* application_impl::get_latency_statistics() const {
+    return latency_statistics_.get();
+}
+
+handler_statistics* application_impl::get_handler_statistics() const {
+    return handler_statistics_.get();
+}
+
 void application_impl::on_state(state_type_e _state) {
 
     bool has_state_handler(false);
@@ -1688,19 +1818,57 @@ void application_impl::on_message(std::shared_ptr<message>&& _message) {
 
     if (_message->get_message_type() == message_type_e::MT_NOTIFICATION) {
         if (!check_for_active_subscription(its_service, its_instance, static_cast<event_t>(its_method))) {
-            VSOMEIP_INFO << "application_impl::on_message [" << std::hex << std::setfill('0') << std::setw(4) << its_service << "."
-                         << std::setw(4) << its_instance << "." << std::setw(4) << its_method << "]"
-                         << ": blocked as the subscription is already inactive.";
+            VSOMEIP_INFO_F("application_impl::on_message [{:04x}.{:04x}.{:04x}]: blocked as the subscription is already inactive.",
+                           its_service, its_instance, its_method);
             return;
         }
     }
 
+    if (service_metrics_) {
+        service_metrics_->record_received(its_service, its_instance, VSOMEIP_SOMEIP_HEADER_SIZE + _message->get_length());
+    }
+
+    if (low_latency_io_ && low_latency_io_->is_low_latency(its_service, its_instance)) {
+        // Low latency services bypass the dispatcher queue
+        std::deque<message_handler_t> its_handlers;
+        {
+            std::scoped_lock its_lock{members_mutex_};
+            its_handlers = find_handlers(its_service, its_instance, its_method);
+        }
+        for (const auto& handler : its_handlers) {
+            const auto its_start = std::chrono::steady_clock::now();
+            try {
+                handler(_message);
+            } catch (const std::exception& e) {
+                VSOMEIP_ERROR << "application_impl::on_message caught exception: " << e.what();
+            }
+            const auto its_duration = std::chrono::steady_clock::now() - its_start;
+            if (its_duration > std::chrono::milliseconds(max_dispatch_time_)) {
+                VSOMEIP_WARNING << "application_impl::on_message [" << std::hex << std::setfill('0') << std::setw(4) << its_service << "."
+                                << std::setw(4) << its_instance << "." << std::setw(4) << its_method << "]"
+                                << ": low latency handler blocked the "
+                                << (low_latency_io_->is_polling() ? "polling" : "receiving") << " thread for "
+                                << std::dec << std::chrono::duration_cast<std::chrono::milliseconds>(its_duration).count() << "ms";
+            }
+        }
+        return;
+    }
+
     {
         std::scoped_lock its_lock{members_mutex_};
 
         const auto its_handlers = find_handlers(its_service, its_instance, its_method);
 
         if (its_handlers.size()) {
+            const auto its_queued = std::chrono::steady_clock::now();
+            if (latency_statistics_) {
+                const auto its_routing_time = receive_timestamp::get_routing_time();
+                if (its_routing_time != receive_timestamp::routing_time_t()) {
+                    latency_statistics_->record(its_service, its_instance, its_method, latency_stage_e::LS_ROUTING_TO_QUEUE,
+                                                its_queued - its_routing_time);
+                }
+            }
+
             std::scoped_lock its_lock_inner{handlers_mutex_};
             for (const auto& handler : its_handlers) {
                 auto its_sync_handler = std::make_shared<sync_handler>([handler, _message]() { handler(_message); });
@@ -1709,8 +1877,12 @@ void application_impl::on_message(std::shared_ptr<message>&& _message) {
                 its_sync_handler->instance_id_ = _message->get_instance();
                 its_sync_handler->method_id_ = _message->get_method();
                 its_sync_handler->session_id_ = _message->get_session();
+                its_sync_handler->queued_ = its_queued;
                 handlers_.push_back(its_sync_handler);
             }
+            if (handler_statistics_) {
+                dispatch_queue_history_.record(handlers_.size(), its_queued);
+            }
             dispatcher_condition_.notify_one();
         }
     }
@@ -1737,7 +1909,7 @@ void application_impl::main_dispatch() {
                  << " TID: " << std::dec << static_cast<int>(syscall(SYS_gettid))
 #endif
             ;
-    std::unique_lock<std::mutex> its_lock(handlers_mutex_);
+    named_mutex::unique_lock its_lock(handlers_mutex_);
     while (is_dispatching_) {
         if (handlers_.empty() || !is_active_dispatcher(its_id)) {
             // Cancel other waiting dispatcher
@@ -1787,7 +1959,7 @@ void application_impl::dispatch() {
                  << " TID: " << std::dec << static_cast<int>(syscall(SYS_gettid))
 #endif
             ;
-    std::unique_lock<std::mutex> its_lock(handlers_mutex_);
+    named_mutex::unique_lock its_lock(handlers_mutex_);
     while (is_active_dispatcher(its_id)) {
         if (is_dispatching_ && handlers_.empty()) {
             dispatcher_condition_.wait(its_lock, [this] { return !is_dispatching_ || !handlers_.empty() || elapse_unactive_dispatchers_; });
@@ -1825,6 +1997,10 @@ void application_impl::dispatch() {
 }
 
 std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handler() {
+    if (handler_statistics_ && !handlers_.empty()) {
+        dispatch_queue_history_.record(handlers_.size(), std::chrono::steady_clock::now());
+    }
+
     std::shared_ptr<sync_handler> its_next_handler;
     while (!handlers_.empty() && !its_next_handler) {
         its_next_handler = handlers_.front();
@@ -1950,12 +2126,36 @@ void application_impl::invoke_handler(std::shared_ptr<sync_handler>& _handler) {
     }
 
     if (is_dispatching_) {
+        dispatch_counters_.add(DC_DISPATCHED);
+        if (_handler->queued_ != std::chrono::steady_clock::time_point()) {
+            const auto its_wait = std::chrono::steady_clock::now() - _handler->queued_;
+            const auto its_wait_ns = static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(its_wait).count(), 0));
+            dispatch_counters_.add(DC_DISPATCHED_MESSAGES);
+            dispatch_counters_.add(DC_WAIT_SUM, its_wait_ns);
+            dispatch_counters_.set_max(DC_WAIT_MAX, its_wait_ns);
+            if (latency_statistics_) {
+                latency_statistics_->record(_handler->service_id_, _handler->instance_id_, _handler->method_id_,
+                                            latency_stage_e::LS_QUEUE_TO_HANDLER, its_wait);
+            }
+        }
+        std::chrono::steady_clock::time_point its_start;
+        std::chrono::nanoseconds its_cpu_start(0);
+        if (handler_statistics_) {
+            its_start = std::chrono::steady_clock::now();
+            its_cpu_start = handler_statistics::get_thread_cpu_time();
+        }
         try {
             _handler->handler_();
         } catch (const std::exception& e) {
             VSOMEIP_ERROR << "application_impl::invoke_handler caught exception: " << e.what();
             print_blocking_call(its_sync_handler);
         }
+        if (handler_statistics_) {
+            handler_statistics_->record(get_handler_kind(_handler->handler_type_), _handler->service_id_, _handler->method_id_,
+                                        handler_statistics::get_thread_cpu_time() - its_cpu_start,
+                                        std::chrono::steady_clock::now() - its_start);
+        }
     }
 
     its_dispatcher_timer.cancel();
@@ -2108,6 +2308,12 @@ void application_impl::shutdown() {
                       << " catched exception: " << e.what();
     }
 
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+    if (metrics_exporter_) {
+        metrics_exporter_->stop();
+    }
+#endif
+
     try {
         if (routing_)
             routing_->stop();
@@ -2146,6 +2352,12 @@ void application_impl::shutdown() {
     try {
         work_.reset();
         io_.stop();
+        if (boost::asio::has_service<io_shards>(io_)) {
+            boost::asio::use_service<io_shards>(io_).stop();
+        }
+        if (low_latency_io_) {
+            low_latency_io_->stop();
+        }
     } catch (const std::exception& e) {
         VSOMEIP_ERROR << "application_impl::" << __func__ << ": stopping io, "
                       << " catched exception: " << e.what();
@@ -2415,6 +2627,26 @@ void application_impl::print_blocking_call(const std::shared_ptr<sync_handler>&
     }
 }
 
+handler_kind_e application_impl::get_handler_kind(handler_type_e _type) {
+    switch (_type) {
+    case handler_type_e::MESSAGE:
+        return handler_kind_e::HK_MESSAGE;
+    case handler_type_e::AVAILABILITY:
+        return handler_kind_e::HK_AVAILABILITY;
+    case handler_type_e::STATE:
+        return handler_kind_e::HK_STATE;
+    case handler_type_e::SUBSCRIPTION:
+        return handler_kind_e::HK_SUBSCRIPTION;
+    case handler_type_e::OFFERED_SERVICES_INFO:
+        return handler_kind_e::HK_OFFERED_SERVICES_INFO;
+    case handler_type_e::WATCHDOG:
+        return handler_kind_e::HK_WATCHDOG;
+    case handler_type_e::UNKNOWN:
+        break;
+    }
+    return handler_kind_e::HK_OTHER;
+}
+
 void application_impl::get_offered_services_async(offer_type_e _offer_type, const offered_services_handler_t& _handler) {
     {
         std::scoped_lock its_lock{offered_services_handler_mutex_};
@@ -53,6 +53,8 @@ public:
 
     // extension
     void load(const configuration_element& _element, const bool _lazy_load = false);
+    // Converts a single entry of the "policies" array
+    std::shared_ptr<policy> convert_policy(const boost::property_tree::ptree& _tree);
 
     void update_security_policy(uid_t _uid, uid_t _gid, const std::shared_ptr<policy>& _policy);
     bool remove_security_policy(uid_t _uid, uid_t _gid);
@@ -76,7 +78,7 @@ private:
     // Configuration
     bool exist_in_any_client_policies_unlocked(std::shared_ptr<policy>& _policy);
     void load_policies(const configuration_element& _element);
-    void load_policy(const boost::property_tree::ptree& _tree);
+    void add_policy(std::shared_ptr<policy> _policy);
     void load_policy_body(std::shared_ptr<policy>& _policy, const boost::property_tree::ptree::const_iterator& _tree);
     void load_credential(const boost::property_tree::ptree& _tree, boost::icl::interval_map<uid_t, boost::icl::interval_set<gid_t>>& _ids);
     bool load_routing_credentials(const configuration_element& _element);
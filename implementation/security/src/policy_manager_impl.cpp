@@ -607,14 +607,18 @@ void policy_manager_impl::load_policies(const configuration_element& _element) {
                 }
             } else if (its_security->first == "policies") {
                 for (auto its_policy = its_security->second.begin(); its_policy != its_security->second.end(); ++its_policy) {
-                    load_policy(its_policy->second);
+                    add_policy(convert_policy(its_policy->second));
+                }
+                // Converted while reading the configuration file
+                for (const auto& its_policy : _element.policies_) {
+                    add_policy(its_policy);
                 }
             }
         }
     } catch (...) { }
 }
 
-void policy_manager_impl::load_policy(const boost::property_tree::ptree& _tree) {
+std::shared_ptr<policy> policy_manager_impl::convert_policy(const boost::property_tree::ptree& _tree) {
 
     std::shared_ptr<policy> policy(std::make_shared<policy>());
     bool allow_deny_set(false);
@@ -701,9 +705,13 @@ void policy_manager_impl::load_policy(const boost::property_tree::ptree& _tree)
             load_policy_body(policy, i);
         }
     }
+    return policy;
+}
+
+void policy_manager_impl::add_policy(std::shared_ptr<policy> _policy) {
     boost::unique_lock<boost::shared_mutex> its_lock(any_client_policies_mutex_);
-    if (!exist_in_any_client_policies_unlocked(policy))
-        any_client_policies_.push_back(policy);
+    if (!exist_in_any_client_policies_unlocked(_policy))
+        any_client_policies_.push_back(_policy);
 }
 
 void policy_manager_impl::load_policy_body(std::shared_ptr<policy>& _policy, const boost::property_tree::ptree::const_iterator& _tree) {
@@ -63,6 +63,9 @@ public:
     virtual void register_sd_acceptance_handler(const sd_acceptance_handler_t& _handler) = 0;
     virtual void register_reboot_notification_handler(const reboot_notification_handler_t& _handler) = 0;
     virtual std::recursive_mutex& get_subscribed_mutex() = 0;
+
+    // Number of SD messages sent and received since the start
+    virtual void get_metrics(std::uint64_t& _sent, std::uint64_t& _received) const = 0;
 };
 
 } // namespace sd
@@ -20,6 +20,7 @@
 #include "../../endpoints/include/endpoint_definition.hpp"
 #include "../../routing/include/types.hpp"
 #include "../../routing/include/remote_subscription.hpp"
+#include "../../utility/include/timing_wheel.hpp"
 
 #include "service_discovery.hpp"
 #include "ip_option_impl.hpp"
@@ -59,6 +60,7 @@ public:
 
     boost::asio::io_context& get_io();
     std::recursive_mutex& get_subscribed_mutex();
+    void get_metrics(std::uint64_t& _sent, std::uint64_t& _received) const;
 
     void init();
     void start();
@@ -196,13 +198,11 @@ private:
     void stop_find_debounce_timer();
     void on_find_debounce_timer_expired(const boost::system::error_code& _error);
 
-    void on_repetition_phase_timer_expired(const boost::system::error_code& _error,
-                                           const std::shared_ptr<boost::asio::steady_timer>& _timer, std::uint8_t _repetition,
-                                           std::uint32_t _last_delay);
-    void on_find_repetition_phase_timer_expired(const boost::system::error_code& _error,
-                                                const std::shared_ptr<boost::asio::steady_timer>& _timer, std::uint8_t _repetition,
-                                                std::uint32_t _last_delay);
-    void move_offers_into_main_phase(const std::shared_ptr<boost::asio::steady_timer>& _timer);
+    void on_repetition_phase_timer_expired(const boost::system::error_code& _error, const std::shared_ptr<wheel_timer>& _timer,
+                                           std::uint8_t _repetition, std::uint32_t _last_delay);
+    void on_find_repetition_phase_timer_expired(const boost::system::error_code& _error, const std::shared_ptr<wheel_timer>& _timer,
+                                                std::uint8_t _repetition, std::uint32_t _last_delay);
+    void move_offers_into_main_phase(const std::shared_ptr<wheel_timer>& _timer);
 
     bool send_stop_offer(const std::shared_ptr<serviceinfo>& _info);
 
@@ -344,11 +344,11 @@ private:
 
     // this map contains the offers and their timers currently in repetition phase
     std::mutex repetition_phase_timers_mutex_;
-    std::map<std::shared_ptr<boost::asio::steady_timer>, services_t> repetition_phase_timers_;
+    std::map<std::shared_ptr<wheel_timer>, services_t> repetition_phase_timers_;
 
     // this map contains the finds and their timers currently in repetition phase
     std::mutex find_repetition_phase_timers_mutex_;
-    std::map<std::shared_ptr<boost::asio::steady_timer>, requests_t> find_repetition_phase_timers_;
+    std::map<std::shared_ptr<wheel_timer>, requests_t> find_repetition_phase_timers_;
 
     std::mutex main_phase_timer_mutex_;
     boost::asio::steady_timer main_phase_timer_;
@@ -402,6 +402,10 @@ private:
 
     std::mutex offer_mutex_;
     std::mutex check_ttl_mutex_;
+
+    // Only updated by the SD, so plain counters suffice
+    std::atomic<std::uint64_t> messages_sent_ {0};
+    std::atomic<std::uint64_t> messages_received_ {0};
 };
 
 } // namespace sd
@@ -220,6 +220,11 @@ std::recursive_mutex& service_discovery_impl::get_subscribed_mutex() {
     return subscribed_mutex_;
 }
 
+void service_discovery_impl::get_metrics(std::uint64_t& _sent, std::uint64_t& _received) const {
+    _sent = messages_sent_.load(std::memory_order_relaxed);
+    _received = messages_received_.load(std::memory_order_relaxed);
+}
+
 void service_discovery_impl::subscribe(service_t _service, instance_t _instance, eventgroup_t _eventgroup, major_version_t _major,
                                        ttl_t _ttl, client_t _client, const std::shared_ptr<eventgroupinfo>& _info) {
 
@@ -987,6 +992,8 @@ void service_discovery_impl::on_message(const byte_t* _data, length_t _length, c
     msg << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(_data[i]) << " ";
     VSOMEIP_INFO << msg.str();
 #endif
+    messages_received_.fetch_add(1, std::memory_order_relaxed);
+
     std::lock_guard<std::mutex> its_lock(check_ttl_mutex_);
     std::lock_guard<std::mutex> its_session_lock(sessions_received_mutex_);
     std::lock_guard<std::recursive_mutex> its_subscribed_lock(subscribed_mutex_);
@@ -2254,6 +2261,7 @@ bool service_discovery_impl::send(const std::vector<std::shared_ptr<message_impl
             m->set_reboot_flag(its_session.second);
             if (host_->send(VSOMEIP_SD_CLIENT, m, true)) {
                 increment_session(unicast_);
+                messages_sent_.fetch_add(1, std::memory_order_relaxed);
             }
         } else {
             its_result = false;
@@ -2277,6 +2285,7 @@ bool service_discovery_impl::serialize_and_send(const std::vector<std::shared_pt
                     if (host_->send_via_sd(endpoint_definition::get(_address, port_, reliable_, m->get_service(), m->get_instance()),
                                            serializer_->get_data(), serializer_->get_size(), port_)) {
                         increment_session(_address);
+                        messages_sent_.fetch_add(1, std::memory_order_relaxed);
                     }
                 } else {
                     VSOMEIP_ERROR << "service_discovery_impl::" << __func__ << ": Serialization failed!";
@@ -2491,7 +2500,7 @@ void service_discovery_impl::on_find_debounce_timer_expired(const boost::system:
     std::chrono::milliseconds its_delay(repetitions_base_delay_);
     std::uint8_t its_repetitions(1);
 
-    auto its_timer = std::make_shared<boost::asio::steady_timer>(host_->get_io());
+    auto its_timer = std::make_shared<wheel_timer>(host_->get_io());
     {
         std::lock_guard<std::mutex> its_lock(find_repetition_phase_timers_mutex_);
         find_repetition_phase_timers_[its_timer] = repetition_phase_finds;
@@ -2583,7 +2592,7 @@ void service_discovery_impl::on_offer_debounce_timer_expired(const boost::system
         its_repetitions = 0;
     }
 
-    auto its_timer = std::make_shared<boost::asio::steady_timer>(host_->get_io());
+    auto its_timer = std::make_shared<wheel_timer>(host_->get_io());
 
     {
         std::lock_guard<std::mutex> its_lock(repetition_phase_timers_mutex_);
@@ -2597,8 +2606,8 @@ void service_discovery_impl::on_offer_debounce_timer_expired(const boost::system
 }
 
 void service_discovery_impl::on_repetition_phase_timer_expired(const boost::system::error_code& _error,
-                                                               const std::shared_ptr<boost::asio::steady_timer>& _timer,
-                                                               std::uint8_t _repetition, std::uint32_t _last_delay) {
+                                                               const std::shared_ptr<wheel_timer>& _timer, std::uint8_t _repetition,
+                                                               std::uint32_t _last_delay) {
     if (_error) {
         return;
     }
@@ -2653,8 +2662,8 @@ void service_discovery_impl::on_repetition_phase_timer_expired(const boost::syst
 }
 
 void service_discovery_impl::on_find_repetition_phase_timer_expired(const boost::system::error_code& _error,
-                                                                    const std::shared_ptr<boost::asio::steady_timer>& _timer,
-                                                                    std::uint8_t _repetition, std::uint32_t _last_delay) {
+                                                                    const std::shared_ptr<wheel_timer>& _timer, std::uint8_t _repetition,
+                                                                    std::uint32_t _last_delay) {
     if (_error) {
         return;
     }
@@ -2684,7 +2693,7 @@ void service_discovery_impl::on_find_repetition_phase_timer_expired(const boost:
     }
 }
 
-void service_discovery_impl::move_offers_into_main_phase(const std::shared_ptr<boost::asio::steady_timer>& _timer) {
+void service_discovery_impl::move_offers_into_main_phase(const std::shared_ptr<wheel_timer>& _timer) {
     // HINT: make sure to lock the repetition_phase_timers_mutex_ before calling
     // this function set flag on all serviceinfos bound to this timer that they
     // will be included in the cyclic offers from now on
@@ -3379,7 +3388,7 @@ reliability_type_e service_discovery_impl::get_eventgroup_reliability(service_t
 
 void service_discovery_impl::deserialize_data(const byte_t* _data, const length_t& _size, std::shared_ptr<message_impl>& _message) {
     std::lock_guard its_lock(deserialize_mutex_);
-    deserializer_->set_data(_data, _size);
+    deserializer_->set_view(_data, _size);
     _message = std::shared_ptr<message_impl>(deserializer_->deserialize_sd_message());
     deserializer_->reset();
 }
@@ -11,19 +11,35 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "enumeration_types.hpp"
+#include <vsomeip/export.hpp>
 #include <vsomeip/trace.hpp>
 
 namespace vsomeip_v3 {
 namespace trace {
 
-typedef std::function<bool(service_t, instance_t, method_t)> filter_func_t;
+// Filter of a channel: matches any of "matches_" (with wildcards) or, for
+// range filters, all messages between "matches_[0]" and "matches_[1]"
+struct filter_rule {
+    VSOMEIP_EXPORT bool matches(service_t _service, instance_t _instance, method_t _method) const;
+
+    std::vector<match_t> matches_;
+    bool is_range_;
+    filter_type_e type_;
+};
+
+// Filters of a channel ordered by their id
+typedef std::map<filter_id_t, filter_rule> filter_rules_t;
 
 class channel_impl : public channel {
 public:
     channel_impl(const std::string& _id, const std::string& _name);
 
+    // Called after a filter was added or removed
+    void set_change_handler(const std::function<void()>& _handler);
+
     std::string get_id() const;
     std::string get_name() const;
 
@@ -43,17 +59,22 @@ public:
 
     std::pair<bool, bool> matches(service_t _service, instance_t _instance, method_t _method);
 
+    filter_rules_t get_filters() const;
+
+    // Whether a message is forwarded and whether it is forwarded with its payload
+    VSOMEIP_EXPORT static std::pair<bool, bool> matches(const filter_rules_t& _filters, service_t _service, instance_t _instance, method_t _method);
+
 private:
-    filter_id_t add_filter_intern(const filter_func_t& _func, filter_type_e _type);
+    filter_id_t add_filter_intern(filter_rule&& _rule);
 
     std::string id_;
     std::string name_;
 
     std::atomic<filter_id_t> current_filter_id_;
 
-    std::map<filter_id_t, std::pair<filter_func_t, bool>> positive_;
-    std::map<filter_id_t, filter_func_t> negative_;
-    std::mutex mutex_; // protects positive_ & negative_
+    filter_rules_t filters_;
+    std::function<void()> change_handler_;
+    mutable std::mutex mutex_; // protects filters_ & change_handler_
 };
 
 } // namespace trace
@@ -23,8 +23,11 @@
 #include <vsomeip/trace.hpp>
 
 #include "enumeration_types.hpp"
+#include "filter_table.hpp"
 #include "header.hpp"
+#include "pcapng_writer.hpp"
 #include "../../endpoints/include/buffer.hpp"
+#include "../../utility/include/snapshot.hpp"
 
 namespace vsomeip_v3 {
 
@@ -69,8 +72,31 @@ private:
 
     std::shared_ptr<channel_impl> get_channel_impl(const std::string& _id) const;
 
+    // Compiles the filters of all channels and publishes them for trace()
+    void update_dispatch();
+
     std::mutex configure_mutex_;
 
+    struct dispatch_t {
+        filter_table filters_;
+#ifdef USE_DLT
+#ifndef ANDROID
+        // DLT context of each channel of "filters_"
+        std::vector<std::shared_ptr<DltContext>> contexts_;
+#endif
+#endif
+#ifdef VSOMEIP_ENABLE_PCAP_TRACING
+        std::shared_ptr<pcapng_writer> pcap_;
+#endif
+    };
+    snapshot<dispatch_t> dispatch_;
+    std::mutex dispatch_mutex_; // serializes update_dispatch
+
+#ifdef VSOMEIP_ENABLE_PCAP_TRACING
+    std::shared_ptr<pcapng_writer> pcap_;
+    std::mutex pcap_mutex_;
+#endif
+
 #ifdef USE_DLT
 #ifndef ANDROID
     std::map<std::string, std::shared_ptr<DltContext>> contexts_;
@@ -0,0 +1,98 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_TRACE_FILTER_TABLE_HPP_
+#define VSOMEIP_V3_TRACE_FILTER_TABLE_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "channel_impl.hpp"
+
+namespace vsomeip_v3 {
+namespace trace {
+
+// The filters of all channels, compiled into a table that answers which
+// channels forward a message with a constant number of lookups.
+//
+// Every filter compares the service, instance and method with single values
+// or ranges. The boundaries of these values split each of the three value
+// ranges into classes whose members are treated alike by all filters. A
+// 64k entry array per dimension maps a value to its class (it is omitted if
+// no filter refers to the dimension) and the decisions of all channels are
+// precomputed for each combination of classes.
+//
+// With more than 64 channels or too many combinations, the filters are
+// evaluated for each message instead.
+class filter_table {
+public:
+    // Bit n refers to the n-th channel passed to the constructor
+    struct decision_t {
+        std::uint64_t forward_;
+        // Subset of "forward_" that is forwarded without payload
+        std::uint64_t header_only_;
+    };
+
+    static constexpr std::size_t max_channels = 64;
+    static constexpr std::size_t max_combinations = 1 << 16;
+
+    filter_table() = default;
+    VSOMEIP_EXPORT explicit filter_table(std::vector<filter_rules_t>&& _channels);
+
+    // Calls "_handler(channel index, is header only)" for each channel that forwards the message
+    template<typename Handler_>
+    void for_each_match(service_t _service, instance_t _instance, method_t _method, Handler_&& _handler) const {
+        if (is_compiled_) {
+            const auto& its_decision = decisions_[get_index(_service, _instance, _method)];
+            auto its_channels = its_decision.forward_;
+            for (std::size_t c = 0; its_channels != 0; ++c, its_channels >>= 1) {
+                if (its_channels & 1) {
+                    _handler(c, (its_decision.header_only_ & (std::uint64_t(1) << c)) != 0);
+                }
+            }
+        } else {
+            for (std::size_t c = 0; c < channels_.size(); ++c) {
+                const auto its_match = channel_impl::matches(channels_[c], _service, _instance, _method);
+                if (its_match.first) {
+                    _handler(c, !its_match.second);
+                }
+            }
+        }
+    }
+
+    bool is_compiled() const { return is_compiled_; }
+
+private:
+    struct dimension_t {
+        // Lowest value of each class, the first class starts at 0
+        std::vector<std::uint16_t> boundaries_;
+        // Class of each value, empty if there is only one class
+        std::vector<std::uint16_t> classes_;
+
+        void build();
+        std::size_t get_class(std::uint16_t _value) const { return classes_.empty() ? 0 : classes_[_value]; }
+    };
+
+    std::size_t get_index(service_t _service, instance_t _instance, method_t _method) const {
+        return (services_.get_class(_service) * instances_.boundaries_.size() + instances_.get_class(_instance)) * methods_.boundaries_.size()
+                + methods_.get_class(_method);
+    }
+
+    decision_t evaluate(service_t _service, instance_t _instance, method_t _method) const;
+
+    std::vector<filter_rules_t> channels_;
+
+    bool is_compiled_{false};
+    dimension_t services_, instances_, methods_;
+    std::vector<decision_t> decisions_;
+};
+
+} // namespace trace
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_TRACE_FILTER_TABLE_HPP_
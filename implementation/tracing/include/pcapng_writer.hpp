@@ -0,0 +1,117 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_TRACE_PCAPNG_WRITER_HPP_
+#define VSOMEIP_V3_TRACE_PCAPNG_WRITER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "header.hpp"
+
+namespace vsomeip_v3 {
+namespace trace {
+
+// Writes traced messages to a pcapng file from a background thread.
+//
+// Each message becomes an IPv4 frame built from its trace header: UDP and
+// TCP messages are carried by a UDP datagram or a TCP segment from/to the
+// remote endpoint, local messages are wrapped into the vsomeip SEND command
+// they are exchanged with and carried by a TCP segment on 127.0.0.1, so
+// that the dissector in "tools/wireshark_plugin" decodes them. Instance,
+// protocol and direction are added as a packet comment.
+//
+// The callers append their messages to a buffer that the writer thread
+// swaps with its own, so at most two buffers of half the memory budget
+// each exist. Messages that do not fit are dropped and counted.
+//
+// If a maximum size is set, the file is rotated to "<path>.1" ...
+// "<path>.<max_files>" before a packet would exceed it.
+class pcapng_writer {
+public:
+    VSOMEIP_EXPORT pcapng_writer(const std::string& _path, std::uint64_t _max_size, std::uint32_t _max_files,
+                                 std::size_t _buffer_size);
+    // Writes all pending messages before returning
+    VSOMEIP_EXPORT ~pcapng_writer();
+
+    pcapng_writer(const pcapng_writer&) = delete;
+    pcapng_writer& operator=(const pcapng_writer&) = delete;
+
+    // "_header" is a trace header, "_data" a SOME/IP message. Returns false
+    // if the message was dropped.
+    VSOMEIP_EXPORT bool write(const byte_t* _header, uint16_t _header_size, const byte_t* _data, uint32_t _data_size,
+                              bool _is_header_only);
+
+    // Waits until the messages that were written before are in the file
+    VSOMEIP_EXPORT void flush();
+
+    VSOMEIP_EXPORT std::uint64_t get_dropped() const;
+
+private:
+    // Stored in front of each message in "pending_"
+    struct entry_t {
+        std::int64_t timestamp_; // nanoseconds since the epoch
+        std::uint32_t captured_size_;
+        std::uint32_t size_;
+        byte_t header_[VSOMEIP_TRACE_HEADER_SIZE];
+    };
+
+    void run();
+    void write_entries(const std::vector<byte_t>& _entries);
+    void write_packet(const entry_t& _entry, const byte_t* _data);
+
+    void open_file();
+    void rotate_file();
+    void write_file_header();
+    // Writes a block whose body is "block_"
+    void write_block(std::uint32_t _type);
+
+    const std::string path_;
+    const std::uint64_t max_size_;
+    const std::uint32_t max_files_;
+    const std::size_t buffer_size_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_up_condition_;
+    std::condition_variable flushed_condition_;
+    std::vector<byte_t> pending_;
+    std::uint64_t pending_count_; // number of buffers handed to the writer
+    std::uint64_t written_count_; // number of buffers in the file
+    bool is_flush_requested_;
+    bool is_stopping_;
+
+    std::atomic<std::uint64_t> dropped_;
+
+    // Writer thread only
+    std::ofstream file_;
+    std::uint64_t file_size_;
+    std::uint64_t file_header_size_;
+    std::vector<byte_t> frame_;
+    std::vector<byte_t> block_;
+    std::uint16_t ip_id_;
+    // Next sequence number of each TCP flow (source address, destination
+    // address, source port, destination port)
+    std::map<std::tuple<std::uint32_t, std::uint32_t, std::uint16_t, std::uint16_t>, std::uint32_t> sequences_;
+    std::uint64_t reported_dropped_;
+
+    std::thread writer_;
+};
+
+} // namespace trace
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_TRACE_PCAPNG_WRITER_HPP_
@@ -10,8 +10,30 @@ namespace trace {
 
 const filter_id_t FILTER_ID_ERROR(0);
 
+bool filter_rule::matches(service_t _service, instance_t _instance, method_t _method) const {
+    if (is_range_) {
+        const auto& its_from = matches_[0];
+        const auto& its_to = matches_[1];
+        return (std::get<0>(its_from) <= _service && _service <= std::get<0>(its_to) && std::get<1>(its_from) <= _instance
+                && _instance <= std::get<1>(its_to) && std::get<2>(its_from) <= _method && _method <= std::get<2>(its_to));
+    }
+
+    for (const auto& m : matches_) {
+        if ((std::get<0>(m) == _service || std::get<0>(m) == ANY_SERVICE) && (std::get<1>(m) == _instance || std::get<1>(m) == ANY_INSTANCE)
+            && (std::get<2>(m) == _method || std::get<2>(m) == ANY_METHOD)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 channel_impl::channel_impl(const std::string& _id, const std::string& _name) : id_(_id), name_(_name), current_filter_id_(1) { }
 
+void channel_impl::set_change_handler(const std::function<void()>& _handler) {
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    change_handler_ = _handler;
+}
+
 std::string channel_impl::get_id() const {
     return id_;
 }
@@ -27,48 +49,7 @@ filter_id_t channel_impl::add_filter(const match_t& _match, bool _is_positive) {
 }
 
 filter_id_t channel_impl::add_filter(const match_t& _match, filter_type_e _type) {
-
-    // Create a filter function
-    std::function<bool(service_t, instance_t, method_t)> its_filter_func;
-    if (std::get<0>(_match) != ANY_SERVICE) {
-        if (std::get<1>(_match) != ANY_INSTANCE) {
-            if (std::get<2>(_match) != ANY_METHOD) {
-                its_filter_func = [_match](service_t _s, instance_t _i, method_t _m) {
-                    return (std::get<0>(_match) == _s && std::get<1>(_match) == _i && std::get<2>(_match) == _m);
-                };
-            } else {
-                its_filter_func = [_match](service_t _s, instance_t _i, method_t) {
-                    return (std::get<0>(_match) == _s && std::get<1>(_match) == _i);
-                };
-            }
-        } else {
-            if (std::get<2>(_match) != ANY_METHOD) {
-                its_filter_func = [_match](service_t _s, instance_t, method_t _m) {
-                    return (std::get<0>(_match) == _s && std::get<1>(_match) == _m);
-                };
-            } else {
-                its_filter_func = [_match](service_t _s, instance_t, method_t) { return (std::get<0>(_match) == _s); };
-            }
-        }
-    } else {
-        if (std::get<1>(_match) != ANY_INSTANCE) {
-            if (std::get<2>(_match) != ANY_METHOD) {
-                its_filter_func = [_match](service_t, instance_t _i, method_t _m) {
-                    return (std::get<1>(_match) == _i && std::get<2>(_match) == _m);
-                };
-            } else {
-                its_filter_func = [_match](service_t, instance_t _i, method_t) { return (std::get<1>(_match) == _i); };
-            }
-        } else {
-            if (std::get<2>(_match) != ANY_METHOD) {
-                its_filter_func = [_match](service_t, instance_t, method_t _m) { return (std::get<2>(_match) == _m); };
-            } else {
-                its_filter_func = [](service_t, instance_t, method_t) { return true; };
-            }
-        }
-    }
-
-    return add_filter_intern(its_filter_func, _type);
+    return add_filter_intern(filter_rule{{_match}, false, _type});
 }
 
 filter_id_t channel_impl::add_filter(const std::vector<match_t>& _matches, bool _is_positive) {
@@ -78,106 +59,7 @@ filter_id_t channel_impl::add_filter(const std::vector<match_t>& _matches, bool
 }
 
 filter_id_t channel_impl::add_filter(const std::vector<match_t>& _matches, filter_type_e _type) {
-    bool has_service(false);
-    bool has_instance(false);
-    bool has_method(false);
-
-    for (auto m : _matches) {
-        if (std::get<0>(m) != ANY_SERVICE)
-            has_service = true;
-        if (std::get<1>(m) != ANY_INSTANCE)
-            has_instance = true;
-        if (std::get<2>(m) != ANY_METHOD)
-            has_method = true;
-    }
-
-    // Create a filter function
-    std::function<bool(service_t, instance_t, method_t)> its_filter_func;
-    if (has_service) {
-        if (has_instance) {
-            if (has_method) {
-                its_filter_func = [_matches](service_t _s, instance_t _i, method_t _m) {
-                    for (const auto& m : _matches) {
-                        if ((std::get<0>(m) == _s || std::get<0>(m) == ANY_SERVICE)
-                            && (std::get<1>(m) == _i || std::get<1>(m) == ANY_INSTANCE)
-                            && (std::get<2>(m) == _m || std::get<2>(m) == ANY_METHOD)) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            } else {
-                its_filter_func = [_matches](service_t _s, instance_t _i, method_t) {
-                    for (const auto& m : _matches) {
-                        if ((std::get<0>(m) == _s || std::get<0>(m) == ANY_SERVICE)
-                            && (std::get<1>(m) == _i || std::get<1>(m) == ANY_INSTANCE)) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            }
-        } else {
-            if (has_method) {
-                its_filter_func = [_matches](service_t _s, instance_t, method_t _m) {
-                    for (const auto& m : _matches) {
-                        if ((std::get<0>(m) == _s || std::get<0>(m) == ANY_SERVICE)
-                            && (std::get<2>(m) == _m || std::get<2>(m) == ANY_METHOD)) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            } else {
-                its_filter_func = [_matches](service_t _s, instance_t, method_t) {
-                    for (auto& m : _matches) {
-                        if (std::get<0>(m) == _s || std::get<0>(m) == ANY_SERVICE) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            }
-        }
-    } else {
-        if (has_instance) {
-            if (has_method) {
-                its_filter_func = [_matches](service_t, instance_t _i, method_t _m) {
-                    for (auto& m : _matches) {
-                        if ((std::get<1>(m) == _i || std::get<1>(m) == ANY_INSTANCE)
-                            && (std::get<2>(m) == _m || std::get<2>(m) == ANY_METHOD)) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            } else {
-                its_filter_func = [_matches](service_t, instance_t _i, method_t) {
-                    for (auto& m : _matches) {
-                        if (std::get<1>(m) == _i || std::get<1>(m) == ANY_INSTANCE) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            }
-        } else {
-            if (has_method) {
-                its_filter_func = [_matches](service_t, instance_t, method_t _m) {
-                    for (auto& m : _matches) {
-                        if (std::get<2>(m) == _m || std::get<2>(m) == ANY_METHOD) {
-                            return true;
-                        }
-                    }
-                    return false;
-                };
-            } else {
-                its_filter_func = [](service_t, instance_t, method_t) { return true; };
-            }
-        }
-    }
-
-    return add_filter_intern(its_filter_func, _type);
+    return add_filter_intern(filter_rule{_matches, false, _type});
 }
 
 filter_id_t channel_impl::add_filter(const match_t& _from, const match_t& _to, filter_type_e _type) {
@@ -190,12 +72,7 @@ filter_id_t channel_impl::add_filter(const match_t& _from, const match_t& _to, f
         return FILTER_ID_ERROR;
     }
 
-    std::function<bool(service_t, instance_t, method_t)> its_filter_func = [_from, _to](service_t _s, instance_t _i, method_t _m) {
-        return (std::get<0>(_from) <= _s && _s <= std::get<0>(_to) && std::get<1>(_from) <= _i && _i <= std::get<1>(_to)
-                && std::get<2>(_from) <= _m && _m <= std::get<2>(_to));
-    };
-
-    return add_filter_intern(its_filter_func, _type);
+    return add_filter_intern(filter_rule{{_from, _to}, true, _type});
 }
 
 filter_id_t channel_impl::add_filter(const match_t& _from, const match_t& _to, bool _is_positive) {
@@ -205,47 +82,66 @@ filter_id_t channel_impl::add_filter(const match_t& _from, const match_t& _to, b
 }
 
 void channel_impl::remove_filter(filter_id_t _id) {
-    std::lock_guard<std::mutex> its_lock(mutex_);
-    positive_.erase(_id);
-    negative_.erase(_id);
+    std::function<void()> its_handler;
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        if (filters_.erase(_id) == 0) {
+            return;
+        }
+        its_handler = change_handler_;
+    }
+    if (its_handler) {
+        its_handler();
+    }
 }
 
-filter_id_t channel_impl::add_filter_intern(const filter_func_t& _func, filter_type_e _type) {
+filter_id_t channel_impl::add_filter_intern(filter_rule&& _rule) {
     filter_id_t its_id = current_filter_id_.fetch_add(1);
 
-    std::lock_guard<std::mutex> its_lock(mutex_);
-    switch (_type) {
-    case filter_type_e::NEGATIVE:
-        negative_[its_id] = _func;
-        break;
-    case filter_type_e::HEADER_ONLY:
-        positive_[its_id] = std::make_pair(_func, false);
-        break;
-    default:
-        positive_[its_id] = std::make_pair(_func, true);
+    std::function<void()> its_handler;
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        filters_[its_id] = std::move(_rule);
+        its_handler = change_handler_;
+    }
+    if (its_handler) {
+        its_handler();
     }
 
     return its_id;
 }
 
+filter_rules_t channel_impl::get_filters() const {
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    return filters_;
+}
+
 std::pair<bool, bool> channel_impl::matches(service_t _service, instance_t _instance, method_t _method) {
     std::lock_guard<std::mutex> its_lock(mutex_);
+    return matches(filters_, _service, _instance, _method);
+}
+
+std::pair<bool, bool> channel_impl::matches(const filter_rules_t& _filters, service_t _service, instance_t _instance, method_t _method) {
 
     // If a negative filter matches --> drop!
-    for (auto& its_filter : negative_) {
-        if (its_filter.second(_service, _instance, _method))
+    for (const auto& its_filter : _filters) {
+        if (its_filter.second.type_ == filter_type_e::NEGATIVE && its_filter.second.matches(_service, _instance, _method))
             return std::make_pair(false, false);
     }
 
     // If a positive/header-only filter matches --> forward!
     bool has_positive(false);
-    for (auto& its_filter : positive_) {
-        if (its_filter.second.first(_service, _instance, _method))
-            return std::make_pair(true, its_filter.second.second);
+    for (const auto& its_filter : _filters) {
+        if (its_filter.second.type_ == filter_type_e::NEGATIVE)
+            continue;
+
+        const bool is_positive(its_filter.second.type_ != filter_type_e::HEADER_ONLY);
+        if (its_filter.second.matches(_service, _instance, _method))
+            return std::make_pair(true, is_positive);
 
         // If we have a positive filter that is no header-only
         // filter, set the flag
-        if (its_filter.second.second)
+        if (is_positive)
             has_positive = true;
     }
 
@@ -47,8 +47,9 @@ std::shared_ptr<connector_impl> connector_impl::get() {
 
 connector_impl::connector_impl() : is_enabled_(false), is_sd_enabled_(false) {
 
-    channels_[VSOMEIP_TC_DEFAULT_CHANNEL_ID] =
-            std::make_shared<channel_impl>(VSOMEIP_TC_DEFAULT_CHANNEL_ID, VSOMEIP_TC_DEFAULT_CHANNEL_NAME);
+    auto its_default_channel = std::make_shared<channel_impl>(VSOMEIP_TC_DEFAULT_CHANNEL_ID, VSOMEIP_TC_DEFAULT_CHANNEL_NAME);
+    its_default_channel->set_change_handler([this]() { update_dispatch(); });
+    channels_[VSOMEIP_TC_DEFAULT_CHANNEL_ID] = its_default_channel;
 #ifdef USE_DLT
 #ifndef ANDROID
     std::shared_ptr<DltContext> its_default_context = std::make_shared<DltContext>();
@@ -58,6 +59,8 @@ connector_impl::connector_impl() : is_enabled_(false), is_sd_enabled_(false) {
                                DLT_TRACE_STATUS_ON);
 #endif
 #endif
+
+    update_dispatch();
 }
 
 connector_impl::~connector_impl() {
@@ -90,6 +93,20 @@ void connector_impl::configure(const std::shared_ptr<cfg::trace>& _configuration
                 }
             }
         }
+
+        if (_configuration->pcap_.is_enabled_) {
+#ifdef VSOMEIP_ENABLE_PCAP_TRACING
+            const auto& its_pcap = _configuration->pcap_;
+            {
+                std::scoped_lock its_lock(pcap_mutex_);
+                pcap_ = std::make_shared<pcapng_writer>(its_pcap.path_, its_pcap.max_size_, its_pcap.max_files_, its_pcap.buffer_size_);
+            }
+            update_dispatch();
+            VSOMEIP_INFO << "vsomeip tracing writes the traced messages to " << its_pcap.path_;
+#else
+            VSOMEIP_WARNING << "tracing.pcap is configured, but vsomeip was built without ENABLE_PCAP_TRACING.";
+#endif
+        }
     }
 
     VSOMEIP_INFO << "vsomeip tracing " << (is_enabled_ ? "enabled." : "not enabled.") << " vsomeip service discovery tracing "
@@ -100,6 +117,9 @@ void connector_impl::reset() {
     // reset to default
     {
         std::scoped_lock its_lock_channels(channels_mutex_);
+        for (const auto& c : channels_) {
+            c.second->set_change_handler(nullptr);
+        }
         channels_.clear();
     }
 #ifdef USE_DLT
@@ -110,6 +130,14 @@ void connector_impl::reset() {
     }
 #endif
 #endif
+#ifdef VSOMEIP_ENABLE_PCAP_TRACING
+    {
+        std::scoped_lock its_lock(pcap_mutex_);
+        pcap_.reset();
+    }
+#endif
+
+    update_dispatch();
 }
 
 void connector_impl::set_enabled(const bool _enabled) {
@@ -148,6 +176,7 @@ std::shared_ptr<channel> connector_impl::add_channel(const trace_channel_t& _id,
 
         // create new channel
         its_channel = std::make_shared<channel_impl>(_id, _name);
+        its_channel->set_change_handler([this]() { update_dispatch(); });
 
         // add channel
         channels_[_id] = its_channel;
@@ -165,6 +194,8 @@ std::shared_ptr<channel> connector_impl::add_channel(const trace_channel_t& _id,
 #endif
 #endif
 
+    update_dispatch();
+
     return its_channel;
 }
 
@@ -178,7 +209,12 @@ bool connector_impl::remove_channel(const trace_channel_t& _id) {
     bool has_removed{false};
     {
         std::scoped_lock its_channels_lock(channels_mutex_);
-        has_removed = (channels_.erase(_id) == 1);
+        auto its_channel = channels_.find(_id);
+        if (its_channel != channels_.end()) {
+            its_channel->second->set_change_handler(nullptr);
+            channels_.erase(its_channel);
+            has_removed = true;
+        }
     }
 
     if (has_removed) {
@@ -194,6 +230,7 @@ bool connector_impl::remove_channel(const trace_channel_t& _id) {
         }
 #endif
 #endif
+        update_dispatch();
     }
 
     return true;
@@ -211,9 +248,47 @@ std::shared_ptr<channel_impl> connector_impl::get_channel_impl(const std::string
     return (its_channel != channels_.end() ? its_channel->second : nullptr);
 }
 
+void connector_impl::update_dispatch() {
+    std::scoped_lock its_lock(dispatch_mutex_);
+
+    std::vector<std::shared_ptr<channel_impl>> its_channels;
+    {
+        std::scoped_lock its_channels_lock(channels_mutex_);
+        for (const auto& c : channels_) {
+            its_channels.push_back(c.second);
+        }
+    }
+
+    auto its_dispatch = std::make_shared<dispatch_t>();
+    std::vector<filter_rules_t> its_filters;
+    for (const auto& c : its_channels) {
+        its_filters.push_back(c->get_filters());
+    }
+    its_dispatch->filters_ = filter_table(std::move(its_filters));
+#ifdef USE_DLT
+#ifndef ANDROID
+    {
+        std::scoped_lock its_contexts_lock(contexts_mutex_);
+        for (const auto& c : its_channels) {
+            auto its_context = contexts_.find(c->get_id());
+            its_dispatch->contexts_.push_back(its_context != contexts_.end() ? its_context->second : nullptr);
+        }
+    }
+#endif
+#endif
+#ifdef VSOMEIP_ENABLE_PCAP_TRACING
+    {
+        std::scoped_lock its_lock(pcap_mutex_);
+        its_dispatch->pcap_ = pcap_;
+    }
+#endif
+
+    dispatch_.publish(std::move(its_dispatch));
+}
+
 void connector_impl::trace(const byte_t* _header, uint16_t _header_size, const byte_t* _data, uint32_t _data_size) {
 
-#if USE_DLT
+#ifdef VSOMEIP_ENABLE_TRACING
     if (!is_enabled_)
         return;
 
@@ -233,55 +308,70 @@ void connector_impl::trace(const byte_t* _header, uint16_t _header_size, const b
     instance_t its_instance = bithelper::read_uint16_be(&_header[VSOMEIP_TC_INSTANCE_POS_MIN]);
     method_t its_method = bithelper::read_uint16_be(&_data[VSOMEIP_METHOD_POS_MIN]);
 
-// Forward to channel if the filter set of the channel allows
-#ifndef ANDROID
-    std::scoped_lock its_lock(channels_mutex_, contexts_mutex_);
-#else
-    std::scoped_lock its_lock(channels_mutex_);
+#ifdef VSOMEIP_ENABLE_PCAP_TRACING
+    // The capture contains each message once, with payload if any channel forwards it
+    bool is_captured(false);
+    bool is_header_only(true);
 #endif
-    for (auto its_channel : channels_) {
-        auto ftype = its_channel.second->matches(its_service, its_instance, its_method);
-        if (ftype.first) {
+
+    // Forward to the channels whose filter set allows
+    const auto its_dispatch = dispatch_.load();
+    its_dispatch->filters_.for_each_match(its_service, its_instance, its_method, [&](std::size_t _channel, bool _is_header_only) {
+#ifdef VSOMEIP_ENABLE_PCAP_TRACING
+        is_captured = true;
+        is_header_only = is_header_only && _is_header_only;
+#endif
+#ifdef USE_DLT
 #ifndef ANDROID
-            auto its_context = contexts_.find(its_channel.second->get_id());
-            if (its_context != contexts_.end()) {
-                try {
-                    if (ftype.second) {
-                        // Positive Filter
-                        DLT_TRACE_NETWORK_SEGMENTED(*(its_context->second.get()), DLT_NW_TRACE_IPC, _header_size,
-                                                    static_cast<void*>(const_cast<byte_t*>(_header)), its_data_size,
-                                                    static_cast<void*>(const_cast<byte_t*>(_data)));
-                    } else {
-                        // Header-Only Filter
-                        DLT_TRACE_NETWORK_TRUNCATED(*(its_context->second.get()), DLT_NW_TRACE_IPC, _header_size,
-                                                    static_cast<void*>(const_cast<byte_t*>(_header)), VSOMEIP_FULL_HEADER_SIZE,
-                                                    static_cast<void*>(const_cast<byte_t*>(_data)));
-                    }
-                } catch (const std::exception& e) {
-                    VSOMEIP_INFO << "connector_impl::trace: "
-                                 << "Exception caught when trying to log a trace with DLT. " << e.what();
+        const auto& its_context = its_dispatch->contexts_[_channel];
+        if (its_context) {
+            try {
+                if (!_is_header_only) {
+                    // Positive Filter
+                    DLT_TRACE_NETWORK_SEGMENTED(*(its_context.get()), DLT_NW_TRACE_IPC, _header_size,
+                                                static_cast<void*>(const_cast<byte_t*>(_header)), its_data_size,
+                                                static_cast<void*>(const_cast<byte_t*>(_data)));
+                } else {
+                    // Header-Only Filter
+                    DLT_TRACE_NETWORK_TRUNCATED(*(its_context.get()), DLT_NW_TRACE_IPC, _header_size,
+                                                static_cast<void*>(const_cast<byte_t*>(_header)), VSOMEIP_FULL_HEADER_SIZE,
+                                                static_cast<void*>(const_cast<byte_t*>(_data)));
                 }
-            } else {
-                // This should never happen!
-                VSOMEIP_ERROR << "tracing: found channel without DLT context!";
+            } catch (const std::exception& e) {
+                VSOMEIP_INFO << "connector_impl::trace: "
+                             << "Exception caught when trying to log a trace with DLT. " << e.what();
             }
+        } else {
+            // This should never happen!
+            VSOMEIP_ERROR << "tracing: found channel without DLT context!";
+        }
 #else
-            std::stringstream ss;
-            ss << "TC:";
-            for (int i = 0; i < _header_size; i++) {
-                ss << ' ' << std::setfill('0') << std::setw(2) << std::hex << int(_header[i]);
-            }
-            if (ftype.second)
-                its_data_size = VSOMEIP_FULL_HEADER_SIZE;
-            for (int i = 0; i < its_data_size; i++) {
-                ss << ' ' << std::setfill('0') << std::setw(2) << std::hex << int(_data[i]);
-            }
-            std::string app = runtime::get_property("LogApplication");
+        (void)_channel;
+        std::stringstream ss;
+        ss << "TC:";
+        for (int i = 0; i < _header_size; i++) {
+            ss << ' ' << std::setfill('0') << std::setw(2) << std::hex << int(_header[i]);
+        }
+        if (!_is_header_only)
+            its_data_size = VSOMEIP_FULL_HEADER_SIZE;
+        for (int i = 0; i < its_data_size; i++) {
+            ss << ' ' << std::setfill('0') << std::setw(2) << std::hex << int(_data[i]);
+        }
+        std::string app = runtime::get_property("LogApplication");
 
-            ALOGI(app.c_str(), ss.str().c_str());
+        ALOGI(app.c_str(), ss.str().c_str());
 #endif
-        }
+#else
+        (void)_channel;
+        (void)_is_header_only;
+#endif
+    });
+
+#ifdef VSOMEIP_ENABLE_PCAP_TRACING
+    if (is_captured && its_dispatch->pcap_) {
+        its_dispatch->pcap_->write(_header, _header_size, _data, _data_size, is_header_only);
     }
+#endif
 #else
     (void)_header;
     (void)_header_size;
@@ -0,0 +1,111 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+
+#include "../include/filter_table.hpp"
+
+namespace vsomeip_v3 {
+namespace trace {
+
+namespace {
+
+// A filter that compares with "_value" distinguishes "_value" from its neighbours
+void add_value(std::vector<std::uint16_t>& _boundaries, std::uint32_t _value) {
+    _boundaries.push_back(static_cast<std::uint16_t>(_value));
+    if (_value < 0xFFFF) {
+        _boundaries.push_back(static_cast<std::uint16_t>(_value + 1));
+    }
+}
+
+void add_range(std::vector<std::uint16_t>& _boundaries, std::uint32_t _from, std::uint32_t _to) {
+    _boundaries.push_back(static_cast<std::uint16_t>(_from));
+    if (_to < 0xFFFF) {
+        _boundaries.push_back(static_cast<std::uint16_t>(_to + 1));
+    }
+}
+
+} // namespace
+
+void filter_table::dimension_t::build() {
+    boundaries_.push_back(0);
+    std::sort(boundaries_.begin(), boundaries_.end());
+    boundaries_.erase(std::unique(boundaries_.begin(), boundaries_.end()), boundaries_.end());
+
+    if (boundaries_.size() > 1) {
+        classes_.resize(0x10000);
+        std::size_t its_class(0);
+        for (std::uint32_t v = 0; v <= 0xFFFF; ++v) {
+            if (its_class + 1 < boundaries_.size() && boundaries_[its_class + 1] == v) {
+                ++its_class;
+            }
+            classes_[v] = static_cast<std::uint16_t>(its_class);
+        }
+    }
+}
+
+filter_table::filter_table(std::vector<filter_rules_t>&& _channels) : channels_(std::move(_channels)) {
+
+    if (channels_.size() > max_channels) {
+        return;
+    }
+
+    for (const auto& c : channels_) {
+        for (const auto& f : c) {
+            const auto& its_rule = f.second;
+            if (its_rule.is_range_) {
+                add_range(services_.boundaries_, std::get<0>(its_rule.matches_[0]), std::get<0>(its_rule.matches_[1]));
+                add_range(instances_.boundaries_, std::get<1>(its_rule.matches_[0]), std::get<1>(its_rule.matches_[1]));
+                add_range(methods_.boundaries_, std::get<2>(its_rule.matches_[0]), std::get<2>(its_rule.matches_[1]));
+            } else {
+                for (const auto& m : its_rule.matches_) {
+                    if (std::get<0>(m) != ANY_SERVICE)
+                        add_value(services_.boundaries_, std::get<0>(m));
+                    if (std::get<1>(m) != ANY_INSTANCE)
+                        add_value(instances_.boundaries_, std::get<1>(m));
+                    if (std::get<2>(m) != ANY_METHOD)
+                        add_value(methods_.boundaries_, std::get<2>(m));
+                }
+            }
+        }
+    }
+
+    services_.build();
+    instances_.build();
+    methods_.build();
+
+    const std::size_t its_combinations = services_.boundaries_.size() * instances_.boundaries_.size() * methods_.boundaries_.size();
+    if (its_combinations > max_combinations) {
+        return;
+    }
+
+    // The lowest value of a class represents all of its values
+    decisions_.reserve(its_combinations);
+    for (auto s : services_.boundaries_) {
+        for (auto i : instances_.boundaries_) {
+            for (auto m : methods_.boundaries_) {
+                decisions_.push_back(evaluate(s, i, m));
+            }
+        }
+    }
+    is_compiled_ = true;
+}
+
+filter_table::decision_t filter_table::evaluate(service_t _service, instance_t _instance, method_t _method) const {
+    decision_t its_decision{0, 0};
+    for (std::size_t c = 0; c < channels_.size(); ++c) {
+        const auto its_match = channel_impl::matches(channels_[c], _service, _instance, _method);
+        if (its_match.first) {
+            its_decision.forward_ |= (std::uint64_t(1) << c);
+            if (!its_match.second) {
+                its_decision.header_only_ |= (std::uint64_t(1) << c);
+            }
+        }
+    }
+    return its_decision;
+}
+
+} // namespace trace
+} // namespace vsomeip_v3
@@ -0,0 +1,436 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include <vsomeip/defines.hpp>
+#include <vsomeip/internal/logger.hpp>
+
+#include "../include/pcapng_writer.hpp"
+#include "../../protocol/include/protocol.hpp"
+#include "../../utility/include/bithelper.hpp"
+
+namespace vsomeip_v3 {
+namespace trace {
+
+namespace {
+// Block types and options, see https://www.ietf.org/archive/id/draft-ietf-opsawg-pcapng-02.html
+constexpr std::uint32_t PCAPNG_SECTION_HEADER_BLOCK = 0x0A0D0D0A;
+constexpr std::uint32_t PCAPNG_INTERFACE_DESCRIPTION_BLOCK = 0x00000001;
+constexpr std::uint32_t PCAPNG_ENHANCED_PACKET_BLOCK = 0x00000006;
+constexpr std::uint32_t PCAPNG_BYTE_ORDER_MAGIC = 0x1A2B3C4D;
+constexpr std::uint16_t PCAPNG_OPTION_END = 0;
+constexpr std::uint16_t PCAPNG_OPTION_COMMENT = 1;
+constexpr std::uint16_t PCAPNG_OPTION_SHB_USERAPPL = 4;
+constexpr std::uint16_t PCAPNG_OPTION_IF_NAME = 2;
+constexpr std::uint16_t PCAPNG_OPTION_IF_TSRESOL = 9;
+constexpr std::uint16_t PCAPNG_LINKTYPE_IPV4 = 228;
+
+constexpr std::size_t IPV4_HEADER_SIZE = 20;
+constexpr std::size_t UDP_HEADER_SIZE = 8;
+constexpr std::size_t TCP_HEADER_SIZE = 20;
+constexpr std::size_t MAX_FRAME_SIZE = 0xFFFF;
+
+constexpr byte_t IP_PROTOCOL_TCP = 6;
+constexpr byte_t IP_PROTOCOL_UDP = 17;
+
+constexpr std::uint32_t LOOPBACK_ADDRESS = 0x7F000001;
+// Port of the routing manager side of local messages if the trace header has none
+constexpr std::uint16_t LOCAL_ROUTING_PORT = 31490;
+
+const byte_t start_tag__[] = {0x67, 0x37, 0x6D, 0x07};
+const byte_t end_tag__[] = {0x07, 0x6D, 0x37, 0x67};
+
+// pcapng fields are written in host byte order (as announced by the byte order magic)
+template<typename T>
+void append(std::vector<byte_t>& _buffer, T _value) {
+    byte_t its_bytes[sizeof(T)];
+    std::memcpy(its_bytes, &_value, sizeof(T));
+    _buffer.insert(_buffer.end(), its_bytes, its_bytes + sizeof(T));
+}
+
+void append_be16(std::vector<byte_t>& _buffer, std::uint16_t _value) {
+    byte_t its_bytes[2];
+    bithelper::write_uint16_be(_value, its_bytes);
+    _buffer.insert(_buffer.end(), its_bytes, its_bytes + 2);
+}
+
+void append_be32(std::vector<byte_t>& _buffer, std::uint32_t _value) {
+    byte_t its_bytes[4];
+    bithelper::write_uint32_be(_value, its_bytes);
+    _buffer.insert(_buffer.end(), its_bytes, its_bytes + 4);
+}
+
+void append_le16(std::vector<byte_t>& _buffer, std::uint16_t _value) {
+    _buffer.push_back(static_cast<byte_t>(_value & 0xFF));
+    _buffer.push_back(static_cast<byte_t>(_value >> 8));
+}
+
+void append_le32(std::vector<byte_t>& _buffer, std::uint32_t _value) {
+    append_le16(_buffer, static_cast<std::uint16_t>(_value & 0xFFFF));
+    append_le16(_buffer, static_cast<std::uint16_t>(_value >> 16));
+}
+
+void pad(std::vector<byte_t>& _buffer) {
+    while (_buffer.size() % 4 != 0) {
+        _buffer.push_back(0);
+    }
+}
+
+void append_option(std::vector<byte_t>& _buffer, std::uint16_t _code, const void* _value, std::size_t _size) {
+    append(_buffer, _code);
+    append(_buffer, static_cast<std::uint16_t>(_size));
+    const auto its_value = static_cast<const byte_t*>(_value);
+    _buffer.insert(_buffer.end(), its_value, its_value + _size);
+    pad(_buffer);
+}
+
+std::uint16_t ipv4_checksum(const byte_t* _header) {
+    std::uint32_t its_sum(0);
+    for (std::size_t i = 0; i < IPV4_HEADER_SIZE; i += 2) {
+        its_sum += bithelper::read_uint16_be(&_header[i]);
+    }
+    while (its_sum >> 16) {
+        its_sum = (its_sum & 0xFFFF) + (its_sum >> 16);
+    }
+    return static_cast<std::uint16_t>(~its_sum);
+}
+
+const char* to_string(protocol_e _protocol) {
+    switch (_protocol) {
+    case protocol_e::local:
+        return "local";
+    case protocol_e::udp:
+        return "udp";
+    case protocol_e::tcp:
+        return "tcp";
+    default:
+        return "unknown";
+    }
+}
+} // namespace
+
+pcapng_writer::pcapng_writer(const std::string& _path, std::uint64_t _max_size, std::uint32_t _max_files, std::size_t _buffer_size) :
+    path_(_path), max_size_(_max_size), max_files_(_max_files), buffer_size_(_buffer_size / 2), pending_count_(0), written_count_(0),
+    is_flush_requested_(false), is_stopping_(false), dropped_(0), file_size_(0), file_header_size_(0), ip_id_(0), reported_dropped_(0) {
+
+    pending_.reserve(buffer_size_);
+    writer_ = std::thread([this]() { run(); });
+#if defined(__linux__)
+    pthread_setname_np(writer_.native_handle(), "vsomeip_pcapng");
+#endif
+}
+
+pcapng_writer::~pcapng_writer() {
+    {
+        std::scoped_lock its_lock(mutex_);
+        is_stopping_ = true;
+    }
+    wake_up_condition_.notify_one();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+}
+
+bool pcapng_writer::write(const byte_t* _header, uint16_t _header_size, const byte_t* _data, uint32_t _data_size,
+                          bool _is_header_only) {
+
+    if (_header_size < VSOMEIP_TRACE_HEADER_SIZE) {
+        return false;
+    }
+
+    entry_t its_entry;
+    its_entry.timestamp_ =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    its_entry.size_ = _data_size;
+    its_entry.captured_size_ = (_is_header_only && _data_size > VSOMEIP_FULL_HEADER_SIZE) ? VSOMEIP_FULL_HEADER_SIZE : _data_size;
+    std::memcpy(its_entry.header_, _header, VSOMEIP_TRACE_HEADER_SIZE);
+
+    const auto its_size = sizeof(its_entry) + its_entry.captured_size_;
+    bool must_wake_up(false);
+    {
+        std::scoped_lock its_lock(mutex_);
+        if (pending_.size() + its_size > buffer_size_) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const auto its_entry_bytes = reinterpret_cast<const byte_t*>(&its_entry);
+        pending_.insert(pending_.end(), its_entry_bytes, its_entry_bytes + sizeof(its_entry));
+        pending_.insert(pending_.end(), _data, _data + its_entry.captured_size_);
+
+        // The writer wakes up periodically, only hurry it if memory gets short
+        must_wake_up = (pending_.size() > buffer_size_ / 2 && pending_.size() - its_size <= buffer_size_ / 2);
+    }
+    if (must_wake_up) {
+        wake_up_condition_.notify_one();
+    }
+    return true;
+}
+
+void pcapng_writer::flush() {
+    std::unique_lock its_lock(mutex_);
+    const auto its_target = pending_count_ + (pending_.empty() ? 0 : 1);
+    if (written_count_ >= its_target) {
+        return;
+    }
+    is_flush_requested_ = true;
+    wake_up_condition_.notify_one();
+    flushed_condition_.wait(its_lock, [this, its_target]() { return written_count_ >= its_target; });
+}
+
+std::uint64_t pcapng_writer::get_dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+void pcapng_writer::run() {
+    open_file();
+
+    std::vector<byte_t> its_entries;
+    its_entries.reserve(buffer_size_);
+    while (true) {
+        std::uint64_t its_count;
+        {
+            std::unique_lock its_lock(mutex_);
+            wake_up_condition_.wait_for(its_lock, std::chrono::milliseconds(100),
+                                        [this]() { return is_stopping_ || is_flush_requested_ || pending_.size() > buffer_size_ / 2; });
+            is_flush_requested_ = false;
+            if (pending_.empty()) {
+                if (is_stopping_) {
+                    break;
+                }
+                continue;
+            }
+            its_entries.swap(pending_);
+            its_count = ++pending_count_;
+        }
+
+        write_entries(its_entries);
+        its_entries.clear();
+
+        {
+            std::scoped_lock its_lock(mutex_);
+            written_count_ = its_count;
+        }
+        flushed_condition_.notify_all();
+
+        const auto its_dropped = get_dropped();
+        if (its_dropped != reported_dropped_) {
+            VSOMEIP_WARNING << "pcapng_writer: dropped " << std::dec << (its_dropped - reported_dropped_)
+                            << " traced messages as the buffer of " << buffer_size_ * 2 << " bytes was full";
+            reported_dropped_ = its_dropped;
+        }
+    }
+
+    file_.close();
+}
+
+void pcapng_writer::write_entries(const std::vector<byte_t>& _entries) {
+    std::size_t its_position(0);
+    while (its_position + sizeof(entry_t) <= _entries.size()) {
+        entry_t its_entry;
+        std::memcpy(&its_entry, &_entries[its_position], sizeof(its_entry));
+        its_position += sizeof(its_entry);
+        write_packet(its_entry, &_entries[its_position]);
+        its_position += its_entry.captured_size_;
+    }
+    if (file_.is_open()) {
+        file_.flush();
+    }
+}
+
+void pcapng_writer::write_packet(const entry_t& _entry, const byte_t* _data) {
+
+    const std::uint32_t its_remote_address = bithelper::read_uint32_be(&_entry.header_[0]);
+    const std::uint16_t its_remote_port = bithelper::read_uint16_be(&_entry.header_[4]);
+    const auto its_protocol = static_cast<protocol_e>(_entry.header_[6]);
+    const bool is_sending = (_entry.header_[7] != 0);
+    const instance_t its_instance = bithelper::read_uint16_be(&_entry.header_[8]);
+
+    const client_t its_client =
+            (_entry.captured_size_ > VSOMEIP_CLIENT_POS_MAX) ? bithelper::read_uint16_be(&_data[VSOMEIP_CLIENT_POS_MIN]) : client_t(0);
+
+    // The trace header only names the remote endpoint. Local messages are
+    // exchanged between the client (port = client ID) and the routing manager,
+    // network messages use the remote port on both sides.
+    std::uint32_t its_local_address(0), its_peer_address(its_remote_address);
+    std::uint16_t its_local_port(its_remote_port), its_peer_port(its_remote_port);
+    if (its_protocol == protocol_e::local) {
+        its_local_address = its_peer_address = LOOPBACK_ADDRESS;
+        its_local_port = its_client;
+        if (its_peer_port == 0) {
+            its_peer_port = LOCAL_ROUTING_PORT;
+        }
+    }
+
+    const bool is_udp = (its_protocol == protocol_e::udp);
+    const std::size_t its_transport_size = is_udp ? UDP_HEADER_SIZE : TCP_HEADER_SIZE;
+    const std::size_t its_wrapper_size =
+            (its_protocol == protocol_e::local) ? sizeof(start_tag__) + protocol::SEND_COMMAND_HEADER_SIZE + sizeof(end_tag__) : 0;
+    const std::size_t its_overhead = IPV4_HEADER_SIZE + its_transport_size + its_wrapper_size;
+
+    // Clip to the maximum IPv4 packet size
+    std::uint32_t its_captured_size = _entry.captured_size_;
+    if (its_overhead + its_captured_size > MAX_FRAME_SIZE) {
+        its_captured_size = static_cast<std::uint32_t>(MAX_FRAME_SIZE - its_overhead);
+    }
+    const std::size_t its_payload_size = its_wrapper_size + its_captured_size;
+
+    const std::uint32_t its_source = is_sending ? its_local_address : its_peer_address;
+    const std::uint32_t its_destination = is_sending ? its_peer_address : its_local_address;
+    const std::uint16_t its_source_port = is_sending ? its_local_port : its_peer_port;
+    const std::uint16_t its_destination_port = is_sending ? its_peer_port : its_local_port;
+
+    frame_.clear();
+
+    // IPv4
+    append_be16(frame_, 0x4500); // version, header length, type of service
+    append_be16(frame_, static_cast<std::uint16_t>(IPV4_HEADER_SIZE + its_transport_size + its_payload_size));
+    append_be16(frame_, ip_id_++);
+    append_be16(frame_, 0x4000); // don't fragment
+    frame_.push_back(64); // time to live
+    frame_.push_back(is_udp ? IP_PROTOCOL_UDP : IP_PROTOCOL_TCP);
+    append_be16(frame_, 0); // checksum
+    append_be32(frame_, its_source);
+    append_be32(frame_, its_destination);
+    bithelper::write_uint16_be(ipv4_checksum(frame_.data()), &frame_[10]);
+
+    if (is_udp) {
+        append_be16(frame_, its_source_port);
+        append_be16(frame_, its_destination_port);
+        append_be16(frame_, static_cast<std::uint16_t>(UDP_HEADER_SIZE + its_payload_size));
+        append_be16(frame_, 0); // no checksum
+    } else {
+        auto& its_sequence = sequences_[std::make_tuple(its_source, its_destination, its_source_port, its_destination_port)];
+        const auto its_acknowledge = sequences_[std::make_tuple(its_destination, its_source, its_destination_port, its_source_port)];
+        append_be16(frame_, its_source_port);
+        append_be16(frame_, its_destination_port);
+        append_be32(frame_, its_sequence);
+        append_be32(frame_, its_acknowledge);
+        append_be16(frame_, 0x5018); // header length, PSH + ACK
+        append_be16(frame_, 0xFFFF); // window
+        append_be16(frame_, 0); // checksum
+        append_be16(frame_, 0); // urgent pointer
+        its_sequence += static_cast<std::uint32_t>(its_payload_size);
+    }
+
+    if (its_protocol == protocol_e::local) {
+        frame_.insert(frame_.end(), start_tag__, start_tag__ + sizeof(start_tag__));
+        frame_.push_back(static_cast<byte_t>(protocol::id_e::SEND_ID));
+        append_le16(frame_, protocol::MAX_SUPPORTED_VERSION);
+        append_le16(frame_, its_client);
+        append_le32(frame_, static_cast<std::uint32_t>(protocol::SEND_COMMAND_HEADER_SIZE - protocol::COMMAND_HEADER_SIZE
+                                                       + its_captured_size));
+        append_le16(frame_, its_instance);
+        frame_.push_back(0); // reliable
+        frame_.push_back(0); // status (crc)
+        append_le16(frame_, 0); // destination client
+    }
+    frame_.insert(frame_.end(), _data, _data + its_captured_size);
+    if (its_protocol == protocol_e::local) {
+        frame_.insert(frame_.end(), end_tag__, end_tag__ + sizeof(end_tag__));
+    }
+
+    std::stringstream its_comment;
+    its_comment << "instance 0x" << std::hex << std::setfill('0') << std::setw(4) << its_instance << ", " << to_string(its_protocol) << ", "
+                << (is_sending ? "sent" : "received");
+    if (its_captured_size < _entry.size_) {
+        its_comment << ", " << std::dec << (_entry.size_ - its_captured_size) << " bytes omitted";
+    }
+    const auto its_comment_text = its_comment.str();
+
+    block_.clear();
+    append(block_, std::uint32_t(0)); // interface
+    append(block_, static_cast<std::uint32_t>(static_cast<std::uint64_t>(_entry.timestamp_) >> 32));
+    append(block_, static_cast<std::uint32_t>(static_cast<std::uint64_t>(_entry.timestamp_) & 0xFFFFFFFF));
+    append(block_, static_cast<std::uint32_t>(frame_.size()));
+    append(block_, static_cast<std::uint32_t>(frame_.size() + (_entry.size_ - its_captured_size)));
+    block_.insert(block_.end(), frame_.begin(), frame_.end());
+    pad(block_);
+    append_option(block_, PCAPNG_OPTION_COMMENT, its_comment_text.data(), its_comment_text.size());
+    append_option(block_, PCAPNG_OPTION_END, nullptr, 0);
+
+    // A file holds at least one packet, even if it exceeds the maximum size
+    if (max_size_ > 0 && file_size_ + block_.size() + 12 > max_size_ && file_size_ > file_header_size_) {
+        rotate_file();
+    }
+    write_block(PCAPNG_ENHANCED_PACKET_BLOCK);
+}
+
+void pcapng_writer::open_file() {
+    file_.open(path_, std::ios_base::binary | std::ios_base::trunc);
+    if (!file_.is_open()) {
+        VSOMEIP_ERROR << "pcapng_writer: cannot open \"" << path_ << "\", traced messages are not captured";
+        return;
+    }
+    file_size_ = 0;
+    write_file_header();
+    file_header_size_ = file_size_;
+}
+
+void pcapng_writer::rotate_file() {
+    file_.close();
+
+    if (max_files_ == 0) {
+        std::remove(path_.c_str());
+    } else {
+        // The oldest file is dropped, all others move up by one
+        std::remove((path_ + "." + std::to_string(max_files_)).c_str());
+        for (std::uint32_t i = max_files_; i > 1; --i) {
+            std::rename((path_ + "." + std::to_string(i - 1)).c_str(), (path_ + "." + std::to_string(i)).c_str());
+        }
+        std::rename(path_.c_str(), (path_ + ".1").c_str());
+    }
+
+    file_.clear();
+    open_file();
+}
+
+void pcapng_writer::write_file_header() {
+    static const char its_application[] = "vsomeip";
+    static const char its_interface[] = "vsomeip trace";
+
+    block_.clear();
+    append(block_, PCAPNG_BYTE_ORDER_MAGIC);
+    append(block_, std::uint16_t(1)); // major version
+    append(block_, std::uint16_t(0)); // minor version
+    append(block_, std::int64_t(-1)); // section length is not known
+    append_option(block_, PCAPNG_OPTION_SHB_USERAPPL, its_application, sizeof(its_application) - 1);
+    append_option(block_, PCAPNG_OPTION_END, nullptr, 0);
+    write_block(PCAPNG_SECTION_HEADER_BLOCK);
+
+    const byte_t its_resolution(9); // nanoseconds
+    block_.clear();
+    append(block_, PCAPNG_LINKTYPE_IPV4);
+    append(block_, std::uint16_t(0)); // reserved
+    append(block_, std::uint32_t(0)); // no snapshot length
+    append_option(block_, PCAPNG_OPTION_IF_NAME, its_interface, sizeof(its_interface) - 1);
+    append_option(block_, PCAPNG_OPTION_IF_TSRESOL, &its_resolution, sizeof(its_resolution));
+    append_option(block_, PCAPNG_OPTION_END, nullptr, 0);
+    write_block(PCAPNG_INTERFACE_DESCRIPTION_BLOCK);
+}
+
+void pcapng_writer::write_block(std::uint32_t _type) {
+    if (!file_.is_open()) {
+        return;
+    }
+
+    // Type, total length, body, total length
+    const auto its_length = static_cast<std::uint32_t>(block_.size() + 12);
+    file_.write(reinterpret_cast<const char*>(&_type), sizeof(_type));
+    file_.write(reinterpret_cast<const char*>(&its_length), sizeof(its_length));
+    file_.write(reinterpret_cast<const char*>(block_.data()), static_cast<std::streamsize>(block_.size()));
+    file_.write(reinterpret_cast<const char*>(&its_length), sizeof(its_length));
+    file_size_ += its_length;
+}
+
+} // namespace trace
+} // namespace vsomeip_v3
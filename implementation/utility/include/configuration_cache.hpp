@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_CONFIGURATION_CACHE_HPP
+#define VSOMEIP_V3_CONFIGURATION_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <vsomeip/export.hpp>
+
+#include "../../configuration/include/configuration_element.hpp"
+
+namespace vsomeip_v3 {
+
+// Binary image of the property trees of a configuration set.
+//
+// The image contains the trees of all configuration files that are read
+// for a set of input files and folders, in the order the configuration
+// reads them, a hash over the input paths, the file names and their
+// contents and a stamp over the file names and their metadata (size,
+// modification time and inode). It is only used if it matches the current
+// state of the inputs: the files are only hashed again if their metadata
+// changed. Otherwise the configuration reads the JSON files. The trees are
+// read once when the image is opened.
+//
+// The image only saves tokenizing the JSON files. It is not a compiled
+// configuration: the trees are copied out of the image and the load_*
+// functions of the configuration evaluate them as they evaluate the trees
+// of the JSON parser.
+//
+// Images are created by the "vsomeip_config_cache" tool and are specific
+// to the byte order of the host they were created on.
+class VSOMEIP_IMPORT_EXPORT configuration_cache {
+public:
+    configuration_cache();
+    ~configuration_cache();
+
+    configuration_cache(const configuration_cache&) = delete;
+    configuration_cache& operator=(const configuration_cache&) = delete;
+
+    // Parses the configuration files of "_input" and writes the image to
+    // "_path". Fails if a file cannot be parsed.
+    static bool create(const std::set<std::string>& _input, const std::string& _path, std::string& _error);
+
+    // Reads the image at "_path". Returns false if it does not exist, is
+    // invalid or was not created from the current state of "_input".
+    bool open(const std::string& _path, const std::set<std::string>& _input);
+    void close();
+
+    // Appends the elements whose name passes "_filter" to "_elements".
+    bool get(std::vector<configuration_element>& _elements, const std::function<bool(const std::string&)>& _filter) const;
+
+    // Configuration files that are read for "_input", in reading order.
+    static std::vector<std::string> get_files(const std::set<std::string>& _input);
+
+private:
+    static bool hash(const std::set<std::string>& _input, std::uint64_t& _hash);
+    static bool stamp(const std::set<std::string>& _input, std::uint64_t& _stamp);
+
+    bool read(const unsigned char* _data, std::size_t _size, const std::set<std::string>& _input);
+
+    bool is_open_;
+    std::vector<configuration_element> elements_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_CONFIGURATION_CACHE_HPP
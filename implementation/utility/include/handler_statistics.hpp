@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_HANDLER_STATISTICS_HPP_
+#define VSOMEIP_V3_HANDLER_STATISTICS_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vsomeip/structured_types.hpp>
+
+#include "latency_statistics.hpp"
+#include "snapshot.hpp"
+
+namespace vsomeip_v3 {
+
+// CPU and wall time histograms of the handler calls, per kind of handler and
+// per kind, service and method. Like latency_statistics, the histograms of
+// known methods are found through a snapshot and at most "_max_methods"
+// methods are tracked, further ones are only counted.
+class handler_statistics {
+public:
+    explicit handler_statistics(std::size_t _max_methods);
+
+    // CPU time consumed by the calling thread, 0 if not supported
+    static std::chrono::nanoseconds get_thread_cpu_time();
+
+    void record(handler_kind_e _kind, service_t _service, method_t _method, std::chrono::nanoseconds _cpu_time,
+                std::chrono::nanoseconds _wall_time);
+
+    // Profiles that contain at least one call, the kinds first, then ordered
+    // by kind, service and method
+    std::vector<handler_profile_t> get() const;
+    std::uint64_t get_ignored() const;
+
+    // The "_count" service and method profiles with the highest 99th
+    // percentile of the wall time, slowest first
+    static std::vector<handler_profile_t> get_slowest(const std::vector<handler_profile_t>& _profiles, std::size_t _count);
+
+private:
+    static constexpr std::size_t kind_count_ = static_cast<std::size_t>(handler_kind_e::HK_OTHER) + 1;
+
+    struct histograms_t {
+        latency_histogram cpu_time_;
+        latency_histogram wall_time_;
+    };
+    using histograms_map_t = std::map<std::uint64_t, std::shared_ptr<histograms_t>>;
+
+    static std::uint64_t get_key(handler_kind_e _kind, service_t _service, method_t _method);
+    static bool get(const histograms_t& _histograms, handler_profile_t& _profile);
+    std::shared_ptr<histograms_t> add(std::uint64_t _key);
+
+    const std::size_t max_methods_;
+
+    std::array<histograms_t, kind_count_> kinds_;
+
+    std::mutex mutex_;
+    histograms_map_t methods_;
+    snapshot<histograms_map_t> snapshot_;
+    std::atomic<std::uint64_t> ignored_;
+};
+
+// Maximum depth of a queue per second, for the last "period_count_" seconds
+// in which the depth was recorded. Not synchronized: application_impl
+// records and reads it while holding the lock of its handler queue.
+class queue_depth_history {
+public:
+    static constexpr std::size_t period_count_ = 60;
+
+    queue_depth_history();
+
+    void record(std::size_t _depth, std::chrono::steady_clock::time_point _now);
+    // Oldest first
+    std::vector<dispatch_queue_sample_t> get() const;
+
+private:
+    std::array<dispatch_queue_sample_t, period_count_> periods_;
+    std::size_t current_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_HANDLER_STATISTICS_HPP_
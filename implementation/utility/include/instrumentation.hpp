@@ -0,0 +1,158 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_INSTRUMENTATION_HPP_
+#define VSOMEIP_V3_INSTRUMENTATION_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <vsomeip/structured_types.hpp>
+
+#include "latency_statistics.hpp"
+#include "metrics.hpp"
+
+namespace vsomeip_v3 {
+
+// Acquisitions and wait times of a named lock site, e.g.
+// "server_endpoint_impl::mutex_". All mutexes with the same name share the
+// site, so the site of a member mutex covers all instances of its class.
+struct lock_site_profile_t {
+    std::string name_;
+    std::uint64_t acquisitions_;
+    // Waits of the contended acquisitions, i.e. of those that found the
+    // mutex held by another thread
+    latency_histogram_t wait_time_;
+};
+
+class lock_site {
+public:
+    explicit lock_site(const std::string& _name);
+
+    lock_site(const lock_site&) = delete;
+    lock_site& operator=(const lock_site&) = delete;
+
+    void record_acquisition() { acquisitions_.add(0); }
+    void record_contention(std::chrono::nanoseconds _wait_time) {
+        acquisitions_.add(0);
+        wait_time_.record(_wait_time);
+    }
+
+    void get(lock_site_profile_t& _profile) const;
+
+private:
+    const std::string name_;
+    metric_counters<1> acquisitions_;
+    latency_histogram wait_time_;
+};
+
+// Mutex that records its acquisitions at its lock site. The wait time is
+// only measured if "try_lock" fails, so an uncontended lock costs one
+// additional counter update.
+template<typename Mutex_>
+class profiling_mutex {
+public:
+    using unique_lock = std::unique_lock<profiling_mutex>;
+    using condition_variable = std::condition_variable_any;
+
+    explicit profiling_mutex(const char* _site);
+
+    profiling_mutex(const profiling_mutex&) = delete;
+    profiling_mutex& operator=(const profiling_mutex&) = delete;
+
+    void lock() {
+        if (mutex_.try_lock()) {
+            site_.record_acquisition();
+            return;
+        }
+        const auto its_start = std::chrono::steady_clock::now();
+        mutex_.lock();
+        site_.record_contention(std::chrono::steady_clock::now() - its_start);
+    }
+
+    bool try_lock() {
+        if (mutex_.try_lock()) {
+            site_.record_acquisition();
+            return true;
+        }
+        return false;
+    }
+
+    void unlock() { mutex_.unlock(); }
+
+private:
+    Mutex_ mutex_;
+    lock_site& site_;
+};
+
+// Mutex that takes a lock site name, but does not record anything
+template<typename Mutex_>
+class plain_mutex : public Mutex_ {
+public:
+    using unique_lock = std::unique_lock<Mutex_>;
+    using condition_variable =
+            std::conditional_t<std::is_same_v<Mutex_, std::mutex>, std::condition_variable, std::condition_variable_any>;
+
+    explicit plain_mutex(const char*) { }
+};
+
+// Mutexes of the lock sites that are profiled by instrumented builds. Lock
+// them with std::scoped_lock or their "unique_lock" and wait on them with
+// their "condition_variable".
+#if defined(VSOMEIP_ENABLE_INSTRUMENTATION)
+using named_mutex = profiling_mutex<std::mutex>;
+using named_recursive_mutex = profiling_mutex<std::recursive_mutex>;
+#else
+using named_mutex = plain_mutex<std::mutex>;
+using named_recursive_mutex = plain_mutex<std::recursive_mutex>;
+#endif
+
+// Results of the instrumented build mode (ENABLE_INSTRUMENTATION). Other
+// builds only profile explicitly created profiling_mutex objects.
+class instrumentation {
+public:
+    static constexpr bool is_enabled() {
+#if defined(VSOMEIP_ENABLE_INSTRUMENTATION)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Site of "_name", created on first use. Sites are never removed.
+    static lock_site& get_lock_site(const std::string& _name);
+
+    // Sites with at least one acquisition, the longest total wait first
+    static std::vector<lock_site_profile_t> get_lock_sites();
+
+    // Counts an allocation of the calling thread. The library does not replace
+    // the global allocation functions; a process that wants allocations to be
+    // counted (e.g. a benchmark) replaces them and calls this from its
+    // operator new. Safe to call before static initialization.
+    static void count_allocation() noexcept;
+
+    // Allocations counted since the process started, of all threads or of
+    // the calling thread. 0 if the process never calls count_allocation.
+    static std::uint64_t get_allocations();
+    static std::uint64_t get_thread_allocations();
+
+    // Writes the allocations and at most "_max_sites" lock sites as text,
+    // one site per line
+    static void dump(std::ostream& _stream, std::size_t _max_sites = std::numeric_limits<std::size_t>::max());
+};
+
+template<typename Mutex_>
+profiling_mutex<Mutex_>::profiling_mutex(const char* _site) : site_(instrumentation::get_lock_site(_site)) { }
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_INSTRUMENTATION_HPP_
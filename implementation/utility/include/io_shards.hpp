@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_IO_SHARDS_HPP
+#define VSOMEIP_V3_IO_SHARDS_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+namespace vsomeip_v3 {
+
+// Additional io_contexts of an application that runs one io_context per
+// io thread ("io_sharding").
+//
+// The service is attached to the primary io_context of the application,
+// which is shard 0. Endpoints, their timers and accepted connections are
+// pinned to one shard by hashing a key (port, remote address, client), so
+// that all of their handlers run on the same thread. Without the service
+// (the default), every key selects the primary io_context.
+class io_shards : public boost::asio::io_context::service {
+public:
+    static boost::asio::io_context::id id;
+
+    explicit io_shards(boost::asio::io_context& _io);
+    ~io_shards() override;
+
+    // Adds io_contexts until there are "_count" shards, the primary one
+    // included. Must be called before any object is pinned to a shard.
+    void resize(std::size_t _count);
+
+    std::size_t size() const;
+    boost::asio::io_context& at(std::size_t _index);
+
+    // Restarts the additional io_contexts after "stop" and keeps them
+    // running until the next "stop".
+    void restart();
+    void stop();
+
+    // io_context that the object identified by "_key" is pinned to.
+    static boost::asio::io_context& select(boost::asio::io_context& _io, std::size_t _key);
+
+private:
+    using work_guard_t = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+    void shutdown() override;
+
+    boost::asio::io_context& io_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<boost::asio::io_context>> contexts_;
+    std::vector<work_guard_t> work_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_IO_SHARDS_HPP
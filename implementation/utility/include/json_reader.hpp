@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_JSON_READER_HPP
+#define VSOMEIP_V3_JSON_READER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <vsomeip/export.hpp>
+
+namespace vsomeip_v3 {
+
+// Streaming (SAX-style) JSON parser.
+//
+// The document is read in one pass and reported to a handler as a sequence
+// of events; no tree is built. Keys and string values are unescaped into a
+// buffer that is reused, numbers and literals are reported as their text.
+class VSOMEIP_IMPORT_EXPORT json_reader {
+public:
+    class handler {
+    public:
+        virtual ~handler() = default;
+
+        virtual void on_object_begin() = 0;
+        virtual void on_object_end() = 0;
+        virtual void on_array_begin() = 0;
+        virtual void on_array_end() = 0;
+        // Only valid during the call
+        virtual void on_key(const std::string& _key) = 0;
+        virtual void on_value(const std::string& _value) = 0;
+    };
+
+    // Returns false and a description of the first syntax error in "_error"
+    // if the document is not valid JSON.
+    static bool parse(const char* _data, std::size_t _size, handler& _handler, std::string& _error);
+    static bool parse_file(const std::string& _path, handler& _handler, std::string& _error);
+};
+
+// Builds the same property tree as boost::property_tree::read_json.
+//
+// Optionally, the elements of the array at "_split_path" (the keys of the
+// objects that contain it, starting at the root) are built one at a time
+// and passed to "_on_element" instead of being added to the tree, so that
+// large arrays are never held completely. The array itself stays in the
+// tree, without children.
+class VSOMEIP_IMPORT_EXPORT json_ptree_builder : public json_reader::handler {
+public:
+    using element_handler_t = std::function<void(const boost::property_tree::ptree&)>;
+
+    explicit json_ptree_builder(boost::property_tree::ptree& _tree);
+    json_ptree_builder(boost::property_tree::ptree& _tree, const std::vector<std::string>& _split_path, element_handler_t _on_element);
+
+    void on_object_begin() override;
+    void on_object_end() override;
+    void on_array_begin() override;
+    void on_array_end() override;
+    void on_key(const std::string& _key) override;
+    void on_value(const std::string& _value) override;
+
+private:
+    boost::property_tree::ptree& add_child();
+    void end_child();
+
+    boost::property_tree::ptree& root_;
+    // Open objects and arrays
+    std::vector<boost::property_tree::ptree*> stack_;
+    std::vector<std::string> path_;
+    std::string key_;
+
+    std::vector<std::string> split_path_;
+    element_handler_t on_element_;
+    // Size of "stack_" while the split array is open, otherwise 0
+    std::size_t split_depth_;
+    boost::property_tree::ptree element_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_JSON_READER_HPP
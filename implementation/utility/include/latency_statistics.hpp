@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_LATENCY_STATISTICS_HPP_
+#define VSOMEIP_V3_LATENCY_STATISTICS_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vsomeip/structured_types.hpp>
+
+#include "snapshot.hpp"
+
+namespace vsomeip_v3 {
+
+// Log-linear (HDR style) histogram of latencies in nanoseconds. Latencies
+// below 16ns have a bucket of their own, above that each power of two is
+// split into 16 buckets. Recording only updates relaxed atomics, so it never
+// blocks and may be done concurrently by any number of threads.
+class latency_histogram {
+public:
+    latency_histogram();
+
+    void record(std::chrono::nanoseconds _latency);
+    // Fills count_, min_, max_, sum_ and buckets_
+    void get(latency_histogram_t& _histogram) const;
+
+    static std::size_t get_index(std::uint64_t _latency);
+    static std::uint64_t get_upper_bound(std::size_t _index);
+
+    // Upper bound of the bucket that contains the given percentile (0..100)
+    static std::chrono::nanoseconds get_percentile(const latency_histogram_t& _histogram, double _percentile);
+
+private:
+    static constexpr unsigned sub_bucket_bits_ = 4;
+    // Latencies of 2^40ns (~18 minutes) and above are counted in the last bucket
+    static constexpr unsigned max_bits_ = 40;
+    static constexpr std::size_t bucket_count_ = (max_bits_ - sub_bucket_bits_ + 1) << sub_bucket_bits_;
+
+    std::array<std::atomic<std::uint64_t>, bucket_count_> buckets_;
+    std::atomic<std::uint64_t> count_;
+    std::atomic<std::uint64_t> sum_;
+    std::atomic<std::uint64_t> min_;
+    std::atomic<std::uint64_t> max_;
+};
+
+// Latency histograms of the processing stages of received messages, per
+// service, instance and method. The histograms of known methods are found
+// through a snapshot, so recording does not take a lock. At most
+// "_max_methods" methods are tracked, further ones are only counted.
+class latency_statistics {
+public:
+    explicit latency_statistics(std::size_t _max_methods);
+
+    void record(service_t _service, instance_t _instance, method_t _method, latency_stage_e _stage, std::chrono::nanoseconds _latency);
+
+    // Histograms that contain at least one latency, ordered by service,
+    // instance, method and stage
+    std::vector<latency_histogram_t> get() const;
+    std::uint64_t get_ignored() const;
+
+private:
+    static constexpr std::size_t stage_count_ = 3;
+
+    struct stages_t {
+        std::array<latency_histogram, stage_count_> histograms_;
+    };
+    using stages_map_t = std::map<std::uint64_t, std::shared_ptr<stages_t>>;
+
+    static std::uint64_t get_key(service_t _service, instance_t _instance, method_t _method);
+    std::shared_ptr<stages_t> add(std::uint64_t _key);
+
+    const std::size_t max_methods_;
+
+    std::mutex mutex_;
+    stages_map_t stages_;
+    snapshot<stages_map_t> snapshot_;
+    std::atomic<std::uint64_t> ignored_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_LATENCY_STATISTICS_HPP_
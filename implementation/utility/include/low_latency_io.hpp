@@ -0,0 +1,88 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_LOW_LATENCY_IO_HPP
+#define VSOMEIP_V3_LOW_LATENCY_IO_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+// Busy polled io_context for the endpoints of low latency services.
+//
+// The service is attached to the primary io_context of an application that
+// has low latency services configured. It owns an additional io_context that
+// is run by a dedicated thread, which never sleeps in epoll but polls for
+// ready handlers in a loop, optionally pinned to a set of CPUs. Endpoints of
+// the low latency services are created on that io_context, so that their
+// receive handlers (and the message handlers of the application, which are
+// then called inline) run on the polling thread. As the polling thread keeps
+// a CPU busy, it only runs once the polled io_context is used.
+//
+// The same class is attached to the polled io_context to make the
+// SO_BUSY_POLL setting available to the endpoints (see "apply").
+class low_latency_io : public boost::asio::io_context::service {
+public:
+    static boost::asio::io_context::id id;
+
+    explicit low_latency_io(boost::asio::io_context& _io);
+    ~low_latency_io() override;
+
+    // Must be called before "start", before any endpoint is created and
+    // before "get_polled"
+    void configure(const std::set<std::pair<service_t, instance_t>>& _services, const std::set<unsigned>& _cpus,
+                   std::uint32_t _busy_poll);
+
+    // Enables polling, "_name" is used as thread name. The polling thread is
+    // started by "start" or "get_polled", whichever comes last.
+    void start(const std::string& _name);
+    void stop();
+
+    bool is_low_latency(service_t _service, instance_t _instance) const;
+    bool is_polling() const;
+    const std::set<std::pair<service_t, instance_t>>& get_services() const;
+    boost::asio::io_context& get_polled();
+
+    // Sets SO_BUSY_POLL for a socket whose handlers run on "_io", if "_io"
+    // is a polled io_context with a busy poll time.
+    static void apply(boost::asio::io_context& _io, int _native_handle);
+
+private:
+    using work_guard_t = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+    void shutdown() override;
+    void start_unlocked();
+    void poll();
+
+    std::set<std::pair<service_t, instance_t>> services_;
+    std::set<unsigned> cpus_;
+    // microseconds, only set in the service of the polled io_context
+    std::uint32_t busy_poll_;
+
+    std::mutex mutex_;
+    std::string name_;
+    bool is_started_;
+    bool is_used_;
+    std::unique_ptr<boost::asio::io_context> polled_;
+    std::unique_ptr<work_guard_t> work_;
+    std::thread thread_;
+    std::atomic<bool> is_polling_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_LOW_LATENCY_IO_HPP
@@ -0,0 +1,143 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_METRICS_HPP_
+#define VSOMEIP_V3_METRICS_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <vsomeip/structured_types.hpp>
+
+#include "snapshot.hpp"
+
+namespace vsomeip_v3 {
+
+// Number of slots of each set of metric counters
+constexpr std::size_t metric_slot_count = 8;
+
+// Slot used by the calling thread. Threads are assigned round-robin on their
+// first call, so threads only share a slot if there are more than
+// "metric_slot_count" of them.
+std::size_t get_metric_slot();
+
+// Set of counters that many threads update without contending for a cache
+// line: each slot is cache-line aligned and a thread only updates the slot
+// assigned to it. Updates are relaxed atomic operations, reading sums up
+// (or takes the maximum of) the slots.
+template<std::size_t Count_>
+class metric_counters {
+public:
+    metric_counters() {
+        for (auto& s : slots_) {
+            for (auto& v : s.values_) {
+                v.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    metric_counters(const metric_counters&) = delete;
+    metric_counters& operator=(const metric_counters&) = delete;
+
+    void add(std::size_t _counter, std::uint64_t _value = 1) {
+        slots_[get_metric_slot()].values_[_counter].fetch_add(_value, std::memory_order_relaxed);
+    }
+
+    void set_max(std::size_t _counter, std::uint64_t _value) {
+        auto& its_max = slots_[get_metric_slot()].values_[_counter];
+        auto its_current = its_max.load(std::memory_order_relaxed);
+        while (_value > its_current && !its_max.compare_exchange_weak(its_current, _value, std::memory_order_relaxed)) { }
+    }
+
+    std::uint64_t get(std::size_t _counter) const {
+        std::uint64_t its_sum(0);
+        for (const auto& s : slots_) {
+            its_sum += s.values_[_counter].load(std::memory_order_relaxed);
+        }
+        return its_sum;
+    }
+
+    std::uint64_t get_max(std::size_t _counter) const {
+        std::uint64_t its_max(0);
+        for (const auto& s : slots_) {
+            const auto its_value = s.values_[_counter].load(std::memory_order_relaxed);
+            if (its_value > its_max) {
+                its_max = its_value;
+            }
+        }
+        return its_max;
+    }
+
+private:
+    struct alignas(64) slot_t {
+        std::array<std::atomic<std::uint64_t>, Count_> values_;
+    };
+
+    std::array<slot_t, metric_slot_count> slots_;
+};
+
+// Counters of endpoint_impl, see endpoint_metrics_t
+enum endpoint_counter_e : std::size_t {
+    EC_MESSAGES_SENT,
+    EC_BYTES_SENT,
+    EC_MESSAGES_RECEIVED,
+    EC_BYTES_RECEIVED,
+    EC_QUEUE_LIMIT_DROPS,
+    EC_SEND_DROPS,
+    EC_TRAIN_DEPARTURES,
+    EC_RECONNECTS,
+    EC_COUNT
+};
+using endpoint_counters = metric_counters<EC_COUNT>;
+
+// Copies the counters into "_metrics"
+void get_endpoint_metrics(const endpoint_counters& _counters, endpoint_metrics_t& _metrics);
+
+// Counters of the dispatchers of an application, see metrics_t
+enum dispatch_counter_e : std::size_t { DC_DISPATCHED, DC_DISPATCHED_MESSAGES, DC_WAIT_SUM, DC_WAIT_MAX, DC_COUNT };
+using dispatch_counters = metric_counters<DC_COUNT>;
+
+// Messages and bytes per service and instance. The counters of known services
+// are found through a snapshot, so recording does not take a lock. At most
+// "_max_services" services are tracked, further ones are only counted.
+class service_metrics {
+public:
+    explicit service_metrics(std::size_t _max_services);
+
+    void record_sent(service_t _service, instance_t _instance, std::uint32_t _size);
+    void record_received(service_t _service, instance_t _instance, std::uint32_t _size);
+
+    // Ordered by service and instance
+    std::vector<service_metrics_t> get() const;
+    std::uint64_t get_ignored() const;
+
+private:
+    enum counter_e : std::size_t { SC_MESSAGES_SENT, SC_BYTES_SENT, SC_MESSAGES_RECEIVED, SC_BYTES_RECEIVED, SC_COUNT };
+    using counters_t = metric_counters<SC_COUNT>;
+    using counters_map_t = std::map<std::uint32_t, std::shared_ptr<counters_t>>;
+
+    counters_t* find(service_t _service, instance_t _instance);
+
+    const std::size_t max_services_;
+
+    std::mutex mutex_;
+    counters_map_t counters_;
+    snapshot<counters_map_t> snapshot_;
+    std::atomic<std::uint64_t> ignored_;
+};
+
+// Renders the metrics in the Prometheus text exposition format. Each sample
+// is labelled with the application name.
+std::string to_prometheus(const metrics_t& _metrics, const std::string& _application);
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_METRICS_HPP_
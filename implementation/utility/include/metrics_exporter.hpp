@@ -0,0 +1,56 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_METRICS_EXPORTER_HPP_
+#define VSOMEIP_V3_METRICS_EXPORTER_HPP_
+
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+namespace vsomeip_v3 {
+
+// Serves text (the Prometheus rendering of the metrics of an application)
+// on a local stream socket. Each connection is answered with the current
+// text and closed, so any client that reads until EOF can scrape it, e.g.
+// "socat - UNIX-CONNECT:<path>".
+class metrics_exporter : public std::enable_shared_from_this<metrics_exporter> {
+public:
+    using provider_t = std::function<std::string()>;
+
+    metrics_exporter(boost::asio::io_context& _io, const std::string& _path, const provider_t& _provider);
+    ~metrics_exporter();
+
+    // Replaces a stale socket file. Returns false if the socket could not
+    // be bound.
+    bool start();
+    // Closes the socket and removes the socket file
+    void stop();
+
+    const std::string& get_path() const { return path_; }
+
+private:
+    void accept();
+    void on_accept(const std::shared_ptr<boost::asio::local::stream_protocol::socket>& _socket, const boost::system::error_code& _error);
+
+    boost::asio::io_context& io_;
+    const std::string path_;
+    const provider_t provider_;
+
+    std::mutex mutex_;
+    boost::asio::local::stream_protocol::acceptor acceptor_;
+};
+
+} // namespace vsomeip_v3
+
+#endif
+
+#endif // VSOMEIP_V3_METRICS_EXPORTER_HPP_
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_RECEIVE_TIMESTAMP_HPP_
+#define VSOMEIP_V3_RECEIVE_TIMESTAMP_HPP_
+
+#include <chrono>
+
+namespace vsomeip_v3 {
+
+// Receive times of the message that is processed by the current thread.
+//
+// A received message is passed from the endpoint through the routing manager
+// to the application without changing the thread. The endpoints provide the
+// kernel receive time while their receive handler runs and the routing
+// managers add the time at which they got the message, so that the
+// application can pick up both when it queues the message for its handlers.
+// Unknown times are left at the epoch.
+class receive_timestamp {
+public:
+    // The kernel takes its timestamps from CLOCK_REALTIME
+    using socket_time_t = std::chrono::system_clock::time_point;
+    using routing_time_t = std::chrono::steady_clock::time_point;
+
+    class socket_scope {
+    public:
+        explicit socket_scope(socket_time_t _time) : previous_(socket_time_) { socket_time_ = _time; }
+        ~socket_scope() { socket_time_ = previous_; }
+
+        socket_scope(const socket_scope&) = delete;
+        socket_scope& operator=(const socket_scope&) = delete;
+
+    private:
+        const socket_time_t previous_;
+    };
+
+    class routing_scope {
+    public:
+        explicit routing_scope(bool _is_enabled) : previous_(routing_time_) {
+            routing_time_ = (_is_enabled ? std::chrono::steady_clock::now() : routing_time_t());
+        }
+        ~routing_scope() { routing_time_ = previous_; }
+
+        routing_scope(const routing_scope&) = delete;
+        routing_scope& operator=(const routing_scope&) = delete;
+
+    private:
+        const routing_time_t previous_;
+    };
+
+    static socket_time_t get_socket_time() { return socket_time_; }
+    static routing_time_t get_routing_time() { return routing_time_; }
+
+private:
+    static thread_local socket_time_t socket_time_;
+    static thread_local routing_time_t routing_time_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_RECEIVE_TIMESTAMP_HPP_
@@ -0,0 +1,127 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_SNAPSHOT_HPP
+#define VSOMEIP_V3_SNAPSHOT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vsomeip_v3 {
+
+// Slot in which a reader announces the snapshot holder it is about to copy
+// the data out of. Each thread owns at most one slot at a time.
+struct alignas(64) hazard_slot {
+    std::atomic<const void*> pointer_ {nullptr};
+    std::atomic<bool> is_used_ {false};
+    hazard_slot* next_ {nullptr};
+};
+
+// Process wide list of the hazard slots. Slots are claimed on the first read
+// of a thread, released on its exit and reused, but never deleted.
+class hazard_slots {
+public:
+    // Slot of the calling thread
+    static hazard_slot& get();
+
+    // Whether a reader currently announces "_pointer"
+    static bool is_protected(const void* _pointer);
+};
+
+// Immutable, versioned copy of a read-mostly table.
+//
+// Writers keep their own authoritative (mutex protected) data structure and
+// publish a new immutable version after each modification. Readers obtain the
+// current version without touching the writer's mutex and keep it alive for as
+// long as they hold the returned pointer, so a concurrent publish never
+// invalidates a lookup that is in progress.
+//
+// Each instance publishes through an atomic pointer to the holder of the
+// current version (the atomic shared_ptr operations of libstdc++ use a
+// process-wide lock pool). Readers announce the holder in the hazard slot of
+// their thread while they copy the pointer out of it. A replaced holder is
+// retired and deleted by the first publish (or the destructor) that finds it
+// unannounced. Publish never waits for readers; at most one retired holder per
+// reading thread is kept.
+//
+// publish() must be serialized by the caller (typically by calling it while
+// holding the mutex that protects the authoritative data).
+template<typename T>
+class snapshot {
+public:
+    using data_t = T;
+
+    snapshot() : current_(new holder_t {std::make_shared<const T>()}), version_(1) { }
+
+    ~snapshot() {
+        // No reader can be in progress while the snapshot is destroyed
+        for (auto h : retired_) {
+            delete h;
+        }
+        delete current_.load(std::memory_order_relaxed);
+    }
+
+    snapshot(const snapshot&) = delete;
+    snapshot& operator=(const snapshot&) = delete;
+
+    std::shared_ptr<const T> load() const {
+        // Announcing the holder before checking that it is still current (and
+        // the writer exchanging the holder before checking the announcements)
+        // requires a total order of both, hence the sequentially consistent
+        // operations
+        auto& its_slot = hazard_slots::get();
+        holder_t* its_holder = current_.load(std::memory_order_acquire);
+        while (true) {
+            its_slot.pointer_.store(its_holder, std::memory_order_seq_cst);
+            holder_t* its_current = current_.load(std::memory_order_seq_cst);
+            if (its_current == its_holder) {
+                break;
+            }
+            its_holder = its_current;
+        }
+        std::shared_ptr<const T> its_data(its_holder->data_);
+        its_slot.pointer_.store(nullptr, std::memory_order_release);
+        return its_data;
+    }
+
+    void publish(std::shared_ptr<const T> _data) {
+        retired_.push_back(current_.exchange(new holder_t {std::move(_data)}, std::memory_order_seq_cst));
+        version_.fetch_add(1, std::memory_order_release);
+        reclaim();
+    }
+
+    std::uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+private:
+    struct holder_t {
+        std::shared_ptr<const T> data_;
+    };
+
+    // Deletes the retired holders no reader announces, keeps the others
+    // for a later publish
+    void reclaim() {
+        auto its_end = std::remove_if(retired_.begin(), retired_.end(), [](holder_t* _holder) {
+            if (hazard_slots::is_protected(_holder)) {
+                return false;
+            }
+            delete _holder;
+            return true;
+        });
+        retired_.erase(its_end, retired_.end());
+    }
+
+    std::atomic<holder_t*> current_;
+    std::atomic<std::uint64_t> version_;
+
+    // Guarded by the serialization of publish
+    std::vector<holder_t*> retired_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_SNAPSHOT_HPP
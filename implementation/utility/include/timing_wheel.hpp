@@ -0,0 +1,156 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_TIMING_WHEEL_HPP
+#define VSOMEIP_V3_TIMING_WHEEL_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+namespace vsomeip_v3 {
+
+// Hierarchical timing wheel shared by all timers of an io_context.
+//
+// Deadlines are rounded up to the wheel resolution and kept in four levels of
+// slots (256 x 0.1ms, 64 x 25.6ms, 64 x 1.6s, 64 x 105s). Scheduling and
+// cancelling are O(1) and each shard of the wheel is driven by a single asio
+// timer that is armed to the next occupied slot of any level, instead of one
+// asio timer (and one timer queue operation) per object.
+//
+// Timers are distributed over independent shards by their id, each with its
+// own lock, so that threads which (re)schedule the timers of different
+// endpoints rarely wait for each other.
+class timing_wheel : public boost::asio::io_context::service {
+public:
+    using handler_t = std::function<void(const boost::system::error_code&)>;
+    using timer_id_t = std::uint64_t;
+
+    static boost::asio::io_context::id id;
+    static constexpr std::chrono::microseconds resolution {100};
+
+    explicit timing_wheel(boost::asio::io_context& _io);
+    ~timing_wheel() override;
+
+    // Calls "_handler" once "_deadline" is reached. The returned id is
+    // never 0.
+    timer_id_t schedule(std::chrono::steady_clock::time_point _deadline, handler_t _handler);
+
+    // Moves a scheduled handler to "_deadline" without calling it.
+    // Returns false if the handler was already called (or is running).
+    bool reschedule(timer_id_t _id, std::chrono::steady_clock::time_point _deadline);
+
+    // Removes a scheduled handler and posts it with operation_aborted.
+    // Returns false if the handler was already called (or is running).
+    bool cancel(timer_id_t _id);
+
+    std::size_t size() const;
+
+    // Earliest time at which the wheel wakes up, time_point::max() if no
+    // handler is scheduled.
+    std::chrono::steady_clock::time_point get_next_wakeup() const;
+
+private:
+    static constexpr std::size_t shard_count_ = 8;
+    static constexpr std::size_t level0_bits_ = 8;
+    static constexpr std::size_t level_bits_ = 6;
+    static constexpr std::size_t levels_ = 3;
+
+    // Level of an entry: 0 is the finest level, 1..levels_ are the higher
+    // levels and due_level_ marks handlers that are already expired.
+    static constexpr std::size_t due_level_ = levels_ + 1;
+
+    using slot_t = std::vector<timer_id_t>;
+    using level0_bitmap_t = std::array<std::uint64_t, (1 << level0_bits_) / 64>;
+    using level_bitmap_t = std::array<std::uint64_t, (1 << level_bits_) / 64>;
+
+    struct entry_t {
+        std::uint64_t tick_;
+        handler_t handler_;
+        std::size_t level_;
+        std::size_t slot_;
+        std::size_t index_;
+    };
+
+    struct shard_t {
+        explicit shard_t(boost::asio::io_context& _io);
+
+        mutable std::mutex mutex_;
+        boost::asio::steady_timer timer_;
+        std::uint64_t current_tick_;
+        std::uint64_t armed_tick_;
+
+        std::unordered_map<timer_id_t, entry_t> entries_;
+        slot_t due_;
+        std::array<slot_t, (1 << level0_bits_)> level0_;
+        level0_bitmap_t level0_occupied_;
+        std::array<std::array<slot_t, (1 << level_bits_)>, levels_> levels_slots_;
+        std::array<level_bitmap_t, levels_> levels_occupied_;
+    };
+
+    void shutdown() override;
+
+    shard_t& get_shard(timer_id_t _id) const;
+    std::uint64_t to_tick(std::chrono::steady_clock::time_point _time_point, bool _round_up) const;
+
+    bool insert_unlocked(shard_t& _shard, timer_id_t _id, entry_t& _entry, std::uint64_t _now);
+    void place_unlocked(shard_t& _shard, timer_id_t _id, entry_t& _entry);
+    void unlink_unlocked(shard_t& _shard, entry_t& _entry);
+    slot_t& get_slot_unlocked(shard_t& _shard, std::size_t _level, std::size_t _slot);
+    void set_occupied_unlocked(shard_t& _shard, std::size_t _level, std::size_t _slot, bool _is_occupied);
+    void cascade_unlocked(shard_t& _shard, std::size_t _level);
+    void collect_unlocked(shard_t& _shard, std::size_t _level, std::size_t _slot, std::vector<handler_t>& _handlers);
+    std::uint64_t get_next_tick_unlocked(const shard_t& _shard) const;
+    void arm_unlocked(shard_t& _shard);
+
+    void on_timer(shard_t& _shard, const boost::system::error_code& _error);
+    void on_due(shard_t& _shard);
+
+    boost::asio::io_context& io_;
+    const std::chrono::steady_clock::time_point origin_;
+    std::atomic<timer_id_t> last_id_;
+    std::array<std::unique_ptr<shard_t>, shard_count_> shards_;
+};
+
+// Drop-in replacement for the subset of boost::asio::steady_timer that is
+// used for the train dispatch and SD repetition timers. Like steady_timer it
+// is not thread safe, and only one wait may be pending at a time.
+class wheel_timer {
+public:
+    explicit wheel_timer(boost::asio::io_context& _io);
+    ~wheel_timer();
+
+    wheel_timer(const wheel_timer&) = delete;
+    wheel_timer& operator=(const wheel_timer&) = delete;
+
+    void expires_after(std::chrono::steady_clock::duration _duration);
+    void expires_at(std::chrono::steady_clock::time_point _expiry);
+
+    void async_wait(timing_wheel::handler_t _handler);
+    std::size_t cancel();
+
+    // Moves the pending wait to "_expiry", keeping its handler. This is
+    // cheaper than cancel and async_wait, as the aborted handler is neither
+    // posted nor replaced. Returns false if no wait is pending.
+    bool reschedule(std::chrono::steady_clock::time_point _expiry);
+
+private:
+    timing_wheel& wheel_;
+    std::chrono::steady_clock::time_point expiry_;
+    timing_wheel::timer_id_t id_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_TIMING_WHEEL_HPP
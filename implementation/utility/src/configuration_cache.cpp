@@ -0,0 +1,336 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/configuration_cache.hpp"
+#include "../include/json_reader.hpp"
+#include "../include/utility.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <boost/filesystem.hpp>
+
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vsomeip_v3 {
+
+namespace {
+
+constexpr unsigned char cache_magic[4] = {'V', 'S', 'C', 'C'};
+constexpr std::uint32_t cache_version = 2;
+constexpr std::uint32_t cache_byte_order = 0x01020304;
+// magic, version, byte order, element count, hash, stamp
+constexpr std::size_t cache_header_size = 4 + 3 * sizeof(std::uint32_t) + 2 * sizeof(std::uint64_t);
+
+constexpr std::uint64_t fnv_offset = 0xcbf29ce484222325ULL;
+constexpr std::uint64_t fnv_prime = 0x100000001b3ULL;
+
+void fnv(std::uint64_t& _hash, const void* _data, std::size_t _size) {
+    const auto its_data = static_cast<const unsigned char*>(_data);
+    for (std::size_t i = 0; i < _size; ++i) {
+        _hash ^= its_data[i];
+        _hash *= fnv_prime;
+    }
+}
+
+void fnv(std::uint64_t& _hash, const std::string& _value) {
+    const auto its_size = static_cast<std::uint32_t>(_value.size());
+    fnv(_hash, &its_size, sizeof(its_size));
+    fnv(_hash, _value.data(), _value.size());
+}
+
+class writer {
+public:
+    explicit writer(std::vector<unsigned char>& _data) : data_(_data) { }
+
+    template<typename T>
+    void write(T _value) {
+        const auto its_data = reinterpret_cast<const unsigned char*>(&_value);
+        data_.insert(data_.end(), its_data, its_data + sizeof(_value));
+    }
+
+    void write(const std::string& _value) {
+        write(static_cast<std::uint32_t>(_value.size()));
+        data_.insert(data_.end(), _value.begin(), _value.end());
+    }
+
+    void write(const boost::property_tree::ptree& _tree) {
+        write(_tree.data());
+        write(static_cast<std::uint32_t>(_tree.size()));
+        for (const auto& its_child : _tree) {
+            write(its_child.first);
+            write(its_child.second);
+        }
+    }
+
+private:
+    std::vector<unsigned char>& data_;
+};
+
+class reader {
+public:
+    reader(const unsigned char* _data, std::size_t _size) : data_(_data), size_(_size), position_(0) { }
+
+    template<typename T>
+    bool read(T& _value) {
+        if (size_ - position_ < sizeof(_value)) {
+            return false;
+        }
+        std::memcpy(&_value, data_ + position_, sizeof(_value));
+        position_ += sizeof(_value);
+        return true;
+    }
+
+    bool read(std::string& _value) {
+        std::uint32_t its_size(0);
+        if (!read(its_size) || size_ - position_ < its_size) {
+            return false;
+        }
+        _value.assign(reinterpret_cast<const char*>(data_ + position_), its_size);
+        position_ += its_size;
+        return true;
+    }
+
+    bool read(boost::property_tree::ptree& _tree) {
+        std::string its_data;
+        std::uint32_t its_count(0);
+        if (!read(its_data) || !read(its_count)) {
+            return false;
+        }
+        _tree.data() = std::move(its_data);
+        for (std::uint32_t i = 0; i < its_count; ++i) {
+            std::string its_key;
+            if (!read(its_key)) {
+                return false;
+            }
+            auto& its_child = _tree.push_back(std::make_pair(std::move(its_key), boost::property_tree::ptree()))->second;
+            if (!read(its_child)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool skip(std::size_t _size) {
+        if (size_ - position_ < _size) {
+            return false;
+        }
+        position_ += _size;
+        return true;
+    }
+
+private:
+    const unsigned char* data_;
+    std::size_t size_;
+    std::size_t position_;
+};
+
+} // namespace
+
+configuration_cache::configuration_cache() : is_open_(false) { }
+
+configuration_cache::~configuration_cache() {
+    close();
+}
+
+std::vector<std::string> configuration_cache::get_files(const std::set<std::string>& _input) {
+    // Same order as "configuration_impl::read_data"
+    std::vector<std::string> its_files;
+    for (const auto& i : _input) {
+        if (utility::is_file(i)) {
+            its_files.push_back(i);
+        } else if (utility::is_folder(i)) {
+            std::set<std::string> its_names;
+            for (auto j = boost::filesystem::directory_iterator(i); j != boost::filesystem::directory_iterator(); j++) {
+                if (!boost::filesystem::is_directory(j->path())) {
+                    its_names.insert(j->path().string());
+                }
+            }
+            its_files.insert(its_files.end(), its_names.begin(), its_names.end());
+        }
+    }
+    return its_files;
+}
+
+bool configuration_cache::hash(const std::set<std::string>& _input, std::uint64_t& _hash) {
+    _hash = fnv_offset;
+    for (const auto& i : _input) {
+        fnv(_hash, i);
+    }
+    for (const auto& f : get_files(_input)) {
+        std::ifstream its_file(f, std::ios::binary);
+        if (!its_file) {
+            return false;
+        }
+        const std::string its_content{std::istreambuf_iterator<char>(its_file), std::istreambuf_iterator<char>()};
+        fnv(_hash, f);
+        fnv(_hash, its_content);
+    }
+    return true;
+}
+
+bool configuration_cache::stamp(const std::set<std::string>& _input, std::uint64_t& _stamp) {
+    _stamp = fnv_offset;
+    for (const auto& i : _input) {
+        fnv(_stamp, i);
+    }
+    for (const auto& f : get_files(_input)) {
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+        struct stat its_stat;
+        if (::stat(f.c_str(), &its_stat) != 0) {
+            return false;
+        }
+        const std::uint64_t its_metadata[] = {static_cast<std::uint64_t>(its_stat.st_size), static_cast<std::uint64_t>(its_stat.st_mtim.tv_sec),
+                                              static_cast<std::uint64_t>(its_stat.st_mtim.tv_nsec), static_cast<std::uint64_t>(its_stat.st_ino)};
+#else
+        boost::system::error_code its_error;
+        const auto its_size = boost::filesystem::file_size(f, its_error);
+        const auto its_time = boost::filesystem::last_write_time(f, its_error);
+        if (its_error) {
+            return false;
+        }
+        const std::uint64_t its_metadata[] = {static_cast<std::uint64_t>(its_size), static_cast<std::uint64_t>(its_time)};
+#endif
+        fnv(_stamp, f);
+        fnv(_stamp, its_metadata, sizeof(its_metadata));
+    }
+    return true;
+}
+
+bool configuration_cache::create(const std::set<std::string>& _input, const std::string& _path, std::string& _error) {
+    // Stamped before hashing, a file that changes in between invalidates the stamp
+    std::uint64_t its_stamp, its_hash;
+    if (!stamp(_input, its_stamp) || !hash(_input, its_hash)) {
+        _error = "Cannot read the configuration files";
+        return false;
+    }
+
+    std::vector<unsigned char> its_data;
+    writer its_writer(its_data);
+    const auto its_files = get_files(_input);
+    its_data.insert(its_data.end(), std::begin(cache_magic), std::end(cache_magic));
+    its_writer.write(cache_version);
+    its_writer.write(cache_byte_order);
+    its_writer.write(static_cast<std::uint32_t>(its_files.size()));
+    its_writer.write(its_hash);
+    its_writer.write(its_stamp);
+    for (const auto& f : its_files) {
+        // Keeps the policies in the tree, they are converted when read
+        boost::property_tree::ptree its_tree;
+        json_ptree_builder its_builder(its_tree);
+        if (!json_reader::parse_file(f, its_builder, _error)) {
+            return false;
+        }
+        its_writer.write(f);
+        its_writer.write(its_tree);
+    }
+
+    // Replace the image atomically, applications may map it at any time
+    const std::string its_temporary(_path + ".tmp");
+    {
+        std::ofstream its_file(its_temporary, std::ios::binary | std::ios::trunc);
+        its_file.write(reinterpret_cast<const char*>(its_data.data()), static_cast<std::streamsize>(its_data.size()));
+        if (!its_file) {
+            _error = "Cannot write \"" + its_temporary + "\"";
+            return false;
+        }
+    }
+    if (std::rename(its_temporary.c_str(), _path.c_str()) != 0) {
+        _error = "Cannot rename \"" + its_temporary + "\" to \"" + _path + "\"";
+        std::remove(its_temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool configuration_cache::open(const std::string& _path, const std::set<std::string>& _input) {
+    close();
+
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+    const int its_fd = ::open(_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (its_fd == -1) {
+        return false;
+    }
+    struct stat its_stat;
+    if (fstat(its_fd, &its_stat) == 0 && its_stat.st_size > 0) {
+        const auto its_size = static_cast<std::size_t>(its_stat.st_size);
+        void* its_data = mmap(nullptr, its_size, PROT_READ, MAP_PRIVATE, its_fd, 0);
+        if (its_data != MAP_FAILED) {
+            is_open_ = read(static_cast<const unsigned char*>(its_data), its_size, _input);
+            munmap(its_data, its_size);
+        }
+    }
+    ::close(its_fd);
+#else
+    std::ifstream its_file(_path, std::ios::binary);
+    if (its_file) {
+        const std::vector<unsigned char> its_data{std::istreambuf_iterator<char>(its_file), std::istreambuf_iterator<char>()};
+        is_open_ = read(its_data.data(), its_data.size(), _input);
+    }
+#endif
+
+    if (!is_open_) {
+        close();
+    }
+    return is_open_;
+}
+
+bool configuration_cache::read(const unsigned char* _data, std::size_t _size, const std::set<std::string>& _input) {
+    reader its_reader(_data, _size);
+    std::uint32_t its_version(0), its_byte_order(0), its_count(0);
+    std::uint64_t its_hash(0), its_stamp(0), its_current(0);
+    if (_size < cache_header_size || std::memcmp(_data, cache_magic, sizeof(cache_magic)) != 0 || !its_reader.skip(sizeof(cache_magic))
+        || !its_reader.read(its_version) || its_version != cache_version || !its_reader.read(its_byte_order)
+        || its_byte_order != cache_byte_order || !its_reader.read(its_count) || !its_reader.read(its_hash) || !its_reader.read(its_stamp)) {
+        return false;
+    }
+
+    // The contents are only hashed again if the metadata of the files changed
+    const bool is_current = (stamp(_input, its_current) && its_current == its_stamp)
+            || (hash(_input, its_current) && its_current == its_hash);
+    if (!is_current) {
+        return false;
+    }
+
+    elements_.reserve(its_count);
+    for (std::uint32_t i = 0; i < its_count; ++i) {
+        std::string its_name;
+        if (!its_reader.read(its_name)) {
+            return false;
+        }
+        elements_.emplace_back(its_name, boost::property_tree::ptree());
+        if (!its_reader.read(elements_.back().tree_)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void configuration_cache::close() {
+    elements_.clear();
+    is_open_ = false;
+}
+
+bool configuration_cache::get(std::vector<configuration_element>& _elements, const std::function<bool(const std::string&)>& _filter) const {
+    if (!is_open_) {
+        return false;
+    }
+
+    for (const auto& e : elements_) {
+        if (_filter(e.name_)) {
+            _elements.emplace_back(e.name_, e.tree_);
+        }
+    }
+    return true;
+}
+
+} // namespace vsomeip_v3
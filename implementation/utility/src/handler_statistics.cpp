@@ -0,0 +1,166 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/handler_statistics.hpp"
+
+#include <algorithm>
+#include <ctime>
+
+#include <vsomeip/constants.hpp>
+
+namespace vsomeip_v3 {
+
+handler_statistics::handler_statistics(std::size_t _max_methods) : max_methods_(_max_methods), ignored_(0) { }
+
+std::chrono::nanoseconds handler_statistics::get_thread_cpu_time() {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec its_time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &its_time) == 0) {
+        return std::chrono::seconds(its_time.tv_sec) + std::chrono::nanoseconds(its_time.tv_nsec);
+    }
+#endif
+    return std::chrono::nanoseconds(0);
+}
+
+void handler_statistics::record(handler_kind_e _kind, service_t _service, method_t _method, std::chrono::nanoseconds _cpu_time,
+                                std::chrono::nanoseconds _wall_time) {
+    const auto its_kind = static_cast<std::size_t>(_kind);
+    if (its_kind >= kind_count_) {
+        return;
+    }
+    kinds_[its_kind].cpu_time_.record(_cpu_time);
+    kinds_[its_kind].wall_time_.record(_wall_time);
+
+    // Handlers that do not belong to a service are covered by their kind
+    if (_service == ANY_SERVICE && _method == ANY_METHOD) {
+        return;
+    }
+
+    const auto its_key = get_key(_kind, _service, _method);
+    std::shared_ptr<histograms_t> its_histograms;
+    {
+        const auto its_snapshot = snapshot_.load();
+        const auto found_histograms = its_snapshot->find(its_key);
+        if (found_histograms != its_snapshot->end()) {
+            its_histograms = found_histograms->second;
+        }
+    }
+    if (!its_histograms) {
+        its_histograms = add(its_key);
+        if (!its_histograms) {
+            ignored_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    its_histograms->cpu_time_.record(_cpu_time);
+    its_histograms->wall_time_.record(_wall_time);
+}
+
+std::vector<handler_profile_t> handler_statistics::get() const {
+    std::vector<handler_profile_t> its_profiles;
+
+    for (std::size_t i = 0; i < kind_count_; ++i) {
+        handler_profile_t its_profile;
+        if (get(kinds_[i], its_profile)) {
+            its_profile.kind_ = static_cast<handler_kind_e>(i);
+            its_profile.service_ = ANY_SERVICE;
+            its_profile.method_ = ANY_METHOD;
+            its_profiles.emplace_back(std::move(its_profile));
+        }
+    }
+
+    const auto its_snapshot = snapshot_.load();
+    for (const auto& m : *its_snapshot) {
+        handler_profile_t its_profile;
+        if (get(*m.second, its_profile)) {
+            its_profile.kind_ = static_cast<handler_kind_e>(m.first >> 32);
+            its_profile.service_ = static_cast<service_t>(m.first >> 16);
+            its_profile.method_ = static_cast<method_t>(m.first);
+            its_profiles.emplace_back(std::move(its_profile));
+        }
+    }
+    return its_profiles;
+}
+
+std::uint64_t handler_statistics::get_ignored() const {
+    return ignored_.load(std::memory_order_relaxed);
+}
+
+std::vector<handler_profile_t> handler_statistics::get_slowest(const std::vector<handler_profile_t>& _profiles, std::size_t _count) {
+    std::vector<std::pair<std::chrono::nanoseconds, const handler_profile_t*>> its_candidates;
+    for (const auto& p : _profiles) {
+        if (p.service_ != ANY_SERVICE || p.method_ != ANY_METHOD) {
+            its_candidates.emplace_back(latency_histogram::get_percentile(p.wall_time_, 99.0), &p);
+        }
+    }
+
+    const auto its_count = std::min(_count, its_candidates.size());
+    std::partial_sort(its_candidates.begin(), its_candidates.begin() + static_cast<std::ptrdiff_t>(its_count), its_candidates.end(),
+                      [](const auto& _lhs, const auto& _rhs) { return _lhs.first > _rhs.first; });
+
+    std::vector<handler_profile_t> its_slowest;
+    its_slowest.reserve(its_count);
+    for (std::size_t i = 0; i < its_count; ++i) {
+        its_slowest.push_back(*its_candidates[i].second);
+    }
+    return its_slowest;
+}
+
+std::uint64_t handler_statistics::get_key(handler_kind_e _kind, service_t _service, method_t _method) {
+    return (std::uint64_t(_kind) << 32) | (std::uint64_t(_service) << 16) | std::uint64_t(_method);
+}
+
+bool handler_statistics::get(const histograms_t& _histograms, handler_profile_t& _profile) {
+    _profile.cpu_time_ = latency_histogram_t();
+    _profile.wall_time_ = latency_histogram_t();
+    _histograms.cpu_time_.get(_profile.cpu_time_);
+    _histograms.wall_time_.get(_profile.wall_time_);
+    return _profile.wall_time_.count_ > 0;
+}
+
+std::shared_ptr<handler_statistics::histograms_t> handler_statistics::add(std::uint64_t _key) {
+    std::scoped_lock its_lock(mutex_);
+    const auto found_histograms = methods_.find(_key);
+    if (found_histograms != methods_.end()) {
+        return found_histograms->second;
+    }
+    if (methods_.size() >= max_methods_) {
+        return nullptr;
+    }
+
+    auto its_histograms = std::make_shared<histograms_t>();
+    methods_[_key] = its_histograms;
+    snapshot_.publish(std::make_shared<const histograms_map_t>(methods_));
+    return its_histograms;
+}
+
+queue_depth_history::queue_depth_history() : periods_(), current_(0) { }
+
+void queue_depth_history::record(std::size_t _depth, std::chrono::steady_clock::time_point _now) {
+    const auto its_period = std::chrono::time_point_cast<std::chrono::seconds>(_now);
+    auto& its_current = periods_[current_];
+    if (its_current.time_ == its_period) {
+        its_current.max_depth_ = std::max(its_current.max_depth_, _depth);
+        return;
+    }
+
+    current_ = (current_ + 1) % period_count_;
+    periods_[current_].time_ = its_period;
+    periods_[current_].max_depth_ = _depth;
+}
+
+std::vector<dispatch_queue_sample_t> queue_depth_history::get() const {
+    std::vector<dispatch_queue_sample_t> its_samples;
+    its_samples.reserve(period_count_);
+    for (std::size_t i = 1; i <= period_count_; ++i) {
+        const auto& its_period = periods_[(current_ + i) % period_count_];
+        if (its_period.time_ != std::chrono::steady_clock::time_point()) {
+            its_samples.push_back(its_period);
+        }
+    }
+    return its_samples;
+}
+
+} // namespace vsomeip_v3
@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+
+namespace vsomeip_v3 {
+
+namespace {
+
+struct lock_sites_t {
+    std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<lock_site>> sites_;
+};
+
+// Never destroyed, as mutexes with static storage duration may still use
+// their sites during exit
+lock_sites_t& get_lock_sites_instance() {
+    static auto* its_sites = new lock_sites_t;
+    return *its_sites;
+}
+
+// Constant initialized, as operator new may be called before any dynamic
+// initialization of the library
+std::atomic<std::uint64_t> allocations {0};
+thread_local std::uint64_t thread_allocations {0};
+
+} // namespace
+
+lock_site::lock_site(const std::string& _name) : name_(_name) { }
+
+void lock_site::get(lock_site_profile_t& _profile) const {
+    _profile.name_ = name_;
+    _profile.acquisitions_ = acquisitions_.get(0);
+    _profile.wait_time_ = latency_histogram_t();
+    wait_time_.get(_profile.wait_time_);
+}
+
+lock_site& instrumentation::get_lock_site(const std::string& _name) {
+    auto& its_sites = get_lock_sites_instance();
+    std::scoped_lock its_lock(its_sites.mutex_);
+    auto& its_site = its_sites.sites_[_name];
+    if (!its_site) {
+        its_site = std::make_unique<lock_site>(_name);
+    }
+    return *its_site;
+}
+
+std::vector<lock_site_profile_t> instrumentation::get_lock_sites() {
+    std::vector<lock_site_profile_t> its_profiles;
+    {
+        auto& its_sites = get_lock_sites_instance();
+        std::scoped_lock its_lock(its_sites.mutex_);
+        for (const auto& s : its_sites.sites_) {
+            lock_site_profile_t its_profile;
+            s.second->get(its_profile);
+            if (its_profile.acquisitions_ > 0) {
+                its_profiles.emplace_back(std::move(its_profile));
+            }
+        }
+    }
+    std::stable_sort(its_profiles.begin(), its_profiles.end(),
+                     [](const auto& _lhs, const auto& _rhs) { return _lhs.wait_time_.sum_ > _rhs.wait_time_.sum_; });
+    return its_profiles;
+}
+
+void instrumentation::count_allocation() noexcept {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    ++thread_allocations;
+}
+
+std::uint64_t instrumentation::get_allocations() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+std::uint64_t instrumentation::get_thread_allocations() {
+    return thread_allocations;
+}
+
+void instrumentation::dump(std::ostream& _stream, std::size_t _max_sites) {
+    // The durations are cumulative and given in microseconds
+    _stream << "allocations=" << std::dec << get_allocations() << "\n";
+    const auto its_profiles = get_lock_sites();
+    for (std::size_t i = 0; i < its_profiles.size() && i < _max_sites; ++i) {
+        const auto& p = its_profiles[i];
+        _stream << p.name_ << ": #=" << p.acquisitions_ << " contended=" << p.wait_time_.count_
+                << " wait=" << std::chrono::duration_cast<std::chrono::microseconds>(p.wait_time_.sum_).count()
+                << " p99=" << latency_histogram::get_percentile(p.wait_time_, 99.0).count() / 1000
+                << " max=" << std::chrono::duration_cast<std::chrono::microseconds>(p.wait_time_.max_).count() << "\n";
+    }
+}
+
+} // namespace vsomeip_v3
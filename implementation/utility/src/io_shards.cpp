@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/io_shards.hpp"
+
+namespace vsomeip_v3 {
+
+boost::asio::io_context::id io_shards::id;
+
+io_shards::io_shards(boost::asio::io_context& _io) : boost::asio::io_context::service(_io), io_(_io) { }
+
+io_shards::~io_shards() {
+    // The io_contexts are destroyed after the primary one was shut down
+    std::scoped_lock its_lock{mutex_};
+    work_.clear();
+    contexts_.clear();
+}
+
+void io_shards::resize(std::size_t _count) {
+    std::scoped_lock its_lock{mutex_};
+    while (contexts_.size() + 1 < _count) {
+        contexts_.emplace_back(std::make_unique<boost::asio::io_context>(1));
+        work_.emplace_back(contexts_.back()->get_executor());
+    }
+}
+
+std::size_t io_shards::size() const {
+    std::scoped_lock its_lock{mutex_};
+    return contexts_.size() + 1;
+}
+
+boost::asio::io_context& io_shards::at(std::size_t _index) {
+    std::scoped_lock its_lock{mutex_};
+    const std::size_t its_index(_index % (contexts_.size() + 1));
+    return (its_index == 0 ? io_ : *contexts_[its_index - 1]);
+}
+
+void io_shards::restart() {
+    std::scoped_lock its_lock{mutex_};
+    if (work_.empty()) {
+        for (const auto& c : contexts_) {
+            c->restart();
+            work_.emplace_back(c->get_executor());
+        }
+    }
+}
+
+void io_shards::stop() {
+    std::scoped_lock its_lock{mutex_};
+    work_.clear();
+    for (const auto& c : contexts_) {
+        c->stop();
+    }
+}
+
+boost::asio::io_context& io_shards::select(boost::asio::io_context& _io, std::size_t _key) {
+    if (!boost::asio::has_service<io_shards>(_io)) {
+        return _io;
+    }
+    return boost::asio::use_service<io_shards>(_io).at(_key);
+}
+
+void io_shards::shutdown() {
+    stop();
+}
+
+} // namespace vsomeip_v3
@@ -0,0 +1,465 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/json_reader.hpp"
+
+#include <fstream>
+#include <iterator>
+
+namespace vsomeip_v3 {
+
+namespace {
+
+// Protects the stack against malicious input, configurations are far less deep
+constexpr std::size_t max_depth = 256;
+
+class parser {
+public:
+    parser(const char* _data, std::size_t _size, json_reader::handler& _handler) :
+        cur_(_data), begin_(_data), end_(_data + _size), handler_(_handler), error_(nullptr) { }
+
+    bool parse() {
+        // Same as boost::property_tree::read_json, which skips a UTF-8 BOM
+        // without checking it
+        if (cur_ != end_ && static_cast<unsigned char>(*cur_) == 0xef) {
+            cur_ += (end_ - cur_ < 3 ? end_ - cur_ : 3);
+        }
+        skip_ws();
+        bool is_valid = parse_value(0);
+        if (is_valid) {
+            skip_ws();
+            if (cur_ != end_) {
+                is_valid = fail("garbage after data");
+            }
+        }
+        return is_valid;
+    }
+
+    const char* get_error() const { return error_; }
+
+    std::size_t get_line() const {
+        std::size_t its_line(1);
+        for (auto c = begin_; c != cur_ && c != end_; ++c) {
+            if (*c == '\n') {
+                its_line++;
+            }
+        }
+        return its_line;
+    }
+
+private:
+    bool fail(const char* _error) {
+        error_ = _error;
+        return false;
+    }
+
+    void skip_ws() {
+        while (cur_ != end_ && (*cur_ == ' ' || *cur_ == '\t' || *cur_ == '\n' || *cur_ == '\r')) {
+            ++cur_;
+        }
+    }
+
+    bool have(char _c) {
+        if (cur_ != end_ && *cur_ == _c) {
+            ++cur_;
+            return true;
+        }
+        return false;
+    }
+
+    bool parse_value(std::size_t _depth) {
+        if (cur_ == end_) {
+            return fail("expected value");
+        }
+        switch (*cur_) {
+        case '{':
+            return parse_object(_depth);
+        case '[':
+            return parse_array(_depth);
+        case '"':
+            if (!parse_string()) {
+                return false;
+            }
+            handler_.on_value(buffer_);
+            return true;
+        case 't':
+            return parse_literal("true");
+        case 'f':
+            return parse_literal("false");
+        case 'n':
+            return parse_literal("null");
+        default:
+            return parse_number();
+        }
+    }
+
+    bool parse_object(std::size_t _depth) {
+        if (_depth == max_depth) {
+            return fail("nesting too deep");
+        }
+        ++cur_;
+        handler_.on_object_begin();
+        skip_ws();
+        if (have('}')) {
+            handler_.on_object_end();
+            return true;
+        }
+        do {
+            skip_ws();
+            if (cur_ == end_ || *cur_ != '"') {
+                return fail("expected key string");
+            }
+            if (!parse_string()) {
+                return false;
+            }
+            handler_.on_key(buffer_);
+            skip_ws();
+            if (!have(':')) {
+                return fail("expected ':'");
+            }
+            skip_ws();
+            if (!parse_value(_depth + 1)) {
+                return false;
+            }
+            skip_ws();
+        } while (have(','));
+        if (!have('}')) {
+            return fail("expected '}' or ','");
+        }
+        handler_.on_object_end();
+        return true;
+    }
+
+    bool parse_array(std::size_t _depth) {
+        if (_depth == max_depth) {
+            return fail("nesting too deep");
+        }
+        ++cur_;
+        handler_.on_array_begin();
+        skip_ws();
+        if (have(']')) {
+            handler_.on_array_end();
+            return true;
+        }
+        do {
+            skip_ws();
+            if (!parse_value(_depth + 1)) {
+                return false;
+            }
+            skip_ws();
+        } while (have(','));
+        if (!have(']')) {
+            return fail("expected ']' or ','");
+        }
+        handler_.on_array_end();
+        return true;
+    }
+
+    bool parse_literal(const char* _literal) {
+        const char* its_begin(cur_);
+        for (const char* c = _literal; *c != '\0'; ++c) {
+            if (!have(*c)) {
+                return fail("expected literal");
+            }
+        }
+        buffer_.assign(its_begin, cur_);
+        handler_.on_value(buffer_);
+        return true;
+    }
+
+    bool is_digit() const { return cur_ != end_ && *cur_ >= '0' && *cur_ <= '9'; }
+
+    void skip_digits() {
+        while (is_digit()) {
+            ++cur_;
+        }
+    }
+
+    bool parse_number() {
+        const char* its_begin(cur_);
+        const bool has_minus(have('-'));
+        if (!have('0')) {
+            if (!is_digit()) {
+                return fail(has_minus ? "expected digits after -" : "expected value");
+            }
+            skip_digits();
+        }
+        if (have('.')) {
+            if (!is_digit()) {
+                return fail("need at least one digit after '.'");
+            }
+            skip_digits();
+        }
+        if (have('e') || have('E')) {
+            if (!have('+')) {
+                have('-');
+            }
+            if (!is_digit()) {
+                return fail("need at least one digit in exponent");
+            }
+            skip_digits();
+        }
+        buffer_.assign(its_begin, cur_);
+        handler_.on_value(buffer_);
+        return true;
+    }
+
+    bool parse_hex_quad(unsigned& _codepoint) {
+        _codepoint = 0;
+        for (int i = 0; i < 4; ++i, ++cur_) {
+            if (cur_ == end_) {
+                return fail("invalid escape sequence");
+            }
+            const char c(*cur_);
+            unsigned its_value;
+            if (c >= '0' && c <= '9') {
+                its_value = static_cast<unsigned>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                its_value = static_cast<unsigned>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                its_value = static_cast<unsigned>(c - 'A' + 10);
+            } else {
+                return fail("invalid escape sequence");
+            }
+            _codepoint = _codepoint * 16 + its_value;
+        }
+        return true;
+    }
+
+    void append_codepoint(unsigned _codepoint) {
+        if (_codepoint <= 0x7f) {
+            buffer_ += static_cast<char>(_codepoint);
+        } else if (_codepoint <= 0x7ff) {
+            buffer_ += static_cast<char>(0xc0 | (_codepoint >> 6));
+            buffer_ += static_cast<char>(0x80 | (_codepoint & 0x3f));
+        } else if (_codepoint <= 0xffff) {
+            buffer_ += static_cast<char>(0xe0 | (_codepoint >> 12));
+            buffer_ += static_cast<char>(0x80 | ((_codepoint >> 6) & 0x3f));
+            buffer_ += static_cast<char>(0x80 | (_codepoint & 0x3f));
+        } else {
+            buffer_ += static_cast<char>(0xf0 | (_codepoint >> 18));
+            buffer_ += static_cast<char>(0x80 | ((_codepoint >> 12) & 0x3f));
+            buffer_ += static_cast<char>(0x80 | ((_codepoint >> 6) & 0x3f));
+            buffer_ += static_cast<char>(0x80 | (_codepoint & 0x3f));
+        }
+    }
+
+    bool parse_escape() {
+        if (cur_ == end_) {
+            return fail("invalid escape sequence");
+        }
+        switch (*cur_++) {
+        case '"':
+            buffer_ += '"';
+            return true;
+        case '\\':
+            buffer_ += '\\';
+            return true;
+        case '/':
+            buffer_ += '/';
+            return true;
+        case 'b':
+            buffer_ += '\b';
+            return true;
+        case 'f':
+            buffer_ += '\f';
+            return true;
+        case 'n':
+            buffer_ += '\n';
+            return true;
+        case 'r':
+            buffer_ += '\r';
+            return true;
+        case 't':
+            buffer_ += '\t';
+            return true;
+        case 'u':
+            break;
+        default:
+            return fail("invalid escape sequence");
+        }
+
+        unsigned its_codepoint;
+        if (!parse_hex_quad(its_codepoint)) {
+            return false;
+        }
+        if ((its_codepoint & 0xfc00) == 0xdc00) {
+            return fail("invalid codepoint, stray low surrogate");
+        }
+        if ((its_codepoint & 0xfc00) == 0xd800) {
+            if (!have('\\')) {
+                return fail("invalid codepoint, stray high surrogate");
+            }
+            if (!have('u')) {
+                return fail("expected codepoint reference after high surrogate");
+            }
+            unsigned its_low;
+            if (!parse_hex_quad(its_low)) {
+                return false;
+            }
+            if ((its_low & 0xfc00) != 0xdc00) {
+                return fail("expected low surrogate after high surrogate");
+            }
+            its_codepoint = 0x10000 + (((its_codepoint & 0x3ff) << 10) | (its_low & 0x3ff));
+        }
+        append_codepoint(its_codepoint);
+        return true;
+    }
+
+    // Unescapes into "buffer_", plain runs are appended in one piece
+    bool parse_string() {
+        buffer_.clear();
+        ++cur_;
+        const char* its_run(cur_);
+        while (true) {
+            if (cur_ == end_) {
+                return fail("unterminated string");
+            }
+            const auto c = static_cast<unsigned char>(*cur_);
+            if (c == '"') {
+                buffer_.append(its_run, cur_);
+                ++cur_;
+                return true;
+            }
+            if (c == '\\') {
+                buffer_.append(its_run, cur_);
+                ++cur_;
+                if (!parse_escape()) {
+                    return false;
+                }
+                its_run = cur_;
+            } else if (c < 0x20) {
+                return fail("invalid code sequence");
+            } else if (c <= 0x7f) {
+                ++cur_;
+            } else {
+                int its_trailing(-1);
+                if ((c & 0xe0) == 0xc0) {
+                    its_trailing = 1;
+                } else if ((c & 0xf0) == 0xe0) {
+                    its_trailing = 2;
+                } else if ((c & 0xf8) == 0xf0) {
+                    its_trailing = 3;
+                }
+                if (its_trailing == -1) {
+                    return fail("invalid code sequence");
+                }
+                ++cur_;
+                for (int i = 0; i < its_trailing; ++i, ++cur_) {
+                    if (cur_ == end_ || (static_cast<unsigned char>(*cur_) & 0xc0) != 0x80) {
+                        return fail("invalid code sequence");
+                    }
+                }
+            }
+        }
+    }
+
+    const char* cur_;
+    const char* begin_;
+    const char* end_;
+    json_reader::handler& handler_;
+    const char* error_;
+    std::string buffer_;
+};
+
+} // namespace
+
+bool json_reader::parse(const char* _data, std::size_t _size, handler& _handler, std::string& _error) {
+    parser its_parser(_data, _size, _handler);
+    if (!its_parser.parse()) {
+        _error = "<unspecified file>(" + std::to_string(its_parser.get_line()) + "): " + its_parser.get_error();
+        return false;
+    }
+    return true;
+}
+
+bool json_reader::parse_file(const std::string& _path, handler& _handler, std::string& _error) {
+    std::ifstream its_file(_path, std::ios::binary);
+    if (!its_file) {
+        _error = _path + ": cannot open file";
+        return false;
+    }
+    const std::string its_content{std::istreambuf_iterator<char>(its_file), std::istreambuf_iterator<char>()};
+    parser its_parser(its_content.data(), its_content.size(), _handler);
+    if (!its_parser.parse()) {
+        // Same format as boost::property_tree::json_parser_error
+        _error = _path + "(" + std::to_string(its_parser.get_line()) + "): " + its_parser.get_error();
+        return false;
+    }
+    return true;
+}
+
+json_ptree_builder::json_ptree_builder(boost::property_tree::ptree& _tree) : root_(_tree), split_depth_(0) { }
+
+json_ptree_builder::json_ptree_builder(boost::property_tree::ptree& _tree, const std::vector<std::string>& _split_path,
+                                       element_handler_t _on_element) :
+    root_(_tree), split_path_(_split_path), on_element_(std::move(_on_element)), split_depth_(0) { }
+
+boost::property_tree::ptree& json_ptree_builder::add_child() {
+    if (stack_.empty()) {
+        return root_;
+    }
+    if (split_depth_ != 0 && stack_.size() == split_depth_) {
+        element_.clear();
+        return element_;
+    }
+    // Array elements are added with an empty key, like read_json does
+    return stack_.back()->push_back(std::make_pair(key_, boost::property_tree::ptree()))->second;
+}
+
+void json_ptree_builder::end_child() {
+    stack_.pop_back();
+    if (!path_.empty()) {
+        path_.pop_back();
+    }
+    if (split_depth_ != 0) {
+        if (stack_.size() == split_depth_) {
+            on_element_(element_);
+            element_.clear();
+        } else if (stack_.size() < split_depth_) {
+            split_depth_ = 0;
+        }
+    }
+}
+
+void json_ptree_builder::on_object_begin() {
+    auto& its_child = add_child();
+    if (!stack_.empty()) {
+        path_.push_back(key_);
+    }
+    key_.clear();
+    stack_.push_back(&its_child);
+}
+
+void json_ptree_builder::on_object_end() {
+    end_child();
+}
+
+void json_ptree_builder::on_array_begin() {
+    on_object_begin();
+    if (split_depth_ == 0 && !split_path_.empty() && path_ == split_path_) {
+        split_depth_ = stack_.size();
+    }
+}
+
+void json_ptree_builder::on_array_end() {
+    end_child();
+}
+
+void json_ptree_builder::on_key(const std::string& _key) {
+    key_ = _key;
+}
+
+void json_ptree_builder::on_value(const std::string& _value) {
+    auto& its_child = add_child();
+    its_child.data() = _value;
+    key_.clear();
+    if (split_depth_ != 0 && stack_.size() == split_depth_) {
+        on_element_(element_);
+        element_.clear();
+    }
+}
+
+} // namespace vsomeip_v3
@@ -0,0 +1,173 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/latency_statistics.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace vsomeip_v3 {
+
+namespace {
+
+unsigned get_most_significant_bit(std::uint64_t _word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - static_cast<unsigned>(__builtin_clzll(_word));
+#else
+    unsigned its_bit(0);
+    while (_word >>= 1) {
+        its_bit++;
+    }
+    return its_bit;
+#endif
+}
+
+} // namespace
+
+latency_histogram::latency_histogram() : count_(0), sum_(0), min_(std::numeric_limits<std::uint64_t>::max()), max_(0) {
+    for (auto& b : buckets_) {
+        b.store(0, std::memory_order_relaxed);
+    }
+}
+
+void latency_histogram::record(std::chrono::nanoseconds _latency) {
+    // A clock that was set back must not be counted as a huge latency
+    const auto its_latency = static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(_latency.count(), 0));
+
+    buckets_[get_index(its_latency)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(its_latency, std::memory_order_relaxed);
+
+    auto its_min = min_.load(std::memory_order_relaxed);
+    while (its_latency < its_min && !min_.compare_exchange_weak(its_min, its_latency, std::memory_order_relaxed)) { }
+    auto its_max = max_.load(std::memory_order_relaxed);
+    while (its_latency > its_max && !max_.compare_exchange_weak(its_max, its_latency, std::memory_order_relaxed)) { }
+}
+
+void latency_histogram::get(latency_histogram_t& _histogram) const {
+    _histogram.count_ = 0;
+    _histogram.buckets_.clear();
+    for (std::size_t i = 0; i < bucket_count_; ++i) {
+        const auto its_count = buckets_[i].load(std::memory_order_relaxed);
+        if (its_count > 0) {
+            _histogram.buckets_.emplace_back(std::chrono::nanoseconds(get_upper_bound(i)), its_count);
+            // Sum of the buckets, so that the percentiles match the count
+            _histogram.count_ += its_count;
+        }
+    }
+    _histogram.sum_ = std::chrono::nanoseconds(sum_.load(std::memory_order_relaxed));
+    _histogram.max_ = std::chrono::nanoseconds(max_.load(std::memory_order_relaxed));
+    _histogram.min_ = (_histogram.count_ > 0 ? std::chrono::nanoseconds(min_.load(std::memory_order_relaxed)) : std::chrono::nanoseconds(0));
+}
+
+std::size_t latency_histogram::get_index(std::uint64_t _latency) {
+    if (_latency < (1u << sub_bucket_bits_)) {
+        return static_cast<std::size_t>(_latency);
+    }
+    if (_latency >= (std::uint64_t(1) << max_bits_)) {
+        return bucket_count_ - 1;
+    }
+
+    const unsigned its_msb = get_most_significant_bit(_latency);
+    const unsigned its_shift = its_msb - sub_bucket_bits_;
+    return (static_cast<std::size_t>(its_shift + 1) << sub_bucket_bits_)
+            + static_cast<std::size_t>((_latency >> its_shift) & ((1u << sub_bucket_bits_) - 1));
+}
+
+std::uint64_t latency_histogram::get_upper_bound(std::size_t _index) {
+    if (_index < (1u << sub_bucket_bits_)) {
+        return _index;
+    }
+
+    const unsigned its_shift = static_cast<unsigned>(_index >> sub_bucket_bits_) - 1;
+    const std::uint64_t its_lower = ((std::uint64_t(1) << sub_bucket_bits_) | (_index & ((1u << sub_bucket_bits_) - 1))) << its_shift;
+    return its_lower + (std::uint64_t(1) << its_shift) - 1;
+}
+
+std::chrono::nanoseconds latency_histogram::get_percentile(const latency_histogram_t& _histogram, double _percentile) {
+    const auto its_rank = static_cast<std::uint64_t>(static_cast<double>(_histogram.count_) * _percentile / 100.0);
+    std::uint64_t its_count(0);
+    for (const auto& b : _histogram.buckets_) {
+        its_count += b.second;
+        if (its_count > its_rank) {
+            return std::min(b.first, _histogram.max_);
+        }
+    }
+    return _histogram.max_;
+}
+
+latency_statistics::latency_statistics(std::size_t _max_methods) : max_methods_(_max_methods), ignored_(0) { }
+
+void latency_statistics::record(service_t _service, instance_t _instance, method_t _method, latency_stage_e _stage,
+                                std::chrono::nanoseconds _latency) {
+    const auto its_stage = static_cast<std::size_t>(_stage);
+    if (its_stage >= stage_count_) {
+        return;
+    }
+
+    const auto its_key = get_key(_service, _instance, _method);
+    std::shared_ptr<stages_t> its_stages;
+    {
+        const auto its_snapshot = snapshot_.load();
+        const auto found_stages = its_snapshot->find(its_key);
+        if (found_stages != its_snapshot->end()) {
+            its_stages = found_stages->second;
+        }
+    }
+    if (!its_stages) {
+        its_stages = add(its_key);
+        if (!its_stages) {
+            ignored_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    its_stages->histograms_[its_stage].record(_latency);
+}
+
+std::vector<latency_histogram_t> latency_statistics::get() const {
+    std::vector<latency_histogram_t> its_histograms;
+
+    const auto its_snapshot = snapshot_.load();
+    for (const auto& s : *its_snapshot) {
+        for (std::size_t i = 0; i < stage_count_; ++i) {
+            latency_histogram_t its_histogram;
+            s.second->histograms_[i].get(its_histogram);
+            if (its_histogram.count_ > 0) {
+                its_histogram.service_ = static_cast<service_t>(s.first >> 32);
+                its_histogram.instance_ = static_cast<instance_t>(s.first >> 16);
+                its_histogram.method_ = static_cast<method_t>(s.first);
+                its_histogram.stage_ = static_cast<latency_stage_e>(i);
+                its_histograms.emplace_back(std::move(its_histogram));
+            }
+        }
+    }
+    return its_histograms;
+}
+
+std::uint64_t latency_statistics::get_ignored() const {
+    return ignored_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t latency_statistics::get_key(service_t _service, instance_t _instance, method_t _method) {
+    return (std::uint64_t(_service) << 32) | (std::uint64_t(_instance) << 16) | std::uint64_t(_method);
+}
+
+std::shared_ptr<latency_statistics::stages_t> latency_statistics::add(std::uint64_t _key) {
+    std::scoped_lock its_lock(mutex_);
+    const auto found_stages = stages_.find(_key);
+    if (found_stages != stages_.end()) {
+        return found_stages->second;
+    }
+    if (stages_.size() >= max_methods_) {
+        return nullptr;
+    }
+
+    auto its_stages = std::make_shared<stages_t>();
+    stages_[_key] = its_stages;
+    snapshot_.publish(std::make_shared<const stages_map_t>(stages_));
+    return its_stages;
+}
+
+} // namespace vsomeip_v3
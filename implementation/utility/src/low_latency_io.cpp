@@ -0,0 +1,165 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/low_latency_io.hpp"
+
+#if defined(__linux__) || defined(ANDROID)
+#include <cerrno>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/socket.h>
+#endif
+
+#include <vsomeip/internal/logger.hpp>
+
+namespace vsomeip_v3 {
+
+boost::asio::io_context::id low_latency_io::id;
+
+low_latency_io::low_latency_io(boost::asio::io_context& _io) :
+    boost::asio::io_context::service(_io), busy_poll_(0), is_started_(false), is_used_(false), is_polling_(false) { }
+
+low_latency_io::~low_latency_io() {
+    stop();
+    // The polled io_context is destroyed after the primary one was shut down
+    std::scoped_lock its_lock{mutex_};
+    work_.reset();
+    polled_.reset();
+}
+
+void low_latency_io::configure(const std::set<std::pair<service_t, instance_t>>& _services, const std::set<unsigned>& _cpus,
+                               std::uint32_t _busy_poll) {
+    std::scoped_lock its_lock{mutex_};
+    services_ = _services;
+    cpus_ = _cpus;
+    if (!polled_) {
+        polled_ = std::make_unique<boost::asio::io_context>(1);
+    }
+    boost::asio::use_service<low_latency_io>(*polled_).busy_poll_ = _busy_poll;
+}
+
+void low_latency_io::start(const std::string& _name) {
+    std::thread its_stopped;
+    {
+        std::scoped_lock its_lock{mutex_};
+        if (is_polling_) {
+            return;
+        }
+        its_stopped = std::move(thread_);
+    }
+    if (its_stopped.joinable()) {
+        its_stopped.join();
+    }
+
+    std::scoped_lock its_lock{mutex_};
+    name_ = _name;
+    is_started_ = true;
+    if (is_used_) {
+        start_unlocked();
+    }
+}
+
+void low_latency_io::stop() {
+    std::thread its_thread;
+    {
+        std::scoped_lock its_lock{mutex_};
+        is_started_ = false;
+        is_polling_ = false;
+        work_.reset();
+        if (polled_) {
+            polled_->stop();
+        }
+        // If stopped by a handler on the polling thread, the thread is
+        // joined by the next call to "start" or "stop"
+        if (thread_.get_id() != std::this_thread::get_id()) {
+            its_thread = std::move(thread_);
+        }
+    }
+    if (its_thread.joinable()) {
+        its_thread.join();
+    }
+}
+
+bool low_latency_io::is_low_latency(service_t _service, instance_t _instance) const {
+    return services_.find(std::make_pair(_service, _instance)) != services_.end();
+}
+
+bool low_latency_io::is_polling() const {
+    return is_polling_;
+}
+
+const std::set<std::pair<service_t, instance_t>>& low_latency_io::get_services() const {
+    return services_;
+}
+
+boost::asio::io_context& low_latency_io::get_polled() {
+    std::scoped_lock its_lock{mutex_};
+    is_used_ = true;
+    if (is_started_) {
+        start_unlocked();
+    }
+    return *polled_;
+}
+
+void low_latency_io::apply(boost::asio::io_context& _io, int _native_handle) {
+#if defined(__linux__) || defined(ANDROID)
+    if (!boost::asio::has_service<low_latency_io>(_io)) {
+        return;
+    }
+    const int its_busy_poll = static_cast<int>(boost::asio::use_service<low_latency_io>(_io).busy_poll_);
+    if (its_busy_poll > 0 && setsockopt(_native_handle, SOL_SOCKET, SO_BUSY_POLL, &its_busy_poll, sizeof(its_busy_poll)) == -1) {
+        VSOMEIP_WARNING << "low_latency_io: could not setsockopt(SO_BUSY_POLL), errno " << errno;
+    }
+#else
+    (void)_io;
+    (void)_native_handle;
+#endif
+}
+
+void low_latency_io::shutdown() {
+    stop();
+}
+
+void low_latency_io::start_unlocked() {
+    if (!polled_ || is_polling_) {
+        return;
+    }
+
+    polled_->restart();
+    work_ = std::make_unique<work_guard_t>(polled_->get_executor());
+    is_polling_ = true;
+    thread_ = std::thread([this, its_name = name_] {
+#if defined(__linux__) || defined(ANDROID)
+        pthread_setname_np(pthread_self(), its_name.c_str());
+        if (!cpus_.empty()) {
+            cpu_set_t its_cpus;
+            CPU_ZERO(&its_cpus);
+            for (const auto c : cpus_) {
+                CPU_SET(c, &its_cpus);
+            }
+            const int its_error = pthread_setaffinity_np(pthread_self(), sizeof(its_cpus), &its_cpus);
+            if (its_error != 0) {
+                VSOMEIP_WARNING << "low_latency_io: could not set the cpu affinity, error " << its_error;
+            }
+        }
+#else
+        (void)its_name;
+#endif
+        poll();
+    });
+}
+
+void low_latency_io::poll() {
+    // Never blocks, the receive handlers run as soon as the data is available
+    while (is_polling_) {
+        try {
+            polled_->poll();
+        } catch (const std::exception& e) {
+            VSOMEIP_ERROR << "low_latency_io::poll caught exception: " << e.what();
+        }
+    }
+}
+
+} // namespace vsomeip_v3
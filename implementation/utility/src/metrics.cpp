@@ -0,0 +1,207 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/metrics.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+#include <vsomeip/constants.hpp>
+
+namespace vsomeip_v3 {
+
+namespace {
+
+std::string escape_label(const std::string& _value) {
+    std::string its_value;
+    its_value.reserve(_value.size());
+    for (const char c : _value) {
+        if (c == '\\' || c == '"') {
+            its_value += '\\';
+            its_value += c;
+        } else if (c == '\n') {
+            its_value += "\\n";
+        } else {
+            its_value += c;
+        }
+    }
+    return its_value;
+}
+
+std::string get_endpoint_labels(const endpoint_metrics_t& _endpoint) {
+    std::stringstream its_labels;
+    its_labels << ",protocol=\"" << (_endpoint.is_local_ ? "local" : (_endpoint.is_reliable_ ? "tcp" : "udp")) << "\""
+               << ",role=\"" << (_endpoint.is_client_ ? "client" : "server") << "\""
+               << ",local_port=\"" << std::dec << _endpoint.local_port_ << "\"";
+    if (_endpoint.is_local_ && _endpoint.client_ != ILLEGAL_CLIENT) {
+        its_labels << ",peer=\"" << std::hex << std::setfill('0') << std::setw(4) << _endpoint.client_ << "\"";
+    } else if (!_endpoint.remote_address_.empty()) {
+        its_labels << ",peer=\"" << escape_label(_endpoint.remote_address_) << ":" << std::dec << _endpoint.remote_port_ << "\"";
+    }
+    return its_labels.str();
+}
+
+std::string get_service_labels(const service_metrics_t& _service) {
+    std::stringstream its_labels;
+    its_labels << std::hex << std::setfill('0') << ",service=\"" << std::setw(4) << _service.service_ << "\",instance=\"" << std::setw(4)
+               << _service.instance_ << "\"";
+    return its_labels.str();
+}
+
+double to_seconds(std::chrono::nanoseconds _duration) {
+    return static_cast<double>(_duration.count()) / 1e9;
+}
+
+} // namespace
+
+std::size_t get_metric_slot() {
+    static std::atomic<std::size_t> its_next_slot {0};
+    static thread_local const std::size_t its_slot = its_next_slot.fetch_add(1, std::memory_order_relaxed) % metric_slot_count;
+    return its_slot;
+}
+
+void get_endpoint_metrics(const endpoint_counters& _counters, endpoint_metrics_t& _metrics) {
+    _metrics.messages_sent_ = _counters.get(EC_MESSAGES_SENT);
+    _metrics.bytes_sent_ = _counters.get(EC_BYTES_SENT);
+    _metrics.messages_received_ = _counters.get(EC_MESSAGES_RECEIVED);
+    _metrics.bytes_received_ = _counters.get(EC_BYTES_RECEIVED);
+    _metrics.queue_limit_drops_ = _counters.get(EC_QUEUE_LIMIT_DROPS);
+    _metrics.send_drops_ = _counters.get(EC_SEND_DROPS);
+    _metrics.train_departures_ = _counters.get(EC_TRAIN_DEPARTURES);
+    _metrics.reconnects_ = _counters.get(EC_RECONNECTS);
+}
+
+service_metrics::service_metrics(std::size_t _max_services) : max_services_(_max_services), ignored_(0) { }
+
+void service_metrics::record_sent(service_t _service, instance_t _instance, std::uint32_t _size) {
+    auto its_counters = find(_service, _instance);
+    if (its_counters) {
+        its_counters->add(SC_MESSAGES_SENT);
+        its_counters->add(SC_BYTES_SENT, _size);
+    }
+}
+
+void service_metrics::record_received(service_t _service, instance_t _instance, std::uint32_t _size) {
+    auto its_counters = find(_service, _instance);
+    if (its_counters) {
+        its_counters->add(SC_MESSAGES_RECEIVED);
+        its_counters->add(SC_BYTES_RECEIVED, _size);
+    }
+}
+
+std::vector<service_metrics_t> service_metrics::get() const {
+    std::vector<service_metrics_t> its_metrics;
+
+    const auto its_snapshot = snapshot_.load();
+    its_metrics.reserve(its_snapshot->size());
+    for (const auto& c : *its_snapshot) {
+        service_metrics_t its_service;
+        its_service.service_ = static_cast<service_t>(c.first >> 16);
+        its_service.instance_ = static_cast<instance_t>(c.first);
+        its_service.messages_sent_ = c.second->get(SC_MESSAGES_SENT);
+        its_service.bytes_sent_ = c.second->get(SC_BYTES_SENT);
+        its_service.messages_received_ = c.second->get(SC_MESSAGES_RECEIVED);
+        its_service.bytes_received_ = c.second->get(SC_BYTES_RECEIVED);
+        its_metrics.push_back(its_service);
+    }
+    return its_metrics;
+}
+
+std::uint64_t service_metrics::get_ignored() const {
+    return ignored_.load(std::memory_order_relaxed);
+}
+
+service_metrics::counters_t* service_metrics::find(service_t _service, instance_t _instance) {
+    const std::uint32_t its_key((std::uint32_t(_service) << 16) | _instance);
+    {
+        // The counters are never removed, so they outlive the snapshot
+        const auto its_snapshot = snapshot_.load();
+        const auto found_counters = its_snapshot->find(its_key);
+        if (found_counters != its_snapshot->end()) {
+            return found_counters->second.get();
+        }
+    }
+
+    std::scoped_lock its_lock(mutex_);
+    const auto found_counters = counters_.find(its_key);
+    if (found_counters != counters_.end()) {
+        return found_counters->second.get();
+    }
+    if (counters_.size() >= max_services_) {
+        ignored_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    auto its_counters = std::make_shared<counters_t>();
+    counters_[its_key] = its_counters;
+    snapshot_.publish(std::make_shared<const counters_map_t>(counters_));
+    return its_counters.get();
+}
+
+std::string to_prometheus(const metrics_t& _metrics, const std::string& _application) {
+    std::stringstream its_text;
+    const std::string its_application("application=\"" + escape_label(_application) + "\"");
+
+    auto write_endpoint_family = [&](const char* _name, const char* _type, const char* _help,
+                                     std::uint64_t (*_value)(const endpoint_metrics_t&)) {
+        its_text << "# HELP " << _name << " " << _help << "\n# TYPE " << _name << " " << _type << "\n";
+        for (const auto& e : _metrics.endpoints_) {
+            its_text << _name << "{" << its_application << get_endpoint_labels(e) << "} " << std::dec << _value(e) << "\n";
+        }
+    };
+    write_endpoint_family("vsomeip_endpoint_queue_bytes", "gauge", "Bytes waiting to be sent.",
+                          [](const endpoint_metrics_t& _e) { return static_cast<std::uint64_t>(_e.queue_size_); });
+    write_endpoint_family("vsomeip_endpoint_messages_sent_total", "counter", "Messages written to the socket.",
+                          [](const endpoint_metrics_t& _e) { return _e.messages_sent_; });
+    write_endpoint_family("vsomeip_endpoint_bytes_sent_total", "counter", "Bytes written to the socket.",
+                          [](const endpoint_metrics_t& _e) { return _e.bytes_sent_; });
+    write_endpoint_family("vsomeip_endpoint_messages_received_total", "counter", "Messages received.",
+                          [](const endpoint_metrics_t& _e) { return _e.messages_received_; });
+    write_endpoint_family("vsomeip_endpoint_bytes_received_total", "counter", "Bytes received.",
+                          [](const endpoint_metrics_t& _e) { return _e.bytes_received_; });
+    write_endpoint_family("vsomeip_endpoint_queue_limit_drops_total", "counter", "Messages dropped because the queue limit was reached.",
+                          [](const endpoint_metrics_t& _e) { return _e.queue_limit_drops_; });
+    write_endpoint_family("vsomeip_endpoint_send_drops_total", "counter", "Queued messages dropped because of a send error or a restart.",
+                          [](const endpoint_metrics_t& _e) { return _e.send_drops_; });
+    write_endpoint_family("vsomeip_endpoint_train_departures_total", "counter", "Trains handed to the socket.",
+                          [](const endpoint_metrics_t& _e) { return _e.train_departures_; });
+    write_endpoint_family("vsomeip_endpoint_reconnects_total", "counter", "Failed connection attempts.",
+                          [](const endpoint_metrics_t& _e) { return _e.reconnects_; });
+
+    auto write_service_family = [&](const char* _name, const char* _help, std::uint64_t (*_value)(const service_metrics_t&)) {
+        its_text << "# HELP " << _name << " " << _help << "\n# TYPE " << _name << " counter\n";
+        for (const auto& s : _metrics.services_) {
+            its_text << _name << "{" << its_application << get_service_labels(s) << "} " << std::dec << _value(s) << "\n";
+        }
+    };
+    write_service_family("vsomeip_service_messages_sent_total", "Messages sent by the application.",
+                         [](const service_metrics_t& _s) { return _s.messages_sent_; });
+    write_service_family("vsomeip_service_bytes_sent_total", "Bytes sent by the application.",
+                         [](const service_metrics_t& _s) { return _s.bytes_sent_; });
+    write_service_family("vsomeip_service_messages_received_total", "Messages received by the application.",
+                         [](const service_metrics_t& _s) { return _s.messages_received_; });
+    write_service_family("vsomeip_service_bytes_received_total", "Bytes received by the application.",
+                         [](const service_metrics_t& _s) { return _s.bytes_received_; });
+
+    auto write_value = [&](const char* _name, const char* _type, const char* _help, auto _value) {
+        its_text << "# HELP " << _name << " " << _help << "\n# TYPE " << _name << " " << _type << "\n"
+                 << _name << "{" << its_application << "} " << _value << "\n";
+    };
+    write_value("vsomeip_dispatched_total", "counter", "Handlers called by the dispatchers.", _metrics.dispatched_);
+    write_value("vsomeip_dispatched_messages_total", "counter", "Message handlers called by the dispatchers.",
+                _metrics.dispatched_messages_);
+    write_value("vsomeip_dispatch_wait_seconds_total", "counter", "Time the dispatched message handlers spent queued.",
+                to_seconds(_metrics.dispatch_wait_sum_));
+    write_value("vsomeip_dispatch_wait_max_seconds", "gauge", "Longest time a message handler spent queued.",
+                to_seconds(_metrics.dispatch_wait_max_));
+    write_value("vsomeip_dispatch_queue_size", "gauge", "Handlers waiting for a dispatcher.", _metrics.dispatch_queue_size_);
+    write_value("vsomeip_sd_messages_sent_total", "counter", "Service discovery messages sent.", _metrics.sd_messages_sent_);
+    write_value("vsomeip_sd_messages_received_total", "counter", "Service discovery messages received.",
+                _metrics.sd_messages_received_);
+
+    return its_text.str();
+}
+
+} // namespace vsomeip_v3
@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/metrics_exporter.hpp"
+
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+
+#include <unistd.h>
+
+#include <boost/asio/write.hpp>
+
+#include <vsomeip/internal/logger.hpp>
+
+namespace vsomeip_v3 {
+
+metrics_exporter::metrics_exporter(boost::asio::io_context& _io, const std::string& _path, const provider_t& _provider) :
+    io_(_io), path_(_path), provider_(_provider), acceptor_(_io) { }
+
+metrics_exporter::~metrics_exporter() {
+    stop();
+}
+
+bool metrics_exporter::start() {
+    std::scoped_lock its_lock(mutex_);
+    if (acceptor_.is_open()) {
+        return true;
+    }
+
+    boost::system::error_code its_error;
+    ::unlink(path_.c_str());
+    acceptor_.open(boost::asio::local::stream_protocol(), its_error);
+    if (!its_error) {
+        acceptor_.bind(boost::asio::local::stream_protocol::endpoint(path_), its_error);
+    }
+    if (!its_error) {
+        acceptor_.listen(boost::asio::socket_base::max_listen_connections, its_error);
+    }
+    if (its_error) {
+        VSOMEIP_ERROR << "metrics_exporter::" << __func__ << ": Cannot listen on " << path_ << " (" << its_error.message() << ")";
+        acceptor_.close(its_error);
+        return false;
+    }
+
+    VSOMEIP_INFO << "metrics_exporter::" << __func__ << ": Serving metrics on " << path_;
+    accept();
+    return true;
+}
+
+void metrics_exporter::stop() {
+    std::scoped_lock its_lock(mutex_);
+    if (acceptor_.is_open()) {
+        boost::system::error_code its_error;
+        acceptor_.close(its_error);
+        ::unlink(path_.c_str());
+    }
+}
+
+void metrics_exporter::accept() {
+    auto its_socket = std::make_shared<boost::asio::local::stream_protocol::socket>(io_);
+    acceptor_.async_accept(*its_socket, [self = shared_from_this(), its_socket](const boost::system::error_code& _error) {
+        self->on_accept(its_socket, _error);
+    });
+}
+
+void metrics_exporter::on_accept(const std::shared_ptr<boost::asio::local::stream_protocol::socket>& _socket,
+                                 const boost::system::error_code& _error) {
+    if (_error == boost::asio::error::operation_aborted) {
+        return;
+    }
+
+    if (!_error) {
+        auto its_text = std::make_shared<std::string>(provider_());
+        boost::asio::async_write(*_socket, boost::asio::buffer(*its_text),
+                                 [_socket, its_text](const boost::system::error_code&, std::size_t) {
+                                     boost::system::error_code its_error;
+                                     _socket->shutdown(boost::asio::socket_base::shutdown_both, its_error);
+                                     _socket->close(its_error);
+                                 });
+    }
+
+    std::scoped_lock its_lock(mutex_);
+    if (acceptor_.is_open()) {
+        accept();
+    }
+}
+
+} // namespace vsomeip_v3
+
+#endif
@@ -0,0 +1,13 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/receive_timestamp.hpp"
+
+namespace vsomeip_v3 {
+
+thread_local receive_timestamp::socket_time_t receive_timestamp::socket_time_;
+thread_local receive_timestamp::routing_time_t receive_timestamp::routing_time_;
+
+} // namespace vsomeip_v3
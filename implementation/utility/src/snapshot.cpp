@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../include/snapshot.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+
+// Constant initialized, as snapshots with static storage duration may be
+// read during dynamic initialization
+std::atomic<hazard_slot*> first_slot {nullptr};
+
+hazard_slot* claim_slot() {
+    for (auto s = first_slot.load(std::memory_order_acquire); s != nullptr; s = s->next_) {
+        bool is_used(false);
+        if (!s->is_used_.load(std::memory_order_relaxed)
+            && s->is_used_.compare_exchange_strong(is_used, true, std::memory_order_acquire)) {
+            return s;
+        }
+    }
+
+    // Never deleted, as writers may scan the slots at any time
+    auto its_slot = new hazard_slot;
+    its_slot->is_used_.store(true, std::memory_order_relaxed);
+    auto its_first = first_slot.load(std::memory_order_relaxed);
+    do {
+        its_slot->next_ = its_first;
+    } while (!first_slot.compare_exchange_weak(its_first, its_slot, std::memory_order_release, std::memory_order_relaxed));
+    return its_slot;
+}
+
+struct slot_owner {
+    slot_owner() : slot_(claim_slot()) { }
+    ~slot_owner() {
+        slot_->pointer_.store(nullptr, std::memory_order_relaxed);
+        slot_->is_used_.store(false, std::memory_order_release);
+    }
+
+    hazard_slot* slot_;
+};
+
+} // namespace
+
+hazard_slot& hazard_slots::get() {
+    thread_local slot_owner its_owner;
+    return *its_owner.slot_;
+}
+
+bool hazard_slots::is_protected(const void* _pointer) {
+    for (auto s = first_slot.load(std::memory_order_acquire); s != nullptr; s = s->next_) {
+        if (s->pointer_.load(std::memory_order_seq_cst) == _pointer) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace vsomeip_v3
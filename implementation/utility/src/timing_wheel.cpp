@@ -0,0 +1,484 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/asio/post.hpp>
+
+#include "../include/timing_wheel.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+
+std::size_t count_trailing_zeros(std::uint64_t _word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(_word));
+#else
+    std::size_t its_count(0);
+    while ((_word & 1) == 0) {
+        _word >>= 1;
+        its_count++;
+    }
+    return its_count;
+#endif
+}
+
+// Returns the distance from "_start" to the next set bit, searching
+// circularly, or the number of bits if no bit is set.
+template<std::size_t N>
+std::size_t find_next_set(const std::array<std::uint64_t, N>& _bitmap, std::size_t _start) {
+
+    constexpr std::size_t its_bits(N * 64);
+    std::size_t its_distance(0);
+    while (its_distance < its_bits) {
+        const std::size_t its_position = (_start + its_distance) % its_bits;
+        const std::uint64_t its_word = _bitmap[its_position / 64] >> (its_position % 64);
+        if (its_word != 0) {
+            return its_distance + count_trailing_zeros(its_word);
+        }
+        its_distance += 64 - (its_position % 64);
+    }
+    return its_bits;
+}
+}
+
+boost::asio::io_context::id timing_wheel::id;
+
+timing_wheel::shard_t::shard_t(boost::asio::io_context& _io) :
+    timer_(_io), current_tick_(0), armed_tick_(std::numeric_limits<std::uint64_t>::max()), level0_occupied_ {}, levels_occupied_ {} { }
+
+timing_wheel::timing_wheel(boost::asio::io_context& _io) :
+    boost::asio::io_context::service(_io), io_(_io), origin_(std::chrono::steady_clock::now()), last_id_(0) {
+
+    for (auto& s : shards_) {
+        s = std::make_unique<shard_t>(_io);
+    }
+}
+
+timing_wheel::~timing_wheel() = default;
+
+timing_wheel::timer_id_t timing_wheel::schedule(std::chrono::steady_clock::time_point _deadline, handler_t _handler) {
+
+    const timer_id_t its_id = ++last_id_;
+    auto& its_shard = get_shard(its_id);
+
+    bool must_post(false);
+    {
+        std::lock_guard<std::mutex> its_lock(its_shard.mutex_);
+
+        const std::uint64_t its_now = to_tick(std::chrono::steady_clock::now(), false);
+        if (its_shard.entries_.empty()) {
+            // Nothing is pending, so there is nothing to catch up with
+            its_shard.current_tick_ = its_now;
+        }
+
+        auto& its_entry = its_shard.entries_[its_id];
+        its_entry.handler_ = std::move(_handler);
+        its_entry.tick_ = to_tick(_deadline, true);
+        must_post = insert_unlocked(its_shard, its_id, its_entry, its_now);
+    }
+
+    if (must_post) {
+        boost::asio::post(io_, [this, &its_shard]() { on_due(its_shard); });
+    }
+    return its_id;
+}
+
+bool timing_wheel::reschedule(timer_id_t _id, std::chrono::steady_clock::time_point _deadline) {
+
+    auto& its_shard = get_shard(_id);
+
+    bool must_post(false);
+    {
+        std::lock_guard<std::mutex> its_lock(its_shard.mutex_);
+        auto found_entry = its_shard.entries_.find(_id);
+        if (found_entry == its_shard.entries_.end()) {
+            return false;
+        }
+
+        auto& its_entry = found_entry->second;
+        const std::uint64_t its_tick = to_tick(_deadline, true);
+        if (its_tick == its_entry.tick_ && its_entry.level_ != due_level_) {
+            // Same slot, nothing to do
+            return true;
+        }
+
+        unlink_unlocked(its_shard, its_entry);
+        its_entry.tick_ = its_tick;
+        must_post = insert_unlocked(its_shard, _id, its_entry, to_tick(std::chrono::steady_clock::now(), false));
+    }
+
+    if (must_post) {
+        boost::asio::post(io_, [this, &its_shard]() { on_due(its_shard); });
+    }
+    return true;
+}
+
+bool timing_wheel::cancel(timer_id_t _id) {
+
+    auto& its_shard = get_shard(_id);
+
+    handler_t its_handler;
+    {
+        std::lock_guard<std::mutex> its_lock(its_shard.mutex_);
+        auto found_entry = its_shard.entries_.find(_id);
+        if (found_entry == its_shard.entries_.end()) {
+            return false;
+        }
+        unlink_unlocked(its_shard, found_entry->second);
+        its_handler = std::move(found_entry->second.handler_);
+        its_shard.entries_.erase(found_entry);
+
+        if (its_shard.entries_.empty() && its_shard.armed_tick_ != std::numeric_limits<std::uint64_t>::max()) {
+            // Do not keep the io_context busy with a wait for nothing
+            its_shard.armed_tick_ = std::numeric_limits<std::uint64_t>::max();
+            boost::system::error_code its_error;
+            its_shard.timer_.cancel(its_error);
+        }
+    }
+
+    boost::asio::post(io_, [its_handler = std::move(its_handler)]() { its_handler(boost::asio::error::operation_aborted); });
+    return true;
+}
+
+std::size_t timing_wheel::size() const {
+
+    std::size_t its_size(0);
+    for (const auto& s : shards_) {
+        std::lock_guard<std::mutex> its_lock(s->mutex_);
+        its_size += s->entries_.size();
+    }
+    return its_size;
+}
+
+std::chrono::steady_clock::time_point timing_wheel::get_next_wakeup() const {
+
+    std::uint64_t its_tick(std::numeric_limits<std::uint64_t>::max());
+    for (const auto& s : shards_) {
+        std::lock_guard<std::mutex> its_lock(s->mutex_);
+        if (!s->due_.empty()) {
+            its_tick = std::min(its_tick, s->current_tick_);
+        } else if (s->entries_.size() > 0) {
+            its_tick = std::min(its_tick, s->armed_tick_);
+        }
+    }
+
+    if (its_tick == std::numeric_limits<std::uint64_t>::max()) {
+        return std::chrono::steady_clock::time_point::max();
+    }
+    return origin_ + resolution * static_cast<std::chrono::microseconds::rep>(its_tick);
+}
+
+void timing_wheel::shutdown() {
+
+    // Handlers must be destroyed without holding the lock, as they may own
+    // objects that cancel their timers on destruction
+    for (auto& s : shards_) {
+        std::unordered_map<timer_id_t, entry_t> its_entries;
+        {
+            std::lock_guard<std::mutex> its_lock(s->mutex_);
+            its_entries.swap(s->entries_);
+            s->due_.clear();
+            for (auto& l : s->level0_) {
+                l.clear();
+            }
+            s->level0_occupied_.fill(0);
+            for (auto& l : s->levels_slots_) {
+                for (auto& t : l) {
+                    t.clear();
+                }
+            }
+            for (auto& l : s->levels_occupied_) {
+                l.fill(0);
+            }
+            s->armed_tick_ = std::numeric_limits<std::uint64_t>::max();
+            boost::system::error_code its_error;
+            s->timer_.cancel(its_error);
+        }
+    }
+}
+
+timing_wheel::shard_t& timing_wheel::get_shard(timer_id_t _id) const {
+    return *shards_[_id % shard_count_];
+}
+
+std::uint64_t timing_wheel::to_tick(std::chrono::steady_clock::time_point _time_point, bool _round_up) const {
+
+    if (_time_point <= origin_) {
+        return 0;
+    }
+
+    const auto its_elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(_time_point - origin_).count();
+    const auto its_resolution = std::chrono::duration_cast<std::chrono::nanoseconds>(resolution).count();
+    auto its_tick = static_cast<std::uint64_t>(its_elapsed / its_resolution);
+    if (_round_up && its_elapsed % its_resolution != 0) {
+        its_tick++;
+    }
+    return its_tick;
+}
+
+bool timing_wheel::insert_unlocked(shard_t& _shard, timer_id_t _id, entry_t& _entry, std::uint64_t _now) {
+
+    if (_entry.tick_ <= _now) {
+        // Already expired, run it from the io_context as soon as possible
+        _entry.tick_ = _shard.current_tick_;
+        _entry.level_ = due_level_;
+        _entry.slot_ = 0;
+        _entry.index_ = _shard.due_.size();
+        _shard.due_.push_back(_id);
+        return (_shard.due_.size() == 1);
+    }
+
+    place_unlocked(_shard, _id, _entry);
+    if (_entry.tick_ < _shard.armed_tick_) {
+        arm_unlocked(_shard);
+    }
+    return false;
+}
+
+void timing_wheel::place_unlocked(shard_t& _shard, timer_id_t _id, entry_t& _entry) {
+
+    const std::uint64_t its_delta = (_entry.tick_ > _shard.current_tick_ ? _entry.tick_ - _shard.current_tick_ : 0);
+
+    if (its_delta < (std::uint64_t(1) << level0_bits_)) {
+        _entry.level_ = 0;
+        _entry.slot_ = static_cast<std::size_t>(_entry.tick_ & ((1 << level0_bits_) - 1));
+    } else {
+        for (std::size_t l = 1; l <= levels_; ++l) {
+            const std::size_t its_shift = level0_bits_ + (l - 1) * level_bits_;
+            std::uint64_t its_tick = _entry.tick_;
+            if (its_delta >= (std::uint64_t(1) << (its_shift + level_bits_))) {
+                if (l < levels_) {
+                    continue;
+                }
+                // Beyond the wheel: park it in the last level, it is
+                // placed again when that slot is cascaded
+                its_tick = _shard.current_tick_ + (std::uint64_t(1) << (its_shift + level_bits_)) - 1;
+            }
+            _entry.level_ = l;
+            _entry.slot_ = static_cast<std::size_t>((its_tick >> its_shift) & ((1 << level_bits_) - 1));
+            break;
+        }
+    }
+
+    slot_t& its_slot = get_slot_unlocked(_shard, _entry.level_, _entry.slot_);
+    _entry.index_ = its_slot.size();
+    its_slot.push_back(_id);
+    if (its_slot.size() == 1) {
+        set_occupied_unlocked(_shard, _entry.level_, _entry.slot_, true);
+    }
+}
+
+void timing_wheel::unlink_unlocked(shard_t& _shard, entry_t& _entry) {
+
+    slot_t& its_slot = get_slot_unlocked(_shard, _entry.level_, _entry.slot_);
+    if (_entry.index_ + 1 != its_slot.size()) {
+        const timer_id_t its_moved = its_slot.back();
+        its_slot[_entry.index_] = its_moved;
+        _shard.entries_[its_moved].index_ = _entry.index_;
+    }
+    its_slot.pop_back();
+    if (its_slot.empty()) {
+        set_occupied_unlocked(_shard, _entry.level_, _entry.slot_, false);
+    }
+}
+
+timing_wheel::slot_t& timing_wheel::get_slot_unlocked(shard_t& _shard, std::size_t _level, std::size_t _slot) {
+
+    if (_level == 0) {
+        return _shard.level0_[_slot];
+    }
+    if (_level == due_level_) {
+        return _shard.due_;
+    }
+    return _shard.levels_slots_[_level - 1][_slot];
+}
+
+void timing_wheel::set_occupied_unlocked(shard_t& _shard, std::size_t _level, std::size_t _slot, bool _is_occupied) {
+
+    std::uint64_t* its_word(nullptr);
+    if (_level == 0) {
+        its_word = &_shard.level0_occupied_[_slot / 64];
+    } else if (_level != due_level_) {
+        its_word = &_shard.levels_occupied_[_level - 1][_slot / 64];
+    } else {
+        return;
+    }
+
+    if (_is_occupied) {
+        *its_word |= (std::uint64_t(1) << (_slot % 64));
+    } else {
+        *its_word &= ~(std::uint64_t(1) << (_slot % 64));
+    }
+}
+
+void timing_wheel::cascade_unlocked(shard_t& _shard, std::size_t _level) {
+
+    const std::size_t its_shift = level0_bits_ + (_level - 1) * level_bits_;
+    const auto its_index = static_cast<std::size_t>((_shard.current_tick_ >> its_shift) & ((1 << level_bits_) - 1));
+
+    slot_t its_ids;
+    its_ids.swap(_shard.levels_slots_[_level - 1][its_index]);
+    set_occupied_unlocked(_shard, _level, its_index, false);
+    for (const auto its_id : its_ids) {
+        place_unlocked(_shard, its_id, _shard.entries_[its_id]);
+    }
+}
+
+void timing_wheel::collect_unlocked(shard_t& _shard, std::size_t _level, std::size_t _slot, std::vector<handler_t>& _handlers) {
+
+    slot_t& its_slot = get_slot_unlocked(_shard, _level, _slot);
+    for (const auto its_id : its_slot) {
+        auto found_entry = _shard.entries_.find(its_id);
+        _handlers.push_back(std::move(found_entry->second.handler_));
+        _shard.entries_.erase(found_entry);
+    }
+    its_slot.clear();
+    set_occupied_unlocked(_shard, _level, _slot, false);
+}
+
+std::uint64_t timing_wheel::get_next_tick_unlocked(const shard_t& _shard) const {
+
+    // Entries of the first level are less than one rotation ahead, so the
+    // next occupied slot is the next expiry. For the higher levels, the next
+    // tick is the beginning of the next occupied slot, where its entries are
+    // cascaded.
+    std::uint64_t its_next(std::numeric_limits<std::uint64_t>::max());
+
+    const std::uint64_t its_first = _shard.current_tick_ + 1;
+    const std::size_t its_distance = find_next_set(_shard.level0_occupied_, static_cast<std::size_t>(its_first & ((1 << level0_bits_) - 1)));
+    if (its_distance < (1 << level0_bits_)) {
+        its_next = its_first + its_distance;
+    }
+
+    for (std::size_t l = 1; l <= levels_; ++l) {
+        const std::size_t its_shift = level0_bits_ + (l - 1) * level_bits_;
+        const std::uint64_t its_slot = (_shard.current_tick_ >> its_shift) + 1;
+        const std::size_t its_slot_distance =
+                find_next_set(_shard.levels_occupied_[l - 1], static_cast<std::size_t>(its_slot & ((1 << level_bits_) - 1)));
+        if (its_slot_distance < (1 << level_bits_)) {
+            its_next = std::min(its_next, (its_slot + its_slot_distance) << its_shift);
+        }
+    }
+
+    return its_next;
+}
+
+void timing_wheel::arm_unlocked(shard_t& _shard) {
+
+    const std::uint64_t its_tick = get_next_tick_unlocked(_shard);
+    if (its_tick == std::numeric_limits<std::uint64_t>::max()) {
+        _shard.armed_tick_ = its_tick;
+        return;
+    }
+
+    if (its_tick != _shard.armed_tick_) {
+        _shard.armed_tick_ = its_tick;
+        _shard.timer_.expires_at(origin_ + resolution * static_cast<std::chrono::microseconds::rep>(its_tick));
+        _shard.timer_.async_wait([this, &_shard](const boost::system::error_code& _error) { on_timer(_shard, _error); });
+    }
+}
+
+void timing_wheel::on_timer(shard_t& _shard, const boost::system::error_code& _error) {
+
+    if (_error) {
+        return;
+    }
+
+    std::vector<handler_t> its_handlers;
+    {
+        std::lock_guard<std::mutex> its_lock(_shard.mutex_);
+        const std::uint64_t its_now = to_tick(std::chrono::steady_clock::now(), false);
+
+        // Jump from one occupied slot to the next instead of visiting every
+        // tick, so a far deadline does not cause a wake up per rotation.
+        while (true) {
+            const std::uint64_t its_next = get_next_tick_unlocked(_shard);
+            if (its_next > its_now) {
+                // Nothing happens before its_next, so all slots keep their
+                // position relative to the current time
+                _shard.current_tick_ = std::max(_shard.current_tick_, its_now);
+                break;
+            }
+
+            _shard.current_tick_ = its_next;
+            const auto its_index = static_cast<std::size_t>(its_next & ((1 << level0_bits_) - 1));
+            if (its_index == 0) {
+                for (std::size_t l = 1; l <= levels_; ++l) {
+                    cascade_unlocked(_shard, l);
+                    if (((its_next >> (level0_bits_ + (l - 1) * level_bits_)) & ((1 << level_bits_) - 1)) != 0) {
+                        break;
+                    }
+                }
+            }
+            collect_unlocked(_shard, 0, its_index, its_handlers);
+        }
+
+        _shard.armed_tick_ = std::numeric_limits<std::uint64_t>::max();
+        arm_unlocked(_shard);
+    }
+
+    for (const auto& h : its_handlers) {
+        h(boost::system::error_code());
+    }
+}
+
+void timing_wheel::on_due(shard_t& _shard) {
+
+    std::vector<handler_t> its_handlers;
+    {
+        std::lock_guard<std::mutex> its_lock(_shard.mutex_);
+        collect_unlocked(_shard, due_level_, 0, its_handlers);
+    }
+
+    for (const auto& h : its_handlers) {
+        h(boost::system::error_code());
+    }
+}
+
+wheel_timer::wheel_timer(boost::asio::io_context& _io) : wheel_(boost::asio::use_service<timing_wheel>(_io)), id_(0) { }
+
+wheel_timer::~wheel_timer() {
+    cancel();
+}
+
+void wheel_timer::expires_after(std::chrono::steady_clock::duration _duration) {
+    expires_at(std::chrono::steady_clock::now() + _duration);
+}
+
+void wheel_timer::expires_at(std::chrono::steady_clock::time_point _expiry) {
+    cancel();
+    expiry_ = _expiry;
+}
+
+void wheel_timer::async_wait(timing_wheel::handler_t _handler) {
+    id_ = wheel_.schedule(expiry_, std::move(_handler));
+}
+
+std::size_t wheel_timer::cancel() {
+
+    std::size_t its_cancelled(0);
+    if (id_ != 0) {
+        if (wheel_.cancel(id_)) {
+            its_cancelled = 1;
+        }
+        id_ = 0;
+    }
+    return its_cancelled;
+}
+
+bool wheel_timer::reschedule(std::chrono::steady_clock::time_point _expiry) {
+
+    if (id_ == 0 || !wheel_.reschedule(id_, _expiry)) {
+        id_ = 0;
+        return false;
+    }
+    expiry_ = _expiry;
+    return true;
+}
+
+} // namespace vsomeip_v3
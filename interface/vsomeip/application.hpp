@@ -1103,6 +1103,101 @@ public:
      * \return policy_manager shared pointer
      */
     virtual std::shared_ptr<policy_manager> get_policy_manager() const = 0;
+
+    /**
+     *
+     * \brief Fire several event or field notifications at once.
+     *
+     * Behaves like calling @ref notify for each entry, in order, but all
+     * events are resolved from the same routing state. If this application
+     * hosts the routing, the notifications to remote subscribers are
+     * grouped per target and each group is added to the target's nPDU
+     * train under one endpoint lock, so that the dispatch timer of a
+     * target is restarted only once per batch.
+     *
+     * \param _notifications Service, instance, event and payload of each
+     * notification.
+     * \param _force Forces the notifications (see @ref notify).
+     *
+     * \return One entry per notification, set to true if the event is known
+     * and provided by this application and the payload was accepted as an
+     * update, i.e. it was not dropped because it did not change the field
+     * or event (see @ref notify).
+     *
+     */
+    virtual std::vector<bool> notify_batch(const std::vector<notification_t>& _notifications, bool _force = false) const = 0;
+
+    /**
+     *
+     * \brief Get the receive latency histograms of the received messages.
+     *
+     * Requires the latency statistics to be enabled in the logging
+     * statistics configuration ("latency"). The latencies of each message
+     * are split into the time from the kernel receive timestamp of the
+     * socket to the routing manager (only if "socket-timestamps" is
+     * enabled and this application hosts the routing), from the routing
+     * manager to the dispatcher queue of this application and from the
+     * queue to the call of the message handler.
+     *
+     * \return One histogram per service, instance, method and stage that
+     * has samples, accumulated since the application was initialized.
+     * Empty if the latency statistics are disabled.
+     *
+     */
+    virtual std::vector<latency_histogram_t> get_latency_histograms() const = 0;
+
+    /**
+     *
+     * \brief Get the runtime metrics of the application.
+     *
+     * The counters are always recorded. They cover the endpoints of the
+     * application (queue depth, messages and bytes sent and received,
+     * messages dropped because of the queue limit, train departures and
+     * reconnects), the messages sent and received per service instance,
+     * the dispatcher queue and, for the routing manager host, the service
+     * discovery messages. At most "max-services" service instances of the
+     * logging statistics configuration are counted.
+     *
+     * If "metrics-socket" is configured, the metrics are additionally
+     * served in the Prometheus text format on a local socket.
+     *
+     * \return The metrics accumulated since the application was
+     * initialized.
+     *
+     */
+    virtual metrics_t get_metrics() const = 0;
+
+    /**
+     *
+     * \brief Get the durations of the handlers called by the dispatchers.
+     *
+     * Requires the handler profiling to be enabled in the logging
+     * statistics configuration ("handler-profiling"). Each handler call is
+     * measured in CPU time of the dispatcher thread and in wall time. The
+     * routing manager host adds the slowest handlers ("slow-handlers") to
+     * its status log.
+     *
+     * \return One profile per kind of handler followed by one profile per
+     * kind, service and method, each accumulated since the application was
+     * initialized. At most "max-messages" services and methods are
+     * profiled. Empty if the handler profiling is disabled.
+     *
+     */
+    virtual std::vector<handler_profile_t> get_handler_profiles() const = 0;
+
+    /**
+     *
+     * \brief Get the recent depths of the dispatcher queue.
+     *
+     * Requires the handler profiling to be enabled. The depth is sampled
+     * whenever messages are queued and whenever a dispatcher takes the next
+     * handler.
+     *
+     * \return The maximum depth of each of the last 60 seconds in which
+     * the queue was sampled, oldest first.
+     *
+     */
+    virtual std::vector<dispatch_queue_sample_t> get_dispatch_queue_history() const = 0;
 };
 
 /** @} */
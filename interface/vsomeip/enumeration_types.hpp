@@ -91,6 +91,24 @@ enum class endianess_e {
     le // little-endian
 };
 
+// Processing stages of a received message (see application::get_latency_histograms)
+enum class latency_stage_e : uint8_t {
+    LS_SOCKET_TO_ROUTING = 0x00, // kernel receive timestamp until the routing manager got the message
+    LS_ROUTING_TO_QUEUE = 0x01, // routing manager until the message was queued for the handlers
+    LS_QUEUE_TO_HANDLER = 0x02 // queued until a message handler was invoked
+};
+
+// Kinds of handlers called by the dispatchers (see application::get_handler_profiles)
+enum class handler_kind_e : uint8_t {
+    HK_MESSAGE = 0x00,
+    HK_AVAILABILITY = 0x01,
+    HK_STATE = 0x02,
+    HK_SUBSCRIPTION = 0x03,
+    HK_OFFERED_SERVICES_INFO = 0x04,
+    HK_WATCHDOG = 0x05,
+    HK_OTHER = 0x06
+};
+
 } // namespace vsomeip_v3
 
 #endif // VSOMEIP_V3_ENUMERATION_TYPES_HPP_
@@ -6,12 +6,16 @@
 #ifndef VSOMEIP_V3_LOGGER_HPP_
 #define VSOMEIP_V3_LOGGER_HPP_
 
+#include <array>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <mutex>
 #include <ostream>
 #include <sstream>
 #include <streambuf>
+#include <string>
+#include <type_traits>
 
 #include <vsomeip/export.hpp>
 
@@ -46,18 +50,107 @@ private:
     std::chrono::system_clock::time_point when_;
     buffer buffer_;
     level_e level_;
-    static std::mutex mutex__;
+};
+
+// Whether lines of the given level are logged with the current configuration.
+// The logging macros check this before a message is created, so suppressed
+// lines are neither time stamped nor formatted.
+VSOMEIP_IMPORT_EXPORT bool is_enabled(level_e _level);
+
+// Argument of a structured log line, kept in binary form until the line is written
+struct argument {
+    enum class type_e : std::uint8_t { AT_SIGNED, AT_UNSIGNED, AT_FLOATING, AT_BOOLEAN, AT_POINTER, AT_STRING };
+
+    template<typename T_, typename std::enable_if<std::is_integral<T_>::value && !std::is_same<T_, bool>::value, int>::type = 0>
+    argument(T_ _value) {
+        if (std::is_signed<T_>::value) {
+            type_ = type_e::AT_SIGNED;
+            signed_ = static_cast<std::int64_t>(_value);
+        } else {
+            type_ = type_e::AT_UNSIGNED;
+            unsigned_ = static_cast<std::uint64_t>(_value);
+        }
+    }
+    template<typename T_, typename std::enable_if<std::is_enum<T_>::value, int>::type = 0>
+    argument(T_ _value) : argument(static_cast<typename std::underlying_type<T_>::type>(_value)) { }
+    argument(bool _value) : type_(type_e::AT_BOOLEAN), unsigned_(_value) { }
+    argument(double _value) : type_(type_e::AT_FLOATING), floating_(_value) { }
+    argument(const void* _value) : type_(type_e::AT_POINTER), pointer_(_value) { }
+    argument(const char* _value) : type_(type_e::AT_STRING), string_{_value, std::strlen(_value)} { }
+    argument(const std::string& _value) : type_(type_e::AT_STRING), string_{_value.data(), _value.size()} { }
+    argument() : type_(type_e::AT_UNSIGNED), unsigned_(0) { }
+
+    // Refers to the caller's characters while the line is logged, the log
+    // record keeps a copy of them
+    struct string_t {
+        const char* data_;
+        std::size_t length_;
+    };
+
+    type_e type_;
+    union {
+        std::int64_t signed_;
+        std::uint64_t unsigned_;
+        double floating_;
+        const void* pointer_;
+        string_t string_;
+    };
+};
+
+constexpr std::size_t max_structured_arguments = 8;
+
+// Logs a line whose arguments are only formatted when it is written, which
+// with asynchronous logging happens on the writer thread. "_format" must be
+// a string literal, "{}" is replaced by the next argument, "{:x}" prints it
+// hexadecimal and "{:04x}" zero padded to four digits.
+VSOMEIP_IMPORT_EXPORT void log_structured(level_e _level, const char* _format, const argument* _arguments, std::size_t _count);
+
+template<std::size_t N_, typename... Arguments_>
+void log_structured(level_e _level, const char (&_format)[N_], const Arguments_&... _arguments) {
+    static_assert(sizeof...(Arguments_) <= max_structured_arguments, "Too many arguments for a structured log line");
+    const std::array<argument, sizeof...(Arguments_)> its_arguments{{argument(_arguments)...}};
+    log_structured(_level, _format, its_arguments.data(), its_arguments.size());
+}
+
+// Turns the streaming expression of the logging macros into "void", so
+// that it fits into the conditional operator
+struct voidify {
+    void operator&(std::ostream&) { }
+    void operator&(std::ostream&&) { }
 };
 
 } // namespace logger
 } // namespace vsomeip_v3
 
-#define VSOMEIP_FATAL   vsomeip_v3::logger::message(vsomeip_v3::logger::level_e::LL_FATAL)
-#define VSOMEIP_ERROR   vsomeip_v3::logger::message(vsomeip_v3::logger::level_e::LL_ERROR)
-#define VSOMEIP_WARNING vsomeip_v3::logger::message(vsomeip_v3::logger::level_e::LL_WARNING)
-#define VSOMEIP_INFO    vsomeip_v3::logger::message(vsomeip_v3::logger::level_e::LL_INFO)
-#define VSOMEIP_DEBUG   vsomeip_v3::logger::message(vsomeip_v3::logger::level_e::LL_DEBUG)
-#define VSOMEIP_TRACE   vsomeip_v3::logger::message(vsomeip_v3::logger::level_e::LL_VERBOSE)
+// Levels above this threshold are removed at compile time (1 = fatal ... 6 = verbose)
+#ifndef VSOMEIP_COMPILED_LOG_LEVEL
+#define VSOMEIP_COMPILED_LOG_LEVEL 6
+#endif
+
+#define VSOMEIP_LOG_IS_ENABLED(_level)                                                                                                     \
+    (static_cast<int>(_level) <= VSOMEIP_COMPILED_LOG_LEVEL && vsomeip_v3::logger::is_enabled(_level))
+
+#define VSOMEIP_LOG(_level)                                                                                                                \
+    !VSOMEIP_LOG_IS_ENABLED(_level) ? (void)0 : vsomeip_v3::logger::voidify() & vsomeip_v3::logger::message(_level)
+
+#define VSOMEIP_FATAL   VSOMEIP_LOG(vsomeip_v3::logger::level_e::LL_FATAL)
+#define VSOMEIP_ERROR   VSOMEIP_LOG(vsomeip_v3::logger::level_e::LL_ERROR)
+#define VSOMEIP_WARNING VSOMEIP_LOG(vsomeip_v3::logger::level_e::LL_WARNING)
+#define VSOMEIP_INFO    VSOMEIP_LOG(vsomeip_v3::logger::level_e::LL_INFO)
+#define VSOMEIP_DEBUG   VSOMEIP_LOG(vsomeip_v3::logger::level_e::LL_DEBUG)
+#define VSOMEIP_TRACE   VSOMEIP_LOG(vsomeip_v3::logger::level_e::LL_VERBOSE)
+
+// Structured logging for high-frequency lines, e.g.
+// VSOMEIP_DEBUG_F("on_message [{:04x}.{:04x}] size {}", its_service, its_instance, its_size);
+#define VSOMEIP_LOG_F(_level, ...)                                                                                                         \
+    !VSOMEIP_LOG_IS_ENABLED(_level) ? (void)0 : vsomeip_v3::logger::log_structured(_level, __VA_ARGS__)
+
+#define VSOMEIP_FATAL_F(...)   VSOMEIP_LOG_F(vsomeip_v3::logger::level_e::LL_FATAL, __VA_ARGS__)
+#define VSOMEIP_ERROR_F(...)   VSOMEIP_LOG_F(vsomeip_v3::logger::level_e::LL_ERROR, __VA_ARGS__)
+#define VSOMEIP_WARNING_F(...) VSOMEIP_LOG_F(vsomeip_v3::logger::level_e::LL_WARNING, __VA_ARGS__)
+#define VSOMEIP_INFO_F(...)    VSOMEIP_LOG_F(vsomeip_v3::logger::level_e::LL_INFO, __VA_ARGS__)
+#define VSOMEIP_DEBUG_F(...)   VSOMEIP_LOG_F(vsomeip_v3::logger::level_e::LL_DEBUG, __VA_ARGS__)
+#define VSOMEIP_TRACE_F(...)   VSOMEIP_LOG_F(vsomeip_v3::logger::level_e::LL_VERBOSE, __VA_ARGS__)
 
 #define VSOMEIP_LOG_DEFAULT_APPLICATION_ID      "VSIP"
 #define VSOMEIP_LOG_DEFAULT_APPLICATION_NAME    "vSomeIP application|SysInfra|IPC"
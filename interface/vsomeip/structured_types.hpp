@@ -8,9 +8,17 @@
 
 #include <chrono>
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <vsomeip/enumeration_types.hpp>
+#include <vsomeip/primitive_types.hpp>
 
 namespace vsomeip_v3 {
 
+class payload;
+
 // Messages are forwarded either because their value differs from the
 // last received message (on_change) or because the specified time
 // (interval) between two messages has elapsed. A message that is forwarded
@@ -54,6 +62,123 @@ struct debounce_filter_t {
     bool send_current_value_after_;
 };
 
+// A single event or field update of a batch notification
+// (see application::notify_batch).
+struct notification_t {
+    service_t service_;
+    instance_t instance_;
+    event_t event_;
+    std::shared_ptr<payload> payload_;
+};
+
+// Latency distribution of one processing stage of the messages received for
+// a method (see application::get_latency_histograms). The latencies are
+// counted in buckets whose width grows with the latency, so that each bucket
+// is at most 1/16th of its lower bound wide.
+struct latency_histogram_t {
+    service_t service_;
+    instance_t instance_;
+    method_t method_;
+    latency_stage_e stage_;
+
+    std::uint64_t count_;
+    std::chrono::nanoseconds min_;
+    std::chrono::nanoseconds max_;
+    std::chrono::nanoseconds sum_;
+    // Upper bound and count of the non-empty buckets, ordered by latency
+    std::vector<std::pair<std::chrono::nanoseconds, std::uint64_t>> buckets_;
+};
+
+// Counters of an endpoint (see application::get_metrics). The counters are
+// accumulated since the endpoint was created, an endpoint that is recreated
+// (e.g. after its service was stopped) starts from zero.
+struct endpoint_metrics_t {
+    bool is_local_;
+    bool is_reliable_;
+    bool is_client_;
+    std::uint16_t local_port_;
+    // Remote address and port of network client endpoints, empty / 0 else
+    std::string remote_address_;
+    std::uint16_t remote_port_;
+    // Peer of local client endpoints, ILLEGAL_CLIENT else
+    client_t client_;
+
+    // Bytes waiting to be sent
+    std::size_t queue_size_;
+    // Messages and bytes written to the socket
+    std::uint64_t messages_sent_;
+    std::uint64_t bytes_sent_;
+    std::uint64_t messages_received_;
+    std::uint64_t bytes_received_;
+    // Messages that were dropped because the queue limit was reached
+    std::uint64_t queue_limit_drops_;
+    // Queued messages that were dropped because of a send error, a restart
+    // or a stop of the endpoint
+    std::uint64_t send_drops_;
+    // Trains (buffers of one or more messages) handed to the socket
+    std::uint64_t train_departures_;
+    // Failed connection attempts of client endpoints
+    std::uint64_t reconnects_;
+};
+
+// Messages sent and received by an application for a service instance
+// (see application::get_metrics).
+struct service_metrics_t {
+    service_t service_;
+    instance_t instance_;
+
+    std::uint64_t messages_sent_;
+    std::uint64_t bytes_sent_;
+    std::uint64_t messages_received_;
+    std::uint64_t bytes_received_;
+};
+
+// Counters of an application (see application::get_metrics).
+struct metrics_t {
+    // Endpoints of the application. The routing manager host additionally
+    // reports the network endpoints and the endpoint the other local
+    // applications connect to.
+    std::vector<endpoint_metrics_t> endpoints_;
+    std::vector<service_metrics_t> services_;
+
+    // Handlers called by the dispatchers
+    std::uint64_t dispatched_;
+    // Message handlers called by the dispatchers and the time they spent
+    // queued
+    std::uint64_t dispatched_messages_;
+    std::chrono::nanoseconds dispatch_wait_sum_;
+    std::chrono::nanoseconds dispatch_wait_max_;
+    // Handlers currently waiting for a dispatcher
+    std::size_t dispatch_queue_size_;
+
+    // Service discovery messages (routing manager host only)
+    std::uint64_t sd_messages_sent_;
+    std::uint64_t sd_messages_received_;
+};
+
+// Durations of the handler calls of a kind or of a service and method (see
+// application::get_handler_profiles). Only the counts and durations of the
+// histograms are set.
+struct handler_profile_t {
+    handler_kind_e kind_;
+    // ANY_SERVICE and ANY_METHOD for the profile of all handlers of the kind
+    service_t service_;
+    method_t method_;
+
+    // CPU time of the dispatcher thread (CLOCK_THREAD_CPUTIME_ID), empty on
+    // platforms that do not support it
+    latency_histogram_t cpu_time_;
+    latency_histogram_t wall_time_;
+};
+
+// Depth of the dispatcher queue during one second (see
+// application::get_dispatch_queue_history).
+struct dispatch_queue_sample_t {
+    // Start of the second
+    std::chrono::steady_clock::time_point time_;
+    std::size_t max_depth_;
+};
+
 } // namespace vsomeip_v3
 
 #endif // VSOMEIP_V3_STRUCTURED_TYPES_HPP
@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "allocation_counter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#include "../../../implementation/utility/include/instrumentation.hpp"
+
+// Replaces the global allocation functions of the benchmark executable. The
+// array and nothrow forms forward to these, so every allocation of the
+// process (including the vsomeip library) is counted by the library hook.
+
+namespace {
+
+void* allocate(std::size_t _size) {
+    vsomeip_v3::instrumentation::count_allocation();
+    if (void* its_pointer = std::malloc(_size == 0 ? 1 : _size)) {
+        return its_pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* allocate(std::size_t _size, std::align_val_t _alignment) {
+    vsomeip_v3::instrumentation::count_allocation();
+    const auto its_alignment = static_cast<std::size_t>(_alignment);
+    // aligned_alloc requires the size to be a multiple of the alignment
+    const auto its_size = (_size + its_alignment - 1) / its_alignment * its_alignment;
+    if (void* its_pointer = std::aligned_alloc(its_alignment, its_size == 0 ? its_alignment : its_size)) {
+        return its_pointer;
+    }
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+namespace e2e {
+
+std::uint64_t get_allocations() {
+    return vsomeip_v3::instrumentation::get_allocations();
+}
+
+} // namespace e2e
+
+void* operator new(std::size_t _size) {
+    return allocate(_size);
+}
+
+void* operator new(std::size_t _size, std::align_val_t _alignment) {
+    return allocate(_size, _alignment);
+}
+
+void operator delete(void* _pointer) noexcept {
+    std::free(_pointer);
+}
+
+void operator delete(void* _pointer, std::size_t) noexcept {
+    std::free(_pointer);
+}
+
+void operator delete(void* _pointer, std::align_val_t) noexcept {
+    std::free(_pointer);
+}
+
+void operator delete(void* _pointer, std::size_t, std::align_val_t) noexcept {
+    std::free(_pointer);
+}
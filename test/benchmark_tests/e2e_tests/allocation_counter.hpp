@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_BENCHMARK_ALLOCATION_COUNTER_HPP_
+#define VSOMEIP_V3_BENCHMARK_ALLOCATION_COUNTER_HPP_
+
+#include <cstdint>
+
+namespace e2e {
+
+// Number of calls to the global operator new of all threads of the benchmark
+// process (including the vsomeip library) since the process started.
+std::uint64_t get_allocations();
+
+} // namespace e2e
+
+#endif // VSOMEIP_V3_BENCHMARK_ALLOCATION_COUNTER_HPP_
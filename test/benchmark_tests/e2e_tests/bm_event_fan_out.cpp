@@ -0,0 +1,169 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <condition_variable>
+#include <mutex>
+
+#include "e2e_setup.hpp"
+
+// Event fan-out from a provider to 1, 10 or 100 subscribers. Each iteration
+// sends one notification and waits until all subscribers received it, the
+// latency is the time from the notification to each reception.
+
+namespace {
+
+class fan_out_setup : public e2e::setup {
+public:
+    fan_out_setup(e2e::transport_e _transport, std::size_t _subscribers) :
+        subscribers_(_subscribers), is_subscribed_(_subscribers, false), subscribed_(0), received_(0), measurement_(nullptr) {
+        const std::string its_prefix("bm_e2e_fo_" + std::string(e2e::to_string(_transport)));
+        const std::string its_provider_name(its_prefix + "_provider");
+        const std::string its_router_name(e2e::is_network(_transport) ? its_prefix + "_router" : its_provider_name);
+        const auto its_reliability(e2e::get_reliability(_transport));
+
+        provider_ = std::make_unique<e2e::running_application>(its_provider_name,
+                                                               e2e::write_configuration(_transport, false, its_provider_name));
+        if (!provider_->init()) {
+            return;
+        }
+        auto its_provider = provider_->get();
+        its_provider->offer_event(e2e::service, e2e::instance, e2e::event, {e2e::eventgroup}, vsomeip_v3::event_type_e::ET_EVENT,
+                                  std::chrono::milliseconds::zero(), false, true, nullptr, its_reliability);
+        its_provider->offer_service(e2e::service, e2e::instance);
+        provider_->start();
+
+        const auto its_configuration = e2e::write_configuration(_transport, true, its_router_name);
+        if (e2e::is_network(_transport)) {
+            router_ = std::make_unique<e2e::running_application>(its_router_name, its_configuration);
+            if (!router_->init()) {
+                return;
+            }
+            router_->start();
+        }
+
+        for (std::size_t i = 0; i < _subscribers; ++i) {
+            auto its_subscriber = std::make_unique<e2e::running_application>(its_prefix + "_subscriber_" + std::to_string(i),
+                                                                             its_configuration);
+            if (!its_subscriber->init()) {
+                return;
+            }
+            auto its_application = its_subscriber->get();
+            its_application->register_subscription_status_handler(
+                    e2e::service, e2e::instance, e2e::eventgroup, e2e::event,
+                    [this, i](vsomeip_v3::service_t, vsomeip_v3::instance_t, vsomeip_v3::eventgroup_t, vsomeip_v3::event_t,
+                              std::uint16_t _error) {
+                        // The status may be reported more than once per subscriber
+                        std::scoped_lock its_lock(mutex_);
+                        if (_error == 0 && !is_subscribed_[i]) {
+                            is_subscribed_[i] = true;
+                            ++subscribed_;
+                            condition_.notify_all();
+                        }
+                    });
+            its_application->register_message_handler(e2e::service, e2e::instance, e2e::event,
+                                                      [this](const std::shared_ptr<vsomeip_v3::message>&) {
+                                                          const auto its_now = std::chrono::steady_clock::now();
+                                                          std::scoped_lock its_lock(mutex_);
+                                                          if (measurement_) {
+                                                              measurement_->record(its_now - sent_);
+                                                          }
+                                                          if (++received_ == subscribers_) {
+                                                              condition_.notify_all();
+                                                          }
+                                                      });
+            its_application->request_event(e2e::service, e2e::instance, e2e::event, {e2e::eventgroup},
+                                           vsomeip_v3::event_type_e::ET_EVENT, its_reliability);
+            its_application->request_service(e2e::service, e2e::instance);
+            its_application->subscribe(e2e::service, e2e::instance, e2e::eventgroup);
+            its_subscriber->start();
+            subscriber_applications_.emplace_back(std::move(its_subscriber));
+        }
+    }
+
+    ~fan_out_setup() override {
+        // The subscriber side first, so that the provider does not notify
+        // into a stopped routing manager
+        subscriber_applications_.clear();
+        router_.reset();
+        provider_.reset();
+    }
+
+    bool wait_until_ready() override {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        return subscriber_applications_.size() == subscribers_
+                && condition_.wait_for(its_lock, e2e::timeout, [this] { return subscribed_ >= subscribers_; });
+    }
+
+    // Sends the notification and waits until all subscribers received it
+    bool notify(const std::shared_ptr<vsomeip_v3::payload>& _payload, e2e::measurement& _measurement) {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        received_ = 0;
+        measurement_ = &_measurement;
+        sent_ = std::chrono::steady_clock::now();
+        its_lock.unlock();
+
+        provider_->get()->notify(e2e::service, e2e::instance, e2e::event, _payload, true);
+
+        its_lock.lock();
+        const bool is_received = condition_.wait_for(its_lock, e2e::timeout, [this] { return received_ >= subscribers_; });
+        measurement_ = nullptr;
+        return is_received;
+    }
+
+private:
+    std::unique_ptr<e2e::running_application> provider_;
+    std::unique_ptr<e2e::running_application> router_;
+    std::vector<std::unique_ptr<e2e::running_application>> subscriber_applications_;
+
+    const std::size_t subscribers_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<bool> is_subscribed_;
+    std::size_t subscribed_;
+    std::size_t received_;
+    e2e::measurement* measurement_;
+    std::chrono::steady_clock::time_point sent_;
+};
+
+} // namespace
+
+static void BM_e2e_event_fan_out(benchmark::State& state, e2e::transport_e _transport) {
+    const auto its_subscribers = static_cast<std::size_t>(state.range(0));
+    auto its_setup = e2e::get_setup<fan_out_setup>(e2e::to_string(_transport) + std::string("_fan_out_") + std::to_string(its_subscribers),
+                                                   _transport, its_subscribers);
+    if (!its_setup) {
+        state.SkipWithError("Subscriptions were not acknowledged");
+        return;
+    }
+
+    auto its_payload =
+            vsomeip_v3::runtime::get()->create_payload(std::vector<vsomeip_v3::byte_t>(static_cast<std::size_t>(state.range(1)), 0x5a));
+
+    e2e::measurement its_measurement;
+    for (auto _ : state) {
+        if (!its_setup->notify(its_payload, its_measurement)) {
+            state.SkipWithError("Notification was not received by all subscribers");
+            break;
+        }
+    }
+    // A notification per subscriber and iteration
+    its_measurement.report(state, state.iterations() * its_subscribers);
+}
+
+// Grouped by the number of subscribers, so that consecutive runs share
+// their setup
+static void fan_out_arguments(benchmark::internal::Benchmark* _benchmark) {
+    for (const int64_t its_subscribers : {1, 10, 100}) {
+        for (const auto its_payload_size : e2e::payload_sizes) {
+            _benchmark->Args({its_subscribers, its_payload_size});
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(BM_e2e_event_fan_out, uds, e2e::transport_e::UDS)->Apply(fan_out_arguments)->UseRealTime();
+BENCHMARK_CAPTURE(BM_e2e_event_fan_out, local_tcp, e2e::transport_e::LOCAL_TCP)->Apply(fan_out_arguments)->UseRealTime();
+BENCHMARK_CAPTURE(BM_e2e_event_fan_out, udp, e2e::transport_e::UDP)->Apply(fan_out_arguments)->UseRealTime();
+BENCHMARK_CAPTURE(BM_e2e_event_fan_out, tcp, e2e::transport_e::TCP)->Apply(fan_out_arguments)->UseRealTime();
@@ -0,0 +1,137 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <condition_variable>
+#include <mutex>
+
+#include "e2e_setup.hpp"
+
+// Request/response round trips between a consumer and a provider that echoes
+// the request payload. Each iteration sends one request and waits for its
+// response, the latency is the round trip time.
+
+namespace {
+
+class round_trip_setup : public e2e::setup {
+public:
+    explicit round_trip_setup(e2e::transport_e _transport) : is_available_(false), has_response_(false) {
+        const std::string its_prefix("bm_e2e_rt_" + std::string(e2e::to_string(_transport)));
+        const std::string its_provider_name(its_prefix + "_provider");
+        const std::string its_router_name(e2e::is_network(_transport) ? its_prefix + "_router" : its_provider_name);
+
+        provider_ = std::make_unique<e2e::running_application>(its_provider_name,
+                                                               e2e::write_configuration(_transport, false, its_provider_name));
+        if (!provider_->init()) {
+            return;
+        }
+        auto its_provider = provider_->get();
+        its_provider->register_message_handler(e2e::service, e2e::instance, e2e::method,
+                                               [its_provider](const std::shared_ptr<vsomeip_v3::message>& _request) {
+                                                   auto its_response = vsomeip_v3::runtime::get()->create_response(_request);
+                                                   its_response->set_payload(_request->get_payload());
+                                                   its_provider->send(its_response);
+                                               });
+        its_provider->offer_service(e2e::service, e2e::instance);
+        provider_->start();
+
+        const auto its_configuration = e2e::write_configuration(_transport, true, its_router_name);
+        if (e2e::is_network(_transport)) {
+            router_ = std::make_unique<e2e::running_application>(its_router_name, its_configuration);
+            if (!router_->init()) {
+                return;
+            }
+            router_->start();
+        }
+
+        consumer_ = std::make_unique<e2e::running_application>(its_prefix + "_consumer", its_configuration);
+        if (!consumer_->init()) {
+            return;
+        }
+        auto its_consumer = consumer_->get();
+        its_consumer->register_availability_handler(e2e::service, e2e::instance,
+                                                    [this](vsomeip_v3::service_t, vsomeip_v3::instance_t, bool _is_available) {
+                                                        std::scoped_lock its_lock(mutex_);
+                                                        is_available_ = _is_available;
+                                                        condition_.notify_all();
+                                                    });
+        its_consumer->register_message_handler(e2e::service, e2e::instance, e2e::method,
+                                               [this](const std::shared_ptr<vsomeip_v3::message>&) {
+                                                   std::scoped_lock its_lock(mutex_);
+                                                   has_response_ = true;
+                                                   condition_.notify_all();
+                                               });
+        its_consumer->request_service(e2e::service, e2e::instance);
+        consumer_->start();
+    }
+
+    ~round_trip_setup() override {
+        // The consumer side first, so that the provider does not answer
+        // into a stopped routing manager
+        consumer_.reset();
+        router_.reset();
+        provider_.reset();
+    }
+
+    bool wait_until_ready() override {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        return condition_.wait_for(its_lock, e2e::timeout, [this] { return is_available_; });
+    }
+
+    // Sends the request and waits for its response
+    bool call(const std::shared_ptr<vsomeip_v3::message>& _request) {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        has_response_ = false;
+        its_lock.unlock();
+
+        consumer_->get()->send(_request);
+
+        its_lock.lock();
+        return condition_.wait_for(its_lock, e2e::timeout, [this] { return has_response_; });
+    }
+
+private:
+    std::unique_ptr<e2e::running_application> provider_;
+    std::unique_ptr<e2e::running_application> router_;
+    std::unique_ptr<e2e::running_application> consumer_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool is_available_;
+    bool has_response_;
+};
+
+} // namespace
+
+static void BM_e2e_round_trip(benchmark::State& state, e2e::transport_e _transport) {
+    auto its_setup = e2e::get_setup<round_trip_setup>(e2e::to_string(_transport) + std::string("_round_trip"), _transport);
+    if (!its_setup) {
+        state.SkipWithError("Service did not become available");
+        return;
+    }
+
+    auto its_request = vsomeip_v3::runtime::get()->create_request(_transport != e2e::transport_e::UDP);
+    its_request->set_service(e2e::service);
+    its_request->set_instance(e2e::instance);
+    its_request->set_method(e2e::method);
+    its_request->set_payload(
+            vsomeip_v3::runtime::get()->create_payload(std::vector<vsomeip_v3::byte_t>(static_cast<std::size_t>(state.range(0)), 0x5a)));
+
+    e2e::measurement its_measurement;
+    for (auto _ : state) {
+        const auto its_start = std::chrono::steady_clock::now();
+        if (!its_setup->call(its_request)) {
+            state.SkipWithError("No response received");
+            break;
+        }
+        its_measurement.record(std::chrono::steady_clock::now() - its_start);
+    }
+    // A request and a response per iteration
+    its_measurement.report(state, 2 * state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_e2e_round_trip, uds, e2e::transport_e::UDS)->ArgsProduct({e2e::payload_sizes})->UseRealTime();
+BENCHMARK_CAPTURE(BM_e2e_round_trip, local_tcp, e2e::transport_e::LOCAL_TCP)->ArgsProduct({e2e::payload_sizes})->UseRealTime();
+BENCHMARK_CAPTURE(BM_e2e_round_trip, udp, e2e::transport_e::UDP)->ArgsProduct({e2e::payload_sizes})->UseRealTime();
+BENCHMARK_CAPTURE(BM_e2e_round_trip, tcp, e2e::transport_e::TCP)->ArgsProduct({e2e::payload_sizes})->UseRealTime();
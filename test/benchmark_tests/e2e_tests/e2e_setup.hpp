@@ -0,0 +1,250 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_BENCHMARK_E2E_SETUP_HPP_
+#define VSOMEIP_V3_BENCHMARK_E2E_SETUP_HPP_
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <vsomeip/vsomeip.hpp>
+
+#include "../../../implementation/utility/include/instrumentation.hpp"
+#include "../../../implementation/utility/include/latency_statistics.hpp"
+#include "allocation_counter.hpp"
+
+// Shared setup of the end-to-end benchmarks. All applications run in the
+// benchmark process. The provider hosts the routing. For the local transports
+// the consumers are its guests and reach it via Unix domain sockets or local
+// TCP. For the network transports a second routing manager with its own
+// unicast address on the loopback interface hosts the consumers, the
+// provider is found by service discovery and the messages are sent over
+// loopback UDP (with SOME/IP-TP for large payloads) or TCP. This requires
+// the second address and a multicast route on the loopback interface:
+//
+//   ip addr add 127.0.0.2/8 dev lo
+//   ip link set lo multicast on
+//   ip route add 224.0.0.0/4 dev lo
+//
+// Without them, the network benchmarks report that the service did not
+// become available. The service discovery module is loaded from the library
+// path, e.g. LD_LIBRARY_PATH=<build directory>.
+
+namespace e2e {
+
+enum class transport_e { UDS, LOCAL_TCP, UDP, TCP };
+
+constexpr vsomeip_v3::service_t service = 0x1234;
+constexpr vsomeip_v3::instance_t instance = 0x0001;
+constexpr vsomeip_v3::method_t method = 0x0421;
+constexpr vsomeip_v3::eventgroup_t eventgroup = 0x0001;
+constexpr vsomeip_v3::event_t event = 0x8001;
+
+// Payload sizes (bytes) of the benchmarks
+const std::vector<int64_t> payload_sizes {8, 1024, 64 * 1024, 1024 * 1024};
+
+// Time to wait for a setup to become ready and for a message to arrive
+constexpr std::chrono::seconds timeout(10);
+
+inline const char* to_string(transport_e _transport) {
+    switch (_transport) {
+    case transport_e::UDS:
+        return "uds";
+    case transport_e::LOCAL_TCP:
+        return "local_tcp";
+    case transport_e::UDP:
+        return "udp";
+    case transport_e::TCP:
+        return "tcp";
+    }
+    return "unknown";
+}
+
+inline bool is_network(transport_e _transport) {
+    return _transport == transport_e::UDP || _transport == transport_e::TCP;
+}
+
+inline vsomeip_v3::reliability_type_e get_reliability(transport_e _transport) {
+    return _transport == transport_e::UDP ? vsomeip_v3::reliability_type_e::RT_UNRELIABLE : vsomeip_v3::reliability_type_e::RT_RELIABLE;
+}
+
+// Writes the configuration of the provider side ("_is_consumer" false) or
+// of the consumer side and returns its path. "_router" hosts the routing of
+// the side.
+inline std::string write_configuration(transport_e _transport, bool _is_consumer, const std::string& _router) {
+    const bool is_remote_consumer(_is_consumer && is_network(_transport));
+    const std::string its_side(is_remote_consumer ? "b" : "a");
+    const std::string its_unicast(is_remote_consumer ? "127.0.0.2" : "127.0.0.1");
+
+    // Only the network transports need the ports and eventgroups of the
+    // service, the local ones route by the service instance only
+    std::stringstream its_service;
+    if (is_network(_transport)) {
+        its_service << std::hex << "{ \"service\" : \"0x" << service << "\", \"instance\" : \"0x" << instance << "\"";
+        if (is_remote_consumer) {
+            // Required to segment the requests
+            its_service << ", \"unicast\" : \"127.0.0.1\"";
+        }
+        if (_transport == transport_e::UDP) {
+            its_service << ", \"unreliable\" : \"30509\", \"someip-tp\" : { \"client-to-service\" : [ \"0x" << method
+                        << "\" ], \"service-to-client\" : [ \"0x" << method << "\", \"0x" << event << "\" ] }";
+        } else {
+            its_service << ", \"reliable\" : { \"port\" : \"30510\", \"enable-magic-cookies\" : \"false\" }";
+        }
+        its_service << ", \"events\" : [ { \"event\" : \"0x" << event << "\", \"is_field\" : \"false\", \"is_reliable\" : \""
+                    << (_transport == transport_e::UDP ? "false" : "true") << "\" } ]"
+                    << ", \"eventgroups\" : [ { \"eventgroup\" : \"0x" << eventgroup << "\", \"events\" : [ \"0x" << event
+                    << "\" ] } ] }";
+    }
+
+    std::stringstream its_routing;
+    if (_transport == transport_e::LOCAL_TCP) {
+        its_routing << "{ \"host\" : { \"name\" : \"" << _router << "\", \"unicast\" : \"127.0.0.1\", \"port\" : \"31490\" } }";
+    } else {
+        its_routing << "\"" << _router << "\"";
+    }
+
+    const std::string its_path("/tmp/bm_e2e_" + std::string(to_string(_transport)) + "_" + its_side + ".json");
+    std::ofstream its_file(its_path);
+    its_file << "{\n"
+             << "    \"unicast\" : \"" << its_unicast << "\",\n"
+             << "    \"network\" : \"bm-e2e-" << to_string(_transport) << "-" << its_side << "\",\n"
+             << "    \"logging\" : { \"level\" : \"warning\", \"console\" : \"true\", \"file\" : { \"enable\" : \"false\" }, \"dlt\" : "
+                "\"false\" },\n"
+             << "    \"max-payload-size-unreliable\" : \"2097152\",\n"
+             << "    \"udp-receive-buffer-size\" : \"16777216\",\n"
+             // Send at once instead of collecting messages into trains
+             << "    \"npdu-default-timings\" : { \"debounce-time-request\" : \"0\", \"debounce-time-response\" : \"0\","
+                " \"max-retention-time-request\" : \"0\", \"max-retention-time-response\" : \"0\" },\n"
+             << "    \"services\" : [ " << its_service.str() << " ],\n"
+             << "    \"routing\" : " << its_routing.str() << ",\n"
+             << "    \"service-discovery\" : { \"enable\" : \"" << (is_network(_transport) ? "true" : "false")
+             << "\", \"multicast\" : \"224.244.224.245\", \"port\" : \"30490\", \"protocol\" : \"udp\", \"initial_delay_min\" : \"0\","
+                " \"initial_delay_max\" : \"0\", \"repetitions_base_delay\" : \"10\", \"repetitions_max\" : \"1\","
+                " \"cyclic_offer_delay\" : \"1000\", \"ttl\" : \"3\" }\n"
+             << "}\n";
+    return its_path;
+}
+
+// An application that runs in its own thread from construction until
+// destruction
+class running_application {
+public:
+    running_application(const std::string& _name, const std::string& _configuration) :
+        application_(vsomeip_v3::runtime::get()->create_application(_name, _configuration)) { }
+
+    ~running_application() {
+        if (thread_.joinable()) {
+            application_->stop();
+            thread_.join();
+        }
+    }
+
+    bool init() { return application_->init(); }
+    void start() {
+        thread_ = std::thread([this] { application_->start(); });
+    }
+
+    const std::shared_ptr<vsomeip_v3::application>& get() const { return application_; }
+
+private:
+    std::shared_ptr<vsomeip_v3::application> application_;
+    std::thread thread_;
+};
+
+// Base of the setups. Only one setup exists at a time, because the setups
+// use the same ports.
+class setup {
+public:
+    virtual ~setup() = default;
+
+    // Waits until the setup is ready to exchange messages
+    virtual bool wait_until_ready() = 0;
+};
+
+struct current_setup_t {
+    std::string key_;
+    std::unique_ptr<setup> setup_;
+    bool is_ready_ {false};
+};
+
+inline current_setup_t& get_current_setup() {
+    static current_setup_t its_current;
+    return its_current;
+}
+
+// Returns the setup for "_key", replacing the current one if it has a
+// different key. nullptr if the setup did not become ready.
+template<typename Setup_, typename... Args_>
+Setup_* get_setup(const std::string& _key, Args_&&... _args) {
+    auto& its_current = get_current_setup();
+    if (its_current.key_ != _key) {
+        its_current.setup_.reset();
+        its_current.key_ = _key;
+        its_current.setup_ = std::make_unique<Setup_>(std::forward<Args_>(_args)...);
+        its_current.is_ready_ = its_current.setup_->wait_until_ready();
+    }
+    return its_current.is_ready_ ? static_cast<Setup_*>(its_current.setup_.get()) : nullptr;
+}
+
+// Contended acquisitions and their total wait time of all lock sites
+inline std::pair<std::uint64_t, std::chrono::nanoseconds> get_lock_waits() {
+    std::pair<std::uint64_t, std::chrono::nanoseconds> its_waits(0, 0);
+    for (const auto& s : vsomeip_v3::instrumentation::get_lock_sites()) {
+        its_waits.first += s.wait_time_.count_;
+        its_waits.second += s.wait_time_.sum_;
+    }
+    return its_waits;
+}
+
+// Counts the allocations (and lock waits of instrumented builds) and records
+// the latencies of a benchmark run
+class measurement {
+public:
+    measurement() : allocations_(get_allocations()), lock_waits_(get_lock_waits()) { }
+
+    void record(std::chrono::nanoseconds _latency) { histogram_.record(_latency); }
+
+    // Sets msgs/s, p50/p99 latency (us), allocations per message and, for
+    // instrumented builds, lock waits per message
+    void report(benchmark::State& _state, std::uint64_t _messages) {
+        const auto its_allocations = get_allocations() - allocations_;
+        vsomeip_v3::latency_histogram_t its_histogram;
+        histogram_.get(its_histogram);
+
+        _state.SetItemsProcessed(static_cast<int64_t>(_messages));
+        _state.counters["p50_us"] =
+                static_cast<double>(vsomeip_v3::latency_histogram::get_percentile(its_histogram, 50.0).count()) / 1000.0;
+        _state.counters["p99_us"] =
+                static_cast<double>(vsomeip_v3::latency_histogram::get_percentile(its_histogram, 99.0).count()) / 1000.0;
+        _state.counters["allocs_per_msg"] =
+                _messages > 0 ? static_cast<double>(its_allocations) / static_cast<double>(_messages) : 0.0;
+
+        if (vsomeip_v3::instrumentation::is_enabled() && _messages > 0) {
+            const auto its_lock_waits = get_lock_waits();
+            _state.counters["lock_waits_per_msg"] =
+                    static_cast<double>(its_lock_waits.first - lock_waits_.first) / static_cast<double>(_messages);
+            _state.counters["lock_wait_us_per_msg"] =
+                    static_cast<double>((its_lock_waits.second - lock_waits_.second).count()) / 1000.0 / static_cast<double>(_messages);
+        }
+    }
+
+private:
+    std::uint64_t allocations_;
+    std::pair<std::uint64_t, std::chrono::nanoseconds> lock_waits_;
+    vsomeip_v3::latency_histogram histogram_;
+};
+
+} // namespace e2e
+
+#endif // VSOMEIP_V3_BENCHMARK_E2E_SETUP_HPP_
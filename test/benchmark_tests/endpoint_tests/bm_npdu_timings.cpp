@@ -0,0 +1,78 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <iomanip>
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/filesystem.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+
+// Resolving the nPDU timings of a message sent to an endpoint with 50
+// services of 20 methods each: asking the configuration for every message,
+// as the endpoints did, versus the table resolved when the endpoint is created.
+
+namespace {
+
+struct configuration_t {
+    configuration_t() {
+        const auto its_path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("bm_npdu_timings_%%%%%%%%.json");
+        {
+            std::ofstream its_file(its_path.string());
+            its_file << "{ \"services\" : [";
+            for (int s = 0; s < 50; ++s) {
+                its_file << (s ? "," : "") << "{ \"service\" : \"0x" << std::hex << std::setw(4) << std::setfill('0') << (0x1000 + s)
+                         << "\", \"instance\" : \"0x1\", \"unicast\" : \"10.0.0.1\", \"unreliable\" : \"30509\", "
+                         << "\"debounce-times\" : { \"requests\" : {";
+                for (int m = 0; m < 20; ++m) {
+                    its_file << (m ? "," : "") << "\"0x" << std::hex << (0x100 + m) << "\" : { \"debounce-time\" : \"" << std::dec << m
+                             << "\", \"maximum-retention-time\" : \"" << (10 * m) << "\" }";
+                }
+                its_file << "} } }";
+            }
+            its_file << "] }";
+        }
+        configuration_ = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_path.string());
+        configuration_->load("bm_npdu_timings");
+        boost::filesystem::remove(its_path);
+    }
+
+    std::shared_ptr<vsomeip_v3::cfg::configuration_impl> configuration_;
+    const boost::asio::ip::address address_{boost::asio::ip::make_address("10.0.0.1")};
+    const std::uint16_t port_{30509};
+};
+
+} // namespace
+
+static void BM_npdu_timings_configuration(benchmark::State& state) {
+    configuration_t its_configuration;
+    std::chrono::nanoseconds its_debounce, its_retention;
+    int its_index(0);
+    for (auto _ : state) {
+        its_configuration.configuration_->get_configured_timing_requests(static_cast<vsomeip_v3::service_t>(0x1000 + its_index), its_configuration.address_.to_string(),
+                                                                         its_configuration.port_, 0x105, &its_debounce, &its_retention);
+        benchmark::DoNotOptimize(its_debounce);
+        its_index = (its_index + 1) % 50;
+    }
+}
+
+static void BM_npdu_timings_table(benchmark::State& state) {
+    configuration_t its_configuration;
+    const auto its_table =
+            its_configuration.configuration_->get_npdu_timings_requests(its_configuration.address_.to_string(), its_configuration.port_);
+    std::chrono::nanoseconds its_debounce, its_retention;
+    int its_index(0);
+    for (auto _ : state) {
+        its_table.get(static_cast<vsomeip_v3::service_t>(0x1000 + its_index), 0x105, its_debounce, its_retention);
+        benchmark::DoNotOptimize(its_debounce);
+        its_index = (its_index + 1) % 50;
+    }
+}
+
+BENCHMARK(BM_npdu_timings_configuration);
+BENCHMARK(BM_npdu_timings_table);
@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <set>
+
+#include "../../../implementation/endpoints/include/buffer.hpp"
+
+// Packing a train with 10, 50 and 200 passengers of 24 bytes each: a train
+// with a growing buffer and a set of passengers, as used before, versus a
+// pooled buffer reserved to the size of the train and inline passengers.
+
+namespace {
+
+constexpr std::size_t message_size = 24;
+
+struct set_train {
+    set_train() : buffer_(std::make_shared<vsomeip_v3::message_buffer_t>()) { }
+
+    vsomeip_v3::message_buffer_ptr_t buffer_;
+    std::set<std::pair<vsomeip_v3::service_t, vsomeip_v3::method_t>> passengers_;
+};
+
+} // namespace
+
+static void BM_pack_train_set(benchmark::State& state) {
+    const auto its_passengers = static_cast<vsomeip_v3::method_t>(state.range(0));
+    const vsomeip_v3::byte_t its_message[message_size]{};
+    for (auto _ : state) {
+        auto its_train = std::make_shared<set_train>();
+        for (vsomeip_v3::method_t m = 0; m < its_passengers; ++m) {
+            const auto its_identifier = std::make_pair(vsomeip_v3::service_t(0x1234), m);
+            if (its_train->passengers_.find(its_identifier) == its_train->passengers_.end()) {
+                its_train->buffer_->insert(its_train->buffer_->end(), its_message, its_message + message_size);
+                its_train->passengers_.insert(its_identifier);
+            }
+        }
+        benchmark::DoNotOptimize(its_train->buffer_->data());
+    }
+}
+
+static void BM_pack_train_pooled(benchmark::State& state) {
+    const auto its_passengers = static_cast<vsomeip_v3::method_t>(state.range(0));
+    const vsomeip_v3::byte_t its_message[message_size]{};
+    auto its_pool = std::make_shared<vsomeip_v3::train_buffer_pool>();
+    for (auto _ : state) {
+        auto its_train = std::make_shared<vsomeip_v3::train>(its_pool->get(its_passengers * message_size));
+        for (vsomeip_v3::method_t m = 0; m < its_passengers; ++m) {
+            if (!its_train->passengers_.contains(0x1234, m)) {
+                its_train->buffer_->insert(its_train->buffer_->end(), its_message, its_message + message_size);
+                its_train->passengers_.insert(0x1234, m);
+            }
+        }
+        benchmark::DoNotOptimize(its_train->buffer_->data());
+    }
+}
+
+BENCHMARK(BM_pack_train_set)->Arg(10)->Arg(50)->Arg(200);
+BENCHMARK(BM_pack_train_pooled)->Arg(10)->Arg(50)->Arg(200);
@@ -0,0 +1,138 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include "../../../implementation/endpoints/include/uring_socket_receiver.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <memory>
+#include <vector>
+
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/configuration/include/internal.hpp"
+
+// Bursts of datagrams over loopback UDP, sent by a plain socket and received
+// like the UDP endpoints do: one receive per datagram, started again from the
+// handler. Compares asio (epoll reactor) with the io_uring receiver, with and
+// without multishot receives into provided buffers.
+
+namespace {
+
+using namespace vsomeip_v3;
+
+constexpr std::size_t burst_size = 16;
+
+enum class receiver_e { asio, uring_single, uring_multishot };
+
+class burst_t {
+public:
+    burst_t(boost::asio::io_context& _io, std::unique_ptr<udp_receiver> _receiver, std::size_t _size) :
+        io_(_io), socket_(_io), peer_(_io), receiver_(std::move(_receiver)), message_(_size, 0x5a),
+        buffer_(VSOMEIP_MAX_UDP_MESSAGE_SIZE), received_(0) {
+        socket_.open(boost::asio::ip::udp::v4());
+        socket_.bind(boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        peer_.open(boost::asio::ip::udp::v4());
+        peer_.bind(boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        destination_ = socket_.local_endpoint();
+    }
+
+    ~burst_t() {
+        if (receiver_) {
+            receiver_->cancel();
+        }
+    }
+
+    void run() {
+        for (std::size_t i = 0; i < burst_size; i++) {
+            peer_.send_to(boost::asio::buffer(message_), destination_);
+        }
+        received_ = 0;
+        // Without the io_uring, the io_context runs out of work after each burst
+        io_.restart();
+        receive();
+        while (received_ < burst_size) {
+            io_.run_one();
+        }
+    }
+
+private:
+    void receive() {
+        if (receiver_) {
+            receiver_->async_receive(socket_, boost::asio::buffer(buffer_),
+                                     [this](const boost::system::error_code& _error, std::size_t, const boost::asio::ip::udp::endpoint&,
+                                            const boost::asio::ip::address&) { on_received(_error); });
+        } else {
+            socket_.async_receive_from(boost::asio::buffer(buffer_), sender_,
+                                       [this](const boost::system::error_code& _error, std::size_t) { on_received(_error); });
+        }
+    }
+
+    void on_received(const boost::system::error_code& _error) {
+        if (!_error && ++received_ < burst_size) {
+            receive();
+        }
+    }
+
+    boost::asio::io_context& io_;
+    boost::asio::ip::udp::socket socket_;
+    boost::asio::ip::udp::socket peer_;
+    boost::asio::ip::udp::endpoint destination_;
+    boost::asio::ip::udp::endpoint sender_;
+    std::unique_ptr<udp_receiver> receiver_;
+    std::vector<unsigned char> message_;
+    std::vector<unsigned char> buffer_;
+    std::size_t received_;
+};
+
+void run(benchmark::State& state, receiver_e _receiver) {
+    const auto its_size = static_cast<std::size_t>(state.range(0));
+
+    boost::asio::io_context its_io;
+    std::unique_ptr<udp_receiver> its_receiver;
+    if (_receiver != receiver_e::asio) {
+        auto& its_service = boost::asio::use_service<uring_service>(its_io);
+        if (!its_service.init(256)) {
+            state.SkipWithError("io_uring is not available");
+            return;
+        }
+        const bool is_multishot(_receiver == receiver_e::uring_multishot);
+        if (is_multishot && !its_service.init_buffers(VSOMEIP_IO_URING_RECEIVE_BUFFERS, uring_udp_receiver::get_buffer_size())) {
+            state.SkipWithError("provided buffer rings are not available");
+            return;
+        }
+        its_receiver = std::make_unique<uring_udp_receiver>(its_io, its_service, is_multishot);
+    }
+
+    {
+        burst_t its_burst(its_io, std::move(its_receiver), its_size);
+        for (auto _ : state) {
+            its_burst.run();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * burst_size));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * burst_size * its_size));
+}
+}
+
+static void BM_udp_receive_burst_epoll(benchmark::State& state) {
+    run(state, receiver_e::asio);
+}
+
+static void BM_udp_receive_burst_io_uring(benchmark::State& state) {
+    run(state, receiver_e::uring_single);
+}
+
+static void BM_udp_receive_burst_io_uring_multishot(benchmark::State& state) {
+    run(state, receiver_e::uring_multishot);
+}
+
+BENCHMARK(BM_udp_receive_burst_epoll)->Arg(64)->Arg(1400)->UseRealTime();
+BENCHMARK(BM_udp_receive_burst_io_uring)->Arg(64)->Arg(1400)->UseRealTime();
+BENCHMARK(BM_udp_receive_burst_io_uring_multishot)->Arg(64)->Arg(1400)->UseRealTime();
+
+#endif // VSOMEIP_HAS_IO_URING
@@ -0,0 +1,133 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include "../../../implementation/endpoints/include/uring_tcp_socket.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <memory>
+#include <vector>
+
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+// Round trips over loopback TCP: the socket under test sends a message and
+// receives the echo of a plain asio peer, both driven by the same io thread.
+// Compares the epoll reactor (asio_tcp_socket) with io_uring (uring_tcp_socket).
+
+namespace {
+
+using namespace vsomeip_v3;
+
+class echo_t {
+public:
+    echo_t(boost::asio::io_context& _io, std::unique_ptr<tcp_socket> _socket, std::size_t _size) :
+        io_(_io), peer_(_io), socket_(std::move(_socket)), message_(_size, 0x5a), echo_(_size), answer_(_size) {
+        std::unique_ptr<tcp_acceptor> its_acceptor = std::make_unique<asio_tcp_acceptor>(_io);
+        boost::system::error_code its_error;
+        const boost::asio::ip::tcp::endpoint its_local(boost::asio::ip::address_v4::loopback(), 0);
+        its_acceptor->open(its_local.protocol(), its_error);
+        its_acceptor->bind(its_local, its_error);
+        its_acceptor->listen(1, its_error);
+
+        sockaddr_in its_address{};
+        socklen_t its_length(sizeof(its_address));
+        getsockname(its_acceptor->native_handle(), reinterpret_cast<sockaddr*>(&its_address), &its_length);
+
+        bool is_accepted(false);
+        its_acceptor->async_accept(*socket_, [&is_accepted](const boost::system::error_code&) { is_accepted = true; });
+        peer_.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), ntohs(its_address.sin_port)));
+        peer_.set_option(boost::asio::ip::tcp::no_delay(true));
+        socket_->set_option(boost::asio::ip::tcp::no_delay(true), its_error);
+        while (!is_accepted) {
+            io_.run_one();
+        }
+        // Without the uring_service, the io_context ran out of work
+        io_.restart();
+        echo();
+    }
+
+    void round_trip() {
+        bool is_written(false);
+        std::size_t its_received(0);
+        socket_->async_write(std::vector<boost::asio::const_buffer>{boost::asio::buffer(message_)},
+                             [&is_written](const boost::system::error_code&, std::size_t) { is_written = true; });
+        receive(its_received);
+        while (!is_written || its_received < answer_.size()) {
+            io_.run_one();
+        }
+    }
+
+private:
+    void receive(std::size_t& _received) {
+        socket_->async_receive(boost::asio::buffer(answer_.data() + _received, answer_.size() - _received),
+                               [this, &_received](const boost::system::error_code& _error, std::size_t _bytes) {
+                                   _received += _bytes;
+                                   if (!_error && _received < answer_.size()) {
+                                       receive(_received);
+                                   }
+                               });
+    }
+
+    void echo() {
+        boost::asio::async_read(peer_, boost::asio::buffer(echo_), [this](const boost::system::error_code& _error, std::size_t) {
+            if (!_error) {
+                boost::asio::async_write(peer_, boost::asio::buffer(echo_), [this](const boost::system::error_code& _error, std::size_t) {
+                    if (!_error) {
+                        echo();
+                    }
+                });
+            }
+        });
+    }
+
+    boost::asio::io_context& io_;
+    boost::asio::ip::tcp::socket peer_;
+    std::unique_ptr<tcp_socket> socket_;
+    std::vector<unsigned char> message_;
+    std::vector<unsigned char> echo_;
+    std::vector<unsigned char> answer_;
+};
+
+void run(benchmark::State& state, bool _is_uring) {
+    const auto its_size = static_cast<std::size_t>(state.range(0));
+
+    boost::asio::io_context its_io;
+    std::unique_ptr<tcp_socket> its_socket;
+    if (_is_uring) {
+        auto& its_service = boost::asio::use_service<uring_service>(its_io);
+        if (!its_service.init(256)) {
+            state.SkipWithError("io_uring is not available");
+            return;
+        }
+        its_socket = std::make_unique<uring_tcp_socket>(its_io, its_service);
+    } else {
+        its_socket = std::make_unique<asio_tcp_socket>(its_io);
+    }
+
+    {
+        echo_t its_echo(its_io, std::move(its_socket), its_size);
+        for (auto _ : state) {
+            its_echo.round_trip();
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * its_size * 2));
+}
+}
+
+static void BM_tcp_round_trip_epoll(benchmark::State& state) {
+    run(state, false);
+}
+
+static void BM_tcp_round_trip_io_uring(benchmark::State& state) {
+    run(state, true);
+}
+
+BENCHMARK(BM_tcp_round_trip_epoll)->Arg(64)->Arg(1400)->Arg(65536)->UseRealTime();
+BENCHMARK(BM_tcp_round_trip_io_uring)->Arg(64)->Arg(1400)->Arg(65536)->UseRealTime();
+
+#endif // VSOMEIP_HAS_IO_URING
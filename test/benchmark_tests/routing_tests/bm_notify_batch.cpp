@@ -0,0 +1,159 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <vsomeip/vsomeip.hpp>
+
+// Compares publishing a cycle of signals through individual application::notify
+// calls against a single application::notify_batch call. The provider hosts the
+// routing and a second application subscribes to all signals, so every update
+// is routed to a subscriber.
+
+namespace {
+
+constexpr vsomeip_v3::service_t service = 0x1234;
+constexpr vsomeip_v3::instance_t instance = 0x0001;
+constexpr vsomeip_v3::eventgroup_t eventgroup = 0x0001;
+constexpr vsomeip_v3::event_t first_event = 0x8001;
+constexpr std::size_t max_signals = 300;
+constexpr std::size_t signal_size = 8;
+
+class notify_setup {
+public:
+    notify_setup() : is_subscribed_(false) {
+        const auto its_runtime = vsomeip_v3::runtime::get();
+
+        provider_ = its_runtime->create_application("bm_notify_batch_provider");
+        if (!provider_->init()) {
+            return;
+        }
+        std::set<vsomeip_v3::eventgroup_t> its_groups {eventgroup};
+        for (std::size_t i = 0; i < max_signals; ++i) {
+            provider_->offer_event(service, instance, static_cast<vsomeip_v3::event_t>(first_event + i), its_groups,
+                                   vsomeip_v3::event_type_e::ET_EVENT);
+        }
+        provider_->offer_service(service, instance);
+        provider_thread_ = std::thread([this]() { provider_->start(); });
+
+        consumer_ = its_runtime->create_application("bm_notify_batch_consumer");
+        if (!consumer_->init()) {
+            return;
+        }
+        consumer_->register_subscription_status_handler(
+                service, instance, eventgroup, vsomeip_v3::ANY_EVENT,
+                [this](vsomeip_v3::service_t, vsomeip_v3::instance_t, vsomeip_v3::eventgroup_t, vsomeip_v3::event_t, uint16_t _error) {
+                    if (_error == 0x0) {
+                        std::lock_guard<std::mutex> its_lock(mutex_);
+                        is_subscribed_ = true;
+                        condition_.notify_all();
+                    }
+                });
+        for (std::size_t i = 0; i < max_signals; ++i) {
+            consumer_->request_event(service, instance, static_cast<vsomeip_v3::event_t>(first_event + i), its_groups,
+                                     vsomeip_v3::event_type_e::ET_EVENT);
+        }
+        consumer_->request_service(service, instance);
+        consumer_->subscribe(service, instance, eventgroup);
+        consumer_thread_ = std::thread([this]() { consumer_->start(); });
+    }
+
+    ~notify_setup() {
+        if (consumer_thread_.joinable()) {
+            consumer_->stop();
+            consumer_thread_.join();
+        }
+        if (provider_thread_.joinable()) {
+            provider_->stop();
+            provider_thread_.join();
+        }
+    }
+
+    bool wait_for_subscription() {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        return condition_.wait_for(its_lock, std::chrono::seconds(10), [this]() { return is_subscribed_; });
+    }
+
+    std::shared_ptr<vsomeip_v3::application> get_provider() const { return provider_; }
+
+private:
+    std::shared_ptr<vsomeip_v3::application> provider_;
+    std::shared_ptr<vsomeip_v3::application> consumer_;
+    std::thread provider_thread_;
+    std::thread consumer_thread_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool is_subscribed_;
+};
+
+std::shared_ptr<vsomeip_v3::application> get_provider(benchmark::State& state) {
+    static notify_setup its_setup;
+    static const bool is_subscribed(its_setup.wait_for_subscription());
+
+    if (!is_subscribed) {
+        state.SkipWithError("Consumer did not subscribe");
+        return nullptr;
+    }
+    return its_setup.get_provider();
+}
+
+// Every cycle changes all payloads, so no update is dropped as unchanged.
+std::vector<vsomeip_v3::notification_t> create_cycle(std::size_t _signals, vsomeip_v3::byte_t _value) {
+    std::vector<vsomeip_v3::notification_t> its_cycle;
+    for (std::size_t i = 0; i < _signals; ++i) {
+        std::vector<vsomeip_v3::byte_t> its_data(signal_size, _value);
+        its_cycle.push_back(
+                {service, instance, static_cast<vsomeip_v3::event_t>(first_event + i), vsomeip_v3::runtime::get()->create_payload(its_data)});
+    }
+    return its_cycle;
+}
+}
+
+static void BM_notify_individual(benchmark::State& state) {
+    const auto its_signals = static_cast<std::size_t>(state.range(0));
+    auto its_provider = get_provider(state);
+    if (!its_provider) {
+        return;
+    }
+    const auto its_cycles = std::array<std::vector<vsomeip_v3::notification_t>, 2> {create_cycle(its_signals, 0x01),
+                                                                                     create_cycle(its_signals, 0x02)};
+
+    std::size_t its_index(0);
+    for (auto _ : state) {
+        for (const auto& n : its_cycles[its_index]) {
+            its_provider->notify(n.service_, n.instance_, n.event_, n.payload_);
+        }
+        its_index ^= 1;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * its_signals));
+}
+
+static void BM_notify_batch(benchmark::State& state) {
+    const auto its_signals = static_cast<std::size_t>(state.range(0));
+    auto its_provider = get_provider(state);
+    if (!its_provider) {
+        return;
+    }
+    const auto its_cycles = std::array<std::vector<vsomeip_v3::notification_t>, 2> {create_cycle(its_signals, 0x01),
+                                                                                     create_cycle(its_signals, 0x02)};
+
+    std::size_t its_index(0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(its_provider->notify_batch(its_cycles[its_index]));
+        its_index ^= 1;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * its_signals));
+}
+
+BENCHMARK(BM_notify_individual)->Arg(10)->Arg(300)->UseRealTime();
+BENCHMARK(BM_notify_batch)->Arg(10)->Arg(300)->UseRealTime();
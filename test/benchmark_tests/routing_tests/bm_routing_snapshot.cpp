@@ -0,0 +1,187 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <common/utility.hpp>
+
+#include "../../unit_tests/routing_manager_tests/mocks/mock_routing_manager_host.hpp"
+
+// Measures routing_manager_base::find_service as used on the data path while
+// a writer thread keeps offering and stopping services, similar to an SD offer
+// storm. A mutex protected map with the layout of routing_manager_base::services_
+// serves as reference for the previous, locked lookup.
+
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+
+constexpr vsomeip_v3::service_t storm_services = 256;
+constexpr vsomeip_v3::instance_t storm_instance = 0x1;
+constexpr int sender_threads = 8;
+
+// Gives access to the service registration of the routing manager. The class
+// is never instantiated, it only provides the member pointers.
+class routing_manager_access : public vsomeip_v3::routing_manager_impl {
+public:
+    static constexpr auto create = &routing_manager_access::create_service_info;
+    static constexpr auto clear = &routing_manager_access::clear_service_info;
+};
+
+class production_table {
+public:
+    production_table() {
+        configuration_ = std::make_shared<vsomeip_v3::cfg::configuration_impl>("");
+
+        EXPECT_CALL(host_, get_io()).WillRepeatedly(ReturnRef(io_));
+        EXPECT_CALL(host_, get_name()).WillRepeatedly(ReturnRef(name_));
+        EXPECT_CALL(host_, get_configuration()).WillRepeatedly(Return(configuration_));
+
+        manager_ = std::make_unique<vsomeip_v3::routing_manager_impl>(&host_);
+        manager_->init();
+    }
+
+    std::shared_ptr<vsomeip_v3::serviceinfo> find(vsomeip_v3::service_t _service, vsomeip_v3::instance_t _instance) const {
+        return manager_->find_service(_service, _instance);
+    }
+
+    void offer(vsomeip_v3::service_t _service, vsomeip_v3::instance_t _instance) {
+        ((*manager_).*routing_manager_access::create)(_service, _instance, 0x1, 0x0, vsomeip_v3::DEFAULT_TTL, true);
+    }
+
+    void stop_offer(vsomeip_v3::service_t _service, vsomeip_v3::instance_t _instance) {
+        ((*manager_).*routing_manager_access::clear)(_service, _instance, false);
+    }
+
+private:
+    ::testing::NiceMock<mock_routing_manager_host> host_;
+    const std::string name_ = "bm_routing_snapshot";
+    boost::asio::io_context io_;
+    std::shared_ptr<vsomeip_v3::cfg::configuration_impl> configuration_;
+    std::unique_ptr<vsomeip_v3::routing_manager_impl> manager_;
+};
+
+class locked_table {
+public:
+    std::shared_ptr<vsomeip_v3::serviceinfo> find(vsomeip_v3::service_t _service, vsomeip_v3::instance_t _instance) const {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        auto found_service = services_.find(_service);
+        if (found_service != services_.end()) {
+            auto found_instance = found_service->second.find(_instance);
+            if (found_instance != found_service->second.end()) {
+                return found_instance->second;
+            }
+        }
+        return nullptr;
+    }
+
+    void offer(vsomeip_v3::service_t _service, vsomeip_v3::instance_t _instance) {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        services_[_service][_instance] =
+                std::make_shared<vsomeip_v3::serviceinfo>(_service, _instance, 0x1, 0x0, vsomeip_v3::DEFAULT_TTL, true);
+    }
+
+    void stop_offer(vsomeip_v3::service_t _service, vsomeip_v3::instance_t _instance) {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        services_[_service].erase(_instance);
+        if (services_[_service].empty()) {
+            services_.erase(_service);
+        }
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::map<vsomeip_v3::service_t, std::map<vsomeip_v3::instance_t, std::shared_ptr<vsomeip_v3::serviceinfo>>> services_;
+};
+
+// Offers all services once, then toggles them as fast as possible until stopped.
+template<typename Table>
+class offer_storm {
+public:
+    explicit offer_storm(Table& _table) : table_(_table), is_running_(true) {
+        for (vsomeip_v3::service_t s = 1; s <= storm_services; ++s) {
+            table_.offer(s, storm_instance);
+        }
+        thread_ = std::thread([this]() {
+            vsomeip_v3::service_t s = 1;
+            while (is_running_) {
+                table_.stop_offer(s, storm_instance);
+                table_.offer(s, storm_instance);
+                s = static_cast<vsomeip_v3::service_t>(s % storm_services + 1);
+            }
+        });
+    }
+
+    ~offer_storm() {
+        is_running_ = false;
+        thread_.join();
+    }
+
+private:
+    Table& table_;
+    std::atomic<bool> is_running_;
+    std::thread thread_;
+};
+
+template<typename Table>
+void run_senders(benchmark::State& state, std::unique_ptr<Table>& _table, std::unique_ptr<offer_storm<Table>>& _storm, bool _with_storm) {
+    if (state.thread_index() == 0) {
+        _table = std::make_unique<Table>();
+        if (_with_storm) {
+            _storm = std::make_unique<offer_storm<Table>>(*_table);
+        } else {
+            for (vsomeip_v3::service_t s = 1; s <= storm_services; ++s) {
+                _table->offer(s, storm_instance);
+            }
+        }
+    }
+
+    vsomeip_v3::service_t s = static_cast<vsomeip_v3::service_t>(state.thread_index() + 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(_table->find(s, storm_instance));
+        s = static_cast<vsomeip_v3::service_t>(s % storm_services + 1);
+    }
+
+    if (state.thread_index() == 0) {
+        _storm.reset();
+        _table.reset();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+std::unique_ptr<locked_table> locked_services;
+std::unique_ptr<offer_storm<locked_table>> locked_storm;
+
+std::unique_ptr<production_table> production_services;
+std::unique_ptr<offer_storm<production_table>> production_storm;
+}
+
+static void BM_find_service_locked_reference(benchmark::State& state) {
+    run_senders(state, locked_services, locked_storm, false);
+}
+
+static void BM_find_service(benchmark::State& state) {
+    run_senders(state, production_services, production_storm, false);
+}
+
+static void BM_find_service_locked_reference_during_offer_storm(benchmark::State& state) {
+    run_senders(state, locked_services, locked_storm, true);
+}
+
+static void BM_find_service_during_offer_storm(benchmark::State& state) {
+    run_senders(state, production_services, production_storm, true);
+}
+
+BENCHMARK(BM_find_service_locked_reference)->Threads(sender_threads)->UseRealTime();
+BENCHMARK(BM_find_service)->Threads(sender_threads)->UseRealTime();
+BENCHMARK(BM_find_service_locked_reference_during_offer_storm)->Threads(sender_threads)->UseRealTime();
+BENCHMARK(BM_find_service_during_offer_storm)->Threads(sender_threads)->UseRealTime();
@@ -0,0 +1,115 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <iomanip>
+
+#include <boost/filesystem.hpp>
+
+#include <vsomeip/internal/logger.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+
+// Log lines per second of 8 threads that log to a file: the previous
+// message destructor (one global lock, time formatting and opening the file
+// per line) as reference, the synchronous writer with its persistent file,
+// and the asynchronous logger with both overflow policies.
+
+namespace {
+
+constexpr int logging_threads = 8;
+
+std::shared_ptr<vsomeip_v3::cfg::configuration_impl> configuration__;
+std::string logfile__;
+
+void configure(const std::string& _async) {
+    const auto its_base = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("bm_async_logger_%%%%%%%%");
+    logfile__ = its_base.string() + ".log";
+    const std::string its_path(its_base.string() + ".json");
+    {
+        std::ofstream its_file(its_path);
+        its_file << "{ \"logging\" : { \"level\" : \"info\", \"console\" : \"false\", \"file\" : { \"enable\" : \"true\", \"path\" : \""
+                 << logfile__ << "\" }" << _async << " } }";
+    }
+    // Loading the logging configuration initializes the logger
+    configuration__ = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_path);
+    configuration__->load("bm_async_logger");
+    boost::filesystem::remove(its_path);
+}
+
+void run(benchmark::State& state, const std::string& _async) {
+    if (state.thread_index() == 0) {
+        configure(_async);
+    }
+
+    int its_counter(0);
+    for (auto _ : state) {
+        VSOMEIP_INFO << "thread " << state.thread_index() << " sends message " << std::hex << its_counter++ << " to [1234.5678.9abc]";
+    }
+
+    if (state.thread_index() == 0) {
+        boost::filesystem::remove(logfile__);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+std::mutex reference_mutex__;
+
+// Writes the line as the message destructor did before
+void write_reference_line(const std::string& _text) {
+    std::scoped_lock its_lock{reference_mutex__};
+    const auto its_now = std::chrono::system_clock::now();
+    auto its_time_t = std::chrono::system_clock::to_time_t(its_now);
+    struct tm its_time;
+    localtime_r(&its_time_t, &its_time);
+    auto its_ms = std::chrono::duration_cast<std::chrono::microseconds>(its_now.time_since_epoch()).count() % 1000000;
+
+    std::ofstream its_logfile(logfile__, std::ios_base::app);
+    if (its_logfile.is_open()) {
+        its_logfile << std::dec << std::setw(4) << its_time.tm_year + 1900 << "-" << std::setfill('0') << std::setw(2) << its_time.tm_mon + 1
+                    << "-" << std::setw(2) << its_time.tm_mday << " " << std::setw(2) << its_time.tm_hour << ":" << std::setw(2)
+                    << its_time.tm_min << ":" << std::setw(2) << its_time.tm_sec << "." << std::setw(6) << its_ms << " [info] " << _text
+                    << std::endl;
+    }
+}
+
+} // namespace
+
+static void BM_log_file_reference(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        logfile__ = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("bm_async_logger_%%%%%%%%.log")).string();
+    }
+
+    int its_counter(0);
+    for (auto _ : state) {
+        std::stringstream its_text;
+        its_text << "thread " << state.thread_index() << " sends message " << std::hex << its_counter++ << " to [1234.5678.9abc]";
+        write_reference_line(its_text.str());
+    }
+
+    if (state.thread_index() == 0) {
+        boost::filesystem::remove(logfile__);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_log_file_sync(benchmark::State& state) {
+    run(state, "");
+}
+
+static void BM_log_file_async_drop(benchmark::State& state) {
+    run(state, ", \"async\" : { \"enable\" : \"true\", \"queue-size\" : \"4096\", \"overflow\" : \"drop\" }");
+}
+
+static void BM_log_file_async_block(benchmark::State& state) {
+    run(state, ", \"async\" : { \"enable\" : \"true\", \"queue-size\" : \"4096\", \"overflow\" : \"block\" }");
+}
+
+BENCHMARK(BM_log_file_reference)->Threads(logging_threads)->UseRealTime();
+BENCHMARK(BM_log_file_sync)->Threads(logging_threads)->UseRealTime();
+BENCHMARK(BM_log_file_async_drop)->Threads(logging_threads)->UseRealTime();
+BENCHMARK(BM_log_file_async_block)->Threads(logging_threads)->UseRealTime();
@@ -0,0 +1,82 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <iomanip>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "../../../implementation/utility/include/configuration_cache.hpp"
+
+// Reading a configuration folder with 1000 services and 20 events each:
+// parsing the JSON files versus reading the trees of a cache image. Both
+// variants include the evaluation of the trees, which the image does not save.
+
+namespace {
+
+struct configuration_folder_t {
+    configuration_folder_t() {
+        folder_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("bm_configuration_cache_%%%%%%%%");
+        boost::filesystem::create_directories(folder_ / "json");
+        for (int f = 0; f < 10; ++f) {
+            std::ofstream its_file((folder_ / "json" / ("services_" + std::to_string(f) + ".json")).string());
+            its_file << "{ \"services\" : [";
+            for (int s = 0; s < 100; ++s) {
+                its_file << (s ? "," : "") << "{ \"service\" : \"0x" << std::hex << std::setw(4) << std::setfill('0') << (f * 100 + s)
+                         << "\", \"instance\" : \"0x0001\", \"unreliable\" : \"30509\", \"events\" : [";
+                for (int e = 0; e < 20; ++e) {
+                    its_file << (e ? "," : "") << "{ \"event\" : \"0x" << std::hex << (0x8000 + e)
+                             << "\", \"is_field\" : \"false\", \"is_reliable\" : \"false\" }";
+                }
+                its_file << "] }";
+            }
+            its_file << "] }";
+        }
+        input_ = {(folder_ / "json").string()};
+        image_ = (folder_ / "vsomeip.cache").string();
+        std::string its_error;
+        vsomeip_v3::configuration_cache::create(input_, image_, its_error);
+    }
+
+    ~configuration_folder_t() { boost::filesystem::remove_all(folder_); }
+
+    boost::filesystem::path folder_;
+    std::set<std::string> input_;
+    std::string image_;
+};
+}
+
+static void BM_read_json_configuration(benchmark::State& state) {
+    configuration_folder_t its_folder;
+    for (auto _ : state) {
+        std::vector<vsomeip_v3::configuration_element> its_elements;
+        for (const auto& f : vsomeip_v3::configuration_cache::get_files(its_folder.input_)) {
+            boost::property_tree::ptree its_tree;
+            boost::property_tree::json_parser::read_json(f, its_tree);
+            its_elements.emplace_back(f, its_tree);
+        }
+        benchmark::DoNotOptimize(its_elements);
+    }
+}
+
+static void BM_read_cached_configuration(benchmark::State& state) {
+    configuration_folder_t its_folder;
+    for (auto _ : state) {
+        vsomeip_v3::configuration_cache its_cache;
+        std::vector<vsomeip_v3::configuration_element> its_elements;
+        if (!its_cache.open(its_folder.image_, its_folder.input_)
+            || !its_cache.get(its_elements, [](const std::string&) { return true; })) {
+            state.SkipWithError("invalid configuration cache");
+            break;
+        }
+        benchmark::DoNotOptimize(its_elements);
+    }
+}
+
+BENCHMARK(BM_read_json_configuration)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_read_cached_configuration)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+#include "../../../implementation/utility/include/handler_statistics.hpp"
+
+// Overhead the handler profiling adds to a dispatched handler call: reading
+// the thread CPU time and the steady clock before and after the call, and
+// recording both durations.
+
+using namespace vsomeip_v3;
+
+static void BM_handler_statistics_disabled(benchmark::State& state) {
+    std::unique_ptr<handler_statistics> its_statistics;
+    std::uint64_t its_calls(0);
+    for (auto _ : state) {
+        std::chrono::steady_clock::time_point its_start;
+        std::chrono::nanoseconds its_cpu_start(0);
+        if (its_statistics) {
+            its_start = std::chrono::steady_clock::now();
+            its_cpu_start = handler_statistics::get_thread_cpu_time();
+        }
+        benchmark::DoNotOptimize(++its_calls);
+        if (its_statistics) {
+            its_statistics->record(handler_kind_e::HK_MESSAGE, 0x1234, 0x8001, handler_statistics::get_thread_cpu_time() - its_cpu_start,
+                                   std::chrono::steady_clock::now() - its_start);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_handler_statistics_enabled(benchmark::State& state) {
+    auto its_statistics = std::make_unique<handler_statistics>(50);
+    std::uint64_t its_calls(0);
+    for (auto _ : state) {
+        std::chrono::steady_clock::time_point its_start;
+        std::chrono::nanoseconds its_cpu_start(0);
+        if (its_statistics) {
+            its_start = std::chrono::steady_clock::now();
+            its_cpu_start = handler_statistics::get_thread_cpu_time();
+        }
+        benchmark::DoNotOptimize(++its_calls);
+        if (its_statistics) {
+            its_statistics->record(handler_kind_e::HK_MESSAGE, 0x1234, static_cast<method_t>(0x8001 + its_calls % 16),
+                                   handler_statistics::get_thread_cpu_time() - its_cpu_start, std::chrono::steady_clock::now() - its_start);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_handler_statistics_disabled);
+BENCHMARK(BM_handler_statistics_enabled);
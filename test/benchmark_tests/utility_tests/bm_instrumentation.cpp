@@ -0,0 +1,38 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "../../../implementation/utility/include/instrumentation.hpp"
+
+// Overhead of the profiling mutex of instrumented builds on an uncontended
+// lock and unlock, compared to the plain mutex.
+
+using namespace vsomeip_v3;
+
+static void BM_instrumentation_plain_mutex(benchmark::State& state) {
+    std::mutex its_mutex;
+    std::uint64_t its_value(0);
+    for (auto _ : state) {
+        std::scoped_lock its_lock(its_mutex);
+        benchmark::DoNotOptimize(++its_value);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_instrumentation_profiling_mutex(benchmark::State& state) {
+    profiling_mutex<std::mutex> its_mutex("bm_instrumentation::mutex_");
+    std::uint64_t its_value(0);
+    for (auto _ : state) {
+        std::scoped_lock its_lock(its_mutex);
+        benchmark::DoNotOptimize(++its_value);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_instrumentation_plain_mutex);
+BENCHMARK(BM_instrumentation_profiling_mutex);
@@ -0,0 +1,96 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+#include "../../../implementation/utility/include/io_shards.hpp"
+
+// Handler throughput of 64 endpoints that each keep one receive handler
+// pending (re-posting it like a receive loop does), run by N io threads:
+// all threads sharing one io_context versus one io_context per thread
+// ("io_sharding"), where every endpoint is pinned to a shard.
+
+namespace {
+
+constexpr std::size_t endpoint_count = 64;
+constexpr std::size_t handlers_per_endpoint = 2000;
+
+struct endpoint_t {
+    explicit endpoint_t(boost::asio::io_context& _io) : io_(_io), checksum_(0) { }
+
+    void receive(std::size_t _remaining, std::atomic<std::size_t>& _done) {
+        boost::asio::post(io_, [this, _remaining, &_done] {
+            {
+                std::lock_guard<std::mutex> its_lock(mutex_);
+                checksum_ = checksum_ * 31 + _remaining;
+            }
+            if (_remaining > 1) {
+                receive(_remaining - 1, _done);
+            } else {
+                _done++;
+            }
+        });
+    }
+
+    boost::asio::io_context& io_;
+    std::mutex mutex_;
+    std::size_t checksum_;
+};
+
+void run(benchmark::State& state, bool _is_sharded) {
+    const auto its_thread_count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        boost::asio::io_context its_io;
+        if (_is_sharded) {
+            boost::asio::use_service<vsomeip_v3::io_shards>(its_io).resize(its_thread_count);
+        }
+
+        std::vector<std::unique_ptr<endpoint_t>> its_endpoints;
+        std::atomic<std::size_t> its_done(0);
+        for (std::size_t i = 0; i < endpoint_count; ++i) {
+            its_endpoints.push_back(std::make_unique<endpoint_t>(vsomeip_v3::io_shards::select(its_io, i)));
+            its_endpoints.back()->receive(handlers_per_endpoint, its_done);
+        }
+
+        std::vector<std::thread> its_threads;
+        for (std::size_t i = 1; i < its_thread_count; ++i) {
+            auto& its_thread_io = vsomeip_v3::io_shards::select(its_io, i);
+            its_threads.emplace_back([&its_thread_io] { its_thread_io.run(); });
+        }
+        its_io.run();
+        while (its_done < endpoint_count) {
+            std::this_thread::yield();
+        }
+        if (_is_sharded) {
+            boost::asio::use_service<vsomeip_v3::io_shards>(its_io).stop();
+        }
+        for (auto& t : its_threads) {
+            t.join();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * endpoint_count * handlers_per_endpoint));
+}
+}
+
+static void BM_shared_io_context(benchmark::State& state) {
+    run(state, false);
+}
+
+static void BM_io_context_per_thread(benchmark::State& state) {
+    run(state, true);
+}
+
+BENCHMARK(BM_shared_io_context)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BM_io_context_per_thread)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
@@ -0,0 +1,140 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <functional>
+#include <iomanip>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <malloc.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../../../implementation/security/include/policy.hpp"
+#include "../../../implementation/security/include/policy_manager_impl.hpp"
+#include "../../../implementation/utility/include/json_reader.hpp"
+
+// Loading a security configuration with 5000 policies: building the complete
+// tree with read_json and converting it afterwards versus converting each
+// policy while the file is read.
+//
+// "peak_rss_kB" is the growth of the peak resident set size during a single
+// load. It is measured in a child process whose peak is reset first, so that
+// neither the timed runs nor memory kept by the allocator influence it.
+
+namespace {
+
+struct policy_file_t {
+    policy_file_t() {
+        path_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("bm_json_reader_%%%%%%%%.json");
+        std::ofstream its_file(path_.string());
+        its_file << "{ \"security\" : { \"check_credentials\" : \"true\", \"policies\" : [";
+        for (int p = 0; p < 5000; ++p) {
+            its_file << (p ? "," : "") << "{ \"credentials\" : { \"uid\" : \"" << std::dec << (1000 + p) << "\", \"gid\" : \""
+                     << (1000 + p) << "\" }, \"allow\" : { \"requests\" : [";
+            for (int r = 0; r < 10; ++r) {
+                its_file << (r ? "," : "") << "{ \"service\" : \"0x" << std::hex << std::setw(4) << std::setfill('0') << (p + r)
+                         << "\", \"instances\" : [ { \"ids\" : [ \"0x1\" ], \"methods\" : [ { \"first\" : \"0x1\", \"last\" : \"0x7fff\" } ] } ] }";
+            }
+            its_file << "], \"offers\" : [ { \"service\" : \"0x" << std::hex << std::setw(4) << std::setfill('0') << p
+                     << "\", \"instance\" : \"0x1\" } ] } }";
+        }
+        its_file << "] } }";
+    }
+
+    ~policy_file_t() { boost::filesystem::remove(path_); }
+
+    boost::filesystem::path path_;
+};
+
+void load_with_read_json(const std::string& _path) {
+    vsomeip_v3::policy_manager_impl its_policy_manager;
+    boost::property_tree::ptree its_tree;
+    boost::property_tree::json_parser::read_json(_path, its_tree);
+    std::vector<std::shared_ptr<vsomeip_v3::policy>> its_policies;
+    for (const auto& p : its_tree.get_child("security.policies")) {
+        its_policies.push_back(its_policy_manager.convert_policy(p.second));
+    }
+    benchmark::DoNotOptimize(its_policies);
+}
+
+void load_with_json_reader(const std::string& _path) {
+    vsomeip_v3::policy_manager_impl its_policy_manager;
+    boost::property_tree::ptree its_tree;
+    std::vector<std::shared_ptr<vsomeip_v3::policy>> its_policies;
+    vsomeip_v3::json_ptree_builder its_builder(
+            its_tree, {"security", "policies"},
+            [&](const boost::property_tree::ptree& _policy) { its_policies.push_back(its_policy_manager.convert_policy(_policy)); });
+    std::string its_error;
+    vsomeip_v3::json_reader::parse_file(_path, its_builder, its_error);
+    benchmark::DoNotOptimize(its_policies);
+}
+
+long get_peak_rss() {
+    std::ifstream its_status("/proc/self/status");
+    std::string its_line;
+    while (std::getline(its_status, its_line)) {
+        if (its_line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stol(its_line.substr(6));
+        }
+    }
+    return -1;
+}
+
+// Peak RSS growth of "_load" in kB, or -1
+long peak_rss_growth(const std::function<void()>& _load) {
+    int its_pipe[2];
+    if (pipe(its_pipe) != 0) {
+        return -1;
+    }
+    const pid_t its_pid = fork();
+    if (its_pid == 0) {
+        close(its_pipe[0]);
+        malloc_trim(0);
+        // Resets the peak to the current resident set size
+        std::ofstream("/proc/self/clear_refs") << "5";
+        const long its_before = get_peak_rss();
+        _load();
+        const long its_growth = (its_before < 0 ? -1 : get_peak_rss() - its_before);
+        ssize_t its_written = write(its_pipe[1], &its_growth, sizeof(its_growth));
+        (void)its_written;
+        _exit(0);
+    }
+    close(its_pipe[1]);
+    long its_growth(-1);
+    if (its_pid > 0 && read(its_pipe[0], &its_growth, sizeof(its_growth)) != sizeof(its_growth)) {
+        its_growth = -1;
+    }
+    close(its_pipe[0]);
+    if (its_pid > 0) {
+        waitpid(its_pid, nullptr, 0);
+    }
+    return its_growth;
+}
+
+void run(benchmark::State& state, const std::function<void(const std::string&)>& _load) {
+    policy_file_t its_file;
+    const std::string its_path(its_file.path_.string());
+    for (auto _ : state) {
+        _load(its_path);
+    }
+    state.counters["peak_rss_kB"] = static_cast<double>(peak_rss_growth([&]() { _load(its_path); }));
+}
+} // namespace
+
+static void BM_load_policies_read_json(benchmark::State& state) {
+    run(state, load_with_read_json);
+}
+
+static void BM_load_policies_json_reader(benchmark::State& state) {
+    run(state, load_with_json_reader);
+}
+
+BENCHMARK(BM_load_policies_read_json)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_load_policies_json_reader)->Unit(benchmark::kMillisecond);
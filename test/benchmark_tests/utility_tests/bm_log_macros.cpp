@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <iomanip>
+
+#include <boost/filesystem.hpp>
+
+#include <vsomeip/internal/logger.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+
+// Cost of a typical hot path line, e.g. from application_impl::on_message:
+// suppressed by the log level (constructing the message as before the level
+// check was moved into the macros, streaming and structured macro) and
+// written asynchronously to a file (streamed and structured).
+
+namespace {
+
+std::shared_ptr<vsomeip_v3::cfg::configuration_impl> configuration__;
+std::string logfile__;
+
+void configure(const std::string& _async) {
+    const auto its_base = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("bm_log_macros_%%%%%%%%");
+    logfile__ = its_base.string() + ".log";
+    const std::string its_path(its_base.string() + ".json");
+    {
+        std::ofstream its_file(its_path);
+        its_file << "{ \"logging\" : { \"level\" : \"info\", \"console\" : \"false\", \"file\" : { \"enable\" : \"true\", \"path\" : \""
+                 << logfile__ << "\" }" << _async << " } }";
+    }
+    configuration__ = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_path);
+    configuration__->load("bm_log_macros");
+    boost::filesystem::remove(its_path);
+}
+
+void cleanup() {
+    boost::filesystem::remove(logfile__);
+}
+
+const std::string async__(", \"async\" : { \"enable\" : \"true\", \"queue-size\" : \"4096\", \"overflow\" : \"block\" }");
+
+const std::uint16_t service__(0x1234), instance__(0x5678);
+
+} // namespace
+
+static void BM_suppressed_message_reference(benchmark::State& state) {
+    configure("");
+    std::uint16_t its_method(0);
+    for (auto _ : state) {
+        vsomeip_v3::logger::message(vsomeip_v3::logger::level_e::LL_DEBUG)
+                << "on_message [" << std::hex << std::setfill('0') << std::setw(4) << service__ << "." << std::setw(4) << instance__
+                << "." << std::setw(4) << its_method++ << "]";
+    }
+    cleanup();
+}
+
+static void BM_suppressed_stream(benchmark::State& state) {
+    configure("");
+    std::uint16_t its_method(0);
+    for (auto _ : state) {
+        VSOMEIP_DEBUG << "on_message [" << std::hex << std::setfill('0') << std::setw(4) << service__ << "." << std::setw(4) << instance__
+                      << "." << std::setw(4) << its_method++ << "]";
+    }
+    cleanup();
+}
+
+static void BM_suppressed_structured(benchmark::State& state) {
+    configure("");
+    std::uint16_t its_method(0);
+    for (auto _ : state) {
+        VSOMEIP_DEBUG_F("on_message [{:04x}.{:04x}.{:04x}]", service__, instance__, its_method++);
+    }
+    cleanup();
+}
+
+static void BM_async_stream(benchmark::State& state) {
+    configure(async__);
+    std::uint16_t its_method(0);
+    for (auto _ : state) {
+        VSOMEIP_INFO << "on_message [" << std::hex << std::setfill('0') << std::setw(4) << service__ << "." << std::setw(4) << instance__
+                     << "." << std::setw(4) << its_method++ << "]";
+    }
+    cleanup();
+}
+
+static void BM_async_structured(benchmark::State& state) {
+    configure(async__);
+    std::uint16_t its_method(0);
+    for (auto _ : state) {
+        VSOMEIP_INFO_F("on_message [{:04x}.{:04x}.{:04x}]", service__, instance__, its_method++);
+    }
+    cleanup();
+}
+
+BENCHMARK(BM_suppressed_message_reference);
+BENCHMARK(BM_suppressed_stream);
+BENCHMARK(BM_suppressed_structured);
+BENCHMARK(BM_async_stream);
+BENCHMARK(BM_async_structured);
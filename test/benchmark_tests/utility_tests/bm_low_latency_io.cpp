@@ -0,0 +1,126 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include "../../../implementation/utility/include/low_latency_io.hpp"
+
+// Latency from sending a datagram over loopback until its receive handler
+// runs, with the handler run by an io thread that waits in epoll (normal
+// mode) versus one that busy polls the io_context ("low_latency"). Reports
+// the 50th, 99th and 99.9th percentile in microseconds.
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct receiver_t {
+    explicit receiver_t(boost::asio::io_context& _io) :
+        socket_(_io, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0)), received_(0) { }
+
+    void receive() {
+        socket_.async_receive(boost::asio::buffer(buffer_), [this](const boost::system::error_code& _error, std::size_t _bytes) {
+            if (_error) {
+                return;
+            }
+            if (_bytes == sizeof(clock_type::rep)) {
+                clock_type::rep its_sent;
+                std::memcpy(&its_sent, buffer_, sizeof(its_sent));
+                latency_ = clock_type::now().time_since_epoch().count() - its_sent;
+                received_++;
+            }
+            receive();
+        });
+    }
+
+    boost::asio::ip::udp::socket socket_;
+    unsigned char buffer_[64];
+    clock_type::rep latency_;
+    std::atomic<std::size_t> received_;
+};
+
+void report(benchmark::State& state, std::vector<clock_type::rep>& _latencies) {
+    if (_latencies.empty()) {
+        return;
+    }
+    std::sort(_latencies.begin(), _latencies.end());
+    const auto its_percentile = [&_latencies](double _p) {
+        const auto its_index = static_cast<std::size_t>(_p / 100.0 * static_cast<double>(_latencies.size() - 1));
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::duration(_latencies[its_index])).count())
+                / 1000.0;
+    };
+    state.counters["p50_us"] = its_percentile(50.0);
+    state.counters["p99_us"] = its_percentile(99.0);
+    state.counters["p999_us"] = its_percentile(99.9);
+}
+
+void run(benchmark::State& state, bool _is_low_latency) {
+    boost::asio::io_context its_io;
+    boost::asio::io_context* its_receive_io(&its_io);
+    vsomeip_v3::low_latency_io* its_low_latency(nullptr);
+    if (_is_low_latency) {
+        its_low_latency = &boost::asio::use_service<vsomeip_v3::low_latency_io>(its_io);
+        its_low_latency->configure({{0x1234, 0x0001}}, {}, 0);
+        its_receive_io = &its_low_latency->get_polled();
+    }
+
+    receiver_t its_receiver(*its_receive_io);
+    its_receiver.receive();
+
+    std::thread its_thread;
+    auto its_work = boost::asio::make_work_guard(its_io);
+    if (its_low_latency) {
+        its_low_latency->start("bm_ll");
+    } else {
+        its_thread = std::thread([&its_io] { its_io.run(); });
+    }
+
+    boost::asio::ip::udp::socket its_sender(its_io, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    its_sender.connect(its_receiver.socket_.local_endpoint());
+
+    std::vector<clock_type::rep> its_latencies;
+    its_latencies.reserve(100000);
+    for (auto _ : state) {
+        const auto its_expected = its_receiver.received_ + 1;
+        const auto its_sent = clock_type::now().time_since_epoch().count();
+        its_sender.send(boost::asio::buffer(&its_sent, sizeof(its_sent)));
+        while (its_receiver.received_ < its_expected) {
+            std::this_thread::yield();
+        }
+        its_latencies.push_back(its_receiver.latency_);
+    }
+
+    if (its_low_latency) {
+        its_low_latency->stop();
+    } else {
+        its_work.reset();
+        its_io.stop();
+        its_thread.join();
+    }
+    report(state, its_latencies);
+}
+}
+
+static void BM_receive_latency_epoll(benchmark::State& state) {
+    run(state, false);
+}
+
+static void BM_receive_latency_busy_poll(benchmark::State& state) {
+    run(state, true);
+}
+
+BENCHMARK(BM_receive_latency_epoll)->Iterations(10000)->UseRealTime();
+BENCHMARK(BM_receive_latency_busy_poll)->Iterations(10000)->UseRealTime();
@@ -0,0 +1,56 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+
+#include "../../../implementation/utility/include/metrics.hpp"
+
+// Cost of counting a sent message (messages and bytes) from several threads:
+// with a single pair of shared atomics, with the slotted endpoint counters and
+// through the per-service lookup.
+
+using namespace vsomeip_v3;
+
+namespace {
+
+struct shared_counters_t {
+    std::atomic<std::uint64_t> messages_ {0};
+    std::atomic<std::uint64_t> bytes_ {0};
+};
+
+} // namespace
+
+static void BM_metrics_shared_atomic(benchmark::State& state) {
+    static shared_counters_t its_counters;
+    for (auto _ : state) {
+        its_counters.messages_.fetch_add(1, std::memory_order_relaxed);
+        its_counters.bytes_.fetch_add(64, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_metrics_endpoint_counters(benchmark::State& state) {
+    static endpoint_counters its_counters;
+    for (auto _ : state) {
+        its_counters.add(EC_MESSAGES_SENT);
+        its_counters.add(EC_BYTES_SENT, 64);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_metrics_service_record(benchmark::State& state) {
+    static service_metrics its_metrics(64);
+    std::uint32_t its_counter(static_cast<std::uint32_t>(state.thread_index()));
+    for (auto _ : state) {
+        its_metrics.record_sent(static_cast<service_t>(0x1000 + (its_counter++ % 32)), 0x0001, 64);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_metrics_shared_atomic)->Threads(1)->Threads(8)->UseRealTime();
+BENCHMARK(BM_metrics_endpoint_counters)->Threads(1)->Threads(8)->UseRealTime();
+BENCHMARK(BM_metrics_service_record)->Threads(1)->Threads(8)->UseRealTime();
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/asio/ip/address_v4.hpp>
+
+#include "../../../implementation/tracing/include/pcapng_writer.hpp"
+
+// Time a traced message costs the sending thread when it is captured into a
+// pcapng file, for a 64 byte and a 1400 byte message. The counter "dropped"
+// is the share of messages that did not fit into the buffer, which is most of
+// them as this loop produces far faster than any sender.
+
+using namespace vsomeip_v3;
+
+namespace {
+
+const char* bm_path = "/tmp/bm_pcapng_writer.pcapng";
+
+void BM_pcapng_writer_write(benchmark::State& _state) {
+    auto its_writer = std::make_unique<trace::pcapng_writer>(bm_path, 64 * 1024 * 1024, 1, 16 * 1024 * 1024);
+
+    trace::header its_header;
+    its_header.prepare(boost::asio::ip::make_address_v4("10.0.0.1"), 30509, trace::protocol_e::udp, true, 0x0001);
+    std::vector<byte_t> its_message(static_cast<std::size_t>(_state.range(0)), 0xAB);
+
+    for (auto _ : _state) {
+        its_writer->write(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), static_cast<std::uint32_t>(its_message.size()),
+                          false);
+    }
+
+    its_writer->flush();
+    _state.counters["dropped"] = benchmark::Counter(static_cast<double>(its_writer->get_dropped()), benchmark::Counter::kAvgIterations);
+    its_writer.reset();
+    std::remove(bm_path);
+    std::remove((std::string(bm_path) + ".1").c_str());
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations()) * _state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_pcapng_writer_write)->Arg(64)->Arg(1400);
@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "../../../implementation/utility/include/timing_wheel.hpp"
+
+// Compares one boost::asio::steady_timer per object against the shared timing
+// wheel with 10k pending deadlines: re-arming a single timer (what every
+// train dispatch does) and letting all deadlines expire.
+
+namespace {
+
+constexpr std::size_t pending_deadlines = 10000;
+
+std::chrono::steady_clock::duration get_delay(std::size_t _index, std::chrono::milliseconds _base) {
+    return _base + std::chrono::microseconds((_index * 7919) % 5000);
+}
+
+template<typename Timer>
+void run_rearm(benchmark::State& state) {
+    boost::asio::io_context its_io;
+    std::vector<std::unique_ptr<Timer>> its_timers;
+    for (std::size_t i = 0; i < pending_deadlines; ++i) {
+        its_timers.push_back(std::make_unique<Timer>(its_io));
+        its_timers.back()->expires_after(get_delay(i, std::chrono::milliseconds(60000)));
+        its_timers.back()->async_wait([](const boost::system::error_code&) { });
+    }
+
+    std::size_t its_index(0);
+    for (auto _ : state) {
+        auto& its_timer = its_timers[its_index];
+        its_timer->expires_after(get_delay(its_index, std::chrono::milliseconds(60000)));
+        its_timer->async_wait([](const boost::system::error_code&) { });
+        its_io.poll(); // runs the handler of the cancelled wait
+        its_index = (its_index + 1) % pending_deadlines;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    for (auto& t : its_timers) {
+        t->cancel();
+    }
+    its_io.poll();
+}
+
+template<typename Timer>
+void run_expiry(benchmark::State& state) {
+    boost::asio::io_context its_io;
+    std::vector<std::unique_ptr<Timer>> its_timers;
+    for (std::size_t i = 0; i < pending_deadlines; ++i) {
+        its_timers.push_back(std::make_unique<Timer>(its_io));
+    }
+
+    std::size_t its_expired(0);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < pending_deadlines; ++i) {
+            its_timers[i]->expires_after(get_delay(i, std::chrono::milliseconds(0)));
+            its_timers[i]->async_wait([&its_expired](const boost::system::error_code& _error) {
+                if (!_error) {
+                    its_expired++;
+                }
+            });
+        }
+        its_io.restart();
+        its_io.run();
+    }
+    benchmark::DoNotOptimize(its_expired);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pending_deadlines));
+}
+}
+
+static void BM_rearm_steady_timer_10k_pending(benchmark::State& state) {
+    run_rearm<boost::asio::steady_timer>(state);
+}
+
+static void BM_rearm_timing_wheel_10k_pending(benchmark::State& state) {
+    run_rearm<vsomeip_v3::wheel_timer>(state);
+}
+
+static void BM_expire_steady_timer_10k(benchmark::State& state) {
+    run_expiry<boost::asio::steady_timer>(state);
+}
+
+static void BM_expire_timing_wheel_10k(benchmark::State& state) {
+    run_expiry<vsomeip_v3::wheel_timer>(state);
+}
+
+BENCHMARK(BM_rearm_steady_timer_10k_pending);
+BENCHMARK(BM_rearm_timing_wheel_10k_pending);
+BENCHMARK(BM_expire_steady_timer_10k);
+BENCHMARK(BM_expire_timing_wheel_10k);
@@ -0,0 +1,89 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <mutex>
+
+#include "../../../implementation/tracing/include/filter_table.hpp"
+
+// Decides for a traced message which channels forward it, with 8 channels of
+// 8 filters each: as connector_impl::trace did before (connector lock, each
+// channel evaluating its filters under its own lock) and with the compiled
+// filter table.
+
+using namespace vsomeip_v3;
+
+namespace {
+
+constexpr int channel_count = 8;
+constexpr int filters_per_channel = 8;
+
+struct channels_t {
+    channels_t() {
+        for (int c = 0; c < channel_count; ++c) {
+            auto its_channel = std::make_shared<trace::channel_impl>("CH" + std::to_string(c), "");
+            for (int f = 0; f < filters_per_channel; ++f) {
+                const auto its_service = static_cast<service_t>(0x1000 + c * 0x100 + f);
+                if (f % 4 == 3) {
+                    its_channel->add_filter(trace::match_t{its_service, 0x0001, 0x0001}, trace::match_t{its_service, 0x0010, 0x7fff},
+                                            trace::filter_type_e::POSITIVE);
+                } else if (f % 4 == 2) {
+                    its_channel->add_filter(trace::match_t{its_service, ANY_INSTANCE, 0x8001}, trace::filter_type_e::NEGATIVE);
+                } else {
+                    its_channel->add_filter(trace::match_t{its_service, ANY_INSTANCE, ANY_METHOD}, trace::filter_type_e::POSITIVE);
+                }
+            }
+            channels_[its_channel->get_id()] = its_channel;
+            rules_.push_back(its_channel->get_filters());
+        }
+        table_ = std::make_shared<trace::filter_table>(std::vector<trace::filter_rules_t>(rules_));
+    }
+
+    std::map<std::string, std::shared_ptr<trace::channel_impl>> channels_;
+    std::mutex mutex_;
+    std::vector<trace::filter_rules_t> rules_;
+    std::shared_ptr<trace::filter_table> table_;
+};
+
+channels_t& get_channels() {
+    static channels_t its_channels;
+    return its_channels;
+}
+
+} // namespace
+
+static void BM_trace_filter_reference(benchmark::State& state) {
+    auto& its_channels = get_channels();
+    std::uint32_t its_counter(static_cast<std::uint32_t>(state.thread_index()));
+    for (auto _ : state) {
+        const auto its_service = static_cast<service_t>(0x1000 + (its_counter++ % 0x900));
+        std::size_t its_forwarded(0);
+        std::scoped_lock its_lock(its_channels.mutex_);
+        for (auto& c : its_channels.channels_) {
+            if (c.second->matches(its_service, 0x0002, 0x8001).first) {
+                ++its_forwarded;
+            }
+        }
+        benchmark::DoNotOptimize(its_forwarded);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_trace_filter_table(benchmark::State& state) {
+    const auto its_table = get_channels().table_;
+    std::uint32_t its_counter(static_cast<std::uint32_t>(state.thread_index()));
+    for (auto _ : state) {
+        const auto its_service = static_cast<service_t>(0x1000 + (its_counter++ % 0x900));
+        std::size_t its_forwarded(0);
+        its_table->for_each_match(its_service, 0x0002, 0x8001, [&its_forwarded](std::size_t, bool) { ++its_forwarded; });
+        benchmark::DoNotOptimize(its_forwarded);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_trace_filter_reference)->Threads(1)->Threads(8)->UseRealTime();
+BENCHMARK(BM_trace_filter_table)->Threads(1)->Threads(8)->UseRealTime();
@@ -104,6 +104,8 @@ private:
         set_user_timeout_ = _timeout;
         return true;
     }
+
+    [[nodiscard]] bool enable_receive_timestamps() override { return false; }
 #endif
 
 #if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
@@ -127,7 +129,14 @@ private:
         state_->write(_buffer, std::move(_handler));
     }
 
-    virtual void async_write(boost::asio::const_buffer const&, completion_condition, rw_handler) override { }
+    // the fake handle always writes all bytes at once, so the completion condition is not needed
+    virtual void async_write(boost::asio::const_buffer const& _buffer, completion_condition, rw_handler _handler) override {
+        state_->write({_buffer}, std::move(_handler));
+    }
+
+    virtual void async_write(std::vector<boost::asio::const_buffer> const& _buffer, completion_condition, rw_handler _handler) override {
+        state_->write(_buffer, std::move(_handler));
+    }
 
     friend class fake_tcp_acceptor_handle;
     std::shared_ptr<fake_tcp_socket_handle> state_;
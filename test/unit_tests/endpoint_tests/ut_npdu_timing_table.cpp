@@ -0,0 +1,94 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/configuration/include/npdu_timing_table.hpp"
+
+using namespace std::chrono_literals;
+using vsomeip_v3::npdu_timing_table;
+
+TEST(npdu_timing_table_test, falls_back_to_defaults) {
+    npdu_timing_table its_table(2ms, 5ms);
+    its_table.add(0x1000, 0x0002, 20ms, 200ms);
+    its_table.add(0x1000, 0x0001, 10ms, 100ms);
+    its_table.add(0x0fff, 0x0001, 30ms, 300ms);
+    its_table.add(0x1000, 0x0001, 11ms, 110ms);
+    EXPECT_EQ(its_table.size(), 3u);
+
+    std::chrono::nanoseconds its_debounce, its_retention;
+    its_table.get(0x1000, 0x0001, its_debounce, its_retention);
+    EXPECT_EQ(its_debounce, 11ms);
+    EXPECT_EQ(its_retention, 110ms);
+    its_table.get(0x1000, 0x0002, its_debounce, its_retention);
+    EXPECT_EQ(its_debounce, 20ms);
+    EXPECT_EQ(its_retention, 200ms);
+    its_table.get(0x0fff, 0x0001, its_debounce, its_retention);
+    EXPECT_EQ(its_debounce, 30ms);
+    its_table.get(0x1000, 0x0003, its_debounce, its_retention);
+    EXPECT_EQ(its_debounce, 2ms);
+    EXPECT_EQ(its_retention, 5ms);
+
+    // Local endpoints use an empty table
+    npdu_timing_table its_empty;
+    its_empty.get(0x1000, 0x0001, its_debounce, its_retention);
+    EXPECT_EQ(its_debounce, 0ms);
+    EXPECT_EQ(its_retention, 0ms);
+}
+
+TEST(npdu_timing_table_test, matches_configured_timings) {
+    const auto its_path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("ut_npdu_timing_table_%%%%%%%%.json");
+    {
+        std::ofstream its_file(its_path.string());
+        its_file << R"({
+            "npdu-default-timings" : {
+                "debounce-time-request" : "3", "max-retention-time-request" : "6",
+                "debounce-time-response" : "4", "max-retention-time-response" : "8"
+            },
+            "services" : [
+                { "service" : "0x1000", "instance" : "0x1", "unicast" : "10.0.0.1", "unreliable" : "30509",
+                  "debounce-times" : {
+                    "requests" : { "0x1001" : { "debounce-time" : "10", "maximum-retention-time" : "100" } },
+                    "responses" : { "0x1002" : { "debounce-time" : "20", "maximum-retention-time" : "200" } } } },
+                { "service" : "0x2000", "instance" : "0x1", "unicast" : "10.0.0.1", "unreliable" : "30509",
+                  "debounce-times" : {
+                    "requests" : { "0x2001" : { "debounce-time" : "30", "maximum-retention-time" : "300" } } } },
+                { "service" : "0x3000", "instance" : "0x1", "unicast" : "10.0.0.2", "unreliable" : "30509",
+                  "debounce-times" : {
+                    "requests" : { "0x3001" : { "debounce-time" : "40", "maximum-retention-time" : "400" } } } }
+            ]
+        })";
+    }
+    auto its_configuration = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_path.string());
+    ASSERT_TRUE(its_configuration->load("ut_npdu_timing_table"));
+    boost::filesystem::remove(its_path);
+
+    const auto its_requests = its_configuration->get_npdu_timings_requests("10.0.0.1", 30509);
+    const auto its_responses = its_configuration->get_npdu_timings_responses("10.0.0.1", 30509);
+    EXPECT_EQ(its_requests.size(), 2u);
+    EXPECT_EQ(its_responses.size(), 1u);
+
+    for (const vsomeip_v3::service_t its_service : std::vector<vsomeip_v3::service_t>{0x1000, 0x2000, 0x3000}) {
+        for (const vsomeip_v3::method_t its_method : std::vector<vsomeip_v3::method_t>{0x0001, 0x1001, 0x1002, 0x2001, 0x3001}) {
+            std::chrono::nanoseconds its_debounce, its_retention, its_expected_debounce, its_expected_retention;
+            its_requests.get(its_service, its_method, its_debounce, its_retention);
+            its_configuration->get_configured_timing_requests(its_service, "10.0.0.1", 30509, its_method, &its_expected_debounce,
+                                                              &its_expected_retention);
+            EXPECT_EQ(its_debounce, its_expected_debounce);
+            EXPECT_EQ(its_retention, its_expected_retention);
+
+            its_responses.get(its_service, its_method, its_debounce, its_retention);
+            its_configuration->get_configured_timing_responses(its_service, "10.0.0.1", 30509, its_method, &its_expected_debounce,
+                                                               &its_expected_retention);
+            EXPECT_EQ(its_debounce, its_expected_debounce);
+            EXPECT_EQ(its_retention, its_expected_retention);
+        }
+    }
+}
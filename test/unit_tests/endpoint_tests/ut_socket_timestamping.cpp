@@ -0,0 +1,155 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/endpoints/include/socket_timestamping.hpp"
+
+#if defined(__linux__)
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/asio/write.hpp>
+
+#include <thread>
+
+using namespace vsomeip_v3;
+
+namespace {
+// The kernel enables the receive timestamps of the network stack with a
+// deferred work item, so packets sent right after the first socket enabled
+// them may arrive without timestamp. Sends probes until one is received with
+// a timestamp.
+template<typename Send_, typename Receive_>
+bool wait_for_timestamping(Send_ _send, Receive_ _receive) {
+    const auto its_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < its_deadline) {
+        _send();
+        receive_timestamp::socket_time_t its_time;
+        boost::system::error_code its_error;
+        while ((its_error = _receive(its_time)) == boost::asio::error::would_block && std::chrono::steady_clock::now() < its_deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (!its_error && its_time != receive_timestamp::socket_time_t()) {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+TEST(socket_timestamping_test, stream_receive_provides_kernel_time) {
+    boost::asio::io_context its_io;
+    boost::asio::ip::tcp::acceptor its_acceptor(its_io, {boost::asio::ip::address_v4::loopback(), 0});
+    boost::asio::ip::tcp::socket its_receiver(its_io);
+    boost::asio::ip::tcp::socket its_sender(its_io);
+    its_sender.connect(its_acceptor.local_endpoint());
+    its_acceptor.accept(its_receiver);
+    ASSERT_TRUE(socket_timestamping::enable(its_receiver.native_handle()));
+    unsigned char its_probe(0);
+    ASSERT_TRUE(wait_for_timestamping([&] { boost::asio::write(its_sender, boost::asio::buffer(&its_probe, 1)); },
+                                      [&](receive_timestamp::socket_time_t& _time) {
+                                          std::size_t its_bytes(0);
+                                          return socket_timestamping::receive(its_receiver.native_handle(), boost::asio::buffer(&its_probe, 1),
+                                                                              its_bytes, _time);
+                                      }));
+
+    const auto its_before = std::chrono::system_clock::now();
+    const std::vector<unsigned char> its_data(100, 0x42);
+    boost::asio::write(its_sender, boost::asio::buffer(its_data));
+
+    std::vector<unsigned char> its_buffer(its_data.size());
+    std::size_t its_received(0);
+    receive_timestamp::socket_time_t its_time;
+    socket_timestamping::async_receive(its_receiver, boost::asio::buffer(its_buffer),
+                                       [&](const boost::system::error_code& _error, std::size_t _bytes) {
+                                           EXPECT_FALSE(_error);
+                                           its_received = _bytes;
+                                           its_time = receive_timestamp::get_socket_time();
+                                       });
+    its_io.run();
+
+    EXPECT_EQ(its_received, its_data.size());
+    EXPECT_EQ(its_buffer, its_data);
+    EXPECT_GE(its_time, its_before - std::chrono::milliseconds(1));
+    EXPECT_LE(its_time, std::chrono::system_clock::now());
+    // The scope ends with the handler
+    EXPECT_EQ(receive_timestamp::get_socket_time(), receive_timestamp::socket_time_t());
+}
+
+TEST(socket_timestamping_test, stream_receive_reports_eof) {
+    boost::asio::io_context its_io;
+    boost::asio::ip::tcp::acceptor its_acceptor(its_io, {boost::asio::ip::address_v4::loopback(), 0});
+    boost::asio::ip::tcp::socket its_receiver(its_io);
+    boost::asio::ip::tcp::socket its_sender(its_io);
+    its_sender.connect(its_acceptor.local_endpoint());
+    its_acceptor.accept(its_receiver);
+    ASSERT_TRUE(socket_timestamping::enable(its_receiver.native_handle()));
+    its_sender.close();
+
+    unsigned char its_buffer[16];
+    boost::system::error_code its_error;
+    socket_timestamping::async_receive(its_receiver, boost::asio::buffer(its_buffer),
+                                       [&its_error](const boost::system::error_code& _error, std::size_t) { its_error = _error; });
+    its_io.run();
+
+    EXPECT_EQ(its_error, boost::asio::error::eof);
+}
+
+TEST(socket_timestamping_test, datagram_receive_provides_kernel_time) {
+    boost::asio::io_context its_io;
+    auto its_receiver = std::make_shared<boost::asio::ip::udp::socket>(
+            its_io, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    boost::asio::ip::udp::socket its_sender(its_io, {boost::asio::ip::address_v4::loopback(), 0});
+    ASSERT_TRUE(socket_timestamping::enable(its_receiver->native_handle()));
+
+    const unsigned char its_data[8]{};
+    unsigned char its_buffer[8];
+    boost::asio::ip::udp::endpoint its_remote;
+    ASSERT_TRUE(wait_for_timestamping([&] { its_sender.send_to(boost::asio::buffer(its_data), its_receiver->local_endpoint()); },
+                                      [&](receive_timestamp::socket_time_t& _time) {
+                                          std::size_t its_bytes(0);
+                                          return socket_timestamping::receive_from(its_receiver->native_handle(),
+                                                                                   boost::asio::buffer(its_buffer), its_remote, its_bytes, _time);
+                                      }));
+    EXPECT_EQ(its_remote, its_sender.local_endpoint());
+
+    const auto its_before = std::chrono::system_clock::now();
+    its_sender.send_to(boost::asio::buffer(its_data), its_receiver->local_endpoint());
+
+    std::size_t its_received(0);
+    receive_timestamp::socket_time_t its_time;
+    its_remote = boost::asio::ip::udp::endpoint();
+    socket_timestamping::async_receive_from(its_receiver, boost::asio::buffer(its_buffer), its_remote,
+                                            [&](const boost::system::error_code& _error, std::size_t _bytes) {
+                                                EXPECT_FALSE(_error);
+                                                its_received = _bytes;
+                                                its_time = receive_timestamp::get_socket_time();
+                                            });
+    its_io.run();
+
+    EXPECT_EQ(its_received, sizeof(its_data));
+    EXPECT_EQ(its_remote, its_sender.local_endpoint());
+    EXPECT_GE(its_time, its_before - std::chrono::milliseconds(1));
+    EXPECT_LE(its_time, std::chrono::system_clock::now());
+}
+
+TEST(socket_timestamping_test, datagram_receive_is_aborted_for_destroyed_socket) {
+    boost::asio::io_context its_io;
+    auto its_receiver = std::make_shared<boost::asio::ip::udp::socket>(
+            its_io, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+
+    unsigned char its_buffer[8];
+    boost::asio::ip::udp::endpoint its_remote;
+    boost::system::error_code its_error;
+    socket_timestamping::async_receive_from(its_receiver, boost::asio::buffer(its_buffer), its_remote,
+                                            [&its_error](const boost::system::error_code& _error, std::size_t) { its_error = _error; });
+    its_receiver.reset();
+    its_io.run();
+
+    EXPECT_EQ(its_error, boost::asio::error::operation_aborted);
+}
+
+#endif
@@ -0,0 +1,314 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/constants.hpp>
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/endpoints/include/tcp_socket.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wkeyword-macro"
+#endif
+
+#define private public
+#define protected public
+#include "../../../implementation/endpoints/include/tcp_client_endpoint_impl.hpp"
+#undef protected
+#undef private
+
+using namespace vsomeip_v3;
+
+namespace {
+
+// Connected socket that records the writes instead of sending them. The
+// writes complete when the test calls the recorded handler.
+class recording_tcp_socket : public tcp_socket {
+public:
+    struct write_t {
+        std::vector<std::vector<byte_t>> buffers_;
+        rw_handler handler_;
+    };
+
+    explicit recording_tcp_socket(std::deque<write_t>& _writes) : writes_(_writes) { }
+
+    bool is_open() const override { return is_open_; }
+    int native_handle() override { return -1; }
+    void open(boost::asio::ip::tcp::endpoint::protocol_type, boost::system::error_code&) override { is_open_ = true; }
+    void bind(boost::asio::ip::tcp::endpoint const&, boost::system::error_code&) override { }
+    void close(boost::system::error_code&) override { is_open_ = false; }
+
+    void cancel(boost::system::error_code&) override { }
+    void shutdown(boost::asio::ip::tcp::socket::shutdown_type, boost::system::error_code&) override { }
+    boost::asio::ip::tcp::endpoint local_endpoint(boost::system::error_code&) const override { return {}; }
+    boost::asio::ip::tcp::endpoint remote_endpoint(boost::system::error_code&) const override { return {}; }
+    void set_option(boost::asio::ip::tcp::no_delay, boost::system::error_code&) override { }
+    void set_option(boost::asio::ip::tcp::socket::keep_alive, boost::system::error_code&) override { }
+    void set_option(boost::asio::ip::tcp::socket::linger, boost::system::error_code&) override { }
+    void set_option(boost::asio::ip::tcp::socket::reuse_address, boost::system::error_code&) override { }
+    void async_connect(boost::asio::ip::tcp::endpoint const&, connect_handler) override { }
+    void async_receive(boost::asio::mutable_buffer, rw_handler) override { }
+
+    void async_write(std::vector<boost::asio::const_buffer> const& _buffers, rw_handler _handler) override {
+        record(_buffers, std::move(_handler));
+    }
+    void async_write(boost::asio::const_buffer const& _buffer, completion_condition, rw_handler _handler) override {
+        record({_buffer}, std::move(_handler));
+    }
+    void async_write(std::vector<boost::asio::const_buffer> const& _buffers, completion_condition, rw_handler _handler) override {
+        record(_buffers, std::move(_handler));
+    }
+
+#if defined(__linux__) || defined(ANDROID)
+    bool set_user_timeout(unsigned int) override { return true; }
+    bool enable_receive_timestamps() override { return true; }
+#endif
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+    bool bind_to_device(std::string const&) override { return true; }
+    bool can_read_fd_flags() override { return true; }
+#endif
+
+private:
+    void record(std::vector<boost::asio::const_buffer> const& _buffers, rw_handler _handler) {
+        write_t its_write;
+        for (const auto& b : _buffers) {
+            const auto its_data = static_cast<const byte_t*>(b.data());
+            its_write.buffers_.emplace_back(its_data, its_data + b.size());
+        }
+        its_write.handler_ = std::move(_handler);
+        writes_.push_back(std::move(its_write));
+    }
+
+    std::deque<write_t>& writes_;
+    bool is_open_{true};
+};
+
+class tcp_gather_write_test : public ::testing::Test {
+protected:
+    void create_endpoint(std::size_t _max_buffers, std::size_t _max_bytes) {
+        const auto its_path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("ut_tcp_gather_write_%%%%%%%%.json");
+        {
+            std::ofstream its_file(its_path.string());
+            its_file << R"({ "unicast" : "127.0.0.1", "tcp-gather-write-max-buffers" : ")" << _max_buffers
+                     << R"(", "tcp-gather-write-max-bytes" : ")" << _max_bytes << R"(" })";
+        }
+        auto its_configuration = std::make_shared<cfg::configuration_impl>(its_path.string());
+        ASSERT_TRUE(its_configuration->load("ut_tcp_gather_write"));
+        boost::filesystem::remove(its_path);
+
+        const boost::asio::ip::tcp::endpoint its_local(boost::asio::ip::address_v4::loopback(), ILLEGAL_PORT);
+        const boost::asio::ip::tcp::endpoint its_remote(boost::asio::ip::address_v4::loopback(), 30509);
+        endpoint_ = std::make_shared<tcp_client_endpoint_impl>(nullptr, nullptr, its_local, its_remote, io_, its_configuration);
+        endpoint_->socket_ = std::make_unique<recording_tcp_socket>(writes_);
+    }
+
+    // Queues "_count" messages of "_size" bytes and starts sending the first one,
+    // like client_endpoint_impl::queue_train does
+    void queue_and_send(std::size_t _count, std::size_t _size) {
+        std::pair<message_buffer_ptr_t, uint32_t> its_entry;
+        {
+            std::scoped_lock its_lock(endpoint_->mutex_);
+            for (std::size_t i = 0; i < _count; ++i) {
+                auto its_buffer = std::make_shared<message_buffer_t>(_size, byte_t(i));
+                its_buffer->at(VSOMEIP_SESSION_POS_MAX) = byte_t(i + 1);
+                endpoint_->queue_.emplace_back(its_buffer, 0);
+                endpoint_->queue_size_ += _size;
+            }
+            endpoint_->is_sending_ = true;
+            its_entry = endpoint_->queue_.front();
+        }
+        endpoint_->send_queued(its_entry);
+    }
+
+    // Completes the oldest recorded write
+    void complete_write(const boost::system::error_code& _error = {}) {
+        ASSERT_FALSE(writes_.empty());
+        auto its_write = std::move(writes_.front());
+        writes_.pop_front();
+        std::size_t its_size(0);
+        for (const auto& b : its_write.buffers_) {
+            its_size += b.size();
+        }
+        its_write.handler_(_error, _error ? 0 : its_size);
+        io_.restart();
+        io_.poll();
+    }
+
+    void TearDown() override {
+        if (endpoint_) {
+            std::scoped_lock its_lock(endpoint_->mutex_);
+            endpoint_->queue_.clear();
+            endpoint_->queue_size_ = 0;
+        }
+        endpoint_.reset();
+        io_.restart();
+        io_.poll();
+    }
+
+    boost::asio::io_context io_;
+    std::deque<recording_tcp_socket::write_t> writes_;
+    std::shared_ptr<tcp_client_endpoint_impl> endpoint_;
+};
+
+} // namespace
+
+TEST_F(tcp_gather_write_test, default_writes_one_message_per_write) {
+    create_endpoint(VSOMEIP_TCP_GATHER_WRITE_MAX_BUFFERS, VSOMEIP_TCP_GATHER_WRITE_MAX_BYTES);
+    queue_and_send(3, 20);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        ASSERT_EQ(writes_.size(), 1u) << i;
+        EXPECT_EQ(writes_.front().buffers_.size(), 1u) << i;
+        complete_write();
+    }
+    EXPECT_TRUE(writes_.empty());
+    EXPECT_FALSE(endpoint_->is_sending_);
+}
+
+TEST_F(tcp_gather_write_test, coalesces_up_to_max_buffers) {
+    create_endpoint(3, 65536);
+    queue_and_send(5, 20);
+
+    ASSERT_EQ(writes_.size(), 1u);
+    ASSERT_EQ(writes_.front().buffers_.size(), 3u);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(writes_.front().buffers_[i][VSOMEIP_SESSION_POS_MAX], byte_t(i + 1));
+    }
+    EXPECT_EQ(endpoint_->sending_count_, 3u);
+
+    // The entries of a write stay queued and counted until it completes
+    EXPECT_EQ(endpoint_->queue_.size(), 5u);
+    EXPECT_EQ(endpoint_->queue_size_, 100u);
+
+    complete_write();
+    EXPECT_EQ(endpoint_->queue_.size(), 2u);
+    EXPECT_EQ(endpoint_->queue_size_, 40u);
+    ASSERT_EQ(writes_.size(), 1u);
+    ASSERT_EQ(writes_.front().buffers_.size(), 2u);
+    EXPECT_EQ(writes_.front().buffers_[0][VSOMEIP_SESSION_POS_MAX], byte_t(4));
+    EXPECT_EQ(writes_.front().buffers_[1][VSOMEIP_SESSION_POS_MAX], byte_t(5));
+
+    complete_write();
+    EXPECT_TRUE(endpoint_->queue_.empty());
+    EXPECT_EQ(endpoint_->queue_size_, 0u);
+    EXPECT_EQ(endpoint_->sending_count_, 1u);
+    EXPECT_FALSE(endpoint_->is_sending_);
+    EXPECT_EQ(endpoint_->writes_, 2u);
+    EXPECT_EQ(endpoint_->written_buffers_, 5u);
+}
+
+TEST_F(tcp_gather_write_test, coalesces_up_to_max_bytes) {
+    create_endpoint(32, 50);
+    queue_and_send(5, 20);
+
+    ASSERT_EQ(writes_.size(), 1u);
+    EXPECT_EQ(writes_.front().buffers_.size(), 2u);
+    complete_write();
+    ASSERT_EQ(writes_.size(), 1u);
+    EXPECT_EQ(writes_.front().buffers_.size(), 2u);
+    complete_write();
+    ASSERT_EQ(writes_.size(), 1u);
+    EXPECT_EQ(writes_.front().buffers_.size(), 1u);
+    complete_write();
+    EXPECT_EQ(endpoint_->queue_size_, 0u);
+
+    // A message above the limit is still sent, on its own
+    queue_and_send(2, 60);
+    ASSERT_EQ(writes_.size(), 1u);
+    EXPECT_EQ(writes_.front().buffers_.size(), 1u);
+    EXPECT_EQ(writes_.front().buffers_[0].size(), 60u);
+    complete_write();
+    complete_write();
+    EXPECT_TRUE(endpoint_->queue_.empty());
+    EXPECT_EQ(endpoint_->queue_size_, 0u);
+}
+
+TEST_F(tcp_gather_write_test, failed_write_keeps_its_entries_and_resets_the_count) {
+    create_endpoint(3, 65536);
+    queue_and_send(3, 20);
+    ASSERT_EQ(endpoint_->sending_count_, 3u);
+
+    complete_write(boost::system::errc::make_error_code(boost::system::errc::destination_address_required));
+    EXPECT_EQ(endpoint_->sending_count_, 1u);
+    EXPECT_FALSE(endpoint_->is_sending_);
+    EXPECT_EQ(endpoint_->queue_.size(), 3u);
+    EXPECT_EQ(endpoint_->queue_size_, 60u);
+
+    // The retry coalesces again from the front of the queue
+    std::pair<message_buffer_ptr_t, uint32_t> its_entry;
+    {
+        std::scoped_lock its_lock(endpoint_->mutex_);
+        endpoint_->is_sending_ = true;
+        its_entry = endpoint_->queue_.front();
+    }
+    endpoint_->send_queued(its_entry);
+    ASSERT_EQ(writes_.size(), 1u);
+    EXPECT_EQ(writes_.front().buffers_.size(), 3u);
+    complete_write();
+    EXPECT_TRUE(endpoint_->queue_.empty());
+    EXPECT_EQ(endpoint_->queue_size_, 0u);
+}
+
+TEST_F(tcp_gather_write_test, restart_drops_the_write_in_progress) {
+    create_endpoint(3, 65536);
+    queue_and_send(3, 20);
+    ASSERT_EQ(endpoint_->sending_count_, 3u);
+
+    endpoint_->restart(true);
+    io_.restart();
+    io_.poll();
+    EXPECT_EQ(endpoint_->sending_count_, 1u);
+    EXPECT_FALSE(endpoint_->is_sending_);
+    EXPECT_TRUE(endpoint_->queue_.empty());
+    EXPECT_EQ(endpoint_->queue_size_, 0u);
+    endpoint_->stop();
+}
+
+TEST_F(tcp_gather_write_test, magic_cookie_goes_into_the_first_buffer) {
+    create_endpoint(3, 65536);
+    endpoint_->has_enabled_magic_cookies_ = true;
+    queue_and_send(3, 20);
+
+    ASSERT_EQ(writes_.size(), 1u);
+    const auto& its_buffers = writes_.front().buffers_;
+    ASSERT_EQ(its_buffers.size(), 3u);
+    ASSERT_EQ(its_buffers[0].size(), sizeof(CLIENT_COOKIE) + 20);
+    EXPECT_TRUE(std::equal(std::begin(CLIENT_COOKIE), std::end(CLIENT_COOKIE), its_buffers[0].begin()));
+    EXPECT_EQ(its_buffers[1].size(), 20u);
+    EXPECT_EQ(its_buffers[2].size(), 20u);
+    EXPECT_EQ(endpoint_->queue_size_, 60u + sizeof(CLIENT_COOKIE));
+
+    complete_write();
+    EXPECT_TRUE(endpoint_->queue_.empty());
+    EXPECT_EQ(endpoint_->queue_size_, 0u);
+}
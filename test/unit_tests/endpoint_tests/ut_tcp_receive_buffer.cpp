@@ -0,0 +1,151 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+
+#include "../../../implementation/endpoints/include/tcp_receive_buffer.hpp"
+
+using vsomeip_v3::byte_t;
+using vsomeip_v3::message_buffer_t;
+using vsomeip_v3::tcp_receive_buffer;
+
+namespace {
+
+message_buffer_t make_bytes(std::size_t _size, byte_t _first) {
+    message_buffer_t its_bytes(_size);
+    std::iota(its_bytes.begin(), its_bytes.end(), _first);
+    return its_bytes;
+}
+
+// Copies "_bytes" into the space returned by prepare(_missing), like a receive would.
+std::size_t receive(tcp_receive_buffer& _buffer, const byte_t* _bytes, std::size_t _size, std::size_t _missing = 0) {
+    auto its_space = _buffer.prepare(_missing);
+    const std::size_t its_size(std::min(_size, its_space.size()));
+    std::memcpy(its_space.data(), _bytes, its_size);
+    EXPECT_TRUE(_buffer.commit(its_size));
+    return its_size;
+}
+
+} // namespace
+
+TEST(tcp_receive_buffer_test, frames_in_place_and_rewinds) {
+    tcp_receive_buffer its_buffer(64, 5);
+    const auto its_bytes = make_bytes(40, 0);
+
+    ASSERT_EQ(receive(its_buffer, its_bytes.data(), its_bytes.size()), 40u);
+    const byte_t* its_start = its_buffer.data();
+    EXPECT_EQ(0, std::memcmp(its_start, its_bytes.data(), 40));
+
+    its_buffer.consume(16);
+    EXPECT_EQ(its_buffer.size(), 24u);
+    EXPECT_EQ(its_buffer.data(), its_start + 16);
+
+    // Consuming everything returns to the start of the ring
+    its_buffer.consume(24);
+    EXPECT_EQ(its_buffer.size(), 0u);
+    EXPECT_EQ(its_buffer.prepare(0).size(), 64u);
+    EXPECT_EQ(its_buffer.prepare(0).data(), static_cast<const void*>(its_start));
+}
+
+TEST(tcp_receive_buffer_test, keeps_receiving_behind_partial_message) {
+    tcp_receive_buffer its_buffer(64, 5);
+    const auto its_bytes = make_bytes(64, 0);
+
+    ASSERT_EQ(receive(its_buffer, its_bytes.data(), 30), 30u);
+    its_buffer.consume(20);
+
+    // 10 bytes of a 20 byte message are available, there is room behind them
+    auto its_space = its_buffer.prepare(10);
+    EXPECT_EQ(its_space.size(), 34u);
+    EXPECT_EQ(0, std::memcmp(its_buffer.data(), its_bytes.data() + 20, 10));
+}
+
+TEST(tcp_receive_buffer_test, moves_partial_message_that_does_not_fit) {
+    tcp_receive_buffer its_buffer(64, 5);
+    const auto its_bytes = make_bytes(64, 0);
+
+    ASSERT_EQ(receive(its_buffer, its_bytes.data(), 64), 64u);
+    its_buffer.consume(50);
+
+    // 14 bytes of a 30 byte message: the message must start at the front
+    auto its_space = its_buffer.prepare(16);
+    EXPECT_FALSE(its_buffer.is_dedicated());
+    EXPECT_EQ(its_space.size(), 50u);
+    EXPECT_EQ(its_buffer.size(), 14u);
+    EXPECT_EQ(0, std::memcmp(its_buffer.data(), its_bytes.data() + 50, 14));
+}
+
+TEST(tcp_receive_buffer_test, receives_large_message_into_dedicated_buffer) {
+    tcp_receive_buffer its_buffer(64, 2);
+    const auto its_message = make_bytes(200, 7);
+
+    ASSERT_EQ(receive(its_buffer, its_message.data(), its_message.size()), 64u);
+
+    // The rest of the message is received into a buffer of exactly its size
+    auto its_space = its_buffer.prepare(200 - 64);
+    EXPECT_TRUE(its_buffer.is_dedicated());
+    EXPECT_EQ(its_space.size(), 200u - 64u);
+    ASSERT_EQ(receive(its_buffer, its_message.data() + 64, 200 - 64, 200 - 64), 200u - 64u);
+    ASSERT_EQ(its_buffer.size(), 200u);
+    EXPECT_EQ(0, std::memcmp(its_buffer.data(), its_message.data(), 200));
+    EXPECT_FALSE(its_buffer.commit(1));
+
+    // The next message is received into the ring again
+    its_buffer.consume(200);
+    EXPECT_FALSE(its_buffer.is_dedicated());
+    EXPECT_EQ(its_buffer.prepare(0).size(), 64u);
+    EXPECT_EQ(its_buffer.capacity(), 64u + 200u);
+}
+
+TEST(tcp_receive_buffer_test, releases_dedicated_buffer_after_threshold) {
+    tcp_receive_buffer its_buffer(32, 2);
+    const auto its_message = make_bytes(100, 0);
+
+    receive(its_buffer, its_message.data(), 32);
+    receive(its_buffer, its_message.data() + 32, 68, 68);
+    its_buffer.consume(100);
+    EXPECT_EQ(its_buffer.capacity(), 32u + 100u);
+
+    its_buffer.prepare(0);
+    its_buffer.prepare(0);
+    EXPECT_EQ(its_buffer.capacity(), 32u + 100u);
+    its_buffer.prepare(0);
+    EXPECT_EQ(its_buffer.capacity(), 32u);
+}
+
+TEST(tcp_receive_buffer_test, keeps_dedicated_buffer_without_threshold) {
+    tcp_receive_buffer its_buffer(32, 0);
+    const auto its_message = make_bytes(100, 0);
+
+    receive(its_buffer, its_message.data(), 32);
+    receive(its_buffer, its_message.data() + 32, 68, 68);
+    its_buffer.consume(100);
+    for (int i = 0; i < 10; ++i) {
+        its_buffer.prepare(0);
+    }
+    EXPECT_EQ(its_buffer.capacity(), 32u + 100u);
+
+    its_buffer.clear();
+    EXPECT_EQ(its_buffer.capacity(), 32u);
+    EXPECT_EQ(its_buffer.size(), 0u);
+}
+
+TEST(tcp_receive_buffer_test, moves_rest_of_dedicated_buffer_back_to_ring) {
+    tcp_receive_buffer its_buffer(32, 5);
+    const auto its_message = make_bytes(100, 0);
+
+    receive(its_buffer, its_message.data(), 32);
+    receive(its_buffer, its_message.data() + 32, 68, 68);
+
+    // Only a part of the message was used (e.g. when resyncing on a magic cookie)
+    its_buffer.consume(90);
+    its_buffer.prepare(6);
+    EXPECT_FALSE(its_buffer.is_dedicated());
+    ASSERT_EQ(its_buffer.size(), 10u);
+    EXPECT_EQ(0, std::memcmp(its_buffer.data(), its_message.data() + 90, 10));
+}
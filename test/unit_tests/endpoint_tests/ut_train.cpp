@@ -0,0 +1,95 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/endpoints/include/buffer.hpp"
+
+using vsomeip_v3::message_buffer_t;
+using vsomeip_v3::train_buffer_pool;
+using vsomeip_v3::train_passengers;
+
+TEST(train_test, passengers_overflow_into_hash_set) {
+    train_passengers its_passengers;
+    EXPECT_TRUE(its_passengers.empty());
+
+    for (vsomeip_v3::method_t m = 0; m < 100; ++m) {
+        its_passengers.insert(0x1234, m);
+        its_passengers.insert(0x1234, m);
+    }
+    EXPECT_FALSE(its_passengers.empty());
+    for (vsomeip_v3::method_t m = 0; m < 100; ++m) {
+        EXPECT_TRUE(its_passengers.contains(0x1234, m)) << m;
+    }
+    EXPECT_FALSE(its_passengers.contains(0x1234, 100));
+    EXPECT_FALSE(its_passengers.contains(0x1235, 0));
+    EXPECT_TRUE(its_passengers.contains_service(0x1234));
+    EXPECT_FALSE(its_passengers.contains_service(0x1235));
+
+    // A service that only travels in the overflow
+    its_passengers.insert(0x4321, 1);
+    EXPECT_TRUE(its_passengers.contains_service(0x4321));
+
+    its_passengers.clear();
+    EXPECT_TRUE(its_passengers.empty());
+    EXPECT_FALSE(its_passengers.contains(0x1234, 0));
+    EXPECT_FALSE(its_passengers.contains(0x1234, 99));
+    EXPECT_FALSE(its_passengers.contains_service(0x4321));
+}
+
+TEST(train_test, pool_recycles_buffers) {
+    auto its_pool = std::make_shared<train_buffer_pool>();
+
+    auto its_buffer = its_pool->get(1416);
+    EXPECT_TRUE(its_buffer->empty());
+    EXPECT_GE(its_buffer->capacity(), 1416u);
+    its_buffer->resize(100, 0x42);
+    const message_buffer_t* its_address = its_buffer.get();
+
+    // The buffer is only recycled after its last reference was dropped
+    auto its_reference = its_buffer;
+    its_buffer.reset();
+    EXPECT_NE(its_pool->get(1416).get(), its_address);
+    its_reference.reset();
+
+    auto its_recycled = its_pool->get(1416);
+    EXPECT_EQ(its_recycled.get(), its_address);
+    EXPECT_TRUE(its_recycled->empty());
+
+    // The reservation is limited for unlimited message sizes
+    auto its_unlimited = its_pool->get(std::numeric_limits<std::uint32_t>::max());
+    EXPECT_LT(its_unlimited->capacity(), std::size_t(std::numeric_limits<std::uint32_t>::max()));
+
+    // Buffers may outlive their pool
+    its_pool.reset();
+    its_recycled->push_back(0x42);
+    its_recycled.reset();
+}
+
+TEST(train_test, reset_takes_pooled_buffer) {
+    auto its_pool = std::make_shared<train_buffer_pool>();
+    vsomeip_v3::train its_train(its_pool->get(1416));
+    its_train.buffer_->resize(100, 0x42);
+    const message_buffer_t* its_address = its_train.buffer_.get();
+
+    // The departed buffer is still queued for sending
+    auto its_departed = its_train.buffer_;
+    its_train.reset(its_pool->get(1416));
+    EXPECT_NE(its_train.buffer_.get(), its_address);
+    EXPECT_TRUE(its_train.buffer_->empty());
+
+    its_departed.reset();
+    its_train.reset(its_pool->get(1416));
+    EXPECT_EQ(its_train.buffer_.get(), its_address);
+    EXPECT_TRUE(its_train.buffer_->empty());
+
+    // Grown buffers give their memory back
+    its_train.buffer_->resize(train_buffer_pool::max_recycled_capacity + 1);
+    its_address = its_train.buffer_.get();
+    its_train.reset(its_pool->get(1416));
+    its_train.reset(its_pool->get(1416));
+    EXPECT_EQ(its_train.buffer_.get(), its_address);
+    EXPECT_LE(its_train.buffer_->capacity(), train_buffer_pool::max_recycled_capacity);
+}
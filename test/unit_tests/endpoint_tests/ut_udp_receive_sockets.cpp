@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/endpoints/include/udp_server_endpoint_impl.hpp"
+
+using namespace vsomeip_v3;
+
+#ifdef __linux__
+
+namespace {
+
+// Number of IPv4 UDP sockets of the system that are bound to "_port"
+std::size_t count_bound_sockets(std::uint16_t _port) {
+    std::ifstream its_file("/proc/net/udp");
+    std::string its_line;
+    std::getline(its_file, its_line); // header
+    std::size_t its_count(0);
+    while (std::getline(its_file, its_line)) {
+        // "  sl  local_address ...", the local address is given as "0100007F:1F90"
+        std::istringstream its_stream(its_line);
+        std::string its_slot, its_local;
+        its_stream >> its_slot >> its_local;
+        const auto its_colon = its_local.find(':');
+        if (its_colon != std::string::npos && std::stoul(its_local.substr(its_colon + 1), nullptr, 16) == _port) {
+            ++its_count;
+        }
+    }
+    return its_count;
+}
+
+std::uint16_t get_free_port() {
+    boost::asio::io_context its_io;
+    boost::asio::ip::udp::socket its_socket(its_io, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    return its_socket.local_endpoint().port();
+}
+
+} // namespace
+
+TEST(udp_receive_sockets_test, restart_and_stop_close_the_receive_sockets) {
+    constexpr std::size_t its_socket_count(4);
+    const auto its_port = get_free_port();
+
+    const auto its_path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("ut_udp_receive_sockets_%%%%%%%%.json");
+    {
+        std::ofstream its_file(its_path.string());
+        its_file << R"({ "unicast" : "127.0.0.1", "udp-receive-sockets" : [ { "port" : ")" << its_port << R"(", "count" : ")"
+                 << its_socket_count << R"(" } ] })";
+    }
+    auto its_configuration = std::make_shared<cfg::configuration_impl>(its_path.string());
+    ASSERT_TRUE(its_configuration->load("ut_udp_receive_sockets"));
+    boost::filesystem::remove(its_path);
+    ASSERT_EQ(its_configuration->get_udp_receive_socket_count(its_port), its_socket_count);
+
+    boost::asio::io_context its_io;
+    auto its_endpoint = std::make_shared<udp_server_endpoint_impl>(nullptr, nullptr, its_io, its_configuration);
+    std::weak_ptr<udp_server_endpoint_impl> its_weak_endpoint(its_endpoint);
+
+    boost::system::error_code its_error;
+    its_endpoint->init(boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), its_port), its_error);
+    ASSERT_FALSE(its_error) << its_error.message();
+    its_endpoint->start();
+    EXPECT_EQ(count_bound_sockets(its_port), its_socket_count);
+
+    // The restarted endpoint binds a new group instead of joining the old one
+    for (int i = 0; i < 3; ++i) {
+        its_endpoint->restart(false);
+        its_io.poll();
+        EXPECT_EQ(count_bound_sockets(its_port), its_socket_count);
+    }
+
+    its_endpoint->stop();
+    EXPECT_EQ(count_bound_sockets(its_port), 0u);
+
+    // The aborted receives release the endpoint
+    its_io.restart();
+    its_io.poll();
+    its_endpoint.reset();
+    EXPECT_TRUE(its_weak_endpoint.expired());
+}
+
+#endif
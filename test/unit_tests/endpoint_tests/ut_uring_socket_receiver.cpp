@@ -0,0 +1,307 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/endpoints/include/uring_socket_receiver.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <cstring>
+#include <set>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <boost/asio/local/connect_pair.hpp>
+#include <boost/asio/write.hpp>
+
+#include <vsomeip/defines.hpp>
+
+using namespace vsomeip_v3;
+
+namespace {
+
+class uring_udp_receiver_test : public ::testing::TestWithParam<bool> {
+protected:
+    void SetUp() override {
+        service_ = &boost::asio::use_service<uring_service>(io_);
+        if (!service_->init(32)) {
+            GTEST_SKIP() << "io_uring is not available";
+        }
+        if (GetParam() && !service_->init_buffers(8, uring_udp_receiver::get_buffer_size())) {
+            GTEST_SKIP() << "provided buffer rings are not available";
+        }
+        receiver_ = std::make_unique<uring_udp_receiver>(io_, *service_, GetParam());
+
+        socket_.open(boost::asio::ip::udp::v4());
+        socket_.bind(boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        const int its_on(1);
+        setsockopt(socket_.native_handle(), IPPROTO_IP, IP_PKTINFO, &its_on, sizeof(its_on));
+        // Like the sockets of the endpoints, which also send through asio
+        socket_.non_blocking(true);
+
+        peer_.open(boost::asio::ip::udp::v4());
+        peer_.bind(boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    }
+
+    void TearDown() override {
+        if (receiver_) {
+            receiver_->cancel();
+        }
+    }
+
+    // Receives the next datagram, "_sender" is the address it was sent from
+    std::vector<unsigned char> receive(boost::asio::ip::udp::endpoint* _sender = nullptr,
+                                       boost::asio::ip::address* _destination = nullptr) {
+        std::vector<unsigned char> its_buffer(VSOMEIP_MAX_UDP_MESSAGE_SIZE);
+        bool is_done(false);
+        receiver_->async_receive(socket_, boost::asio::buffer(its_buffer),
+                                 [&](const boost::system::error_code& _error, std::size_t _bytes,
+                                     const boost::asio::ip::udp::endpoint& _from, const boost::asio::ip::address& _to) {
+                                     EXPECT_FALSE(_error) << _error.message();
+                                     its_buffer.resize(_bytes);
+                                     if (_sender) {
+                                         *_sender = _from;
+                                     }
+                                     if (_destination) {
+                                         *_destination = _to;
+                                     }
+                                     is_done = true;
+                                 });
+        while (!is_done) {
+            io_.run_one();
+        }
+        return its_buffer;
+    }
+
+    void send(std::size_t _size, unsigned char _value) {
+        const std::vector<unsigned char> its_data(_size, _value);
+        peer_.send_to(boost::asio::buffer(its_data), socket_.local_endpoint());
+    }
+
+    boost::asio::io_context io_;
+    uring_service* service_{nullptr};
+    boost::asio::ip::udp::socket socket_{io_};
+    boost::asio::ip::udp::socket peer_{io_};
+    std::unique_ptr<udp_receiver> receiver_;
+};
+
+} // namespace
+
+TEST_P(uring_udp_receiver_test, receives_sender_and_destination) {
+    send(100, 1);
+
+    boost::asio::ip::udp::endpoint its_sender;
+    boost::asio::ip::address its_destination;
+    const auto its_data = receive(&its_sender, &its_destination);
+    ASSERT_EQ(its_data.size(), 100u);
+    EXPECT_EQ(its_data.front(), 1);
+    EXPECT_EQ(its_sender, peer_.local_endpoint());
+    EXPECT_EQ(its_destination, boost::asio::ip::address_v4::loopback());
+}
+
+TEST_P(uring_udp_receiver_test, keeps_datagrams_in_order) {
+    // The first receive arms the multishot receive, the others are read before they are asked for
+    send(10, 1);
+    EXPECT_EQ(receive().size(), 10u);
+
+    for (unsigned char i = 2; i < 6; i++) {
+        send(i * 10, i);
+    }
+    io_.poll();
+    for (unsigned char i = 2; i < 6; i++) {
+        const auto its_data = receive();
+        ASSERT_EQ(its_data.size(), i * 10u);
+        EXPECT_EQ(its_data.back(), i);
+    }
+}
+
+TEST_P(uring_udp_receiver_test, reads_more_datagrams_than_buffers) {
+    // The ring has 8 buffers, the datagrams that do not fit are read directly
+    send(10, 0);
+    receive();
+    for (unsigned char i = 1; i <= 20; i++) {
+        send(i, i);
+    }
+    io_.poll();
+    for (unsigned char i = 1; i <= 20; i++) {
+        const auto its_data = receive();
+        ASSERT_EQ(its_data.size(), std::size_t(i));
+        EXPECT_EQ(its_data.back(), i);
+    }
+}
+
+TEST_P(uring_udp_receiver_test, aborts_pending_receive_on_cancel) {
+    std::vector<unsigned char> its_buffer(100);
+    bool is_done(false);
+    receiver_->async_receive(socket_, boost::asio::buffer(its_buffer),
+                             [&](const boost::system::error_code& _error, std::size_t, const boost::asio::ip::udp::endpoint&,
+                                 const boost::asio::ip::address&) {
+                                 EXPECT_EQ(_error, boost::asio::error::operation_aborted);
+                                 is_done = true;
+                             });
+    io_.poll(); // submits the receive
+
+    receiver_->cancel();
+    while (!is_done) {
+        io_.run_one();
+    }
+
+    // The port is free again once the socket is closed
+    const auto its_local = socket_.local_endpoint();
+    socket_.close();
+    io_.poll();
+    boost::asio::ip::udp::socket its_socket(io_);
+    boost::system::error_code its_error;
+    its_socket.open(boost::asio::ip::udp::v4());
+    its_socket.bind(its_local, its_error);
+    EXPECT_FALSE(its_error) << its_error.message();
+}
+
+INSTANTIATE_TEST_SUITE_P(uring_udp_receiver, uring_udp_receiver_test, ::testing::Values(true, false),
+                         [](const ::testing::TestParamInfo<bool>& _info) { return _info.param ? "multishot" : "single"; });
+
+TEST(uring_service_test, multishot_receive_selects_provided_buffers) {
+    // The receivers fall back to single receives if this does not work, so it is checked on its own
+    boost::asio::io_context its_io;
+    auto& its_service = boost::asio::use_service<uring_service>(its_io);
+    if (!its_service.init(32) || !its_service.init_buffers(8, uring_udp_receiver::get_buffer_size())) {
+        GTEST_SKIP() << "provided buffer rings are not available";
+    }
+
+    boost::asio::ip::udp::socket its_socket(its_io, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    boost::asio::ip::udp::socket its_peer(its_io, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+
+    msghdr its_header{};
+    std::vector<std::pair<int, std::uint32_t>> its_completions;
+    const auto its_op = its_service.start_multishot(
+            [&](io_uring_sqe& _sqe) {
+                _sqe.opcode = IORING_OP_RECVMSG;
+                _sqe.fd = its_socket.native_handle();
+                _sqe.addr = reinterpret_cast<std::uintptr_t>(&its_header);
+                _sqe.ioprio = IORING_RECV_MULTISHOT;
+                _sqe.flags = IOSQE_BUFFER_SELECT;
+                _sqe.buf_group = uring_service::buffer_group;
+            },
+            [&](int _result, std::uint32_t _flags) { its_completions.emplace_back(_result, _flags); });
+    ASSERT_NE(its_op, 0u);
+    its_io.poll(); // submits the receive
+
+    const std::vector<unsigned char> its_first(10, 1), its_second(20, 2);
+    its_peer.send_to(boost::asio::buffer(its_first), its_socket.local_endpoint());
+    its_peer.send_to(boost::asio::buffer(its_second), its_socket.local_endpoint());
+    while (its_completions.size() < 2) {
+        its_io.run_one();
+    }
+
+    std::set<std::uint16_t> its_buffers;
+    for (std::size_t i = 0; i < its_completions.size(); ++i) {
+        const auto& [its_result, its_flags] = its_completions[i];
+        ASSERT_GT(its_result, 0);
+        ASSERT_TRUE(its_flags & IORING_CQE_F_BUFFER);
+        EXPECT_TRUE(its_flags & IORING_CQE_F_MORE);
+
+        const auto its_buffer = static_cast<std::uint16_t>(its_flags >> IORING_CQE_BUFFER_SHIFT);
+        ASSERT_LT(its_buffer, 8u);
+        its_buffers.insert(its_buffer);
+
+        io_uring_recvmsg_out its_out;
+        std::memcpy(&its_out, its_service.get_buffer(its_buffer), sizeof(its_out));
+        EXPECT_EQ(its_out.payloadlen, i == 0 ? its_first.size() : its_second.size());
+        its_service.release_buffer(its_buffer);
+    }
+    EXPECT_EQ(its_buffers.size(), 2u);
+
+    its_service.cancel(its_op);
+    while (its_completions.back().second & IORING_CQE_F_MORE) {
+        its_io.run_one();
+    }
+    EXPECT_EQ(its_completions.back().first, -ECANCELED);
+}
+
+namespace {
+
+class uring_uds_receiver_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto& its_service = boost::asio::use_service<uring_service>(io_);
+        if (!its_service.init(32)) {
+            GTEST_SKIP() << "io_uring is not available";
+        }
+        receiver_ = std::make_unique<uring_uds_receiver>(io_, its_service);
+
+        boost::asio::local::connect_pair(socket_, peer_);
+        const int its_on(1);
+        setsockopt(socket_.native_handle(), SOL_SOCKET, SO_PASSCRED, &its_on, sizeof(its_on));
+    }
+
+    void TearDown() override {
+        if (receiver_) {
+            receiver_->cancel();
+        }
+    }
+
+    boost::asio::io_context io_;
+    boost::asio::local::stream_protocol::socket socket_{io_};
+    boost::asio::local::stream_protocol::socket peer_{io_};
+    std::unique_ptr<uds_receiver> receiver_;
+};
+
+} // namespace
+
+TEST_F(uring_uds_receiver_test, receives_with_credentials) {
+    const std::vector<unsigned char> its_data(200, 7);
+    boost::asio::write(peer_, boost::asio::buffer(its_data));
+
+    std::vector<unsigned char> its_buffer(1000);
+    bool is_done(false);
+    receiver_->async_receive(socket_, boost::asio::buffer(its_buffer),
+                             [&](const boost::system::error_code& _error, std::size_t _bytes, const std::uint32_t& _uid,
+                                 const std::uint32_t& _gid) {
+                                 EXPECT_FALSE(_error);
+                                 EXPECT_EQ(_bytes, its_data.size());
+                                 EXPECT_EQ(_uid, getuid());
+                                 EXPECT_EQ(_gid, getgid());
+                                 is_done = true;
+                             });
+    while (!is_done) {
+        io_.run_one();
+    }
+    EXPECT_EQ(its_buffer.front(), 7);
+}
+
+TEST_F(uring_uds_receiver_test, reports_eof) {
+    std::vector<unsigned char> its_buffer(100);
+    bool is_done(false);
+    receiver_->async_receive(socket_, boost::asio::buffer(its_buffer),
+                             [&](const boost::system::error_code& _error, std::size_t _bytes, const std::uint32_t&, const std::uint32_t&) {
+                                 EXPECT_EQ(_error, boost::asio::error::eof);
+                                 EXPECT_EQ(_bytes, 0u);
+                                 is_done = true;
+                             });
+    peer_.close();
+    while (!is_done) {
+        io_.run_one();
+    }
+}
+
+TEST_F(uring_uds_receiver_test, aborts_pending_receive_on_cancel) {
+    std::vector<unsigned char> its_buffer(100);
+    bool is_done(false);
+    receiver_->async_receive(socket_, boost::asio::buffer(its_buffer),
+                             [&](const boost::system::error_code& _error, std::size_t, const std::uint32_t&, const std::uint32_t&) {
+                                 EXPECT_EQ(_error, boost::asio::error::operation_aborted);
+                                 is_done = true;
+                             });
+    io_.poll(); // submits the receive
+
+    receiver_->cancel();
+    while (!is_done) {
+        io_.run_one();
+    }
+}
+
+#endif // VSOMEIP_HAS_IO_URING
@@ -0,0 +1,162 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/endpoints/include/uring_tcp_socket.hpp"
+
+#ifdef VSOMEIP_HAS_IO_URING
+
+#include <numeric>
+
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+using namespace vsomeip_v3;
+
+namespace {
+
+class uring_tcp_socket_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto& its_service = boost::asio::use_service<uring_service>(io_);
+        if (!its_service.init(32)) {
+            GTEST_SKIP() << "io_uring is not available";
+        }
+
+        std::unique_ptr<tcp_acceptor> its_acceptor = std::make_unique<asio_tcp_acceptor>(io_);
+        socket_ = std::make_unique<uring_tcp_socket>(io_, its_service);
+
+        boost::system::error_code its_error;
+        const boost::asio::ip::tcp::endpoint its_local(boost::asio::ip::address_v4::loopback(), 0);
+        its_acceptor->open(its_local.protocol(), its_error);
+        its_acceptor->bind(its_local, its_error);
+        its_acceptor->listen(1, its_error);
+        ASSERT_FALSE(its_error);
+
+        // The port is only known from the native socket
+        sockaddr_in its_address{};
+        socklen_t its_length(sizeof(its_address));
+        getsockname(its_acceptor->native_handle(), reinterpret_cast<sockaddr*>(&its_address), &its_length);
+
+        bool is_accepted(false);
+        its_acceptor->async_accept(*socket_, [&is_accepted](const boost::system::error_code& _error) { is_accepted = !_error; });
+        peer_.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), ntohs(its_address.sin_port)));
+        while (!is_accepted) {
+            io_.run_one();
+        }
+    }
+
+    boost::asio::io_context io_;
+    boost::asio::ip::tcp::socket peer_{io_};
+    std::unique_ptr<tcp_socket> socket_;
+};
+
+} // namespace
+
+TEST_F(uring_tcp_socket_test, receives) {
+    std::vector<unsigned char> its_data(1000);
+    std::iota(its_data.begin(), its_data.end(), 0);
+    boost::asio::write(peer_, boost::asio::buffer(its_data));
+
+    std::vector<unsigned char> its_buffer(2000);
+    std::size_t its_received(0);
+    while (its_received < its_data.size()) {
+        bool is_done(false);
+        socket_->async_receive(boost::asio::buffer(its_buffer.data() + its_received, its_buffer.size() - its_received),
+                               [&](const boost::system::error_code& _error, std::size_t _bytes) {
+                                   EXPECT_FALSE(_error);
+                                   its_received += _bytes;
+                                   is_done = true;
+                               });
+        while (!is_done) {
+            io_.run_one();
+        }
+    }
+    ASSERT_EQ(its_received, its_data.size());
+    EXPECT_TRUE(std::equal(its_data.begin(), its_data.end(), its_buffer.begin()));
+}
+
+TEST_F(uring_tcp_socket_test, writes_all_buffers) {
+    std::vector<unsigned char> its_first(100000, 1), its_second(50000, 2);
+    bool is_done(false);
+    socket_->async_write(std::vector<boost::asio::const_buffer>{boost::asio::buffer(its_first), boost::asio::buffer(its_second)},
+                         [&](const boost::system::error_code& _error, std::size_t _bytes) {
+                             EXPECT_FALSE(_error);
+                             EXPECT_EQ(_bytes, its_first.size() + its_second.size());
+                             is_done = true;
+                         });
+
+    // Read while the write is in progress, it does not fit into the socket buffers at once
+    std::vector<unsigned char> its_buffer(its_first.size() + its_second.size());
+    std::size_t its_read(0);
+    peer_.non_blocking(true);
+    while (!is_done || its_read < its_buffer.size()) {
+        io_.poll();
+        boost::system::error_code its_error;
+        its_read += peer_.read_some(boost::asio::buffer(its_buffer.data() + its_read, its_buffer.size() - its_read), its_error);
+    }
+    EXPECT_EQ(its_read, its_buffer.size());
+    EXPECT_EQ(its_buffer.front(), 1);
+    EXPECT_EQ(its_buffer.back(), 2);
+}
+
+TEST_F(uring_tcp_socket_test, stops_at_completion_condition) {
+    std::vector<unsigned char> its_data(1000, 3);
+    bool is_done(false);
+    socket_->async_write(
+            boost::asio::buffer(its_data),
+            [](const boost::system::error_code&, std::size_t _total) -> std::size_t { return _total == 0 ? 400 : 0; },
+            [&](const boost::system::error_code& _error, std::size_t _bytes) {
+                EXPECT_FALSE(_error);
+                EXPECT_EQ(_bytes, 400u);
+                is_done = true;
+            });
+    while (!is_done) {
+        io_.run_one();
+    }
+}
+
+TEST_F(uring_tcp_socket_test, reports_eof) {
+    std::vector<unsigned char> its_buffer(100);
+    bool is_done(false);
+    socket_->async_receive(boost::asio::buffer(its_buffer), [&](const boost::system::error_code& _error, std::size_t _bytes) {
+        EXPECT_EQ(_error, boost::asio::error::eof);
+        EXPECT_EQ(_bytes, 0u);
+        is_done = true;
+    });
+    peer_.close();
+    while (!is_done) {
+        io_.run_one();
+    }
+}
+
+TEST_F(uring_tcp_socket_test, aborts_pending_receive_on_close) {
+    std::vector<unsigned char> its_buffer(100);
+    bool is_done(false);
+    socket_->async_receive(boost::asio::buffer(its_buffer), [&](const boost::system::error_code& _error, std::size_t) {
+        EXPECT_EQ(_error, boost::asio::error::operation_aborted);
+        is_done = true;
+    });
+    io_.poll(); // submits the receive
+
+    boost::system::error_code its_error;
+    socket_->close(its_error);
+    while (!is_done) {
+        io_.run_one();
+    }
+
+    // Operations started after closing fail, too
+    is_done = false;
+    socket_->async_receive(boost::asio::buffer(its_buffer), [&](const boost::system::error_code& _error, std::size_t) {
+        EXPECT_TRUE(_error);
+        is_done = true;
+    });
+    while (!is_done) {
+        io_.run_one();
+    }
+}
+
+#endif // VSOMEIP_HAS_IO_URING
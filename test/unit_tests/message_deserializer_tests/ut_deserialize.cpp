@@ -442,6 +442,43 @@ TEST(deserialize_test, set_data_from_uint8_vector) {
     ASSERT_EQ(deserialized_byte_array_.at(4), byte4);
 }
 
+TEST(deserialize_test, set_view_from_uint8_array_pointer_and_length) {
+    std::array<vsomeip_v3::byte_t, array_size> byte_array_{byte1, byte2, byte3, byte4};
+
+    std::unique_ptr<vsomeip_v3::deserializer> its_deserializer(new vsomeip_v3::deserializer(buffer_shrink_threshold));
+
+    // Test Method
+    its_deserializer->set_view(byte_array_.data(), byte_array_.size());
+    ASSERT_EQ(its_deserializer->get_available(), array_size);
+    ASSERT_EQ(its_deserializer->get_remaining(), array_size);
+
+    // The view refers to the array, so changes are visible
+    byte_array_[1] = byte4;
+
+    vsomeip_v3::byte_t deserialized_byte_;
+    std::uint16_t deserialized_word_;
+    ASSERT_TRUE(its_deserializer->look_ahead(1, deserialized_byte_));
+    ASSERT_EQ(deserialized_byte_, byte4);
+    ASSERT_TRUE(its_deserializer->deserialize(deserialized_byte_));
+    ASSERT_EQ(deserialized_byte_, byte1);
+    ASSERT_TRUE(its_deserializer->deserialize(deserialized_word_));
+    ASSERT_EQ(deserialized_word_, 0x0403);
+
+    // Appending copies the view first
+    its_deserializer->append_data(byte_array_.data(), byte_array_.size());
+    byte_array_.fill(0);
+    ASSERT_EQ(its_deserializer->get_available(), array_size * 2);
+    ASSERT_EQ(its_deserializer->get_remaining(), array_size + 1);
+
+    std::array<vsomeip_v3::byte_t, array_size + 1> deserialized_byte_array_;
+    ASSERT_TRUE(its_deserializer->deserialize(deserialized_byte_array_.data(), deserialized_byte_array_.size()));
+    ASSERT_EQ(deserialized_byte_array_, (std::array<vsomeip_v3::byte_t, array_size + 1> {byte4, byte1, byte4, byte3, byte4}));
+
+    its_deserializer->reset();
+    ASSERT_EQ(its_deserializer->get_available(), 0);
+    ASSERT_FALSE(its_deserializer->deserialize(deserialized_byte_));
+}
+
 TEST(deserialize_test, append_data_from_uint8_array_pointer_and_length) {
     std::array<vsomeip_v3::byte_t, array_size> byte_array_{byte1, byte2, byte3, byte4};
 
@@ -0,0 +1,145 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#include "../../../implementation/protocol/include/send_command.hpp"
+#include "../../../implementation/protocol/include/protocol.hpp"
+
+namespace send_command_tests {
+
+// Tester Note: Expect Little-Endian representation for serialized data.
+const std::vector<std::uint8_t> serialized_send_command = {
+        0x18, // send_command
+        0x00, 0x00, // Version.
+        0x01, 0x00, // Client.
+        0x0a, 0x00, 0x00, 0x00, // Size.
+        0x34, 0x12, // Instance.
+        0x01, // Reliable.
+        0x02, // Status.
+        0x03, 0x00, // Target.
+        0xde, 0xad, 0xbe, 0xef // Message.
+};
+
+const std::vector<std::uint8_t> message = {0xde, 0xad, 0xbe, 0xef};
+
+void init(vsomeip_v3::protocol::send_command& _command) {
+    _command.set_client(0x0001);
+    _command.set_instance(0x1234);
+    _command.set_reliable(true);
+    _command.set_status(0x02);
+    _command.set_target(0x0003);
+}
+
+TEST(send_command_test, serialize) {
+    vsomeip_v3::protocol::send_command command(vsomeip_v3::protocol::id_e::SEND_ID);
+    init(command);
+    command.set_message(message);
+
+    std::vector<std::uint8_t> buffer;
+    vsomeip_v3::protocol::error_e error;
+    command.serialize(buffer, error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    ASSERT_EQ(buffer, serialized_send_command);
+}
+
+TEST(send_command_test, serialize_header) {
+    vsomeip_v3::protocol::send_command command(vsomeip_v3::protocol::id_e::SEND_ID);
+    init(command);
+
+    // The message is placed by the caller, only the header is written
+    std::vector<std::uint8_t> buffer(vsomeip_v3::protocol::SEND_COMMAND_HEADER_SIZE);
+    buffer.insert(buffer.end(), message.begin(), message.end());
+    vsomeip_v3::protocol::error_e error;
+    command.serialize(&buffer[0], message.size(), error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    ASSERT_EQ(buffer, serialized_send_command);
+}
+
+TEST(send_command_test, deserialize) {
+    vsomeip_v3::protocol::send_command command(vsomeip_v3::protocol::id_e::SEND_ID);
+    vsomeip_v3::protocol::error_e error;
+    command.deserialize(serialized_send_command, error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    EXPECT_EQ(command.get_client(), 0x0001);
+    EXPECT_EQ(command.get_instance(), 0x1234);
+    EXPECT_TRUE(command.is_reliable());
+    EXPECT_EQ(command.get_status(), 0x02);
+    EXPECT_EQ(command.get_target(), 0x0003);
+    EXPECT_EQ(command.get_message(), message);
+}
+
+TEST(send_command_test, deserialize_view) {
+    vsomeip_v3::protocol::send_command command(vsomeip_v3::protocol::id_e::SEND_ID);
+    vsomeip_v3::protocol::error_e error;
+    command.deserialize(serialized_send_command.data(), serialized_send_command.size(), error);
+    ASSERT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_OK);
+    EXPECT_EQ(command.get_instance(), 0x1234);
+    EXPECT_EQ(command.get_target(), 0x0003);
+
+    // The message refers into the receive buffer
+    EXPECT_EQ(command.get_message_data(), &serialized_send_command[vsomeip_v3::protocol::SEND_COMMAND_HEADER_SIZE]);
+    EXPECT_EQ(command.get_message_size(), message.size());
+}
+
+TEST(send_command_test, deserialize_errors) {
+    vsomeip_v3::protocol::error_e error;
+
+    vsomeip_v3::protocol::send_command short_command(vsomeip_v3::protocol::id_e::SEND_ID);
+    short_command.deserialize(serialized_send_command.data(), vsomeip_v3::protocol::SEND_COMMAND_HEADER_SIZE - 1, error);
+    EXPECT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_NOT_ENOUGH_BYTES);
+
+    vsomeip_v3::protocol::send_command notify_command(vsomeip_v3::protocol::id_e::NOTIFY_ID);
+    notify_command.deserialize(serialized_send_command.data(), serialized_send_command.size(), error);
+    EXPECT_EQ(error, vsomeip_v3::protocol::error_e::ERROR_MISMATCH);
+}
+
+// Compares the copying codec with the view based one for a 1KiB message.
+// Only reports the timings, as they depend on the machine.
+TEST(send_command_test, codec_throughput) {
+    const std::size_t its_runs(100000);
+    const std::vector<std::uint8_t> its_message(1024, 0x55);
+    std::size_t its_check(0);
+
+    const auto its_copy_start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < its_runs; ++i) {
+        vsomeip_v3::protocol::error_e error;
+        vsomeip_v3::protocol::send_command command(vsomeip_v3::protocol::id_e::SEND_ID);
+        init(command);
+        command.set_message(std::vector<std::uint8_t>(its_message.begin(), its_message.end()));
+        std::vector<std::uint8_t> buffer;
+        command.serialize(buffer, error);
+
+        vsomeip_v3::protocol::send_command received(vsomeip_v3::protocol::id_e::SEND_ID);
+        received.deserialize(std::vector<std::uint8_t>(buffer.begin(), buffer.end()), error);
+        its_check += received.get_message().size();
+    }
+    const auto its_copy_time = std::chrono::steady_clock::now() - its_copy_start;
+
+    const auto its_view_start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < its_runs; ++i) {
+        vsomeip_v3::protocol::error_e error;
+        vsomeip_v3::protocol::send_command command(vsomeip_v3::protocol::id_e::SEND_ID);
+        init(command);
+        std::vector<std::uint8_t> buffer(vsomeip_v3::protocol::SEND_COMMAND_HEADER_SIZE + its_message.size());
+        command.serialize(&buffer[0], its_message.size(), error);
+        std::memcpy(&buffer[vsomeip_v3::protocol::SEND_COMMAND_HEADER_SIZE], its_message.data(), its_message.size());
+
+        vsomeip_v3::protocol::send_command received(vsomeip_v3::protocol::id_e::SEND_ID);
+        received.deserialize(buffer.data(), buffer.size(), error);
+        its_check -= received.get_message_size();
+    }
+    const auto its_view_time = std::chrono::steady_clock::now() - its_view_start;
+
+    EXPECT_EQ(its_check, 0u);
+    std::cout << "send_command round trips (" << its_runs << " x " << its_message.size() << " bytes): copy "
+              << std::chrono::duration_cast<std::chrono::microseconds>(its_copy_time).count() << "us, view "
+              << std::chrono::duration_cast<std::chrono::microseconds>(its_view_time).count() << "us" << std::endl;
+}
+}
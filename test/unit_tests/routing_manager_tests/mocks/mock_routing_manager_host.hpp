@@ -36,4 +36,7 @@ public:
     MOCK_METHOD(void, on_offered_services_info, ((std::vector<std::pair<vsomeip_v3::service_t, vsomeip_v3::instance_t>> & _services)),
                 (override));
     MOCK_METHOD(bool, is_routing, (), (const, override));
+    MOCK_METHOD(latency_statistics*, get_latency_statistics, (), (const, override));
+    MOCK_METHOD(handler_statistics*, get_handler_statistics, (), (const, override));
+    MOCK_METHOD(std::vector<dispatch_queue_sample_t>, get_dispatch_queue_history, (), (const, override));
 };
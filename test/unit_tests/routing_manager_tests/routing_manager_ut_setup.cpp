@@ -21,6 +21,16 @@ void routing_manager_ut_setup::SetUp() {
     its_manager->init();
 }
 
+void routing_manager_ut_data_setup::SetUp() {
+    configuration_ptr_ = std::make_shared<vsomeip_v3::cfg::configuration_impl>("routing_manager_ut_config.json");
+
+    EXPECT_CALL(mock_host_, get_io()).WillRepeatedly(ReturnRef(io_));
+    EXPECT_CALL(mock_host_, get_name()).WillRepeatedly(ReturnRef(name_));
+    EXPECT_CALL(mock_host_, get_configuration()).WillRepeatedly(Return(configuration_ptr_));
+
+    its_manager = new vsomeip_v3::routing_manager_impl(&mock_host_);
+}
+
 void routing_manager_ut_setup::TearDown() {
     delete its_manager;
     configuration_ptr_.reset();
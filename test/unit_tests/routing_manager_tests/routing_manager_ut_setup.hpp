@@ -27,4 +27,12 @@ protected:
     void TearDown() override;
 };
 
+// Same as routing_manager_ut_setup, but the routing manager is not
+// initialized. This is sufficient for tests of events and eventgroups and
+// does not need the service discovery module to be loadable.
+class routing_manager_ut_data_setup : public routing_manager_ut_setup {
+protected:
+    void SetUp() override;
+};
+
 #endif // ROUTING_MANAGER_UT_SETUP_HPP
@@ -0,0 +1,71 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../../../implementation/routing/include/change_detector.hpp"
+
+using vsomeip_v3::byte_t;
+using vsomeip_v3::change_detector;
+using vsomeip_v3::change_filter_t;
+using vsomeip_v3::change_filter_value_e;
+
+namespace {
+bool has_changed(const change_detector& _detector, const std::vector<byte_t>& _old, const std::vector<byte_t>& _new) {
+    return _detector.has_changed(_old.data(), _old.size(), _new.data(), _new.size());
+}
+}
+
+TEST(change_detector_test, ignore_mask) {
+    // Spans the vectorized and the scalar part of the compare
+    std::vector<byte_t> its_old(40, 0x55);
+    change_detector its_detector(std::map<std::size_t, byte_t> {{1, 0xff}, {20, 0x0f}, {35, 0xf0}});
+
+    EXPECT_FALSE(has_changed(its_detector, its_old, its_old));
+
+    auto its_new = its_old;
+    its_new[1] = 0x00;
+    its_new[20] = 0x5a;
+    its_new[35] = 0xa5;
+    EXPECT_FALSE(has_changed(its_detector, its_old, its_new));
+
+    its_new[20] = 0x65;
+    EXPECT_TRUE(has_changed(its_detector, its_old, its_new));
+
+    // Bytes behind the mask are compared completely
+    its_new = its_old;
+    its_new[39] = 0x54;
+    EXPECT_TRUE(has_changed(its_detector, its_old, its_new));
+}
+
+TEST(change_detector_test, length_change) {
+    change_detector its_detector(std::map<std::size_t, byte_t> {{2, 0xff}, {3, 0x01}});
+
+    EXPECT_FALSE(has_changed(its_detector, {0x01, 0x02}, {0x01, 0x02, 0x03}));
+    EXPECT_TRUE(has_changed(its_detector, {0x01, 0x02}, {0x01, 0x02, 0x03, 0x04}));
+    EXPECT_TRUE(has_changed(its_detector, {0x01, 0x02, 0x03, 0x04, 0x05}, {0x01, 0x02, 0x03}));
+}
+
+TEST(change_detector_test, tolerances) {
+    change_filter_t its_filter;
+    its_filter.tolerances_.push_back({0, change_filter_value_e::CFV_INT16, false, 5.0});
+    its_filter.tolerances_.push_back({2, change_filter_value_e::CFV_UINT16, true, 1.0});
+    change_detector its_detector(its_filter);
+
+    // big endian int16: 10 -> 14 / -> 16 / -> -1
+    EXPECT_FALSE(has_changed(its_detector, {0x00, 0x0a, 0x00, 0x00}, {0x00, 0x0e, 0x00, 0x00}));
+    EXPECT_TRUE(has_changed(its_detector, {0x00, 0x0a, 0x00, 0x00}, {0x00, 0x10, 0x00, 0x00}));
+    EXPECT_TRUE(has_changed(its_detector, {0x00, 0x0a, 0x00, 0x00}, {0xff, 0xff, 0x00, 0x00}));
+
+    // little endian uint16: 256 -> 257 / -> 255 / -> 258
+    EXPECT_FALSE(has_changed(its_detector, {0x00, 0x00, 0x00, 0x01}, {0x00, 0x00, 0x01, 0x01}));
+    EXPECT_FALSE(has_changed(its_detector, {0x00, 0x00, 0x00, 0x01}, {0x00, 0x00, 0xff, 0x00}));
+    EXPECT_TRUE(has_changed(its_detector, {0x00, 0x00, 0x00, 0x01}, {0x00, 0x00, 0x02, 0x01}));
+
+    // Tolerated values are never ignored when the length changes
+    EXPECT_TRUE(has_changed(its_detector, {0x00, 0x00}, {0x00, 0x00, 0x00, 0x00}));
+}
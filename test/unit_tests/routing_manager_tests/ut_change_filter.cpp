@@ -0,0 +1,100 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include <vsomeip/runtime.hpp>
+
+#include "routing_manager_ut_setup.hpp"
+
+#include "../../../implementation/configuration/include/change_filter.hpp"
+#include "../../../implementation/routing/include/change_detector.hpp"
+#include "../../../implementation/routing/include/event.hpp"
+
+namespace {
+
+constexpr vsomeip_v3::service_t service = 0x1234;
+constexpr vsomeip_v3::instance_t instance = 0x0001;
+
+const char* change_filter_config = R"({
+    "services" : [
+        {
+            "service" : "0x1234",
+            "instance" : "0x0001",
+            "unreliable" : "30509",
+            "events" : [
+                {
+                    "event" : "0x8001",
+                    "change_filter" : {
+                        "ignore" : [ "2", { "index" : "5", "mask" : "0x0f" } ],
+                        "tolerances" : [
+                            { "offset" : "8", "type" : "uint16", "epsilon" : "3" },
+                            { "offset" : "12", "type" : "float32", "byte_order" : "little_endian", "epsilon" : "0.5" },
+                            { "offset" : "16", "type" : "int128", "epsilon" : "1" }
+                        ]
+                    }
+                },
+                {
+                    "event" : "0x8002"
+                }
+            ]
+        }
+    ]
+})";
+}
+
+TEST(change_filter_test, load_event_change_filter) {
+    const std::string its_path("/tmp/ut_change_filter.json");
+    {
+        std::ofstream its_file(its_path);
+        its_file << change_filter_config;
+    }
+
+    auto its_configuration = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_path);
+    ASSERT_TRUE(its_configuration->load("ut_change_filter"));
+    std::remove(its_path.c_str());
+
+    const auto its_filter = its_configuration->get_change_filter(service, instance, 0x8001);
+    ASSERT_NE(its_filter, nullptr);
+    EXPECT_EQ(its_filter->ignore_, (std::map<std::size_t, vsomeip_v3::byte_t> {{2, 0xff}, {5, 0x0f}}));
+
+    // The tolerance of unknown type is dropped
+    ASSERT_EQ(its_filter->tolerances_.size(), 2u);
+    EXPECT_EQ(its_filter->tolerances_[0].offset_, 8u);
+    EXPECT_EQ(its_filter->tolerances_[0].type_, vsomeip_v3::change_filter_value_e::CFV_UINT16);
+    EXPECT_FALSE(its_filter->tolerances_[0].is_little_endian_);
+    EXPECT_DOUBLE_EQ(its_filter->tolerances_[0].epsilon_, 3.0);
+    EXPECT_EQ(its_filter->tolerances_[1].offset_, 12u);
+    EXPECT_EQ(its_filter->tolerances_[1].type_, vsomeip_v3::change_filter_value_e::CFV_FLOAT32);
+    EXPECT_TRUE(its_filter->tolerances_[1].is_little_endian_);
+    EXPECT_DOUBLE_EQ(its_filter->tolerances_[1].epsilon_, 0.5);
+
+    EXPECT_EQ(its_configuration->get_change_filter(service, instance, 0x8002), nullptr);
+    EXPECT_EQ(its_configuration->get_change_filter(service, instance, 0x8003), nullptr);
+}
+
+class change_filter_event_test : public routing_manager_ut_data_setup { };
+
+TEST_F(change_filter_event_test, first_update_is_accepted) {
+    auto its_event = std::make_shared<vsomeip_v3::event>(its_manager);
+    its_event->set_service(service);
+    its_event->set_instance(instance);
+    its_event->set_event(0x8001);
+    its_event->set_provided(true);
+    its_event->set_change_detector(std::make_shared<vsomeip_v3::change_detector>(std::map<std::size_t, vsomeip_v3::byte_t> {{0, 0xff}}));
+
+    // Compared to the empty initial payload, only ignored bytes differ. As
+    // the event has no value yet, the update must be accepted anyway.
+    const auto its_runtime = vsomeip_v3::runtime::get();
+    EXPECT_TRUE(its_event->prepare_update_payload(its_runtime->create_payload({0x01}), false));
+    EXPECT_TRUE(its_event->is_set());
+
+    // The current payload is still empty
+    EXPECT_FALSE(its_event->prepare_update_payload(its_runtime->create_payload({0x02}), false));
+    EXPECT_TRUE(its_event->prepare_update_payload(its_runtime->create_payload({0x02, 0x03}), false));
+}
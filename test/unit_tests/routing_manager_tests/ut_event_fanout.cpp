@@ -0,0 +1,151 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "routing_manager_ut_setup.hpp"
+
+#include "../../../implementation/endpoints/include/endpoint_definition.hpp"
+#include "../../../implementation/routing/include/event.hpp"
+#include "../../../implementation/routing/include/eventgroupinfo.hpp"
+#include "../../../implementation/routing/include/remote_subscription.hpp"
+
+namespace {
+
+constexpr vsomeip_v3::service_t service = 0x1234;
+constexpr vsomeip_v3::instance_t instance = 0x0001;
+constexpr vsomeip_v3::eventgroup_t first_eventgroup = 0x0001;
+constexpr vsomeip_v3::eventgroup_t second_eventgroup = 0x0002;
+
+std::shared_ptr<vsomeip_v3::endpoint_definition> get_target(const char* _address, uint16_t _port, bool _reliable) {
+    return vsomeip_v3::endpoint_definition::get(boost::asio::ip::make_address(_address), _port, _reliable, service, instance);
+}
+
+std::shared_ptr<vsomeip_v3::remote_subscription> create_subscription(const std::shared_ptr<vsomeip_v3::endpoint_definition>& _reliable,
+                                                                     const std::shared_ptr<vsomeip_v3::endpoint_definition>& _unreliable) {
+    auto its_subscription = std::make_shared<vsomeip_v3::remote_subscription>();
+    its_subscription->set_reliable(_reliable);
+    its_subscription->set_unreliable(_unreliable);
+    return its_subscription;
+}
+}
+
+class event_fanout_test : public routing_manager_ut_data_setup {
+protected:
+    void SetUp() override {
+        routing_manager_ut_data_setup::SetUp();
+
+        event_ = std::make_shared<vsomeip_v3::event>(its_manager);
+        event_->set_service(service);
+        event_->set_instance(instance);
+        event_->set_event(0x8001);
+        event_->set_eventgroups({first_eventgroup, second_eventgroup});
+        event_->set_provided(true);
+        event_->set_reliability(vsomeip_v3::reliability_type_e::RT_BOTH);
+    }
+
+    void TearDown() override {
+        event_.reset();
+        routing_manager_ut_setup::TearDown();
+    }
+
+    std::shared_ptr<vsomeip_v3::event> event_;
+};
+
+TEST_F(event_fanout_test, local_subscribe_unsubscribe_clear) {
+    EXPECT_TRUE(event_->get_fanout()->empty());
+
+    // Subscribers of all eventgroups are merged into one sorted list
+    ASSERT_TRUE(event_->add_subscriber(first_eventgroup, nullptr, 0x0103, false));
+    ASSERT_TRUE(event_->add_subscriber(second_eventgroup, nullptr, 0x0101, false));
+    ASSERT_TRUE(event_->add_subscriber(second_eventgroup, nullptr, 0x0103, false));
+    EXPECT_EQ(*event_->get_fanout(), (vsomeip_v3::event::subscribers_t {0x0101, 0x0103}));
+
+    // A published list is not changed by later subscriptions
+    const auto its_old_fanout = event_->get_fanout();
+    ASSERT_TRUE(event_->add_subscriber(first_eventgroup, nullptr, 0x0102, false));
+    EXPECT_EQ(*event_->get_fanout(), (vsomeip_v3::event::subscribers_t {0x0101, 0x0102, 0x0103}));
+    EXPECT_EQ(*its_old_fanout, (vsomeip_v3::event::subscribers_t {0x0101, 0x0103}));
+
+    // A client stays in the list as long as it is subscribed to any eventgroup
+    event_->remove_subscriber(first_eventgroup, 0x0103);
+    EXPECT_EQ(*event_->get_fanout(), (vsomeip_v3::event::subscribers_t {0x0101, 0x0102, 0x0103}));
+    event_->remove_subscriber(second_eventgroup, 0x0103);
+    EXPECT_EQ(*event_->get_fanout(), (vsomeip_v3::event::subscribers_t {0x0101, 0x0102}));
+    EXPECT_FALSE(event_->is_subscribed(0x0103));
+    EXPECT_TRUE(event_->is_subscribed(0x0102));
+
+    event_->clear_subscribers();
+    EXPECT_TRUE(event_->get_fanout()->empty());
+    EXPECT_FALSE(event_->is_subscribed(0x0101));
+}
+
+TEST_F(event_fanout_test, remote_subscribe_unsubscribe_clear) {
+    auto its_first = std::make_shared<vsomeip_v3::eventgroupinfo>(service, instance, first_eventgroup, 0x01, 0xffffff, 0xff);
+    auto its_second = std::make_shared<vsomeip_v3::eventgroupinfo>(service, instance, second_eventgroup, 0x01, 0xffffff, 0xff);
+    its_first->add_event(event_);
+    its_second->add_event(event_);
+    EXPECT_TRUE(event_->get_remote_targets()->reliable_.empty());
+    EXPECT_TRUE(event_->get_remote_targets()->unreliable_.empty());
+
+    const auto its_tcp_a = get_target("10.0.0.1", 30501, true);
+    const auto its_udp_a = get_target("10.0.0.1", 30502, false);
+    const auto its_udp_b = get_target("10.0.0.2", 30502, false);
+
+    // The same subscriber in both eventgroups is targeted once
+    const auto its_id_a = its_first->add_remote_subscription(create_subscription(its_tcp_a, its_udp_a));
+    const auto its_id_b = its_first->add_remote_subscription(create_subscription(nullptr, its_udp_b));
+    its_second->add_remote_subscription(create_subscription(nullptr, its_udp_a));
+
+    auto its_targets = event_->get_remote_targets();
+    EXPECT_EQ(its_targets->reliable_, (std::vector<std::shared_ptr<vsomeip_v3::endpoint_definition>> {its_tcp_a}));
+    EXPECT_EQ(its_targets->unreliable_.size(), 2u);
+    EXPECT_TRUE(std::is_sorted(its_targets->unreliable_.begin(), its_targets->unreliable_.end()));
+
+    // Unreliable events are not sent to reliable subscribers
+    event_->set_reliability(vsomeip_v3::reliability_type_e::RT_UNRELIABLE);
+    EXPECT_TRUE(event_->get_remote_targets()->reliable_.empty());
+    event_->set_reliability(vsomeip_v3::reliability_type_e::RT_BOTH);
+
+    its_first->remove_remote_subscription(its_id_b);
+    its_targets = event_->get_remote_targets();
+    EXPECT_EQ(its_targets->unreliable_, (std::vector<std::shared_ptr<vsomeip_v3::endpoint_definition>> {its_udp_a}));
+
+    // Still subscribed via the second eventgroup
+    its_first->remove_remote_subscription(its_id_a);
+    its_targets = event_->get_remote_targets();
+    EXPECT_TRUE(its_targets->reliable_.empty());
+    EXPECT_EQ(its_targets->unreliable_, (std::vector<std::shared_ptr<vsomeip_v3::endpoint_definition>> {its_udp_a}));
+
+    its_second->clear_remote_subscriptions();
+    EXPECT_TRUE(event_->get_remote_targets()->unreliable_.empty());
+
+    // Removing the event from the eventgroup drops its targets
+    its_first->add_remote_subscription(create_subscription(its_tcp_a, nullptr));
+    EXPECT_EQ(event_->get_remote_targets()->reliable_.size(), 1u);
+    its_first->remove_event(event_);
+    EXPECT_TRUE(event_->get_remote_targets()->reliable_.empty());
+}
+
+TEST_F(event_fanout_test, remote_multicast_threshold) {
+    auto its_eventgroup = std::make_shared<vsomeip_v3::eventgroupinfo>(service, instance, first_eventgroup, 0x01, 0xffffff, 0xff);
+    its_eventgroup->add_event(event_);
+    its_eventgroup->set_multicast(boost::asio::ip::make_address("224.0.0.1"), 30490);
+    its_eventgroup->set_threshold(2);
+
+    const auto its_udp_a = get_target("10.0.0.1", 30502, false);
+    const auto its_udp_b = get_target("10.0.0.2", 30502, false);
+    const auto its_multicast = get_target("224.0.0.1", 30490, false);
+
+    its_eventgroup->add_remote_subscription(create_subscription(nullptr, its_udp_a));
+    EXPECT_EQ(event_->get_remote_targets()->unreliable_, (std::vector<std::shared_ptr<vsomeip_v3::endpoint_definition>> {its_udp_a}));
+
+    // Reaching the threshold replaces the unicast targets by the multicast target
+    const auto its_id = its_eventgroup->add_remote_subscription(create_subscription(nullptr, its_udp_b));
+    EXPECT_EQ(event_->get_remote_targets()->unreliable_, (std::vector<std::shared_ptr<vsomeip_v3::endpoint_definition>> {its_multicast}));
+
+    its_eventgroup->remove_remote_subscription(its_id);
+    EXPECT_EQ(event_->get_remote_targets()->unreliable_, (std::vector<std::shared_ptr<vsomeip_v3::endpoint_definition>> {its_udp_a}));
+}
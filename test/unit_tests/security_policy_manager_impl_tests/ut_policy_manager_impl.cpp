@@ -9,12 +9,16 @@
 #include <gtest/gtest.h>
 #include <vsomeip/defines.hpp>
 
+#include <sstream>
+
+#include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
 #include "../../../implementation/configuration/include/configuration_element.hpp"
 #include "../../../implementation/security/include/policy.hpp"
 #include "../../../implementation/security/include/policy_manager_impl.hpp"
 #include "../../../implementation/utility/include/bithelper.hpp"
+#include "../../../implementation/utility/include/json_reader.hpp"
 #include "../../../implementation/utility/include/utility.hpp"
 
 #include "policy_manager_impl_unit_test_macro.hpp"
@@ -1996,3 +2000,65 @@ TEST(security_policy_manager_test, is_policy_extension_loaded) {
     // Clean up, remove directory.
     boost::filesystem::remove_all(final_path_string, ec);
 }
+
+TEST(security_policy_manager_test, convert_streamed_policy) {
+    // Policies that are converted while the file is read must be equal to
+    // those that are converted from the complete tree.
+    const std::string its_json(R"({
+        "security" : {
+            "check_credentials" : "true",
+            "policies" : [
+                { "credentials" : { "uid" : "0", "gid" : "0" }, "deny" : { } },
+                { "credentials" : { "uid" : "any", "gid" : "1000" },
+                  "allow" : { "requests" : [ { "service" : "0x1234", "instance" : "any" },
+                                             { "service" : "0x1235", "instances" : [ { "ids" : [ "0x1", { "first" : "0x10", "last" : "0x20" } ],
+                                                                                       "methods" : [ "0x8001", { "first" : "0x1", "last" : "max" } ] } ] } ] } },
+                { "credentials" : { "uid" : [ { "first" : "100", "last" : "200" }, "300" ], "gid" : "any" },
+                  "allow" : { "offers" : [ { "service" : "0x1236", "instances" : [ "0x1", "0x2" ] } ] } },
+                { "credentials" : { "allow" : [ { "uid" : [ "4000" ], "gid" : [ "4001" ] } ] },
+                  "deny" : { "requests" : [ { "service" : "any", "instance" : "0x1" } ], "offers" : [ { "service" : "0x1237", "instance" : "0x1" } ] } }
+            ]
+        }
+    })");
+
+    vsomeip_v3::policy_manager_impl its_policy_manager;
+    boost::property_tree::ptree its_tree;
+    std::vector<std::shared_ptr<vsomeip_v3::policy>> its_streamed;
+    vsomeip_v3::json_ptree_builder its_builder(its_tree, {"security", "policies"}, [&](const boost::property_tree::ptree& _policy) {
+        its_streamed.push_back(its_policy_manager.convert_policy(_policy));
+    });
+    std::string its_error;
+    ASSERT_TRUE(vsomeip_v3::json_reader::parse(its_json.data(), its_json.size(), its_builder, its_error)) << its_error;
+
+    boost::property_tree::ptree its_expected;
+    std::istringstream its_stream(its_json);
+    boost::property_tree::json_parser::read_json(its_stream, its_expected);
+    const auto& its_policies = its_expected.get_child("security.policies");
+    ASSERT_EQ(its_streamed.size(), its_policies.size());
+
+    auto s = its_streamed.begin();
+    for (const auto& p : its_policies) {
+        const auto its_policy = its_policy_manager.convert_policy(p.second);
+        EXPECT_EQ((*s)->credentials_, its_policy->credentials_);
+        EXPECT_EQ((*s)->allow_who_, its_policy->allow_who_);
+        EXPECT_EQ((*s)->requests_, its_policy->requests_);
+        EXPECT_EQ((*s)->offers_, its_policy->offers_);
+        EXPECT_EQ((*s)->allow_what_, its_policy->allow_what_);
+        ++s;
+    }
+
+    // Loading the element adds the converted policies
+    vsomeip_v3::configuration_element its_element("streamed", boost::property_tree::ptree());
+    its_element.tree_.swap(its_tree);
+    its_element.policies_ = its_streamed;
+    its_policy_manager.load(its_element, lazy_load);
+    EXPECT_FALSE(its_policy_manager.is_audit());
+
+    vsomeip_sec_client_t its_client;
+    its_client.user = 5;
+    its_client.group = 1000;
+    its_client.port = VSOMEIP_SEC_PORT_UNUSED;
+    its_client.host = 0;
+    EXPECT_TRUE(its_policy_manager.is_client_allowed(&its_client, 0x1234, 0x1, 0x1));
+    EXPECT_FALSE(its_policy_manager.is_client_allowed(&its_client, 0x1236, 0x1, 0x1));
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <map>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+
+#include "../../../implementation/logger/include/async_logger.hpp"
+#include "../../../implementation/logger/include/log_writer.hpp"
+
+using vsomeip_v3::logger::async_logger;
+using vsomeip_v3::logger::level_e;
+using vsomeip_v3::logger::log_record;
+using vsomeip_v3::logger::log_writer;
+
+TEST(async_logger_test, writes_lines_of_all_threads_in_time_order) {
+    std::mutex its_mutex;
+    std::vector<log_record> its_records;
+    {
+        async_logger its_logger(64, true, [&](const std::vector<log_record>& _records) {
+            std::scoped_lock its_lock{its_mutex};
+            // Each batch is ordered by time
+            for (std::size_t i = 1; i < _records.size(); ++i) {
+                EXPECT_LE(_records[i - 1].when_, _records[i].when_);
+            }
+            its_records.insert(its_records.end(), _records.begin(), _records.end());
+        });
+
+        std::vector<std::thread> its_threads;
+        for (int t = 0; t < 4; ++t) {
+            its_threads.emplace_back([&its_logger, t]() {
+                for (int i = 0; i < 1000; ++i) {
+                    its_logger.push(level_e::LL_INFO, std::chrono::system_clock::now(), std::to_string(t) + ":" + std::to_string(i));
+                }
+            });
+        }
+        for (auto& t : its_threads) {
+            t.join();
+        }
+
+        its_logger.flush();
+        std::scoped_lock its_lock{its_mutex};
+        EXPECT_EQ(its_records.size(), 4000u);
+        EXPECT_EQ(its_logger.get_dropped(), 0u);
+    }
+
+    // The lines of each thread keep their order
+    std::map<std::string, int> its_next;
+    for (const auto& r : its_records) {
+        const auto its_separator = r.text_.find(':');
+        const auto its_thread = r.text_.substr(0, its_separator);
+        EXPECT_EQ(std::stoi(r.text_.substr(its_separator + 1)), its_next[its_thread]++);
+    }
+}
+
+TEST(async_logger_test, counts_and_reports_dropped_lines) {
+    std::mutex its_mutex;
+    std::condition_variable its_condition;
+    bool is_released(false);
+    std::vector<std::string> its_lines;
+
+    async_logger its_logger(4, false, [&](const std::vector<log_record>& _records) {
+        std::unique_lock its_lock{its_mutex};
+        its_condition.wait(its_lock, [&is_released]() { return is_released; });
+        for (const auto& r : _records) {
+            its_lines.push_back(r.text_);
+        }
+    });
+
+    // The first line blocks the writer in the sink, the next four fill the ring
+    its_logger.push(level_e::LL_INFO, std::chrono::system_clock::now(), "first");
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        its_logger.push(level_e::LL_INFO, std::chrono::system_clock::now(), "probe");
+        if (its_logger.get_dropped() > 0) {
+            break;
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        its_logger.push(level_e::LL_INFO, std::chrono::system_clock::now(), "dropped");
+    }
+    const auto its_dropped = its_logger.get_dropped();
+    EXPECT_GE(its_dropped, 11u);
+
+    {
+        std::scoped_lock its_lock{its_mutex};
+        is_released = true;
+    }
+    its_condition.notify_all();
+    its_logger.flush();
+
+    std::scoped_lock its_lock{its_mutex};
+    EXPECT_EQ(its_lines.front(), "first");
+    const std::string its_report("Dropped " + std::to_string(its_dropped) + " log messages as the queue of the logging thread was full");
+    EXPECT_NE(std::find(its_lines.begin(), its_lines.end(), its_report), its_lines.end());
+}
+
+TEST(async_logger_test, rotates_log_file) {
+    const auto its_folder = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("ut_async_logger_%%%%%%%%");
+    boost::filesystem::create_directories(its_folder);
+    const std::string its_path((its_folder / "vsomeip.log").string());
+
+    log_writer its_writer;
+    its_writer.set_file(true, its_path, 1000, 2);
+    const std::string its_text(100, 'x');
+    for (int i = 0; i < 50; ++i) {
+        its_writer.write(level_e::LL_INFO, std::chrono::system_clock::now(), its_text);
+    }
+
+    EXPECT_TRUE(boost::filesystem::exists(its_path));
+    EXPECT_TRUE(boost::filesystem::exists(its_path + ".1"));
+    EXPECT_TRUE(boost::filesystem::exists(its_path + ".2"));
+    EXPECT_FALSE(boost::filesystem::exists(its_path + ".3"));
+    for (const auto& f : {its_path, its_path + ".1", its_path + ".2"}) {
+        EXPECT_LE(boost::filesystem::file_size(f), 1000u) << f;
+    }
+
+    // "YYYY-MM-DD HH:MM:SS.uuuuuu [info] xxx"
+    std::ifstream its_file(its_path);
+    std::string its_line;
+    ASSERT_TRUE(std::getline(its_file, its_line));
+    EXPECT_EQ(its_line.size(), 26 + 8 + its_text.size());
+    EXPECT_EQ(its_line.substr(26), " [info] " + its_text);
+
+    boost::filesystem::remove_all(its_folder);
+}
@@ -0,0 +1,134 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "../../../implementation/utility/include/configuration_cache.hpp"
+
+using vsomeip_v3::configuration_cache;
+using vsomeip_v3::configuration_element;
+
+namespace {
+
+class configuration_cache_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        folder_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("ut_configuration_cache_%%%%%%%%");
+        boost::filesystem::create_directories(folder_ / "sub");
+        write("b.json", R"({ "applications" : [ { "name" : "client", "id" : "0x1234" } ] })");
+        write("a.json", R"({ "unicast" : "127.0.0.1", "logging" : { "level" : "debug", "console" : "true" } })");
+        // not read by the configuration
+        write("sub/c.json", R"({ "routing" : "client" })");
+        image_ = (folder_ / "vsomeip.cache").string();
+        input_ = {(folder_ / "a.json").string(), (folder_ / "b.json").string()};
+    }
+
+    void TearDown() override { boost::filesystem::remove_all(folder_); }
+
+    void write(const std::string& _name, const std::string& _content) {
+        std::ofstream its_file((folder_ / _name).string(), std::ios::trunc);
+        its_file << _content;
+    }
+
+    boost::filesystem::path folder_;
+    std::string image_;
+    std::set<std::string> input_;
+};
+
+} // namespace
+
+TEST_F(configuration_cache_test, provides_parsed_trees) {
+    std::string its_error;
+    ASSERT_TRUE(configuration_cache::create(input_, image_, its_error)) << its_error;
+
+    configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(image_, input_));
+
+    std::vector<configuration_element> its_elements;
+    ASSERT_TRUE(its_cache.get(its_elements, [](const std::string&) { return true; }));
+    ASSERT_EQ(its_elements.size(), 2u);
+    for (const auto& e : its_elements) {
+        boost::property_tree::ptree its_tree;
+        boost::property_tree::json_parser::read_json(e.name_, its_tree);
+        EXPECT_EQ(e.tree_, its_tree) << e.name_;
+    }
+    EXPECT_EQ(its_elements[0].name_, (folder_ / "a.json").string());
+    EXPECT_EQ(its_elements[0].tree_.get<std::string>("logging.level"), "debug");
+
+    its_elements.clear();
+    ASSERT_TRUE(its_cache.get(its_elements, [](const std::string& _name) { return _name.find("b.json") != std::string::npos; }));
+    ASSERT_EQ(its_elements.size(), 1u);
+    EXPECT_EQ(its_elements[0].tree_.get_child("applications").begin()->second.get<std::string>("id"), "0x1234");
+}
+
+TEST_F(configuration_cache_test, reads_folders_like_the_configuration) {
+    const std::set<std::string> its_input{folder_.string()};
+    std::string its_error;
+    // The image itself is not part of the folder yet
+    image_ = (folder_ / "sub" / "vsomeip.cache").string();
+    ASSERT_TRUE(configuration_cache::create(its_input, image_, its_error)) << its_error;
+
+    const auto its_files = configuration_cache::get_files(its_input);
+    ASSERT_EQ(its_files.size(), 2u);
+    EXPECT_EQ(its_files[0], (folder_ / "a.json").string());
+    EXPECT_EQ(its_files[1], (folder_ / "b.json").string());
+
+    configuration_cache its_cache;
+    EXPECT_TRUE(its_cache.open(image_, its_input));
+
+    // A new file makes the image outdated
+    write("d.json", "{}");
+    EXPECT_FALSE(its_cache.open(image_, its_input));
+}
+
+TEST_F(configuration_cache_test, rejects_outdated_image) {
+    std::string its_error;
+    ASSERT_TRUE(configuration_cache::create(input_, image_, its_error)) << its_error;
+
+    configuration_cache its_cache;
+    // Different input
+    EXPECT_FALSE(its_cache.open(image_, {(folder_ / "a.json").string()}));
+
+    // Changed content
+    write("b.json", R"({ "applications" : [ { "name" : "client", "id" : "0x1235" } ] })");
+    EXPECT_FALSE(its_cache.open(image_, input_));
+
+    std::vector<configuration_element> its_elements;
+    EXPECT_FALSE(its_cache.get(its_elements, [](const std::string&) { return true; }));
+    EXPECT_TRUE(its_elements.empty());
+}
+
+TEST_F(configuration_cache_test, accepts_rewritten_unchanged_files) {
+    std::string its_error;
+    ASSERT_TRUE(configuration_cache::create(input_, image_, its_error)) << its_error;
+
+    // New metadata, but the same content
+    boost::filesystem::remove(folder_ / "a.json");
+    write("a.json", R"({ "unicast" : "127.0.0.1", "logging" : { "level" : "debug", "console" : "true" } })");
+
+    configuration_cache its_cache;
+    ASSERT_TRUE(its_cache.open(image_, input_));
+    std::vector<configuration_element> its_elements;
+    EXPECT_TRUE(its_cache.get(its_elements, [](const std::string&) { return true; }));
+    EXPECT_EQ(its_elements.size(), 2u);
+}
+
+TEST_F(configuration_cache_test, rejects_invalid_image) {
+    configuration_cache its_cache;
+    EXPECT_FALSE(its_cache.open(image_, input_));
+
+    write("vsomeip.cache", "VSCC");
+    EXPECT_FALSE(its_cache.open(image_, input_));
+
+    write("b.json", "{ invalid");
+    std::string its_error;
+    EXPECT_FALSE(configuration_cache::create(input_, image_, its_error));
+    EXPECT_FALSE(its_error.empty());
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/utility/include/handler_statistics.hpp"
+
+using namespace vsomeip_v3;
+using namespace std::chrono_literals;
+
+TEST(handler_statistics_test, records_per_kind_and_method) {
+    handler_statistics its_statistics(2);
+
+    its_statistics.record(handler_kind_e::HK_MESSAGE, 0x1234, 0x8001, 5us, 10us);
+    its_statistics.record(handler_kind_e::HK_MESSAGE, 0x1234, 0x8001, 15us, 30us);
+    its_statistics.record(handler_kind_e::HK_AVAILABILITY, 0x1234, ANY_METHOD, 1us, 2us);
+    // Covered by the kind only
+    its_statistics.record(handler_kind_e::HK_STATE, ANY_SERVICE, ANY_METHOD, 1us, 1us);
+    // Exceeds the maximum number of methods
+    its_statistics.record(handler_kind_e::HK_MESSAGE, 0x1111, 0x0001, 1us, 1us);
+
+    const auto its_profiles = its_statistics.get();
+    ASSERT_EQ(its_profiles.size(), 5u);
+
+    EXPECT_EQ(its_profiles[0].kind_, handler_kind_e::HK_MESSAGE);
+    EXPECT_EQ(its_profiles[0].service_, ANY_SERVICE);
+    EXPECT_EQ(its_profiles[0].wall_time_.count_, 3u);
+    EXPECT_EQ(its_profiles[1].kind_, handler_kind_e::HK_AVAILABILITY);
+    EXPECT_EQ(its_profiles[2].kind_, handler_kind_e::HK_STATE);
+
+    EXPECT_EQ(its_profiles[3].kind_, handler_kind_e::HK_MESSAGE);
+    EXPECT_EQ(its_profiles[3].service_, 0x1234);
+    EXPECT_EQ(its_profiles[3].method_, 0x8001);
+    EXPECT_EQ(its_profiles[3].wall_time_.count_, 2u);
+    EXPECT_EQ(its_profiles[3].wall_time_.sum_, 40us);
+    EXPECT_EQ(its_profiles[3].cpu_time_.max_, 15us);
+
+    EXPECT_EQ(its_profiles[4].kind_, handler_kind_e::HK_AVAILABILITY);
+    EXPECT_EQ(its_profiles[4].method_, ANY_METHOD);
+
+    EXPECT_EQ(its_statistics.get_ignored(), 1u);
+
+    const auto its_slowest = handler_statistics::get_slowest(its_profiles, 1);
+    ASSERT_EQ(its_slowest.size(), 1u);
+    EXPECT_EQ(its_slowest[0].service_, 0x1234);
+    EXPECT_EQ(its_slowest[0].method_, 0x8001);
+    EXPECT_EQ(handler_statistics::get_slowest(its_profiles, 10).size(), 2u);
+}
+
+TEST(handler_statistics_test, thread_cpu_time_advances) {
+#if defined(__linux__)
+    const auto its_start = handler_statistics::get_thread_cpu_time();
+    volatile std::uint64_t its_sum(0);
+    for (std::uint64_t i = 0; i < 1000000; ++i) {
+        its_sum = its_sum + i;
+    }
+    EXPECT_GT(handler_statistics::get_thread_cpu_time(), its_start);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(handler_statistics_test, queue_depth_history_keeps_maximum_per_second) {
+    queue_depth_history its_history;
+    const std::chrono::steady_clock::time_point its_start(100s);
+
+    its_history.record(3, its_start);
+    its_history.record(7, its_start + 500ms);
+    its_history.record(2, its_start + 1s);
+    its_history.record(1, its_start + 5s);
+
+    auto its_samples = its_history.get();
+    ASSERT_EQ(its_samples.size(), 3u);
+    EXPECT_EQ(its_samples[0].time_, its_start);
+    EXPECT_EQ(its_samples[0].max_depth_, 7u);
+    EXPECT_EQ(its_samples[1].max_depth_, 2u);
+    EXPECT_EQ(its_samples[2].time_, its_start + 5s);
+    EXPECT_EQ(its_samples[2].max_depth_, 1u);
+
+    for (std::size_t i = 0; i < queue_depth_history::period_count_; ++i) {
+        its_history.record(i, its_start + 10s + std::chrono::seconds(i));
+    }
+    its_samples = its_history.get();
+    ASSERT_EQ(its_samples.size(), queue_depth_history::period_count_);
+    EXPECT_EQ(its_samples.front().max_depth_, 0u);
+    EXPECT_EQ(its_samples.back().max_depth_, queue_depth_history::period_count_ - 1);
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include "../../../implementation/utility/include/instrumentation.hpp"
+
+using namespace vsomeip_v3;
+using namespace std::chrono_literals;
+
+namespace {
+
+bool find_site(const std::string& _name, lock_site_profile_t& _profile) {
+    for (const auto& p : instrumentation::get_lock_sites()) {
+        if (p.name_ == _name) {
+            _profile = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST(instrumentation_test, profiling_mutex_records_acquisitions_per_site) {
+    profiling_mutex<std::mutex> its_first("ut_instrumentation::acquisitions_");
+    profiling_mutex<std::recursive_mutex> its_second("ut_instrumentation::acquisitions_");
+
+    for (int i = 0; i < 3; ++i) {
+        std::scoped_lock its_lock(its_first);
+    }
+    {
+        std::scoped_lock its_lock(its_second);
+        std::scoped_lock its_recursive_lock(its_second);
+    }
+    ASSERT_TRUE(its_first.try_lock());
+    its_first.unlock();
+
+    lock_site_profile_t its_profile;
+    ASSERT_TRUE(find_site("ut_instrumentation::acquisitions_", its_profile));
+    EXPECT_EQ(its_profile.acquisitions_, 6u);
+    EXPECT_EQ(its_profile.wait_time_.count_, 0u);
+}
+
+TEST(instrumentation_test, profiling_mutex_records_wait_time) {
+    profiling_mutex<std::mutex> its_mutex("ut_instrumentation::contention_");
+
+    std::promise<void> is_locked;
+    std::thread its_holder([&its_mutex, &is_locked] {
+        std::scoped_lock its_lock(its_mutex);
+        is_locked.set_value();
+        std::this_thread::sleep_for(20ms);
+    });
+    is_locked.get_future().wait();
+    { std::scoped_lock its_lock(its_mutex); }
+    its_holder.join();
+
+    lock_site_profile_t its_profile;
+    ASSERT_TRUE(find_site("ut_instrumentation::contention_", its_profile));
+    EXPECT_EQ(its_profile.acquisitions_, 2u);
+    EXPECT_EQ(its_profile.wait_time_.count_, 1u);
+    EXPECT_GE(its_profile.wait_time_.max_, 5ms);
+
+    std::stringstream its_dump;
+    instrumentation::dump(its_dump);
+    EXPECT_NE(its_dump.str().find("ut_instrumentation::contention_: #=2 contended=1"), std::string::npos);
+}
+
+TEST(instrumentation_test, named_mutex_waits_on_its_condition_variable) {
+    named_mutex its_mutex("ut_instrumentation::condition_");
+    named_mutex::condition_variable its_condition;
+    bool is_signaled(false);
+
+    std::thread its_signaler([&] {
+        std::scoped_lock its_lock(its_mutex);
+        is_signaled = true;
+        its_condition.notify_one();
+    });
+    {
+        named_mutex::unique_lock its_lock(its_mutex);
+        EXPECT_TRUE(its_condition.wait_for(its_lock, 5s, [&is_signaled] { return is_signaled; }));
+    }
+    its_signaler.join();
+
+    lock_site_profile_t its_profile;
+    EXPECT_EQ(find_site("ut_instrumentation::condition_", its_profile), instrumentation::is_enabled());
+}
+
+TEST(instrumentation_test, counts_allocations_of_the_hook) {
+    const auto its_allocations = instrumentation::get_allocations();
+    const auto its_thread_allocations = instrumentation::get_thread_allocations();
+    instrumentation::count_allocation();
+    instrumentation::count_allocation();
+    EXPECT_EQ(instrumentation::get_thread_allocations(), its_thread_allocations + 2);
+    EXPECT_GE(instrumentation::get_allocations(), its_allocations + 2);
+
+    std::uint64_t its_other_allocations(0);
+    std::thread its_thread([&its_other_allocations] {
+        instrumentation::count_allocation();
+        its_other_allocations = instrumentation::get_thread_allocations();
+    });
+    its_thread.join();
+    EXPECT_EQ(its_other_allocations, 1u);
+    EXPECT_EQ(instrumentation::get_thread_allocations(), its_thread_allocations + 2);
+    EXPECT_GE(instrumentation::get_allocations(), its_allocations + 3);
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include <boost/asio/post.hpp>
+
+#include "../../../implementation/utility/include/io_shards.hpp"
+
+using vsomeip_v3::io_shards;
+
+TEST(io_shards_test, selects_primary_without_sharding) {
+    boost::asio::io_context its_io;
+    for (std::size_t its_key = 0; its_key < 16; ++its_key) {
+        EXPECT_EQ(&io_shards::select(its_io, its_key), &its_io);
+    }
+    EXPECT_FALSE(boost::asio::has_service<io_shards>(its_io));
+}
+
+TEST(io_shards_test, pins_keys_to_shards) {
+    boost::asio::io_context its_io;
+    auto& its_shards = boost::asio::use_service<io_shards>(its_io);
+    its_shards.resize(4);
+    its_shards.resize(2); // never shrinks
+    ASSERT_EQ(its_shards.size(), 4u);
+
+    EXPECT_EQ(&io_shards::select(its_io, 0), &its_io);
+    EXPECT_EQ(&io_shards::select(its_io, 4), &its_io);
+    for (std::size_t its_key = 1; its_key < 4; ++its_key) {
+        auto& its_shard = io_shards::select(its_io, its_key);
+        EXPECT_NE(&its_shard, &its_io);
+        EXPECT_EQ(&its_shard, &io_shards::select(its_io, its_key + 4));
+        for (std::size_t its_other = its_key + 1; its_other < 4; ++its_other) {
+            EXPECT_NE(&its_shard, &io_shards::select(its_io, its_other));
+        }
+    }
+}
+
+TEST(io_shards_test, stops_and_restarts_shards) {
+    boost::asio::io_context its_io;
+    auto& its_shards = boost::asio::use_service<io_shards>(its_io);
+    its_shards.resize(2);
+    auto& its_shard = its_shards.at(1);
+
+    std::atomic<int> its_count(0);
+    std::thread its_thread([&its_shard] { its_shard.run(); });
+    boost::asio::post(its_shard, [&its_count] { its_count++; });
+    its_shards.stop();
+    its_thread.join();
+    EXPECT_TRUE(its_shard.stopped());
+
+    // Handlers posted while stopped run after the restart
+    boost::asio::post(its_shard, [&its_count] { its_count++; });
+    its_shards.restart();
+    EXPECT_FALSE(its_shard.stopped());
+    its_thread = std::thread([&its_shard] { its_shard.run(); });
+    while (its_count < 2) {
+        std::this_thread::yield();
+    }
+    its_shards.stop();
+    its_thread.join();
+    EXPECT_EQ(its_count, 2);
+}
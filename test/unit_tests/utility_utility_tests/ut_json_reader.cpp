@@ -0,0 +1,157 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "../../../implementation/utility/include/json_reader.hpp"
+
+using vsomeip_v3::json_ptree_builder;
+using vsomeip_v3::json_reader;
+
+namespace {
+
+// Returns whether both parsers accept "_json" and build the same tree
+::testing::AssertionResult same_as_read_json(const std::string& _json) {
+    boost::property_tree::ptree its_expected;
+    bool is_expected_valid(true);
+    try {
+        std::istringstream its_stream(_json);
+        boost::property_tree::json_parser::read_json(its_stream, its_expected);
+    } catch (const boost::property_tree::json_parser_error&) {
+        is_expected_valid = false;
+    }
+
+    boost::property_tree::ptree its_tree;
+    json_ptree_builder its_builder(its_tree);
+    std::string its_error;
+    const bool is_valid = json_reader::parse(_json.data(), _json.size(), its_builder, its_error);
+    if (is_valid != is_expected_valid) {
+        return ::testing::AssertionFailure() << "read_json " << (is_expected_valid ? "accepts" : "rejects") << " " << _json << " ("
+                                             << its_error << ")";
+    }
+    if (is_valid && its_tree != its_expected) {
+        return ::testing::AssertionFailure() << "different trees for " << _json;
+    }
+    return ::testing::AssertionSuccess();
+}
+
+} // namespace
+
+TEST(json_reader_test, builds_same_tree_as_read_json) {
+    EXPECT_TRUE(same_as_read_json("{}"));
+    EXPECT_TRUE(same_as_read_json("[]"));
+    EXPECT_TRUE(same_as_read_json("\"root\""));
+    EXPECT_TRUE(same_as_read_json(" { \"a\" : \"1\", \"b\" : { \"c\" : [ \"x\", \"y\" ] }, \"a\" : \"2\" } "));
+    EXPECT_TRUE(same_as_read_json(R"({ "n" : [ 0, -1, 12.5, 1e3, -0.25E-2 ], "b" : [ true, false, null ] })"));
+    EXPECT_TRUE(same_as_read_json(R"({ "nested" : [ [ ], { }, [ { "a" : [ [ "1" ] ] } ] ] })"));
+    EXPECT_TRUE(same_as_read_json(R"({ "e" : "\"\\\/\b\f\n\r\t", "u" : "\u00e4\u20ac\ud83d\ude00", "utf8" : "äö€" })"));
+    EXPECT_TRUE(same_as_read_json("\xef\xbb\xbf{ \"bom\" : \"1\" }"));
+    EXPECT_TRUE(same_as_read_json("{ \"\" : \"empty key\" }"));
+}
+
+TEST(json_reader_test, rejects_what_read_json_rejects) {
+    EXPECT_TRUE(same_as_read_json(""));
+    EXPECT_TRUE(same_as_read_json("{"));
+    EXPECT_TRUE(same_as_read_json("{ \"a\" }"));
+    EXPECT_TRUE(same_as_read_json("{ \"a\" : \"1\", }"));
+    EXPECT_TRUE(same_as_read_json("[ 1 2 ]"));
+    EXPECT_TRUE(same_as_read_json("{ a : 1 }"));
+    EXPECT_TRUE(same_as_read_json("{} {}"));
+    EXPECT_TRUE(same_as_read_json("[ 01 ]"));
+    EXPECT_TRUE(same_as_read_json("[ 1. ]"));
+    EXPECT_TRUE(same_as_read_json("[ -a ]"));
+    EXPECT_TRUE(same_as_read_json("[ 1e ]"));
+    EXPECT_TRUE(same_as_read_json("[ tru ]"));
+    EXPECT_TRUE(same_as_read_json("[ \"unterminated ]"));
+    EXPECT_TRUE(same_as_read_json("[ \"tab\tinside\" ]"));
+    EXPECT_TRUE(same_as_read_json("[ \"\\x\" ]"));
+    EXPECT_TRUE(same_as_read_json("[ \"\\u12g4\" ]"));
+    EXPECT_TRUE(same_as_read_json("[ \"\\udc00\" ]"));
+    EXPECT_TRUE(same_as_read_json("[ \"\\ud800x\" ]"));
+    EXPECT_TRUE(same_as_read_json("[ \"\xff\" ]"));
+    EXPECT_TRUE(same_as_read_json("[ \"\xc3\" ]"));
+}
+
+TEST(json_reader_test, reports_error_position) {
+    boost::property_tree::ptree its_tree;
+    json_ptree_builder its_builder(its_tree);
+    const std::string its_json("{\n  \"a\" : \"1\",\n  \"b\" \"2\"\n}");
+    std::string its_error;
+    EXPECT_FALSE(json_reader::parse(its_json.data(), its_json.size(), its_builder, its_error));
+    EXPECT_EQ(its_error, "<unspecified file>(3): expected ':'");
+
+    EXPECT_FALSE(json_reader::parse_file("/nonexistent/vsomeip.json", its_builder, its_error));
+    EXPECT_FALSE(its_error.empty());
+
+    // Deep nesting is rejected instead of exhausting the stack
+    const std::string its_deep(100000, '[');
+    EXPECT_FALSE(json_reader::parse(its_deep.data(), its_deep.size(), its_builder, its_error));
+}
+
+TEST(json_reader_test, passes_split_array_elements) {
+    const std::string its_json(R"({
+        "security" : {
+            "check_credentials" : "true",
+            "policies" : [ { "credentials" : { "uid" : "1", "gid" : "2" } }, "plain", [ "3" ], { } ]
+        },
+        "policies" : [ { "not" : "split" } ]
+    })");
+
+    boost::property_tree::ptree its_tree;
+    std::vector<boost::property_tree::ptree> its_elements;
+    json_ptree_builder its_builder(its_tree, {"security", "policies"},
+                                   [&its_elements](const boost::property_tree::ptree& _element) { its_elements.push_back(_element); });
+    std::string its_error;
+    ASSERT_TRUE(json_reader::parse(its_json.data(), its_json.size(), its_builder, its_error)) << its_error;
+
+    boost::property_tree::ptree its_expected;
+    std::istringstream its_stream(its_json);
+    boost::property_tree::json_parser::read_json(its_stream, its_expected);
+
+    // The elements are passed in order, the array stays in the tree without them
+    auto& its_policies = its_expected.get_child("security.policies");
+    ASSERT_EQ(its_elements.size(), its_policies.size());
+    auto e = its_elements.begin();
+    for (const auto& p : its_policies) {
+        EXPECT_EQ(*e++, p.second);
+    }
+    its_policies.clear();
+    EXPECT_EQ(its_tree, its_expected);
+    EXPECT_EQ(its_tree.get_child("policies").size(), 1u);
+}
+
+TEST(json_reader_test, parses_repository_configurations_like_read_json) {
+    // All configuration files of the repository, including the invalid ones
+    std::size_t its_count(0);
+    for (const auto& its_folder : {"config", "test"}) {
+        const auto its_path = boost::filesystem::path(VSOMEIP_SOURCE_DIR) / its_folder;
+        for (auto i = boost::filesystem::recursive_directory_iterator(its_path); i != boost::filesystem::recursive_directory_iterator();
+             ++i) {
+            if (i->path().extension() != ".json") {
+                continue;
+            }
+            boost::property_tree::ptree its_expected;
+            bool is_expected_valid(true);
+            try {
+                boost::property_tree::json_parser::read_json(i->path().string(), its_expected);
+            } catch (const boost::property_tree::json_parser_error&) {
+                is_expected_valid = false;
+            }
+
+            boost::property_tree::ptree its_tree;
+            json_ptree_builder its_builder(its_tree);
+            std::string its_error;
+            ASSERT_EQ(json_reader::parse_file(i->path().string(), its_builder, its_error), is_expected_valid) << i->path() << its_error;
+            EXPECT_EQ(its_tree, its_expected) << i->path();
+            its_count++;
+        }
+    }
+    EXPECT_GT(its_count, 0u);
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../../implementation/utility/include/latency_statistics.hpp"
+
+using namespace vsomeip_v3;
+using namespace std::chrono_literals;
+
+TEST(latency_statistics_test, bucket_bounds_contain_latency) {
+    std::size_t its_last_index(0);
+    for (std::uint64_t its_latency = 0; its_latency < (std::uint64_t(1) << 41); its_latency = its_latency * 3 / 2 + 1) {
+        const auto its_index = latency_histogram::get_index(its_latency);
+        EXPECT_GE(its_index, its_last_index);
+        its_last_index = its_index;
+
+        if (its_latency < (std::uint64_t(1) << 40)) {
+            const auto its_upper = latency_histogram::get_upper_bound(its_index);
+            EXPECT_GE(its_upper, its_latency);
+            // The buckets are at most 1/16th of the latency wide
+            EXPECT_LE(its_upper - its_latency, its_latency / 16);
+            if (its_index > 0) {
+                EXPECT_LT(latency_histogram::get_upper_bound(its_index - 1), its_latency);
+            }
+        }
+    }
+}
+
+TEST(latency_statistics_test, percentiles) {
+    latency_histogram its_histogram;
+    for (int i = 1; i <= 100; ++i) {
+        its_histogram.record(std::chrono::microseconds(i));
+    }
+    its_histogram.record(-5ns); // counted as 0
+
+    latency_histogram_t its_result;
+    its_histogram.get(its_result);
+    EXPECT_EQ(its_result.count_, 101u);
+    EXPECT_EQ(its_result.min_, 0ns);
+    EXPECT_EQ(its_result.max_, 100us);
+    EXPECT_EQ(its_result.sum_, 5050us);
+
+    const auto its_p50 = latency_histogram::get_percentile(its_result, 50.0);
+    EXPECT_GE(its_p50, 50us);
+    EXPECT_LE(its_p50, 50us + 50us / 16);
+    const auto its_p99 = latency_histogram::get_percentile(its_result, 99.0);
+    EXPECT_GE(its_p99, 99us);
+    EXPECT_LE(its_p99, 100us);
+    EXPECT_EQ(latency_histogram::get_percentile(its_result, 100.0), 100us);
+}
+
+TEST(latency_statistics_test, records_per_method_and_stage) {
+    latency_statistics its_statistics(2);
+
+    its_statistics.record(0x1234, 0x0001, 0x8001, latency_stage_e::LS_QUEUE_TO_HANDLER, 10us);
+    its_statistics.record(0x1234, 0x0001, 0x8001, latency_stage_e::LS_ROUTING_TO_QUEUE, 20us);
+    its_statistics.record(0x1234, 0x0001, 0x8001, latency_stage_e::LS_ROUTING_TO_QUEUE, 30us);
+    its_statistics.record(0x1111, 0x0002, 0x0001, latency_stage_e::LS_SOCKET_TO_ROUTING, 40us);
+    // exceeds the maximum number of methods
+    its_statistics.record(0x2222, 0x0001, 0x0001, latency_stage_e::LS_SOCKET_TO_ROUTING, 50us);
+
+    const auto its_histograms = its_statistics.get();
+    ASSERT_EQ(its_histograms.size(), 3u);
+
+    EXPECT_EQ(its_histograms[0].service_, 0x1111);
+    EXPECT_EQ(its_histograms[0].instance_, 0x0002);
+    EXPECT_EQ(its_histograms[0].method_, 0x0001);
+    EXPECT_EQ(its_histograms[0].stage_, latency_stage_e::LS_SOCKET_TO_ROUTING);
+    EXPECT_EQ(its_histograms[0].count_, 1u);
+
+    EXPECT_EQ(its_histograms[1].service_, 0x1234);
+    EXPECT_EQ(its_histograms[1].method_, 0x8001);
+    EXPECT_EQ(its_histograms[1].stage_, latency_stage_e::LS_ROUTING_TO_QUEUE);
+    EXPECT_EQ(its_histograms[1].count_, 2u);
+    EXPECT_EQ(its_histograms[1].min_, 20us);
+    EXPECT_EQ(its_histograms[1].max_, 30us);
+
+    EXPECT_EQ(its_histograms[2].stage_, latency_stage_e::LS_QUEUE_TO_HANDLER);
+    EXPECT_EQ(its_histograms[2].count_, 1u);
+
+    EXPECT_EQ(its_statistics.get_ignored(), 1u);
+}
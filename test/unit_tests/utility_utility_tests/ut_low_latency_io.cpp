@@ -0,0 +1,96 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include <boost/asio/post.hpp>
+
+#include "../../../implementation/utility/include/low_latency_io.hpp"
+
+using vsomeip_v3::low_latency_io;
+
+TEST(low_latency_io_test, selects_configured_services) {
+    boost::asio::io_context its_io;
+    auto& its_low_latency = boost::asio::use_service<low_latency_io>(its_io);
+    its_low_latency.configure({{0x1234, 0x0001}}, {}, 0);
+
+    EXPECT_TRUE(its_low_latency.is_low_latency(0x1234, 0x0001));
+    EXPECT_FALSE(its_low_latency.is_low_latency(0x1234, 0x0002));
+    EXPECT_FALSE(its_low_latency.is_low_latency(0x4321, 0x0001));
+    EXPECT_EQ(its_low_latency.get_services().size(), 1u);
+    EXPECT_NE(&its_low_latency.get_polled(), &its_io);
+}
+
+TEST(low_latency_io_test, polls_on_dedicated_thread) {
+    boost::asio::io_context its_io;
+    auto& its_low_latency = boost::asio::use_service<low_latency_io>(its_io);
+    its_low_latency.configure({{0x1234, 0x0001}}, {0}, 0);
+    auto& its_polled = its_low_latency.get_polled();
+
+    std::atomic<int> its_count(0);
+    std::atomic<bool> is_other_thread(false);
+    const auto its_id = std::this_thread::get_id();
+    its_low_latency.start("test_ll");
+    boost::asio::post(its_polled, [&] {
+        is_other_thread = (std::this_thread::get_id() != its_id);
+        its_count++;
+    });
+    while (its_count < 1) {
+        std::this_thread::yield();
+    }
+    its_low_latency.stop();
+    EXPECT_TRUE(is_other_thread);
+    EXPECT_TRUE(its_polled.stopped());
+
+    // Handlers posted while stopped run after the restart
+    boost::asio::post(its_polled, [&its_count] { its_count++; });
+    its_low_latency.start("test_ll");
+    while (its_count < 2) {
+        std::this_thread::yield();
+    }
+    its_low_latency.stop();
+    EXPECT_EQ(its_count, 2);
+}
+
+TEST(low_latency_io_test, polls_once_used) {
+    boost::asio::io_context its_io;
+    auto& its_low_latency = boost::asio::use_service<low_latency_io>(its_io);
+    its_low_latency.configure({{0x1234, 0x0001}}, {}, 0);
+
+    // Without endpoints on the polled io_context, no thread is spinning
+    its_low_latency.start("test_ll");
+    EXPECT_FALSE(its_low_latency.is_polling());
+
+    std::atomic<bool> is_called(false);
+    boost::asio::post(its_low_latency.get_polled(), [&is_called] { is_called = true; });
+    EXPECT_TRUE(its_low_latency.is_polling());
+    while (!is_called) {
+        std::this_thread::yield();
+    }
+    its_low_latency.stop();
+    EXPECT_FALSE(its_low_latency.is_polling());
+}
+
+TEST(low_latency_io_test, stops_from_polling_thread) {
+    boost::asio::io_context its_io;
+    auto& its_low_latency = boost::asio::use_service<low_latency_io>(its_io);
+    its_low_latency.configure({{0x1234, 0x0001}}, {}, 0);
+
+    std::atomic<bool> is_stopped(false);
+    its_low_latency.start("test_ll");
+    boost::asio::post(its_low_latency.get_polled(), [&] {
+        its_low_latency.stop();
+        is_stopped = true;
+    });
+    while (!is_stopped) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(its_low_latency.get_polled().stopped());
+    // Joins the polling thread
+    its_low_latency.stop();
+}
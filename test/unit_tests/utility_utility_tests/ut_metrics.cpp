@@ -0,0 +1,156 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+
+#include <vsomeip/constants.hpp>
+
+#include "../../../implementation/utility/include/metrics.hpp"
+#include "../../../implementation/utility/include/metrics_exporter.hpp"
+
+using namespace vsomeip_v3;
+using namespace std::chrono_literals;
+
+TEST(metrics_test, counters_sum_slots_of_all_threads) {
+    metric_counters<2> its_counters;
+
+    constexpr std::size_t its_thread_count(2 * metric_slot_count);
+    constexpr std::uint64_t its_count(1000);
+    std::vector<std::thread> its_threads;
+    for (std::size_t t = 0; t < its_thread_count; ++t) {
+        its_threads.emplace_back([&its_counters, t] {
+            for (std::uint64_t i = 0; i < its_count; ++i) {
+                its_counters.add(0);
+            }
+            its_counters.set_max(1, t);
+        });
+    }
+    for (auto& t : its_threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(its_counters.get(0), its_thread_count * its_count);
+    EXPECT_EQ(its_counters.get_max(1), its_thread_count - 1);
+}
+
+TEST(metrics_test, service_metrics_are_bounded) {
+    service_metrics its_metrics(2);
+
+    its_metrics.record_sent(0x1234, 0x0001, 100);
+    its_metrics.record_sent(0x1234, 0x0001, 50);
+    its_metrics.record_received(0x1234, 0x0001, 16);
+    its_metrics.record_received(0x1111, 0x0002, 20);
+    // exceeds the maximum number of services
+    its_metrics.record_received(0x2222, 0x0001, 30);
+
+    const auto its_services = its_metrics.get();
+    ASSERT_EQ(its_services.size(), 2u);
+
+    EXPECT_EQ(its_services[0].service_, 0x1111);
+    EXPECT_EQ(its_services[0].instance_, 0x0002);
+    EXPECT_EQ(its_services[0].messages_sent_, 0u);
+    EXPECT_EQ(its_services[0].messages_received_, 1u);
+    EXPECT_EQ(its_services[0].bytes_received_, 20u);
+
+    EXPECT_EQ(its_services[1].service_, 0x1234);
+    EXPECT_EQ(its_services[1].instance_, 0x0001);
+    EXPECT_EQ(its_services[1].messages_sent_, 2u);
+    EXPECT_EQ(its_services[1].bytes_sent_, 150u);
+    EXPECT_EQ(its_services[1].messages_received_, 1u);
+    EXPECT_EQ(its_services[1].bytes_received_, 16u);
+
+    EXPECT_EQ(its_metrics.get_ignored(), 1u);
+}
+
+TEST(metrics_test, prometheus_text) {
+    metrics_t its_metrics {};
+
+    endpoint_metrics_t its_endpoint {};
+    its_endpoint.is_reliable_ = true;
+    its_endpoint.is_client_ = true;
+    its_endpoint.local_port_ = 40000;
+    its_endpoint.remote_address_ = "10.0.0.2";
+    its_endpoint.remote_port_ = 30509;
+    its_endpoint.client_ = ILLEGAL_CLIENT;
+    its_endpoint.queue_size_ = 12;
+    its_endpoint.messages_sent_ = 3;
+    its_endpoint.queue_limit_drops_ = 1;
+    its_endpoint.send_drops_ = 2;
+    its_metrics.endpoints_.push_back(its_endpoint);
+
+    endpoint_metrics_t its_local {};
+    its_local.is_local_ = true;
+    its_local.is_client_ = true;
+    its_local.client_ = 0x1343;
+    its_local.messages_received_ = 7;
+    its_metrics.endpoints_.push_back(its_local);
+
+    service_metrics_t its_service {};
+    its_service.service_ = 0x1234;
+    its_service.instance_ = 0x0001;
+    its_service.bytes_sent_ = 64;
+    its_metrics.services_.push_back(its_service);
+
+    its_metrics.dispatched_ = 5;
+    its_metrics.dispatch_wait_sum_ = 1500ms;
+    its_metrics.sd_messages_received_ = 9;
+
+    const auto its_text = to_prometheus(its_metrics, "my \"app\"");
+
+    const std::string its_application("application=\"my \\\"app\\\"\"");
+    EXPECT_NE(its_text.find("# TYPE vsomeip_endpoint_queue_bytes gauge\n"), std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_endpoint_queue_bytes{" + its_application
+                            + ",protocol=\"tcp\",role=\"client\",local_port=\"40000\",peer=\"10.0.0.2:30509\"} 12\n"),
+              std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_endpoint_queue_limit_drops_total{" + its_application
+                            + ",protocol=\"tcp\",role=\"client\",local_port=\"40000\",peer=\"10.0.0.2:30509\"} 1\n"),
+              std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_endpoint_send_drops_total{" + its_application
+                            + ",protocol=\"tcp\",role=\"client\",local_port=\"40000\",peer=\"10.0.0.2:30509\"} 2\n"),
+              std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_endpoint_messages_received_total{" + its_application
+                            + ",protocol=\"local\",role=\"client\",local_port=\"0\",peer=\"1343\"} 7\n"),
+              std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_service_bytes_sent_total{" + its_application + ",service=\"1234\",instance=\"0001\"} 64\n"),
+              std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_dispatched_total{" + its_application + "} 5\n"), std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_dispatch_wait_seconds_total{" + its_application + "} 1.5\n"), std::string::npos);
+    EXPECT_NE(its_text.find("vsomeip_sd_messages_received_total{" + its_application + "} 9\n"), std::string::npos);
+}
+
+#if defined(__linux__) || defined(ANDROID) || defined(__QNX__)
+TEST(metrics_test, exporter_serves_text) {
+    const std::string its_path("/tmp/ut_metrics_exporter");
+    boost::asio::io_context its_io;
+    auto its_exporter = std::make_shared<metrics_exporter>(its_io, its_path, [] { return std::string("vsomeip_dispatched_total 1\n"); });
+    ASSERT_TRUE(its_exporter->start());
+
+    std::thread its_thread([&its_io] { its_io.run(); });
+
+    for (int i = 0; i < 2; ++i) {
+        boost::asio::io_context its_client_io;
+        boost::asio::local::stream_protocol::socket its_socket(its_client_io);
+        its_socket.connect(boost::asio::local::stream_protocol::endpoint(its_path));
+        std::string its_text;
+        boost::system::error_code its_error;
+        boost::asio::read(its_socket, boost::asio::dynamic_buffer(its_text), its_error);
+        EXPECT_EQ(its_error, boost::asio::error::eof);
+        EXPECT_EQ(its_text, "vsomeip_dispatched_total 1\n");
+    }
+
+    its_exporter->stop();
+    its_thread.join();
+    EXPECT_NE(::access(its_path.c_str(), F_OK), 0);
+}
+#endif
@@ -0,0 +1,270 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/asio/ip/address_v4.hpp>
+
+#include <vsomeip/defines.hpp>
+
+#include "../../../implementation/tracing/include/header.hpp"
+#include "../../../implementation/tracing/include/pcapng_writer.hpp"
+
+using namespace vsomeip_v3;
+using vsomeip_v3::trace::pcapng_writer;
+using vsomeip_v3::trace::protocol_e;
+
+namespace {
+
+const char* test_path = "/tmp/ut_pcapng_writer.pcapng";
+
+struct block_t {
+    std::uint32_t type_;
+    std::vector<byte_t> body_;
+};
+
+std::uint32_t read_uint32(const byte_t* _data) {
+    std::uint32_t its_value;
+    std::memcpy(&its_value, _data, sizeof(its_value));
+    return its_value;
+}
+
+std::uint16_t read_uint16(const byte_t* _data) {
+    std::uint16_t its_value;
+    std::memcpy(&its_value, _data, sizeof(its_value));
+    return its_value;
+}
+
+std::vector<block_t> read_blocks(const std::string& _path) {
+    std::ifstream its_file(_path, std::ios_base::binary);
+    std::vector<byte_t> its_data((std::istreambuf_iterator<char>(its_file)), std::istreambuf_iterator<char>());
+
+    std::vector<block_t> its_blocks;
+    std::size_t its_position(0);
+    while (its_position + 12 <= its_data.size()) {
+        const auto its_length = read_uint32(&its_data[its_position + 4]);
+        EXPECT_EQ(its_length % 4, 0u);
+        EXPECT_LE(its_position + its_length, its_data.size());
+        EXPECT_EQ(read_uint32(&its_data[its_position + its_length - 4]), its_length);
+        block_t its_block;
+        its_block.type_ = read_uint32(&its_data[its_position]);
+        its_block.body_.assign(its_data.begin() + static_cast<std::ptrdiff_t>(its_position + 8),
+                               its_data.begin() + static_cast<std::ptrdiff_t>(its_position + its_length - 4));
+        its_blocks.push_back(std::move(its_block));
+        its_position += its_length;
+    }
+    EXPECT_EQ(its_position, its_data.size());
+    return its_blocks;
+}
+
+// The frame of an enhanced packet block
+std::vector<byte_t> get_frame(const block_t& _block) {
+    const auto its_size = read_uint32(&_block.body_[12]);
+    return std::vector<byte_t>(_block.body_.begin() + 20, _block.body_.begin() + 20 + its_size);
+}
+
+std::string get_comment(const block_t& _block) {
+    const auto its_size = read_uint32(&_block.body_[12]);
+    std::size_t its_position = 20 + ((its_size + 3) & ~3u);
+    EXPECT_EQ(read_uint16(&_block.body_[its_position]), 1); // opt_comment
+    const auto its_length = read_uint16(&_block.body_[its_position + 2]);
+    return std::string(reinterpret_cast<const char*>(&_block.body_[its_position + 4]), its_length);
+}
+
+std::vector<byte_t> create_message(service_t _service, method_t _method, client_t _client, std::size_t _payload_size) {
+    std::vector<byte_t> its_message(VSOMEIP_FULL_HEADER_SIZE + _payload_size, 0xAB);
+    its_message[0] = static_cast<byte_t>(_service >> 8);
+    its_message[1] = static_cast<byte_t>(_service & 0xFF);
+    its_message[2] = static_cast<byte_t>(_method >> 8);
+    its_message[3] = static_cast<byte_t>(_method & 0xFF);
+    const auto its_length = static_cast<std::uint32_t>(8 + _payload_size);
+    its_message[4] = 0;
+    its_message[5] = 0;
+    its_message[6] = static_cast<byte_t>(its_length >> 8);
+    its_message[7] = static_cast<byte_t>(its_length & 0xFF);
+    its_message[8] = static_cast<byte_t>(_client >> 8);
+    its_message[9] = static_cast<byte_t>(_client & 0xFF);
+    return its_message;
+}
+
+void remove_files() {
+    std::remove(test_path);
+    for (int i = 1; i <= 3; ++i) {
+        std::remove((std::string(test_path) + "." + std::to_string(i)).c_str());
+    }
+}
+
+} // namespace
+
+TEST(pcapng_writer_test, file_structure) {
+    remove_files();
+
+    const auto its_message = create_message(0x1234, 0x0001, 0x0102, 20);
+    {
+        pcapng_writer its_writer(test_path, 0, 0, 1024 * 1024);
+
+        trace::header its_header;
+        its_header.prepare(boost::asio::ip::make_address_v4("192.168.1.10"), 30501, protocol_e::udp, true, 0x0005);
+        EXPECT_TRUE(its_writer.write(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(),
+                                     static_cast<std::uint32_t>(its_message.size()), false));
+
+        its_header.prepare(boost::asio::ip::make_address_v4("192.168.1.10"), 30502, protocol_e::tcp, false, 0x0005);
+        EXPECT_TRUE(its_writer.write(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(),
+                                     static_cast<std::uint32_t>(its_message.size()), true));
+
+        its_header.prepare(boost::asio::ip::address_v4(), 0, protocol_e::local, true, 0x0006);
+        EXPECT_TRUE(its_writer.write(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(),
+                                     static_cast<std::uint32_t>(its_message.size()), false));
+
+        its_writer.flush();
+        EXPECT_EQ(its_writer.get_dropped(), 0u);
+    }
+
+    const auto its_blocks = read_blocks(test_path);
+    ASSERT_EQ(its_blocks.size(), 5u);
+
+    // Section header and interface description (IPv4 link type)
+    EXPECT_EQ(its_blocks[0].type_, 0x0A0D0D0Au);
+    EXPECT_EQ(read_uint32(&its_blocks[0].body_[0]), 0x1A2B3C4Du);
+    EXPECT_EQ(its_blocks[1].type_, 1u);
+    EXPECT_EQ(read_uint16(&its_blocks[1].body_[0]), 228);
+
+    // UDP datagram to the remote endpoint
+    ASSERT_EQ(its_blocks[2].type_, 6u);
+    auto its_frame = get_frame(its_blocks[2]);
+    ASSERT_EQ(its_frame.size(), 20 + 8 + its_message.size());
+    EXPECT_EQ(its_frame[0], 0x45);
+    EXPECT_EQ(its_frame[9], 17);
+    EXPECT_EQ(std::vector<byte_t>(its_frame.begin() + 16, its_frame.begin() + 20), (std::vector<byte_t>{192, 168, 1, 10}));
+    EXPECT_EQ((its_frame[22] << 8) | its_frame[23], 30501);
+    EXPECT_TRUE(std::equal(its_message.begin(), its_message.end(), its_frame.begin() + 28));
+    EXPECT_EQ(get_comment(its_blocks[2]), "instance 0x0005, udp, sent");
+
+    // TCP segment from the remote endpoint, header only
+    ASSERT_EQ(its_blocks[3].type_, 6u);
+    its_frame = get_frame(its_blocks[3]);
+    ASSERT_EQ(its_frame.size(), 20 + 20 + VSOMEIP_FULL_HEADER_SIZE);
+    EXPECT_EQ(read_uint32(&its_blocks[3].body_[16]), its_frame.size() + 20); // original length
+    EXPECT_EQ(its_frame[9], 6);
+    EXPECT_EQ(std::vector<byte_t>(its_frame.begin() + 12, its_frame.begin() + 16), (std::vector<byte_t>{192, 168, 1, 10}));
+    EXPECT_EQ((its_frame[20] << 8) | its_frame[21], 30502);
+    EXPECT_EQ(get_comment(its_blocks[3]), "instance 0x0005, tcp, received, 20 bytes omitted");
+
+    // Local message as vsomeip SEND command on 127.0.0.1, from the port of the client
+    ASSERT_EQ(its_blocks[4].type_, 6u);
+    its_frame = get_frame(its_blocks[4]);
+    ASSERT_EQ(its_frame.size(), 20 + 20 + 4 + 15 + its_message.size() + 4);
+    EXPECT_EQ(its_frame[9], 6);
+    EXPECT_EQ(std::vector<byte_t>(its_frame.begin() + 12, its_frame.begin() + 20), (std::vector<byte_t>{127, 0, 0, 1, 127, 0, 0, 1}));
+    EXPECT_EQ((its_frame[20] << 8) | its_frame[21], 0x0102);
+    const byte_t* its_command = &its_frame[40];
+    EXPECT_EQ(std::vector<byte_t>(its_command, its_command + 4), (std::vector<byte_t>{0x67, 0x37, 0x6D, 0x07}));
+    EXPECT_EQ(its_command[4], 0x18); // SEND
+    EXPECT_EQ(read_uint16(&its_command[7]), 0x0102); // client (little endian)
+    EXPECT_EQ(read_uint32(&its_command[9]), 6 + its_message.size()); // size (little endian)
+    EXPECT_EQ(read_uint16(&its_command[13]), 0x0006); // instance (little endian)
+    EXPECT_TRUE(std::equal(its_message.begin(), its_message.end(), its_command + 19));
+    EXPECT_EQ(std::vector<byte_t>(its_frame.end() - 4, its_frame.end()), (std::vector<byte_t>{0x07, 0x6D, 0x37, 0x67}));
+    EXPECT_EQ(get_comment(its_blocks[4]), "instance 0x0006, local, sent");
+
+    remove_files();
+}
+
+TEST(pcapng_writer_test, tcp_sequence_numbers) {
+    remove_files();
+
+    const auto its_message = create_message(0x1234, 0x0001, 0x0102, 10);
+    {
+        pcapng_writer its_writer(test_path, 0, 0, 1024 * 1024);
+        trace::header its_header;
+        its_header.prepare(boost::asio::ip::make_address_v4("10.0.0.1"), 30509, protocol_e::tcp, true, 0x0001);
+        for (int i = 0; i < 3; ++i) {
+            its_writer.write(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), static_cast<std::uint32_t>(its_message.size()),
+                             false);
+        }
+        its_writer.flush();
+    }
+
+    const auto its_blocks = read_blocks(test_path);
+    ASSERT_EQ(its_blocks.size(), 5u);
+    for (std::size_t i = 0; i < 3; ++i) {
+        const auto its_frame = get_frame(its_blocks[2 + i]);
+        const std::uint32_t its_sequence = (std::uint32_t(its_frame[24]) << 24) | (std::uint32_t(its_frame[25]) << 16)
+                | (std::uint32_t(its_frame[26]) << 8) | its_frame[27];
+        EXPECT_EQ(its_sequence, i * its_message.size());
+    }
+
+    remove_files();
+}
+
+TEST(pcapng_writer_test, rotation) {
+    remove_files();
+
+    const auto its_message = create_message(0x1234, 0x0001, 0x0102, 200);
+    {
+        // Room for a few packets per file
+        pcapng_writer its_writer(test_path, 1024, 2, 1024 * 1024);
+        trace::header its_header;
+        its_header.prepare(boost::asio::ip::make_address_v4("10.0.0.1"), 30509, protocol_e::udp, true, 0x0001);
+        for (int i = 0; i < 20; ++i) {
+            its_writer.write(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(), static_cast<std::uint32_t>(its_message.size()),
+                             false);
+        }
+        its_writer.flush();
+    }
+
+    for (const auto& its_path : {std::string(test_path), std::string(test_path) + ".1", std::string(test_path) + ".2"}) {
+        std::ifstream its_file(its_path, std::ios_base::binary | std::ios_base::ate);
+        ASSERT_TRUE(its_file.is_open()) << its_path;
+        EXPECT_LE(static_cast<std::uint64_t>(its_file.tellg()), 1024u) << its_path;
+
+        // Every file starts with its own section header and interface description
+        const auto its_blocks = read_blocks(its_path);
+        ASSERT_GE(its_blocks.size(), 3u);
+        EXPECT_EQ(its_blocks[0].type_, 0x0A0D0D0Au);
+        EXPECT_EQ(its_blocks[1].type_, 1u);
+    }
+    EXPECT_FALSE(std::ifstream(std::string(test_path) + ".3").is_open());
+
+    remove_files();
+}
+
+TEST(pcapng_writer_test, bounded_buffer) {
+    remove_files();
+
+    const auto its_message = create_message(0x1234, 0x0001, 0x0102, 1000);
+    const auto its_large_message = create_message(0x1234, 0x0001, 0x0102, 5000);
+    {
+        // Callers fill one half of the budget while the writer owns the other
+        pcapng_writer its_writer(test_path, 0, 0, 8 * 1024);
+        trace::header its_header;
+        its_header.prepare(boost::asio::ip::make_address_v4("10.0.0.1"), 30509, protocol_e::udp, true, 0x0001);
+
+        EXPECT_FALSE(its_writer.write(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_large_message.data(),
+                                      static_cast<std::uint32_t>(its_large_message.size()), false));
+        EXPECT_EQ(its_writer.get_dropped(), 1u);
+
+        std::uint64_t its_accepted(0);
+        for (int i = 0; i < 100; ++i) {
+            if (its_writer.write(its_header.data_, VSOMEIP_TRACE_HEADER_SIZE, its_message.data(),
+                                 static_cast<std::uint32_t>(its_message.size()), false)) {
+                ++its_accepted;
+            }
+        }
+        EXPECT_EQ(its_writer.get_dropped(), 1u + 100u - its_accepted);
+
+        its_writer.flush();
+        EXPECT_EQ(read_blocks(test_path).size(), 2u + its_accepted);
+    }
+
+    remove_files();
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "../../../implementation/utility/include/snapshot.hpp"
+
+using namespace vsomeip_v3;
+
+TEST(snapshot_test, replaced_versions_are_released) {
+    snapshot<std::map<int, int>> its_snapshot;
+    EXPECT_TRUE(its_snapshot.load()->empty());
+
+    auto its_first = std::make_shared<const std::map<int, int>>(std::map<int, int> {{1, 1}});
+    std::weak_ptr<const std::map<int, int>> its_first_weak(its_first);
+    its_snapshot.publish(std::move(its_first));
+    EXPECT_EQ(its_snapshot.load()->at(1), 1);
+
+    its_snapshot.publish(std::make_shared<const std::map<int, int>>(std::map<int, int> {{2, 2}}));
+    // Without readers, the replaced version is deleted by the publish
+    EXPECT_TRUE(its_first_weak.expired());
+    EXPECT_EQ(its_snapshot.load()->count(1), 0u);
+    EXPECT_EQ(its_snapshot.version(), 3u);
+}
+
+TEST(snapshot_test, snapshots_do_not_share_versions) {
+    snapshot<int> its_first;
+    snapshot<int> its_second;
+
+    for (int i = 0; i < 10; ++i) {
+        its_first.publish(std::make_shared<const int>(i));
+        its_second.publish(std::make_shared<const int>(-i));
+        EXPECT_EQ(*its_first.load(), i);
+        EXPECT_EQ(*its_second.load(), -i);
+    }
+}
+
+TEST(snapshot_test, readers_see_consistent_versions_while_publishing) {
+    snapshot<std::vector<int>> its_snapshot;
+    std::atomic<bool> is_running(true);
+    std::atomic<std::uint64_t> its_errors(0);
+
+    std::vector<std::thread> its_readers;
+    for (int r = 0; r < 3; ++r) {
+        its_readers.emplace_back([&] {
+            while (is_running.load(std::memory_order_relaxed)) {
+                const auto its_data = its_snapshot.load();
+                for (const auto v : *its_data) {
+                    if (v != static_cast<int>(its_data->size())) {
+                        its_errors.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    }
+    for (int i = 1; i <= 2000; ++i) {
+        its_snapshot.publish(std::make_shared<const std::vector<int>>(static_cast<std::size_t>(i % 64), i % 64));
+    }
+    is_running = false;
+    for (auto& t : its_readers) {
+        t.join();
+    }
+    EXPECT_EQ(its_errors.load(), 0u);
+}
+
+namespace {
+
+// Counts the versions that are still alive
+struct counted_t {
+    explicit counted_t(int _value = 0) : value_(_value) { alive_.fetch_add(1, std::memory_order_relaxed); }
+    ~counted_t() { alive_.fetch_sub(1, std::memory_order_relaxed); }
+
+    int value_;
+    static std::atomic<int> alive_;
+};
+
+std::atomic<int> counted_t::alive_(0);
+
+} // namespace
+
+TEST(snapshot_test, publish_does_not_wait_for_sustained_readers) {
+    constexpr int its_reader_count(8);
+    {
+        snapshot<counted_t> its_snapshot;
+        its_snapshot.publish(std::make_shared<const counted_t>(0));
+
+        std::atomic<bool> is_running(true);
+        std::atomic<int> its_started(0);
+        std::atomic<std::uint64_t> its_errors(0);
+        std::atomic<int> its_max_alive(0);
+
+        std::vector<std::thread> its_readers;
+        for (int r = 0; r < its_reader_count; ++r) {
+            its_readers.emplace_back([&] {
+                int its_last(0);
+                its_started.fetch_add(1);
+                while (is_running.load(std::memory_order_relaxed)) {
+                    const auto its_data = its_snapshot.load();
+                    // Versions are published in ascending order
+                    if (its_data->value_ < its_last) {
+                        its_errors.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    its_last = its_data->value_;
+                }
+            });
+        }
+        while (its_started.load() < its_reader_count) {
+            std::this_thread::yield();
+        }
+
+        // The readers never pause, so a writer waiting for them would not
+        // make progress. Each reader keeps at most the version it holds and
+        // one announced version alive.
+        for (int i = 1; i <= 20000; ++i) {
+            its_snapshot.publish(std::make_shared<const counted_t>(i));
+            const auto its_alive = counted_t::alive_.load(std::memory_order_relaxed);
+            if (its_alive > its_max_alive.load(std::memory_order_relaxed)) {
+                its_max_alive.store(its_alive, std::memory_order_relaxed);
+            }
+        }
+        is_running = false;
+        for (auto& t : its_readers) {
+            t.join();
+        }
+        EXPECT_EQ(its_errors.load(), 0u);
+        EXPECT_LE(its_max_alive.load(), 2 * its_reader_count + 1);
+        EXPECT_EQ(its_snapshot.load()->value_, 20000);
+
+        // Without readers, the next publish releases all replaced versions
+        its_snapshot.publish(std::make_shared<const counted_t>(20001));
+        EXPECT_EQ(counted_t::alive_.load(), 1);
+    }
+    EXPECT_EQ(counted_t::alive_.load(), 0);
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <vsomeip/internal/logger.hpp>
+
+#include "../../../implementation/configuration/include/configuration_impl.hpp"
+#include "../../../implementation/logger/include/log_writer.hpp"
+
+using vsomeip_v3::logger::argument;
+using vsomeip_v3::logger::level_e;
+using vsomeip_v3::logger::log_record;
+
+namespace {
+
+std::string format(const char* _format, std::initializer_list<argument> _arguments, const std::string& _strings = "") {
+    log_record its_record{level_e::LL_INFO, std::chrono::system_clock::now(), _strings};
+    its_record.format_ = _format;
+    for (const auto& a : _arguments) {
+        its_record.arguments_[its_record.argument_count_++] = a;
+    }
+    std::string its_text;
+    vsomeip_v3::logger::format_structured(its_record, its_text);
+    return its_text;
+}
+
+int evaluated__(0);
+
+int evaluate() {
+    return ++evaluated__;
+}
+
+} // namespace
+
+TEST(structured_logging_test, formats_arguments) {
+    EXPECT_EQ(format("[{:04x}.{:04x}.{:x}]", {std::uint16_t(0x1234), std::uint16_t(0x5), 0xabcu}), "[1234.0005.abc]");
+    EXPECT_EQ(format("{} {} {} {}", {-42, std::uint32_t(42), true, 1.5}), "-42 42 true 1.5");
+    EXPECT_EQ(format("{:4}|", {7}), "   7|");
+    // String arguments are stored one after the other in the text of the record
+    EXPECT_EQ(format("{} and {}", {std::string("first"), std::string("second")}, "firstsecond"), "first and second");
+    // Missing arguments leave the placeholder in the line
+    EXPECT_EQ(format("{} {}", {1}), "1 {}");
+    EXPECT_EQ(format("no arguments", {}), "no arguments");
+}
+
+TEST(structured_logging_test, suppressed_lines_are_not_formatted) {
+    const auto its_base = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("ut_structured_logging_%%%%%%%%");
+    const std::string its_logfile(its_base.string() + ".log");
+    const std::string its_path(its_base.string() + ".json");
+    {
+        std::ofstream its_file(its_path);
+        its_file << "{ \"logging\" : { \"level\" : \"info\", \"console\" : \"false\", \"file\" : { \"enable\" : \"true\", \"path\" : \""
+                 << its_logfile << "\" } } }";
+    }
+    auto its_configuration = std::make_shared<vsomeip_v3::cfg::configuration_impl>(its_path);
+    its_configuration->load("ut_structured_logging");
+    boost::filesystem::remove(its_path);
+
+    EXPECT_TRUE(vsomeip_v3::logger::is_enabled(level_e::LL_INFO));
+    EXPECT_FALSE(vsomeip_v3::logger::is_enabled(level_e::LL_DEBUG));
+
+    evaluated__ = 0;
+    VSOMEIP_DEBUG << "suppressed " << evaluate();
+    VSOMEIP_DEBUG_F("suppressed {}", evaluate());
+    EXPECT_EQ(evaluated__, 0);
+
+    VSOMEIP_INFO << "streamed " << evaluate();
+    VSOMEIP_INFO_F("structured [{:04x}] {}", 0x12, std::string("text"));
+    EXPECT_EQ(evaluated__, 1);
+
+    // Loading the configuration logged as well
+    std::ifstream its_file(its_logfile);
+    std::vector<std::string> its_lines;
+    for (std::string its_line; std::getline(its_file, its_line);) {
+        EXPECT_EQ(its_line.find("suppressed"), std::string::npos);
+        its_lines.push_back(its_line.substr(26));
+    }
+    ASSERT_GE(its_lines.size(), 2u);
+    EXPECT_EQ(its_lines[its_lines.size() - 2], " [info] streamed 1");
+    EXPECT_EQ(its_lines.back(), " [info] structured [0012] text");
+
+    boost::filesystem::remove(its_logfile);
+}
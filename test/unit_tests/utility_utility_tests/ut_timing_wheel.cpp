@@ -0,0 +1,168 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+
+#include "../../../implementation/utility/include/timing_wheel.hpp"
+
+using vsomeip_v3::timing_wheel;
+using vsomeip_v3::wheel_timer;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct expiry_t {
+    int id_;
+    std::chrono::steady_clock::time_point deadline_;
+    std::chrono::steady_clock::time_point expiry_;
+    boost::system::error_code error_;
+};
+
+class timing_wheel_test : public ::testing::Test {
+protected:
+    timing_wheel_test() : wheel_(boost::asio::use_service<timing_wheel>(io_)) { }
+
+    timing_wheel::timer_id_t schedule(int _id, std::chrono::steady_clock::time_point _deadline) {
+        return wheel_.schedule(_deadline, [this, _id, _deadline](const boost::system::error_code& _error) {
+            expiries_.push_back({_id, _deadline, std::chrono::steady_clock::now(), _error});
+        });
+    }
+
+    boost::asio::io_context io_;
+    timing_wheel& wheel_;
+    std::vector<expiry_t> expiries_;
+};
+}
+
+TEST_F(timing_wheel_test, firing_order) {
+    const auto its_now = std::chrono::steady_clock::now();
+    for (const int its_id : {5, 1, 3, 2, 4}) {
+        schedule(its_id, its_now + its_id * 2ms);
+    }
+    EXPECT_EQ(wheel_.size(), 5u);
+
+    io_.run();
+
+    ASSERT_EQ(expiries_.size(), 5u);
+    for (std::size_t i = 0; i < expiries_.size(); ++i) {
+        EXPECT_EQ(expiries_[i].id_, static_cast<int>(i + 1));
+        EXPECT_FALSE(expiries_[i].error_);
+        EXPECT_GE(expiries_[i].expiry_, expiries_[i].deadline_);
+    }
+    EXPECT_EQ(wheel_.size(), 0u);
+}
+
+TEST_F(timing_wheel_test, cascade_across_levels) {
+    // First level (< 25.6ms), second level (< 1.6s) and third level
+    const auto its_now = std::chrono::steady_clock::now();
+    schedule(3, its_now + 1700ms);
+    schedule(2, its_now + 60ms);
+    schedule(1, its_now + 10ms);
+
+    io_.run();
+
+    ASSERT_EQ(expiries_.size(), 3u);
+    for (std::size_t i = 0; i < expiries_.size(); ++i) {
+        EXPECT_EQ(expiries_[i].id_, static_cast<int>(i + 1));
+        EXPECT_FALSE(expiries_[i].error_);
+        EXPECT_GE(expiries_[i].expiry_, expiries_[i].deadline_);
+        EXPECT_LT(expiries_[i].expiry_, expiries_[i].deadline_ + 100ms);
+    }
+}
+
+TEST_F(timing_wheel_test, wakes_up_for_occupied_slots_only) {
+    // A deadline in the third level must not wake the wheel every rotation
+    // of the first level, but at the earliest when its slot is cascaded.
+    const auto its_now = std::chrono::steady_clock::now();
+    schedule(1, its_now + 1700ms);
+
+    const auto its_wakeup = wheel_.get_next_wakeup();
+    EXPECT_GT(its_wakeup, its_now + 50ms);
+    EXPECT_LE(its_wakeup, its_now + 1700ms + timing_wheel::resolution);
+
+    io_.run_for(25ms);
+    EXPECT_TRUE(expiries_.empty());
+    EXPECT_EQ(wheel_.get_next_wakeup(), its_wakeup);
+}
+
+TEST_F(timing_wheel_test, cancel_after_due) {
+    const auto its_now = std::chrono::steady_clock::now();
+
+    // Expired when scheduled
+    const auto its_expired = schedule(1, its_now - 1ms);
+
+    // Expires while the io_context does not run
+    const auto its_due = schedule(2, its_now + 1ms);
+    std::this_thread::sleep_for(5ms);
+
+    EXPECT_TRUE(wheel_.cancel(its_expired));
+    EXPECT_TRUE(wheel_.cancel(its_due));
+    EXPECT_FALSE(wheel_.cancel(its_due));
+    EXPECT_EQ(wheel_.size(), 0u);
+
+    io_.run();
+    ASSERT_EQ(expiries_.size(), 2u);
+    EXPECT_EQ(expiries_[0].error_, boost::asio::error::operation_aborted);
+    EXPECT_EQ(expiries_[1].error_, boost::asio::error::operation_aborted);
+
+    // Cancelling a handler that was called fails
+    expiries_.clear();
+    io_.restart();
+    const auto its_called = schedule(3, std::chrono::steady_clock::now() + 1ms);
+    io_.run();
+    ASSERT_EQ(expiries_.size(), 1u);
+    EXPECT_FALSE(expiries_[0].error_);
+    EXPECT_FALSE(wheel_.cancel(its_called));
+}
+
+TEST_F(timing_wheel_test, deadline_beyond_wheel) {
+    // 2^26 ticks of 0.1ms are about 1.9 hours
+    const auto its_now = std::chrono::steady_clock::now();
+    const auto its_far = schedule(1, its_now + 3h);
+    const auto its_edge = schedule(2, its_now + timing_wheel::resolution * (1 << 26));
+
+    // Parked in the last level, so there is no wake up within the next hour
+    EXPECT_GT(wheel_.get_next_wakeup(), its_now + 1h);
+
+    io_.run_for(50ms);
+    EXPECT_TRUE(expiries_.empty());
+    EXPECT_EQ(wheel_.size(), 2u);
+
+    // Moving the handler keeps it, it is called once for the new deadline
+    EXPECT_TRUE(wheel_.reschedule(its_far, std::chrono::steady_clock::now() + 5ms));
+    EXPECT_TRUE(wheel_.cancel(its_edge));
+
+    io_.restart();
+    io_.run();
+    ASSERT_EQ(expiries_.size(), 2u);
+    EXPECT_EQ(expiries_[0].id_, 2);
+    EXPECT_EQ(expiries_[0].error_, boost::asio::error::operation_aborted);
+    EXPECT_EQ(expiries_[1].id_, 1);
+    EXPECT_FALSE(expiries_[1].error_);
+}
+
+TEST_F(timing_wheel_test, wheel_timer_reschedule) {
+    wheel_timer its_timer(io_);
+    std::vector<boost::system::error_code> its_errors;
+
+    EXPECT_FALSE(its_timer.reschedule(std::chrono::steady_clock::now()));
+
+    its_timer.expires_after(1h);
+    its_timer.async_wait([&its_errors](const boost::system::error_code& _error) { its_errors.push_back(_error); });
+    EXPECT_TRUE(its_timer.reschedule(std::chrono::steady_clock::now() + 2ms));
+
+    io_.run();
+    ASSERT_EQ(its_errors.size(), 1u);
+    EXPECT_FALSE(its_errors[0]);
+
+    // The wait is done, a new one is needed
+    EXPECT_FALSE(its_timer.reschedule(std::chrono::steady_clock::now()));
+}
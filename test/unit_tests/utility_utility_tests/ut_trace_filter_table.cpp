@@ -0,0 +1,115 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "../../../implementation/tracing/include/filter_table.hpp"
+
+using namespace vsomeip_v3;
+using vsomeip_v3::trace::channel_impl;
+using vsomeip_v3::trace::filter_rules_t;
+using vsomeip_v3::trace::filter_table;
+using vsomeip_v3::trace::filter_type_e;
+
+namespace {
+
+// Channels with positive, negative, header-only, wildcard and range filters
+std::vector<filter_rules_t> create_channels() {
+    channel_impl its_all("ALL", "no filter");
+
+    channel_impl its_positive("POS", "positive");
+    its_positive.add_filter(trace::match_t{0x1234, ANY_INSTANCE, ANY_METHOD}, filter_type_e::POSITIVE);
+    its_positive.add_filter(trace::match_t{0x2000, 0x0001, 0x8001}, filter_type_e::HEADER_ONLY);
+    its_positive.add_filter(trace::match_t{0x1234, 0x0002, 0x0003}, filter_type_e::NEGATIVE);
+
+    channel_impl its_range("RANGE", "range");
+    its_range.add_filter(trace::match_t{0x1000, 0x0001, 0x0001}, trace::match_t{0x1fff, 0x0010, 0x7fff}, filter_type_e::POSITIVE);
+    its_range.add_filter(std::vector<trace::match_t>{{ANY_SERVICE, 0x0005, ANY_METHOD}, {0x3000, ANY_INSTANCE, 0x0001}},
+                         filter_type_e::NEGATIVE);
+
+    channel_impl its_header_only("HDR", "header only");
+    its_header_only.add_filter(trace::match_t{ANY_SERVICE, ANY_INSTANCE, 0x8001}, filter_type_e::HEADER_ONLY);
+
+    return {its_all.get_filters(), its_positive.get_filters(), its_range.get_filters(), its_header_only.get_filters()};
+}
+
+// Collects the decisions of the table as two bit masks
+std::pair<std::uint64_t, std::uint64_t> lookup(const filter_table& _table, service_t _service, instance_t _instance, method_t _method) {
+    std::pair<std::uint64_t, std::uint64_t> its_result{0, 0};
+    _table.for_each_match(_service, _instance, _method, [&its_result](std::size_t _channel, bool _is_header_only) {
+        its_result.first |= (std::uint64_t(1) << _channel);
+        if (_is_header_only) {
+            its_result.second |= (std::uint64_t(1) << _channel);
+        }
+    });
+    return its_result;
+}
+
+std::pair<std::uint64_t, std::uint64_t> evaluate(const std::vector<filter_rules_t>& _channels, service_t _service, instance_t _instance,
+                                                 method_t _method) {
+    std::pair<std::uint64_t, std::uint64_t> its_result{0, 0};
+    for (std::size_t c = 0; c < _channels.size(); ++c) {
+        const auto its_match = channel_impl::matches(_channels[c], _service, _instance, _method);
+        if (its_match.first) {
+            its_result.first |= (std::uint64_t(1) << c);
+            if (!its_match.second) {
+                its_result.second |= (std::uint64_t(1) << c);
+            }
+        }
+    }
+    return its_result;
+}
+
+} // namespace
+
+TEST(trace_filter_table_test, matches_channel_filters) {
+    const auto its_channels = create_channels();
+    const filter_table its_table{std::vector<filter_rules_t>(its_channels)};
+    ASSERT_TRUE(its_table.is_compiled());
+
+    // Boundaries of the filters and their neighbours
+    const std::vector<std::uint16_t> its_values{0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0010, 0x0011, 0x0fff,
+                                                0x1000, 0x1233, 0x1234, 0x1235, 0x1fff, 0x2000, 0x2001, 0x3000, 0x7fff, 0x8000,
+                                                0x8001, 0x8002, 0xfffe, 0xffff};
+    for (auto s : its_values) {
+        for (auto i : its_values) {
+            for (auto m : its_values) {
+                ASSERT_EQ(lookup(its_table, s, i, m), evaluate(its_channels, s, i, m)) << std::hex << s << "." << i << "." << m;
+            }
+        }
+    }
+
+    std::mt19937 its_random(42);
+    std::uniform_int_distribution<std::uint32_t> its_distribution(0, 0xffff);
+    for (int n = 0; n < 100000; ++n) {
+        const auto s = static_cast<service_t>(its_distribution(its_random));
+        const auto i = static_cast<instance_t>(its_distribution(its_random));
+        const auto m = static_cast<method_t>(its_distribution(its_random));
+        ASSERT_EQ(lookup(its_table, s, i, m), evaluate(its_channels, s, i, m)) << std::hex << s << "." << i << "." << m;
+    }
+
+    // Spot checks of the expected semantics: a channel without positive
+    // filters forwards all messages that no header-only filter matches
+    EXPECT_EQ(lookup(its_table, 0x1234, 0x0001, 0x0001), std::make_pair(std::uint64_t(0b1111), std::uint64_t(0)));
+    EXPECT_EQ(lookup(its_table, 0x1234, 0x0002, 0x0003), std::make_pair(std::uint64_t(0b1101), std::uint64_t(0)));
+    EXPECT_EQ(lookup(its_table, 0x2000, 0x0001, 0x8001), std::make_pair(std::uint64_t(0b1011), std::uint64_t(0b1010)));
+}
+
+TEST(trace_filter_table_test, falls_back_with_many_channels) {
+    std::vector<filter_rules_t> its_channels;
+    for (std::size_t c = 0; c < filter_table::max_channels + 2; ++c) {
+        channel_impl its_channel(std::to_string(c), "");
+        its_channel.add_filter(trace::match_t{static_cast<service_t>(c), ANY_INSTANCE, ANY_METHOD}, filter_type_e::POSITIVE);
+        its_channels.push_back(its_channel.get_filters());
+    }
+    const filter_table its_table{std::move(its_channels)};
+    EXPECT_FALSE(its_table.is_compiled());
+
+    std::vector<std::size_t> its_matches;
+    its_table.for_each_match(65, 1, 1, [&its_matches](std::size_t _channel, bool) { its_matches.push_back(_channel); });
+    EXPECT_EQ(its_matches, std::vector<std::size_t>{65});
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2025 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "../../implementation/utility/include/configuration_cache.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+
+namespace {
+
+void print_help(const char* _name) {
+    std::cout << "Parses a vsomeip configuration and stores the parsed trees in a binary image that" << std::endl
+              << "applications read instead of parsing the JSON files if VSOMEIP_CONFIGURATION_CACHE" << std::endl
+              << "points to it. The applications still evaluate the trees as usual." << std::endl
+              << std::endl
+              << "Usage: " << _name << " --output <image> <file or folder>..." << std::endl
+              << std::endl
+              << "The files and folders must be the ones the applications read, e.g. the value of" << std::endl
+              << "VSOMEIP_CONFIGURATION and, if existing, its <uid>_<gid> security sub folder." << std::endl
+              << std::endl
+              << "--output, -o: path of the image" << std::endl
+              << "--help, -h: print this help" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string its_output;
+    std::set<std::string> its_input;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg == "--help" || arg == "-h") {
+            print_help(argv[0]);
+            return EXIT_SUCCESS;
+        } else if (arg == "--output" || arg == "-o") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing path of the image" << std::endl;
+                return EXIT_FAILURE;
+            }
+            its_output = argv[++i];
+        } else {
+            its_input.insert(arg);
+        }
+    }
+
+    if (its_output.empty() || its_input.empty()) {
+        print_help(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::string its_error;
+    if (!vsomeip_v3::configuration_cache::create(its_input, its_output, its_error)) {
+        std::cerr << "Failed to create the image: " << its_error << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Stored " << vsomeip_v3::configuration_cache::get_files(its_input).size() << " configuration file(s) into \""
+              << its_output << "\"" << std::endl;
+    return EXIT_SUCCESS;
+}
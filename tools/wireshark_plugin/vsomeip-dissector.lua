@@ -930,6 +930,10 @@ function vsomeip_protocol.dissector(buffer, packet_info, root_tree)
     while buffer ~= nil do
         -- Check if it's a vsomeip packet
         if not is_vsomeip_packet(buffer) then
+            if vsomeip_packets_counter == 0 then
+                -- Leave other TCP payloads (e.g. SOME/IP) to their dissectors
+                return 0
+            end
             return
         end
 